@@ -6,22 +6,31 @@
  *   
  */
 
-#define HIGH_WATER_MARK_LOOP_SKIP 120
+#define HIGH_WATER_MARK_LOOP_SKIP 120    // idle loop iterations between metrics reports, about 30s
 #define BAUD_RATE 115200
 
 #include "Arduino.h"
+#ifdef ARDUINO
 #include "ESP.h"
-#include <SPI.h>
+#endif
 
 // C99 libraries
 #include <cstdlib>
 #include <string.h>
 #include <time.h>
 
-#include "src/logging/SerialLogger.h"
+#include "src/logging/log.h"
+#include "src/logging/flight_recorder.h"
 #include "src/controller/controller.h"
+#include "src/metrics/metrics.h"
+#include "src/metrics/trace.h"
+#include "src/hal/hal.h"
+#ifdef LATHE_SIMULATOR
+#include "src/simulator/lathe_simulator.h"
+#endif
 
 #define VERSION "0.99.00"
+#define COMMAND_SIZE 32
 
 #ifdef SET_LOOP_TASK_STACK_SIZE
 SET_LOOP_TASK_STACK_SIZE(16384);
@@ -31,6 +40,41 @@ SET_LOOP_TASK_STACK_SIZE(16384);
 #endif
 
 Controller *controller = NULL;
+#ifdef LATHE_SIMULATOR
+Lathe_Simulator *simulator = NULL;
+#endif
+char command[COMMAND_SIZE];
+size_t command_length = 0;
+Task_Metric loop_metric("loopTask");
+unsigned int loop_count = 0;
+
+/**
+ * @brief Executes a command received on the serial console
+ * @param command - the command line
+ */
+void execute_command(const char* command)
+{
+  if(strcmp(command, "dump") == 0) Recorder.request_dump();
+  else if(strcmp(command, "metrics") == 0) Metrics.report();
+  else if(strcmp(command, "histograms") == 0) Metrics.report_histograms();
+  else if(strcmp(command, "trace") == 0)
+  {
+    if(Trace.is_running()) Trace.stop();
+    else Trace.start();
+    LOG_INFO(SYSTEM, "Trace %s", Trace.is_running() ? "started, convert the capture with tools/trace_to_chrome.py" : "stopped");
+  }
+  else if(strncmp(command, "filter", 6) == 0 && (command[6] == 0 || command[6] == ' '))
+  {
+    // filter <name> selects the RPM filter, filter alone shows the active one
+    const char* name = command[6] == ' ' ? command + 7 : "";
+    int filter = 0;
+    while(filter < RPM_FILTER_COUNT && strcmp(name, RPM_Estimator::get_filter_name((rpm_filter)filter)) != 0) filter++;
+    if(filter < RPM_FILTER_COUNT) controller->set_rpm_filter((rpm_filter)filter);
+    else if(name[0] != 0) LOG_WARN(SYSTEM, "Unknown RPM filter, use: none, average, median, ema, alpha-beta");
+    else LOG_INFO(SYSTEM, "RPM filter %s", RPM_Estimator::get_filter_name(controller->get_rpm_filter()));
+  }
+  else if(command[0] != 0) LOG_WARN(SYSTEM, "Unknown command, use: dump, metrics, histograms, trace, filter");
+}
 
 /**
  * @brief Performs system setup activities, including connecting to WIFI, setting time, obtaining the IoTHub info 
@@ -43,23 +87,59 @@ void setup()
   //
   // Initialize configuration data from EEPROM
   //
+#ifdef LATHE_SIMULATOR
+  hal_host_time_scale(SIM_SPEEDUP);
+    // must be set before anything reads the clock
+#endif
   Logger.SetSpeed(BAUD_RATE);
+#ifndef ARDUINO
+  hal_host_partition_create(FLIGHT_LOG_PARTITION, FLIGHT_LOG_SIZE);
+#endif
+  bool recording = Recorder.begin();
+  if(recording) Logger.SetRecorder(&Recorder);
+  Logger.Begin();
+    // from here on messages are written by the drain task, callers only queue them
+  Metrics.begin();
+  Metrics.add_task(&loop_metric, hal_task_current());
+  Trace.begin();
+  Trace.add_task(hal_task_current(), "loopTask");
 
-  Logger.Info_f(F("Copyright 2025, Thor Schueler, Firmware Version: %s"), VERSION);
-  Logger.Info_f(F("Loop task stack size: %i"), getArduinoLoopTaskStackSize());
-  Logger.Info_f(F("Loop task stack high water mark: %i"), uxTaskGetStackHighWaterMark(NULL));
-  Logger.Info_f(F("Total heap: %d"), ESP.getHeapSize()); 
-  Logger.Info_f(F("Free heap: %d"), ESP.getFreeHeap()); 
-  Logger.Info_f(F("Total PSRAM: %d"), ESP.getPsramSize()); 
-  Logger.Info_f(F("Free PSRAM: %d"), ESP.getFreePsram());
-  Logger.Info(F(""));
-  Logger.Info(F(""));
+  LOG_INFO(SYSTEM, "Copyright 2025, Thor Schueler, Firmware Version: %s", VERSION);
+  if(recording) LOG_INFO(SYSTEM, "Flight recorder: %u sectors at sequence %u, send \"dump\" to read them", Recorder.get_sectors(), Recorder.get_sequence());
+  else LOG_ERROR(SYSTEM, "Flight recorder: partition " FLIGHT_LOG_PARTITION " not available");
+  LOG_INFO(SYSTEM, "Send \"metrics\" for the load of the tasks and interrupts, reported every %i loops", HIGH_WATER_MARK_LOOP_SKIP);
+#ifdef ARDUINO
+  LOG_INFO(SYSTEM, "Loop task stack size: %i", getArduinoLoopTaskStackSize());
+  LOG_INFO(SYSTEM, "Loop task stack high water mark: %i", uxTaskGetStackHighWaterMark(NULL));
+  LOG_INFO(SYSTEM, "Total heap: %d", ESP.getHeapSize()); 
+  LOG_INFO(SYSTEM, "Free heap: %d", ESP.getFreeHeap()); 
+  LOG_INFO(SYSTEM, "Total PSRAM: %d", ESP.getPsramSize()); 
+  LOG_INFO(SYSTEM, "Free PSRAM: %d", ESP.getFreePsram());
+#endif
+  LOG_INFO(SYSTEM, "");
+  LOG_INFO(SYSTEM, "");
   
-
+#ifdef LATHE_SIMULATOR
+#ifdef SIM_SOAK
+  simulator = new Lathe_Simulator(soak_scenario, soak_scenario_size);
+#else
+  simulator = new Lathe_Simulator(default_scenario, default_scenario_size);
+#endif
+  simulator->begin();
+#endif
   controller = new Controller();
-  Logger.Info(F("Init done"));
-  Logger.Info_f(F("Free heap: %d"), ESP.getFreeHeap()); 
-  Logger.Info(F(""));
+#ifdef LATHE_SIMULATOR
+  simulator->start(controller);
+#endif
+  LOG_INFO(SYSTEM, "Init done");
+#ifdef ARDUINO
+  LOG_INFO(SYSTEM, "Free heap: %d", ESP.getFreeHeap()); 
+#if HAL_STATIC_ALLOCATION
+  LOG_INFO(SYSTEM, "Static arena: %u of %u bytes used", (unsigned)hal_static_used(), HAL_STATIC_ARENA_SIZE);
+  if(hal_static_overflows() > 0) LOG_WARN(SYSTEM, "Static arena: %u objects did not fit and are on the heap", (unsigned)hal_static_overflows());
+#endif
+#endif
+  LOG_INFO(SYSTEM, "");
 }
 
 /**
@@ -69,5 +149,20 @@ void setup()
  */
 void loop()
 {
-  vTaskDelay(1000);
+  char received[COMMAND_SIZE];
+  loop_metric.wake();
+  size_t n = hal_serial_read(received, sizeof(received));
+  for(size_t i = 0; i < n; i++)
+  {
+    if(received[i] == '\r' || received[i] == '\n')
+    {
+      command[command_length] = 0;
+      execute_command(command);
+      command_length = 0;
+    }
+    else if(command_length < COMMAND_SIZE - 1) command[command_length++] = received[i];
+  }
+  if(++loop_count % HIGH_WATER_MARK_LOOP_SKIP == 0) Metrics.report();
+  loop_metric.sleep();
+  hal_delay_ms(n > 0 ? 10 : 250);
 }
@@ -23,156 +23,132 @@ POSSIBILITY OF SUCH DAMAGE.
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
-#include <FunctionalInterrupt.h>
-#include <freertos/FreeRTOS.h>
-#include <freertos/task.h>
 #include "controller.h"
-#include "../logging/SerialLogger.h"
-#include <portmacro.h>
-extern "C" {
-  #include <driver/timer.h>
-  #include <soc/gpio_struct.h>
-}
+#include "../hal/hal.h"
+#include "../logging/log.h"
+#include "../metrics/trace.h"
 
 
-portMUX_TYPE _hall_mux = portMUX_INITIALIZER_UNLOCKED;
 static Controller *_instance = nullptr;
+static ISR_Metric input_isr("inputISR");
+static ISR_Metric energize_isr("energizeISR");
+TRACE_POINT(trace_display_frame, "displayFrame");
+TRACE_POINT(trace_display_mutex, "displayMutex");
+TRACE_POINT(trace_input, "input");
+TRACE_POINT(trace_energize, "energize");
+TRACE_POINT(trace_deenergize, "deEnergize");
+TRACE_POINT(trace_power_loss, "powerLoss");
+TRACE_POINT(trace_relays, "directionRelays");
+TRACE_POINT(trace_emergency, "emergency");
+TRACE_POINT(trace_rpm, "calculateRpm");
+TRACE_POINT(trace_input_isr, "inputISR");
+TRACE_POINT(trace_energize_isr, "energizeISR");
 
 /**
  * @brief Creates a new instance of Controller
  */
 Controller::Controller()
 {
-    Logger.Info(F("Startup"));
-    Logger.Info(F("....Initialize Display"));
+    LOG_INFO(CONTROLLER, "Startup");
+    LOG_INFO(CONTROLLER, "....Initialize Display");
     _display = new Controller_Display();
     _display->init();
     _instance = this;
 
-    Logger.Info(F("....Inititialize GPIO pins"));
-    pinMode(I_MAIN_POWER, INPUT_PULLUP);
-    pinMode(I_EMS, INPUT);
-    pinMode(I_ENERGIZE, INPUT);
-    pinMode(I_FOR_F, INPUT);
-    pinMode(I_FOR_B, INPUT);
-    pinMode(I_LIGHT, INPUT_PULLUP);
-    pinMode(I_BACKLIGHT, INPUT_PULLDOWN); 
-    pinMode(I_LUBE, INPUT_PULLUP);
-    pinMode(I_CONTROLBOARD_DETECT, INPUT_PULLDOWN);
-    pinMode(I_SPINDLE_PULSE, INPUT_PULLUP);
-
-
-    pinMode(O_SPINDLE_DIRECTION_SWITCH_A, OUTPUT);
-    pinMode(O_SPINDLE_DIRECTION_SWITCH_B, OUTPUT);
-    pinMode(O_SPINDLE_OFF, OUTPUT);
-    pinMode(O_ENGINE_DISCHARGE, OUTPUT);
-
-    Logger.Info(F("....Attach event receivers for GPIO"));
-    attachInterrupt(digitalPinToInterrupt(I_MAIN_POWER), std::bind(&Controller::handle_input, this), CHANGE);
-    attachInterrupt(digitalPinToInterrupt(I_EMS), std::bind(&Controller::handle_input, this), CHANGE);
-    attachInterrupt(digitalPinToInterrupt(I_FOR_F), std::bind(&Controller::handle_input, this), CHANGE);
-    attachInterrupt(digitalPinToInterrupt(I_FOR_B), std::bind(&Controller::handle_input, this), CHANGE);
-    attachInterrupt(digitalPinToInterrupt(I_LIGHT), std::bind(&Controller::handle_input, this), CHANGE);
-    attachInterrupt(digitalPinToInterrupt(I_LUBE), std::bind(&Controller::handle_input, this), CHANGE);
-    attachInterrupt(digitalPinToInterrupt(I_BACKLIGHT), std::bind(&Controller::handle_input, this), CHANGE);
-    attachInterrupt(digitalPinToInterrupt(I_ENERGIZE), std::bind(&Controller::handle_energize, this), FALLING);    
-    attachInterrupt(digitalPinToInterrupt(I_CONTROLBOARD_DETECT), std::bind(&Controller::handle_input, this), RISING);
-        // we only process rising (the signal is inverted) here as an interrupt as the control board might shut off 
-        // due to overload and we need to be informed of that. All falling is initiated by us, so 
-        // we do not need an interrupt for that. 
-
-    Logger.Info("....Initializing counter timer");    
-    timer_config_t cnt_config = 
-    {
-        .alarm_en = TIMER_ALARM_DIS,
-        .counter_en = TIMER_PAUSE,
-        .counter_dir = TIMER_COUNT_UP,
-        .auto_reload = TIMER_AUTORELOAD_DIS,
-        .divider = TIMER_DIVIDER,
-    };
-    timer_init(TIMER_GROUP, TIMER_COUNTER, &cnt_config);
-    timer_set_counter_value(TIMER_GROUP, TIMER_COUNTER, 0);
-    timer_start(TIMER_GROUP, TIMER_COUNTER);
-
-    if(USE_POLLING_FOR_RPM)
-    {
-        Logger.Info(F("     Not using interrupt for RPM sensing. Instead create RPM sample timer"));
-        timer_config_t rpm_config = 
-        {
-            .alarm_en = TIMER_ALARM_EN,
-            .counter_en = TIMER_PAUSE,
-            .counter_dir = TIMER_COUNT_UP,
-            .auto_reload = TIMER_AUTORELOAD_EN,
-            .divider = TIMER_DIVIDER,
-        };
-        timer_init(TIMER_GROUP, TIMER_RPM, &rpm_config);
-        timer_set_counter_value(TIMER_GROUP, TIMER_RPM, 0);
-        timer_set_alarm_value(TIMER_GROUP, TIMER_RPM, HALL_POLLING_INTERVAL_US);
-        timer_enable_intr(TIMER_GROUP, TIMER_RPM);
-        timer_isr_callback_add(TIMER_GROUP, TIMER_RPM, Controller::read_hall_sensor, this, ESP_INTR_FLAG_IRAM);
-        timer_start(TIMER_GROUP, TIMER_RPM);
-    }
-    else
-    {
-        Logger.Info_f(F("     Register Interrupt Handler for Hall Sensor on pin %i"), I_SPINDLE_PULSE);
-        attachInterrupt(digitalPinToInterrupt(I_SPINDLE_PULSE), std::bind(&Controller::handle_spindle_pulse, this), FALLING);
-    }
+    LOG_INFO(CONTROLLER, "....Inititialize GPIO pins");
+    hal_gpio_mode(I_MAIN_POWER, HAL_PIN_INPUT_PULLUP);
+    hal_gpio_mode(I_EMS, HAL_PIN_INPUT);
+    hal_gpio_mode(I_ENERGIZE, HAL_PIN_INPUT);
+    hal_gpio_mode(I_FOR_F, HAL_PIN_INPUT);
+    hal_gpio_mode(I_FOR_B, HAL_PIN_INPUT);
+    hal_gpio_mode(I_LIGHT, HAL_PIN_INPUT_PULLUP);
+    hal_gpio_mode(I_BACKLIGHT, HAL_PIN_INPUT_PULLDOWN); 
+    hal_gpio_mode(I_LUBE, HAL_PIN_INPUT_PULLUP);
+    hal_gpio_mode(I_CONTROLBOARD_DETECT, HAL_PIN_INPUT_PULLDOWN);
+    hal_gpio_mode(I_SPINDLE_PULSE, HAL_PIN_INPUT_PULLUP);
+
+
+    hal_gpio_mode(O_SPINDLE_DIRECTION_SWITCH_A, HAL_PIN_OUTPUT);
+    hal_gpio_mode(O_SPINDLE_DIRECTION_SWITCH_B, HAL_PIN_OUTPUT);
+    hal_gpio_mode(O_SPINDLE_OFF, HAL_PIN_OUTPUT);
+    hal_gpio_mode(O_ENGINE_DISCHARGE, HAL_PIN_OUTPUT);
+
+    LOG_INFO(CONTROLLER, "....Initializing counter timer");    
+    hal_timer_init();
+
+    _rpm_source = RPM_Source::create(RPM_ACQUISITION_MODE, I_SPINDLE_PULSE);
+        // started by the RPM task, so its interrupts run on the control core
     
-    Logger.Info("....Initializing Relays");
-    digitalWrite(O_ENGINE_DISCHARGE, LOW); 
-    digitalWrite(O_SPINDLE_OFF, LOW);
-    digitalWrite(O_SPINDLE_DIRECTION_SWITCH_A, LOW);
-    digitalWrite(O_SPINDLE_DIRECTION_SWITCH_B, LOW);
-
-    Logger.Info("....Initializing Input Values");  
-    _main_power = digitalRead(I_MAIN_POWER);
-    _has_emergency = digitalRead(I_EMS);
-    _toggle_energize = !digitalRead(I_ENERGIZE);
-    _for_f = digitalRead(I_FOR_F);
-    _for_b = digitalRead(I_FOR_B);
-    _light = digitalRead(I_LIGHT);
-    _backlight = digitalRead(I_BACKLIGHT);
-    _lube = digitalRead(I_LUBE);
-    _is_energized = !digitalRead(I_CONTROLBOARD_DETECT);
-    if(_for_f)
+    LOG_INFO(CONTROLLER, "....Initializing Relays");
+    hal_gpio_write(O_ENGINE_DISCHARGE, false); 
+    hal_gpio_write(O_SPINDLE_OFF, false);
+    hal_gpio_write(O_SPINDLE_DIRECTION_SWITCH_A, false);
+    hal_gpio_write(O_SPINDLE_DIRECTION_SWITCH_B, false);
+
+    LOG_INFO(CONTROLLER, "....Initializing Input Values");  
+    machine_state s;
+    _toggle_energize = !hal_gpio_read(I_ENERGIZE);
+    s.main_power = hal_gpio_read(I_MAIN_POWER);
+    s.has_emergency = hal_gpio_read(I_EMS);
+    s.for_f = hal_gpio_read(I_FOR_F);
+    s.for_b = hal_gpio_read(I_FOR_B);
+    s.light = hal_gpio_read(I_LIGHT);
+    s.backlight = hal_gpio_read(I_BACKLIGHT);
+    s.lube = hal_gpio_read(I_LUBE);
+    s.is_energized = !hal_gpio_read(I_CONTROLBOARD_DETECT);
+    if(s.for_f)
     {
-        this->_direction_a.desired = false;
-        this->_direction_b.desired = false;
-        this->_common.desired = true;
+        s.direction_a.desired = false;
+        s.direction_b.desired = false;
+        s.common.desired = true;
     }
-    else if(_for_b)
+    else if(s.for_b)
     {
-        this->_direction_a.desired = true;
-        this->_direction_b.desired = true;
-        this->_common.desired = true;
+        s.direction_a.desired = true;
+        s.direction_b.desired = true;
+        s.common.desired = true;
     }
     else
     {
-        this->_direction_a.desired = false;
-        this->_direction_b.desired = false;
-        this->_common.desired = false;        
+        s.direction_a.desired = false;
+        s.direction_b.desired = false;
+        s.common.desired = false;        
     }
-    Logger.Info_f(F("         Main Power: %s"), _main_power ? "Off" : "On");
-    Logger.Info_f(F("         Energize Toggled: %s"), _toggle_energize ? "Yes" : "No");
-    Logger.Info_f(F("         Emergency Shutdown: %s"), _has_emergency ? "On" : "Off");
-    Logger.Info_f(F("         Forward Selector: %s"), _for_f ? "On" : "Off");      
-    Logger.Info_f(F("         Backward Selector: %s"), _for_b ? "On" : "Off");    
-    Logger.Info_f(F("         Light: %s"), _light ? "Off" : "On");
-    Logger.Info_f(F("         Backlight: %s"), _backlight ? "On" : "Off");  
-    Logger.Info_f(F("         Lube: %s"), _lube ? "Off" : "On");
-    Logger.Info_f(F("         Energized: %s"), _is_energized ? "HOT" : "COLD");
-
-    Logger.Info(F("....Generating Mutexes"));
-    _display_mutex = xSemaphoreCreateBinary();  xSemaphoreGive(_display_mutex);
-
-    Logger.Info("....Create various tasks");
-    xTaskCreatePinnedToCore(display_runner, "displayRunner", 8192, this, 1, &_display_runner, 0);
-    xTaskCreatePinnedToCore(input_runner, "inputRunner", 2048, this, configMAX_PRIORITIES-1, &_input_runner, 0);
-    xTaskCreatePinnedToCore(rpm_runner, "rpmRunner", 2048, this, configMAX_PRIORITIES-1, &_rpm_runner, 0);
-
-    Logger.Info("Startup done");
-    Logger.Info("");
-    Logger.Info("");
+    LOG_INFO(CONTROLLER, "         Main Power: %s", s.main_power ? "Off" : "On");
+    LOG_INFO(CONTROLLER, "         Energize Toggled: %s", _toggle_energize ? "Yes" : "No");
+    LOG_INFO(CONTROLLER, "         Emergency Shutdown: %s", s.has_emergency ? "On" : "Off");
+    LOG_INFO(CONTROLLER, "         Forward Selector: %s", s.for_f ? "On" : "Off");      
+    LOG_INFO(CONTROLLER, "         Backward Selector: %s", s.for_b ? "On" : "Off");    
+    LOG_INFO(CONTROLLER, "         Light: %s", s.light ? "Off" : "On");
+    LOG_INFO(CONTROLLER, "         Backlight: %s", s.backlight ? "On" : "Off");  
+    LOG_INFO(CONTROLLER, "         Lube: %s", s.lube ? "Off" : "On");
+    LOG_INFO(CONTROLLER, "         Energized: %s", s.is_energized ? "HOT" : "COLD");
+    _state.publish(s);
+
+    LOG_INFO(CONTROLLER, "....Generating Mutexes");
+    _display_mutex = hal_sem_create();  hal_sem_give(_display_mutex);
+    _display_events = hal_events_create();
+    post_display(DISPLAY_EVENT_STATE);
+        // draws the first frame
+
+    LOG_INFO(CONTROLLER, "....Create various tasks, control on core %d, display on core %d", CONTROL_CORE, DISPLAY_CORE);
+    _display_runner = hal_task_create(display_runner, "displayRunner", DISPLAY_TASK_STACK, this, DISPLAY_TASK_PRIORITY, DISPLAY_CORE);
+    _input_runner = hal_task_create(input_runner, "inputRunner", INPUT_TASK_STACK, this, INPUT_TASK_PRIORITY, CONTROL_CORE);
+    _rpm_runner = hal_task_create(rpm_runner, "rpmRunner", RPM_TASK_STACK, this, RPM_TASK_PRIORITY, CONTROL_CORE);
+    hal_task_notify(_input_runner);
+        // the input task attaches the interrupt handlers only now, they notify it through _input_runner
+    Metrics.add_task(&_display_metric, _display_runner);
+    Metrics.add_task(&_input_metric, _input_runner);
+    Metrics.add_task(&_rpm_metric, _rpm_runner);
+    Metrics.add_isr(&input_isr);
+    Metrics.add_isr(&energize_isr);
+    Trace.add_task(_display_runner, "displayRunner");
+    Trace.add_task(_input_runner, "inputRunner");
+    Trace.add_task(_rpm_runner, "rpmRunner");
+
+    LOG_INFO(CONTROLLER, "Startup done");
+    LOG_INFO(CONTROLLER, "");
+    LOG_INFO(CONTROLLER, "");
 }
 
 /**
@@ -180,150 +156,113 @@ Controller::Controller()
  */
 Controller::~Controller()
 {
-    Logger.Info(F("Destruct controller client and clean up resources"));
-    Logger.Info(F("     Remove tasks"));
-    if(this->_display_runner != NULL) vTaskDelete(this->_display_runner);
-    if(this->_input_runner != NULL) vTaskDelete(this->_input_runner);
-    if(this->_rpm_runner != NULL) vTaskDelete(this->_rpm_runner);
+    LOG_INFO(CONTROLLER, "Destruct controller client and clean up resources");
+    LOG_INFO(CONTROLLER, "     Remove tasks");
+    Metrics.remove_task(this->_display_runner);
+    Metrics.remove_task(this->_input_runner);
+    Metrics.remove_task(this->_rpm_runner);
+    if(this->_display_runner != NULL) hal_task_delete(this->_display_runner);
+    if(this->_input_runner != NULL) hal_task_delete(this->_input_runner);
+    if(this->_rpm_runner != NULL) hal_task_delete(this->_rpm_runner);
     this->_display_runner = NULL;
     this->_input_runner = NULL;
     this->_rpm_runner = NULL;
 
-    Logger.Info(F("     Remove Counter timer"));
-    timer_pause(TIMER_GROUP, TIMER_COUNTER);
-    timer_set_counter_value(TIMER_GROUP, TIMER_COUNTER, 0);
+    LOG_INFO(CONTROLLER, "     Remove Counter timer");
+    hal_timer_deinit();
 
-    if(USE_POLLING_FOR_RPM)
+    if(_rpm_source != nullptr)
     {
-        Logger.Info(F("     Remove RPM timer"));
-        timer_pause(TIMER_GROUP, TIMER_RPM);
-        timer_disable_intr(TIMER_GROUP, TIMER_RPM);
-        timer_set_counter_value(TIMER_GROUP, TIMER_RPM, 0);
-        timer_set_alarm_value(TIMER_GROUP, TIMER_RPM, 0);
-    }
-    else
-    {
-        Logger.Info(F("     Remove RPM hall sensor interrupt"));
-        detachInterrupt(digitalPinToInterrupt(I_SPINDLE_PULSE));
+        _rpm_source->end();
+        delete _rpm_source;
+        _rpm_source = nullptr;
     }
 
-    Logger.Info(F("     Remove interrupts"));
-    detachInterrupt(digitalPinToInterrupt(I_MAIN_POWER));
-    detachInterrupt(digitalPinToInterrupt(I_EMS));
-    detachInterrupt(digitalPinToInterrupt(I_FOR_F));
-    detachInterrupt(digitalPinToInterrupt(I_FOR_B));
-    detachInterrupt(digitalPinToInterrupt(I_LIGHT));
-    detachInterrupt(digitalPinToInterrupt(I_ENERGIZE));
-    detachInterrupt(digitalPinToInterrupt(I_BACKLIGHT));
-    detachInterrupt(digitalPinToInterrupt(I_LUBE));
-    detachInterrupt(digitalPinToInterrupt(I_CONTROLBOARD_DETECT));
+    LOG_INFO(CONTROLLER, "     Remove interrupts");
+    hal_gpio_detach(I_MAIN_POWER);
+    hal_gpio_detach(I_EMS);
+    hal_gpio_detach(I_FOR_F);
+    hal_gpio_detach(I_FOR_B);
+    hal_gpio_detach(I_LIGHT);
+    hal_gpio_detach(I_ENERGIZE);
+    hal_gpio_detach(I_BACKLIGHT);
+    hal_gpio_detach(I_LUBE);
+    hal_gpio_detach(I_CONTROLBOARD_DETECT);
 }
 
 
 /**
- * @brief Task function managing the display
+ * @brief Task function managing the display. Blocks until display events are posted, draws emergency and
+ * state changes right away and RPM changes at most DISPLAY_MAX_FPS times a second.
  * @param args - pointer to task arguments
  */
 void Controller::display_runner(void* args)
 {
     Controller *_this = reinterpret_cast<Controller *>(args);
-    unsigned int rpm = 0;
-    word state = 0b1000000000000000;
-        //         |      ||||||||+---- had_emergency
-        //         |      |||||||+----- power state
-        //         |      ||||||+------ engine energized state
-        //         |      |||||+------- for_f state
-        //         |      ||||+-------- for_b state
-        //         |      |||+--------- light state
-        //         |      ||+---------- backlight state
-        //         |      |+----------- lube state 
-        //         |      +------------ has deferred action
-        //         +------------------- is first
-
-    int count = 0;
+    bool is_first = true;
+    bool had_emergency = false;
+    uint64_t last_frame = 0;
     for (;;) 
     { 
-        if (xSemaphoreTake(_this->_display_mutex, portMAX_DELAY) == pdTRUE) 
+        uint32_t events = hal_events_wait(_this->_display_events, DISPLAY_EVENT_ALL, HAL_WAIT_FOREVER);
+        uint64_t elapsed = hal_timer_us() - last_frame;
+        if(events == DISPLAY_EVENT_RPM && elapsed < DISPLAY_FRAME_US)
+        {
+            // only the RPM changed, so hold the frame until the frame interval passed. Further RPM changes are
+            // picked up by this frame, emergencies and state changes cut the wait short.
+            events |= hal_events_wait(_this->_display_events, DISPLAY_EVENT_EMERGENCY | DISPLAY_EVENT_STATE, 
+                (DISPLAY_FRAME_US - elapsed + 999) / 1000);
+            hal_events_wait(_this->_display_events, DISPLAY_EVENT_RPM, 0);
+        }
+        last_frame = hal_timer_us();
+        _this->_display_metric.wake();
+        TRACE_ENTER(trace_display_frame);
+
+        machine_state s = _this->_state.read();
+            // one consistent snapshot per frame, the input task may publish a new one while we draw
+        bool locked;
         {
-            if(_this->_has_emergency)
+            TRACE_SCOPE(trace_display_mutex);
+            locked = hal_sem_take(_this->_display_mutex, HAL_WAIT_FOREVER);
+        }
+        if (locked) 
+        {
+            if(s.has_emergency)
             {
-                // draw emergency shutdown screen
-                _this->_display->write_emergency();
-                state |= (1 << 0);
+                // draw emergency shutdown screen once
+                if(!had_emergency) _this->_display->write_emergency();
+                had_emergency = true;
             }
             else
             {
-                if(((state >> 0) & 0x1) || ((state >> 15) & 0x1))
+                if(had_emergency || is_first)
                 {
-                    //restore display background after emergency and reset state
+                    //restore display background after emergency, this invalidates all widgets
                     _this->_display->update_background();
-                    state = 0b1000000000000000;
-                }
-
-                if(_this->_rpm != rpm || ((state >> 15) & 0x1))
-                {
-                    // write RPMs to display
-                    rpm = _this->_rpm;
-                        // it is important to catpure the rpm here as the write RPM takes some time, 
-                        // during which the rpm might change again. This might lead to a situation where
-                        // the display is never updated as the rpm changes again before we write it, especially if
-                        // no new pulses come in (rpm == 0)
-                    _this->_display->write_rpm(_this->_rpm);
-                    _this->_display->update_scale(_this->_rpm);
+                    had_emergency = false;
+                    is_first = false;
                 }
 
-                if(((state >> 1) & 0x1) != _this->_main_power || ((state >> 2) & 0x1) != _this->_is_energized || ((state >> 15) & 0x1))
-                {
-                    // update engine energized state
-                    _this->_display->update_engine_state(_this->_is_energized);
-
-                    // update power state
-                    _this->_display->update_power_state(_this->_main_power);
-                
-                    state = (state & ~(1 << 1)) | (_this->_main_power << 1);
-                    state = (state & ~(1 << 2)) | (_this->_is_energized << 2);
-                }
-
-                if(((state >> 3) & 0x1) != _this->_for_f || ((state >> 4) & 0x1) != _this->_for_b || ((state >> 15) & 0x1))
-                {
-                    // update FOR state
-                    _this->_display->update_for_state(_this->_for_f, _this->_for_b);
-                    state = (state & ~(1 << 3)) | (_this->_for_f << 3);
-                    state = (state & ~(1 << 4)) | (_this->_for_b << 4);
-                }
-
-                if(((state >> 5) & 0x1) != _this->_light || ((state >> 15) & 0x1))
-                {
-                    // update light state
-                    _this->_display->update_light_state(_this->_light);
-                    state = (state & ~(1 << 5)) | (_this->_light << 5);
-                }
-          
-                if(((state >> 6) & 0x1) != _this->_backlight || ((state >> 15) & 0x1))
-                {
-                    // update backlight state
-                    _this->_display->update_back_light(_this->_backlight);
-                    state = (state & ~(1 << 6)) | (_this->_backlight << 6);
-                }
-
-                if(((state >> 7) & 0x1) != _this->_lube || ((state >> 15) & 0x1))
-                {
-                    // update lube state
-                    _this->_display->update_lube_state(_this->_lube);
-                    state = (state & ~(1 << 7)) | (_this->_lube << 7);
-                }
-
-                if(((state >> 8) & 0x1) != _this->_has_deferred_action)
-                {
-                    // update warning area
-                    _this->_display->update_warning(_this->_has_deferred_action);
-                    state = (state & ~(1 << 8)) | (_this->_has_deferred_action << 8);
-                }
+                // hand the current state to the display. Only widgets whose state changed are invalidated, 
+                // and only the invalidated regions are drawn with the frame.
+                unsigned int rpm = _this->_rpm;
+                    // it is important to catpure the rpm here as it might change while we update the display, 
+                    // which would leave digits and scale out of sync.
+                _this->_display->write_rpm(rpm);
+                _this->_display->update_scale(rpm);
+                _this->_display->update_engine_state(s.is_energized);
+                _this->_display->update_power_state(s.main_power);
+                _this->_display->update_for_state(s.for_f, s.for_b);
+                _this->_display->update_light_state(s.light);
+                _this->_display->update_back_light(s.backlight);
+                _this->_display->update_lube_state(s.lube);
+                _this->_display->update_warning(s.has_deferred_action);
+                _this->_display->render_frame();
             }
-            xSemaphoreGive(_this->_display_mutex);
+            hal_sem_give(_this->_display_mutex);
         }
-        state &= ~(1 << 15);
-        vTaskDelay(DISPLAY_REFRESH);
+        TRACE_LEAVE(trace_display_frame);
+        _this->_display_metric.sleep();
     }
 }
 
@@ -338,118 +277,130 @@ void Controller::input_runner(void* args)
     static int index = 0;
     bool external_power_loss = false;
     Controller *_this = reinterpret_cast<Controller *>(args);
+    hal_task_wait(HAL_WAIT_FOREVER);
+        // the task may run before hal_task_create returned, so it waits for the constructor to set _input_runner
+    _this->attach_interrupts();
+        // the loop reads all inputs before it first waits, so no edge before this point is lost
     for (;;) 
     { 
+        _this->_input_metric.wake();
+        TRACE_ENTER(trace_input);
         bool should_print = false;
+        machine_state s = _this->_state.read();
+            // this task is the only writer, so the last published state is the working copy
+        bool had_emergency = s.has_emergency;
 
         //
         // read input states
         //
-        vTaskDelay(pdMS_TO_TICKS(DEBOUNCE_MS));
-        _this->_direction_a.reported = digitalRead(O_SPINDLE_DIRECTION_SWITCH_A);
-        _this->_direction_b.reported = digitalRead(O_SPINDLE_DIRECTION_SWITCH_B);
-        _this->_common.reported = digitalRead(O_SPINDLE_OFF);
-        _this->_deenergize.reported = digitalRead(O_ENGINE_DISCHARGE);
-        if(digitalRead(I_MAIN_POWER) != _this->_main_power) 
+        hal_delay_ms(DEBOUNCE_MS);
+        s.direction_a.reported = hal_gpio_read(O_SPINDLE_DIRECTION_SWITCH_A);
+        s.direction_b.reported = hal_gpio_read(O_SPINDLE_DIRECTION_SWITCH_B);
+        s.common.reported = hal_gpio_read(O_SPINDLE_OFF);
+        s.deenergize.reported = hal_gpio_read(O_ENGINE_DISCHARGE);
+        if(hal_gpio_read(I_MAIN_POWER) != s.main_power) 
         {
-            _this->_main_power = !_this->_main_power;
+            s.main_power = !s.main_power;
             should_print = true;
-            Logger.Info_f(F("Main Power changed to: %s"), _this->_main_power ? "Off" : "On");
+            LOG_INFO(CONTROLLER, "Main Power changed to: %s", s.main_power ? "Off" : "On");
         }
-        if(digitalRead(I_EMS) != _this->_has_emergency) 
+        if(hal_gpio_read(I_EMS) != s.has_emergency) 
         {
-            _this->_has_emergency = !_this->_has_emergency;
+            s.has_emergency = !s.has_emergency;
             should_print = true;
-            Logger.Info_f(F("EMS changed to: %s"), _this->_has_emergency ? "Shutdown" : "Energize");
+            LOG_INFO(CONTROLLER, "EMS changed to: %s", s.has_emergency ? "Shutdown" : "Energize");
         }
-        if(digitalRead(I_LIGHT) != _this->_light) 
+        if(hal_gpio_read(I_LIGHT) != s.light) 
         {
-            _this->_light = !_this->_light;
-            Logger.Info_f(F("Light toggled: %s"), _this->_light ? "Off" : "On");
+            s.light = !s.light;
+            LOG_INFO(CONTROLLER, "Light toggled: %s", s.light ? "Off" : "On");
         }
-        if(digitalRead(I_BACKLIGHT) != _this->_backlight) 
+        if(hal_gpio_read(I_BACKLIGHT) != s.backlight) 
         {
-            _this->_backlight = !_this->_backlight;
-            Logger.Info_f(F("Backlight toggled: %s"), _this->_backlight ? "On" : "Off");
+            s.backlight = !s.backlight;
+            LOG_INFO(CONTROLLER, "Backlight toggled: %s", s.backlight ? "On" : "Off");
         }
-        if(digitalRead(I_LUBE) != _this->_lube) 
+        if(hal_gpio_read(I_LUBE) != s.lube) 
         {
-            _this->_lube = !_this->_lube;
-            Logger.Info_f(F("Lubrication toggled: %s"), _this->_lube ? "Off" : "On");
+            s.lube = !s.lube;
+            LOG_INFO(CONTROLLER, "Lubrication toggled: %s", s.lube ? "Off" : "On");
         }
-        if(digitalRead(I_FOR_F))
+        if(hal_gpio_read(I_FOR_F))
         {
-            _this->_for_f = true;
-            _this->_for_b = false;
-            _this->_direction_a.desired = false;
-            _this->_direction_b.desired = false;
-            _this->_common.desired = true;
-            if(_this->_direction_a.reported != false || _this->_direction_b.reported != false || _this->_common.reported != true)
+            s.for_f = true;
+            s.for_b = false;
+            s.direction_a.desired = false;
+            s.direction_b.desired = false;
+            s.common.desired = true;
+            if(s.direction_a.reported != false || s.direction_b.reported != false || s.common.reported != true)
             {
                 should_print = true;
-                Logger.Info(F("Direction changed to: Forward"));
+                LOG_INFO(CONTROLLER, "Direction changed to: Forward");
             }
         }
-        else if(digitalRead(I_FOR_B))
+        else if(hal_gpio_read(I_FOR_B))
         {
-            _this->_for_f = false;
-            _this->_for_b = true;
-            _this->_direction_a.desired = true;
-            _this->_direction_b.desired = true;
-            _this->_common.desired = true;
-            if(_this->_direction_a.reported != true || _this->_direction_b.reported != true || _this->_common.reported != true)
+            s.for_f = false;
+            s.for_b = true;
+            s.direction_a.desired = true;
+            s.direction_b.desired = true;
+            s.common.desired = true;
+            if(s.direction_a.reported != true || s.direction_b.reported != true || s.common.reported != true)
             {
                 should_print = true;
-                Logger.Info(F("Direction changed to: Backward"));
+                LOG_INFO(CONTROLLER, "Direction changed to: Backward");
             }
         }
         else
         {
-            _this->_for_f = false;
-            _this->_for_b = false;
-            _this->_direction_a.desired = false;
-            _this->_direction_b.desired = false;
-            _this->_common.desired = false;
-            if(_this->_direction_a.reported != false || _this->_direction_b.reported != false || _this->_common.reported != false)
+            s.for_f = false;
+            s.for_b = false;
+            s.direction_a.desired = false;
+            s.direction_b.desired = false;
+            s.common.desired = false;
+            if(s.direction_a.reported != false || s.direction_b.reported != false || s.common.reported != false)
             {
                 should_print = true;
-                Logger.Info(F("Direction changed to: Neutral"));
+                LOG_INFO(CONTROLLER, "Direction changed to: Neutral");
             }
         }
-        if(digitalRead(I_CONTROLBOARD_DETECT) == HIGH && !_this->_toggle_energize && _this->_is_energized)
+        if(hal_gpio_read(I_CONTROLBOARD_DETECT) && !_this->_toggle_energize && s.is_energized)
         {
             // if we read high here, than there is no voltage on the control board. If this happens without 
             // _toggle_energize being true while _is_energized, then the board has shutdown power basd on current or voltage
             // draw. So we need to "fake" de-energizing...  
             external_power_loss = true;
-            Logger.Info(F("Received control board power loss trigger: Shutting down..."));
+            LOG_WARN(CONTROLLER, "Received control board power loss trigger: Shutting down...");
         }
+        _this->_state.publish(s);
+        _this->post_display(s.has_emergency != had_emergency ? DISPLAY_EVENT_EMERGENCY : DISPLAY_EVENT_STATE);
+            // show the new switch positions before acting on them, that takes up to seconds
 
         //
         // take appropriate action
         //
-        _this->_common.desired = (!_this->_for_b && !_this->_for_f) ? false : true;
-        if(!_this->_has_emergency)
+        s.common.desired = (!s.for_b && !s.for_f) ? false : true;
+        if(!s.has_emergency)
         {
             if(_this->_toggle_energize)
             {
                 _this->_toggle_energize = false;
-                if(!_this->_main_power)
+                if(!s.main_power)
                 {
                     unsigned int loop_break_counter = 0;
                     unsigned int stabilization_counter = 0;
                     byte reg = 0x0;
 
-                    gpio_intr_disable(static_cast<gpio_num_t>(I_ENERGIZE));
+                    hal_gpio_interrupt(I_ENERGIZE, false);
                         // disable the interrupt during processing as there might be a lot of noise 
                         // coming on that pin during startup/shutdown.
 
                     do{
-                        bool val = !digitalRead(I_ENERGIZE);            // I_ENERGIZE reads low if the button us pressed
+                        bool val = !hal_gpio_read(I_ENERGIZE);            // I_ENERGIZE reads low if the button us pressed
                         reg = reg << 1;                                 // left shift register
                         reg |= val ?  1 << 0 : 0 << 0;                  // set least signifcant bit based on read value
                         stabilization_counter++;
-                        vTaskDelay(pdMS_TO_TICKS(1));              
+                        hal_delay_ms(1);              
                     }
                     while(reg != 0xff && stabilization_counter < 40);
                         // delay any action until the button press on Energize is released
@@ -457,130 +408,163 @@ void Controller::input_runner(void* args)
                         // do make sure we are not being hit by bounce.  
                     if(stabilization_counter < 40)
                     {
-                        if(_this->_is_energized)
+                        if(s.is_energized)
                         {
-                            Logger.Info_f("    De-Energizing engine...");
-                            gpio_intr_disable(static_cast<gpio_num_t>(I_CONTROLBOARD_DETECT));  
+                            TRACE_SCOPE(trace_deenergize);
+                            LOG_INFO(CONTROLLER, "    De-Energizing engine...");
+                            hal_gpio_interrupt(I_CONTROLBOARD_DETECT, false);  
                                 // temporarily disable interrupt to prevent double processing
-                            digitalWrite(O_ENGINE_DISCHARGE, HIGH);
+                            hal_gpio_write(O_ENGINE_DISCHARGE, true);
                             do { 
-                                _this->_is_energized = !digitalRead(I_CONTROLBOARD_DETECT); 
+                                s.is_energized = !hal_gpio_read(I_CONTROLBOARD_DETECT); 
                                 loop_break_counter++;
-                                vTaskDelay(10);
+                                hal_delay_ms(10);
                             }
-                            while (_this->_is_energized && loop_break_counter < 1000);
-                            if(!_this->_is_energized) Logger.Info("    Engine is now de-energized.");
+                            while (s.is_energized && loop_break_counter < 1000);
+                            _this->_state.publish(s);
+                            if(!s.is_energized) LOG_INFO(CONTROLLER, "    Engine is now de-energized.");
                             else
                             {
-                                Logger.Error("    Engine was not de-energized after waiting for 10sec. Check engine.");
+                                LOG_ERROR(CONTROLLER, "    Engine was not de-energized after waiting for 10sec. Check engine.");
                             }
-                            digitalWrite(O_ENGINE_DISCHARGE, LOW);
-                            vTaskDelay(pdMS_TO_TICKS(250));
-                            gpio_intr_enable(static_cast<gpio_num_t>(I_CONTROLBOARD_DETECT));
+                            hal_gpio_write(O_ENGINE_DISCHARGE, false);
+                            hal_delay_ms(250);
+                            hal_gpio_interrupt(I_CONTROLBOARD_DETECT, true);
                                 // re-enable interrupt
                         }
                         else
                         {
-                            Logger.Info_f("    Energizing engine...");
+                            TRACE_SCOPE(trace_energize);
+                            LOG_INFO(CONTROLLER, "    Energizing engine...");
                             do { 
                                 // power on happens on the motor control board, we just wait until we read the voltage
-                                _this->_is_energized = !digitalRead(I_CONTROLBOARD_DETECT);
+                                s.is_energized = !hal_gpio_read(I_CONTROLBOARD_DETECT);
                                 loop_break_counter++;
-                                vTaskDelay(10); 
+                                hal_delay_ms(10); 
                             }
-                            while (!_this->_is_energized && loop_break_counter < 1000);
-                            if(_this->_is_energized) Logger.Info("    Engine is now energized.");
+                            while (!s.is_energized && loop_break_counter < 1000);
+                            _this->_state.publish(s);
+                            if(s.is_energized) LOG_INFO(CONTROLLER, "    Engine is now energized.");
                             else
                             {
-                                Logger.Error("    Engine was not energized after waiting for 10sec. Check engine.");
+                                LOG_ERROR(CONTROLLER, "    Engine was not energized after waiting for 10sec. Check engine.");
                             }
                         }
                     }
                     else
                     {
-                        Logger.Info(F("Could not obtain stable reading on I_ENERGIZE. Cancelling transaction without change."));
-                        if(!_this->_is_energized && digitalRead(I_CONTROLBOARD_DETECT) == LOW)
+                        LOG_WARN(CONTROLLER, "Could not obtain stable reading on I_ENERGIZE. Cancelling transaction without change.");
+                        if(!s.is_energized && !hal_gpio_read(I_CONTROLBOARD_DETECT))
                         {
-                            digitalWrite(O_ENGINE_DISCHARGE, HIGH);
-                            vTaskDelay(pdMS_TO_TICKS(250));
-                            digitalWrite(O_ENGINE_DISCHARGE, LOW);
+                            hal_gpio_write(O_ENGINE_DISCHARGE, true);
+                            hal_delay_ms(250);
+                            hal_gpio_write(O_ENGINE_DISCHARGE, false);
                         }
                     }
-                    gpio_intr_enable(static_cast<gpio_num_t>(I_ENERGIZE));
+                    hal_gpio_interrupt(I_ENERGIZE, true);
                 }
             }
         
             if(external_power_loss)
             {
+                TRACE_SCOPE(trace_power_loss);
                 unsigned int loop_break_counter = 0;
-                Logger.Info(F("Responding to control board power loss trigger."));
+                LOG_INFO(CONTROLLER, "Responding to control board power loss trigger.");
                 do { 
-                    _this->_is_energized = !digitalRead(I_CONTROLBOARD_DETECT); 
+                    s.is_energized = !hal_gpio_read(I_CONTROLBOARD_DETECT); 
                     loop_break_counter++;
-                    vTaskDelay(10);
+                    hal_delay_ms(10);
                 }
-                while (_this->_is_energized && loop_break_counter < 1000);
+                while (s.is_energized && loop_break_counter < 1000);
                     // confirm control board is indeed de-energized.
+                _this->_state.publish(s);
                 external_power_loss = false;
             }
 
-            if(!_this->_is_energized)
+            if(!s.is_energized)
             {
-                gpio_intr_disable(static_cast<gpio_num_t>(I_ENERGIZE));  
+                TRACE_SCOPE(trace_relays);
+                hal_gpio_interrupt(I_ENERGIZE, false);  
                                 // temporarily disable interrupt to prevent induction lead processing
-                digitalWrite(O_ENGINE_DISCHARGE, LOW);        
-                if(_this->_direction_a.desired != _this->_direction_a.reported) { digitalWrite(O_SPINDLE_DIRECTION_SWITCH_A, _this->_direction_a.desired); should_print = true; }
-                if(_this->_direction_b.desired != _this->_direction_b.reported) { digitalWrite(O_SPINDLE_DIRECTION_SWITCH_B, _this->_direction_b.desired); should_print = true; }
-                if(_this->_common.desired != _this->_common.reported) { digitalWrite(O_SPINDLE_OFF, _this->_common.desired); should_print = true; }
-                _this->_direction_a.reported = digitalRead(O_SPINDLE_DIRECTION_SWITCH_A);
-                _this->_direction_b.reported = digitalRead(O_SPINDLE_DIRECTION_SWITCH_B);
-                _this->_common.reported = digitalRead(O_SPINDLE_OFF);
-                _this->_deenergize.reported = digitalRead(O_ENGINE_DISCHARGE);
-                _this->_has_deferred_action = false;
-                vTaskDelay(pdMS_TO_TICKS(250));
-                gpio_intr_enable(static_cast<gpio_num_t>(I_ENERGIZE));
+                hal_gpio_write(O_ENGINE_DISCHARGE, false);        
+                if(s.direction_a.desired != s.direction_a.reported) { hal_gpio_write(O_SPINDLE_DIRECTION_SWITCH_A, s.direction_a.desired); should_print = true; }
+                if(s.direction_b.desired != s.direction_b.reported) { hal_gpio_write(O_SPINDLE_DIRECTION_SWITCH_B, s.direction_b.desired); should_print = true; }
+                if(s.common.desired != s.common.reported) { hal_gpio_write(O_SPINDLE_OFF, s.common.desired); should_print = true; }
+                s.direction_a.reported = hal_gpio_read(O_SPINDLE_DIRECTION_SWITCH_A);
+                s.direction_b.reported = hal_gpio_read(O_SPINDLE_DIRECTION_SWITCH_B);
+                s.common.reported = hal_gpio_read(O_SPINDLE_OFF);
+                s.deenergize.reported = hal_gpio_read(O_ENGINE_DISCHARGE);
+                s.has_deferred_action = false;
+                hal_delay_ms(250);
+                hal_gpio_interrupt(I_ENERGIZE, true);
             }
             else
             {
-                if(_this->_direction_a.desired != _this->_direction_a.reported) _this->_has_deferred_action = true;
-                if(_this->_direction_b.desired != _this->_direction_b.reported) _this->_has_deferred_action = true;
-                if(_this->_common.desired != _this->_common.reported) _this->_has_deferred_action = true;
-                if(_this->_has_deferred_action)
+                if(s.direction_a.desired != s.direction_a.reported) s.has_deferred_action = true;
+                if(s.direction_b.desired != s.direction_b.reported) s.has_deferred_action = true;
+                if(s.common.desired != s.common.reported) s.has_deferred_action = true;
+                if(s.has_deferred_action)
                 {
-                    Logger.Info(F("Deferring Direction change due to engine lockout. Change will take place next time spindle if off."));
+                    LOG_WARN(CONTROLLER, "Deferring Direction change due to engine lockout. Change will take place next time spindle if off.");
                     should_print = false;
                 }
             }    
         }
         else
         {
-            Logger.Info(F("Emergceny Shutdown Mode"));
-            digitalWrite(O_ENGINE_DISCHARGE, HIGH);
-            vTaskDelay(1000);
-            digitalWrite(O_SPINDLE_OFF, LOW);
+            TRACE_SCOPE(trace_emergency);
+            LOG_WARN(CONTROLLER, "Emergceny Shutdown Mode");
+            hal_gpio_write(O_ENGINE_DISCHARGE, true);
+            hal_delay_ms(1000);
+            hal_gpio_write(O_SPINDLE_OFF, false);
         }
         
-        _this->_direction_a.reported = digitalRead(O_SPINDLE_DIRECTION_SWITCH_A);
-        _this->_direction_b.reported = digitalRead(O_SPINDLE_DIRECTION_SWITCH_B);
-        _this->_common.reported = digitalRead(O_SPINDLE_OFF);
-        _this->_deenergize.reported = digitalRead(O_ENGINE_DISCHARGE);
+        s.direction_a.reported = hal_gpio_read(O_SPINDLE_DIRECTION_SWITCH_A);
+        s.direction_b.reported = hal_gpio_read(O_SPINDLE_DIRECTION_SWITCH_B);
+        s.common.reported = hal_gpio_read(O_SPINDLE_OFF);
+        s.deenergize.reported = hal_gpio_read(O_ENGINE_DISCHARGE);
         if(should_print)
         {
-            Logger.Info  (F("Status:"));
-            Logger.Info_f(F("    Engine power: %s"), _this->_is_energized ? "Hot" : "Cold");
-            Logger.Info_f(F("    Direction Relay A: %s"), _this->_direction_a.reported ? "Reverse" : "Forward");
-            Logger.Info_f(F("    Direction Relay B: %s"), _this->_direction_b.reported ? "Reverse" : "Forward");
-            Logger.Info_f(F("    Direction Relay Common: %s"), _this->_common.reported ? "Energized" : "Off");
-            Logger.Info_f(F("    Denergize Relay: %s"), _this->_deenergize.reported ? "Open" : "Closed");
+            LOG_INFO(CONTROLLER, "Status:");
+            LOG_INFO(CONTROLLER, "    Engine power: %s", s.is_energized ? "Hot" : "Cold");
+            LOG_INFO(CONTROLLER, "    Direction Relay A: %s", s.direction_a.reported ? "Reverse" : "Forward");
+            LOG_INFO(CONTROLLER, "    Direction Relay B: %s", s.direction_b.reported ? "Reverse" : "Forward");
+            LOG_INFO(CONTROLLER, "    Direction Relay Common: %s", s.common.reported ? "Energized" : "Off");
+            LOG_INFO(CONTROLLER, "    Denergize Relay: %s", s.deenergize.reported ? "Open" : "Closed");
         }
+        _this->_state.publish(s);
+        _this->post_display(DISPLAY_EVENT_STATE);
+            // engine and deferred action state
 
         //
         // block execution until next event trigger
         //
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        TRACE_LEAVE(trace_input);
+        _this->_input_metric.sleep();
+        hal_task_wait(HAL_WAIT_FOREVER);
     }
 }
 
+/**
+ * @brief Attaches the GPIO interrupt handlers. Called by the input task, so the handlers run on its core.
+ */
+void Controller::attach_interrupts()
+{
+    LOG_INFO(CONTROLLER, "....Attach event receivers for GPIO on core %d", hal_core_id());
+    hal_gpio_attach(I_MAIN_POWER, HAL_EDGE_CHANGE, Controller::handle_input, this);
+    hal_gpio_attach(I_EMS, HAL_EDGE_CHANGE, Controller::handle_input, this);
+    hal_gpio_attach(I_FOR_F, HAL_EDGE_CHANGE, Controller::handle_input, this);
+    hal_gpio_attach(I_FOR_B, HAL_EDGE_CHANGE, Controller::handle_input, this);
+    hal_gpio_attach(I_LIGHT, HAL_EDGE_CHANGE, Controller::handle_input, this);
+    hal_gpio_attach(I_LUBE, HAL_EDGE_CHANGE, Controller::handle_input, this);
+    hal_gpio_attach(I_BACKLIGHT, HAL_EDGE_CHANGE, Controller::handle_input, this);
+    hal_gpio_attach(I_ENERGIZE, HAL_EDGE_FALLING, Controller::handle_energize, this);    
+    hal_gpio_attach(I_CONTROLBOARD_DETECT, HAL_EDGE_RISING, Controller::handle_input, this);
+        // we only process rising (the signal is inverted) here as an interrupt as the control board might shut off 
+        // due to overload and we need to be informed of that. All falling is initiated by us, so 
+        // we do not need an interrupt for that.
+}
+
 /**
  * @brief Task function caluclating the spindle RPM based on the pulses on a regular schedule.
  * @param args - pointer to task arguments 
@@ -588,10 +572,13 @@ void Controller::input_runner(void* args)
 void Controller::rpm_runner(void* args)
 {
     Controller *_this = reinterpret_cast<Controller *>(args);
+    _this->_rpm_source->begin();
     for (;;) 
     { 
+        _this->_rpm_metric.wake();
         _this->calculate_rpm();
-        vTaskDelay(pdMS_TO_TICKS(RPM_CALCULATION_INTERVAL));
+        _this->_rpm_metric.sleep();
+        hal_delay_ms(RPM_CALCULATION_INTERVAL);
     }
 }
 
@@ -600,162 +587,93 @@ void Controller::rpm_runner(void* args)
  */
 void Controller::calculate_rpm() 
 {
-    uint64_t now = 0;
-    uint64_t validTimes[MAX_RPM_PULSES];
-    uint64_t sum = 0;
-    float avgDelta = 0.0;
-    float rawRPM = 0.0;
-    int validCount = 0;
-    int count = (this->_pulse_count < MAX_RPM_PULSES) ? this->_pulse_count : MAX_RPM_PULSES;
-    if (count < 2)
-    { 
-        // we need at least two pulses to calculate RPMs. 
-        this->_rpm = 0;
-        return;
-    }    
-
-    // Filter out timestamps older than MAX_RPM_AGE_US
-    timer_get_counter_value(TIMER_GROUP, TIMER_COUNTER, &now);
-    for (int i = 0; i < count; i++) 
-    {
-        if (now - this->_pulse_times[i] <= MAX_RPM_AGE_US) 
-        {
-            validTimes[validCount++] = this->_pulse_times[i];
-        }
-    }
-    if (validCount < 2) 
-    {
-        // we need at least two pulses to calculate RPMs.
-        this->_rpm = 0;
-        return;
-    }
-
-    // Calculate average delta
-    for (int i = 1; i < validCount; i++) sum += validTimes[i] - validTimes[i-1];
-
-    avgDelta = sum / float(validCount - 1);
-    rawRPM = 60000000.0 / avgDelta;
-
-    // Jitter suppression
-    if (RPM_SMOOTHING_ALPHA > 0.0 && RPM_SMOOTHING_ALPHA < 1.0 && abs((int)rawRPM - (int)this->_rpm) > MIN_RPM_DELTA)
-    {
-        this->_rpm = RPM_SMOOTHING_ALPHA * rawRPM + (1.0 - RPM_SMOOTHING_ALPHA) * this->_rpm;
-            // Exponential smoothing
-    }
-    else if (abs((int)rawRPM - (int)this->_rpm) > MIN_RPM_DELTA) this->_rpm = rawRPM;
+    TRACE_SCOPE(trace_rpm);
+    unsigned int rpm = this->_rpm_estimator.update(this->_rpm_source->get_rpm());
+    if(rpm == this->_rpm) return;
+    this->_rpm = rpm;
+    post_display(DISPLAY_EVENT_RPM);
 }
 
 /**
- * @brief Interrupt handler to read the State of the Hall sensor to measure Motor RPM
- *
- * @param arg pointer to class instance context (this)
+ * @brief Wakes the display task
+ * @param events - the DISPLAY_EVENT_ bits describing what changed
  */
-bool IRAM_ATTR Controller::read_hall_sensor(void *arg) 
+void Controller::post_display(uint32_t events)
 {
-    static byte reg = 0x0;
-    static bool last_stable_state = 1;
-
-    // hall sensor will read logical 1 until the magnet gets close to the sensor, when it
-    // switches to logical 0. So it is equivalent to a normally closed switch. So will
-    // monitor for a stable low signal while our state is high.  
-
-    Controller* _this = reinterpret_cast<Controller *>(arg);
-    portENTER_CRITICAL_ISR(&_hall_mux);
+    hal_events_set(this->_display_events, events);
+}
 
-    timer_group_clr_intr_status_in_isr(TIMER_GROUP, TIMER_RPM);
-                                                // clear the timer interrupt to allow for subsequent processing
-    bool val = 0;
-    if(I_SPINDLE_PULSE <32) val = (GPIO.in >> I_SPINDLE_PULSE) & 0x1;
-    else if (I_SPINDLE_PULSE < 40) val = (GPIO.in1.data >> (I_SPINDLE_PULSE - 32)) & 0x1;
-    else val = 0;
+/**
+ * @brief Gets the filtered spindle RPM
+ * @returns The RPM
+ */
+unsigned int Controller::get_rpm() const
+{
+    return this->_rpm;
+}
 
-    reg = ((reg << 1) | (val ? 1 : 0)) & 0x07;  // Shift in current value, keep last 3 bits
-    bool stable_state = (reg == 0x07) ? 1 : (reg == 0x00) ? 0 : last_stable_state;
-                                                // Determine stable state from 3-sample debounce
+/**
+ * @brief Gets a consistent snapshot of the inputs and relays
+ * @param generation - optional, receives the number of snapshots the input task published before this one
+ * @returns The snapshot
+ */
+machine_state Controller::get_state(uint32_t* generation) const
+{
+    return this->_state.read(generation);
+}
 
-    // Detect falling edge: HIGH → LOW
-    if (last_stable_state == 1 && stable_state == 0) 
-    {
-        uint64_t currentTime = 0;
-        timer_get_counter_value(TIMER_GROUP, TIMER_COUNTER, &currentTime); 
-            // Read hardware timer, this is a 64bit value, so it rolls over every
-            // 584,942 years
+/**
+ * @brief Selects the filter applied to the raw RPM
+ * @param filter - the filter to use
+ */
+void Controller::set_rpm_filter(rpm_filter filter)
+{
+    LOG_INFO(RPM, "Select RPM filter %s", RPM_Estimator::get_filter_name(filter));
+    this->_rpm_estimator.set_filter(filter);
+}
 
-        if (_this->_pulse_count < MAX_RPM_PULSES) _this->_pulse_times[_this->_pulse_count++] = currentTime;
-        else 
-        {
-            // Shift left to discard oldest
-            memmove((void*)&(_this->_pulse_times[0]), (void*)&(_this->_pulse_times[1]), sizeof(uint64_t) * (MAX_RPM_PULSES - 1));
-            _this->_pulse_times[MAX_RPM_PULSES - 1] = currentTime;
-        }
-        _this->_counter++;
-    }
-    last_stable_state = stable_state;
-    portEXIT_CRITICAL_ISR(&_hall_mux);
-    return false;
+/**
+ * @brief Gets the filter applied to the raw RPM
+ * @returns The filter
+ */
+rpm_filter Controller::get_rpm_filter()
+{
+    return this->_rpm_estimator.get_filter();
 }
 
 /**
  * @brief Event handler watching for changes on the energize button toggle.
+ * @param arg - pointer to class instance context (this)
  */
-void IRAM_ATTR Controller::handle_energize()
+void IRAM_ATTR Controller::handle_energize(void* arg)
 {
+    ISR_Probe probe(energize_isr);
+    TRACE_ISR_SCOPE(trace_energize_isr);
+    Controller *_this = reinterpret_cast<Controller *>(arg);
     static uint64_t last_toggle_energize = 0;
-    uint64_t currentTime = 0;
-    timer_get_counter_value(TIMER_GROUP, TIMER_COUNTER, &currentTime); 
-        // Read hardware timer, this is a 64bit value, so it rolls over every
-        // 584,942 years
+    uint64_t currentTime = hal_timer_us();
     if (currentTime - last_toggle_energize > DEBOUNCE_US) 
     {
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
         last_toggle_energize = currentTime;
-        this->_toggle_energize = true;
-        vTaskNotifyGiveFromISR(this->_input_runner, &xHigherPriorityTaskWoken); 
-        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+        _this->_toggle_energize = true;
+        hal_task_notify_from_isr(_this->_input_runner);
     }
 }
 
 /**
  * @brief Event handler watching for changes on any inputs.
+ * @param arg - pointer to class instance context (this)
  */
-void IRAM_ATTR Controller::handle_input()
+void IRAM_ATTR Controller::handle_input(void* arg)
 {
-    static uint64_t last_input_change = 0;    
-    uint64_t currentTime = 0;
-    timer_get_counter_value(TIMER_GROUP, TIMER_COUNTER, &currentTime); 
-        // Read hardware timer, this is a 64bit value, so it rolls over every
-        // 584,942 years
+    ISR_Probe probe(input_isr);
+    TRACE_ISR_SCOPE(trace_input_isr);
+    Controller *_this = reinterpret_cast<Controller *>(arg);
+    static uint64_t last_input_change = 0;
+    uint64_t currentTime = hal_timer_us();
     if (currentTime - last_input_change > DEBOUNCE_US) 
     {
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
         last_input_change = currentTime;
-        vTaskNotifyGiveFromISR(this->_input_runner, &xHigherPriorityTaskWoken); 
-        portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-    }
-}
-
-/**
- * @brief Event handler monitoring the Spindle Pulse
- */
-void IRAM_ATTR Controller::handle_spindle_pulse()
-{    
-    static unsigned long hall_debounce_tick = 0;
-    uint64_t now = 0;
-    portENTER_CRITICAL_ISR(&_hall_mux);
-    timer_get_counter_value(TIMER_GROUP, TIMER_COUNTER, &now); 
-        // Read hardware timer, this is a 64bit value, so it rolls over every
-        // 584,942 years
-    if(now - hall_debounce_tick > HALL_DEBOUNCE_DELAY_US)
-    {
-        hall_debounce_tick = now;
-
-        if (this->_pulse_count < MAX_RPM_PULSES) this->_pulse_times[this->_pulse_count++] = now;
-        else 
-        {
-            // Shift left to discard oldest
-            memmove((void*)&this->_pulse_times[0], (void*)&this->_pulse_times[1], sizeof(uint64_t) * (MAX_RPM_PULSES - 1));
-            this->_pulse_times[MAX_RPM_PULSES - 1] = now;
-        }
+        hal_task_notify_from_isr(_this->_input_runner);
     }
-    portEXIT_CRITICAL_ISR(&_hall_mux);
 }
@@ -6,9 +6,11 @@
 
 #include <Arduino.h>
 #include "../controller_display/controller_display.h"
-extern "C" {
-  #include <driver/timer.h>
-}
+#include "../rpm/rpm_source.h"
+#include "../rpm/rpm_estimator.h"
+#include "../hal/hal.h"
+#include "../metrics/metrics.h"
+#include "seqlock.h"
 
 #define DEBOUNCE_US 150000
 #define DEBOUNCE_MS DEBOUNCE_US/1000
@@ -30,32 +32,34 @@ extern "C" {
 #define O_ENGINE_DISCHARGE 21
 
 
-#define TIMER_GROUP    TIMER_GROUP_0
-#define TIMER_RPM      TIMER_0
-#define TIMER_COUNTER  TIMER_1
-#define TIMER_DIVIDER  80  
-    // 80 MHz / 80 = 1 MHz → 1 tick = 1 µs
-
-#define HALL_DEBOUNCE_DELAY_US 10
-#define HALL_POLLING_INTERVAL_US 25
-#define USE_POLLING_FOR_RPM true
-    // this define controls whether we use polling on a timer or interrupts for RPM measurement. 
-    // while interrupt drive is preferable, there seem to be a lot of phantom interrupts on low RPMs
-    // probably because the slow takeup edge on the hall. We might be able to reduce the capacitor 
-    // from the Hall input to ground to steepen the edge, but it is more likely a function of the slow
-    // increase of the magnetic field on low RPMs (on higher RPMs, the edge is sharp).
-    // see also https://github.com/espressif/arduino-esp32/issues/4172 and 
-    // https://github.com/espressif/esp-idf/issues/7602 for addtional discussion. 
-
-
-#define MAX_RPM_PULSES 12       // History depth for RPM measurement, should be between 8 and 12
-#define MAX_RPM_AGE_US 1000000  // Max age of pulse timestamps to consider in us, 6-10sec
-#define RPM_SMOOTHING_ALPHA 1.0 // Smoothing factor for RPM curve, should be between 0 and 1, closer to 0 will
-                                // give smoother RPM evolution, closer to 1 will be more responsive but
-                                // also more jittery 
-#define MIN_RPM_DELTA 10        // Minimum change to update display
 #define RPM_CALCULATION_INTERVAL 10
-#define DISPLAY_REFRESH 100
+#define DISPLAY_MAX_FPS 25         // Upper bound of the display frame rate, RPM changes within a frame interval are coalesced
+#define DISPLAY_FRAME_US (1000000 / DISPLAY_MAX_FPS)
+
+#define DISPLAY_EVENT_EMERGENCY 0x01    // emergency stop pressed or released
+#define DISPLAY_EVENT_STATE 0x02        // a switch, the engine or a relay changed
+#define DISPLAY_EVENT_RPM 0x04          // the RPM changed
+#define DISPLAY_EVENT_ALL (DISPLAY_EVENT_EMERGENCY | DISPLAY_EVENT_STATE | DISPLAY_EVENT_RPM)
+
+// Task placement. Acquisition and safety run on the control core, rendering and the SPI blitter on the display
+// core, which display_spi.h sets with DISPLAY_CORE and BLIT_TASK_CORE. An interrupt runs on the core that
+// attaches it, so the input task attaches the GPIO interrupts and the RPM task starts the RPM source. Each value
+// can be overridden by a build flag.
+#ifndef CONTROL_CORE
+#define CONTROL_CORE 0                  // input and RPM tasks, GPIO, hall and RPM timer interrupts
+#endif
+#ifndef INPUT_TASK_PRIORITY
+#define INPUT_TASK_PRIORITY HAL_PRIORITY_HIGHEST
+#endif
+#ifndef RPM_TASK_PRIORITY
+#define RPM_TASK_PRIORITY HAL_PRIORITY_HIGHEST
+#endif
+#ifndef DISPLAY_TASK_PRIORITY
+#define DISPLAY_TASK_PRIORITY 1         // as the Arduino loop, the two share the display core in time slices
+#endif
+#define INPUT_TASK_STACK 3072           // attaches the GPIO interrupts before it starts its loop
+#define RPM_TASK_STACK 3072             // starts the RPM source before it starts its loop
+#define DISPLAY_TASK_STACK 8192
 
 
 /**
@@ -66,6 +70,26 @@ struct State {
     bool reported = false;
 };
 
+/**
+ * @brief The inputs and relays of the lathe as one consistent snapshot. The input task is the only writer and
+ * publishes the whole struct, so readers never see a combination the input task did not produce.
+ */
+struct machine_state {
+    bool main_power = false;            // true if the main power switch is off (the input reads high)
+    bool has_emergency = false;
+    bool for_f = false;
+    bool for_b = false;
+    bool light = false;                 // true if the light is off
+    bool is_energized = false;
+    bool backlight = false;
+    bool lube = false;                  // true if the lubrication is off
+    bool has_deferred_action = false;   // direction change waits for the engine to be de-energized
+    State direction_a;
+    State direction_b;
+    State common;
+    State deenergize;
+};
+
 /**
  * @brief Implements the basic controller functionality
  */
@@ -83,10 +107,36 @@ class Controller
          */
         ~Controller();
 
+        /**
+         * @brief Selects the filter applied to the raw RPM
+         * @param filter - the filter to use
+         */
+        void set_rpm_filter(rpm_filter filter);
+
+        /**
+         * @brief Gets the filter applied to the raw RPM
+         * @returns The filter
+         */
+        rpm_filter get_rpm_filter();
+
+        /**
+         * @brief Gets the filtered spindle RPM
+         * @returns The RPM
+         */
+        unsigned int get_rpm() const;
+
+        /**
+         * @brief Gets a consistent snapshot of the inputs and relays
+         * @param generation - optional, receives the number of snapshots the input task published before this one
+         * @returns The snapshot
+         */
+        machine_state get_state(uint32_t* generation = nullptr) const;
+
     protected:
 
         /**
-         * @brief Task function managing the display
+         * @brief Task function managing the display. Blocks until display events are posted, draws emergency and
+         * state changes right away and RPM changes at most DISPLAY_MAX_FPS times a second.
          * @param args - pointer to task arguments
          */
         static void display_runner(void* args);
@@ -103,34 +153,35 @@ class Controller
          */
         static void rpm_runner(void* args); 
 
-        /**
-         * @brief Interrupt handler to read the State of the Hall sensor to measure Motor RPM
-         *
-         * @param arg pointer to class instance context (this)
-         */
-        static bool IRAM_ATTR read_hall_sensor(void *arg);
-
         /**
          * @brief Event handler watching for changes on the energize button toggle.
+         * @param arg - pointer to class instance context (this)
          */
-        void IRAM_ATTR handle_energize();
+        static void IRAM_ATTR handle_energize(void* arg);
 
         /**
          * @brief Event handler watching for changes on any inputs.
+         * @param arg - pointer to class instance context (this)
          */
-        void IRAM_ATTR handle_input();
+        static void IRAM_ATTR handle_input(void* arg);
 
         /**
-         * @brief Event handler monitoring the Spindle Pulse
+         * @brief Calculates the rpm based on the collected pulses
          */
-        void IRAM_ATTR handle_spindle_pulse(); 
+        void calculate_rpm();
+
+    private:
 
         /**
-         * @brief Calculates the rpm based on the collected pulses
+         * @brief Attaches the GPIO interrupt handlers. Called by the input task, so the handlers run on its core.
          */
-        void calculate_rpm();
+        void attach_interrupts();
 
-    private: 
+        /**
+         * @brief Wakes the display task
+         * @param events - the DISPLAY_EVENT_ bits describing what changed
+         */
+        void post_display(uint32_t events);
 
         /**
          * @brief Formats a string, essentially a wrapper for vnsprintf
@@ -140,34 +191,26 @@ class Controller
         String format_string(const char* format, ...);
     
         Controller_Display *_display = nullptr;
+        RPM_Source *_rpm_source = nullptr;
+        RPM_Estimator _rpm_estimator;
     
-        TaskHandle_t _display_runner;
-        TaskHandle_t _input_runner;
-        TaskHandle_t _rpm_runner;
+        hal_task_t _display_runner;
+        hal_task_t _input_runner;
+        hal_task_t _rpm_runner;
+        Task_Metric _display_metric{"displayRunner"};
+        Task_Metric _input_metric{"inputRunner"};
+        Task_Metric _rpm_metric{"rpmRunner"};
 
         volatile bool _should_exit = false;
-        volatile bool _main_power = false;
-        volatile bool _has_emergency = false;
         volatile bool _toggle_energize = false;
-        volatile bool _for_f = false;
-        volatile bool _for_b = false;
-        volatile bool _light = false;
-        volatile bool _is_energized = false;
-        volatile bool _backlight = false;
-        volatile bool _lube = false;
-        volatile bool _has_deferred_action = false;
-
-        volatile uint64_t _pulse_times[MAX_RPM_PULSES];
-        volatile unsigned int _pulse_count = 0;
+            // set by the energize interrupt, consumed by the input task
+
         volatile unsigned int _rpm = 0;
-        volatile unsigned int _counter = 0;
 
-        volatile State _direction_a;
-        volatile State _direction_b;
-        volatile State _common;
-        volatile State _deenergize;
+        Seqlock<machine_state> _state;
     
-        SemaphoreHandle_t _display_mutex;       
+        hal_sem_t _display_mutex;       
+        hal_events_t _display_events;
 };
 
 #endif
\ No newline at end of file
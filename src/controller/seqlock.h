@@ -0,0 +1,82 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _SEQLOCK_H_
+#define _SEQLOCK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+/**
+ * @brief Single-writer sequence lock publishing a small struct to any number of readers.
+ * @details The writer makes the sequence odd, stores the value and makes the sequence even again. A reader
+ * copies the value between two reads of the sequence and retries if the sequence was odd or changed, so it
+ * always gets a value the writer published as a whole, without locking out the writer. The value is held in
+ * atomic words, so the concurrent copy is well defined. Readers spin while a write is in progress, so the
+ * writer must not be preempted by a reader on the same core (publish from the highest priority task).
+ * @tparam T - the value, must be trivially copyable
+ */
+template<typename T>
+class Seqlock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock values must be trivially copyable");
+
+    public:
+        /**
+         * @brief Publishes a new value. Must only be called from a single writer.
+         * @param value - the value
+         */
+        void publish(const T& value)
+        {
+            uint32_t words[WORDS] = {0};
+            memcpy(words, &value, sizeof(T));
+            uint32_t seq = _seq.load(std::memory_order_relaxed);
+            _seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+                // readers see the odd sequence before any of the new words
+            for(size_t i = 0; i < WORDS; i++) _words[i].store(words[i], std::memory_order_relaxed);
+            _seq.store(seq + 2, std::memory_order_release);
+        }
+
+        /**
+         * @brief Gets the last published value
+         * @param generation - optional, receives the number of values published before this one
+         * @returns The value
+         */
+        T read(uint32_t* generation = nullptr) const
+        {
+            uint32_t words[WORDS];
+            for(;;)
+            {
+                uint32_t s1 = _seq.load(std::memory_order_acquire);
+                if(s1 & 1) continue;
+                    // write in progress
+                for(size_t i = 0; i < WORDS; i++) words[i] = _words[i].load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if(_seq.load(std::memory_order_relaxed) != s1) continue;
+                if(generation != nullptr) *generation = s1 / 2;
+                T value;
+                memcpy(&value, words, sizeof(T));
+                return value;
+            }
+        }
+
+        /**
+         * @brief Gets the number of values published so far
+         * @returns The generation, changes with every publish
+         */
+        uint32_t generation() const
+        {
+            return _seq.load(std::memory_order_acquire) / 2;
+        }
+
+    private:
+        static constexpr size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+        std::atomic<uint32_t> _seq{0};
+        std::atomic<uint32_t> _words[WORDS] = {};
+};
+
+#endif
@@ -0,0 +1,118 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "asset_pack.h"
+#include "assets.h"
+#include "../display_spi/rle565.h"
+#include "../hal/hal.h"
+#include "../logging/log.h"
+
+static const uint8_t* pack = nullptr;
+static const asset_pack_entry* entries = nullptr;
+
+/**
+ * @brief Calculates the FNV-1a hash of the image placements in the asset table
+ */
+static uint32_t layout_hash()
+{
+  uint32_t hash = 0x811c9dc5;
+  for(int i=0; i<ASSET_COUNT; i++)
+  {
+    int16_t values[4] = { asset_table[i].x, asset_table[i].y, asset_table[i].w, asset_table[i].h };
+    for(int v=0; v<4; v++)
+    {
+      uint8_t bytes[2] = { (uint8_t)(values[v] & 0xff), (uint8_t)((uint16_t)values[v] >> 8) };
+      for(int b=0; b<2; b++) hash = (hash ^ bytes[b]) * 0x01000193;
+    }
+  }
+  return hash;
+}
+
+/**
+ * @brief Calculates the CRC-32 (IEEE) of a buffer
+ */
+static uint32_t crc32(const uint8_t* data, size_t len)
+{
+  uint32_t crc = 0xffffffff;
+  for(size_t i=0; i<len; i++)
+  {
+    crc ^= data[i];
+    for(int k=0; k<8; k++) crc = (crc & 1) ? 0xedb88320 ^ (crc >> 1) : crc >> 1;
+  }
+  return ~crc;
+}
+
+/**
+ * @brief Maps the asset pack and validates it against the compiled asset table
+ * @returns True if the images can be drawn
+ */
+bool asset_pack_begin()
+{
+  if(pack != nullptr) return true;
+
+  asset_pack_header header;
+  if(!hal_partition_read(ASSET_PACK_PARTITION, 0, &header, sizeof(header)))
+  {
+    LOG_ERROR(DISPLAY, "Asset pack: partition " ASSET_PACK_PARTITION " not found");
+    return false;
+  }
+  if(header.magic != ASSET_PACK_MAGIC || header.version != ASSET_PACK_VERSION)
+  {
+    LOG_ERROR(DISPLAY, "Asset pack: no asset pack in partition " ASSET_PACK_PARTITION ", flash it with tools/asset_compiler.py --pack");
+    return false;
+  }
+  if(header.count != ASSET_COUNT || header.layout != layout_hash())
+  {
+    LOG_ERROR(DISPLAY, "Asset pack: %d images with layout %08x do not match the firmware (%d images with layout %08x)",
+      header.count, header.layout, ASSET_COUNT, layout_hash());
+    return false;
+  }
+  size_t directory = sizeof(asset_pack_header) + ASSET_COUNT * sizeof(asset_pack_entry);
+  if(header.size < directory || header.size > hal_partition_size(ASSET_PACK_PARTITION))
+  {
+    LOG_ERROR(DISPLAY, "Asset pack: invalid size %u", header.size);
+    return false;
+  }
+
+  const uint8_t* data = hal_partition_map(ASSET_PACK_PARTITION, header.size);
+  if(data == nullptr)
+  {
+    LOG_ERROR(DISPLAY, "Asset pack: could not map partition " ASSET_PACK_PARTITION);
+    return false;
+  }
+  if(crc32(data + sizeof(asset_pack_header), header.size - sizeof(asset_pack_header)) != header.crc)
+  {
+    LOG_ERROR(DISPLAY, "Asset pack: checksum mismatch");
+    return false;
+  }
+
+  // the images are drawn straight from flash, so check everything the blitter relies on once
+  const asset_pack_entry* table = (const asset_pack_entry*)(data + sizeof(asset_pack_header));
+  for(int i=0; i<ASSET_COUNT; i++)
+  {
+    const unsigned char* image = data + table[i].offset;
+    if(table[i].offset < directory || table[i].offset % ASSET_ALIGN != 0 || table[i].size < RLE565_HEADER_SIZE ||
+      table[i].offset + table[i].size > header.size || !rle565_is_image(image) ||
+      rle565_width(image) != asset_table[i].w || rle565_height(image) != asset_table[i].h)
+    {
+      LOG_ERROR(DISPLAY, "Asset pack: image %d is invalid", i);
+      return false;
+    }
+  }
+
+  pack = data;
+  entries = table;
+  LOG_INFO(DISPLAY, "....Asset pack: %d images, %u bytes", header.count, header.size);
+  return true;
+}
+
+/**
+ * @brief Gets an image from the asset pack
+ * @param id - the asset_id of the image
+ * @returns The rle565 image in mapped flash, nullptr if the pack was not loaded
+ */
+const unsigned char* asset_pack_image(uint8_t id)
+{
+  if(pack == nullptr || id >= ASSET_COUNT) return nullptr;
+  return pack + entries[id].offset;
+}
@@ -0,0 +1,63 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _ASSET_PACK_H_
+#define _ASSET_PACK_H_
+
+#include "Arduino.h"
+
+#define ASSETS_IN_PARTITION 1
+    // 1 reads the images from the asset pack in ASSET_PACK_PARTITION, 0 links them into the firmware
+#define ASSET_PACK_PARTITION "assets"
+#define ASSET_PACK_MAGIC 0x4b50414c     // "LAPK"
+#define ASSET_PACK_VERSION 1
+
+/**
+ * The asset pack holds the compiled images outside of the app image, so the artwork can be flashed on its own
+ * and the app image stays small. tools/asset_compiler.py --pack writes it:
+ *
+ *     asset_pack_header
+ *     count x asset_pack_entry
+ *     images, each rle565 and starting at an ASSET_ALIGN boundary
+ *
+ * All values are little endian and offsets are relative to the start of the pack. The placements stay in the
+ * firmware (asset_table). The layout hash identifies them, so a pack only loads into a firmware compiled from
+ * a manifest with the same placements, while the pixels can change freely.
+ */
+
+/**
+ * @brief Header at the start of the asset pack
+ */
+struct asset_pack_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;     // of images
+    uint32_t layout;    // FNV-1a hash of the image placements
+    uint32_t size;      // of the pack in bytes, including the header
+    uint32_t crc;       // CRC-32 of the pack after the header
+};
+
+/**
+ * @brief Location of an image in the asset pack
+ */
+struct asset_pack_entry {
+    uint32_t offset;
+    uint32_t size;
+};
+
+static_assert(sizeof(asset_pack_header) == 20 && sizeof(asset_pack_entry) == 8, "asset pack structures must be packed");
+
+/**
+ * @brief Maps the asset pack and validates it against the compiled asset table
+ * @returns True if the images can be drawn
+ */
+bool asset_pack_begin();
+
+/**
+ * @brief Gets an image from the asset pack
+ * @param id - the asset_id of the image
+ * @returns The rle565 image in mapped flash, nullptr if the pack was not loaded
+ */
+const unsigned char* asset_pack_image(uint8_t id);
+
+#endif
@@ -0,0 +1,2845 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+// Generated by tools/asset_compiler.py from assets/manifest.json, do not edit.
+
+#include "assets.h"
+
+#if !ASSETS_IN_PARTITION
+alignas(ASSET_ALIGN) const unsigned char asset_data[] PROGMEM = {
+    // background_lcars
+    82,76,240,0,64,1,0,0,0,0,6,0,0,0,12,0,0,0,18,0,0,0,24,0,0,0,61,0,0,0,151,0,0,0,189,0,0,0,221,0,0,0,253,0,0,0,29,1,
+    0,0,59,1,0,0,93,1,0,0,182,1,0,0,27,2,0,0,130,2,0,0,233,2,0,0,82,3,0,0,191,3,0,0,46,4,0,0,159,4,0,0,12,5,0,0,119,5,
+    0,0,230,5,0,0,71,6,0,0,172,6,0,0,13,7,0,0,104,7,0,0,197,7,0,0,30,8,0,0,64,8,0,0,96,8,0,0,130,8,0,0,164,8,0,0,196,8,
+    0,0,234,8,0,0,117,9,0,0,141,9,0,0,163,9,0,0,183,9,0,0,203,9,0,0,225,9,0,0,245,9,0,0,11,10,0,0,31,10,0,0,51,10,0,0,71,10,
+    0,0,91,10,0,0,111,10,0,0,131,10,0,0,151,10,0,0,171,10,0,0,191,10,0,0,211,10,0,0,34,11,0,0,158,11,0,0,27,12,0,0,183,12,0,0,59,13,
+    0,0,193,13,0,0,91,14,0,0,240,14,0,0,153,15,0,0,66,16,0,0,234,16,0,0,115,17,0,0,26,18,0,0,180,18,0,0,128,19,0,0,38,20,0,0,166,20,
+    0,0,85,21,0,0,253,21,0,0,180,22,0,0,89,23,0,0,1,24,0,0,195,24,0,0,174,25,0,0,93,26,0,0,54,27,0,0,240,27,0,0,169,28,0,0,124,29,
+    0,0,89,30,0,0,16,31,0,0,171,31,0,0,101,32,0,0,24,33,0,0,210,33,0,0,175,34,0,0,118,35,0,0,28,36,0,0,227,36,0,0,159,37,0,0,70,38,
+    0,0,237,38,0,0,171,39,0,0,100,40,0,0,42,41,0,0,225,41,0,0,168,42,0,0,85,43,0,0,20,44,0,0,196,44,0,0,160,45,0,0,98,46,0,0,22,47,
+    0,0,190,47,0,0,81,48,0,0,27,49,0,0,227,49,0,0,125,50,0,0,28,51,0,0,224,51,0,0,97,52,0,0,173,52,0,0,246,52,0,0,46,53,0,0,131,53,
+    0,0,215,53,0,0,32,54,0,0,123,54,0,0,209,54,0,0,3,55,0,0,89,55,0,0,129,55,0,0,32,56,0,0,223,56,0,0,191,57,0,0,232,58,0,0,58,60,
+    0,0,166,61,0,0,248,62,0,0,64,64,0,0,147,65,0,0,244,66,0,0,213,67,0,0,84,68,0,0,223,68,0,0,103,69,0,0,109,69,0,0,115,69,0,0,121,69,
+    0,0,176,69,0,0,51,70,0,0,114,70,0,0,169,70,0,0,224,70,0,0,25,71,0,0,106,71,0,0,185,71,0,0,8,72,0,0,89,72,0,0,184,72,0,0,18,73,
+    0,0,115,73,0,0,206,73,0,0,43,74,0,0,136,74,0,0,229,74,0,0,82,75,0,0,195,75,0,0,62,76,0,0,185,76,0,0,66,77,0,0,189,77,0,0,54,78,
+    0,0,179,78,0,0,42,79,0,0,165,79,0,0,26,80,0,0,117,80,0,0,208,80,0,0,65,81,0,0,170,81,0,0,23,82,0,0,126,82,0,0,237,82,0,0,88,83,
+    0,0,195,83,0,0,48,84,0,0,157,84,0,0,20,85,0,0,89,85,0,0,164,85,0,0,245,85,0,0,46,86,0,0,109,86,0,0,192,86,0,0,233,86,0,0,16,87,
+    0,0,57,87,0,0,180,87,0,0,239,87,0,0,42,88,0,0,101,88,0,0,158,88,0,0,203,88,0,0,244,88,0,0,31,89,0,0,78,89,0,0,135,89,0,0,181,89,
+    0,0,244,89,0,0,45,90,0,0,104,90,0,0,161,90,0,0,218,90,0,0,19,91,0,0,78,91,0,0,137,91,0,0,198,91,0,0,243,91,0,0,30,92,0,0,73,92,
+    0,0,116,92,0,0,165,92,0,0,231,92,0,0,30,93,0,0,89,93,0,0,150,93,0,0,4,94,0,0,57,94,0,0,102,94,0,0,173,94,0,0,58,95,0,0,161,95,
+    0,0,10,96,0,0,113,96,0,0,215,96,0,0,52,97,0,0,167,97,0,0,32,98,0,0,153,98,0,0,18,99,0,0,135,99,0,0,254,99,0,0,117,100,0,0,236,100,
+    0,0,111,101,0,0,238,101,0,0,101,102,0,0,218,102,0,0,83,103,0,0,198,103,0,0,29,104,0,0,120,104,0,0,203,104,0,0,18,105,0,0,93,105,0,0,162,105,
+    0,0,229,105,0,0,42,106,0,0,109,106,0,0,178,106,0,0,247,106,0,0,64,107,0,0,133,107,0,0,208,107,0,0,19,108,0,0,92,108,0,0,159,108,0,0,232,108,
+    0,0,45,109,0,0,114,109,0,0,161,109,0,0,204,109,0,0,1,110,0,0,53,110,0,0,131,110,0,0,151,110,0,0,177,110,0,0,203,110,0,0,32,111,0,0,111,111,
+    0,0,194,111,0,0,3,112,0,0,60,112,0,0,127,112,0,0,206,112,0,0,24,113,0,0,120,113,0,0,206,113,0,0,31,114,0,0,126,114,0,0,225,114,0,0,70,115,
+    0,0,177,115,0,0,52,116,0,0,197,116,0,0,68,117,0,0,199,117,0,0,96,118,0,0,249,118,0,0,132,119,0,0,59,120,0,0,236,120,0,0,127,121,0,0,26,122,
+    0,0,199,122,0,0,110,123,0,0,245,123,0,0,120,124,0,0,250,124,0,0,86,125,0,0,187,125,0,0,24,126,0,0,113,126,0,0,185,126,0,0,2,127,0,0,75,127,
+    0,0,140,127,0,0,195,127,0,0,254,127,0,0,57,128,0,0,120,128,0,0,183,128,0,0,24,129,0,0,46,129,0,0,52,129,0,0,255,0,0,239,0,0,255,0,0,239,
+    0,0,255,0,0,239,0,0,255,0,0,239,0,0,145,0,0,1,40,161,65,34,180,73,66,0,48,225,131,0,0,0,57,71,151,73,136,0,73,137,243,73,136,1,65,104,40,229,
+    145,0,0,142,0,0,3,40,161,146,68,219,135,227,135,131,219,102,131,219,103,129,219,102,132,219,103,129,219,102,1,219,103,219,102,132,219,103,0,219,102,131,219,103,129,219,102,132,
+    219,103,0,219,102,131,219,103,0,219,102,130,219,103,0,219,102,135,219,103,0,138,68,131,0,0,0,122,174,255,155,82,142,155,82,2,163,115,114,109,24,163,142,0,0,140,0,0,
+    2,40,161,162,165,227,135,184,219,103,0,138,68,131,0,0,0,122,174,255,155,82,144,155,82,2,163,115,114,142,32,164,140,0,0,139,0,0,0,113,227,187,219,103,0,138,68,131,
+    0,0,0,122,174,255,155,82,146,155,82,1,155,114,89,234,139,0,0,137,0,0,1,8,32,154,133,188,219,103,0,138,68,131,0,0,0,122,174,255,155,82,148,155,82,0,114,142,
+    138,0,0,136,0,0,1,8,32,187,6,189,219,103,0,138,100,131,0,0,0,122,174,255,155,82,149,155,82,0,114,109,137,0,0,136,0,0,0,146,100,190,219,103,0,138,100,131,
+    0,0,0,122,174,255,155,82,150,155,82,0,89,234,136,0,0,135,0,0,1,65,2,227,135,190,219,103,0,138,100,131,0,0,0,122,174,255,155,82,150,155,82,1,163,115,32,196,
+    135,0,0,135,0,0,0,195,6,191,219,103,0,138,68,131,0,0,0,122,174,220,155,82,0,205,185,132,255,223,2,247,94,222,58,180,85,132,155,82,1,163,147,247,158,131,255,223,
+    2,247,158,230,188,188,247,132,155,82,4,180,85,255,190,255,223,247,126,180,150,136,155,82,4,155,114,222,123,255,223,255,223,222,91,139,155,82,0,130,207,135,0,0,134,0,0,0,
+    73,66,192,219,103,0,138,100,131,0,0,0,122,174,220,155,82,5,222,91,255,255,247,158,239,29,239,29,247,93,130,255,255,0,213,217,131,155,82,10,171,244,255,255,255,255,239,29,
+    239,29,239,61,247,190,255,255,255,255,238,253,163,179,130,155,82,0,197,55,130,255,255,0,239,61,136,155,82,0,188,247,130,255,255,0,247,93,139,155,82,1,163,115,40,196,134,0,
+    0,134,0,0,0,162,165,192,219,103,0,138,100,131,0,0,0,122,174,220,155,82,2,222,91,255,255,205,185,130,155,82,4,163,179,230,155,255,255,255,255,180,85,130,155,82,2,172,
+    20,255,255,255,255,131,155,82,3,197,23,255,255,255,255,222,91,130,155,82,5,197,55,255,255,247,93,247,158,255,255,188,214,135,155,82,4,238,252,255,255,230,155,255,255,247,93,140,
+    155,82,0,98,44,134,0,0,134,0,0,0,219,135,192,219,103,0,138,100,131,0,0,0,122,175,220,155,82,2,222,91,255,255,205,185,131,155,82,3,163,212,255,255,255,255,205,153,
+    130,155,82,2,172,20,255,255,255,255,132,155,82,11,222,58,255,255,255,223,155,114,155,82,155,82,197,55,255,255,239,61,214,26,255,255,230,220,134,155,82,5,172,20,255,255,255,223,
+    188,247,255,255,247,93,140,155,82,0,139,17,134,0,0,133,0,0,0,40,161,193,219,103,0,138,100,131,0,0,0,122,174,220,155,82,2,222,91,255,255,205,185,132,155,82,2,247,
+    158,255,255,213,250,130,155,82,2,172,20,255,255,255,255,132,155,82,12,188,247,255,255,255,255,172,20,155,82,155,82,197,55,255,255,239,61,180,117,255,255,255,255,172,20,133,155,82,
+    5,205,185,255,255,214,26,188,182,255,255,247,93,140,155,82,1,163,147,8,33,133,0,0,133,0,0,1,73,66,219,102,192,219,103,0,138,68,131,0,0,0,122,174,220,155,82,2,
+    222,91,255,255,205,185,131,155,82,3,163,147,255,223,255,255,205,120,130,155,82,2,172,20,255,255,255,255,132,155,82,12,188,182,255,255,255,255,171,244,155,82,155,82,197,56,255,255,
+    239,61,155,82,247,94,255,255,213,250,132,155,82,6,155,114,247,158,255,255,163,212,188,182,255,255,247,93,141,155,82,0,40,229,133,0,0,133,0,0,1,81,98,219,102,192,219,103,
+    0,138,68,131,0,0,0,122,174,220,155,82,2,222,91,255,255,205,185,131,155,82,3,214,26,255,255,255,223,163,212,130,155,82,2,172,20,255,255,255,255,132,155,82,13,213,217,255,
+    255,255,191,155,114,155,82,155,82,197,56,255,255,239,61,155,82,205,120,255,255,247,158,155,115,131,155,82,6,188,247,255,255,222,123,155,82,188,182,255,255,247,93,141,155,82,0,57,
+    71,133,0,0,133,0,0,1,81,98,219,70,192,219,103,0,138,100,131,0,0,0,122,174,220,155,82,9,222,91,255,255,238,253,213,249,213,217,222,58,247,93,255,255,255,191,188,214,
+    131,155,82,2,172,20,255,255,255,255,131,155,82,3,180,85,255,223,255,255,214,26,130,155,82,7,197,55,255,255,239,61,155,82,163,179,255,255,255,255,188,247,131,155,82,6,230,220,
+    255,255,180,150,155,82,188,182,255,255,247,93,141,155,82,0,65,71,133,0,0,133,0,0,1,81,98,219,102,192,219,103,0,138,100,131,0,0,0,122,174,220,155,82,0,222,91,133,
+    255,255,1,230,155,163,179,132,155,82,10,172,20,255,255,255,255,197,56,197,55,197,88,222,90,255,255,255,255,247,126,163,179,130,155,82,7,197,56,255,255,239,61,155,82,155,82,222,
+    123,255,255,230,155,130,155,82,7,171,212,255,255,247,126,155,82,155,82,188,182,255,255,247,93,141,155,82,0,65,71,133,0,0,133,0,0,1,81,98,219,102,192,219,103,0,138,100,
+    131,0,0,0,122,174,220,155,82,8,222,91,255,255,230,188,197,55,197,88,222,123,255,255,255,223,188,247,132,155,82,0,171,244,134,255,255,1,222,91,163,211,131,155,82,18,197,55,
+    255,255,239,61,155,82,155,82,180,85,255,255,255,223,163,179,155,82,155,82,205,153,255,255,213,217,155,82,155,82,188,182,255,255,247,93,141,155,82,0,65,71,133,0,0,133,0,0,
+    1,81,98,219,70,192,219,103,0,138,100,131,0,0,0,122,174,220,155,82,2,222,91,255,255,205,185,130,155,82,3,205,152,255,255,255,255,172,53,131,155,82,7,172,20,255,255,255,
+    255,205,120,205,120,197,88,188,214,163,211,133,155,82,2,197,56,255,255,239,61,130,155,82,12,238,253,255,255,205,120,155,82,155,114,247,126,255,255,171,244,155,82,155,82,188,182,255,
+    255,247,93,141,155,82,0,57,71,133,0,0,133,0,0,1,81,98,219,70,192,219,103,0,138,100,131,0,0,0,122,174,220,155,82,2,222,91,255,255,205,185,131,155,82,2,247,93,
+    255,255,222,123,131,155,82,2,172,20,255,255,255,255,138,155,82,2,197,56,255,255,239,61,130,155,82,6,197,55,255,255,247,93,155,82,197,55,255,255,230,188,130,155,82,2,188,182,
+    255,255,247,93,141,155,82,0,40,229,133,0,0,133,0,0,1,81,98,219,70,192,219,103,0,138,100,131,0,0,0,122,174,220,155,82,2,222,91,255,255,205,185,131,155,82,3,197,
+    88,255,255,255,255,163,212,130,155,82,2,172,20,255,255,255,255,138,155,82,2,197,56,255,255,239,61,130,155,82,6,163,147,255,223,255,255,180,150,247,126,255,255,188,214,130,155,82,
+    2,188,182,255,255,247,93,140,155,82,1,163,115,16,65,133,0,0,133,0,0,1,81,98,219,102,192,219,103,0,138,68,131,0,0,0,122,174,220,155,82,2,222,91,255,255,205,185,
+    131,155,82,3,163,179,255,255,255,255,205,120,130,155,82,2,172,20,255,255,255,255,138,155,82,2,197,55,255,255,239,61,131,155,82,5,222,123,255,255,247,94,255,255,255,191,155,114,
+    130,155,82,2,188,182,255,255,247,93,140,155,82,0,147,50,134,0,0,133,0,0,1,81,98,219,102,192,219,103,0,138,100,131,0,0,0,122,174,220,155,82,2,222,91,255,255,205,
+    185,132,155,82,2,222,91,255,255,239,61,130,155,82,2,171,244,255,255,255,255,138,155,82,2,197,55,255,255,239,61,131,155,82,0,188,182,130,255,255,0,214,26,131,155,82,2,188,
+    182,255,255,247,93,140,155,82,0,114,109,134,0,0,133,0,0,1,81,98,219,102,192,219,103,0,138,68,131,0,0,0,122,174,220,155,82,2,222,91,255,255,205,185,132,155,82,8,
+    172,20,255,255,255,255,180,117,155,82,155,82,172,20,255,255,255,255,138,155,82,2,197,56,255,255,239,61,132,155,82,3,247,158,255,255,255,255,172,53,131,155,82,2,188,150,255,255,
+    247,93,140,155,82,0,57,71,134,0,0,133,0,0,1,81,98,219,102,192,219,103,0,138,68,131,0,0,0,122,174,220,155,82,2,205,185,247,94,197,23,133,155,82,7,222,58,247,
+    94,197,55,155,82,155,82,163,211,239,61,239,29,138,155,82,2,188,182,247,93,222,91,132,155,82,2,197,88,247,94,222,58,132,155,82,2,172,53,247,93,222,123,139,155,82,0,147,
+    49,135,0,0,133,0,0,1,81,98,219,102,192,219,103,0,138,68,131,0,0,0,122,174,255,155,82,150,155,82,1,155,114,57,71,135,0,0,133,0,0,1,81,98,219,102,192,219,
+    103,0,138,100,131,0,0,0,122,174,255,155,82,150,155,82,0,114,141,136,0,0,133,0,0,1,81,98,219,102,192,219,103,0,138,68,131,0,0,0,122,174,255,155,82,149,155,82,
+    1,130,207,0,32,136,0,0,133,0,0,1,81,98,219,102,192,219,103,0,138,100,131,0,0,0,122,174,255,155,82,148,155,82,1,114,142,0,32,137,0,0,133,0,0,1,81,98,
+    219,102,192,219,103,0,138,100,131,0,0,0,122,174,255,155,82,147,155,82,0,73,136,139,0,0,133,0,0,1,81,98,219,70,192,219,103,0,138,68,131,0,0,0,122,174,255,155,
+    82,143,155,82,3,163,115,130,208,73,169,8,65,140,0,0,133,0,0,1,81,98,219,102,185,219,103,2,227,135,203,38,146,68,130,121,228,1,121,227,73,66,131,0,0,2,90,11,
+    114,142,114,142,130,114,109,4,114,110,114,142,114,141,114,142,114,110,130,114,142,0,114,110,160,114,142,139,122,142,129,122,174,129,122,142,135,122,174,2,122,175,122,174,122,174,162,122,
+    175,1,122,207,130,175,133,122,175,129,130,175,129,130,207,130,122,175,130,122,207,4,130,207,122,175,130,207,130,207,130,175,130,130,207,9,122,175,130,207,130,207,130,175,130,207,130,207,
+    130,175,114,109,73,169,24,130,143,0,0,133,0,0,1,81,98,219,102,183,219,103,2,211,70,130,4,40,193,255,0,0,172,0,0,133,0,0,1,81,98,219,102,182,219,103,1,162,
+    165,16,64,255,0,0,174,0,0,133,0,0,1,81,98,219,102,181,219,103,0,138,68,255,0,0,176,0,0,133,0,0,1,81,98,219,102,180,219,103,0,170,197,255,0,0,177,0,
+    0,133,0,0,1,81,98,219,102,179,219,103,1,227,135,40,161,255,0,0,177,0,0,133,0,0,1,81,98,219,102,179,219,103,0,146,101,255,0,0,178,0,0,133,0,0,1,81,
+    98,219,102,178,219,103,1,227,135,32,129,255,0,0,178,0,0,133,0,0,1,81,98,219,102,178,219,103,0,178,197,255,0,0,179,0,0,133,0,0,1,81,98,219,102,178,219,103,
+    0,121,228,255,0,0,179,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,255,0,0,179,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,255,0,0,179,0,
+    0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,255,0,0,179,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,255,0,0,179,0,0,133,0,0,1,81,98,219,
+    102,178,219,103,0,89,131,255,0,0,179,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,255,0,0,179,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,255,
+    0,0,179,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,255,0,0,179,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,194,0,0,2,24,128,57,128,90,
+    65,130,98,129,2,98,97,65,193,32,224,154,0,0,8,32,224,73,193,98,65,98,97,98,129,98,97,90,33,57,128,24,128,154,0,0,7,24,160,49,96,73,193,82,1,82,1,57,
+    160,41,32,8,64,160,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,169,0,0,1,16,96,172,34,130,171,226,129,172,2,1,171,226,82,1,140,0,0,3,49,64,139,
+    65,204,194,237,99,134,237,35,3,237,99,229,35,163,194,73,193,147,0,0,4,0,32,82,1,163,194,229,67,237,99,130,237,35,0,237,67,130,237,35,3,237,99,212,227,139,98,49,
+    32,147,0,0,6,8,32,82,33,163,226,221,35,237,99,237,66,229,35,130,237,35,4,237,67,237,131,204,194,139,66,49,64,157,0,0,133,0,0,1,81,98,219,102,178,219,103,0,
+    89,163,169,0,0,2,65,160,237,35,237,35,132,237,34,0,114,161,139,0,0,1,139,98,237,99,130,237,34,3,237,35,237,34,237,35,237,35,132,237,34,3,237,35,237,67,180,98,
+    24,160,144,0,0,2,41,32,204,226,237,35,131,237,34,0,237,35,134,237,34,3,237,35,237,99,163,226,16,96,144,0,0,2,90,65,221,67,237,67,132,237,35,3,237,34,237,35,
+    237,35,237,34,130,237,35,2,237,99,180,66,24,192,155,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,131,169,0,0,1,131,1,237,35,131,237,34,2,237,35,237,34,114,
+    161,137,0,0,6,16,96,188,98,237,35,237,35,237,34,237,34,237,35,130,237,34,2,237,35,237,34,237,35,130,237,34,130,237,35,1,229,35,82,1,142,0,0,1,81,225,229,35,
+    130,237,35,10,237,34,237,35,237,34,237,34,237,35,237,34,237,34,237,35,237,35,237,34,237,34,130,237,35,1,204,226,32,224,141,0,0,2,0,32,147,162,237,67,131,237,35,3,
+    237,34,237,35,237,34,237,34,130,237,35,6,237,34,237,35,237,34,237,34,237,35,221,35,57,128,154,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,163,168,0,0,2,8,
+    64,221,3,237,35,132,237,34,1,237,35,114,161,136,0,0,1,16,96,196,162,130,237,35,137,237,34,0,237,35,131,237,34,2,237,35,237,67,90,33,140,0,0,1,81,225,237,67,
+    130,237,35,4,237,34,237,35,237,34,237,34,237,35,131,237,34,0,237,35,132,237,34,2,237,35,212,227,24,160,140,0,0,0,172,2,131,237,35,1,237,34,237,35,135,237,34,6,
+    237,35,237,34,237,35,237,34,237,35,229,67,57,128,153,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,163,168,0,0,2,123,1,237,34,237,35,133,237,34,0,114,161,135,
+    0,0,2,0,32,196,162,237,35,141,237,34,0,237,35,130,237,34,129,237,35,1,229,67,41,0,138,0,0,1,41,32,229,35,131,237,35,129,237,34,0,237,35,132,237,34,129,237,
+    35,1,237,34,237,35,130,237,34,129,237,35,0,188,98,139,0,0,0,123,1,130,237,35,0,237,34,130,237,35,133,237,34,129,237,35,129,237,34,5,237,35,237,34,237,35,237,35,
+    221,35,24,160,152,0,0,133,0,0,1,81,98,219,102,178,219,103,0,89,163,167,0,0,4,82,1,237,67,237,34,237,34,237,35,132,237,34,0,114,161,135,0,0,2,114,193,237,
+    35,237,35,130,237,34,0,237,35,130,237,34,0,237,35,131,237,34,5,237,35,237,34,237,34,237,35,237,35,237,34,130,237,35,0,180,66,137,0,0,3,8,32,212,226,237,35,237,
+    35,131,237,34,0,237,35,133,237,34,0,237,35,135,237,34,1,237,67,98,97,137,0,0,2,41,32,237,67,237,35,131,237,34,129,237,35,131,237,34,2,237,35,237,34,237,35,130,
+    237,34,129,237,35,3,237,34,237,35,237,35,163,194,152,0,0,133,0,0,0,81,98,138,227,135,2,227,167,227,135,235,135,163,227,135,2,227,167,227,135,97,163,166,0,0,1,82,
+    1,237,99,136,237,34,0,114,161,135,0,0,3,212,227,237,34,237,34,237,35,134,237,34,130,237,35,129,237,34,0,237,35,132,237,34,3,237,35,237,34,237,99,41,0,136,0,0,
+    1,98,129,237,35,131,237,34,131,237,35,0,237,34,133,237,35,134,237,34,1,237,67,196,130,137,0,0,6,172,34,237,35,237,35,237,34,237,34,237,35,237,34,130,237,35,0,237,
+    34,133,237,35,2,237,34,237,35,237,34,131,237,35,1,237,99,41,32,151,0,0,224,0,0,3,16,128,147,97,237,67,237,35,131,237,34,0,237,35,131,237,34,0,114,161,134,0,
+    0,15,57,96,237,67,237,35,237,34,237,35,237,34,237,35,237,34,237,34,237,35,237,35,237,67,204,162,171,226,180,34,229,66,130,237,35,129,237,34,132,237,35,0,123,1,136,0,
+    0,0,188,98,130,237,35,3,237,34,237,35,237,34,237,34,130,237,35,3,237,67,237,99,229,67,237,131,130,237,35,132,237,34,129,237,35,1,237,99,41,0,135,0,0,4,24,192,
+    237,99,237,35,237,34,237,34,130,237,35,129,237,34,129,237,35,2,237,67,237,131,237,99,131,237,35,7,237,34,237,35,237,35,237,34,237,35,237,35,237,34,163,226,151,0,0,221,
+    0,0,4,24,160,82,1,155,162,229,67,237,35,138,237,34,0,114,161,134,0,0,0,122,225,130,237,35,0,237,34,130,237,35,3,237,34,237,67,212,226,49,64,130,0,0,1,8,
+    64,163,194,130,237,35,0,237,34,132,237,35,0,188,98,135,0,0,1,24,160,237,99,130,237,34,132,237,35,17,237,67,163,226,49,64,0,0,0,0,16,64,106,129,229,35,237,35,
+    237,34,237,35,237,35,237,34,237,35,237,34,237,35,237,35,131,2,135,0,0,0,106,129,130,237,35,132,237,34,18,237,35,229,35,131,33,57,96,16,96,32,192,90,65,204,194,237,
+    35,237,34,237,35,237,34,237,35,237,34,237,34,237,35,237,35,237,131,16,96,150,0,0,218,0,0,3,73,225,188,66,221,3,237,99,131,237,35,136,237,34,2,237,35,237,34,114,
+    161,134,0,0,2,172,2,237,35,237,35,131,237,34,129,237,35,1,237,99,49,32,133,0,0,5,188,130,237,35,237,35,237,34,237,35,237,34,130,237,35,1,237,99,8,32,134,0,
+    0,10,90,33,237,35,237,34,237,34,237,35,237,35,237,34,237,34,237,35,237,35,163,194,133,0,0,1,32,224,229,35,131,237,35,129,237,34,2,237,35,237,34,188,98,135,0,0,
+    0,155,130,130,237,35,6,237,34,237,35,237,34,237,34,237,35,237,67,73,160,132,0,0,3,8,32,188,98,237,35,237,34,130,237,35,0,237,34,130,237,35,0,73,225,150,0,0,
+    218,0,0,0,98,129,130,237,35,141,237,34,1,237,35,114,161,134,0,0,1,204,162,237,35,131,237,34,3,237,35,237,34,237,35,180,66,134,0,0,1,81,225,237,35,131,237,34,
+    4,237,35,237,34,237,35,237,67,57,96,134,0,0,1,131,33,237,67,131,237,34,130,237,35,1,237,99,24,160,134,0,0,3,131,1,237,35,237,34,237,35,131,237,34,1,237,35,
+    229,67,135,0,0,0,196,130,135,237,35,0,188,98,134,0,0,6,73,193,237,67,237,35,237,35,237,34,237,35,237,34,130,237,35,0,114,161,150,0,0,133,0,0,1,82,1,237,
+    131,178,245,131,0,98,129,158,0,0,5,98,129,237,35,237,35,237,34,237,34,237,35,130,237,34,2,237,35,237,34,237,35,134,237,34,0,114,161,134,0,0,1,229,35,237,35,132,
+    237,34,129,237,35,0,139,33,134,0,0,10,8,64,237,99,237,35,237,34,237,34,237,35,237,34,237,34,237,35,237,35,82,33,134,0,0,4,155,162,237,34,237,35,237,34,237,35,
+    130,237,34,1,237,35,204,194,135,0,0,2,65,160,237,35,237,35,131,237,34,129,237,35,0,245,131,135,0,0,0,221,3,135,237,35,0,139,65,134,0,0,1,8,32,237,131,130,
+    237,35,0,237,34,130,237,35,1,237,67,139,65,150,0,0,133,0,0,1,82,1,229,3,177,237,34,1,237,35,98,97,158,0,0,0,98,129,131,237,35,5,237,34,237,35,237,34,
+    237,34,237,35,237,35,135,237,34,0,114,161,134,0,0,1,237,131,237,35,133,237,34,1,237,35,106,129,135,0,0,0,237,99,131,237,34,130,237,35,1,237,34,114,161,134,0,0,
+    0,188,66,130,237,35,131,237,34,1,237,35,180,34,135,0,0,1,40,224,237,99,130,237,35,130,237,34,2,237,35,237,131,8,32,134,0,0,0,237,131,133,237,35,2,237,34,237,
+    35,106,129,135,0,0,2,229,35,237,35,237,34,131,237,35,2,237,34,237,67,147,130,150,0,0,133,0,0,1,82,1,237,35,132,237,34,0,237,35,137,237,34,129,237,35,131,237,
+    34,0,237,35,135,237,34,129,237,35,131,237,34,0,237,35,132,237,34,129,237,35,132,237,34,1,237,35,98,129,158,0,0,0,98,129,132,237,35,129,237,34,0,237,35,130,237,34,
+    0,237,35,130,237,34,3,237,35,237,34,237,34,114,161,134,0,0,0,237,131,133,237,34,129,237,35,0,98,97,135,0,0,2,237,99,237,34,237,34,130,237,35,129,237,34,1,237,
+    35,122,225,134,0,0,4,196,130,237,35,237,34,237,35,237,35,130,237,34,1,237,35,163,226,135,0,0,1,16,96,237,131,132,237,34,129,237,35,1,237,163,8,32,134,0,0,9,
+    237,131,237,35,237,35,237,34,237,35,237,34,237,34,237,35,237,35,98,97,135,0,0,0,221,3,131,237,34,131,237,35,0,155,162,150,0,0,133,0,0,1,82,1,237,35,132,237,
+    34,0,237,35,146,237,34,0,237,35,135,237,34,0,237,35,130,237,34,0,237,35,138,237,34,1,237,35,98,97,158,0,0,0,98,129,137,237,35,135,237,34,0,114,161,134,0,0,
+    0,237,131,134,237,34,1,237,35,98,97,135,0,0,2,237,99,237,34,237,35,133,237,34,0,122,226,134,0,0,0,196,130,132,237,35,129,237,34,1,237,35,163,226,135,0,0,2,
+    8,64,155,194,147,162,133,155,162,1,155,226,8,32,134,0,0,2,237,131,237,35,237,35,130,237,34,130,237,35,0,98,97,135,0,0,9,213,2,237,35,237,35,237,34,237,34,237,
+    35,237,34,237,34,237,35,155,162,150,0,0,133,0,0,1,82,1,229,35,165,237,34,0,237,35,135,237,34,4,237,35,237,34,237,34,237,35,98,129,158,0,0,0,82,33,135,188,
+    130,0,204,194,136,237,34,0,114,161,134,0,0,0,237,131,134,237,34,1,237,35,98,97,135,0,0,0,237,99,135,237,34,0,122,226,134,0,0,0,196,130,130,237,35,132,237,34,
+    0,163,226,153,0,0,2,237,131,237,35,237,35,132,237,34,1,237,35,98,97,135,0,0,4,213,2,237,35,237,35,237,34,237,34,131,237,35,0,155,162,150,0,0,133,0,0,4,
+    82,1,237,35,237,35,237,34,237,35,130,237,34,2,237,35,237,34,237,35,130,237,34,0,237,35,131,237,34,129,237,35,131,237,34,129,237,35,133,237,34,130,237,35,131,237,34,129,
+    237,35,131,237,34,129,237,35,131,237,34,1,237,35,98,129,167,0,0,1,66,1,229,35,135,237,34,0,106,161,134,0,0,1,237,131,237,35,133,237,34,1,237,35,98,97,135,0,
+    0,0,237,99,135,237,34,0,123,1,134,0,0,5,196,130,237,35,237,34,237,34,237,35,237,35,130,237,34,0,163,194,153,0,0,3,237,163,237,34,237,35,237,35,131,237,34,1,
+    237,35,98,97,135,0,0,1,213,3,237,35,131,237,34,3,237,35,237,34,237,35,155,162,150,0,0,133,0,0,1,82,1,229,35,130,237,34,4,237,35,237,34,237,35,237,34,237,
+    35,136,237,34,129,237,35,130,237,34,130,237,35,133,237,34,130,237,35,131,237,34,129,237,35,131,237,34,129,237,35,131,237,34,1,237,35,98,97,167,0,0,1,66,1,229,3,133,
+    237,34,2,237,35,237,34,106,161,134,0,0,0,237,131,133,237,34,129,237,35,0,98,97,135,0,0,0,237,99,135,237,34,0,122,225,134,0,0,0,196,130,131,237,35,130,237,34,
+    1,237,35,163,226,153,0,0,2,237,131,237,34,237,35,130,237,34,129,237,35,1,237,34,98,97,135,0,0,5,213,3,237,35,237,34,237,34,237,35,237,34,130,237,35,0,155,162,
+    150,0,0,133,0,0,9,82,1,229,35,237,34,237,35,237,34,237,34,237,35,237,34,237,34,237,35,130,237,34,129,237,35,129,237,34,131,237,35,129,237,34,131,237,35,132,237,34,
+    131,237,35,131,237,34,129,237,35,129,237,34,129,237,35,1,237,34,237,35,131,237,34,1,237,35,98,97,167,0,0,1,65,225,229,35,135,237,34,0,114,161,134,0,0,0,237,99,
+    134,237,34,1,237,35,98,97,135,0,0,0,237,99,133,237,34,2,237,35,237,34,122,193,134,0,0,0,196,130,131,237,35,131,237,34,0,163,226,153,0,0,9,237,163,237,35,237,
+    34,237,35,237,34,237,34,237,35,237,34,237,35,98,97,135,0,0,9,213,2,237,35,237,34,237,35,237,34,237,35,237,35,237,34,237,35,155,162,150,0,0,133,0,0,3,82,1,
+    229,35,237,34,237,34,130,237,35,1,237,34,237,35,136,237,34,2,237,35,237,34,237,35,130,237,34,3,237,35,237,34,237,34,237,35,135,237,34,0,237,35,130,237,34,0,237,35,
+    130,237,34,0,237,35,134,237,34,1,237,35,98,97,167,0,0,1,66,1,237,35,135,237,34,0,106,161,134,0,0,1,213,2,237,35,134,237,34,0,98,97,135,0,0,0,237,99,
+    135,237,34,0,90,65,134,0,0,2,196,130,237,34,237,35,132,237,34,1,237,35,163,226,153,0,0,2,237,131,237,35,237,35,131,237,34,2,237,35,237,34,98,97,135,0,0,2,
+    213,2,237,35,237,34,133,237,35,0,155,162,150,0,0,133,0,0,3,82,1,229,35,237,35,237,34,130,237,35,129,237,34,0,237,35,132,237,34,0,237,35,132,237,34,129,237,35,
+    134,237,34,129,237,35,137,237,34,0,237,35,133,237,34,4,237,35,237,34,237,34,237,35,98,97,167,0,0,2,66,1,229,3,237,35,133,237,34,1,237,35,106,161,134,0,0,1,
+    188,98,237,35,133,237,34,1,237,35,114,193,135,0,0,0,237,131,134,237,34,1,237,67,57,96,134,0,0,9,196,130,237,35,237,35,237,34,237,34,237,35,237,35,237,34,237,35,
+    163,194,153,0,0,0,237,131,134,237,34,1,237,35,98,97,135,0,0,1,213,2,237,34,130,237,35,129,237,34,129,237,35,0,155,162,150,0,0,133,0,0,9,82,1,229,35,237,
+    34,237,34,237,35,237,34,237,35,237,34,237,34,237,35,130,237,34,129,237,35,1,237,34,237,35,136,237,34,0,237,35,135,237,34,0,237,35,134,237,34,0,237,35,135,237,34,1,
+    237,35,98,129,167,0,0,1,66,1,237,35,135,237,34,0,114,161,134,0,0,1,147,130,237,35,133,237,34,1,237,35,147,98,134,0,0,1,49,32,237,67,132,237,34,129,237,35,
+    1,237,99,0,32,134,0,0,0,196,130,132,237,35,130,237,34,0,163,194,132,0,0,6,57,96,114,161,123,1,123,33,122,225,73,193,0,32,141,0,0,9,237,131,237,34,237,34,
+    237,35,237,34,237,34,237,35,237,35,237,34,98,97,135,0,0,9,213,2,237,34,237,34,237,35,237,34,237,35,237,35,237,34,237,35,155,162,150,0,0,133,0,0,7,82,1,229,
+    35,237,34,237,34,237,35,237,34,237,34,237,35,133,237,34,129,237,35,131,237,34,17,237,35,237,34,237,35,237,34,237,34,237,35,237,34,237,35,237,35,237,34,237,35,237,35,237,
+    34,237,34,237,35,237,34,237,35,237,35,130,237,34,129,237,35,3,237,34,237,35,237,34,237,34,130,237,35,129,237,34,1,237,35,98,129,167,0,0,1,66,1,237,2,135,237,34,
+    0,114,161,134,0,0,1,98,65,237,35,131,237,34,3,237,35,237,34,237,35,204,194,134,0,0,9,131,65,237,35,237,34,237,34,237,35,237,34,237,35,237,34,237,35,196,98,135,
+    0,0,0,196,130,130,237,35,11,237,34,237,35,237,34,237,34,237,35,163,194,0,0,0,0,0,32,114,193,221,35,237,67,131,237,35,3,237,67,229,35,155,162,41,0,139,0,0,
+    1,237,131,237,35,133,237,34,1,237,35,98,97,135,0,0,1,213,2,237,35,131,237,34,3,237,35,237,34,237,35,155,162,150,0,0,133,0,0,1,82,1,229,34,131,237,34,129,
+    237,35,147,237,34,0,237,35,135,237,34,0,237,35,137,237,34,5,237,35,237,34,237,34,237,35,237,35,98,97,167,0,0,1,74,1,229,34,135,237,34,0,114,161,134,0,0,1,
+    16,128,237,67,134,237,34,1,237,67,114,161,132,0,0,2,57,96,237,66,237,35,130,237,34,131,237,35,0,106,129,135,0,0,0,196,130,131,237,35,130,237,34,5,237,35,163,194,
+    0,0,41,32,204,194,237,35,130,237,34,129,237,35,131,237,34,1,237,67,106,161,138,0,0,4,237,163,237,34,237,34,237,35,237,35,130,237,34,1,237,35,98,97,135,0,0,0,
+    213,2,130,237,34,0,237,35,130,237,34,1,237,35,155,162,150,0,0,133,0,0,1,82,1,229,35,142,237,34,8,237,35,237,34,237,34,237,35,237,34,237,34,237,35,237,34,237,
+    35,133,237,34,2,237,35,237,34,237,35,133,237,34,4,237,35,237,34,237,34,237,35,237,35,132,237,34,129,237,35,0,98,129,167,0,0,1,66,1,237,35,135,237,34,0,114,161,
+    135,0,0,0,147,98,130,237,35,131,237,34,17,237,35,237,67,155,194,81,225,49,64,57,96,123,1,229,35,237,35,237,35,237,34,237,34,237,35,237,34,237,35,237,67,212,226,8,
+    32,135,0,0,0,196,130,130,237,35,9,237,34,237,35,237,34,237,34,237,35,163,194,57,128,229,35,237,35,237,35,131,237,34,129,237,35,130,237,34,2,237,35,237,67,123,1,137,
+    0,0,3,237,131,237,34,237,34,237,35,131,237,34,1,237,35,98,97,135,0,0,1,213,3,237,35,130,237,34,4,237,35,237,34,237,34,237,35,155,162,150,0,0,133,0,0,1,
+    82,1,237,35,134,237,34,0,237,35,133,237,34,0,237,35,130,237,34,129,237,35,135,237,34,0,237,35,137,237,34,2,237,35,237,34,237,35,130,237,34,0,237,35,131,237,34,1,
+    237,35,98,129,167,0,0,1,74,1,237,35,134,237,34,1,237,35,114,161,135,0,0,2,8,64,204,194,237,35,134,237,34,129,237,35,7,237,67,237,35,237,35,237,34,237,34,237,
+    35,237,35,237,34,130,237,35,1,229,35,57,96,136,0,0,0,196,130,135,237,35,2,204,162,229,35,237,35,132,237,34,0,237,35,134,237,34,1,237,67,65,161,136,0,0,2,237,
+    131,237,35,237,35,132,237,34,1,237,35,98,97,135,0,0,1,213,2,237,35,130,237,34,4,237,35,237,34,237,34,237,35,155,162,150,0,0,133,0,0,1,82,1,237,35,134,237,
+    34,0,237,35,136,237,34,0,237,35,132,237,34,0,237,35,134,237,34,129,237,35,132,237,34,129,237,35,131,237,34,0,237,35,132,237,34,1,237,67,98,129,167,0,0,1,66,1,
+    237,35,135,237,34,0,114,161,136,0,0,1,16,96,204,162,131,237,35,136,237,34,7,237,35,237,34,237,35,237,34,237,35,237,35,237,67,73,225,137,0,0,0,196,130,131,237,35,
+    3,237,34,237,35,237,35,237,34,131,237,35,130,237,34,0,237,35,132,237,34,4,237,35,237,34,237,35,237,35,196,130,136,0,0,0,237,163,130,237,35,1,237,34,237,35,130,237,
+    34,0,98,97,135,0,0,9,213,3,237,35,237,34,237,35,237,34,237,35,237,34,237,34,237,35,155,162,150,0,0,133,0,0,1,82,1,237,35,130,237,34,0,237,35,140,237,34,
+    0,237,35,132,237,34,5,237,35,237,34,237,35,237,34,237,34,237,35,130,237,34,2,237,35,237,34,237,35,130,237,34,0,237,35,130,237,34,2,237,35,237,34,237,35,132,237,34,
+    1,237,35,98,129,167,0,0,1,66,1,229,35,135,237,34,0,114,161,137,0,0,6,8,64,131,1,229,2,237,35,237,35,237,34,237,35,134,237,34,131,237,35,2,229,34,163,194,
+    49,64,138,0,0,0,196,130,131,237,35,7,237,34,237,35,237,35,237,34,237,35,237,34,237,35,237,35,130,237,34,11,237,35,237,34,237,34,237,35,237,35,237,34,237,35,237,35,
+    237,34,237,35,237,67,65,161,135,0,0,0,237,131,130,237,35,131,237,34,1,237,35,98,97,135,0,0,0,213,2,130,237,35,5,237,34,237,35,237,34,237,34,237,35,155,162,150,
+    0,0,133,0,0,2,82,1,229,35,237,35,130,237,34,0,237,35,132,237,34,3,237,35,237,34,237,35,237,35,130,237,34,6,237,35,237,34,237,35,237,34,237,34,237,35,237,35,
+    131,237,34,4,237,35,237,34,237,34,237,35,237,35,132,237,34,130,237,35,4,237,34,237,35,237,34,237,35,237,35,131,237,34,1,237,35,98,129,167,0,0,1,66,1,237,35,134,
+    237,34,1,237,35,114,161,137,0,0,5,24,160,172,2,237,67,237,34,237,35,237,35,135,237,34,131,237,35,2,237,67,196,130,65,160,138,0,0,0,196,130,130,237,35,129,237,34,
+    2,237,35,237,34,237,34,131,237,35,129,237,34,12,237,35,237,34,237,35,237,34,237,35,237,34,237,35,237,35,237,34,237,34,237,35,237,34,172,2,135,0,0,2,237,131,237,34,
+    237,35,132,237,34,1,237,35,98,97,135,0,0,2,213,2,237,35,237,35,132,237,34,1,237,35,155,162,150,0,0,133,0,0,1,82,1,237,35,130,237,34,0,237,35,140,237,34,
+    0,237,35,132,237,34,0,237,35,142,237,34,0,237,35,131,237,34,0,237,35,132,237,34,1,237,35,98,129,167,0,0,1,66,1,237,35,135,237,34,0,114,161,136,0,0,5,65,
+    128,221,3,237,35,237,35,237,34,237,35,137,237,34,1,237,35,237,34,130,237,35,1,237,67,114,161,137,0,0,5,196,130,237,35,237,35,237,34,237,35,237,35,130,237,34,129,237,
+    35,7,237,67,196,162,147,130,139,66,163,194,229,35,237,35,237,35,135,237,34,1,237,131,0,32,134,0,0,1,237,131,237,34,130,237,35,129,237,34,129,237,35,0,98,97,135,0,
+    0,1,213,2,237,35,130,237,34,129,237,35,2,237,34,237,35,155,162,150,0,0,133,0,0,1,82,1,229,35,134,237,34,0,237,35,169,237,34,1,237,67,98,129,167,0,0,0,
+    65,225,135,237,34,1,237,35,114,161,135,0,0,2,57,96,237,67,237,35,131,237,34,0,237,35,134,237,34,129,237,35,131,237,34,129,237,35,1,237,67,114,193,136,0,0,0,196,
+    130,131,237,35,6,237,34,237,35,237,34,237,35,237,35,229,35,73,160,131,0,0,3,16,128,172,2,237,35,237,35,134,237,34,1,237,67,49,32,134,0,0,2,237,131,237,34,237,
+    35,132,237,34,1,237,35,98,97,135,0,0,1,213,2,237,35,130,237,34,129,237,35,2,237,34,237,35,155,162,150,0,0,133,0,0,3,82,1,237,35,237,34,237,34,130,237,35,
+    134,237,34,0,237,35,131,237,34,0,237,35,130,237,34,0,237,35,135,237,34,0,237,35,140,237,34,0,237,35,132,237,34,1,237,35,98,129,167,0,0,1,65,225,237,35,135,237,
+    34,0,114,161,135,0,0,0,204,194,134,237,34,130,237,35,2,237,99,237,131,237,131,130,237,35,134,237,34,1,237,67,41,0,135,0,0,3,196,130,237,67,237,34,237,35,130,237,
+    34,130,237,35,0,106,161,134,0,0,1,204,194,237,35,133,237,34,129,237,35,0,73,225,134,0,0,9,237,163,237,35,237,35,237,34,237,34,237,35,237,34,237,35,237,35,98,97,
+    135,0,0,9,213,3,237,35,237,34,237,34,237,35,237,34,237,35,237,34,237,35,155,162,150,0,0,133,0,0,1,82,1,229,35,132,237,35,130,237,34,0,237,35,137,237,34,2,
+    237,35,237,34,237,35,135,237,34,0,237,35,146,237,34,1,237,35,98,129,167,0,0,1,65,225,229,35,133,237,34,129,237,35,0,114,161,134,0,0,1,73,225,237,67,135,237,34,
+    8,229,35,114,193,41,0,8,32,16,64,73,193,196,130,237,35,237,35,132,237,34,129,237,35,0,155,194,135,0,0,2,196,130,237,35,237,35,132,237,34,2,237,35,229,35,8,64,
+    134,0,0,1,114,193,237,35,131,237,34,4,237,35,237,34,237,34,237,35,98,65,134,0,0,0,237,163,130,237,34,0,237,35,130,237,34,1,237,35,98,97,135,0,0,1,213,2,
+    237,35,131,237,34,130,237,35,0,155,162,150,0,0,133,0,0,1,82,1,229,34,130,237,34,129,237,35,129,237,34,0,237,35,135,237,34,0,237,35,132,237,34,0,237,35,135,237,
+    34,0,237,35,133,237,34,0,237,35,132,237,34,0,237,35,132,237,34,1,237,35,98,129,167,0,0,1,73,225,229,34,134,237,34,1,237,35,114,161,134,0,0,1,172,2,237,35,
+    134,237,34,1,237,67,65,128,132,0,0,2,8,32,180,66,237,35,134,237,34,1,237,99,24,128,134,0,0,0,196,130,133,237,35,2,237,34,237,35,172,2,135,0,0,2,57,96,
+    237,34,237,35,133,237,34,1,237,35,98,97,134,0,0,9,237,131,237,34,237,35,237,34,237,35,237,35,237,34,237,34,237,35,98,97,135,0,0,1,212,226,237,35,131,237,34,130,
+    237,35,0,155,162,150,0,0,133,0,0,1,82,1,229,35,130,237,34,129,237,35,2,237,34,237,35,237,34,130,237,35,130,237,34,9,237,35,237,34,237,34,237,35,237,34,237,34,
+    237,35,237,34,237,35,237,35,132,237,34,2,237,35,237,34,237,35,133,237,34,7,237,35,237,34,237,34,237,35,237,34,237,34,237,35,237,35,131,237,34,1,237,35,98,97,167,0,
+    0,1,66,1,229,35,135,237,34,0,114,161,133,0,0,1,8,32,229,99,134,237,34,1,237,35,155,162,134,0,0,3,24,128,237,67,237,34,237,35,130,237,34,3,237,35,237,34,
+    237,34,106,193,134,0,0,0,196,130,131,237,35,129,237,34,129,237,35,0,147,98,135,0,0,2,24,128,237,99,237,35,132,237,34,129,237,35,0,98,97,134,0,0,1,237,131,237,
+    35,132,237,34,129,237,35,0,98,97,135,0,0,9,213,3,237,35,237,35,237,34,237,34,237,35,237,34,237,34,237,35,155,162,150,0,0,133,0,0,4,82,1,229,35,237,35,237,
+    34,237,34,130,237,35,0,237,34,131,237,35,129,237,34,0,237,35,131,237,34,0,237,35,133,237,34,3,237,35,237,34,237,34,237,35,132,237,34,0,237,35,132,237,34,0,237,35,
+    132,237,34,0,237,35,130,237,34,1,237,35,98,97,167,0,0,1,65,225,229,3,135,237,34,0,114,161,133,0,0,1,49,96,237,35,133,237,34,129,237,35,0,90,33,135,0,0,
+    0,180,66,131,237,34,4,237,35,237,34,237,35,237,34,172,2,134,0,0,0,196,130,131,237,35,130,237,34,1,237,35,139,66,135,0,0,2,16,64,237,131,237,35,132,237,34,129,
+    237,35,0,98,97,134,0,0,0,237,131,130,237,35,130,237,34,129,237,35,0,98,97,135,0,0,3,213,3,237,35,237,34,237,34,132,237,35,0,155,162,150,0,0,133,0,0,7,
+    82,1,229,35,237,34,237,34,237,35,237,34,237,34,237,35,131,237,34,2,237,35,237,34,237,35,164,237,34,1,237,35,98,129,167,0,0,1,66,1,237,35,134,237,34,1,237,35,
+    114,161,133,0,0,1,90,33,237,35,133,237,34,2,237,35,237,67,49,64,135,0,0,5,147,130,237,35,237,35,237,34,237,34,237,35,130,237,34,0,204,162,134,0,0,3,196,130,
+    237,35,237,34,237,35,132,237,34,0,139,65,135,0,0,1,16,64,237,131,132,237,34,130,237,35,0,98,97,134,0,0,0,237,131,131,237,34,4,237,35,237,34,237,34,237,35,98,
+    97,135,0,0,0,213,3,134,237,34,1,237,35,155,162,150,0,0,133,0,0,6,82,1,229,35,237,34,237,34,237,35,237,34,237,35,133,237,34,0,237,35,131,237,34,129,237,35,
+    132,237,34,0,237,35,135,237,34,0,237,35,131,237,34,129,237,35,131,237,34,129,237,35,129,237,34,4,237,35,237,34,237,34,237,35,98,129,167,0,0,1,66,1,237,35,135,237,
+    34,0,114,161,133,0,0,1,98,97,237,35,133,237,34,2,237,35,237,67,49,32,135,0,0,0,139,130,133,237,34,2,237,35,237,34,229,35,134,0,0,0,196,130,130,237,35,5,
+    237,34,237,35,237,35,237,34,237,35,139,34,135,0,0,1,16,96,237,131,134,237,34,1,237,35,98,97,134,0,0,0,237,131,130,237,34,0,237,35,130,237,34,1,237,35,98,97,
+    135,0,0,4,213,2,237,35,237,34,237,34,237,35,130,237,34,1,237,35,155,162,150,0,0,133,0,0,3,82,1,229,35,237,34,237,34,131,237,35,137,237,34,129,237,35,130,237,
+    34,2,237,35,237,34,237,35,133,237,34,2,237,35,237,34,237,35,131,237,34,130,237,35,130,237,34,129,237,35,132,237,34,1,237,35,98,97,167,0,0,1,66,1,229,35,134,237,
+    34,1,237,35,114,161,133,0,0,1,98,129,237,35,133,237,34,2,237,35,237,67,49,32,135,0,0,0,147,130,130,237,34,0,237,35,130,237,34,1,237,35,237,67,134,0,0,1,
+    196,130,237,35,131,237,34,3,237,35,237,34,237,35,139,33,135,0,0,1,16,96,237,131,132,237,34,130,237,35,0,98,97,134,0,0,0,237,131,133,237,34,129,237,35,0,98,97,
+    135,0,0,0,213,2,132,237,34,3,237,35,237,34,237,35,155,162,150,0,0,133,0,0,5,82,1,229,35,237,34,237,34,237,35,237,35,162,237,34,0,237,35,130,237,34,2,237,
+    35,237,34,237,35,131,237,34,1,237,35,98,129,167,0,0,2,66,1,237,35,237,35,134,237,34,0,114,161,133,0,0,1,98,129,237,35,134,237,34,1,237,67,49,32,135,0,0,
+    0,147,130,135,237,34,0,237,99,134,0,0,1,196,130,237,35,130,237,34,4,237,35,237,34,237,35,237,35,139,66,135,0,0,1,16,96,237,131,132,237,34,130,237,35,0,98,97,
+    134,0,0,9,237,131,237,34,237,35,237,34,237,35,237,34,237,34,237,35,237,35,98,97,135,0,0,1,213,3,237,35,132,237,34,129,237,35,0,155,162,150,0,0,133,0,0,6,
+    82,1,229,35,237,35,237,34,237,34,237,35,237,35,149,237,34,0,237,35,147,237,34,3,237,35,237,34,237,35,98,129,167,0,0,1,66,1,229,3,134,237,34,1,237,35,114,161,
+    133,0,0,1,98,129,237,35,134,237,34,1,237,67,49,32,135,0,0,0,139,130,130,237,34,0,237,35,131,237,34,0,237,99,134,0,0,1,196,130,237,35,133,237,34,1,237,35,
+    139,34,135,0,0,3,16,96,237,131,237,34,237,35,130,237,34,130,237,35,0,98,97,134,0,0,3,237,131,237,34,237,34,237,35,131,237,34,1,237,35,98,97,135,0,0,1,213,
+    3,237,35,130,237,34,129,237,35,2,237,34,237,35,155,162,150,0,0,133,0,0,4,82,1,237,35,237,35,237,34,237,35,141,237,34,0,237,35,132,237,34,0,237,35,135,237,34,
+    0,237,35,133,237,34,0,237,35,131,237,34,0,237,35,132,237,34,1,237,35,98,97,167,0,0,2,65,225,237,3,237,35,133,237,34,1,237,35,114,161,133,0,0,1,98,129,237,
+    35,132,237,34,3,237,35,237,34,237,67,49,32,135,0,0,2,147,130,237,34,237,35,130,237,34,3,237,35,237,34,237,35,237,99,134,0,0,1,196,130,237,35,133,237,34,1,237,
+    35,139,66,135,0,0,2,16,96,237,131,237,35,133,237,34,1,237,35,98,97,134,0,0,3,237,163,237,34,237,35,237,35,130,237,34,129,237,35,0,98,97,135,0,0,4,213,2,
+    237,35,237,34,237,35,237,35,131,237,34,0,155,162,150,0,0,133,0,0,9,82,1,229,35,237,34,237,34,237,35,237,34,237,35,237,34,237,34,237,35,138,237,34,0,237,35,132,
+    237,34,0,237,35,135,237,34,0,237,35,138,237,34,0,237,35,130,237,34,1,237,35,98,97,167,0,0,1,65,225,229,2,135,237,34,0,114,161,133,0,0,1,98,129,237,35,133,
+    237,34,2,237,35,237,67,49,32,135,0,0,0,147,130,133,237,34,2,237,35,237,34,237,99,134,0,0,1,196,130,237,35,131,237,34,3,237,35,237,34,237,35,139,65,135,0,0,
+    1,16,96,237,131,133,237,34,129,237,35,0,98,97,134,0,0,2,237,131,237,34,237,35,131,237,34,129,237,35,0,98,97,135,0,0,4,213,2,237,35,237,35,237,34,237,35,130,
+    237,34,1,237,35,155,162,150,0,0,133,0,0,7,82,1,229,35,237,34,237,34,237,35,237,35,237,34,237,35,130,237,34,0,237,35,134,237,34,129,237,35,131,237,34,0,237,35,
+    135,237,34,0,237,35,133,237,34,0,237,35,137,237,34,1,237,35,98,129,167,0,0,1,66,1,237,35,134,237,34,1,237,35,114,161,133,0,0,2,98,129,237,35,237,35,130,237,
+    34,4,237,35,237,34,237,34,237,66,49,32,135,0,0,0,139,130,130,237,34,0,237,35,131,237,34,0,237,99,134,0,0,1,196,130,237,35,132,237,34,129,237,35,0,139,65,135,
+    0,0,4,16,96,237,131,237,34,237,34,237,35,130,237,34,129,237,35,0,98,97,134,0,0,2,237,131,237,34,237,35,131,237,34,129,237,35,0,98,97,135,0,0,0,212,226,131,
+    237,35,4,237,34,237,35,237,34,237,34,155,194,150,0,0,133,0,0,4,82,1,229,35,237,35,237,34,237,35,141,237,34,0,237,35,140,237,34,0,237,35,132,237,34,129,237,35,
+    138,237,34,1,237,35,98,129,167,0,0,1,65,225,229,3,131,237,34,4,237,35,237,34,237,34,237,35,114,161,133,0,0,4,98,129,237,35,237,34,237,34,237,35,131,237,34,1,
+    237,67,49,32,135,0,0,0,147,130,130,237,34,0,237,35,131,237,34,0,237,67,134,0,0,2,196,162,237,34,237,35,130,237,34,3,237,35,237,34,237,35,139,65,135,0,0,1,
+    16,96,237,131,134,237,34,1,237,35,98,97,134,0,0,0,237,131,131,237,35,0,237,34,130,237,35,0,98,97,135,0,0,1,221,2,237,35,130,237,34,4,237,35,237,34,237,34,
+    237,35,155,194,150,0,0,133,0,0,4,82,1,229,35,237,34,237,34,237,35,147,237,34,4,237,35,237,34,237,34,237,35,237,35,131,237,34,3,237,35,237,34,237,34,237,35,136,
+    237,34,6,237,35,237,34,237,35,237,34,237,34,237,35,98,97,167,0,0,3,66,1,229,3,237,34,237,35,131,237,34,129,237,35,0,114,161,133,0,0,2,98,129,237,35,237,35,
+    133,237,34,1,237,67,49,32,135,0,0,0,147,130,130,237,34,0,237,35,131,237,34,0,229,35,134,0,0,0,204,162,130,237,35,5,237,34,237,35,237,34,237,34,237,35,139,66,
+    135,0,0,1,16,96,237,131,134,237,34,1,237,35,98,97,134,0,0,0,237,131,130,237,35,129,237,34,3,237,35,237,34,237,35,98,97,135,0,0,0,221,3,130,237,35,5,237,
+    34,237,35,237,34,237,35,237,35,155,162,150,0,0,133,0,0,8,82,1,229,35,237,34,237,35,237,35,237,34,237,34,237,35,237,34,130,237,35,134,237,34,0,237,35,141,237,34,
+    0,237,35,144,237,34,1,237,35,98,129,167,0,0,1,66,1,237,35,133,237,34,2,237,35,237,34,114,161,133,0,0,1,98,97,237,35,134,237,34,1,237,67,49,64,135,0,0,
+    0,147,130,130,237,34,0,237,35,131,237,34,0,213,3,134,0,0,2,196,162,237,35,237,35,132,237,34,1,237,35,147,98,135,0,0,1,32,192,237,99,134,237,34,1,237,35,98,
+    65,134,0,0,5,237,163,237,35,237,34,237,34,237,35,237,34,130,237,35,0,98,97,135,0,0,0,229,67,132,237,35,129,237,34,1,237,35,155,162,150,0,0,133,0,0,6,82,
+    1,229,35,237,35,237,35,237,34,237,34,237,35,139,237,34,0,237,35,132,237,34,2,237,35,237,34,237,35,133,237,34,2,237,35,237,34,237,35,130,237,34,0,237,35,132,237,34,
+    7,237,35,237,34,237,34,237,35,237,34,237,34,237,35,98,129,167,0,0,1,66,1,237,3,135,237,34,0,114,161,133,0,0,1,90,65,237,35,134,237,34,1,237,35,65,160,135,
+    0,0,0,172,34,135,237,34,0,188,98,134,0,0,2,188,130,237,35,237,35,132,237,34,1,237,35,163,226,135,0,0,2,57,128,237,35,237,35,133,237,34,1,237,35,73,225,134,
+    0,0,5,237,99,237,35,237,34,237,34,237,35,237,34,130,237,35,0,122,225,134,0,0,1,8,64,237,131,133,237,35,2,237,34,237,35,147,130,150,0,0,133,0,0,2,82,1,
+    229,35,237,35,131,237,34,0,237,35,130,237,34,0,237,35,133,237,34,0,237,35,132,237,34,0,237,35,135,237,34,0,237,35,145,237,34,1,237,35,98,129,167,0,0,1,65,225,
+    237,35,134,237,34,1,237,35,114,161,133,0,0,1,65,161,237,35,134,237,34,1,237,35,122,225,134,0,0,2,0,32,229,35,237,35,134,237,34,0,163,194,134,0,0,0,163,194,
+    130,237,35,129,237,34,4,237,35,237,34,237,35,221,35,0,32,134,0,0,1,122,225,237,35,134,237,34,1,237,67,49,32,134,0,0,0,204,194,130,237,35,132,237,34,0,180,34,
+    134,0,0,0,82,33,130,237,35,129,237,34,4,237,35,237,34,237,35,237,35,114,193,150,0,0,133,0,0,2,82,1,229,35,237,34,130,237,35,4,237,34,237,35,237,34,237,34,
+    237,35,131,237,34,2,237,35,237,34,237,35,136,237,34,3,237,35,237,34,237,34,237,35,132,237,34,0,237,35,132,237,34,2,237,35,237,34,237,35,134,237,34,1,237,35,98,129,
+    167,0,0,1,66,1,229,3,133,237,34,2,237,35,237,34,114,161,133,0,0,2,24,160,237,99,237,35,133,237,34,2,237,35,212,226,8,64,133,0,0,1,131,33,237,35,130,237,
+    34,0,237,35,131,237,34,0,114,193,134,0,0,0,122,225,131,237,35,130,237,34,129,237,35,0,114,193,133,0,0,11,32,224,221,3,237,35,237,35,237,34,237,35,237,34,237,34,
+    237,35,237,35,237,131,0,32,134,0,0,1,163,194,237,34,131,237,35,130,237,34,1,237,67,73,193,132,0,0,4,8,96,204,194,237,35,237,34,237,34,131,237,35,2,237,34,237,
+    35,73,225,150,0,0,133,0,0,9,82,1,229,35,237,35,237,34,237,34,237,35,237,35,237,34,237,34,237,35,131,237,34,0,237,35,132,237,34,0,237,35,153,237,34,0,237,35,
+    131,237,34,1,237,35,98,129,167,0,0,1,66,1,229,3,135,237,34,0,114,161,134,0,0,0,213,2,134,237,34,129,237,35,1,180,66,16,128,130,0,0,3,0,32,122,225,237,
+    67,237,35,132,237,34,129,237,35,1,237,99,41,0,134,0,0,1,57,96,237,67,133,237,35,129,237,34,2,237,67,114,193,8,32,130,0,0,2,82,1,221,35,237,35,134,237,34,
+    1,237,35,172,2,135,0,0,2,98,97,237,34,237,35,132,237,34,129,237,35,9,229,35,131,1,41,32,0,0,16,128,90,33,212,227,237,35,237,35,237,34,131,237,35,129,237,34,
+    1,237,131,16,96,150,0,0,133,0,0,2,82,1,229,35,237,34,130,237,35,133,237,34,2,237,35,237,34,237,35,164,237,34,1,237,35,98,97,167,0,0,1,66,1,229,2,135,
+    237,34,0,114,161,134,0,0,1,155,162,237,35,136,237,34,15,229,67,172,2,139,65,155,162,221,2,237,35,237,34,237,34,237,35,237,34,237,34,237,35,237,34,237,35,237,35,212,
+    194,136,0,0,7,221,35,237,34,237,35,237,34,237,35,237,35,237,34,237,34,130,237,35,4,237,99,188,66,180,34,213,2,237,67,135,237,34,2,237,35,237,67,82,33,135,0,0,
+    4,16,128,237,131,237,35,237,35,237,34,134,237,35,8,237,99,237,163,237,131,237,34,237,35,237,35,237,34,237,35,237,35,131,237,34,1,237,35,172,34,151,0,0,133,0,0,1,
+    82,1,229,3,130,237,35,10,237,34,237,35,237,35,237,34,237,35,237,34,237,35,237,34,237,35,237,34,237,35,131,237,34,0,237,35,136,237,34,0,237,35,138,237,34,0,237,35,
+    136,237,34,1,237,35,98,97,167,0,0,1,65,225,229,2,134,237,34,1,237,35,114,161,134,0,0,1,73,193,237,67,135,237,34,132,237,35,134,237,34,131,237,35,0,122,225,136,
+    0,0,0,139,98,131,237,35,133,237,34,131,237,35,129,237,34,0,237,35,133,237,34,1,237,35,212,226,137,0,0,0,147,162,131,237,35,4,237,34,237,35,237,35,237,34,237,35,
+    132,237,34,129,237,35,131,237,34,130,237,35,1,237,67,65,161,151,0,0,133,0,0,1,82,1,229,35,132,237,35,130,237,34,2,237,35,237,34,237,35,138,237,34,0,237,35,135,
+    237,34,0,237,35,143,237,34,3,237,35,237,34,237,35,98,97,167,0,0,1,74,1,229,3,135,237,34,0,114,161,135,0,0,0,196,130,147,237,34,129,237,35,2,237,34,221,35,
+    16,96,136,0,0,5,24,192,229,35,237,35,237,34,237,35,237,35,134,237,34,130,237,35,135,237,34,1,237,67,90,65,137,0,0,1,16,96,221,35,132,237,35,1,237,34,237,35,
+    133,237,34,1,237,35,237,34,131,237,35,3,237,34,237,35,237,35,180,34,152,0,0,133,0,0,1,82,1,229,35,133,237,35,131,237,34,129,237,35,132,237,34,0,237,35,132,237,
+    34,3,237,35,237,34,237,34,237,35,132,237,34,6,237,35,237,34,237,34,237,35,237,34,237,34,237,35,132,237,34,7,237,35,237,34,237,34,237,35,237,34,237,34,237,35,98,129,
+    167,0,0,1,65,225,229,34,135,237,34,0,114,161,135,0,0,2,49,64,229,67,237,35,130,237,34,0,237,35,141,237,34,129,237,35,1,237,67,90,33,138,0,0,2,82,1,237,
+    67,237,35,130,237,34,0,237,35,130,237,34,129,237,35,129,237,34,0,237,35,131,237,34,131,237,35,0,172,34,139,0,0,1,73,225,237,67,130,237,35,13,237,34,237,35,237,34,
+    237,35,237,34,237,35,237,34,237,35,237,34,237,35,237,34,237,35,237,35,237,34,130,237,35,1,229,35,32,224,152,0,0,133,0,0,5,82,1,229,35,237,35,237,34,237,35,237,
+    34,130,237,35,0,237,34,130,237,35,1,237,34,237,35,131,237,34,6,237,35,237,34,237,34,237,35,237,34,237,35,237,35,132,237,34,3,237,35,237,34,237,35,237,35,131,237,34,
+    2,237,35,237,34,237,35,131,237,34,0,237,35,131,237,34,129,237,35,0,98,129,167,0,0,2,65,225,229,34,237,35,134,237,34,0,114,161,136,0,0,1,65,193,229,35,140,237,
+    34,0,237,35,130,237,34,129,237,35,1,237,67,139,65,140,0,0,1,114,193,237,67,135,237,34,0,237,35,132,237,34,6,237,35,237,34,237,34,237,35,237,35,212,194,16,128,140,
+    0,0,1,123,1,237,67,132,237,35,129,237,34,2,237,35,237,34,237,34,130,237,35,6,237,34,237,35,237,35,237,34,237,35,237,67,73,225,153,0,0,133,0,0,7,82,1,229,
+    35,237,34,237,34,237,35,237,34,237,34,237,35,136,237,34,129,237,35,131,237,34,129,237,35,134,237,34,129,237,35,137,237,34,129,237,35,132,237,34,129,237,35,0,98,97,167,0,
+    0,1,74,1,229,2,135,237,34,0,114,161,137,0,0,3,65,193,237,99,237,35,237,35,140,237,34,129,237,35,1,237,67,147,130,142,0,0,4,139,66,237,67,237,35,237,34,237,
+    35,133,237,34,130,237,35,130,237,34,3,237,35,237,67,213,3,32,224,142,0,0,0,147,130,130,237,67,129,237,35,129,237,34,0,237,35,130,237,34,133,237,35,1,237,99,98,97,
+    154,0,0,133,0,0,1,82,1,229,35,130,237,34,130,237,35,132,237,34,0,237,35,139,237,34,0,237,35,135,237,34,0,237,35,138,237,34,0,237,35,131,237,34,1,237,35,98,
+    97,167,0,0,6,74,1,229,3,237,35,237,34,237,34,237,35,237,35,130,237,34,0,114,161,138,0,0,2,49,64,196,130,237,67,130,237,35,1,237,34,237,35,133,237,34,130,237,
+    35,1,204,194,90,33,144,0,0,1,98,97,229,35,131,237,35,1,237,34,237,35,130,237,34,132,237,35,2,229,67,147,98,24,160,144,0,0,3,106,161,229,67,237,35,237,67,130,
+    237,35,0,237,34,134,237,35,2,237,67,204,162,73,192,155,0,0,133,0,0,2,82,1,229,35,237,35,130,237,34,0,237,35,130,237,34,129,237,35,1,237,34,237,35,132,237,34,
+    129,237,35,131,237,34,3,237,35,237,34,237,35,237,35,132,237,34,7,237,35,237,34,237,35,237,35,237,34,237,35,237,34,237,35,132,237,34,6,237,35,237,34,237,35,237,34,237,
+    34,237,35,98,97,167,0,0,1,41,64,139,130,130,147,130,5,147,129,147,130,139,130,147,130,147,98,65,193,140,0,0,3,73,225,155,194,221,3,237,99,134,237,35,3,237,67,237,
+    99,172,2,90,33,147,0,0,15,16,96,106,129,180,34,237,99,237,99,237,34,229,35,237,34,229,35,237,34,237,67,237,99,229,67,172,2,106,129,16,96,147,0,0,4,8,32,98,
+    97,180,66,237,131,237,67,133,237,35,3,237,67,229,35,163,194,65,161,157,0,0,133,0,0,1,82,1,229,35,132,237,34,2,237,35,237,34,237,35,131,237,34,0,237,35,132,237,
+    34,0,237,35,132,237,34,129,237,35,134,237,34,129,237,35,131,237,34,0,237,35,132,237,34,129,237,35,130,237,34,1,237,35,98,129,194,0,0,8,32,192,74,1,98,129,114,193,
+    122,225,114,193,98,97,81,225,41,32,154,0,0,7,41,0,57,128,65,161,65,193,65,193,65,161,49,64,24,128,154,0,0,8,8,32,49,64,90,33,98,97,98,97,98,129,98,97,
+    73,225,41,0,160,0,0,133,0,0,10,82,1,229,35,237,34,237,35,237,35,237,34,237,35,237,34,237,35,237,34,237,35,130,237,34,0,237,35,131,237,34,0,237,35,131,237,34,
+    131,237,35,132,237,34,131,237,35,130,237,34,129,237,35,131,237,34,130,237,35,130,237,34,1,237,35,98,97,255,0,0,179,0,0,133,0,0,1,82,1,229,35,133,237,35,131,237,
+    34,0,237,35,131,237,34,9,237,35,237,34,237,34,237,35,237,34,237,34,237,35,237,34,237,34,237,35,132,237,34,3,237,35,237,34,237,34,237,35,135,237,34,0,237,35,134,237,
+    34,1,237,35,98,129,255,0,0,179,0,0,133,0,0,12,82,1,229,35,237,34,237,34,237,35,237,34,237,35,237,34,237,35,237,35,237,34,237,35,237,35,140,237,34,0,237,35,
+    135,237,34,0,237,35,143,237,34,1,237,35,98,129,255,0,0,179,0,0,133,0,0,1,82,1,229,35,131,237,34,130,237,35,1,237,34,237,35,130,237,34,0,237,35,131,237,34,
+    129,237,35,129,237,34,3,237,35,237,34,237,35,237,35,130,237,34,5,237,35,237,34,237,35,237,34,237,35,237,35,131,237,34,129,237,35,131,237,34,129,237,35,131,237,34,1,237,
+    35,98,97,255,0,0,179,0,0,133,0,0,2,82,1,229,35,237,35,132,237,34,5,237,35,237,34,237,34,237,35,237,34,237,35,131,237,34,7,237,35,237,34,237,35,237,34,237,
+    35,237,34,237,35,237,35,132,237,34,3,237,35,237,34,237,35,237,35,136,237,34,3,237,35,237,34,237,34,237,35,131,237,34,1,237,35,106,129,255,0,0,179,0,0,133,0,0,
+    7,82,1,229,35,237,35,237,34,237,35,237,34,237,35,237,35,137,237,34,0,237,35,131,237,34,129,237,35,131,237,34,4,237,35,237,34,237,34,237,35,237,35,131,237,34,129,237,
+    35,132,237,34,0,237,35,132,237,34,129,237,35,0,163,226,255,0,0,179,0,0,133,0,0,2,82,1,229,3,237,35,130,237,34,1,237,35,237,34,130,237,35,129,237,34,129,237,
+    35,5,237,34,237,35,237,34,237,35,237,35,237,34,130,237,35,0,237,34,130,237,35,129,237,34,130,237,35,0,237,34,130,237,35,129,237,34,130,237,35,2,237,34,237,35,237,34,
+    131,237,35,131,237,34,1,229,67,8,64,255,0,0,178,0,0,133,0,0,7,82,1,229,3,237,35,237,35,237,34,237,34,237,35,237,35,130,237,34,129,237,35,0,237,34,131,237,
+    35,129,237,34,132,237,35,129,237,34,2,237,35,237,34,237,34,131,237,35,129,237,34,4,237,35,237,34,237,34,237,35,237,34,132,237,35,129,237,34,129,237,35,131,237,34,0,131,
+    34,255,0,0,178,0,0,133,0,0,0,82,1,134,237,35,129,237,34,130,237,35,129,237,34,140,237,35,129,237,34,134,237,35,129,237,34,138,237,35,129,237,34,129,237,35,1,237,
+    67,57,64,255,0,0,177,0,0,133,0,0,4,74,1,229,35,237,35,237,34,237,34,130,237,35,2,237,34,237,35,237,34,131,237,35,130,237,34,129,237,35,129,237,34,131,237,35,
+    0,237,34,130,237,35,0,237,34,131,237,35,0,237,34,132,237,35,131,237,34,129,237,35,0,237,34,130,237,35,0,237,34,130,237,35,1,212,226,32,192,255,0,0,176,0,0,133,
+    0,0,0,65,161,131,237,35,0,237,34,139,237,35,0,237,34,159,237,35,0,237,34,131,237,35,2,229,35,106,161,8,64,255,0,0,174,0,0,133,0,0,1,41,0,237,67,175,
+    237,35,0,237,34,134,237,35,12,237,99,180,66,155,162,139,129,139,97,139,97,139,98,139,97,139,129,24,128,0,0,0,0,245,227,147,237,163,3,180,98,0,0,0,0,221,99,135,
+    237,163,0,237,131,138,237,163,3,245,227,0,0,0,0,147,130,131,237,163,0,237,131,131,237,163,0,237,131,138,237,163,3,180,98,0,0,0,0,229,131,147,237,163,3,237,195,40,
+    224,0,0,114,225,143,237,163,0,237,131,131,237,163,3,82,33,0,0,49,64,245,163,138,237,163,0,237,131,135,237,163,3,205,3,0,0,0,0,147,130,130,237,163,2,229,67,163,
+    226,49,64,138,0,0,133,0,0,1,8,32,237,131,132,237,35,0,237,34,135,237,35,129,237,34,131,237,35,130,237,34,129,237,35,129,237,34,129,237,35,129,237,34,130,237,35,129,
+    237,34,132,237,35,129,237,34,130,237,35,130,237,34,137,237,35,132,237,67,4,237,99,32,192,0,0,0,0,245,131,146,237,34,4,237,35,172,2,0,0,0,0,213,2,147,237,34,
+    4,237,131,0,0,0,0,147,66,237,35,141,237,34,0,237,35,131,237,34,4,237,35,180,2,0,0,0,0,221,35,132,237,34,0,237,35,141,237,34,4,237,99,40,224,0,0,106,
+    161,237,35,147,237,34,3,82,1,0,0,49,64,237,67,132,237,34,0,237,35,138,237,34,129,237,35,6,237,34,204,162,0,0,0,0,147,66,237,35,237,34,130,237,35,1,237,67,
+    131,33,137,0,0,134,0,0,0,196,130,132,237,35,0,237,34,130,237,35,5,237,34,237,35,237,34,237,35,237,35,237,34,136,237,35,0,237,34,135,237,35,0,237,34,134,237,35,
+    0,237,34,130,237,35,0,237,34,137,237,35,2,237,34,237,35,237,35,132,237,34,4,237,99,32,192,0,0,0,0,245,131,140,237,34,0,237,35,133,237,34,6,172,2,0,0,0,
+    0,221,2,237,34,237,34,237,35,135,237,34,129,237,35,134,237,34,6,237,131,0,0,0,0,147,66,237,34,237,35,237,35,138,237,34,129,237,35,8,237,34,237,35,237,34,237,34,
+    237,35,180,2,0,0,0,0,221,35,134,237,34,0,237,35,139,237,34,4,237,99,32,192,0,0,106,161,237,35,147,237,34,3,82,1,0,0,49,64,237,67,134,237,34,0,237,35,
+    134,237,34,0,237,35,131,237,34,3,204,162,0,0,0,0,147,65,130,237,35,5,237,34,237,35,237,34,237,67,172,34,0,32,135,0,0,134,0,0,0,123,1,134,237,35,0,237,
+    34,173,237,35,14,237,34,237,35,237,35,237,34,237,34,237,35,237,34,237,34,237,35,237,34,237,99,32,192,0,0,0,0,245,131,138,237,34,5,237,35,237,34,237,34,229,2,179,
+    226,212,194,130,237,34,20,172,2,0,0,0,0,213,2,237,34,237,35,237,34,237,34,220,226,188,34,188,34,212,194,237,34,229,2,180,2,212,162,237,34,237,34,196,98,180,2,229,
+    34,130,237,34,29,237,131,0,0,0,0,147,66,237,35,237,34,237,34,204,130,229,2,237,34,237,34,204,130,180,2,229,34,237,34,229,34,180,2,204,162,237,34,237,35,204,130,180,
+    2,229,34,237,34,237,35,172,2,0,0,0,0,229,35,237,35,138,237,34,0,229,2,130,237,34,11,229,2,229,34,237,34,237,34,237,131,32,224,0,0,106,161,237,35,237,34,229,
+    34,229,2,130,237,34,1,229,2,229,34,130,237,34,0,229,2,130,237,34,1,229,2,229,34,130,237,34,27,82,1,0,0,49,64,237,67,237,35,220,226,179,226,212,162,237,34,220,
+    226,188,34,188,34,212,162,237,35,229,2,180,2,204,98,237,34,237,34,204,130,179,226,229,2,237,35,237,34,204,162,0,0,0,0,147,65,135,237,35,0,123,1,135,0,0,134,0,
+    0,1,32,192,237,67,132,237,35,0,237,34,146,237,35,0,237,34,135,237,35,0,237,34,138,237,35,0,237,34,141,237,35,129,237,34,6,237,99,32,192,0,0,0,0,245,131,237,
+    34,237,35,134,237,34,129,237,35,129,237,34,10,229,34,65,128,147,65,57,64,212,194,237,34,237,35,172,2,0,0,0,0,213,2,131,237,34,12,130,225,73,192,130,225,188,34,220,
+    226,49,32,147,33,65,96,196,98,139,1,98,33,131,1,89,225,130,237,34,101,237,131,0,0,0,0,147,66,237,35,237,35,130,225,32,192,188,34,237,35,171,226,89,225,130,225,90,
+    1,237,34,81,193,147,33,65,96,196,66,171,194,81,193,139,1,81,225,237,34,237,35,172,2,0,0,0,0,221,35,237,35,220,226,106,65,57,64,237,34,237,35,57,64,81,225,89,
+    225,237,34,196,98,65,128,90,1,114,129,237,34,90,1,98,33,57,96,204,130,237,34,237,99,40,192,0,0,106,161,237,35,171,194,81,225,65,96,147,33,237,34,98,33,90,1,57,
+    96,196,98,188,34,65,128,98,33,98,33,237,34,98,33,98,65,65,96,188,34,237,34,237,34,82,1,0,0,49,64,237,67,237,35,90,1,139,1,49,0,220,194,147,33,65,128,130,
+    225,171,194,237,35,65,128,147,65,81,193,171,194,171,194,90,1,147,33,57,96,237,34,237,34,204,162,0,0,0,0,147,65,133,237,35,3,237,67,237,35,229,66,16,96,134,0,0,
+    135,0,0,12,171,226,237,35,237,35,237,34,237,35,237,35,237,34,237,35,237,35,237,34,237,35,237,35,237,34,142,237,35,0,237,34,141,237,35,0,237,34,132,237,35,2,237,34,
+    237,35,237,35,131,237,34,12,237,35,237,34,237,34,237,35,237,34,237,34,237,35,237,34,237,99,32,192,0,0,0,0,237,131,140,237,34,10,179,226,106,97,237,34,139,33,155,97,
+    237,34,237,35,172,2,0,0,0,0,213,3,131,237,34,12,131,1,139,33,237,34,237,34,163,162,106,97,237,34,163,162,130,225,65,96,237,34,237,34,57,64,130,237,34,102,237,131,
+    0,0,0,0,147,66,237,35,237,35,220,194,98,65,188,2,237,34,90,1,204,162,237,34,57,64,212,162,81,225,237,34,163,162,122,193,73,128,196,66,237,34,57,96,237,34,237,35,
+    172,2,0,0,0,0,221,35,237,34,204,130,204,130,57,64,237,34,237,34,57,64,237,35,237,34,237,34,89,225,180,2,237,34,57,64,196,66,73,128,237,34,171,194,122,161,237,34,
+    237,99,40,192,0,0,106,161,237,35,237,34,237,34,212,194,73,160,204,130,57,64,237,34,179,226,114,129,90,1,204,98,237,34,65,128,204,130,81,225,237,34,188,66,98,65,237,34,
+    237,34,82,1,0,0,49,64,237,67,237,35,237,34,237,34,98,65,196,66,147,33,122,193,237,34,237,34,204,98,98,33,237,35,196,98,90,1,90,1,212,162,237,34,89,225,204,130,
+    237,35,204,162,0,0,0,0,147,66,237,35,131,237,34,129,237,35,2,237,34,237,35,82,1,134,0,0,135,0,0,1,41,32,237,67,132,237,35,2,237,34,237,35,237,34,143,237,
+    35,0,237,34,135,237,35,0,237,34,138,237,35,0,237,34,131,237,35,130,237,34,129,237,35,134,237,34,4,237,99,32,192,0,0,0,0,237,131,140,237,34,11,147,65,130,193,237,
+    34,163,130,139,1,237,34,237,35,172,2,0,0,0,0,213,2,237,35,130,237,34,44,163,162,81,225,73,160,163,162,139,33,130,225,237,34,188,2,114,129,57,64,237,34,237,34,73,
+    128,229,2,237,34,237,34,237,131,0,0,0,0,147,66,237,35,237,35,237,34,106,65,188,34,237,34,65,128,229,2,237,34,65,96,180,2,98,65,237,34,188,34,106,97,40,224,212,
+    162,237,34,73,160,220,226,237,35,180,2,0,0,0,0,221,35,130,237,34,69,57,64,237,34,237,34,65,128,90,1,122,161,237,34,49,32,212,162,237,34,73,160,147,65,106,97,237,
+    34,204,98,98,33,237,34,237,99,40,192,0,0,106,161,237,35,237,34,237,34,171,194,122,161,171,194,98,33,237,34,212,162,81,225,57,96,237,34,237,34,98,33,147,65,114,129,237,
+    34,220,226,73,160,237,34,237,34,82,1,0,0,49,64,237,67,237,34,237,35,229,2,65,96,229,2,171,194,81,225,81,193,139,33,179,226,114,129,237,34,220,226,73,160,65,128,229,
+    2,237,34,106,97,188,34,237,35,204,162,0,0,0,0,147,66,134,237,35,2,237,34,237,35,98,97,134,0,0,136,0,0,1,114,193,237,67,161,237,35,0,237,34,141,237,35,1,
+    237,34,237,35,134,237,34,129,237,35,5,237,34,237,99,32,192,0,0,0,0,237,131,133,237,34,3,237,35,237,34,237,35,237,35,130,237,34,59,163,130,114,161,237,34,147,65,147,
+    65,237,34,237,35,172,2,0,0,0,0,213,2,237,35,237,34,237,34,237,35,237,34,237,34,220,226,57,64,147,65,122,161,237,35,171,194,122,193,57,64,237,35,237,34,65,96,237,
+    34,237,34,237,35,237,131,0,0,0,0,147,66,237,35,237,35,237,34,106,65,188,34,237,34,73,160,220,194,237,34,65,96,196,66,90,1,237,34,179,226,122,161,49,32,204,130,237,
+    35,65,128,229,34,237,35,180,2,0,0,0,0,229,35,130,237,34,0,49,32,130,237,34,65,237,35,98,65,171,194,49,32,204,130,237,34,73,160,155,97,106,65,237,35,196,98,98,
+    65,237,34,237,99,40,192,0,0,106,161,237,35,237,34,212,162,73,160,229,2,171,226,90,1,237,34,204,130,90,1,65,96,229,34,237,34,90,1,155,97,106,97,237,34,220,194,81,
+    193,237,35,237,34,82,1,0,0,49,64,237,67,237,35,229,34,90,1,188,34,237,34,237,34,237,35,237,34,49,0,188,34,106,97,237,35,212,162,90,1,73,160,220,226,237,35,98,
+    33,204,130,237,35,204,162,0,0,0,0,147,65,136,237,35,0,82,1,134,0,0,137,0,0,1,131,1,237,67,147,237,35,0,237,34,135,237,35,0,237,34,149,237,35,0,237,34,
+    133,237,35,5,237,34,237,99,32,192,0,0,0,0,237,131,132,237,34,3,237,35,237,34,237,34,237,35,131,237,34,10,220,194,57,64,196,98,73,160,212,162,237,34,237,34,172,2,
+    0,0,0,0,213,2,131,237,34,12,171,194,196,98,147,65,98,33,204,130,41,0,196,66,89,225,188,66,98,33,147,65,180,2,73,192,130,237,34,101,237,131,0,0,0,0,147,66,
+    237,34,237,34,204,98,81,225,147,65,220,194,139,1,130,193,179,226,81,225,229,34,57,64,196,66,90,1,188,34,130,193,114,129,180,2,73,160,237,34,237,35,172,2,0,0,0,0,
+    229,35,237,34,237,34,237,35,49,32,237,34,229,35,212,162,237,34,90,1,180,2,106,65,147,65,220,226,65,96,204,130,40,224,229,2,131,1,155,97,237,34,237,131,40,224,0,0,
+    106,161,237,35,212,162,73,128,212,194,237,34,212,162,32,192,229,2,139,33,147,33,106,65,163,130,229,2,57,96,220,194,57,96,229,34,155,97,130,225,237,34,237,34,82,1,0,0,
+    49,64,237,67,229,2,65,96,114,161,188,34,212,194,180,2,196,98,171,194,73,128,229,2,57,64,196,98,114,129,155,97,130,225,130,225,196,66,65,96,237,34,237,34,204,162,0,0,
+    0,0,147,65,130,237,35,6,237,34,237,35,237,35,237,34,237,35,229,67,8,64,134,0,0,138,0,0,5,90,65,229,67,237,35,237,34,237,35,237,34,134,237,35,0,237,34,132,
+    237,35,0,237,34,135,237,35,0,237,34,150,237,35,0,237,34,133,237,35,11,237,34,237,35,237,99,32,192,0,0,0,0,237,131,237,34,237,34,237,35,237,35,237,34,130,237,35,
+    15,237,34,237,35,237,34,237,35,237,34,237,34,188,66,122,193,188,34,237,34,237,34,237,35,172,2,0,0,0,0,213,2,131,237,34,12,188,34,130,225,147,65,229,2,237,35,188,
+    66,130,193,179,226,237,34,229,2,139,33,131,1,220,194,130,237,34,78,237,131,0,0,0,0,147,66,237,34,237,34,163,130,139,1,139,1,196,98,229,34,147,65,139,1,220,226,237,
+    34,204,98,130,193,179,226,237,35,237,34,155,97,130,225,220,194,237,34,237,35,172,2,0,0,0,0,229,35,237,34,204,130,90,1,90,1,114,129,229,2,106,97,90,1,147,65,237,
+    35,229,2,106,97,98,33,196,66,237,35,163,130,90,1,122,193,237,34,237,34,237,99,40,192,0,0,106,161,237,35,163,130,90,1,90,1,106,65,237,35,171,194,90,1,114,161,229,
+    34,220,194,106,65,90,33,188,2,237,34,163,162,90,1,114,129,229,2,237,35,237,34,82,1,0,0,49,64,237,67,229,2,130,139,1,19,196,66,188,66,130,193,139,1,220,226,237,
+    35,196,66,122,193,163,130,237,34,229,34,147,65,130,225,212,162,237,34,237,34,204,162,0,0,0,0,147,65,133,237,35,2,237,34,237,35,123,1,135,0,0,139,0,0,1,57,128,
+    221,35,185,237,35,11,237,99,32,192,0,0,0,0,245,131,237,34,237,35,237,34,237,35,237,34,237,34,237,35,132,237,34,0,237,35,132,237,34,129,237,35,4,172,2,0,0,0,
+    0,213,3,237,35,132,237,34,0,237,35,131,237,34,3,237,35,237,34,237,35,237,35,132,237,34,3,237,131,0,0,0,0,147,66,130,237,34,130,237,35,133,237,34,133,237,35,6,
+    237,34,237,35,237,35,172,2,0,0,0,0,229,35,130,237,34,129,237,35,129,237,34,129,237,35,2,237,34,237,35,237,34,132,237,35,6,237,34,237,35,237,35,237,99,40,192,0,
+    0,106,161,137,237,35,3,237,34,237,35,237,35,237,34,130,237,35,129,237,34,129,237,35,5,82,1,0,0,49,64,237,67,237,35,237,35,130,237,34,132,237,35,0,237,34,132,237,
+    35,129,237,34,129,237,35,3,204,162,0,0,0,0,147,66,134,237,35,1,204,195,8,32,135,0,0,140,0,0,2,24,128,147,130,229,99,183,237,35,4,237,99,32,192,0,0,0,
+    0,245,99,140,237,35,0,237,34,133,237,35,5,172,2,0,0,0,0,213,2,237,35,237,34,145,237,35,3,237,131,0,0,0,0,147,66,148,237,35,3,172,2,0,0,0,0,229,
+    35,147,237,35,5,237,99,40,224,0,0,106,161,237,35,237,34,140,237,35,0,237,34,132,237,35,3,82,1,0,0,49,64,237,67,147,237,35,3,204,162,0,0,0,0,147,66,133,
+    237,35,1,196,130,16,128,136,0,0,142,0,0,3,8,64,90,65,163,194,212,227,140,237,131,131,237,99,132,237,131,130,237,99,137,237,131,131,237,99,0,237,131,131,237,99,131,237,
+    131,0,237,99,131,237,131,4,237,163,32,224,0,0,0,0,245,163,147,237,131,3,180,66,0,0,0,0,221,99,147,237,131,3,237,195,0,0,0,0,147,130,148,237,131,3,172,66,
+    0,0,0,0,229,99,147,237,131,3,237,195,40,224,0,0,106,193,148,237,131,2,82,1,0,0,49,64,148,237,131,3,204,227,0,0,0,0,147,130,131,237,131,2,204,194,114,193,
+    0,32,137,0,0,147,0,0,0,24,128,131,24,160,0,24,128,132,24,160,4,24,128,24,160,24,160,32,160,32,160,131,24,160,6,24,128,24,160,24,160,32,160,32,160,24,160,24,
+    128,132,24,160,2,24,128,24,160,24,160,136,32,160,131,24,160,129,32,160,130,24,160,130,0,0,0,8,32,130,0,32,132,0,0,129,0,32,135,0,0,130,0,32,129,0,0,0,
+    0,32,132,0,0,0,0,32,141,0,0,0,8,32,175,0,0,0,0,32,166,0,0,0,0,32,133,0,0,2,8,32,0,32,0,32,130,0,0,130,8,32,141,0,0,255,0,0,
+    239,0,0,255,0,0,239,0,0,255,0,0,239,0,0,145,0,0,1,8,32,40,161,180,48,225,133,0,0,0,8,64,169,40,224,1,32,192,16,96,143,0,0,2,24,160,40,224,
+    49,64,133,57,64,129,57,96,0,57,64,130,57,96,1,57,64,24,160,210,0,0,142,0,0,4,73,34,138,68,195,38,227,135,227,135,179,219,103,0,227,135,133,0,0,0,90,1,
+    170,237,35,2,229,3,171,194,49,0,138,0,0,4,24,128,147,65,229,2,237,66,237,66,141,237,34,2,237,66,204,129,90,0,140,0,0,10,16,64,98,65,171,194,196,98,212,162,
+    212,194,221,3,213,3,213,3,212,194,212,227,138,213,3,0,221,3,134,213,3,1,221,3,212,227,130,213,3,1,212,194,212,227,138,213,3,7,221,3,213,3,212,227,212,162,188,34,
+    147,66,81,225,8,32,139,0,0,140,0,0,1,81,66,203,38,184,219,103,0,227,135,133,0,0,0,89,225,173,237,35,0,98,33,136,0,0,1,49,32,220,226,147,237,35,1,237,
+    34,155,97,137,0,0,2,0,32,114,161,229,3,181,237,35,1,220,227,98,33,138,0,0,139,0,0,0,138,68,186,219,103,0,227,135,133,0,0,0,90,1,174,237,35,0,49,0,
+    134,0,0,1,16,64,212,226,150,237,35,0,131,32,135,0,0,1,16,96,188,66,185,237,35,0,131,33,137,0,0,138,0,0,0,154,101,187,219,103,0,227,135,133,0,0,0,90,
+    1,174,237,35,0,163,130,134,0,0,0,155,96,151,237,35,1,237,66,41,0,133,0,0,1,8,32,188,34,187,237,35,0,131,1,136,0,0,136,0,0,1,8,32,178,229,188,219,
+    103,0,227,135,133,0,0,0,89,225,174,237,35,1,229,3,8,64,132,0,0,1,24,128,237,66,152,237,35,0,147,65,133,0,0,0,139,33,189,237,35,0,90,33,135,0,0,136,
+    0,0,0,162,133,189,219,103,0,227,135,133,0,0,0,89,225,175,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,196,161,132,0,0,0,41,0,151,237,35,4,229,3,180,
+    2,147,34,114,129,106,97,130,106,65,4,106,97,114,97,114,129,114,161,188,2,153,237,35,1,220,226,8,32,134,0,0,135,0,0,0,89,98,190,219,103,0,227,135,133,0,0,0,
+    89,225,175,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,204,225,132,0,0,0,147,65,149,237,35,2,204,98,90,1,8,64,131,0,0,2,8,32,98,33,32,160,132,0,
+    0,1,32,192,139,33,152,237,35,0,81,225,134,0,0,135,0,0,0,203,38,190,219,103,0,227,103,133,0,0,0,89,225,175,237,35,0,32,192,132,0,0,0,57,128,153,237,35,
+    0,204,225,132,0,0,0,204,162,148,237,35,0,122,193,133,0,0,4,16,96,188,34,237,35,220,226,73,161,133,0,0,1,57,96,220,226,150,237,35,0,147,66,134,0,0,134,0,
+    0,0,73,34,191,219,103,0,227,135,133,0,0,0,89,225,175,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,8,32,237,67,147,237,35,0,98,33,
+    133,0,0,1,32,192,204,98,131,237,35,0,98,33,133,0,0,1,24,160,204,98,149,237,35,0,180,34,134,0,0,134,0,0,0,154,133,191,219,103,0,227,135,133,0,0,0,89,
+    225,149,237,35,4,163,130,81,192,81,192,81,193,98,65,148,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,99,146,237,35,0,98,33,133,
+    0,0,1,41,0,220,194,133,237,35,0,90,1,133,0,0,1,16,96,171,194,148,237,35,0,196,98,134,0,0,134,0,0,192,219,103,0,227,135,133,0,0,0,89,225,149,237,35,
+    0,122,193,130,0,0,0,32,192,148,237,35,0,32,192,132,0,0,0,57,128,153,237,35,0,204,225,131,0,0,1,16,96,237,67,145,237,35,0,147,66,133,0,0,1,8,64,204,
+    130,135,237,35,0,65,96,133,0,0,1,8,32,179,226,147,237,35,0,204,162,134,0,0,133,0,0,1,40,161,219,135,191,219,103,0,227,135,133,0,0,0,89,225,149,237,35,0,
+    122,193,130,0,0,0,32,192,148,237,35,0,32,192,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,144,237,35,1,196,66,8,32,133,0,0,0,155,66,
+    136,237,35,1,220,194,24,128,133,0,0,1,24,128,220,194,146,237,35,0,212,162,134,0,0,133,0,0,1,65,34,219,102,191,219,103,0,227,135,133,0,0,0,89,225,149,237,35,
+    0,130,193,130,0,0,0,32,160,148,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,204,225,131,0,0,1,16,96,237,67,144,237,35,0,49,0,133,0,0,0,40,224,138,
+    237,35,0,155,98,134,0,0,0,98,65,146,237,35,0,212,162,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,149,237,35,0,122,193,130,0,
+    0,0,32,192,148,237,35,0,32,192,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,143,237,35,0,163,162,134,0,0,0,147,33,139,237,35,0,57,64,
+    133,0,0,1,8,32,212,194,145,237,35,0,212,162,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,103,133,0,0,0,89,225,149,237,35,0,122,193,130,0,0,0,32,
+    160,148,237,35,0,32,160,132,0,0,0,65,128,153,237,35,0,205,1,131,0,0,1,24,96,237,67,143,237,35,0,57,64,133,0,0,1,16,96,229,3,139,237,35,0,196,66,134,
+    0,0,0,106,97,145,237,35,0,212,162,134,0,0,133,0,0,1,89,99,219,102,191,219,103,0,227,135,133,0,0,0,89,225,149,237,35,0,122,193,130,0,0,0,32,192,148,237,
+    35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,24,96,237,67,142,237,35,0,196,66,134,0,0,0,98,33,141,237,35,0,57,64,133,0,0,1,8,64,
+    229,3,144,237,35,0,204,162,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,144,237,35,1,155,97,139,1,130,237,35,0,122,193,130,0,0,
+    0,32,192,130,237,35,2,180,2,106,65,228,226,142,237,35,0,32,192,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,142,237,35,0,130,225,134,0,0,
+    0,163,130,141,237,35,0,130,225,134,0,0,0,163,162,144,237,35,0,204,162,134,0,0,133,0,0,1,89,99,219,102,191,219,103,0,227,135,133,0,0,0,89,225,143,237,35,2,
+    106,65,0,0,57,64,130,237,35,0,122,193,130,0,0,0,32,192,130,237,35,3,98,65,0,0,49,0,220,226,141,237,35,0,32,192,132,0,0,0,57,128,153,237,35,0,204,225,
+    131,0,0,1,16,96,237,67,142,237,35,0,65,128,134,0,0,0,220,194,141,237,35,0,179,226,134,0,0,0,106,65,144,237,35,0,204,130,134,0,0,133,0,0,1,89,98,219,
+    102,191,219,103,0,227,135,133,0,0,0,89,225,141,237,35,8,228,226,73,160,0,0,0,0,8,32,220,226,237,35,237,35,122,193,130,0,0,8,32,192,237,35,237,35,229,3,24,
+    128,0,0,0,0,32,192,212,162,140,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,142,237,35,0,24,160,133,0,0,0,24,128,142,
+    237,35,0,204,130,134,0,0,0,57,64,144,237,35,0,212,162,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,141,237,35,0,65,96,130,0,
+    0,4,90,1,228,226,237,35,237,35,122,193,130,0,0,9,32,192,237,35,237,35,229,3,114,129,8,32,0,0,0,0,57,64,228,226,139,237,35,0,32,192,132,0,0,0,57,128,
+    153,237,35,0,205,1,131,0,0,1,16,96,237,99,141,237,35,0,220,194,134,0,0,0,73,161,142,237,35,0,228,226,134,0,0,0,8,32,144,237,35,0,212,162,134,0,0,133,
+    0,0,1,89,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,140,237,35,0,114,129,130,0,0,0,139,33,131,237,35,0,122,193,130,0,0,0,32,192,131,237,35,5,180,
+    2,8,64,0,0,0,0,65,96,229,3,138,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,141,237,35,0,204,98,134,0,0,0,90,
+    1,137,237,35,5,220,194,106,97,106,97,114,97,114,97,98,65,135,0,0,1,130,225,155,98,130,155,130,0,188,34,138,237,35,0,212,162,134,0,0,133,0,0,1,89,98,219,102,
+    191,219,103,0,227,135,133,0,0,0,89,225,139,237,35,4,196,66,8,32,0,0,0,0,114,129,132,237,35,0,122,193,130,0,0,0,32,192,132,237,35,4,179,226,0,32,0,0,
+    0,0,130,225,138,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,204,225,131,0,0,1,16,96,237,67,141,237,35,0,188,2,134,0,0,0,122,193,138,237,35,1,188,34,
+    49,0,142,0,0,1,106,65,212,162,138,237,35,0,212,162,134,0,0,133,0,0,1,89,99,219,102,191,219,103,0,227,135,133,0,0,0,89,225,139,237,35,3,90,1,0,0,0,
+    0,57,32,133,237,35,0,122,193,130,0,0,0,32,160,133,237,35,4,106,97,0,0,0,0,24,128,229,3,137,237,35,0,32,192,132,0,0,0,57,128,153,237,35,0,204,225,131,
+    0,0,1,16,96,237,67,141,237,35,0,163,162,134,0,0,0,139,1,139,237,35,1,229,3,90,1,139,0,0,1,24,160,179,226,140,237,35,0,212,162,134,0,0,133,0,0,1,
+    89,98,219,102,191,219,103,0,227,103,133,0,0,0,89,225,138,237,35,4,220,194,8,32,0,0,8,32,196,66,133,237,35,0,122,193,130,0,0,0,32,160,133,237,35,4,220,194,
+    16,96,0,0,0,0,155,130,137,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,204,225,131,0,0,1,16,96,237,67,141,237,35,0,188,34,134,0,0,0,122,193,141,237,
+    35,1,163,130,32,160,135,0,0,2,0,32,106,97,220,194,141,237,35,0,212,162,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,138,237,35,
+    3,147,65,0,0,0,0,73,160,134,237,35,0,122,193,130,0,0,0,32,160,134,237,35,3,106,97,0,0,0,0,73,160,137,237,35,0,32,160,132,0,0,0,57,128,153,237,35,
+    0,204,225,131,0,0,1,16,96,237,67,141,237,35,0,212,130,134,0,0,0,98,65,142,237,35,1,228,226,98,33,133,0,0,1,90,1,212,162,143,237,35,0,212,162,134,0,0,
+    133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,138,237,35,3,81,225,0,0,0,0,147,65,134,237,35,0,122,193,130,0,0,0,32,160,134,237,35,4,
+    196,66,0,0,0,0,8,64,229,3,136,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,141,237,35,1,229,3,8,32,133,0,0,0,
+    65,129,144,237,35,5,188,34,32,224,0,0,0,0,57,64,188,34,145,237,35,0,204,162,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,138,
+    237,35,3,32,192,0,0,0,0,204,130,134,237,35,4,188,2,122,193,122,193,130,193,139,33,134,237,35,4,229,3,8,64,0,0,0,0,204,98,136,237,35,0,32,192,132,0,0,
+    0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,142,237,35,0,41,0,133,0,0,0,8,64,145,237,35,2,229,3,130,193,147,66,147,237,35,0,204,162,134,0,0,
+    133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,138,237,35,3,32,160,0,0,0,0,229,2,147,237,35,3,41,0,0,0,0,0,171,194,136,237,35,0,
+    32,192,132,0,0,0,57,128,153,237,35,0,204,225,131,0,0,1,16,96,237,67,142,237,35,0,98,33,134,0,0,0,204,98,167,237,35,0,204,130,134,0,0,133,0,0,1,81,
+    98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,138,237,35,3,32,160,0,0,0,0,229,2,147,237,35,3,49,0,0,0,0,0,171,194,136,237,35,0,32,192,132,0,0,
+    0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,142,237,35,0,163,130,134,0,0,0,147,33,167,237,35,0,204,130,134,0,0,133,0,0,1,81,98,219,102,191,219,
+    103,0,227,135,133,0,0,0,89,225,138,237,35,3,32,160,0,0,0,0,228,226,147,237,35,3,40,224,0,0,0,0,171,194,136,237,35,0,32,160,132,0,0,0,57,128,153,237,
+    35,0,205,1,131,0,0,1,16,96,237,67,142,237,35,1,229,3,16,96,133,0,0,0,57,96,140,237,35,3,130,225,73,160,73,160,81,225,130,98,33,1,98,65,114,161,145,237,
+    35,0,212,130,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,138,237,35,3,49,0,0,0,0,0,196,66,146,237,35,4,229,2,0,32,0,
+    0,0,0,204,130,136,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,143,237,35,0,114,129,134,0,0,0,188,34,138,237,35,0,204,
+    98,135,0,0,0,130,225,145,237,35,0,212,162,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,138,237,35,3,98,65,0,0,0,0,130,225,
+    146,237,35,4,171,194,0,0,0,0,16,96,229,3,136,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,143,237,35,1,220,194,24,128,
+    133,0,0,0,65,96,138,237,35,0,73,193,134,0,0,1,40,224,229,3,145,237,35,0,204,130,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,
+    225,138,237,35,3,163,130,0,0,0,0,57,64,146,237,35,3,106,65,0,0,0,0,73,160,137,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,204,225,131,0,0,1,16,
+    96,237,67,144,237,35,0,163,162,134,0,0,0,188,2,136,237,35,0,188,2,135,0,0,0,188,34,146,237,35,0,204,130,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,
+    227,135,133,0,0,0,89,225,138,237,35,4,220,226,16,96,0,0,0,0,180,2,144,237,35,4,220,194,16,96,0,0,0,0,147,65,137,237,35,0,32,160,132,0,0,0,57,128,
+    153,237,35,0,205,1,131,0,0,1,24,128,237,67,145,237,35,0,106,65,133,0,0,1,40,224,228,226,134,237,35,1,229,3,49,32,134,0,0,0,114,129,147,237,35,0,204,130,
+    134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,139,237,35,4,122,161,0,0,0,0,24,128,212,162,143,237,35,4,81,225,0,0,0,0,16,
+    96,228,226,137,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,131,0,0,1,16,96,237,67,146,237,35,0,90,1,133,0,0,0,81,193,134,237,35,0,98,65,134,
+    0,0,0,106,97,148,237,35,0,204,98,134,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,135,133,0,0,0,89,225,139,237,35,5,228,226,24,160,0,0,0,0,57,64,
+    228,226,141,237,35,0,139,1,130,0,0,0,147,65,138,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,132,0,0,0,237,67,147,237,35,0,114,129,133,0,0,1,
+    65,96,220,226,131,237,35,0,130,225,134,0,0,0,130,225,149,237,35,0,188,34,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,103,133,0,0,0,89,225,140,237,35,
+    0,171,194,130,0,0,1,57,64,212,162,139,237,35,0,114,161,130,0,0,0,90,1,139,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,132,0,0,0,196,98,148,
+    237,35,1,171,194,49,32,132,0,0,4,32,160,196,66,237,35,204,130,73,129,133,0,0,1,16,96,155,130,150,237,35,0,139,33,134,0,0,133,0,0,1,81,98,219,102,191,219,
+    103,0,227,135,133,0,0,0,89,225,141,237,35,0,122,161,130,0,0,1,24,128,188,2,136,237,35,1,204,98,49,32,130,0,0,0,73,160,140,237,35,0,32,160,132,0,0,0,
+    57,128,153,237,35,0,204,225,132,0,0,0,139,33,150,237,35,1,163,162,49,0,131,0,0,2,0,32,90,1,8,64,132,0,0,2,32,160,114,161,228,227,151,237,35,0,73,193,
+    134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,89,225,142,237,35,0,122,161,131,0,0,9,57,64,139,1,196,66,228,226,237,34,229,2,220,194,163,
+    130,81,193,8,32,130,0,0,1,57,64,220,226,140,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,132,0,0,0,57,64,152,237,35,1,204,98,147,66,130,122,161,
+    6,114,129,106,65,106,65,106,97,130,225,163,130,212,162,153,237,35,1,220,226,8,32,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,143,237,
+    35,1,171,194,24,160,141,0,0,1,106,97,229,2,141,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,204,225,133,0,0,0,171,194,189,237,35,0,98,33,135,0,0,133,
+    0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,144,237,35,2,228,226,122,193,16,96,136,0,0,2,8,32,90,1,196,66,143,237,35,0,32,160,132,0,0,
+    0,57,128,153,237,35,0,204,225,133,0,0,1,24,128,212,194,187,237,35,0,147,66,136,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,146,237,
+    35,10,229,3,179,226,114,129,65,96,32,160,32,160,32,192,32,224,81,225,147,65,220,226,145,237,35,0,32,160,132,0,0,0,57,128,153,237,35,0,205,1,134,0,0,1,32,192,
+    204,130,185,237,35,0,122,193,137,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,175,237,35,0,32,192,132,0,0,0,57,128,153,237,35,0,205,
+    1,135,0,0,1,0,32,147,66,182,237,35,1,229,3,81,225,138,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,175,237,35,0,32,160,132,0,
+    0,0,57,128,153,237,35,0,204,225,137,0,0,2,49,32,147,65,212,162,176,237,67,3,229,3,180,2,114,129,16,128,139,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,
+    135,133,0,0,0,89,225,175,237,35,0,32,192,132,0,0,0,57,128,153,237,35,0,204,225,141,0,0,140,16,96,129,16,64,5,16,96,16,64,16,96,16,64,16,96,16,96,131,
+    16,64,1,16,96,16,64,139,16,96,132,16,64,130,16,96,0,8,64,143,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,135,133,0,0,0,89,225,175,237,35,0,32,160,
+    132,0,0,0,57,128,153,237,35,0,205,1,205,0,0,133,0,0,0,81,99,192,219,103,0,227,135,133,0,0,0,89,225,175,237,35,0,32,160,132,0,0,0,57,128,153,237,35,
+    0,205,1,205,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,175,237,35,0,24,160,132,0,0,0,57,128,153,237,35,0,205,1,205,0,0,133,
+    0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,89,225,174,237,35,0,220,194,133,0,0,0,57,128,153,237,35,0,205,1,137,0,0,10,16,64,98,65,171,194,196,
+    98,212,162,212,194,221,3,213,3,213,3,212,194,212,226,132,213,3,0,212,227,132,213,3,2,221,3,213,3,212,227,132,213,3,1,221,3,212,227,130,213,3,129,212,194,133,213,3,
+    0,212,227,131,213,3,7,221,3,213,3,212,226,212,162,188,34,147,66,81,225,8,32,139,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,89,225,174,237,
+    35,0,147,33,133,0,0,0,57,128,153,237,35,0,204,225,135,0,0,2,0,32,114,161,229,3,181,237,35,1,220,227,98,33,138,0,0,133,0,0,1,81,98,219,102,191,219,103,
+    0,227,135,133,0,0,0,89,225,173,237,35,1,212,130,24,128,133,0,0,0,73,192,153,237,35,0,204,225,134,0,0,1,32,192,204,130,185,237,35,1,155,130,0,32,136,0,0,
+    133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,89,225,172,237,35,1,180,2,32,160,134,0,0,0,98,96,153,237,35,0,204,225,133,0,0,1,24,128,212,194,
+    187,237,35,1,171,226,0,32,135,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,73,192,169,229,2,2,228,226,188,34,65,128,136,0,0,0,147,97,153,
+    237,35,0,204,225,133,0,0,0,155,130,189,237,35,0,106,97,135,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,103,187,0,0,1,8,32,220,226,153,237,35,0,204,225,
+    132,0,0,0,41,0,190,237,35,1,220,226,8,32,134,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,135,187,0,0,0,122,160,154,237,35,0,204,225,132,0,0,0,147,
+    65,191,237,35,0,81,225,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,186,0,0,1,81,224,237,34,154,237,35,0,204,225,132,0,0,0,212,194,191,237,35,0,
+    155,98,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,184,0,0,2,16,96,139,33,237,34,155,237,35,0,204,225,131,0,0,1,8,64,237,67,191,237,35,0,188,
+    34,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,24,160,49,0,173,49,32,3,65,96,90,0,147,96,229,34,157,237,35,0,204,225,131,0,0,1,
+    16,96,237,99,191,237,35,0,196,98,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,131,32,175,237,34,160,237,35,0,204,225,131,0,0,1,16,96,
+    237,67,191,237,35,0,204,162,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,16,96,237,67,156,
+    237,35,6,188,2,65,128,8,32,0,0,32,192,130,225,229,3,155,237,35,0,212,162,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,34,
+    207,237,35,0,204,225,131,0,0,1,16,96,237,67,155,237,35,0,163,130,133,0,0,0,73,160,155,237,35,0,212,162,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,
+    135,133,0,0,1,123,0,237,34,207,237,35,0,204,225,131,0,0,1,16,96,237,67,154,237,35,1,220,226,16,96,134,0,0,0,147,33,154,237,35,0,212,162,134,0,0,133,0,
+    0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,34,207,237,35,0,196,225,131,0,0,1,24,96,237,67,154,237,35,0,147,65,135,0,0,0,65,128,154,237,
+    35,0,212,162,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,16,96,237,67,154,237,35,0,122,
+    161,135,0,0,0,49,0,154,237,35,0,212,162,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,207,237,35,0,205,1,131,0,0,1,
+    16,96,237,67,154,237,35,0,155,98,135,0,0,0,73,161,154,237,35,0,212,162,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,207,
+    237,35,0,204,225,131,0,0,1,16,96,237,67,154,237,35,1,229,3,32,192,134,0,0,0,171,194,154,237,35,0,204,130,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,
+    227,135,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,24,128,237,67,155,237,35,1,188,34,16,96,132,0,0,0,114,129,155,237,35,0,204,130,134,0,0,133,
+    0,0,1,81,98,219,70,191,219,103,0,227,135,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,24,128,237,67,156,237,35,5,212,162,81,193,8,64,0,0,41,
+    0,163,130,156,237,35,0,204,130,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,8,64,237,67,
+    191,237,35,0,196,98,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,207,237,35,0,204,225,132,0,0,0,229,3,191,237,35,0,171,
+    194,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,207,237,35,0,196,225,132,0,0,0,171,226,191,237,35,0,114,161,134,0,0,133,
+    0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,207,237,35,0,204,225,132,0,0,0,98,33,191,237,35,0,32,192,134,0,0,133,0,0,0,81,99,
+    192,219,103,0,227,103,133,0,0,1,123,0,237,2,161,237,35,0,237,34,172,237,35,0,205,1,132,0,0,1,8,64,229,2,189,237,35,0,163,162,135,0,0,133,0,0,0,81,
+    98,192,219,103,0,227,135,133,0,0,1,123,0,237,2,159,237,35,1,196,97,81,192,131,81,224,129,81,192,0,81,224,132,81,192,0,171,225,160,237,35,0,204,225,133,0,0,0,
+    106,97,188,237,35,1,229,3,40,224,135,0,0,133,0,0,0,81,99,192,219,103,0,227,135,133,0,0,1,123,0,237,2,159,237,35,0,98,96,140,0,0,0,65,128,160,237,35,
+    0,204,225,134,0,0,0,155,130,186,237,35,1,220,226,57,64,136,0,0,133,0,0,0,81,99,192,219,103,0,227,103,133,0,0,1,123,0,237,2,158,237,35,1,229,34,16,96,
+    141,0,0,0,212,162,159,237,35,0,204,225,135,0,0,1,106,129,229,3,183,237,35,1,204,130,40,224,137,0,0,133,0,0,0,89,99,192,219,103,0,227,135,133,0,0,1,123,
+    0,237,2,158,237,35,0,155,129,142,0,0,0,122,192,159,237,35,0,204,225,136,0,0,2,24,160,147,66,229,35,179,237,35,2,212,162,106,97,8,32,138,0,0,133,0,0,1,
+    81,98,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,2,158,237,35,0,73,192,142,0,0,1,40,224,237,66,158,237,35,0,204,225,138,0,0,3,16,64,90,1,122,193,
+    139,66,131,147,66,1,139,34,147,33,130,147,34,135,139,33,129,139,34,133,139,33,129,139,34,130,147,66,1,139,34,139,33,130,147,34,1,139,33,139,34,134,139,33,4,139,34,139,
+    66,139,33,106,129,49,32,141,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,155,237,35,3,228,226,196,98,188,97,8,32,143,0,0,2,
+    163,193,196,98,220,226,156,237,35,0,204,225,205,0,0,133,0,0,0,81,98,192,219,103,0,227,135,133,0,0,1,123,0,237,2,154,237,35,1,171,193,8,32,149,0,0,1,98,
+    64,220,226,154,237,35,0,204,225,205,0,0,133,0,0,0,81,99,192,219,103,0,227,135,133,0,0,1,123,0,237,2,150,237,35,4,237,66,229,34,204,129,237,66,41,0,135,0,
+    0,6,16,64,65,192,106,128,114,192,106,128,65,160,8,32,136,0,0,2,16,96,139,65,237,34,152,237,35,0,204,225,205,0,0,133,0,0,0,89,99,192,219,103,0,227,135,133,
+    0,0,1,123,0,237,2,149,237,35,5,171,193,49,32,0,0,0,0,229,65,32,192,133,0,0,10,41,0,147,128,221,32,220,224,212,192,212,192,212,160,220,224,221,0,147,96,41,
+    0,136,0,0,2,24,160,147,97,237,66,150,237,35,0,204,225,139,0,0,3,24,128,49,64,65,161,73,161,130,73,225,1,73,161,73,193,137,73,225,129,74,1,133,73,225,129,74,
+    1,0,73,193,130,73,225,1,73,161,73,193,137,73,225,129,74,1,4,73,225,73,193,65,128,41,0,8,32,141,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,135,133,0,
+    0,1,123,0,237,2,148,237,35,0,139,32,131,0,0,1,237,65,32,192,132,0,0,12,114,160,221,32,220,192,221,0,196,160,147,128,131,32,147,160,204,192,221,0,212,192,229,32,
+    114,160,137,0,0,1,65,96,212,194,149,237,35,0,204,225,137,0,0,2,65,128,188,34,237,67,177,237,35,2,237,67,163,194,49,32,139,0,0,133,0,0,1,81,98,219,102,191,
+    219,103,0,227,135,133,0,0,1,123,0,237,2,147,237,35,0,171,225,132,0,0,1,229,65,32,192,131,0,0,4,122,224,220,224,220,224,171,224,49,64,132,0,0,4,57,96,172,
+    0,220,224,220,224,122,224,137,0,0,2,8,64,122,224,229,2,130,237,35,0,237,34,143,237,35,0,204,225,135,0,0,1,24,160,163,162,183,237,35,1,147,65,8,64,137,0,0,
+    133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,146,237,35,1,229,34,24,160,132,0,0,1,229,65,32,192,130,0,0,3,98,96,220,224,212,192,
+    90,0,136,0,0,3,90,32,212,192,220,224,98,64,138,0,0,2,196,64,163,193,106,128,131,106,160,0,155,160,140,237,35,0,204,225,134,0,0,1,65,128,229,3,185,237,35,1,
+    196,66,16,128,136,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,2,138,237,35,135,196,65,0,130,224,133,0,0,7,229,33,32,192,0,0,
+    0,0,24,160,221,0,220,224,57,96,138,0,0,3,65,160,220,224,221,0,24,128,137,0,0,1,180,32,114,128,132,0,0,0,98,64,140,237,35,0,204,225,133,0,0,1,41,0,
+    229,3,187,237,35,1,204,162,16,96,135,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,2,137,237,35,1,237,66,24,128,141,0,0,6,229,
+    65,32,192,0,0,0,0,139,96,220,192,123,0,140,0,0,2,139,64,220,192,139,64,137,0,0,1,188,32,114,160,132,0,0,0,98,64,140,237,35,0,204,225,133,0,0,0,196,
+    98,189,237,35,0,155,98,135,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,137,237,35,1,237,66,24,128,141,0,0,6,229,33,32,192,
+    0,0,0,0,220,224,229,32,16,96,140,0,0,2,24,128,229,32,212,224,137,0,0,1,188,64,114,160,132,0,0,0,98,32,140,237,35,0,196,225,132,0,0,0,73,193,154,237,
+    35,8,196,66,155,130,147,65,147,65,147,33,147,65,147,33,188,2,204,130,155,237,35,0,24,128,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,
+    0,237,2,137,237,35,1,237,66,24,128,141,0,0,5,229,33,32,192,0,0,57,96,221,0,172,0,142,0,0,2,180,0,229,0,49,64,136,0,0,1,188,64,114,160,132,0,0,
+    0,98,64,140,237,35,0,204,225,132,0,0,0,163,162,151,237,35,2,180,2,81,225,16,96,130,0,0,1,8,64,57,64,131,0,0,3,24,160,81,193,163,130,228,227,151,237,35,
+    0,98,65,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,2,137,237,35,1,237,66,24,128,141,0,0,5,229,33,32,192,0,0,114,224,
+    212,128,122,224,142,0,0,2,122,224,212,160,106,160,136,0,0,1,188,64,114,160,132,0,0,0,98,64,140,237,35,0,204,225,132,0,0,0,220,227,149,237,35,1,220,194,81,225,
+    132,0,0,4,49,32,212,162,237,35,188,34,40,224,132,0,0,1,16,96,155,98,150,237,35,0,163,162,134,0,0,133,0,0,0,81,99,192,219,103,0,227,135,133,0,0,1,123,
+    0,237,2,137,237,35,1,237,66,24,128,141,0,0,5,229,65,32,192,0,0,131,64,212,128,98,128,142,0,0,2,98,128,212,160,123,32,136,0,0,1,188,64,114,160,132,0,0,
+    0,98,64,140,237,35,0,196,225,131,0,0,1,16,64,237,99,148,237,35,1,147,66,8,64,132,0,0,1,81,193,229,3,130,237,35,1,220,226,49,0,133,0,0,0,130,193,149,
+    237,35,0,188,66,134,0,0,133,0,0,0,89,98,192,219,103,0,227,103,133,0,0,1,123,0,237,2,137,237,35,1,237,66,24,128,141,0,0,5,229,33,32,192,0,0,114,224,
+    212,128,106,128,142,0,0,2,106,128,212,160,115,0,136,0,0,1,188,64,114,160,132,0,0,0,98,64,140,237,35,0,204,225,131,0,0,1,16,96,237,99,147,237,35,0,130,225,
+    133,0,0,0,73,193,133,237,35,1,212,162,16,96,133,0,0,0,114,129,148,237,35,0,204,130,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,135,133,0,0,1,123,
+    0,237,2,137,237,35,1,237,66,24,128,141,0,0,5,229,33,32,192,0,0,90,64,220,192,139,32,142,0,0,2,139,64,220,224,82,32,136,0,0,1,188,64,114,160,132,0,0,
+    0,98,64,140,237,35,0,204,225,131,0,0,1,16,96,237,67,146,237,35,0,188,2,133,0,0,1,32,192,229,3,134,237,35,0,139,1,134,0,0,0,155,98,147,237,35,0,212,
+    162,134,0,0,133,0,0,0,81,98,192,219,103,0,227,135,133,0,0,1,123,0,237,2,137,237,35,1,237,66,24,128,141,0,0,5,229,65,32,192,0,0,24,128,229,64,196,128,
+    142,0,0,2,196,128,229,64,24,128,136,0,0,1,188,64,114,160,132,0,0,0,98,64,140,237,35,0,204,225,131,0,0,1,16,96,237,67,145,237,35,1,228,227,32,192,133,0,
+    0,0,179,226,136,237,35,0,40,224,133,0,0,1,16,96,212,130,146,237,35,0,212,162,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,
+    2,137,237,35,1,237,66,24,128,141,0,0,6,229,33,32,192,0,0,0,0,171,224,221,0,73,192,140,0,0,2,65,160,221,0,180,32,137,0,0,1,188,64,114,160,132,0,0,
+    0,98,64,140,237,35,0,196,225,131,0,0,1,16,96,237,67,145,237,35,0,114,129,133,0,0,0,81,225,137,237,35,0,179,226,134,0,0,0,73,161,146,237,35,0,212,162,134,
+    0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,2,137,237,35,1,237,66,65,128,134,49,32,0,24,128,133,0,0,7,229,33,32,192,0,0,
+    0,0,57,128,221,0,196,128,8,64,138,0,0,3,8,64,196,128,221,0,73,192,137,0,0,1,188,64,114,160,132,0,0,0,98,32,140,237,35,0,204,225,131,0,0,1,24,96,
+    237,67,144,237,35,1,212,162,8,32,133,0,0,0,196,66,138,237,35,0,65,96,134,0,0,0,163,130,145,237,35,0,212,162,134,0,0,133,0,0,0,81,99,192,219,103,0,227,
+    103,133,0,0,1,123,0,237,2,138,237,35,0,237,34,134,237,66,0,188,65,133,0,0,1,229,33,32,192,130,0,0,3,155,128,220,192,172,32,8,64,136,0,0,3,0,32,172,
+    0,220,192,171,224,138,0,0,1,188,64,114,128,132,0,0,0,98,32,140,237,35,0,204,225,131,0,0,1,24,96,237,67,144,237,35,0,106,65,133,0,0,0,57,32,139,237,35,
+    1,196,66,16,128,133,16,96,0,57,96,145,237,35,0,212,162,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,2,146,237,35,1,237,66,
+    73,160,132,0,0,1,229,33,32,192,130,0,0,4,16,96,204,192,212,192,204,224,41,0,134,0,0,4,32,224,196,160,220,192,212,224,16,128,138,0,0,2,196,97,204,161,180,96,
+    131,180,128,0,204,161,140,237,35,0,196,225,131,0,0,1,24,96,237,67,143,237,35,1,237,3,16,96,133,0,0,0,130,193,166,237,35,0,204,162,134,0,0,133,0,0,1,81,
+    99,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,147,237,35,1,212,194,24,160,131,0,0,1,229,33,32,192,131,0,0,14,41,0,204,192,220,192,221,0,147,96,65,
+    160,16,64,0,0,8,32,57,96,139,64,221,0,212,192,204,192,49,32,137,0,0,2,24,160,163,161,237,34,147,237,35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,179,
+    226,134,0,0,0,188,34,166,237,35,0,204,162,134,0,0,133,0,0,1,89,99,219,70,191,219,103,0,227,103,133,0,0,1,123,0,237,2,148,237,35,1,212,194,81,192,130,0,
+    0,1,229,65,32,192,132,0,0,12,16,96,139,64,221,0,212,192,220,224,221,32,221,0,229,32,220,224,220,192,220,224,139,64,16,128,136,0,0,2,8,32,122,192,229,2,149,237,
+    35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,122,161,133,0,0,0,8,64,145,237,35,1,212,162,204,130,147,237,35,0,204,130,134,0,0,133,0,0,1,81,99,219,
+    102,191,219,103,0,227,103,133,0,0,1,123,0,237,2,150,237,35,4,212,161,147,129,139,96,237,34,32,192,134,0,0,8,16,96,98,128,163,192,188,128,196,128,188,128,163,192,98,
+    128,16,96,136,0,0,2,0,32,98,32,212,193,151,237,35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,81,225,133,0,0,0,49,32,144,237,35,3,122,161,8,32,8,
+    32,130,225,146,237,35,0,212,162,134,0,0,133,0,0,0,81,99,192,219,103,0,227,103,133,0,0,1,123,0,237,2,153,237,35,1,237,34,57,64,151,0,0,1,65,160,204,161,
+    153,237,35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,49,32,133,0,0,0,81,225,142,237,35,1,204,98,49,32,131,0,0,1,57,64,196,66,144,237,35,0,212,162,
+    134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,123,0,237,2,154,237,35,1,188,33,16,96,148,0,0,2,24,128,163,161,237,66,154,237,35,0,204,
+    225,131,0,0,1,16,96,237,67,143,237,35,0,16,96,133,0,0,0,98,65,141,237,35,1,163,130,8,64,133,0,0,1,8,32,122,161,143,237,35,0,212,162,134,0,0,133,0,
+    0,0,81,98,192,219,103,0,227,135,133,0,0,1,123,0,237,2,155,237,35,0,229,34,148,212,193,0,229,2,156,237,35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,
+    16,96,133,0,0,0,106,97,139,237,35,1,204,130,73,193,137,0,0,1,57,64,196,66,141,237,35,0,212,162,134,0,0,133,0,0,0,81,98,192,219,103,0,227,103,133,0,0,
+    1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,16,96,133,0,0,0,114,129,138,237,35,1,155,98,16,96,139,0,0,1,8,32,114,129,140,
+    237,35,0,212,162,134,0,0,133,0,0,0,81,98,192,219,103,0,227,135,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,24,128,
+    133,0,0,0,106,65,137,237,35,0,163,130,131,65,128,135,0,0,131,65,96,1,106,97,229,3,138,237,35,0,212,162,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,
+    103,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,24,96,237,67,143,237,35,0,57,64,133,0,0,0,81,225,142,237,35,0,32,160,133,0,0,0,32,192,144,
+    237,35,0,212,162,134,0,0,133,0,0,0,89,98,192,219,103,0,227,103,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,81,193,
+    133,0,0,0,57,64,142,237,35,0,8,64,133,0,0,0,81,193,144,237,35,0,204,162,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,
+    2,207,237,35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,122,161,133,0,0,0,24,160,141,237,35,0,228,227,134,0,0,0,130,225,144,237,35,0,204,162,134,0,0,
+    133,0,0,0,81,99,192,219,103,0,227,103,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,16,96,237,67,143,237,35,0,179,226,134,0,0,0,212,162,140,237,
+    35,0,180,2,134,0,0,0,188,34,144,237,35,0,204,130,134,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,
+    0,0,1,16,96,237,67,144,237,35,0,16,96,133,0,0,0,147,66,140,237,35,0,114,161,133,0,0,0,32,192,145,237,35,0,204,130,134,0,0,133,0,0,1,81,99,219,102,
+    191,219,103,0,227,103,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,16,96,237,67,144,237,35,0,122,193,133,0,0,0,73,193,140,237,35,0,32,192,133,0,
+    0,0,122,193,145,237,35,0,212,162,134,0,0,133,0,0,0,81,98,192,219,103,0,227,103,133,0,0,1,123,0,237,34,207,237,35,0,204,225,131,0,0,1,16,96,237,67,144,
+    237,35,1,220,226,8,64,132,0,0,1,0,32,228,227,138,237,35,0,155,98,133,0,0,1,8,32,212,162,145,237,35,0,212,162,134,0,0,133,0,0,0,81,99,192,219,103,0,
+    227,103,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,16,96,237,67,145,237,35,0,106,65,133,0,0,0,130,225,137,237,35,1,220,226,24,160,133,0,0,0,
+    98,33,146,237,35,0,204,130,134,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,103,133,0,0,1,123,0,237,34,207,237,35,0,204,225,131,0,0,1,24,96,237,67,145,
+    237,35,1,220,226,16,96,132,0,0,1,24,128,229,3,136,237,35,0,98,33,133,0,0,1,16,128,220,226,146,237,35,0,204,130,134,0,0,133,0,0,0,81,99,192,219,103,0,
+    227,103,133,0,0,1,123,0,237,2,207,237,35,0,204,225,131,0,0,1,24,128,237,67,146,237,35,0,155,98,133,0,0,0,106,97,135,237,35,0,163,130,134,0,0,0,171,194,
+    147,237,35,0,204,130,134,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,103,133,0,0,1,122,224,237,34,207,237,35,0,204,225,131,0,0,1,8,64,237,67,147,237,35,
+    0,90,1,133,0,0,0,147,66,133,237,35,1,196,66,8,32,132,0,0,1,0,32,155,98,148,237,35,0,196,98,134,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,103,
+    133,0,0,0,114,192,208,237,35,0,196,193,132,0,0,0,229,35,148,237,35,0,57,64,133,0,0,0,171,162,131,237,35,1,220,194,24,160,133,0,0,0,155,98,149,237,35,0,
+    179,226,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,90,0,208,237,35,0,188,65,132,0,0,0,188,34,148,237,35,1,220,226,81,193,132,0,0,
+    5,8,64,179,226,237,35,237,35,212,130,49,0,132,0,0,1,24,128,171,162,150,237,35,0,130,225,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,1,
+    32,192,237,66,207,237,35,0,139,1,132,0,0,0,114,129,150,237,35,1,179,226,57,64,132,0,0,2,106,65,122,193,8,32,132,0,0,1,81,225,212,194,151,237,35,0,49,32,
+    134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,134,0,0,0,163,161,206,237,35,1,237,66,41,0,132,0,0,1,16,96,229,3,151,237,35,4,204,130,147,66,114,
+    129,98,33,65,128,132,57,96,2,65,128,131,1,220,194,152,237,35,0,180,2,135,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,134,0,0,1,16,96,212,194,204,237,
+    35,1,237,34,131,0,134,0,0,0,106,97,188,237,35,1,229,3,40,224,135,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,135,0,0,1,49,32,229,34,203,237,35,
+    0,172,0,136,0,0,0,172,2,187,237,35,0,73,161,136,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,136,0,0,2,49,32,188,65,237,34,199,237,35,2,237,34,
+    139,32,8,32,136,0,0,1,8,64,155,130,184,237,35,1,229,3,73,193,137,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,138,0,0,1,49,32,98,32,195,114,128,
+    129,114,160,1,90,0,24,128,140,0,0,1,65,128,196,98,181,237,35,1,155,130,24,160,138,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,135,227,0,0,2,49,32,114,
+    161,147,65,135,163,162,1,163,130,163,162,130,163,130,131,155,130,131,163,130,130,155,130,130,163,130,134,163,162,1,163,130,163,162,130,163,130,131,155,130,130,163,130,4,163,162,155,130,
+    131,1,90,1,16,128,140,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,135,255,0,0,166,0,0,133,0,0,1,89,99,219,102,172,219,103,0,219,102,145,219,103,0,227,
+    135,255,0,0,166,0,0,133,0,0,1,81,99,219,102,181,219,103,0,219,102,136,219,103,0,227,135,255,0,0,166,0,0,133,0,0,1,89,98,219,102,191,219,103,0,227,135,140,
+    0,0,5,24,160,81,192,89,225,90,1,90,1,106,97,152,90,1,1,106,65,98,33,144,90,1,2,81,225,65,128,16,96,144,0,0,5,24,160,81,192,89,225,90,1,90,1,106,
+    97,145,90,1,2,81,193,57,64,8,64,148,0,0,1,8,64,8,32,161,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,138,0,0,1,98,33,196,66,179,237,35,2,
+    229,3,171,194,65,128,140,0,0,1,98,33,196,66,153,237,35,2,228,226,147,65,32,192,140,0,0,3,65,128,155,97,220,194,229,2,148,237,35,4,229,2,212,130,163,130,90,1,
+    8,32,139,0,0,133,0,0,1,81,98,219,102,154,219,103,0,219,102,135,219,103,0,219,102,139,219,103,0,219,102,141,219,103,0,227,135,136,0,0,1,32,160,188,34,184,237,35,
+    1,171,194,8,64,136,0,0,1,32,160,188,34,157,237,35,1,229,2,114,161,137,0,0,1,40,224,188,34,156,237,35,1,212,162,73,160,138,0,0,133,0,0,1,81,98,219,102,
+    183,219,103,129,219,102,133,219,103,0,227,135,135,0,0,1,16,64,204,98,186,237,35,0,188,2,135,0,0,1,16,64,204,98,160,237,35,0,139,1,135,0,0,1,49,32,220,226,
+    159,237,35,0,90,1,137,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,135,0,0,0,179,226,188,237,35,0,130,225,134,0,0,0,179,226,162,237,35,0,89,225,133,
+    0,0,1,57,64,228,226,160,237,35,1,229,3,73,160,136,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,134,0,0,0,130,193,190,237,35,0,57,64,132,0,0,0,
+    130,193,163,237,35,1,220,226,16,96,131,0,0,1,16,96,212,162,144,237,35,1,130,193,229,2,143,237,35,1,229,3,49,0,135,0,0,133,0,0,1,81,98,219,102,191,219,103,
+    0,227,135,133,0,0,1,32,192,229,3,141,237,35,4,220,226,106,65,90,1,90,1,130,225,171,237,35,0,163,162,131,0,0,1,32,192,229,3,164,237,35,0,114,129,131,0,0,
+    0,130,193,145,237,35,1,40,224,220,226,144,237,35,0,171,194,135,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,114,129,142,237,35,0,147,65,131,0,
+    0,171,237,35,1,229,3,16,96,130,0,0,0,114,129,165,237,35,0,196,98,130,0,0,1,8,32,220,226,145,237,35,1,41,0,220,226,145,237,35,0,24,128,134,0,0,133,0,
+    0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,171,194,142,237,35,0,147,33,131,0,0,160,237,35,1,163,196,204,132,137,237,35,0,81,192,130,0,0,0,171,194,166,
+    237,35,3,16,96,0,0,0,0,57,64,138,237,35,1,114,161,220,194,133,237,35,1,171,194,229,3,132,237,35,2,228,226,106,97,229,3,137,237,35,0,89,225,134,0,0,133,0,
+    0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,180,2,142,237,35,0,155,98,131,16,128,157,237,35,0,212,196,141,237,35,0,98,65,130,0,0,0,180,2,166,237,35,
+    3,32,192,0,0,0,0,81,225,138,237,35,2,130,225,40,224,212,162,139,237,35,1,90,1,89,225,138,237,35,0,130,193,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,
+    227,135,133,0,0,0,188,2,175,237,35,3,204,163,90,2,82,2,220,195,140,237,35,0,106,97,130,0,0,0,188,2,166,237,35,3,40,224,0,0,0,0,90,1,139,237,35,1,
+    122,161,147,65,138,237,35,1,196,66,81,225,139,237,35,0,130,225,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,188,2,136,237,35,1,212,162,98,
+    33,137,65,128,1,90,1,212,194,152,237,35,1,196,67,204,131,142,237,35,0,114,129,130,0,0,0,188,2,166,237,35,3,40,224,0,0,0,0,90,1,143,237,35,6,188,2,106,
+    97,57,96,32,192,49,0,98,33,171,194,143,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,188,2,135,237,35,1,220,194,40,224,
+    139,0,0,0,81,225,148,237,35,1,188,67,155,163,135,237,35,1,229,35,212,163,136,237,35,0,114,97,130,0,0,0,188,2,166,237,35,3,40,224,0,0,0,0,90,1,141,237,
+    35,1,212,162,65,128,134,0,0,1,40,224,196,66,141,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,188,2,135,237,35,0,65,
+    96,140,0,0,0,41,0,146,237,35,3,220,227,98,66,65,129,196,131,135,237,35,1,220,195,163,163,136,237,35,0,114,97,130,0,0,0,188,2,166,237,35,3,40,224,0,0,0,
+    0,90,1,140,237,35,1,220,226,40,224,136,0,0,1,8,64,204,98,140,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,188,2,
+    134,237,35,4,106,97,0,0,0,0,73,161,122,161,137,0,0,0,41,0,146,237,35,1,98,99,171,195,132,237,35,3,204,131,114,130,65,195,204,132,139,237,35,0,114,129,130,0,
+    0,0,188,2,166,237,35,3,40,224,0,0,0,0,90,1,140,237,35,0,65,128,138,0,0,1,32,160,220,226,139,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,
+    219,103,0,227,135,133,0,0,0,188,2,133,237,35,6,130,193,0,0,0,0,89,225,237,35,229,3,8,64,136,0,0,0,41,0,142,237,35,0,229,3,134,237,35,4,220,227,237,
+    35,237,35,212,163,196,99,141,237,35,0,114,129,130,0,0,0,188,2,166,237,35,3,40,224,0,0,0,0,90,1,133,237,35,6,229,3,155,65,188,34,229,3,237,35,237,35,130,
+    225,140,0,0,0,98,65,130,237,35,2,212,162,163,162,220,194,133,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,188,2,132,237,
+    35,6,130,193,0,0,0,0,65,128,229,3,237,35,81,193,137,0,0,0,41,0,140,237,35,3,220,227,122,195,65,162,220,227,130,237,35,3,163,163,90,2,73,195,155,131,145,237,
+    35,0,114,129,130,0,0,0,188,2,145,237,35,1,188,34,171,194,146,237,35,3,40,224,0,0,0,0,90,1,133,237,35,6,229,3,114,129,57,64,89,224,237,35,228,226,16,96,
+    140,0,0,6,8,32,204,130,237,35,163,130,40,224,90,1,212,130,133,237,35,0,139,1,134,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,135,133,0,0,0,188,2,131,
+    237,35,6,212,130,0,0,0,0,40,224,229,2,229,3,73,161,138,0,0,0,41,0,138,237,35,3,212,195,114,130,65,130,171,227,131,237,35,2,220,227,147,67,212,195,137,237,35,
+    1,220,227,204,163,135,237,35,0,114,129,130,0,0,0,188,2,145,237,35,1,139,1,130,193,146,237,35,3,40,224,0,0,0,0,90,1,138,237,35,0,163,130,142,0,0,0,122,
+    193,138,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,188,2,131,237,35,5,188,34,0,0,0,0,81,193,237,35,98,33,139,0,
+    0,0,41,0,137,237,35,6,163,163,49,34,163,196,237,35,188,68,90,2,90,67,137,237,35,6,180,35,114,195,82,2,237,35,237,35,220,195,196,99,135,237,35,0,114,97,130,0,
+    0,0,188,2,145,237,35,1,139,1,130,193,146,237,35,3,40,224,0,0,0,0,90,1,138,237,35,0,130,193,142,0,0,0,65,96,138,237,35,0,139,1,134,0,0,133,0,0,
+    1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,188,2,131,237,35,0,188,34,130,0,0,0,49,32,132,0,0,1,163,130,57,64,133,0,0,0,41,0,137,237,35,5,204,
+    131,171,228,106,130,65,163,114,130,188,67,131,237,35,9,204,163,163,163,130,227,90,34,212,195,237,35,237,35,171,195,171,227,212,196,139,237,35,0,114,129,130,0,0,0,188,2,137,
+    237,35,1,212,130,155,97,133,237,35,1,196,66,179,226,133,237,35,129,188,34,138,237,35,3,40,224,0,0,0,0,90,1,138,237,35,0,130,193,142,0,0,0,40,224,138,237,35,
+    0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,188,2,131,237,35,0,188,34,134,0,0,5,106,65,98,33,237,35,130,225,147,33,16,128,
+    131,0,0,0,41,0,133,237,35,17,147,66,65,162,237,35,237,35,212,163,122,226,196,132,229,4,188,35,147,99,106,98,229,4,237,35,237,35,171,227,155,99,188,35,221,4,145,237,
+    35,0,114,129,130,0,0,0,188,2,137,237,35,2,220,226,49,0,147,65,139,237,35,2,204,98,32,192,196,66,138,237,35,3,40,224,0,0,0,0,90,1,138,237,35,0,130,225,
+    142,0,0,0,81,192,138,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,188,2,131,237,35,0,188,34,134,0,0,5,139,1,237,
+    3,237,35,237,35,212,130,41,0,131,0,0,0,41,0,131,237,35,12,147,99,32,193,0,0,8,64,188,68,237,35,237,35,90,35,73,227,90,2,130,227,171,195,204,164,152,237,35,
+    0,114,129,130,0,0,0,188,2,138,237,35,1,212,130,89,225,139,237,35,1,81,224,163,162,139,237,35,3,40,224,0,0,0,0,90,1,138,237,35,0,188,34,142,0,0,0,139,
+    1,138,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,188,2,131,237,35,0,188,34,132,0,0,24,90,1,122,161,0,0,24,160,
+    237,35,122,161,0,0,24,160,155,98,8,64,0,0,0,0,41,0,237,35,237,35,147,67,41,1,0,32,0,0,0,0,8,64,171,195,237,35,237,35,171,195,132,163,163,3,220,227,
+    237,35,237,35,204,131,130,163,163,9,212,163,237,35,237,35,204,131,163,163,163,163,228,227,237,35,237,35,188,67,135,237,35,0,114,129,130,0,0,0,188,2,142,237,35,7,220,226,
+    147,65,81,193,32,192,32,192,73,160,130,225,212,162,143,237,35,3,40,224,0,0,0,0,90,1,139,237,35,0,65,96,140,0,0,1,16,96,228,226,138,237,35,0,139,1,134,0,
+    0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,188,2,131,237,35,0,188,34,132,0,0,8,122,161,220,226,0,32,0,0,237,35,81,225,0,0,106,97,212,
+    194,130,0,0,12,41,0,237,35,237,35,122,227,8,97,0,32,0,0,0,0,16,96,172,4,237,35,237,35,155,131,131,147,67,4,139,67,220,195,237,35,237,35,196,67,130,147,67,
+    9,204,131,237,35,237,35,196,99,147,67,147,67,220,227,237,35,237,35,180,4,135,237,35,0,114,129,130,0,0,0,188,2,141,237,35,1,163,162,8,64,133,0,0,1,8,64,163,
+    162,142,237,35,3,40,224,0,0,0,0,90,1,139,237,35,0,196,98,140,0,0,0,130,193,139,237,35,0,139,1,134,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,103,
+    133,0,0,0,188,2,131,237,35,0,188,34,131,0,0,13,81,225,155,98,237,35,147,65,130,193,237,35,171,162,130,193,204,98,204,130,122,193,0,0,0,0,41,0,130,237,35,12,
+    212,195,98,98,8,32,0,0,16,97,180,36,237,35,237,35,90,35,98,66,139,3,180,3,212,196,153,237,35,0,114,129,130,0,0,0,188,2,140,237,35,0,147,33,137,0,0,0,
+    147,33,141,237,35,3,40,224,0,0,0,0,90,1,140,237,35,0,130,193,138,0,0,1,57,64,229,3,139,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,
+    0,227,103,133,0,0,0,188,2,131,237,35,0,188,34,131,0,0,13,139,1,204,130,237,35,212,130,196,98,237,35,212,162,196,98,228,226,220,226,196,66,0,0,0,0,41,0,132,
+    237,35,16,212,163,98,66,24,161,221,3,237,35,220,227,171,227,212,197,180,3,139,35,98,66,73,227,229,4,237,35,237,35,196,132,196,131,147,237,35,0,114,129,130,0,0,0,188,
+    2,139,237,35,0,163,130,139,0,0,0,139,33,140,237,35,3,40,224,0,0,0,0,90,1,141,237,35,0,89,225,136,0,0,1,24,160,212,130,140,237,35,0,139,1,134,0,0,
+    133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,188,2,131,237,35,0,188,34,132,0,0,8,98,33,229,3,16,96,0,0,237,35,81,225,0,0,122,193,204,98,
+    130,0,0,0,41,0,137,237,35,5,220,228,130,226,73,195,81,226,155,131,229,3,131,237,35,8,179,227,114,130,82,3,82,3,212,195,237,35,237,35,204,131,220,228,140,237,35,0,
+    114,97,130,0,0,0,188,2,133,237,35,6,196,98,163,162,220,194,237,35,237,35,228,226,16,96,140,0,0,5,196,66,237,35,237,35,229,2,188,34,179,226,134,237,35,3,40,224,
+    0,0,0,0,90,1,141,237,35,1,220,226,16,96,135,0,0,0,163,130,141,237,35,0,139,1,134,0,0,133,0,0,0,81,98,192,219,103,0,227,135,133,0,0,0,188,2,131,
+    237,35,0,188,34,132,0,0,12,106,97,147,33,0,0,8,64,237,35,106,65,0,0,32,192,179,226,8,64,0,0,0,0,41,0,137,237,35,6,147,67,81,226,180,3,220,227,147,
+    99,81,227,122,195,137,237,35,6,155,131,90,34,90,35,237,35,237,35,220,227,204,131,135,237,35,0,114,97,130,0,0,0,188,2,133,237,35,5,196,66,81,192,32,192,204,130,237,
+    35,147,33,141,0,0,5,81,192,237,35,229,3,49,0,65,96,130,225,134,237,35,3,40,224,0,0,0,0,90,1,142,237,35,0,106,97,134,0,0,0,24,128,142,237,35,0,139,
+    1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,133,0,0,0,188,2,131,237,35,0,188,34,134,0,0,5,98,33,220,226,237,35,237,35,179,226,24,160,131,0,
+    0,0,41,0,138,237,35,3,212,163,81,226,57,98,204,131,131,237,35,1,229,3,180,36,138,237,35,1,220,227,204,131,135,237,35,0,114,97,130,0,0,0,188,2,138,237,35,0,
+    73,160,141,0,0,1,8,64,229,3,138,237,35,3,40,224,0,0,0,0,90,1,142,237,35,0,171,162,134,0,0,0,81,192,142,237,35,0,139,1,134,0,0,133,0,0,1,81,
+    99,219,102,191,219,103,0,227,135,133,0,0,0,188,2,131,237,35,0,188,34,134,0,0,5,155,130,171,162,237,35,179,226,212,162,41,0,131,0,0,0,41,0,140,237,35,10,188,
+    67,81,226,98,66,229,3,237,35,237,35,228,227,114,162,65,163,98,66,188,35,145,237,35,0,114,97,130,0,0,0,188,2,138,237,35,0,32,192,142,0,0,0,204,98,138,237,35,
+    3,40,224,0,0,0,0,90,1,142,237,35,0,171,194,134,0,0,0,98,1,142,237,35,0,139,1,134,0,0,133,0,0,1,81,99,219,102,191,219,103,0,227,103,133,0,0,0,
+    188,2,131,237,35,0,188,34,136,0,0,1,237,35,81,225,133,0,0,0,41,0,142,237,35,1,196,99,229,3,132,237,35,5,204,163,196,67,237,35,237,35,229,3,229,35,141,237,
+    35,0,114,129,130,0,0,0,188,2,131,237,35,134,41,0,0,0,32,142,0,0,0,32,192,132,41,0,0,155,130,132,237,35,3,40,224,0,0,0,0,90,1,142,237,35,0,204,
+    98,134,32,192,0,147,65,142,237,35,0,139,1,134,0,0,133,0,0,0,81,98,192,219,103,0,227,135,133,0,0,0,188,2,131,237,35,0,188,34,144,0,0,0,41,0,146,237,
+    35,1,130,226,212,163,132,237,35,3,188,35,73,227,81,226,204,163,139,237,35,0,114,129,130,0,0,0,188,2,131,237,35,156,188,34,0,220,194,132,237,35,3,40,224,0,0,0,
+    0,90,1,166,237,35,0,139,1,134,0,0,133,0,0,0,81,98,192,219,103,0,227,135,133,0,0,0,188,2,131,237,35,0,188,34,144,0,0,0,41,0,146,237,35,3,196,99,
+    82,2,98,66,204,163,132,237,35,4,221,3,229,3,237,35,220,227,171,227,136,237,35,0,114,129,130,0,0,0,188,2,166,237,35,3,40,224,0,0,0,0,90,1,142,237,35,0,
+    229,3,134,130,193,0,204,130,142,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,188,2,131,237,35,0,204,130,144,0,0,0,65,
+    96,148,237,35,1,180,4,139,67,135,237,35,1,229,35,204,132,136,237,35,0,114,97,130,0,0,0,188,2,166,237,35,3,40,224,0,0,0,0,90,1,142,237,35,0,220,226,134,
+    0,0,0,171,194,142,237,35,0,139,1,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,0,188,2,132,237,35,1,114,129,8,32,141,0,0,1,16,96,
+    179,226,152,237,35,1,212,195,229,3,142,237,35,0,114,97,130,0,0,0,188,2,166,237,35,3,40,224,0,0,0,0,90,1,142,237,35,0,228,226,134,0,0,0,171,194,142,237,
+    35,0,139,1,134,0,0,133,0,0,0,81,98,192,219,103,0,227,135,133,0,0,0,180,2,175,237,35,3,188,35,65,162,130,227,229,3,140,237,35,0,106,65,130,0,0,0,180,
+    2,166,237,35,3,32,192,0,0,0,0,90,1,143,237,35,134,220,226,0,229,3,142,237,35,0,130,225,134,0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,103,133,0,0,
+    0,171,194,177,237,35,1,163,195,228,227,140,237,35,0,81,193,130,0,0,0,171,194,166,237,35,3,16,128,0,0,0,0,81,193,144,237,35,0,179,226,130,171,194,0,179,226,144,
+    237,35,0,130,193,134,0,0,133,0,0,0,81,99,192,219,103,0,227,103,133,0,0,0,114,129,180,237,35,1,180,4,204,164,136,237,35,1,229,3,24,128,130,0,0,0,114,129,
+    165,237,35,0,204,98,130,0,0,0,49,0,144,237,35,0,49,0,130,0,0,0,40,224,144,237,35,0,81,192,134,0,0,133,0,0,0,81,98,192,219,103,0,227,103,133,0,0,
+    0,49,32,191,237,35,0,179,226,131,0,0,0,49,32,165,237,35,0,130,225,131,0,0,0,220,194,143,237,35,4,220,194,73,160,32,192,57,64,204,98,144,237,35,0,24,128,134,
+    0,0,133,0,0,1,81,98,219,102,191,219,103,0,227,135,134,0,0,0,188,2,190,237,35,0,81,192,132,0,0,0,188,2,163,237,35,1,229,3,32,192,131,0,0,0,147,33,
+    164,237,35,0,171,194,135,0,0,133,0,0,0,81,98,192,219,103,0,227,135,134,0,0,1,32,192,220,226,188,237,35,0,171,194,133,0,0,1,32,192,220,226,162,237,35,0,122,
+    193,132,0,0,1,32,192,228,226,162,237,35,1,229,3,49,0,135,0,0,133,0,0,0,81,98,192,219,103,0,227,135,135,0,0,1,57,96,229,2,186,237,35,1,204,130,24,128,
+    134,0,0,1,57,96,229,2,160,237,35,1,179,226,0,32,133,0,0,0,98,33,162,237,35,0,90,1,136,0,0,133,0,0,0,81,98,192,219,103,0,227,135,136,0,0,1,57,
+    96,220,194,184,237,35,1,179,226,24,160,136,0,0,1,57,96,220,194,158,237,35,1,130,225,8,64,135,0,0,1,81,192,228,226,158,237,35,1,229,2,98,33,137,0,0,133,0,
+    0,0,81,99,192,227,167,0,235,199,137,0,0,1,24,128,180,2,181,237,35,1,220,226,114,129,139,0,0,1,24,128,180,2,155,237,35,1,204,130,57,64,138,0,0,1,57,32,
+    212,162,156,237,35,1,220,194,57,64,138,0,0,212,0,0,3,49,32,114,129,171,194,180,2,140,188,2,130,180,2,131,188,2,131,180,2,142,188,2,131,180,2,131,188,2,3,179,
+    226,155,98,90,1,16,64,142,0,0,3,49,32,114,129,171,194,180,2,140,188,2,130,180,2,132,188,2,3,179,226,147,65,73,128,8,32,140,0,0,2,16,96,114,129,196,98,151,
+    237,35,3,229,3,196,66,114,129,16,96,139,0,0,255,0,0,199,0,0,1,24,128,32,192,148,40,224,1,32,192,16,96,142,0,0,255,0,0,239,0,0,255,0,0,239,0,0,
+    // background_ems
+    82,76,240,0,64,1,0,0,0,0,6,0,0,0,12,0,0,0,18,0,0,0,217,0,0,0,58,1,0,0,119,1,0,0,201,1,0,0,27,2,0,0,89,2,0,0,153,2,
+    0,0,67,3,0,0,44,4,0,0,241,4,0,0,31,6,0,0,44,7,0,0,64,8,0,0,60,9,0,0,93,10,0,0,167,11,0,0,213,12,0,0,207,13,0,0,204,14,
+    0,0,246,15,0,0,11,17,0,0,59,18,0,0,88,19,0,0,104,20,0,0,115,21,0,0,137,22,0,0,104,23,0,0,103,24,0,0,109,25,0,0,56,26,0,0,255,26,
+    0,0,197,27,0,0,120,28,0,0,132,29,0,0,163,30,0,0,144,31,0,0,158,32,0,0,177,33,0,0,215,34,0,0,241,35,0,0,18,37,0,0,79,38,0,0,84,39,
+    0,0,91,40,0,0,114,41,0,0,141,42,0,0,155,43,0,0,183,44,0,0,208,45,0,0,249,46,0,0,10,48,0,0,14,49,0,0,27,50,0,0,58,51,0,0,78,52,
+    0,0,12,53,0,0,180,53,0,0,110,54,0,0,45,55,0,0,167,55,0,0,63,56,0,0,69,56,0,0,75,56,0,0,81,56,0,0,22,57,0,0,54,57,0,0,86,57,
+    0,0,120,57,0,0,152,57,0,0,182,57,0,0,212,57,0,0,244,57,0,0,20,58,0,0,122,58,0,0,177,58,0,0,209,58,0,0,241,58,0,0,17,59,0,0,53,59,
+    0,0,172,59,0,0,205,59,0,0,235,59,0,0,11,60,0,0,41,60,0,0,71,60,0,0,250,60,0,0,16,61,0,0,36,61,0,0,58,61,0,0,187,61,0,0,221,61,
+    0,0,1,62,0,0,35,62,0,0,69,62,0,0,103,62,0,0,135,62,0,0,169,62,0,0,201,62,0,0,233,62,0,0,7,63,0,0,37,63,0,0,71,63,0,0,98,63,
+    0,0,128,63,0,0,172,63,0,0,190,63,0,0,210,63,0,0,230,63,0,0,38,64,0,0,70,64,0,0,115,64,0,0,176,64,0,0,225,64,0,0,20,65,0,0,65,65,
+    0,0,110,65,0,0,155,65,0,0,198,65,0,0,241,65,0,0,36,66,0,0,83,66,0,0,127,66,0,0,178,66,0,0,229,66,0,0,32,67,0,0,93,67,0,0,158,67,
+    0,0,217,67,0,0,24,68,0,0,85,68,0,0,146,68,0,0,209,68,0,0,20,69,0,0,89,69,0,0,152,69,0,0,219,69,0,0,22,70,0,0,81,70,0,0,146,70,
+    0,0,211,70,0,0,20,71,0,0,79,71,0,0,142,71,0,0,207,71,0,0,13,72,0,0,78,72,0,0,159,72,0,0,242,72,0,0,79,73,0,0,152,73,0,0,233,73,
+    0,0,58,74,0,0,133,74,0,0,210,74,0,0,27,75,0,0,116,75,0,0,191,75,0,0,8,76,0,0,81,76,0,0,160,76,0,0,235,76,0,0,54,77,0,0,129,77,
+    0,0,206,77,0,0,23,78,0,0,96,78,0,0,169,78,0,0,246,78,0,0,65,79,0,0,138,79,0,0,211,79,0,0,28,80,0,0,103,80,0,0,176,80,0,0,249,80,
+    0,0,68,81,0,0,141,81,0,0,214,81,0,0,29,82,0,0,102,82,0,0,173,82,0,0,240,82,0,0,55,83,0,0,130,83,0,0,211,83,0,0,30,84,0,0,99,84,
+    0,0,170,84,0,0,239,84,0,0,58,85,0,0,131,85,0,0,200,85,0,0,23,86,0,0,100,86,0,0,169,86,0,0,228,86,0,0,33,87,0,0,110,87,0,0,185,87,
+    0,0,4,88,0,0,77,88,0,0,148,88,0,0,221,88,0,0,38,89,0,0,109,89,0,0,184,89,0,0,3,90,0,0,74,90,0,0,149,90,0,0,222,90,0,0,39,91,
+    0,0,108,91,0,0,181,91,0,0,8,92,0,0,81,92,0,0,138,92,0,0,195,92,0,0,248,92,0,0,47,93,0,0,106,93,0,0,191,93,0,0,101,94,0,0,147,94,
+    0,0,194,94,0,0,240,94,0,0,32,95,0,0,80,95,0,0,126,95,0,0,177,95,0,0,226,95,0,0,17,96,0,0,68,96,0,0,121,96,0,0,34,97,0,0,70,97,
+    0,0,106,97,0,0,140,97,0,0,174,97,0,0,208,97,0,0,248,97,0,0,28,98,0,0,62,98,0,0,94,98,0,0,126,98,0,0,162,98,0,0,194,98,0,0,226,98,
+    0,0,3,99,0,0,40,99,0,0,85,99,0,0,119,99,0,0,156,99,0,0,194,99,0,0,233,99,0,0,17,100,0,0,65,100,0,0,113,100,0,0,41,101,0,0,64,101,
+    0,0,92,101,0,0,208,101,0,0,77,102,0,0,120,102,0,0,161,102,0,0,202,102,0,0,243,102,0,0,28,103,0,0,69,103,0,0,112,103,0,0,157,103,0,0,202,103,
+    0,0,243,103,0,0,30,104,0,0,147,104,0,0,176,104,0,0,213,104,0,0,244,104,0,0,17,105,0,0,46,105,0,0,75,105,0,0,106,105,0,0,135,105,0,0,78,106,
+    0,0,125,106,0,0,168,106,0,0,209,106,0,0,250,106,0,0,39,107,0,0,82,107,0,0,123,107,0,0,163,107,0,0,208,107,0,0,5,108,0,0,129,108,0,0,162,108,
+    0,0,195,108,0,0,10,109,0,0,163,109,0,0,195,109,0,0,229,109,0,0,5,110,0,0,39,110,0,0,75,110,0,0,111,110,0,0,143,110,0,0,181,110,0,0,213,110,
+    0,0,249,110,0,0,31,111,0,0,67,111,0,0,107,111,0,0,145,111,0,0,52,112,0,0,32,113,0,0,38,113,0,0,44,113,0,0,255,0,0,239,0,0,255,0,0,239,
+    0,0,255,0,0,239,0,0,146,0,0,0,40,128,195,48,160,0,40,128,131,0,0,10,72,199,80,232,72,232,72,232,80,232,80,232,80,233,80,233,81,9,81,9,89,9,132,89,
+    10,0,89,42,131,89,10,8,89,11,89,10,89,10,89,43,89,43,89,11,89,43,89,11,89,43,136,89,11,0,89,10,137,89,11,3,89,43,89,11,89,11,89,43,130,89,11,132,
+    89,43,129,89,44,2,89,43,89,44,89,44,133,89,43,131,89,11,129,89,10,6,89,11,89,10,89,42,89,10,89,10,89,11,89,11,130,89,10,129,89,42,130,89,10,130,89,42,
+    11,89,10,89,42,89,10,89,42,89,10,89,10,89,42,89,10,89,42,89,10,89,10,89,42,130,89,10,0,97,10,130,97,42,0,97,10,133,97,42,0,105,42,130,105,43,129,105,
+    42,4,97,42,89,9,72,232,48,165,16,33,140,0,0,141,0,0,4,8,0,80,224,145,129,202,33,234,129,139,226,97,129,226,65,136,226,97,0,226,65,134,226,97,0,226,65,135,
+    226,97,0,226,65,136,226,97,129,226,65,134,226,97,131,226,65,133,226,97,0,234,97,130,0,0,0,40,132,136,121,108,138,121,109,161,121,110,134,121,111,131,121,143,132,121,111,142,
+    121,110,154,121,109,149,121,108,1,97,42,40,100,138,0,0,140,0,0,1,89,0,210,97,201,226,97,130,0,0,0,48,133,136,121,108,136,121,109,163,121,110,144,121,111,146,121,110,
+    1,121,109,121,110,151,121,109,130,121,108,138,121,76,131,121,108,3,121,76,121,108,89,9,8,0,136,0,0,138,0,0,2,24,64,169,225,226,129,201,226,97,0,226,98,130,0,0,
+    0,56,165,132,121,108,0,121,76,130,121,108,136,121,109,162,121,110,145,121,111,148,121,110,2,121,109,121,110,121,109,132,121,110,144,121,109,131,121,108,132,121,76,0,121,108,130,121,
+    76,129,121,108,132,121,76,1,121,108,32,99,135,0,0,137,0,0,1,80,224,218,65,204,226,97,130,0,0,0,56,165,133,121,108,2,121,76,121,108,121,108,136,121,109,163,121,110,
+    143,121,111,158,121,110,145,121,109,7,121,108,121,76,121,108,121,108,121,76,121,108,121,76,121,108,130,121,76,130,121,108,129,121,76,4,121,108,121,76,121,108,121,108,40,132,134,0,
+    0,136,0,0,0,121,96,205,226,97,0,226,98,130,0,0,0,56,165,136,121,108,135,121,109,147,121,110,0,121,111,143,121,110,142,121,111,161,121,110,145,121,109,139,121,108,1,121,
+    76,121,108,130,121,76,129,121,108,0,24,67,133,0,0,135,0,0,1,105,32,234,129,205,226,97,0,226,98,130,0,0,0,56,165,136,121,108,135,121,109,144,121,110,134,121,111,140,
+    121,110,139,121,111,166,121,110,0,121,109,136,121,110,135,121,109,139,121,108,131,121,76,1,121,108,113,75,133,0,0,134,0,0,1,32,64,226,129,206,226,97,0,234,98,130,0,0,
+    0,48,165,135,121,108,135,121,109,143,121,110,135,121,111,0,121,110,132,121,78,6,113,78,121,78,121,78,113,78,121,78,121,110,121,110,131,121,78,129,121,110,0,121,79,132,121,111,
+    132,121,110,6,121,78,113,13,130,15,146,144,138,80,113,45,121,78,131,121,110,0,121,78,137,113,45,1,113,77,121,110,132,113,45,131,121,110,3,113,45,113,13,113,13,113,77,132,
+    121,110,5,113,45,129,239,155,17,155,50,138,80,113,45,130,121,109,0,113,45,130,113,44,5,113,76,121,108,121,109,121,108,121,108,121,76,131,113,11,129,121,76,4,121,108,121,76,
+    121,108,121,108,32,99,132,0,0,134,0,0,0,169,193,207,226,97,0,234,98,130,0,0,0,56,165,134,121,108,2,121,109,138,79,196,245,134,197,21,9,197,22,188,181,121,77,121,
+    78,180,84,196,245,196,245,196,213,196,245,171,243,131,121,110,0,129,240,131,196,246,9,197,22,146,145,121,111,121,111,163,83,205,87,205,87,205,119,205,87,205,87,131,205,119,5,171,
+    244,121,110,121,110,171,244,205,87,205,87,130,205,86,4,205,87,197,22,180,52,146,145,113,78,133,121,110,7,180,84,230,121,230,185,230,153,230,185,230,185,197,22,129,239,130,121,110,
+    1,138,80,213,248,135,213,215,3,222,24,121,110,121,110,171,243,130,213,248,8,188,213,121,78,121,110,121,110,113,13,213,183,213,215,213,215,146,177,130,121,110,11,121,78,163,82,221,
+    248,238,185,230,153,230,153,238,185,230,121,172,19,121,77,121,109,163,114,130,213,215,0,172,19,131,121,109,5,146,143,221,247,221,247,222,24,205,54,121,76,132,121,108,0,64,198,132,
+    0,0,133,0,0,0,72,192,208,226,97,4,234,97,16,32,0,0,0,0,48,165,134,121,108,1,121,109,146,176,136,230,153,3,222,88,113,45,121,78,213,151,131,230,153,5,222,56,
+    113,13,121,110,121,110,121,111,155,50,132,230,153,3,163,83,121,111,121,111,171,244,136,230,153,3,188,181,121,110,121,110,188,181,136,230,153,6,196,246,113,78,113,78,121,78,121,110,
+    121,110,213,183,134,230,153,5,230,121,130,15,121,110,121,110,138,112,230,185,135,230,153,3,238,217,121,142,121,110,180,84,130,230,153,8,230,185,121,142,121,110,121,110,113,13,222,88,
+    230,153,230,153,154,241,130,121,110,0,163,147,135,230,153,7,180,84,121,77,121,174,230,185,230,153,230,153,222,56,113,76,130,121,109,4,180,84,230,121,230,153,230,121,163,146,133,121,
+    108,0,80,232,132,0,0,133,0,0,0,194,1,145,226,97,130,234,129,6,226,97,210,65,210,33,210,65,210,65,202,33,194,1,134,186,1,0,177,225,134,186,1,1,177,225,194,1,
+    134,186,1,2,177,225,202,33,194,33,134,186,1,6,177,225,169,193,169,193,161,161,153,161,153,161,145,161,131,145,129,0,137,129,130,129,97,4,129,65,121,65,129,65,129,97,129,97,
+    130,0,0,0,48,165,134,121,108,1,121,109,146,176,130,230,153,133,230,121,3,222,56,113,45,121,78,213,151,131,230,153,0,238,217,131,121,110,0,180,20,132,230,153,3,163,115,121,
+    111,121,111,171,244,131,230,153,130,230,121,129,230,153,3,188,181,121,110,121,110,188,181,130,230,153,2,238,218,238,217,230,185,131,230,153,4,155,50,113,78,113,78,121,78,171,243,130,
+    230,153,2,213,215,180,116,213,151,130,230,153,4,197,22,113,78,121,110,138,80,230,185,132,230,153,129,230,185,4,230,153,238,217,121,142,121,110,180,84,131,230,153,10,155,50,113,78,
+    121,110,105,13,222,88,230,153,230,153,154,241,121,110,121,110,121,111,131,230,153,1,188,149,180,117,130,230,153,3,230,185,130,15,113,77,188,116,130,230,153,8,138,111,121,109,121,109,
+    113,44,222,24,230,153,230,121,230,121,121,109,133,121,108,0,89,9,132,0,0,132,0,0,0,72,192,144,226,97,2,129,97,40,128,16,32,193,0,0,0,48,133,133,121,108,129,121,
+    109,0,146,176,130,230,153,0,180,116,130,155,49,129,155,17,15,146,241,113,77,113,78,205,151,230,153,230,153,221,248,230,185,230,153,146,241,113,78,121,110,113,78,197,54,230,153,230,
+    121,130,230,153,3,163,115,113,111,121,111,171,244,130,230,153,0,163,146,131,146,209,11,146,177,138,48,113,110,121,110,188,181,230,153,230,153,213,183,104,237,105,13,130,15,205,118,130,
+    230,153,21,196,246,113,78,113,78,113,46,222,56,230,153,230,153,197,54,113,45,113,110,113,77,213,215,230,153,230,153,230,185,121,110,121,110,138,80,230,185,230,153,230,153,180,116,130,
+    138,80,5,138,79,138,47,138,80,121,110,121,110,180,84,131,230,153,10,196,213,113,78,121,110,105,13,222,88,230,153,230,153,146,242,121,111,121,111,155,82,130,230,153,3,171,212,113,
+    111,113,111,163,147,130,230,153,2,171,211,113,78,121,174,130,230,153,8,180,51,121,109,121,109,138,79,230,185,230,153,230,153,180,116,121,109,131,121,108,2,121,76,121,108,89,9,132,
+    0,0,132,0,0,0,161,193,142,226,97,1,202,33,32,64,196,0,0,0,48,133,133,121,108,129,121,109,0,146,176,130,230,153,2,155,49,121,109,113,77,131,113,109,67,121,109,113,
+    77,205,151,230,153,230,153,197,54,230,153,230,153,172,20,113,78,113,78,113,46,222,56,230,153,213,183,230,89,230,153,230,153,163,147,113,78,121,78,171,244,230,153,230,153,230,185,138,
+    80,113,78,113,77,113,78,113,77,113,78,113,78,113,110,121,110,188,181,230,153,230,153,213,183,113,45,113,77,113,77,129,239,230,185,230,153,230,153,213,183,113,46,113,78,138,48,230,
+    185,230,153,230,153,146,209,113,77,113,77,113,110,172,19,230,153,230,153,230,185,138,112,113,110,138,80,230,185,230,153,230,153,171,211,113,78,132,113,77,2,113,78,113,110,180,84,131,
+    230,153,36,230,121,113,46,113,78,105,13,222,88,230,153,230,153,146,242,121,111,121,111,180,85,230,153,230,153,238,217,129,240,113,111,113,111,121,208,238,185,230,153,230,153,188,181,113,
+    78,113,77,196,245,230,153,230,153,213,247,113,44,113,77,171,243,230,153,230,153,230,185,138,79,121,109,121,109,132,121,108,0,89,9,132,0,0,132,0,0,0,210,97,141,226,97,1,
+    194,1,24,64,197,0,0,0,48,133,132,121,108,130,121,109,0,146,176,130,230,153,0,155,49,133,113,77,14,113,109,113,77,205,151,230,153,230,153,197,54,205,151,230,153,205,86,113,
+    45,113,78,121,142,238,185,230,153,188,181,130,230,153,3,163,147,113,78,113,78,171,212,130,230,153,0,138,80,133,113,77,9,113,78,121,110,188,181,230,153,230,153,213,183,105,45,113,
+    77,113,77,105,13,130,230,153,7,213,215,113,46,121,78,163,147,230,153,230,153,230,185,121,110,130,113,77,10,163,82,238,217,238,185,238,185,154,241,113,78,138,80,230,185,230,153,230,
+    153,171,211,133,113,77,17,113,78,113,110,180,84,230,153,230,153,230,121,230,153,230,153,138,144,113,78,105,13,222,88,230,153,230,153,146,242,121,111,121,111,196,246,130,230,153,3,113,
+    47,113,111,113,111,113,46,130,230,153,14,197,54,121,110,113,109,155,17,230,153,230,153,238,185,129,238,113,76,205,118,230,153,230,153,213,151,113,76,113,109,133,121,108,0,89,9,132,
+    0,0,131,0,0,1,16,32,234,129,140,226,97,1,194,33,8,32,131,0,0,1,16,0,32,64,131,40,64,129,40,96,174,48,96,129,56,96,1,64,129,72,129,131,72,161,0,56,
+    128,130,0,0,0,48,133,131,121,108,131,121,109,4,146,176,230,121,230,153,230,153,155,49,135,113,77,19,205,151,230,153,230,153,205,86,188,148,230,153,230,153,113,45,113,78,146,177,
+    230,153,230,121,163,179,230,185,230,153,230,153,163,179,113,78,113,78,171,211,130,230,153,0,138,80,134,113,77,8,113,78,188,181,230,153,230,153,213,183,113,13,113,77,113,77,105,13,
+    130,230,153,7,197,54,113,78,113,78,188,149,230,153,230,153,222,88,105,13,130,113,77,10,113,78,121,78,121,78,113,78,113,78,113,110,138,80,230,185,230,153,230,153,171,211,134,113,
+    77,43,113,110,180,84,230,153,230,153,205,151,213,248,230,153,180,52,113,78,105,13,222,88,230,153,230,153,146,242,121,111,113,79,213,183,230,153,230,153,213,216,113,79,113,111,113,111,
+    113,79,171,244,172,20,172,20,163,114,113,78,113,109,113,77,222,88,230,153,230,153,180,52,121,174,230,185,230,153,230,185,138,175,113,108,113,108,121,108,121,109,131,121,108,0,89,9,
+    132,0,0,131,0,0,0,40,128,140,226,97,1,234,98,48,128,130,0,0,3,104,193,193,131,209,163,201,163,130,201,131,0,201,163,134,201,131,0,201,130,143,201,131,0,201,130,136,
+    201,131,0,201,130,135,201,131,1,193,131,193,130,131,201,131,129,201,130,133,193,130,4,209,163,24,32,0,0,0,0,48,133,130,121,108,132,121,109,4,146,176,230,121,230,153,230,153,
+    155,49,131,113,77,16,113,109,121,110,113,110,113,78,205,119,230,153,230,153,197,54,163,146,230,153,230,185,130,15,113,77,171,179,230,153,230,153,138,145,130,230,153,7,171,212,113,78,
+    113,78,171,211,230,153,230,153,230,185,138,80,133,113,77,64,113,78,121,78,188,181,230,153,230,153,213,183,113,13,113,77,113,77,138,80,230,185,230,153,230,153,171,243,113,78,113,78,
+    197,54,230,153,230,153,213,215,113,45,113,77,113,77,113,78,121,110,121,110,113,78,113,78,113,77,113,77,138,80,230,185,230,153,230,153,171,211,113,109,113,77,113,77,113,109,113,110,
+    113,78,113,78,113,110,180,84,230,153,230,153,213,183,180,84,230,153,222,24,113,46,105,13,222,88,230,153,230,153,146,242,121,111,113,47,213,248,230,153,230,153,205,87,113,79,113,111,
+    113,111,130,121,111,1,113,110,113,78,130,113,77,10,172,19,230,153,230,153,222,88,155,113,230,121,230,121,213,183,113,44,113,76,113,76,133,121,108,0,89,9,132,0,0,131,0,0,
+    1,48,160,226,98,139,226,97,0,177,225,130,0,0,2,96,193,201,131,201,131,130,201,130,0,201,131,186,201,130,6,201,131,48,96,0,0,0,0,48,133,121,108,121,108,133,121,109,
+    5,146,176,230,121,230,153,230,153,188,213,171,211,131,171,243,15,138,112,121,110,113,78,205,119,230,153,230,153,197,86,138,112,230,153,230,153,155,82,113,78,188,181,230,153,238,218,113,
+    110,130,230,153,3,171,212,113,79,113,78,171,211,130,230,153,1,188,213,180,116,130,180,84,21,180,117,129,207,113,110,121,110,188,181,230,153,230,153,213,248,130,47,130,79,155,50,222,
+    24,230,153,230,153,230,121,121,174,113,78,113,46,205,151,230,153,230,153,205,151,130,113,77,11,113,78,121,78,121,78,121,110,113,78,113,77,113,77,138,80,230,185,230,153,230,153,205,
+    183,130,188,149,129,188,181,22,155,18,113,110,121,110,180,85,230,153,230,153,213,183,138,145,230,153,230,153,138,48,105,13,222,88,230,153,230,153,146,242,121,111,113,79,222,24,230,153,
+    230,153,197,22,113,112,130,121,112,3,121,111,113,111,113,110,113,78,130,113,77,7,129,239,230,185,230,153,230,153,222,24,230,153,230,153,155,81,130,113,76,6,121,108,121,109,121,108,
+    121,108,121,76,121,108,89,9,132,0,0,131,0,0,0,48,160,140,226,97,0,121,64,130,0,0,8,161,66,201,130,201,130,201,131,201,130,201,131,201,130,201,130,201,131,178,201,130,
+    0,201,131,132,201,130,5,201,131,48,96,0,0,0,0,48,133,121,108,134,121,109,1,146,176,230,121,135,230,153,15,171,179,121,110,121,78,205,119,230,153,230,153,197,54,121,110,238,
+    217,230,153,180,52,113,45,213,183,230,153,222,89,104,205,130,230,153,3,171,212,113,110,113,110,171,211,135,230,153,4,230,185,130,15,121,78,121,110,188,181,136,230,153,10,146,209,113,
+    78,113,78,113,46,213,183,230,153,230,153,205,118,113,77,113,77,163,114,132,188,213,3,138,112,113,110,138,80,230,185,135,230,153,22,172,20,113,78,113,110,180,84,230,153,230,153,213,
+    183,113,14,230,153,230,153,171,179,105,13,222,88,230,153,230,153,146,242,121,111,113,79,222,24,230,153,230,153,196,246,113,112,131,121,112,0,113,111,131,113,78,2,113,109,113,77,205,
+    118,132,230,153,131,113,76,1,121,108,121,109,131,121,108,0,80,232,132,0,0,131,0,0,0,48,160,140,226,97,0,89,0,130,0,0,0,177,98,159,201,130,0,201,131,136,201,130,
+    0,201,131,149,201,130,5,201,131,48,96,0,0,0,0,48,133,121,108,134,121,109,1,146,176,230,121,135,230,153,15,171,179,121,110,121,78,205,119,230,153,230,153,197,54,105,13,222,
+    56,230,153,197,22,113,45,230,153,230,153,196,246,105,14,130,230,153,3,171,244,113,110,113,78,171,211,135,230,153,4,230,185,130,47,113,78,121,110,188,181,134,230,153,12,230,121,163,
+    211,113,110,113,78,113,77,113,45,213,215,230,153,230,153,205,118,113,77,113,77,188,149,131,230,153,4,230,121,155,17,113,110,138,80,230,185,135,230,153,22,172,20,113,78,113,110,180,
+    84,230,153,230,153,213,183,113,46,196,246,230,153,205,86,104,237,222,88,230,153,230,153,146,242,121,111,113,79,221,248,230,153,230,153,196,246,113,112,131,121,112,7,121,111,113,111,113,
+    110,113,78,113,110,113,110,113,78,163,146,131,230,153,0,188,180,131,113,76,1,121,108,121,109,131,121,108,0,80,232,132,0,0,131,0,0,0,48,160,140,226,97,0,80,224,130,0,
+    0,1,193,162,201,131,130,201,130,0,201,131,141,201,130,0,201,131,134,201,130,0,201,131,135,201,130,0,201,131,136,201,130,2,201,131,201,130,201,131,144,201,130,4,48,96,0,0,
+    0,0,48,133,121,108,134,121,109,4,146,176,230,121,230,153,230,153,205,118,132,188,149,15,146,177,121,110,121,78,205,119,230,153,230,153,197,54,113,77,196,245,230,153,222,24,129,239,
+    230,185,230,153,163,147,105,14,130,230,153,3,171,244,113,79,113,78,171,211,130,230,153,0,188,213,132,180,84,9,121,206,113,78,121,78,188,181,230,153,230,153,222,88,188,181,188,213,
+    213,215,130,230,153,12,213,247,113,77,113,77,113,45,213,247,230,153,230,153,205,151,113,45,113,77,188,149,238,185,238,185,130,230,153,8,155,17,113,110,138,48,230,185,230,153,230,153,
+    197,54,163,211,163,211,130,171,211,22,138,145,113,78,113,111,180,85,230,153,230,153,213,215,113,46,163,114,230,153,230,185,113,78,222,88,230,153,230,153,146,242,121,111,113,79,213,248,
+    230,153,230,153,197,23,113,80,132,121,112,130,121,111,0,121,110,130,113,110,131,230,153,0,138,143,130,113,76,129,121,108,129,121,109,130,121,108,0,80,232,132,0,0,131,0,0,0,
+    48,160,140,226,97,0,89,0,130,0,0,0,201,163,192,201,130,5,193,130,48,96,0,0,0,0,48,133,121,108,134,121,109,6,146,176,230,121,230,153,230,153,155,82,113,109,113,109,
+    131,113,110,14,121,110,113,78,205,119,230,153,230,153,205,86,113,77,171,243,230,153,230,185,155,82,230,153,238,185,129,239,105,14,130,230,153,3,172,20,113,79,113,79,171,211,130,230,
+    153,0,138,80,133,113,77,9,113,78,121,110,188,181,230,153,230,153,213,183,113,45,113,78,113,45,188,213,130,230,153,25,155,50,113,78,113,46,213,215,230,153,230,153,213,215,113,45,
+    113,78,121,174,129,239,138,144,230,185,230,153,230,153,155,17,113,110,138,80,230,185,230,153,230,153,171,211,113,78,113,110,113,78,113,110,130,113,78,20,121,111,180,85,230,153,230,153,
+    213,184,113,46,121,143,230,185,230,153,163,179,222,88,230,153,230,153,146,242,121,111,113,79,213,215,230,153,230,153,205,87,113,80,130,121,112,13,138,82,138,146,138,113,138,49,121,111,
+    121,111,121,110,113,110,121,78,196,245,230,153,230,153,230,121,105,12,130,113,76,131,121,109,130,121,108,0,80,232,132,0,0,131,0,0,0,48,160,140,226,97,0,89,0,130,0,0,
+    0,201,163,140,201,130,0,201,131,134,201,130,0,201,131,135,201,130,0,201,131,136,201,130,0,201,131,151,201,130,5,193,130,48,96,0,0,0,0,48,133,121,108,134,121,109,0,146,
+    176,130,230,153,2,155,82,113,77,113,109,131,113,110,14,121,110,113,79,205,119,230,153,230,153,205,86,113,77,146,241,230,153,230,153,197,86,230,153,230,89,105,13,105,14,130,230,153,
+    3,172,20,113,79,113,79,171,211,130,230,153,0,138,80,133,113,77,9,113,78,121,110,188,181,230,153,230,153,213,183,113,45,113,78,113,77,146,241,130,230,153,58,180,52,113,78,113,
+    78,205,119,230,153,230,153,222,56,113,45,113,78,121,110,113,110,130,15,230,185,230,153,230,153,155,17,113,110,138,80,230,185,230,153,230,153,171,243,113,78,113,78,113,110,113,110,113,
+    78,113,78,113,111,121,111,180,85,230,153,230,153,213,215,113,46,113,78,205,86,230,153,213,215,222,56,230,153,230,153,146,242,113,111,113,111,205,119,230,153,230,153,213,216,113,48,121,
+    112,121,112,113,80,213,151,230,153,230,153,213,183,113,79,121,111,130,121,110,7,188,213,230,153,230,153,230,121,105,12,113,76,113,76,113,77,131,121,109,130,121,108,0,80,232,132,0,
+    0,131,0,0,0,48,160,140,226,97,0,97,0,130,0,0,0,209,163,141,201,130,0,201,131,134,201,130,0,201,131,135,201,130,0,201,131,136,201,130,0,201,131,150,201,130,5,193,
+    131,48,96,0,0,0,0,48,133,121,108,134,121,109,0,146,176,130,230,153,2,155,82,113,110,113,77,130,113,110,129,121,111,13,121,79,205,119,230,153,230,153,205,86,113,77,121,238,
+    238,217,230,153,230,121,230,153,205,86,113,78,105,14,130,230,153,3,172,52,113,111,113,79,171,179,130,230,153,0,138,80,133,113,77,16,113,78,113,110,188,181,230,153,230,153,213,215,
+    105,45,113,78,113,78,130,47,230,185,230,153,230,153,180,117,113,78,113,78,196,245,130,230,153,0,113,45,130,113,78,0,138,48,130,230,153,6,155,17,113,110,138,80,230,185,230,153,
+    230,153,171,243,132,113,78,9,113,111,121,111,121,112,180,85,230,153,230,153,213,183,113,78,113,78,171,179,132,230,153,3,146,210,113,111,121,111,196,246,130,230,153,9,113,47,121,112,
+    121,112,113,47,222,24,230,153,230,153,205,151,113,78,121,111,130,121,110,6,188,213,230,153,230,153,230,121,105,12,113,76,113,109,132,121,109,130,121,108,0,80,232,132,0,0,131,0,
+    0,0,48,160,140,226,97,0,105,32,130,0,0,0,209,163,139,201,130,0,201,131,179,201,130,5,193,131,48,96,0,0,0,0,48,133,121,108,134,121,109,0,146,176,130,230,153,4,
+    155,82,113,78,113,78,113,110,113,110,131,121,111,5,205,119,230,153,230,153,205,86,113,77,113,45,131,230,153,2,180,84,113,110,105,14,130,230,153,3,180,52,113,111,113,79,171,179,
+    130,230,153,0,138,80,132,113,77,129,113,78,23,121,111,188,181,230,153,230,153,213,215,113,46,113,78,113,78,129,239,230,185,230,153,230,153,188,149,113,78,113,78,180,52,230,153,230,
+    153,230,185,130,15,113,78,113,110,113,78,146,209,130,230,153,6,147,17,113,110,138,80,230,185,230,153,230,153,171,243,130,113,78,129,113,110,10,113,111,121,111,121,112,180,85,230,153,
+    230,153,213,184,113,46,113,78,130,16,230,185,131,230,153,16,146,210,113,111,113,111,180,85,230,153,230,153,238,217,129,241,121,112,121,112,113,79,230,185,230,153,230,153,196,246,113,110,
+    113,110,130,121,110,5,188,213,230,153,230,153,230,121,105,12,113,109,134,121,109,129,121,108,0,80,232,132,0,0,131,0,0,0,48,160,140,226,97,0,105,32,130,0,0,0,209,163,
+    184,201,130,129,201,131,133,201,130,4,193,131,48,96,0,0,0,0,48,133,135,121,109,0,146,176,130,230,153,2,155,50,113,45,113,45,131,113,46,8,121,111,121,79,205,119,230,153,
+    230,153,205,86,113,77,113,45,205,86,130,230,153,9,155,82,113,78,105,14,230,121,230,153,230,153,180,52,113,111,113,79,171,180,130,230,153,0,130,47,132,105,13,17,113,46,121,79,
+    121,111,188,181,230,153,230,153,213,215,105,14,113,78,113,78,121,207,238,217,230,153,230,153,188,213,113,78,113,78,146,209,130,230,153,0,180,84,130,113,78,0,188,149,130,230,153,6,
+    147,17,113,110,138,48,238,185,230,153,230,153,163,211,131,113,46,11,113,78,113,79,121,79,121,112,180,85,230,153,230,153,213,184,113,46,113,110,113,46,213,248,131,230,153,3,146,242,
+    113,111,113,111,155,19,130,230,153,3,171,244,121,112,113,112,154,242,130,230,153,2,171,244,113,78,113,110,130,121,110,6,188,213,230,153,230,153,230,121,105,12,113,109,113,109,134,121,
+    109,1,121,108,80,232,132,0,0,131,0,0,0,48,192,140,226,97,0,113,33,130,0,0,0,209,163,132,201,130,2,201,131,201,130,201,131,184,201,130,5,193,130,48,96,0,0,0,
+    0,48,133,121,108,134,121,109,0,146,176,130,230,153,28,222,56,213,216,213,248,213,248,221,248,213,248,222,24,138,81,121,111,205,119,230,153,230,153,205,86,113,77,113,77,171,211,230,
+    153,230,153,230,185,130,16,113,78,105,14,230,121,230,153,230,153,180,53,113,111,113,79,171,180,130,230,153,0,238,185,130,238,218,129,238,217,18,222,89,113,46,121,111,188,181,230,153,
+    230,153,213,216,113,14,113,78,113,78,113,79,238,217,230,153,230,153,197,22,113,78,113,78,113,46,222,88,130,230,153,2,197,22,171,243,196,245,131,230,153,6,147,17,113,110,138,48,
+    238,185,230,153,230,153,230,185,133,238,218,9,163,83,121,112,180,85,230,153,230,153,213,215,113,46,113,78,113,110,180,52,131,230,153,4,146,242,113,111,113,112,121,112,230,121,130,230,
+    153,8,188,181,180,85,230,89,230,153,230,153,230,185,130,16,113,78,113,110,130,121,110,5,188,213,230,153,230,153,230,121,105,44,113,109,135,121,109,1,121,108,80,232,132,0,0,131,
+    0,0,0,48,160,140,226,97,0,113,33,130,0,0,0,209,163,192,201,130,4,193,131,48,96,0,0,0,0,48,133,135,121,109,0,146,176,136,230,153,22,230,185,138,80,113,111,205,
+    119,230,153,230,153,205,54,113,77,113,77,138,112,230,185,230,153,230,153,113,46,113,78,105,14,230,121,230,153,230,153,180,53,113,79,113,79,171,180,136,230,153,14,222,56,113,15,121,
+    111,188,182,230,153,230,153,213,216,113,14,113,78,113,79,113,14,230,185,230,153,230,153,205,119,130,113,78,0,155,50,134,230,153,6,214,24,230,153,230,153,147,17,113,110,138,48,230,
+    185,136,230,153,10,155,83,113,111,180,85,230,153,230,153,213,215,113,46,113,78,113,78,138,112,230,185,130,230,153,4,146,242,113,111,113,112,121,112,155,19,135,230,153,3,180,117,113,
+    78,113,78,113,110,130,121,110,5,188,213,230,153,230,153,230,121,105,44,113,109,136,121,109,0,81,8,132,0,0,131,0,0,0,48,160,140,226,97,0,129,97,130,0,0,0,209,163,
+    165,201,130,0,201,131,145,201,130,0,201,131,134,201,130,5,193,131,48,96,0,0,0,0,48,133,121,108,134,121,109,0,146,176,136,230,121,15,230,153,138,80,121,78,205,86,230,121,
+    230,121,197,54,113,77,113,77,113,45,230,153,230,121,205,151,113,46,113,79,113,15,130,230,121,3,180,53,113,111,113,80,171,180,131,230,121,132,230,153,15,222,56,113,15,121,111,188,
+    182,230,153,230,153,213,184,113,14,113,79,113,79,113,46,222,24,230,121,230,153,230,121,113,110,130,113,78,13,171,244,230,185,230,121,230,153,230,121,230,153,196,246,138,177,230,153,230,
+    121,155,18,113,110,138,80,238,250,136,238,217,20,163,115,121,111,180,85,238,218,238,218,213,248,113,46,113,110,113,78,113,46,230,153,238,218,238,218,238,217,146,242,113,111,113,112,121,
+    112,121,112,163,116,230,185,131,230,153,2,238,185,188,181,113,79,130,113,78,130,121,110,5,188,245,230,185,230,185,230,121,105,44,113,109,136,121,109,0,80,232,132,0,0,131,0,0,
+    0,48,160,140,226,97,0,129,97,130,0,0,0,209,163,192,201,130,5,193,131,48,96,0,0,0,0,48,133,121,108,134,121,109,1,129,206,163,81,131,155,81,132,155,49,14,121,174,
+    113,78,146,145,155,17,147,17,138,144,113,77,113,77,113,45,146,241,147,17,138,113,113,111,113,79,113,79,130,146,210,8,130,49,113,79,113,80,130,17,146,210,146,178,138,178,138,177,
+    138,177,130,138,145,12,138,177,138,145,113,79,113,79,138,49,146,178,146,178,138,114,113,79,113,111,113,79,113,79,138,81,130,138,145,18,121,175,113,78,113,79,113,79,113,78,130,16,
+    163,115,163,179,163,147,138,112,113,46,113,110,146,242,146,241,121,207,113,110,121,111,130,16,130,16,132,129,239,8,121,239,121,207,129,207,121,143,113,79,121,143,121,207,121,207,121,175,
+    131,113,78,5,121,174,121,207,121,207,121,175,113,111,113,111,132,121,112,9,146,210,163,147,163,147,155,18,121,208,113,79,113,111,113,110,113,78,113,78,130,121,110,6,129,239,138,80,
+    138,79,138,79,113,77,113,109,113,109,135,121,109,0,80,232,132,0,0,131,0,0,1,48,160,226,98,139,226,97,0,121,97,130,0,0,0,209,163,131,201,130,0,201,131,132,201,130,
+    0,201,131,169,201,130,0,201,131,138,201,130,4,193,131,48,96,0,0,0,0,48,133,137,121,109,137,113,77,0,113,110,130,121,110,12,113,109,113,77,113,77,113,78,121,110,113,78,
+    113,78,113,111,113,111,121,112,121,112,113,112,113,112,132,113,80,138,113,79,0,113,80,130,113,112,132,113,111,0,113,79,131,113,78,130,113,111,131,113,79,9,113,111,113,79,113,78,
+    113,111,113,110,113,78,113,110,113,111,113,111,113,110,137,113,78,1,121,78,121,110,134,113,78,5,113,110,113,78,113,78,113,110,113,111,113,112,132,121,112,0,113,112,132,113,111,129,
+    113,78,0,113,110,131,121,110,5,113,110,113,109,113,109,113,77,113,109,113,109,135,121,109,0,80,232,132,0,0,131,0,0,0,48,160,140,226,97,0,129,97,130,0,0,0,201,163,
+    134,201,130,0,201,131,143,201,130,0,201,131,135,201,130,0,201,131,136,201,130,0,201,131,148,201,130,5,193,130,48,96,0,0,0,0,48,133,121,108,136,121,109,130,113,77,2,113,
+    76,113,77,113,76,131,113,77,0,113,110,130,121,110,130,113,77,5,113,78,121,110,113,110,113,110,113,111,113,111,131,121,112,130,113,112,2,121,112,113,80,113,80,138,113,79,134,113,
+    112,2,113,111,113,79,113,111,130,113,78,1,113,111,121,111,136,113,111,130,113,110,129,113,111,1,113,79,113,110,137,113,78,0,113,110,137,113,78,1,113,110,113,111,133,121,112,129,
+    113,111,0,113,79,130,113,111,129,113,78,0,113,110,131,121,110,4,113,110,113,109,113,109,113,77,113,77,136,121,109,0,81,8,132,0,0,131,0,0,0,48,160,140,226,97,0,129,
+    97,130,0,0,0,201,163,141,201,130,130,201,131,132,201,130,130,201,131,133,201,130,130,201,131,134,201,130,130,201,131,142,201,130,0,201,131,132,201,130,5,193,130,48,96,0,0,0,
+    0,48,133,121,108,136,121,109,1,121,77,113,77,131,113,76,131,113,77,0,113,110,130,121,110,130,113,77,3,121,78,121,110,113,110,113,110,130,113,111,129,121,112,129,121,113,131,121,
+    112,0,113,112,137,113,79,0,113,80,132,113,112,129,121,112,0,113,112,131,113,111,5,113,79,121,111,121,111,121,112,121,112,113,111,130,113,112,137,113,111,143,113,78,130,113,110,129,
+    113,78,1,113,79,113,111,133,121,112,0,113,112,132,113,111,3,113,79,113,111,121,111,121,111,131,121,110,0,113,110,130,113,109,136,121,109,0,81,8,132,0,0,131,0,0,0,48,
+    192,140,226,97,0,129,97,130,0,0,0,209,163,192,201,130,5,193,131,48,96,0,0,0,0,40,133,121,108,137,121,109,135,113,77,0,113,109,131,121,110,130,113,77,0,121,77,130,
+    121,110,129,121,111,129,121,112,133,121,113,2,121,112,113,80,113,80,135,113,79,5,113,80,113,112,113,80,121,113,113,112,113,112,130,121,112,129,113,112,131,113,111,0,121,111,131,121,
+    112,4,113,112,121,112,121,112,113,112,113,112,131,113,111,130,121,111,1,113,111,121,111,130,113,111,0,113,110,138,113,78,129,121,110,0,113,110,130,113,111,0,121,111,133,121,112,0,
+    113,112,134,113,111,2,121,111,121,110,113,110,130,121,110,0,113,110,130,113,109,136,121,109,0,81,9,132,0,0,131,0,0,0,48,160,140,226,97,0,129,97,130,0,0,0,209,163,
+    135,201,130,0,201,131,135,201,130,0,201,131,134,201,130,0,201,131,135,201,130,0,201,131,136,201,130,0,201,131,139,201,130,0,201,131,134,201,130,5,193,131,48,96,0,0,0,0,
+    40,133,121,108,136,121,109,9,121,77,121,141,146,208,163,114,163,114,155,17,121,141,113,77,121,109,121,109,132,121,110,129,113,109,0,121,109,130,121,110,2,121,111,121,144,121,144,132,
+    121,113,130,121,145,7,113,80,121,112,113,80,113,80,121,112,121,144,121,144,121,112,130,113,80,130,121,145,133,121,177,129,121,144,4,121,112,113,112,121,111,113,47,113,48,132,113,80,
+    0,113,48,131,121,112,0,113,111,132,121,111,16,113,79,138,145,163,83,163,147,155,82,130,16,113,78,113,110,113,110,121,110,121,78,121,110,121,142,121,143,121,143,121,110,121,110,130,
+    121,111,2,121,143,121,144,121,144,131,121,112,6,121,144,129,209,129,209,129,208,121,143,113,111,121,143,130,121,175,1,121,207,113,78,130,121,110,4,121,175,129,207,121,207,121,174,113,
+    109,136,121,109,0,80,233,132,0,0,131,0,0,0,48,160,140,226,97,0,137,97,130,0,0,0,209,163,136,201,130,0,201,131,175,201,130,0,201,131,133,201,130,5,193,130,48,96,
+    0,0,0,0,40,133,121,108,136,121,109,32,188,116,230,185,230,153,230,121,230,153,230,121,230,185,188,181,121,142,121,109,121,110,121,110,121,78,205,119,238,218,238,218,205,151,113,77,
+    121,110,121,110,113,46,222,24,230,218,230,218,213,248,113,81,121,113,121,113,163,116,230,185,230,186,238,250,113,80,130,121,112,12,171,212,238,218,230,218,238,218,130,18,121,113,121,145,
+    238,250,230,218,238,218,230,186,230,217,230,186,130,230,185,16,230,217,238,217,197,23,121,112,121,112,196,214,230,153,230,185,230,185,238,218,238,218,238,217,222,57,188,182,138,82,121,112,
+    121,112,131,121,111,2,121,79,154,242,222,56,131,230,153,14,230,185,205,86,129,207,113,110,113,110,121,110,146,177,238,218,238,185,230,185,172,20,113,111,121,111,121,111,171,180,130,238,
+    218,11,180,52,113,111,113,111,121,112,171,212,230,185,230,185,238,250,130,16,113,111,163,147,230,185,130,238,218,8,130,16,113,110,121,110,121,110,196,246,238,186,230,185,197,22,113,110,
+    136,121,109,0,81,9,132,0,0,131,0,0,0,48,160,140,226,97,0,137,129,130,0,0,0,209,163,192,201,130,5,193,130,48,96,0,0,0,0,40,133,121,108,134,121,109,1,121,
+    77,196,245,135,230,153,24,205,151,121,77,121,110,121,110,121,78,205,86,230,153,230,153,205,118,113,77,121,110,121,110,113,45,213,248,230,153,230,153,213,184,113,81,121,113,121,113,163,
+    84,230,153,230,153,230,218,113,80,130,121,112,7,171,180,230,153,230,153,230,185,130,18,121,113,121,145,230,185,137,230,153,3,196,246,121,112,113,112,196,246,136,230,153,1,163,116,113,
+    79,131,121,111,1,146,210,230,185,130,230,153,0,230,121,130,230,153,12,222,88,129,207,113,110,113,110,121,142,238,217,230,153,230,153,188,181,113,110,113,111,113,111,180,85,130,230,153,
+    4,196,246,113,111,113,111,121,111,188,149,130,230,153,2,113,46,113,111,163,115,130,230,153,9,230,121,171,211,113,110,121,110,121,110,188,213,230,153,230,153,196,245,121,110,136,121,109,
+    0,81,8,132,0,0,131,0,0,0,48,192,140,226,97,0,145,129,130,0,0,0,209,163,192,201,130,5,193,130,48,96,0,0,0,0,40,133,121,108,134,121,109,1,138,79,230,185,
+    130,230,153,2,180,116,172,19,222,24,130,230,153,22,155,49,121,109,121,110,121,78,205,86,230,153,230,153,205,118,113,77,113,110,121,110,113,45,213,248,230,153,230,153,213,184,113,81,
+    121,113,121,113,163,84,230,153,230,153,230,218,130,113,80,11,121,112,171,212,230,153,230,153,230,185,130,18,121,113,121,146,238,250,238,185,230,185,230,185,131,230,153,6,238,185,230,185,
+    238,185,197,22,121,112,113,112,196,246,130,230,153,129,230,121,0,230,185,130,230,153,1,230,185,138,145,130,121,111,7,113,46,213,248,230,153,230,153,230,88,172,20,163,147,205,119,130,
+    230,153,11,188,149,113,78,121,110,113,46,222,24,230,153,230,153,205,87,113,78,113,110,113,111,197,54,130,230,153,10,213,215,113,46,113,111,113,79,205,151,230,153,230,153,205,119,113,
+    78,113,110,163,115,131,230,153,8,205,151,113,78,113,110,121,110,188,213,230,153,230,153,196,245,121,110,136,121,109,0,81,8,132,0,0,131,0,0,0,48,160,140,226,97,0,145,129,
+    130,0,0,0,209,163,192,201,130,5,193,131,48,96,0,0,0,0,40,133,121,108,134,121,109,0,171,146,130,230,153,29,155,49,113,109,113,77,130,47,230,185,230,153,230,153,188,148,
+    121,109,121,110,121,110,205,86,230,153,230,153,205,118,113,77,121,109,121,110,113,45,213,216,230,153,230,153,213,184,113,80,121,113,121,113,163,84,230,153,230,153,238,218,131,113,80,15,
+    171,180,230,153,230,153,230,185,130,18,121,113,121,113,121,178,121,177,121,145,138,146,230,185,230,153,230,153,180,117,121,176,130,121,144,9,113,111,113,112,196,246,230,153,230,153,230,121,
+    104,238,105,15,113,143,205,87,130,230,153,0,188,149,130,121,111,4,138,113,230,185,230,153,230,153,163,114,130,113,78,14,222,88,230,153,230,153,230,121,113,46,113,110,113,78,196,213,
+    230,153,230,153,222,24,113,46,113,110,113,46,222,24,130,230,153,10,230,121,105,46,113,110,113,46,230,121,230,153,230,153,180,148,113,110,113,110,163,115,131,230,153,8,230,185,121,142,
+    113,110,121,110,196,245,230,153,230,153,196,245,113,110,136,121,109,0,80,233,132,0,0,131,0,0,0,48,192,140,226,97,0,145,129,130,0,0,0,209,163,151,201,130,0,201,131,135,
+    201,130,0,201,131,136,201,130,0,201,131,148,201,130,5,193,130,48,96,0,0,0,0,40,133,121,108,134,121,109,33,180,51,230,153,230,153,230,185,113,45,113,77,113,76,113,44,221,
+    248,230,153,230,153,205,86,121,77,121,110,121,110,205,86,230,153,230,153,205,118,113,77,121,109,121,109,113,45,213,248,230,153,230,153,213,183,113,80,121,113,121,113,155,84,230,121,230,
+    153,230,218,131,113,80,4,171,180,230,153,230,153,230,185,130,18,130,121,113,129,113,113,5,138,82,230,185,230,153,230,153,180,85,113,112,131,113,111,8,113,79,196,246,230,153,230,153,
+    230,121,105,47,113,111,113,111,121,144,130,230,153,8,222,24,113,47,121,111,121,111,171,212,230,121,230,153,230,185,113,142,130,113,78,14,188,117,230,153,230,153,230,185,129,240,113,110,
+    121,111,171,211,230,153,230,153,230,185,113,46,113,110,113,46,230,185,130,230,153,11,238,217,121,142,113,110,121,111,238,217,230,153,230,153,163,179,113,78,113,110,163,114,230,121,131,230,
+    153,8,155,50,113,110,121,110,196,245,230,153,230,153,196,245,113,110,113,109,135,121,109,0,81,9,132,0,0,131,0,0,0,48,160,140,226,97,0,145,129,130,0,0,0,209,163,192,
+    201,130,4,193,130,48,96,0,0,0,0,48,133,135,121,109,34,180,51,230,153,230,153,230,185,113,77,113,76,113,76,113,77,138,111,146,240,146,208,138,143,113,77,121,109,121,110,205,
+    54,230,153,230,153,205,118,113,77,121,109,121,109,113,45,213,215,230,153,230,153,213,183,113,80,121,113,121,113,163,84,230,153,230,153,238,218,113,48,130,113,80,4,171,180,230,153,230,
+    153,230,185,130,18,130,121,113,129,113,113,4,138,82,230,185,230,153,230,153,180,85,132,113,111,20,113,79,196,246,230,153,230,153,230,121,105,47,113,111,113,111,113,79,196,246,230,153,
+    230,153,230,185,121,143,121,111,121,79,196,246,230,153,230,153,222,24,105,45,130,113,78,42,163,147,230,153,230,153,230,121,146,241,113,110,121,111,146,145,230,185,230,153,238,185,129,239,
+    113,78,129,240,230,185,230,153,197,86,230,153,230,153,138,144,113,110,138,48,238,185,230,153,230,153,146,176,113,110,113,110,163,114,230,121,230,153,222,88,230,153,230,153,196,245,113,78,
+    121,110,196,245,230,153,230,153,196,245,121,110,113,109,135,121,109,0,81,9,132,0,0,131,0,0,0,48,160,140,226,97,0,145,129,130,0,0,0,209,163,192,201,130,5,193,130,48,
+    96,0,0,0,0,40,133,121,108,134,121,109,0,163,146,130,230,153,29,180,51,113,44,113,76,113,76,113,77,113,109,113,76,113,76,113,77,121,109,121,109,205,54,230,153,230,153,205,
+    118,113,77,113,109,113,77,113,45,213,215,230,153,230,153,213,183,113,80,121,112,121,113,163,84,230,153,230,153,238,218,131,113,80,25,171,180,230,153,230,153,230,185,130,18,113,113,121,
+    113,121,113,113,113,113,80,138,82,230,185,230,153,230,153,180,85,113,111,113,112,113,111,113,79,113,111,113,79,196,246,230,153,230,153,230,121,105,46,130,113,111,57,172,20,230,153,230,
+    153,230,185,130,16,121,111,113,46,213,151,230,153,230,153,213,151,113,45,113,78,113,78,113,110,155,18,230,153,230,153,230,121,155,82,113,110,121,111,113,79,230,185,230,153,230,153,146,
+    177,113,78,146,209,230,153,230,185,163,179,230,153,230,153,163,114,113,78,155,17,230,153,230,153,238,217,113,109,113,109,113,110,163,146,230,121,230,153,213,247,205,86,230,153,230,153,113,
+    110,121,110,196,245,230,153,230,153,196,245,121,110,113,109,135,121,109,0,81,9,132,0,0,131,0,0,0,48,192,140,226,97,0,145,129,130,0,0,0,209,163,144,201,130,0,201,131,
+    134,201,130,0,201,131,135,201,130,0,201,131,130,201,130,0,201,131,132,201,130,0,201,131,147,201,130,5,193,130,48,96,0,0,0,0,40,132,121,108,134,121,109,1,129,238,230,185,
+    130,230,153,13,188,213,121,205,113,76,113,77,113,77,113,76,113,76,113,77,121,77,113,77,197,54,230,153,230,153,213,215,130,163,114,31,155,82,222,56,230,153,230,153,213,183,113,80,
+    121,112,121,113,163,84,230,153,230,153,238,218,113,80,113,112,113,80,113,80,171,180,230,153,230,153,230,185,130,18,113,113,121,113,121,113,113,113,113,80,138,82,230,185,230,153,230,153,
+    180,85,113,111,130,113,112,10,113,111,113,79,196,246,230,153,230,153,230,121,105,46,113,111,113,111,113,78,163,147,130,230,153,11,138,113,113,110,113,46,221,248,230,153,230,153,205,118,
+    113,78,113,110,113,110,121,110,146,209,130,230,153,38,163,115,113,110,121,111,113,46,213,248,230,153,230,153,163,114,113,78,163,179,230,153,238,185,129,239,238,185,230,153,180,52,113,78,
+    163,179,230,153,230,153,222,24,105,44,113,109,113,109,163,114,230,153,230,153,222,24,155,17,230,153,230,153,146,241,113,110,188,245,230,153,230,153,196,245,113,110,113,109,135,121,109,0,
+    81,9,132,0,0,131,0,0,0,48,160,140,226,97,0,153,161,130,0,0,0,209,163,192,201,130,4,193,130,48,96,0,0,0,0,40,133,135,121,109,1,121,77,197,21,131,230,153,
+    9,230,185,188,213,129,238,113,77,113,77,113,76,113,77,121,77,121,109,197,54,137,230,153,17,213,183,113,80,121,112,121,113,155,84,230,153,230,153,238,218,113,80,113,112,113,80,121,
+    80,171,212,230,153,230,153,230,185,130,18,113,113,130,121,113,5,113,80,138,82,230,185,230,153,230,153,180,85,132,113,112,9,113,80,196,246,230,153,230,153,222,121,105,46,113,111,113,
+    111,113,79,163,82,130,230,153,11,138,145,113,110,113,46,222,24,230,153,230,153,205,86,113,78,113,110,113,110,121,111,146,177,130,230,153,37,163,147,113,110,113,111,121,111,196,246,230,
+    153,230,153,180,20,113,78,180,84,230,153,222,89,105,46,238,217,230,153,196,245,113,77,180,84,230,153,230,153,197,21,113,77,113,109,113,110,163,146,230,121,230,153,222,24,105,13,230,
+    185,230,153,180,116,113,110,188,213,230,153,230,153,196,245,121,110,136,121,109,0,81,9,132,0,0,131,0,0,1,48,160,226,98,139,226,97,0,153,161,130,0,0,0,209,163,192,201,
+    130,4,193,130,48,96,0,0,0,0,40,132,136,121,109,1,130,14,222,88,133,230,153,6,188,148,121,173,113,77,113,77,121,109,121,77,205,54,137,230,153,37,213,183,113,80,113,112,
+    121,112,155,84,230,153,230,153,238,217,113,80,113,112,113,112,121,80,171,180,230,153,230,153,230,185,130,17,113,81,113,113,121,113,121,113,113,80,138,82,230,185,230,153,230,153,180,85,
+    113,112,113,112,121,112,113,112,121,112,113,80,196,246,230,153,230,153,222,121,105,14,130,113,111,0,155,82,130,230,153,11,146,145,113,110,113,46,222,24,230,153,230,153,197,54,113,78,
+    113,110,113,110,121,111,146,177,130,230,153,37,163,179,113,110,121,111,113,111,180,52,230,153,230,153,188,181,113,78,197,22,230,153,205,119,105,13,222,56,230,153,213,215,113,45,196,245,
+    230,153,230,153,180,51,113,77,113,109,113,109,163,146,230,153,230,153,222,24,105,13,197,22,230,153,222,24,113,45,188,213,230,153,230,153,196,245,113,109,136,121,109,0,81,9,132,0,
+    0,131,0,0,0,48,160,140,226,97,0,153,161,130,0,0,0,209,163,151,201,130,0,201,131,135,201,130,0,201,131,136,201,130,0,201,131,148,201,130,4,193,130,48,96,0,0,0,
+    0,40,132,137,121,109,2,130,14,205,86,230,185,132,230,153,5,222,24,121,174,113,109,121,109,113,77,197,54,130,230,153,131,238,217,130,230,153,7,213,183,113,80,121,112,121,112,155,
+    84,230,153,230,153,238,218,131,113,80,16,163,180,230,153,230,153,230,185,130,18,113,112,113,81,121,81,113,80,113,80,138,82,230,185,230,153,230,153,180,84,113,111,113,112,130,121,112,
+    9,113,112,196,246,230,153,230,153,222,121,105,14,113,110,113,110,113,111,155,50,130,230,153,11,146,177,113,110,113,46,221,248,230,153,230,153,205,86,113,78,113,110,121,110,121,111,146,
+    177,130,230,153,20,163,179,113,110,113,111,113,111,155,82,230,153,230,153,205,118,105,13,213,215,230,153,188,149,113,78,196,245,230,153,230,153,105,13,213,183,230,153,230,153,155,81,130,
+    113,109,13,163,146,230,153,230,153,222,24,105,13,163,114,230,153,230,185,138,112,196,213,230,153,230,153,196,245,113,109,136,121,109,0,80,233,132,0,0,131,0,0,0,48,160,140,226,
+    97,0,161,161,130,0,0,0,209,163,142,201,130,0,201,131,176,201,130,4,193,131,48,96,0,0,0,0,40,132,138,121,109,3,113,76,130,14,180,19,230,88,131,230,153,43,188,181,
+    121,77,121,109,121,109,197,22,230,153,230,153,205,118,113,45,113,77,113,77,113,45,213,215,230,153,230,153,213,183,113,80,121,112,121,112,155,84,230,121,230,153,238,218,113,80,113,112,
+    113,80,113,80,171,180,230,153,230,153,230,185,130,18,113,80,113,81,121,80,121,80,113,80,138,82,230,185,230,153,230,153,180,84,113,111,113,112,130,121,112,9,113,80,196,246,230,153,
+    230,153,222,121,105,14,113,110,113,111,121,110,155,82,130,230,153,11,138,144,113,110,113,46,213,248,230,153,230,153,205,118,113,78,113,110,121,110,121,111,146,177,130,230,153,37,163,179,
+    113,110,113,110,121,111,138,80,230,153,230,153,222,88,104,205,230,153,230,153,171,243,113,110,171,243,230,153,230,185,121,142,230,121,230,153,230,185,130,14,113,77,113,109,113,109,163,114,
+    230,121,230,153,222,24,113,45,121,174,230,185,230,153,180,52,188,213,230,153,230,153,196,245,113,109,136,121,109,0,81,9,132,0,0,131,0,0,0,48,160,140,226,97,0,161,193,130,
+    0,0,0,209,163,192,201,130,4,193,131,48,96,0,0,0,0,40,100,138,121,109,130,113,76,1,121,109,197,21,131,230,153,6,113,77,121,110,121,109,197,22,230,153,230,153,205,118,
+    130,113,77,32,113,45,213,215,230,153,230,153,205,151,113,80,113,112,121,112,155,84,230,153,230,153,238,217,113,80,113,112,113,80,113,80,163,180,230,153,230,153,230,185,130,17,113,80,
+    113,112,121,112,113,80,113,80,138,82,230,185,230,153,230,153,180,84,113,111,113,112,130,121,112,9,113,79,196,246,230,153,230,153,222,121,105,14,113,110,113,110,121,110,163,115,130,230,
+    153,11,138,80,113,110,113,46,213,183,230,153,230,153,213,183,113,45,113,78,121,110,121,110,146,209,130,230,153,20,163,147,113,78,113,110,121,110,121,111,238,185,230,153,230,185,129,239,
+    238,185,230,153,155,50,113,109,146,176,230,153,230,153,146,241,238,217,230,153,230,185,113,44,130,113,109,13,163,114,230,121,230,153,222,24,113,12,113,77,205,118,230,153,213,215,188,213,
+    230,153,230,153,196,245,113,109,136,121,109,0,89,9,132,0,0,131,0,0,0,48,160,140,226,97,0,169,193,130,0,0,0,209,163,192,201,130,4,193,130,48,96,0,0,0,0,32,
+    100,135,121,109,130,121,77,15,113,77,113,76,113,108,113,76,113,76,230,120,230,153,230,153,230,185,130,15,121,109,121,109,197,22,230,153,230,153,205,118,130,113,77,32,113,45,213,215,
+    230,153,230,153,213,151,113,79,113,112,113,112,155,83,230,153,230,153,238,217,121,112,113,112,113,80,113,80,171,180,230,153,230,153,230,185,130,17,113,80,113,112,121,112,121,80,113,80,
+    138,82,230,185,230,153,230,153,180,84,113,111,113,111,130,121,112,5,113,80,196,246,230,153,230,153,222,121,105,45,130,113,110,15,171,211,230,153,230,153,230,185,129,239,113,110,113,78,
+    205,86,230,153,230,153,222,24,105,45,113,78,121,110,121,110,155,18,130,230,153,38,155,82,113,110,121,110,121,110,113,46,222,56,230,153,238,185,163,147,230,153,230,185,138,112,113,109,
+    113,141,238,217,230,153,180,116,230,185,230,153,213,215,113,44,113,77,113,109,113,109,163,114,230,153,230,153,222,24,113,44,113,109,171,211,230,153,230,185,205,151,230,153,230,153,196,245,
+    113,109,113,109,135,121,109,0,97,42,132,0,0,131,0,0,0,48,160,140,226,97,0,177,225,130,0,0,0,209,163,193,201,130,4,48,96,0,0,0,0,32,100,121,108,133,121,109,
+    9,121,45,171,210,180,51,180,51,163,81,121,77,113,77,113,76,113,76,197,53,130,230,153,6,138,112,121,109,113,109,197,21,230,153,230,153,205,86,130,113,77,32,113,45,213,215,230,
+    153,230,153,205,151,113,79,113,112,113,112,155,83,230,153,230,153,238,217,121,176,113,112,113,80,113,80,171,212,230,153,230,153,230,185,129,241,113,112,113,112,121,112,121,112,113,80,138,
+    82,230,185,230,153,230,153,180,84,113,111,113,111,130,121,112,16,113,79,196,246,230,153,230,153,230,121,105,13,113,110,113,110,121,110,188,116,230,153,230,153,230,185,113,77,113,110,113,
+    110,188,181,130,230,153,4,113,45,113,78,113,110,121,110,163,82,130,230,153,1,146,209,113,110,130,121,110,26,205,54,230,153,230,153,197,22,230,153,238,217,121,174,113,109,105,12,230,
+    121,230,153,213,183,230,153,230,153,196,245,113,76,113,76,113,109,113,109,163,114,230,153,230,153,222,24,113,44,113,109,138,79,230,185,131,230,153,2,196,245,113,109,113,109,135,121,109,
+    0,89,42,132,0,0,131,0,0,0,56,160,140,226,97,0,185,225,130,0,0,3,209,163,201,130,201,130,201,131,146,201,130,0,201,131,169,201,130,5,193,131,48,96,0,0,0,0,
+    32,100,121,108,133,121,109,9,121,77,213,151,230,153,230,153,213,247,113,45,121,77,113,77,113,77,197,54,130,230,153,22,138,79,113,109,113,109,197,21,230,153,230,153,205,86,113,77,
+    113,109,113,77,113,45,213,216,230,153,230,153,205,151,113,79,113,112,113,112,155,19,230,153,230,153,230,185,138,146,130,113,112,49,180,117,230,153,230,153,238,217,121,145,113,112,113,113,
+    121,112,121,112,121,80,138,82,230,185,230,153,230,153,180,84,113,111,113,111,121,111,121,112,121,111,113,79,197,22,230,153,230,153,222,121,105,13,113,110,113,110,113,78,222,24,230,153,
+    230,153,213,247,113,45,113,109,121,110,171,179,230,153,230,153,238,185,121,207,113,77,113,110,121,110,180,20,230,153,230,153,238,185,121,207,113,110,130,121,110,9,180,84,230,153,230,153,
+    230,121,230,153,230,153,113,44,113,109,113,44,205,151,131,230,153,12,171,243,113,108,113,76,113,109,121,109,163,114,230,153,230,153,222,24,113,44,113,109,113,44,222,24,131,230,153,2,
+    196,245,113,109,113,109,135,121,109,0,72,232,132,0,0,131,0,0,0,56,160,140,226,97,0,185,225,130,0,0,0,209,163,193,201,130,4,48,96,0,0,0,0,32,100,121,108,134,
+    121,109,44,196,245,230,153,230,153,230,185,146,208,121,77,121,77,121,173,230,121,230,153,230,153,238,185,121,141,113,109,113,109,197,21,230,153,230,153,205,86,113,77,113,109,121,109,113,
+    45,213,248,230,153,230,153,205,151,113,79,113,112,121,112,138,50,230,185,230,153,230,153,196,246,113,80,113,112,113,80,222,24,230,153,230,153,230,121,113,48,113,112,113,112,130,121,112,
+    6,138,82,230,185,230,153,230,153,180,84,113,111,113,111,130,121,111,8,113,79,197,22,230,153,230,153,222,121,96,204,105,13,113,110,180,84,130,230,153,17,180,116,113,77,113,109,121,
+    110,130,15,230,185,230,153,230,153,171,243,113,77,113,110,113,78,222,24,230,153,230,153,221,248,113,45,113,109,130,121,110,0,163,114,131,230,153,4,213,183,113,76,113,108,113,109,188,
+    181,131,230,153,0,147,16,130,113,76,8,113,109,163,146,230,153,230,153,222,24,113,44,113,109,113,109,180,83,131,230,153,2,196,245,113,109,113,109,135,121,109,0,40,133,132,0,0,
+    131,0,0,0,56,192,140,226,97,0,186,1,130,0,0,0,209,163,192,201,130,5,193,130,48,96,0,0,0,0,32,100,121,108,132,121,109,2,121,108,121,77,163,146,131,230,153,2,
+    196,213,180,116,222,56,130,230,153,20,205,118,113,76,113,76,113,109,196,245,230,153,230,153,205,86,113,77,113,109,121,110,113,45,213,248,230,153,230,153,205,151,113,79,113,112,121,112,
+    113,80,214,24,130,230,153,2,205,119,180,117,213,216,130,230,153,3,188,150,113,80,113,80,113,112,130,121,112,6,138,82,230,185,230,153,230,153,180,84,113,111,113,111,130,121,111,1,
+    113,79,197,22,130,230,153,130,238,218,131,230,153,5,130,15,113,77,113,109,113,109,113,77,197,54,130,230,153,2,188,213,172,20,213,151,130,230,153,7,171,243,113,77,113,109,121,109,
+    121,110,121,110,138,112,230,185,130,230,153,0,196,245,130,113,108,0,171,243,130,230,153,13,238,185,121,237,113,76,113,76,121,76,113,109,163,146,230,153,230,153,222,24,105,44,113,109,
+    113,109,138,143,131,230,153,2,196,245,113,109,113,108,135,121,109,133,0,0,131,0,0,0,56,160,140,226,97,0,186,1,130,0,0,3,209,163,201,130,201,130,201,131,140,201,130,0,
+    201,131,134,201,130,0,201,131,135,201,130,0,201,131,136,201,130,0,201,131,148,201,130,4,193,130,48,96,0,0,0,0,32,99,131,121,109,130,121,108,129,121,109,0,222,88,135,230,
+    153,22,230,185,138,143,113,76,113,76,113,77,196,245,230,153,230,153,205,86,113,77,113,109,121,110,113,45,213,248,230,153,230,153,205,151,113,79,113,111,121,112,121,112,155,51,230,185,
+    134,230,153,3,230,185,129,241,113,112,113,112,131,121,112,6,138,82,230,185,230,153,230,153,180,84,113,111,113,111,130,121,111,1,113,79,197,22,135,230,153,7,230,185,155,17,113,77,
+    113,77,113,109,121,109,121,110,138,80,135,230,153,8,222,88,113,109,113,77,113,109,121,109,121,110,121,110,121,142,238,185,130,230,153,4,180,84,113,108,113,108,113,76,155,113,131,230,
+    153,13,113,44,113,76,113,76,121,108,113,109,163,114,230,153,230,153,222,23,105,44,113,108,113,108,113,44,230,121,130,230,153,2,196,245,113,108,113,108,134,121,109,0,80,232,133,0,
+    0,131,0,0,0,56,192,140,226,97,0,186,1,130,0,0,0,209,163,144,201,130,0,201,131,134,201,130,0,201,131,135,201,130,0,201,131,136,201,130,0,201,131,148,201,130,5,48,
+    96,0,0,0,0,32,99,121,109,121,109,133,121,108,3,121,109,138,46,213,151,230,185,131,230,153,2,230,185,222,23,155,16,130,113,76,18,113,77,197,54,238,185,238,185,205,118,113,
+    77,113,77,121,110,113,46,222,24,238,185,238,185,213,183,113,79,113,111,121,112,121,113,113,80,163,180,130,230,153,4,230,121,230,153,238,185,213,248,146,211,130,113,112,131,121,112,0,
+    138,114,130,238,217,2,180,117,113,111,113,111,130,121,111,3,113,78,197,22,238,185,238,217,131,238,218,2,230,121,196,245,138,111,131,113,77,129,121,109,2,121,77,155,17,222,88,130,
+    230,153,11,230,121,238,185,205,86,121,206,113,109,113,77,113,109,121,109,121,109,121,110,113,45,230,153,130,238,217,4,171,210,113,108,113,76,113,108,146,143,130,238,217,14,205,150,113,
+    44,113,76,121,76,121,108,121,109,163,146,230,185,230,185,222,24,113,44,113,108,113,108,113,76,196,245,130,238,217,3,197,21,113,108,113,108,121,108,133,121,109,0,16,66,133,0,0,
+    131,0,0,0,56,160,140,226,97,0,186,1,130,0,0,0,209,163,143,201,130,0,201,131,135,201,130,0,201,131,135,201,130,0,201,131,136,201,130,0,201,131,147,201,130,6,193,130,
+    48,96,0,0,0,0,32,99,121,108,121,109,132,121,108,10,121,76,121,108,121,108,113,76,138,46,163,113,171,210,171,242,163,113,130,46,113,44,131,113,76,8,121,109,121,141,121,173,
+    121,173,121,141,113,77,113,77,113,109,121,110,130,121,174,13,121,143,113,111,113,111,121,112,121,112,121,113,121,113,113,112,138,146,155,84,163,148,155,51,130,17,113,80,131,113,112,0,
+    121,113,130,121,112,6,121,79,113,47,113,46,113,46,113,78,113,110,113,110,131,121,110,4,113,46,113,45,113,45,105,13,105,45,130,105,12,133,113,77,131,121,109,10,113,77,138,144,
+    155,81,163,114,155,81,129,238,113,76,113,109,113,76,113,108,113,109,131,121,109,7,113,44,113,12,113,12,105,12,113,76,113,108,113,76,113,108,135,113,76,5,121,76,121,109,121,76,
+    113,44,113,12,105,11,131,113,76,129,113,44,6,113,11,105,11,113,44,113,108,113,108,121,108,121,108,131,121,109,0,64,199,134,0,0,131,0,0,0,64,192,140,226,97,0,186,1,
+    130,0,0,0,209,163,192,201,130,4,193,130,48,96,0,0,0,0,32,99,134,121,108,131,121,76,137,113,76,4,121,76,121,77,121,109,121,109,113,109,130,113,77,1,113,109,121,110,
+    132,113,110,0,113,111,130,121,112,1,121,113,121,112,136,113,112,132,121,112,129,121,111,129,113,111,131,113,110,131,121,110,2,113,110,113,109,113,109,137,113,77,129,121,77,129,121,109,
+    10,113,109,113,108,113,76,113,76,113,77,113,76,113,108,113,76,113,108,113,76,113,76,132,121,109,1,113,76,113,108,133,113,76,0,113,108,133,113,76,0,121,76,130,121,108,0,113,
+    108,131,113,76,9,121,76,121,108,121,108,113,108,113,108,113,76,113,108,113,108,121,108,121,108,130,121,109,0,89,10,135,0,0,131,0,0,0,56,192,140,226,97,0,186,33,130,0,
+    0,0,209,163,192,201,130,4,193,130,48,96,0,0,0,0,32,99,132,121,108,133,121,76,137,113,76,4,121,76,121,77,121,109,121,109,113,109,130,113,77,129,113,109,132,113,110,1,
+    113,111,121,111,131,121,112,136,113,112,131,121,112,130,121,111,0,113,111,131,113,110,131,121,110,129,113,110,0,113,109,137,113,77,130,121,77,129,121,109,129,113,108,136,113,76,5,121,
+    108,121,109,121,108,121,109,121,108,121,108,133,113,76,129,121,76,133,113,76,130,121,76,0,121,108,131,113,76,129,121,76,7,121,108,121,76,113,108,113,108,113,76,113,108,121,108,121,
+    108,130,121,109,0,97,42,136,0,0,131,0,0,0,64,192,140,226,97,0,186,33,130,0,0,0,209,163,192,201,130,6,193,130,48,96,0,0,0,0,32,99,121,108,121,109,130,121,
+    108,133,121,76,0,113,76,132,113,75,131,113,76,1,121,76,121,77,130,121,109,130,113,77,0,121,109,131,113,109,129,113,110,129,113,111,0,121,111,130,121,112,136,113,112,130,121,112,
+    132,121,111,132,113,110,130,121,110,0,113,110,133,113,109,131,113,77,1,113,76,113,77,132,121,109,1,121,108,113,108,135,113,76,129,121,76,130,121,108,129,121,76,132,113,76,130,121,
+    76,130,113,76,15,113,75,113,76,121,76,121,76,121,108,121,76,121,76,113,76,113,76,113,75,113,76,121,76,121,108,121,108,121,76,113,76,130,113,108,129,121,108,129,121,109,0,81,
+    9,137,0,0,131,0,0,0,64,192,140,226,97,0,186,33,130,0,0,0,209,163,192,201,130,6,193,131,48,96,0,0,0,0,32,99,121,108,121,109,130,121,108,134,121,76,133,113,
+    75,129,113,76,129,121,76,0,121,108,130,121,109,6,113,77,113,109,113,109,121,109,121,109,121,110,113,109,131,113,110,0,113,111,132,121,111,130,113,111,129,113,112,131,121,112,133,121,
+    111,0,121,110,130,113,110,133,121,110,130,113,109,3,113,77,113,109,113,77,113,109,131,113,77,0,121,77,131,121,109,130,121,108,134,113,76,4,121,108,121,76,121,76,121,108,121,108,
+    132,121,76,130,113,75,4,121,75,121,76,121,76,121,75,113,75,130,121,75,133,121,76,130,113,75,4,121,76,121,108,121,108,121,76,121,108,130,113,108,129,121,108,1,121,109,56,166,
+    138,0,0,131,0,0,0,72,192,140,226,97,0,186,1,130,0,0,0,209,163,192,201,130,5,193,131,48,96,0,0,0,0,24,67,121,109,131,121,108,132,121,76,131,121,75,131,113,
+    75,0,113,76,130,121,76,0,121,108,135,121,109,133,121,110,1,113,110,121,110,132,121,111,129,113,111,133,121,111,143,121,110,129,121,109,132,113,109,134,121,109,131,121,108,132,121,76,
+    0,121,108,140,121,76,138,121,75,132,121,76,129,121,75,129,121,76,135,121,108,1,72,232,16,33,139,0,0,131,0,0,6,32,96,178,1,186,1,186,1,194,1,202,33,202,1,130,
+    202,33,4,194,1,186,1,186,1,161,193,56,160,130,0,0,0,137,34,192,209,163,1,185,131,8,0,130,0,0,2,80,232,113,76,121,108,130,121,76,3,121,75,113,75,121,75,121,
+    75,136,113,75,7,113,76,121,76,121,76,113,76,121,76,121,76,113,76,113,76,130,113,77,134,113,109,146,113,110,130,113,109,3,113,110,113,109,113,109,113,77,132,113,109,2,113,77,
+    113,109,113,77,150,113,76,129,113,75,0,113,76,152,113,75,130,113,43,6,113,75,113,43,97,42,97,42,89,9,72,231,40,100,142,0,0,255,0,0,239,0,0,255,0,0,239,0,
+    0,255,0,0,239,0,0,131,0,0,4,24,64,161,193,153,193,145,161,137,161,135,137,129,0,137,161,136,137,129,129,137,161,168,137,129,9,137,161,137,129,137,161,137,129,145,129,153,
+    161,153,161,161,161,169,193,169,193,130,177,225,0,185,225,131,186,1,1,185,225,32,96,130,0,0,2,32,0,72,1,64,1,156,64,0,0,64,1,131,64,0,129,64,1,129,64,0,
+    0,64,1,131,64,0,5,64,1,64,0,64,1,64,0,64,0,64,1,135,64,0,129,64,1,131,64,0,0,64,1,132,64,0,25,72,0,72,1,72,1,72,0,72,0,72,1,72,
+    1,64,1,64,0,72,0,72,1,72,1,72,0,72,0,72,1,72,0,72,1,72,0,72,1,72,0,72,1,72,0,72,0,72,1,72,1,72,0,138,72,1,146,80,1,134,88,1,
+    131,96,1,129,104,1,0,48,0,132,0,0,131,0,0,0,64,192,211,226,97,0,48,160,130,0,0,0,184,34,255,192,34,138,192,34,1,192,66,128,34,132,0,0,131,0,0,0,
+    64,192,211,226,97,0,40,128,130,0,0,0,208,35,255,192,34,138,192,34,1,192,66,128,33,132,0,0,131,0,0,0,64,192,210,226,97,1,234,97,32,64,130,0,0,0,208,34,
+    255,192,34,138,192,34,1,192,66,128,33,132,0,0,131,0,0,0,64,192,210,226,97,1,234,130,16,32,130,0,0,0,208,34,255,192,34,139,192,34,0,128,33,132,0,0,131,0,
+    0,0,64,192,210,226,97,0,234,130,131,0,0,0,208,34,255,192,34,139,192,34,0,120,33,132,0,0,131,0,0,0,64,192,210,226,97,0,234,130,131,0,0,0,200,66,255,192,
+    34,139,192,34,0,120,33,132,0,0,131,0,0,0,64,192,210,226,97,0,234,130,131,0,0,0,200,66,255,192,34,138,192,34,1,192,66,120,33,132,0,0,131,0,0,0,64,192,
+    210,226,97,0,234,130,130,0,0,1,8,0,200,34,255,192,34,139,192,34,0,120,33,132,0,0,131,0,0,0,64,192,210,226,97,0,234,130,130,0,0,1,16,0,200,34,138,192,
+    34,0,200,34,130,192,34,1,200,34,192,34,203,200,34,9,200,35,208,34,208,34,208,35,208,67,208,67,208,35,208,35,208,67,208,34,131,208,67,129,208,34,129,208,67,10,208,35,
+    208,67,208,67,208,66,208,34,208,66,208,34,208,66,200,34,200,34,208,34,143,200,34,129,192,34,0,88,1,132,0,0,131,0,0,0,64,192,210,226,97,0,234,130,130,0,0,1,
+    16,0,200,34,134,192,34,1,200,34,112,33,146,48,0,130,40,0,129,48,0,164,40,0,135,32,0,136,24,0,130,16,0,130,8,0,180,0,0,131,0,0,0,64,192,210,226,97,
+    0,234,129,130,0,0,1,24,0,200,34,134,192,34,0,152,34,255,0,0,137,0,0,131,0,0,0,64,192,210,226,97,0,218,97,130,0,0,1,24,0,200,34,134,192,34,0,128,
+    33,255,0,0,137,0,0,131,0,0,0,64,192,210,226,97,0,202,65,130,0,0,1,32,0,200,34,134,192,34,0,136,33,255,0,0,137,0,0,131,0,0,0,64,192,210,226,97,
+    0,194,33,130,0,0,1,32,0,200,34,133,192,34,2,192,66,192,34,24,0,255,0,0,136,0,0,131,0,0,0,64,192,210,226,97,0,186,1,130,0,0,1,40,0,200,34,136,
+    192,34,6,160,34,176,34,184,34,192,34,200,34,200,34,208,35,134,200,34,129,200,35,129,200,34,131,208,34,2,200,67,200,34,208,35,136,200,34,3,200,35,200,34,200,34,200,35,
+    133,200,34,8,200,67,200,34,200,34,200,35,200,35,200,34,200,34,200,35,200,35,188,200,34,0,200,35,131,200,34,0,200,35,134,200,34,129,208,34,2,200,34,192,34,72,1,132,
+    0,0,131,0,0,0,64,192,210,226,97,0,186,1,130,0,0,0,48,0,159,192,34,0,192,66,235,192,34,0,128,33,132,0,0,131,0,0,0,64,192,210,226,97,0,186,1,130,
+    0,0,0,48,0,255,192,34,140,192,34,0,128,33,132,0,0,131,0,0,0,64,192,210,226,97,0,186,1,130,0,0,1,40,0,200,34,255,192,34,139,192,34,0,128,33,132,0,
+    0,131,0,0,0,64,192,210,226,97,0,186,1,131,0,0,0,200,34,255,192,34,139,192,34,0,128,33,132,0,0,131,0,0,0,64,192,210,226,97,0,186,1,131,0,0,0,120,
+    1,255,192,34,139,192,34,0,128,33,132,0,0,131,0,0,0,64,192,165,226,97,1,194,1,153,33,135,137,1,129,145,1,130,137,1,129,145,1,0,137,1,133,145,1,0,137,1,
+    131,145,1,4,137,1,145,1,137,1,145,1,137,1,136,145,1,2,137,1,145,1,112,225,132,0,0,0,104,1,130,128,33,4,128,1,128,33,128,1,128,33,128,1,130,128,33,2,
+    128,1,128,33,128,33,130,128,1,130,128,33,0,128,1,133,128,33,0,128,1,130,128,33,12,128,1,128,33,128,1,128,33,128,1,128,33,128,33,128,1,128,1,128,33,128,33,128,
+    1,128,1,141,128,33,0,128,1,133,128,33,3,128,1,128,33,128,33,128,1,149,128,33,0,120,33,142,128,33,0,128,1,148,128,33,129,128,1,135,128,33,0,64,1,132,0,0,
+    131,0,0,0,64,192,162,226,97,2,161,161,72,192,16,32,255,0,0,196,0,0,131,0,0,0,64,192,160,226,97,1,202,33,56,128,255,0,0,199,0,0,131,0,0,0,64,192,
+    158,226,97,2,234,97,145,129,8,0,255,0,0,200,0,0,131,0,0,0,64,192,157,226,97,1,218,97,105,0,132,0,0,6,8,0,72,1,120,1,152,34,168,34,192,34,200,34,
+    134,208,34,129,200,34,131,192,34,132,184,34,129,176,34,136,168,34,0,168,2,188,168,34,129,176,34,131,184,34,132,192,34,135,200,34,130,208,34,129,200,34,132,208,34,136,200,34,
+    131,208,34,129,200,34,132,208,34,136,200,34,129,208,34,134,200,34,130,208,34,129,200,34,132,208,34,131,200,34,129,192,34,2,184,34,176,34,176,34,135,168,34,0,96,33,132,0,
+    0,131,0,0,0,64,192,156,226,97,1,186,1,24,64,131,0,0,1,24,0,120,33,255,192,34,191,192,34,0,112,33,132,0,0,131,0,0,0,64,224,155,226,97,1,177,225,8,
+    0,130,0,0,2,8,0,120,1,200,34,255,192,34,192,192,34,0,112,33,132,0,0,131,0,0,0,64,192,154,226,97,1,210,65,8,32,130,0,0,1,8,0,168,34,255,192,34,
+    194,192,34,0,112,33,132,0,0,131,0,0,0,64,192,154,226,97,0,64,160,130,0,0,2,16,0,168,34,192,66,255,192,34,194,192,34,0,112,33,132,0,0,131,0,0,0,64,
+    192,152,226,97,1,234,97,113,64,130,0,0,1,24,0,176,34,255,192,34,196,192,34,0,112,33,132,0,0,131,0,0,0,64,192,152,226,97,0,161,193,130,0,0,1,16,0,176,
+    34,255,192,34,197,192,34,0,112,33,132,0,0,131,0,0,0,64,224,151,226,97,1,210,65,8,32,130,0,0,1,160,34,192,66,255,192,34,197,192,34,0,112,33,132,0,0,131,
+    0,0,1,64,192,226,65,150,226,97,0,105,32,130,0,0,0,72,0,255,192,34,199,192,34,0,112,33,132,0,0,131,0,0,1,64,192,226,65,150,226,97,0,16,32,130,0,0,
+    0,168,34,255,192,34,199,192,34,0,112,33,132,0,0,131,0,0,0,64,192,150,226,97,0,153,193,130,0,0,0,72,1,255,192,34,200,192,34,0,112,33,132,0,0,131,0,0,
+    0,72,192,150,226,97,0,89,0,130,0,0,0,160,34,255,192,34,200,192,34,0,112,33,132,0,0,131,0,0,0,72,192,149,226,97,5,234,129,24,64,0,0,0,0,24,0,200,
+    34,255,192,34,200,192,34,0,112,33,132,0,0,131,0,0,0,72,192,150,226,97,130,0,0,0,88,1,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,0,72,192,149,226,
+    97,0,186,1,130,0,0,0,128,33,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,1,40,128,186,33,134,186,1,0,194,1,130,202,33,129,210,33,135,186,1,0,129,97,
+    130,0,0,0,168,34,255,192,34,201,192,34,0,112,33,132,0,0,158,0,0,0,200,34,255,192,34,201,192,34,0,112,33,132,0,0,157,0,0,1,16,0,200,66,255,192,34,201,
+    192,34,0,112,33,132,0,0,157,0,0,1,40,0,200,34,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,6,24,32,161,66,169,98,169,98,169,66,169,98,169,98,130,169,
+    66,1,169,98,169,66,130,169,98,130,169,66,129,169,98,7,169,66,169,98,161,66,16,32,0,0,0,0,48,0,200,66,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,1,
+    64,129,193,130,148,201,130,3,56,96,0,0,0,0,56,0,255,192,34,202,192,34,0,112,1,132,0,0,131,0,0,1,64,129,193,130,147,201,130,4,193,130,56,128,0,0,0,0,
+    56,0,225,192,34,4,200,67,201,5,201,5,192,67,192,66,227,192,34,0,112,33,132,0,0,131,0,0,1,56,129,193,130,147,201,130,4,193,130,56,128,0,0,0,0,56,0,220,
+    192,34,12,192,66,209,135,227,175,245,183,255,61,255,125,255,255,255,255,255,93,254,122,236,212,219,45,200,197,224,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,147,201,
+    130,4,193,130,56,128,0,0,0,0,56,0,219,192,34,1,218,9,254,122,138,255,255,2,255,190,235,240,200,99,222,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,147,
+    201,130,4,193,130,64,128,0,0,0,0,56,0,216,192,34,3,192,66,200,131,236,147,255,223,141,255,255,1,246,24,201,6,221,192,34,0,112,33,132,0,0,131,0,0,1,64,129,
+    193,130,148,201,130,3,48,96,0,0,0,0,56,0,216,192,34,1,209,70,246,122,144,255,255,1,255,125,218,107,220,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,
+    201,130,3,48,96,0,0,0,0,56,0,215,192,34,1,210,9,255,125,146,255,255,1,255,223,227,46,219,192,34,0,112,33,132,0,0,131,0,0,1,56,129,193,130,148,201,130,3,
+    48,96,0,0,0,0,56,0,214,192,34,1,201,5,255,125,148,255,255,1,255,223,218,172,218,192,34,0,112,33,132,0,0,131,0,0,1,56,129,193,130,148,201,130,3,48,96,0,
+    0,0,0,56,0,214,192,34,0,245,150,150,255,255,1,255,61,200,132,217,192,34,0,112,33,132,0,0,131,0,0,2,56,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,
+    56,0,213,192,34,0,218,74,152,255,255,0,236,211,217,192,34,0,112,33,132,0,0,131,0,0,3,64,129,193,130,201,130,201,131,145,201,130,4,193,130,48,96,0,0,0,0,56,
+    0,212,192,34,1,192,99,254,122,152,255,255,1,255,223,218,9,216,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,1,
+    211,192,34,1,192,66,227,46,154,255,255,1,254,122,192,99,215,192,34,0,112,33,132,0,0,131,0,0,0,64,129,130,193,130,146,201,130,3,48,96,0,0,0,0,56,1,211,192,
+    34,1,200,197,255,28,155,255,255,0,236,17,215,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,130,201,130,0,201,131,143,201,130,3,48,96,0,0,0,0,56,
+    0,211,192,34,0,236,114,156,255,255,1,255,223,209,103,214,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,130,201,130,0,201,131,143,201,130,3,48,96,0,0,
+    0,0,56,0,210,192,34,1,209,135,255,190,157,255,255,0,245,118,214,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,
+    0,209,192,34,1,192,66,245,248,140,255,255,4,254,251,218,139,209,5,209,233,245,118,141,255,255,0,210,9,213,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,
+    147,201,130,3,48,96,0,0,0,0,56,0,209,192,34,0,218,139,140,255,255,1,255,125,201,6,130,192,34,1,192,66,236,212,140,255,255,1,246,89,192,67,212,192,34,0,112,33,
+    132,0,0,131,0,0,2,64,129,193,130,193,130,132,201,130,0,201,131,141,201,130,3,48,96,0,0,0,0,56,0,208,192,34,1,200,131,254,251,140,255,255,0,218,236,132,192,34,
+    1,200,99,254,219,140,255,255,0,227,45,212,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,1,208,192,34,0,227,175,
+    140,255,255,1,254,186,192,66,133,192,34,0,218,204,140,255,255,1,255,60,192,99,211,192,34,0,112,33,132,0,0,131,0,0,4,64,129,193,130,201,130,201,130,201,131,145,201,130,
+    3,48,96,0,0,0,0,56,1,207,192,34,1,200,164,255,93,140,255,255,0,218,139,134,192,34,1,192,66,245,248,140,255,255,0,227,143,211,192,34,0,112,33,132,0,0,131,0,
+    0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,207,192,34,0,236,114,140,255,255,1,245,118,192,67,135,192,34,1,201,38,255,125,139,255,255,1,255,125,
+    200,229,210,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,206,192,34,1,209,233,255,223,139,255,255,1,255,125,201,
+    38,137,192,34,0,227,208,140,255,255,1,245,215,192,67,209,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,133,201,130,0,201,131,141,201,130,3,48,96,0,0,0,0,
+    56,0,205,192,34,1,200,131,254,187,140,255,255,0,227,208,138,192,34,1,192,99,254,219,140,255,255,0,219,45,209,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,134,
+    201,130,0,201,131,138,201,130,5,193,130,201,130,48,96,0,0,0,0,56,1,205,192,34,0,227,175,140,255,255,1,255,61,200,99,139,192,34,0,218,236,140,255,255,1,254,251,200,
+    99,208,192,34,0,112,33,132,0,0,131,0,0,4,64,129,193,130,193,130,201,130,193,130,130,201,130,0,201,131,141,201,130,3,48,96,0,0,0,0,56,0,204,192,34,1,200,164,
+    255,28,140,255,255,0,227,143,140,192,34,1,192,99,254,122,140,255,255,0,227,111,208,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,134,201,130,0,201,131,140,201,130,
+    3,48,96,0,0,0,0,56,0,204,192,34,0,236,49,140,255,255,1,254,187,192,99,141,192,34,0,218,74,140,255,255,1,255,93,200,164,207,192,34,0,112,33,132,0,0,131,0,
+    0,2,64,129,193,130,193,130,136,201,130,2,201,131,201,130,201,131,135,201,130,3,48,96,0,0,0,0,56,0,203,192,34,1,209,38,255,190,140,255,255,0,218,107,143,192,34,0,
+    245,118,140,255,255,0,236,179,207,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,56,0,203,192,34,0,245,118,140,255,255,1,245,
+    183,192,66,143,192,34,1,201,38,255,190,139,255,255,1,255,223,209,135,206,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,133,201,130,0,201,131,141,201,130,3,48,96,
+    0,0,0,0,56,0,202,192,34,0,209,168,141,255,255,0,209,168,145,192,34,0,227,175,140,255,255,0,245,150,206,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,131,
+    201,130,0,201,131,143,201,130,3,48,96,0,0,0,0,56,0,201,192,34,1,192,67,245,183,140,255,255,0,236,211,146,192,34,1,200,131,254,122,139,255,255,1,255,223,218,42,205,
+    192,34,0,112,1,132,0,0,131,0,0,2,64,129,193,130,193,130,136,201,130,0,201,131,137,201,130,3,40,96,0,0,0,0,56,1,201,192,34,0,227,13,140,255,255,1,254,251,
+    200,131,147,192,34,0,218,74,140,255,255,1,255,60,200,164,204,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,131,201,130,0,201,131,141,201,130,5,193,130,201,130,48,
+    96,0,0,0,0,56,0,200,192,34,1,209,38,255,125,140,255,255,0,218,139,149,192,34,0,245,150,140,255,255,0,236,179,204,192,34,0,112,33,132,0,0,131,0,0,1,64,129,
+    193,130,148,201,130,3,48,96,0,0,0,0,56,0,200,192,34,0,245,118,140,255,255,1,245,183,192,66,149,192,34,1,201,70,255,190,139,255,255,1,255,223,209,135,203,192,34,0,
+    112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,135,201,130,0,201,131,138,201,130,3,40,64,0,0,0,0,56,0,199,192,34,0,209,135,141,255,255,0,209,233,151,192,34,
+    0,236,147,140,255,255,1,245,150,192,66,202,192,34,0,112,33,132,0,0,131,0,0,0,64,129,130,193,130,1,201,130,193,130,144,201,130,3,40,64,0,0,0,0,56,0,198,192,
+    34,1,192,67,245,183,140,255,255,0,245,118,152,192,34,1,201,38,255,158,139,255,255,1,255,223,209,200,202,192,34,0,112,33,132,0,0,131,0,0,0,64,129,131,193,130,143,201,
+    130,5,193,130,201,130,40,96,0,0,0,0,56,0,198,192,34,0,218,107,140,255,255,1,255,191,209,38,153,192,34,0,227,208,140,255,255,1,246,89,192,66,201,192,34,0,112,33,
+    132,0,0,131,0,0,2,64,129,193,130,193,130,130,201,130,0,201,131,143,201,130,3,40,96,0,0,0,0,56,0,197,192,34,1,192,99,254,187,140,255,255,0,236,114,154,192,34,
+    1,192,99,254,186,140,255,255,0,218,237,201,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,40,64,0,0,0,0,56,1,197,192,34,0,227,143,
+    140,255,255,1,254,219,200,164,137,192,34,7,209,168,236,179,254,122,255,61,255,28,245,150,227,143,200,164,137,192,34,1,209,135,255,191,139,255,255,1,254,252,200,132,200,192,34,0,
+    112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,131,201,130,0,201,131,142,201,130,3,40,64,0,0,0,0,56,0,196,192,34,1,200,132,255,93,140,255,255,0,218,139,136,
+    192,34,2,192,67,236,17,255,223,133,255,255,2,255,93,227,110,192,66,136,192,34,0,236,244,140,255,255,0,236,114,200,192,34,0,112,33,132,0,0,131,0,0,8,64,129,193,130,
+    193,130,201,130,193,130,201,130,193,130,201,130,193,130,139,201,130,5,193,130,201,130,40,64,0,0,0,0,56,0,196,192,34,0,236,211,140,255,255,1,245,151,192,67,135,192,34,1,
+    200,132,245,118,137,255,255,1,236,179,192,66,135,192,34,1,201,38,255,158,139,255,255,1,255,223,209,200,199,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,98,193,130,147,
+    201,130,3,40,64,0,0,0,0,56,0,195,192,34,0,218,9,140,255,255,1,255,190,201,70,135,192,34,1,192,66,245,118,139,255,255,0,236,49,136,192,34,0,228,17,140,255,255,
+    1,245,248,192,66,198,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,145,201,130,5,193,130,201,130,40,64,0,0,0,0,56,0,194,192,34,1,192,99,254,122,
+    140,255,255,0,236,49,135,192,34,1,192,66,219,45,140,255,255,1,255,223,209,38,135,192,34,1,200,131,254,252,140,255,255,1,218,139,192,66,197,192,34,0,112,33,132,0,0,131,
+    0,0,3,64,129,193,98,193,130,193,130,133,201,130,0,193,130,139,201,130,3,40,64,0,0,0,0,56,0,194,192,34,0,227,46,140,255,255,1,255,28,200,164,135,192,34,1,192,
+    67,254,219,141,255,255,0,236,179,136,192,34,0,218,204,140,255,255,1,254,251,192,99,197,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,146,201,130,5,193,130,201,130,
+    40,64,0,0,0,0,56,0,193,192,34,1,192,131,255,60,140,255,255,0,227,143,136,192,34,0,209,233,142,255,255,1,254,186,192,66,135,192,34,1,192,67,254,186,140,255,255,0,
+    227,110,197,192,34,0,112,33,132,0,0,131,0,0,0,64,129,131,193,130,1,201,130,193,130,143,201,130,3,40,64,0,0,0,0,56,0,193,192,34,0,227,143,140,255,255,1,254,
+    252,200,131,136,192,34,0,227,175,142,255,255,1,255,223,200,196,136,192,34,0,218,171,140,255,255,1,255,28,200,164,196,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,
+    193,130,146,201,130,4,201,163,32,64,0,0,0,0,56,0,192,192,34,1,200,164,255,93,140,255,255,0,218,204,137,192,34,0,228,17,143,255,255,0,200,229,136,192,34,1,192,66,
+    245,118,140,255,255,0,236,49,196,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,130,201,130,3,193,130,201,130,201,130,193,130,139,201,130,4,209,163,32,32,0,
+    0,0,0,56,0,192,192,34,0,236,179,140,255,255,1,245,118,192,66,137,192,34,0,228,17,142,255,255,1,255,125,200,66,137,192,34,1,200,196,255,93,139,255,255,1,255,190,209,
+    135,195,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,146,201,130,4,201,162,24,64,0,0,0,0,56,0,191,192,34,1,209,200,255,191,139,255,255,1,255,28,
+    200,197,138,192,34,0,228,17,142,255,255,0,255,61,139,192,34,0,227,45,140,255,255,1,254,186,192,99,194,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,98,193,130,146,
+    201,130,4,209,163,24,32,0,0,0,0,56,0,190,192,34,1,192,66,254,89,140,255,255,0,227,175,139,192,34,0,218,204,142,255,255,0,254,89,139,192,34,1,192,66,254,219,140,
+    255,255,0,227,110,194,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,146,201,130,4,209,131,24,32,0,0,0,0,56,0,190,192,34,0,227,45,140,255,255,1,
+    255,28,200,131,139,192,34,0,218,107,142,255,255,0,245,183,140,192,34,0,218,236,140,255,255,1,254,252,200,131,193,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,
+    130,130,201,130,0,193,131,142,201,130,4,209,163,24,32,0,0,0,0,56,0,189,192,34,1,200,164,255,28,140,255,255,0,218,236,140,192,34,0,209,6,142,255,255,0,236,179,140,
+    192,34,1,192,66,245,248,140,255,255,0,236,49,193,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,146,201,130,4,209,163,24,32,0,0,0,0,56,1,189,192,
+    34,0,236,49,140,255,255,1,246,57,192,66,140,192,34,0,200,229,142,255,255,0,228,17,141,192,34,1,209,168,255,223,139,255,255,1,255,190,201,38,192,192,34,0,112,33,132,0,
+    0,131,0,0,2,64,129,193,130,193,130,146,201,130,4,209,162,16,32,0,0,0,0,56,0,188,192,34,1,209,38,255,190,139,255,255,1,255,223,209,168,141,192,34,1,200,34,255,
+    93,141,255,255,0,227,110,142,192,34,0,236,211,140,255,255,0,245,118,192,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,131,201,130,0,201,131,142,201,130,4,209,131,
+    16,32,0,0,0,0,56,0,188,192,34,0,236,244,140,255,255,0,245,53,143,192,34,0,255,61,141,255,255,0,218,171,142,192,34,1,200,229,255,158,140,255,255,0,209,233,191,192,
+    34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,146,201,130,4,209,163,16,32,0,0,0,0,56,0,187,192,34,1,209,70,255,190,139,255,255,1,255,190,209,135,142,
+    192,34,1,192,66,254,57,141,255,255,0,218,106,143,192,34,0,227,78,140,255,255,1,245,183,192,66,190,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,146,201,
+    130,4,209,162,16,32,0,0,0,0,56,0,187,192,34,0,245,150,140,255,255,0,227,143,143,192,34,1,192,66,245,183,141,255,255,0,209,6,143,192,34,1,192,66,245,248,140,255,
+    255,0,227,45,190,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,147,201,130,4,209,163,16,32,0,0,0,0,56,0,186,192,34,0,226,204,140,255,255,1,246,89,192,
+    66,144,192,34,0,237,53,141,255,255,0,200,229,144,192,34,1,209,200,255,223,139,255,255,1,255,190,209,70,189,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,98,193,130,
+    146,201,130,4,209,163,16,32,0,0,0,0,56,0,185,192,34,1,200,229,255,93,139,255,255,1,255,223,209,200,145,192,34,0,228,49,140,255,255,0,255,93,146,192,34,0,236,211,
+    140,255,255,0,245,150,189,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,131,201,130,0,193,130,141,201,130,4,209,130,16,32,0,0,0,0,56,0,185,192,34,
+    0,236,114,140,255,255,0,245,85,146,192,34,0,228,17,140,255,255,0,255,60,146,192,34,1,201,38,255,190,140,255,255,0,209,200,188,192,34,0,112,33,132,0,0,131,0,0,2,
+    64,129,193,130,193,130,146,201,130,4,209,130,16,32,0,0,0,0,56,0,184,192,34,1,201,38,255,158,139,255,255,1,255,223,209,135,146,192,34,0,218,204,140,255,255,0,246,57,
+    147,192,34,0,236,114,140,255,255,1,245,248,192,67,187,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,146,201,130,4,209,163,16,32,0,0,0,0,56,0,184,
+    192,34,0,237,21,140,255,255,1,236,211,192,66,146,192,34,0,218,139,140,255,255,0,245,183,147,192,34,1,200,164,255,93,140,255,255,0,218,171,187,192,34,0,112,33,132,0,0,
+    131,0,0,2,64,129,193,130,193,130,146,201,130,4,209,163,16,32,0,0,0,0,56,0,183,192,34,0,217,200,140,255,255,1,255,93,200,164,147,192,34,0,209,70,140,255,255,0,
+    236,179,148,192,34,0,227,45,140,255,255,1,254,252,200,131,186,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,146,201,130,4,209,162,16,32,0,0,0,0,56,
+    0,182,192,34,1,192,66,246,57,140,255,255,0,219,46,148,192,34,0,209,5,140,255,255,0,228,49,148,192,34,1,192,66,245,215,140,255,255,0,228,17,186,192,34,0,112,33,132,
+    0,0,131,0,0,1,64,129,193,130,147,201,130,4,209,162,16,32,0,0,0,0,56,0,182,192,34,0,218,107,140,255,255,1,254,122,192,67,148,192,34,1,200,164,255,223,139,255,
+    255,0,227,240,149,192,34,1,209,6,255,190,139,255,255,1,255,126,201,5,185,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,147,201,130,4,209,130,16,32,0,0,0,
+    0,56,0,181,192,34,1,192,66,246,89,139,255,255,1,255,223,218,9,150,192,34,0,255,93,139,255,255,0,218,139,150,192,34,0,236,114,140,255,255,1,245,53,192,66,184,192,34,
+    0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,146,201,130,4,209,130,16,32,0,0,0,0,56,0,181,192,34,0,227,143,140,255,255,1,236,179,192,66,150,192,34,0,
+    254,219,139,255,255,0,218,106,150,192,34,1,200,164,255,28,140,255,255,0,218,171,184,192,34,0,112,1,132,0,0,131,0,0,2,64,129,193,98,193,130,146,201,130,4,209,130,16,
+    32,0,0,0,0,56,0,180,192,34,1,209,135,255,190,139,255,255,1,255,93,200,164,151,192,34,0,245,183,139,255,255,0,209,5,151,192,34,0,218,236,140,255,255,1,254,252,200,
+    99,183,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,146,201,130,4,209,130,16,32,0,0,0,0,56,0,179,192,34,1,192,66,245,183,140,255,255,0,227,78,
+    152,192,34,0,245,150,139,255,255,0,200,229,151,192,34,1,192,66,246,57,140,255,255,0,227,208,183,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,147,201,130,4,209,
+    130,24,32,0,0,0,0,56,0,179,192,34,0,210,9,140,255,255,1,254,219,192,67,152,192,34,0,236,49,138,255,255,1,255,158,200,99,152,192,34,0,218,9,140,255,255,1,255,
+    125,200,197,182,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,98,148,201,130,3,24,32,0,0,0,0,56,0,178,192,34,1,192,66,245,248,140,255,255,1,219,45,192,66,
+    152,192,34,0,236,17,138,255,255,0,255,61,153,192,34,1,192,66,245,183,140,255,255,0,236,114,182,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,98,147,201,130,4,209,
+    130,24,32,0,0,0,0,56,0,178,192,34,0,218,139,140,255,255,1,246,57,192,66,153,192,34,0,219,45,138,255,255,0,254,154,154,192,34,1,209,70,255,190,139,255,255,1,255,
+    191,209,70,181,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,98,148,201,130,3,24,32,0,0,0,0,56,0,177,192,34,1,192,99,254,251,139,255,255,1,255,223,209,200,
+    154,192,34,0,218,139,138,255,255,0,245,183,155,192,34,0,227,143,140,255,255,1,245,183,192,66,180,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,24,
+    32,0,0,0,0,56,0,177,192,34,0,227,208,140,255,255,0,235,240,155,192,34,0,209,136,138,255,255,0,237,53,155,192,34,1,192,67,245,248,140,255,255,0,227,45,180,192,34,
+    0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,24,32,0,0,0,0,56,0,176,192,34,1,200,164,255,93,139,255,255,1,254,187,192,67,155,192,34,0,208,229,
+    138,255,255,0,236,49,156,192,34,0,209,233,140,255,255,1,255,158,200,197,179,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,141,201,130,0,193,130,133,201,130,3,24,
+    32,0,0,0,0,56,0,175,192,34,1,192,66,237,20,140,255,255,1,218,171,192,66,155,192,34,0,200,229,138,255,255,0,228,17,157,192,34,0,245,150,140,255,255,0,236,179,179,
+    192,34,0,112,33,132,0,0,131,0,0,2,64,161,193,98,193,130,140,201,130,0,193,130,133,201,130,3,32,64,0,0,0,0,56,0,175,192,34,0,218,107,140,255,255,1,245,248,
+    192,66,156,192,34,1,200,35,255,125,137,255,255,0,227,78,157,192,34,1,201,70,255,190,139,255,255,1,255,223,209,135,178,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,
+    130,193,130,146,201,130,4,201,131,32,64,0,0,0,0,56,0,174,192,34,1,192,99,254,187,139,255,255,1,255,223,209,135,158,192,34,0,255,28,137,255,255,0,218,139,158,192,34,
+    0,236,49,140,255,255,1,245,248,192,66,177,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,32,64,0,0,0,0,56,0,174,192,34,0,227,208,
+    140,255,255,0,236,179,159,192,34,0,254,219,137,255,255,0,209,200,158,192,34,1,200,164,255,28,140,255,255,0,218,171,177,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,
+    130,148,201,130,3,32,64,0,0,0,0,56,0,173,192,34,1,200,164,255,93,139,255,255,1,255,190,200,197,159,192,34,0,245,53,137,255,255,0,201,5,159,192,34,0,227,175,140,
+    255,255,1,254,187,192,66,176,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,40,64,0,0,0,0,56,0,173,192,34,0,228,17,140,255,255,0,
+    236,49,160,192,34,0,236,244,137,255,255,0,200,229,159,192,34,1,200,131,254,187,140,255,255,0,227,46,176,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,
+    201,130,3,40,64,0,0,0,0,56,0,172,192,34,1,201,38,255,158,139,255,255,1,254,219,200,164,160,192,34,0,219,45,136,255,255,0,254,251,161,192,34,1,209,233,255,223,139,
+    255,255,1,255,93,200,196,175,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,40,64,0,0,0,0,56,0,171,192,34,1,192,66,245,118,139,255,255,1,
+    255,223,209,233,161,192,34,1,209,6,255,223,135,255,255,0,236,114,162,192,34,0,236,179,140,255,255,1,245,118,192,66,174,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,
+    130,148,201,130,3,40,64,0,0,0,0,56,0,171,192,34,0,226,236,140,255,255,0,236,179,163,192,34,0,245,86,134,255,255,1,255,125,201,38,162,192,34,1,200,164,255,93,140,
+    255,255,0,218,171,174,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,139,201,130,0,193,130,135,201,130,3,40,64,0,0,0,0,56,0,170,192,34,1,200,196,255,93,
+    139,255,255,1,255,190,200,197,163,192,34,1,200,229,255,93,133,255,255,0,227,78,164,192,34,0,227,176,140,255,255,1,254,187,192,66,173,192,34,0,112,33,132,0,0,131,0,0,
+    2,64,129,193,130,193,130,147,201,130,3,40,64,0,0,0,0,56,0,170,192,34,0,236,114,140,255,255,0,236,114,165,192,34,7,201,38,245,86,255,158,255,255,255,223,254,187,218,
+    236,192,66,164,192,34,1,200,164,255,93,140,255,255,0,227,46,173,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,40,64,0,0,0,0,56,0,169,192,
+    34,1,209,70,255,191,139,255,255,1,255,28,200,164,167,192,34,2,200,132,200,229,200,164,168,192,34,0,227,45,140,255,255,1,255,93,200,164,172,192,34,0,112,33,132,0,0,131,
+    0,0,2,64,129,193,130,193,130,147,201,130,3,40,64,0,0,0,0,56,0,168,192,34,1,192,66,245,183,140,255,255,0,227,45,212,192,34,1,192,66,246,89,140,255,255,0,236,
+    212,172,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,40,64,0,0,0,0,56,0,168,192,34,0,218,171,140,255,255,1,246,89,192,66,213,192,
+    34,1,218,9,255,223,139,255,255,1,255,223,210,9,171,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,40,64,0,0,0,0,56,0,167,192,34,1,192,
+    67,254,187,140,255,255,0,210,41,167,192,34,7,200,197,227,208,245,183,255,28,254,154,244,244,218,107,192,66,167,192,34,0,245,118,140,255,255,1,246,24,192,67,170,192,34,0,112,
+    33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,40,64,0,0,0,0,56,0,167,192,34,0,227,111,140,255,255,1,245,118,192,66,165,192,34,2,200,132,228,17,255,126,
+    133,255,255,1,246,89,218,42,166,192,34,1,200,229,255,93,140,255,255,0,227,45,170,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,64,0,0,0,
+    0,56,1,166,192,34,1,201,38,255,125,139,255,255,1,255,28,200,197,165,192,34,1,201,6,254,154,137,255,255,1,236,114,192,66,165,192,34,0,227,78,140,255,255,1,255,190,201,
+    70,169,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,64,0,0,0,0,56,0,165,192,34,1,192,99,246,24,140,255,255,0,219,45,165,192,34,1,
+    200,132,254,187,139,255,255,0,236,49,165,192,34,1,192,99,246,122,140,255,255,1,245,183,192,66,168,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,
+    3,48,64,0,0,0,0,56,0,165,192,34,0,227,143,140,255,255,1,246,57,192,66,165,192,34,0,236,49,140,255,255,1,255,223,209,200,165,192,34,0,218,9,141,255,255,0,218,
+    139,168,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,164,192,34,1,200,196,255,125,140,255,255,0,218,107,165,192,
+    34,1,200,131,255,158,141,255,255,0,237,53,166,192,34,0,245,151,140,255,255,1,254,186,192,67,167,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,
+    3,48,96,0,0,0,0,56,0,164,192,34,0,236,114,140,255,255,1,245,248,192,66,165,192,34,0,218,139,142,255,255,1,255,126,192,99,165,192,34,1,209,168,255,223,140,255,255,
+    0,227,46,167,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,163,192,34,1,209,167,255,223,140,255,255,0,209,200,
+    166,192,34,0,236,146,143,255,255,0,209,200,166,192,34,0,236,211,140,255,255,1,255,93,200,196,166,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,136,201,130,0,193,
+    130,138,201,130,3,48,96,0,0,0,0,56,0,162,192,34,1,192,66,246,57,140,255,255,0,237,53,167,192,34,0,245,183,143,255,255,0,218,139,166,192,34,1,200,229,255,61,140,
+    255,255,0,236,211,166,192,34,0,112,33,132,0,0,131,0,0,4,64,129,193,130,193,130,201,130,193,130,145,201,130,3,48,96,0,0,0,0,56,0,162,192,34,0,227,78,140,255,
+    255,1,255,190,201,38,167,192,34,0,245,183,143,255,255,0,218,139,167,192,34,0,226,204,140,255,255,1,255,223,218,42,165,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,
+    130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,161,192,34,1,200,164,255,61,140,255,255,0,227,175,168,192,34,0,236,179,143,255,255,0,209,168,168,192,34,0,245,248,140,
+    255,255,1,254,252,200,99,164,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,160,192,34,1,192,66,237,21,140,255,
+    255,1,254,187,192,131,168,192,34,0,219,13,142,255,255,1,255,93,200,99,168,192,34,1,209,200,255,223,140,255,255,0,227,208,164,192,34,0,112,33,132,0,0,131,0,0,2,64,
+    129,193,130,193,130,147,201,130,4,48,96,0,0,0,0,56,0,192,66,159,192,34,0,218,236,141,255,255,0,218,107,169,192,34,1,200,164,255,93,141,255,255,0,236,179,170,192,34,
+    0,237,53,140,255,255,1,255,158,201,38,163,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,56,0,159,192,34,1,200,131,254,252,
+    140,255,255,1,245,183,192,66,170,192,34,0,218,204,140,255,255,1,255,28,200,229,170,192,34,1,201,38,255,158,140,255,255,0,245,21,163,192,34,0,112,33,132,0,0,131,0,0,
+    1,64,129,193,130,148,201,130,3,48,64,0,0,0,0,56,0,159,192,34,0,228,17,140,255,255,1,255,190,209,70,172,192,34,0,236,114,138,255,255,1,255,126,209,233,172,192,34,
+    0,228,17,141,255,255,0,209,200,162,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,56,0,158,192,34,1,192,131,255,61,140,255,
+    255,0,236,114,173,192,34,1,192,67,236,49,136,255,255,1,255,93,218,74,173,192,34,1,200,132,255,93,140,255,255,0,237,53,162,192,34,0,112,33,132,0,0,131,0,0,2,64,
+    129,193,130,193,130,137,201,130,0,193,130,136,201,130,3,48,96,0,0,0,0,56,0,158,192,34,0,218,42,140,255,255,1,255,28,200,164,175,192,34,1,218,74,246,89,132,255,255,
+    2,255,191,236,212,209,38,175,192,34,0,227,143,140,255,255,1,255,158,200,99,161,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,
+    56,0,158,192,34,0,236,212,140,255,255,0,218,139,177,192,34,6,192,66,209,200,227,175,228,17,228,17,218,172,200,197,177,192,34,1,192,99,246,24,140,255,255,0,218,9,161,192,
+    34,0,112,1,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,56,0,158,192,34,0,254,219,139,255,255,1,244,244,192,66,235,192,34,1,209,103,255,
+    190,139,255,255,0,227,240,161,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,56,0,157,192,34,1,200,164,255,223,138,255,255,1,
+    255,158,200,197,237,192,34,0,236,114,139,255,255,0,237,85,161,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,56,1,157,192,34,
+    0,209,38,139,255,255,0,245,248,238,192,34,0,209,6,139,255,255,0,245,215,161,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,
+    0,0,56,0,157,192,34,0,218,107,139,255,255,0,237,150,239,192,34,0,255,61,138,255,255,0,254,219,161,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,
+    201,130,3,48,96,0,0,0,0,56,0,157,192,34,0,218,139,139,255,255,1,254,122,192,67,237,192,34,1,200,229,255,223,138,255,255,0,255,61,161,192,34,0,112,33,132,0,0,
+    131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,56,0,157,192,34,0,209,201,140,255,255,5,245,183,218,42,201,5,200,229,200,132,200,34,184,192,34,129,192,66,
+    131,192,34,0,192,66,140,192,34,0,192,66,152,192,34,2,200,132,210,9,246,24,139,255,255,0,246,57,161,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,98,148,201,130,
+    3,48,96,0,0,0,0,56,0,157,192,34,0,200,229,144,255,255,7,255,190,255,93,255,61,255,61,255,60,255,61,255,61,255,60,132,255,61,132,255,60,3,255,61,255,60,255,60,
+    255,61,130,255,60,129,255,61,130,255,60,1,254,154,245,248,131,245,215,132,253,215,4,245,215,253,215,253,215,245,215,245,215,143,253,215,0,245,215,130,253,215,16,245,215,253,216,245,
+    248,254,154,255,60,255,60,255,61,255,61,255,60,255,61,255,60,255,60,255,61,255,61,255,60,255,60,255,61,142,255,60,129,255,61,130,255,60,129,255,61,0,255,158,141,255,255,0,
+    236,147,161,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,158,192,34,0,255,28,255,255,255,135,255,255,0,218,204,
+    161,192,34,0,112,33,132,0,0,131,0,0,0,64,129,130,193,130,146,201,130,3,48,96,0,0,0,0,56,0,158,192,34,0,236,244,255,255,255,134,255,255,1,255,158,200,164,161,
+    192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,4,48,96,0,0,0,0,56,0,192,66,157,192,34,0,209,200,255,255,255,134,255,255,0,236,179,162,192,34,
+    0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,159,192,34,0,245,216,255,255,255,132,255,255,1,255,158,201,38,162,192,34,
+    0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,159,192,34,1,209,70,255,158,255,255,255,131,255,255,0,227,143,163,192,34,
+    0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,56,0,160,192,34,0,227,78,255,255,255,130,255,255,1,246,122,192,67,163,192,34,0,112,
+    33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,4,48,96,0,0,0,0,56,0,192,66,159,192,34,2,192,66,227,208,255,223,255,255,255,1,255,93,209,135,164,192,
+    34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,4,48,96,0,0,0,0,56,0,192,66,161,192,34,1,218,204,255,158,253,255,255,1,254,219,209,70,165,
+    192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,3,48,96,0,0,0,0,56,0,163,192,34,1,209,135,246,89,251,255,255,1,245,215,200,229,166,192,
+    34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,3,48,96,0,0,0,0,56,0,164,192,34,3,192,66,218,204,245,248,255,223,246,255,255,2,255,61,227,78,192,
+    66,167,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,4,48,96,0,0,0,0,48,0,200,34,166,192,34,2,209,135,236,114,254,219,241,255,255,3,255,191,
+    246,24,227,13,200,99,169,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,4,48,96,0,0,0,0,48,0,200,34,169,192,34,8,200,229,218,74,218,
+    139,218,171,218,172,218,172,218,236,218,236,227,240,131,228,17,132,236,17,132,228,17,0,236,17,130,228,17,0,228,49,136,228,17,130,236,17,129,228,17,130,236,17,129,228,17,0,236,
+    17,130,228,17,0,236,17,135,228,17,136,236,17,1,228,17,236,17,136,228,17,11,236,17,228,17,236,17,228,17,236,17,236,17,228,17,236,17,228,17,236,17,228,17,236,17,132,228,
+    17,7,228,49,228,17,236,17,228,17,236,17,236,17,228,17,228,17,131,236,17,130,228,17,2,219,13,218,74,208,164,172,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,
+    193,130,147,201,130,4,48,96,0,0,0,0,40,0,200,34,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,4,48,96,0,0,0,0,
+    40,0,200,34,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,4,48,96,0,0,0,0,32,0,200,34,255,192,34,201,192,34,0,112,33,132,
+    0,0,131,0,0,1,64,129,193,130,148,201,130,4,48,96,0,0,0,0,32,0,200,34,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,4,
+    48,96,0,0,0,0,24,0,200,66,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,134,201,130,0,201,131,140,201,130,4,48,96,0,0,0,0,16,0,
+    200,66,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,4,48,96,0,0,0,0,8,0,200,67,255,192,34,201,192,34,0,112,33,132,
+    0,0,131,0,0,1,64,129,193,130,148,201,130,4,48,96,0,0,0,0,8,0,200,67,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,0,
+    48,96,130,0,0,0,200,67,255,192,34,201,192,34,0,112,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,0,48,96,130,0,0,0,200,67,255,192,34,201,192,34,0,112,
+    33,132,0,0,131,0,0,3,64,129,193,130,201,130,193,130,146,201,130,0,48,96,130,0,0,0,200,67,255,192,34,201,192,34,0,120,33,132,0,0,131,0,0,1,64,129,193,130,
+    148,201,130,0,48,96,130,0,0,0,200,67,255,192,34,201,192,34,0,120,33,132,0,0,131,0,0,1,64,129,193,130,148,201,130,0,48,96,130,0,0,0,208,67,255,192,34,201,
+    192,34,0,104,1,132,0,0,131,0,0,0,64,129,130,193,130,146,201,130,0,48,96,130,0,0,0,200,67,255,192,34,201,192,34,0,64,0,132,0,0,131,0,0,0,64,129,131,
+    193,130,145,201,130,0,48,96,130,0,0,1,200,66,192,66,255,192,34,199,192,34,1,200,34,8,0,132,0,0,131,0,0,0,64,129,130,193,130,129,201,130,0,193,130,130,201,130,
+    0,193,130,139,201,130,0,48,96,130,0,0,0,200,66,255,192,34,200,192,34,0,128,33,133,0,0,131,0,0,2,64,161,193,130,193,130,147,201,130,0,48,96,130,0,0,0,200,
+    66,255,192,34,200,192,34,0,32,0,133,0,0,131,0,0,0,64,161,130,193,130,145,201,130,1,193,130,80,161,130,0,0,1,168,34,192,66,255,192,34,198,192,34,0,112,33,134,
+    0,0,131,0,0,2,64,129,193,130,193,130,147,201,130,0,112,193,130,0,0,2,128,33,192,66,192,66,255,192,34,196,192,34,0,176,34,135,0,0,131,0,0,0,64,129,130,193,
+    130,146,201,130,0,161,66,130,0,0,2,48,0,200,66,192,66,255,192,34,195,192,34,1,176,34,32,0,135,0,0,131,0,0,2,64,161,193,130,193,130,147,201,130,1,201,163,32,
+    64,130,0,0,1,128,33,192,66,255,192,34,194,192,34,1,152,34,8,0,136,0,0,131,0,0,2,64,129,193,130,193,130,130,201,130,0,193,130,144,201,130,0,145,34,131,0,0,
+    3,128,33,200,66,192,66,192,66,255,192,34,189,192,34,1,184,34,88,1,138,0,0,131,0,0,2,64,129,193,130,193,130,149,201,130,0,80,161,131,0,0,3,48,0,128,33,176,
+    34,200,66,255,192,34,184,192,34,4,200,34,192,34,144,34,80,1,8,0,139,0,0,131,0,0,1,64,129,193,130,150,201,130,1,193,130,48,64,133,0,0,2,8,0,56,0,56,
+    0,130,64,0,29,56,0,64,1,64,1,64,0,64,1,64,1,64,0,64,1,56,0,64,1,64,1,56,1,56,1,64,1,64,0,64,0,56,1,56,1,56,0,64,0,64,1,56,
+    1,56,1,64,1,56,1,56,1,64,1,56,1,56,0,64,0,132,64,1,129,64,0,0,64,1,132,64,0,130,64,1,129,64,0,0,56,0,135,64,0,130,64,1,131,64,0,7,
+    64,1,64,0,64,1,64,1,56,1,64,1,64,0,56,0,131,64,1,0,64,0,130,64,1,129,64,0,133,64,1,3,64,0,64,1,64,0,56,0,136,64,0,129,56,0,132,64,
+    0,0,56,0,197,64,0,1,56,0,32,0,143,0,0,131,0,0,1,64,129,193,130,150,201,130,129,193,130,0,80,161,255,0,0,207,0,0,131,0,0,1,64,129,193,130,133,201,
+    130,0,201,131,146,201,130,1,137,2,32,64,255,0,0,205,0,0,131,0,0,1,64,129,193,130,153,201,130,8,193,130,201,131,153,66,88,193,64,128,48,96,32,64,16,32,8,0,
+    132,0,0,137,8,0,0,0,0,130,8,0,0,16,0,130,24,0,1,32,0,24,0,132,0,0,0,8,0,143,24,0,0,16,0,131,0,0,0,8,0,138,24,0,130,16,0,2,
+    24,0,16,0,16,0,130,24,0,132,0,0,138,24,0,129,16,0,179,24,0,129,32,0,0,8,0,172,24,0,1,32,0,24,0,133,0,0,131,0,0,1,64,129,193,130,203,201,
+    130,130,193,130,130,201,131,0,161,66,130,0,0,15,32,0,192,67,200,66,200,35,200,34,200,34,200,66,200,67,200,34,200,66,200,66,200,35,200,34,200,35,200,34,200,35,132,200,
+    34,1,200,67,88,33,130,0,0,1,80,1,200,35,139,200,34,0,200,35,172,200,34,0,200,35,134,200,34,0,200,35,131,200,34,0,200,35,135,200,34,0,200,35,130,200,34,0,
+    200,35,150,200,34,0,200,67,131,200,34,1,200,35,104,33,132,0,0,131,0,0,1,64,129,193,130,209,201,130,0,177,98,130,0,0,1,88,1,192,66,147,192,34,0,88,1,130,
+    0,0,0,128,1,242,192,34,0,128,33,132,0,0,131,0,0,1,64,129,193,130,209,201,130,0,193,130,130,0,0,0,88,1,148,192,34,0,88,1,130,0,0,0,128,33,242,192,
+    34,0,128,33,132,0,0,131,0,0,1,64,129,193,130,209,201,130,0,193,130,130,0,0,0,88,1,148,192,34,0,88,1,130,0,0,0,128,33,242,192,34,0,120,33,132,0,0,
+    131,0,0,1,64,129,193,130,209,201,130,0,193,131,130,0,0,0,88,1,148,192,34,0,96,1,130,0,0,0,128,33,242,192,34,0,128,33,132,0,0,131,0,0,1,64,129,193,
+    130,209,201,130,0,193,130,130,0,0,0,88,1,148,192,34,0,104,1,130,0,0,0,128,33,242,192,34,0,128,33,132,0,0,131,0,0,1,64,129,193,130,209,201,130,0,201,163,
+    130,0,0,0,88,1,148,192,34,0,112,33,130,0,0,0,128,1,242,192,34,0,128,33,132,0,0,131,0,0,2,64,129,193,130,193,130,208,201,130,0,201,163,130,0,0,0,88,
+    1,148,192,34,0,120,33,130,0,0,0,128,33,242,192,34,0,128,33,132,0,0,131,0,0,2,64,129,193,130,193,130,208,201,130,0,201,131,130,0,0,1,88,1,192,66,147,192,
+    34,0,120,33,130,0,0,0,128,1,242,192,34,0,128,33,132,0,0,131,0,0,2,64,129,193,130,193,130,208,201,130,0,209,163,130,0,0,1,88,1,192,66,147,192,34,0,120,
+    1,130,0,0,0,128,1,242,192,34,0,128,33,132,0,0,131,0,0,1,64,129,193,130,209,201,130,0,209,163,130,0,0,0,88,1,148,192,34,0,128,1,130,0,0,0,128,1,
+    242,192,34,0,128,33,132,0,0,131,0,0,1,64,129,193,130,209,201,130,0,209,163,130,0,0,0,88,1,148,192,34,0,128,1,130,0,0,1,128,33,192,66,241,192,34,0,120,
+    33,132,0,0,131,0,0,1,64,129,193,130,209,201,130,0,209,163,130,0,0,0,88,1,148,192,34,0,128,33,130,0,0,3,32,0,168,34,184,34,184,34,162,192,34,2,184,34,
+    192,34,192,34,133,184,34,1,176,34,184,34,133,176,34,147,168,34,129,160,34,5,168,34,160,34,168,34,160,34,168,34,168,34,134,160,34,0,168,34,131,160,34,0,168,34,133,160,
+    34,1,168,34,160,34,132,168,34,0,176,34,130,184,34,2,192,34,160,34,32,0,132,0,0,131,0,0,1,56,129,193,130,209,201,130,0,209,163,130,0,0,0,88,1,148,192,34,
+    0,128,33,252,0,0,131,0,0,1,56,129,193,130,181,201,130,0,193,130,154,201,130,0,209,163,130,0,0,1,88,1,192,66,147,192,34,0,128,33,252,0,0,131,0,0,1,48,
+    129,193,130,209,201,130,0,209,163,130,0,0,0,88,33,147,192,34,1,192,66,128,33,252,0,0,131,0,0,1,56,129,193,130,209,201,130,0,209,163,130,0,0,0,88,1,148,192,
+    34,0,120,33,252,0,0,131,0,0,1,56,96,193,130,209,201,130,0,209,163,130,0,0,0,88,1,148,192,34,0,120,33,252,0,0,131,0,0,1,48,96,193,130,209,201,130,0,
+    209,163,130,0,0,0,88,33,148,192,34,0,128,33,252,0,0,131,0,0,1,48,96,193,130,209,201,130,0,209,163,130,0,0,1,88,1,192,66,147,192,34,0,128,33,252,0,0,
+    131,0,0,1,48,96,193,130,209,201,130,0,209,163,130,0,0,0,88,33,148,192,34,0,128,33,252,0,0,131,0,0,1,48,96,193,130,209,201,130,0,209,163,130,0,0,1,88,
+    33,192,66,146,192,34,1,192,66,128,33,131,0,0,31,8,32,64,192,64,192,72,224,72,224,80,224,97,0,97,32,105,32,113,32,113,64,113,64,121,96,121,64,121,96,121,96,113,
+    96,121,64,121,97,121,97,121,96,121,97,121,97,121,96,129,96,137,128,145,129,153,161,161,193,161,193,169,193,169,193,134,169,225,145,178,1,8,177,225,169,193,161,193,161,193,153,161,
+    153,161,145,129,137,129,137,129,131,129,129,10,129,96,129,129,129,129,121,97,121,97,121,96,121,97,121,97,129,97,121,97,121,96,131,121,97,0,121,96,131,121,97,3,121,96,121,97,
+    121,97,121,96,135,121,97,129,121,96,10,121,97,121,96,121,97,121,96,121,97,121,97,121,96,121,97,121,97,105,32,8,0,133,0,0,131,0,0,1,48,96,193,130,209,201,130,0,
+    209,163,130,0,0,1,88,1,192,66,146,192,34,1,192,66,128,33,131,0,0,0,194,33,240,226,97,1,202,33,24,64,132,0,0,131,0,0,0,48,96,210,201,130,0,209,163,130,
+    0,0,1,88,33,192,66,146,192,34,1,192,66,128,33,130,0,0,0,72,192,242,226,97,0,129,97,132,0,0,131,0,0,0,48,96,210,201,130,0,209,163,130,0,0,0,88,1,
+    147,192,34,1,192,66,128,33,130,0,0,0,97,0,242,226,97,0,137,129,132,0,0,131,0,0,0,48,96,210,201,130,0,209,163,130,0,0,0,88,1,147,192,34,1,192,66,128,
+    33,130,0,0,0,97,0,242,226,97,0,137,129,132,0,0,131,0,0,2,48,96,193,130,193,130,208,201,130,0,209,163,130,0,0,1,88,1,192,66,147,192,34,0,128,33,130,0,
+    0,0,97,0,242,226,97,0,137,129,132,0,0,131,0,0,2,40,96,201,131,193,130,208,201,130,0,209,163,130,0,0,0,88,1,148,192,34,0,128,33,130,0,0,0,89,0,242,
+    226,97,0,137,129,132,0,0,131,0,0,1,32,64,201,163,209,201,130,0,209,163,130,0,0,0,88,1,148,192,34,0,144,33,130,0,0,0,40,96,242,226,97,0,137,129,132,0,
+    0,131,0,0,1,24,32,209,163,209,201,130,4,209,163,8,0,0,0,0,0,88,1,149,192,34,131,0,0,0,186,1,241,226,97,0,137,129,132,0,0,131,0,0,1,8,0,209,
+    195,209,201,130,4,209,163,8,0,0,0,0,0,88,33,149,192,34,0,88,33,130,0,0,1,32,96,210,65,240,226,97,0,137,129,132,0,0,132,0,0,1,209,163,193,130,208,201,
+    130,0,209,163,130,0,0,1,88,1,192,66,149,192,34,0,8,0,130,0,0,5,16,32,169,225,234,129,226,97,226,97,226,98,235,226,97,0,121,97,132,0,0,132,0,0,1,177,
+    98,193,130,208,201,130,4,209,163,8,0,0,0,0,0,88,1,150,192,34,0,136,33,132,0,0,4,32,96,80,224,97,0,97,32,97,0,136,97,32,129,97,0,130,97,32,129,105,
+    32,132,113,64,130,113,32,131,113,64,129,113,32,132,113,64,0,113,32,147,113,64,129,121,64,130,113,64,134,121,64,2,113,64,121,64,113,64,141,121,64,4,129,97,121,96,129,96,
+    129,97,129,96,134,129,97,129,129,96,133,129,97,2,137,97,105,32,8,32,132,0,0,132,0,0,1,145,34,201,131,208,201,130,4,209,163,8,0,0,0,0,0,88,1,151,192,34,
+    1,136,33,8,0,248,0,0,132,0,0,0,96,193,209,201,130,5,209,163,8,0,0,0,0,0,88,1,192,66,151,192,34,1,176,34,64,0,247,0,0,132,0,0,1,16,32,201,
+    163,208,201,130,4,209,163,16,0,0,0,0,0,80,1,153,192,34,9,200,34,176,34,120,33,88,1,48,0,40,0,48,0,40,0,24,0,24,0,144,16,0,5,24,0,16,0,16,
+    0,24,0,16,0,24,0,209,16,0,0,8,0,132,0,0,133,0,0,1,169,98,193,130,207,201,130,4,209,163,16,32,0,0,0,0,80,1,158,192,34,134,200,34,131,208,34,132,
+    200,34,130,208,34,129,200,34,1,208,34,200,34,132,208,34,2,208,35,208,34,208,34,130,208,35,132,208,34,2,208,35,208,34,200,34,130,208,34,130,208,35,130,208,34,129,208,35,
+    131,208,34,0,200,35,135,208,34,129,208,35,129,208,34,6,200,34,200,35,208,34,208,34,200,34,208,35,208,34,130,208,35,2,200,34,208,34,208,35,130,208,34,5,200,34,208,34,
+    208,34,200,34,208,35,200,35,132,200,34,134,208,34,132,208,35,1,200,35,128,34,132,0,0,133,0,0,0,104,193,208,201,130,4,209,163,16,32,0,0,0,0,80,1,255,192,34,
+    140,192,34,0,128,33,132,0,0,133,0,0,1,24,32,201,163,207,201,130,4,209,163,24,32,0,0,0,0,80,1,255,192,34,140,192,34,0,120,33,132,0,0,134,0,0,0,137,
+    2,207,201,130,4,209,163,24,32,0,0,0,0,80,1,255,192,34,140,192,34,0,96,1,132,0,0,134,0,0,1,40,64,201,163,206,201,130,4,209,163,24,32,0,0,0,0,80,
+    0,255,192,34,140,192,34,0,64,0,132,0,0,135,0,0,1,137,2,193,131,205,201,130,4,201,163,24,32,0,0,0,0,72,0,255,192,34,139,192,34,1,200,66,24,0,132,0,
+    0,135,0,0,2,24,32,193,131,201,131,204,201,130,4,209,163,24,32,0,0,0,0,64,1,255,192,34,139,192,34,0,168,34,133,0,0,136,0,0,0,80,161,205,201,130,4,209,
+    163,24,32,0,0,0,0,56,0,255,192,34,139,192,34,0,88,1,133,0,0,137,0,0,2,104,225,201,130,193,130,202,201,130,5,209,163,24,32,0,0,0,0,56,0,192,66,255,
+    192,34,138,192,34,0,8,0,133,0,0,138,0,0,0,112,225,203,201,130,4,209,131,24,32,0,0,0,0,48,0,255,192,34,138,192,34,0,88,1,134,0,0,139,0,0,2,145,
+    34,193,130,193,130,200,201,130,4,209,163,24,32,0,0,0,0,48,0,255,192,34,137,192,34,0,168,34,135,0,0,140,0,0,1,137,2,201,131,200,201,130,5,201,163,24,32,0,
+    0,0,0,48,0,192,66,255,192,34,135,192,34,1,184,34,32,0,135,0,0,141,0,0,1,88,161,193,130,199,201,130,4,201,163,24,32,0,0,0,0,48,0,255,192,34,135,192,
+    34,1,160,34,16,0,136,0,0,142,0,0,2,8,32,120,225,201,163,197,201,130,5,201,163,40,64,0,0,0,0,48,0,192,66,255,192,34,132,192,34,1,200,34,128,1,138,0,
+    0,144,0,0,2,32,64,129,1,201,131,195,201,130,4,201,163,40,96,0,0,0,0,48,0,255,192,34,132,192,34,1,160,34,48,0,139,0,0,146,0,0,5,8,0,88,193,161,
+    66,209,163,193,130,193,130,134,201,130,129,193,130,3,201,130,193,130,193,130,201,130,134,193,130,0,201,130,135,193,130,0,201,130,136,193,130,0,201,130,132,193,130,129,201,130,129,193,
+    130,129,201,130,130,193,130,129,201,130,129,193,130,129,201,130,9,193,130,201,130,201,130,201,163,24,32,0,0,0,0,16,0,192,66,192,66,131,192,34,7,192,66,192,34,192,34,192,
+    66,192,66,192,34,192,34,192,66,160,192,34,0,192,66,147,192,34,0,192,66,135,192,34,0,192,66,132,192,34,0,192,66,147,192,34,133,192,66,144,192,34,5,192,66,192,34,192,
+    34,200,34,128,33,48,0,141,0,0,149,0,0,4,8,0,56,128,88,193,104,225,121,1,133,129,2,132,129,1,131,129,2,131,129,1,131,129,2,132,129,1,131,129,2,133,129,1,
+    131,129,2,130,129,1,132,129,2,0,129,1,130,129,2,2,129,1,128,225,129,1,130,129,2,1,129,1,104,193,131,0,0,1,32,0,88,33,130,88,1,0,88,33,137,88,1,0,
+    96,1,131,104,1,1,112,1,104,1,135,112,1,130,120,1,129,120,33,129,128,33,0,128,1,130,128,33,2,120,1,128,33,128,33,130,120,33,129,128,33,2,120,33,128,33,120,33,
+    131,128,33,5,120,33,128,33,128,1,128,33,120,33,120,33,131,128,33,0,120,33,134,128,33,132,120,33,129,128,33,0,120,33,131,128,33,0,120,33,131,128,33,8,120,33,128,33,
+    120,33,128,33,120,33,120,33,128,33,120,33,120,33,130,128,33,134,120,33,0,128,33,133,120,33,11,120,1,120,33,120,1,112,1,112,1,120,1,112,1,112,1,104,1,88,1,80,
+    1,48,0,144,0,0,255,0,0,239,0,0,255,0,0,239,0,0,255,0,0,239,0,0,
+    // engine_on
+    82,76,85,0,127,0,0,0,0,0,3,0,0,0,32,0,0,0,49,0,0,0,67,0,0,0,81,0,0,0,95,0,0,0,109,0,0,0,123,0,0,0,137,0,0,0,151,0,
+    0,0,165,0,0,0,179,0,0,0,193,0,0,0,207,0,0,0,221,0,0,0,235,0,0,0,249,0,0,0,7,1,0,0,21,1,0,0,35,1,0,0,49,1,0,0,63,1,
+    0,0,77,1,0,0,91,1,0,0,105,1,0,0,119,1,0,0,133,1,0,0,147,1,0,0,161,1,0,0,175,1,0,0,189,1,0,0,203,1,0,0,217,1,0,0,231,1,
+    0,0,245,1,0,0,3,2,0,0,17,2,0,0,31,2,0,0,45,2,0,0,59,2,0,0,73,2,0,0,87,2,0,0,101,2,0,0,115,2,0,0,129,2,0,0,143,2,
+    0,0,157,2,0,0,171,2,0,0,185,2,0,0,199,2,0,0,213,2,0,0,227,2,0,0,241,2,0,0,255,2,0,0,13,3,0,0,27,3,0,0,43,3,0,0,59,3,
+    0,0,77,3,0,0,96,3,0,0,109,3,0,0,122,3,0,0,135,3,0,0,148,3,0,0,161,3,0,0,174,3,0,0,187,3,0,0,200,3,0,0,213,3,0,0,226,3,
+    0,0,239,3,0,0,252,3,0,0,9,4,0,0,22,4,0,0,44,4,0,0,69,4,0,0,94,4,0,0,119,4,0,0,144,4,0,0,171,4,0,0,208,4,0,0,251,4,
+    0,0,54,5,0,0,109,5,0,0,184,5,0,0,1,6,0,0,72,6,0,0,142,6,0,0,207,6,0,0,16,7,0,0,77,7,0,0,138,7,0,0,199,7,0,0,4,8,
+    0,0,65,8,0,0,130,8,0,0,193,8,0,0,7,9,0,0,78,9,0,0,149,9,0,0,214,9,0,0,15,10,0,0,60,10,0,0,87,10,0,0,114,10,0,0,127,10,
+    0,0,140,10,0,0,153,10,0,0,166,10,0,0,179,10,0,0,192,10,0,0,205,10,0,0,218,10,0,0,231,10,0,0,244,10,0,0,1,11,0,0,14,11,0,0,27,11,
+    0,0,40,11,0,0,53,11,0,0,66,11,0,0,81,11,0,0,97,11,0,0,115,11,0,0,132,11,0,0,155,11,0,0,212,0,0,187,0,0,3,9,64,26,160,35,64,35,
+    128,139,35,160,4,43,160,35,160,35,64,18,64,0,128,131,0,0,185,0,0,1,0,96,26,224,148,35,224,0,18,32,130,0,0,184,0,0,1,0,32,35,64,150,35,224,2,18,
+    32,0,0,0,0,184,0,0,0,17,224,152,35,224,1,0,128,0,0,184,0,0,0,35,96,152,35,224,1,18,64,0,0,183,0,0,0,8,160,153,35,224,1,35,128,0,0,183,
+    0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,43,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,
+    35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,43,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,
+    0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,
+    192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,
+    160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,
+    0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,
+    1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,
+    0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,
+    35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,
+    0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,
+    192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,
+    160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,
+    0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,1,35,160,0,0,183,0,0,0,8,160,153,35,224,1,35,160,0,0,183,0,0,0,8,192,153,35,224,
+    1,35,160,0,0,183,0,0,0,9,96,153,35,224,1,35,160,0,0,183,0,0,0,18,0,153,35,224,1,35,160,0,0,183,0,0,0,35,96,153,35,224,1,35,160,0,0,182,
+    0,0,0,9,128,154,35,224,1,35,160,0,0,181,0,0,1,0,192,35,160,154,35,224,1,35,160,0,0,180,0,0,1,9,32,35,160,155,35,224,1,35,160,0,0,177,0,0,
+    2,0,32,8,192,26,128,157,35,224,1,35,160,0,0,1,0,0,18,64,174,35,128,0,35,160,160,35,224,1,35,160,0,0,1,0,0,26,96,208,35,224,1,35,160,0,0,1,
+    0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,
+    160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,
+    35,224,1,35,160,0,0,1,0,0,26,96,208,35,224,1,35,160,0,0,1,0,0,26,96,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,
+    0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,161,35,224,140,35,128,0,35,192,160,35,224,1,35,160,0,0,1,0,
+    0,26,64,160,35,224,0,26,192,140,0,0,0,18,32,160,35,224,1,35,160,0,0,1,0,0,26,64,160,35,224,0,9,64,140,0,0,0,0,128,160,35,224,1,35,160,0,0,
+    1,0,0,26,64,159,35,224,0,35,128,142,0,0,0,27,0,159,35,224,1,35,160,0,0,1,0,0,26,128,159,35,224,0,18,64,142,0,0,0,17,160,159,35,224,1,35,160,
+    0,0,1,0,0,26,64,159,35,224,0,9,0,142,0,0,1,0,96,35,192,158,35,224,1,35,160,0,0,1,0,0,26,64,155,35,224,3,35,192,17,224,9,32,9,0,144,0,
+    0,3,9,0,9,32,17,192,35,128,155,35,224,1,35,160,0,0,1,0,0,26,64,155,35,224,0,17,192,136,0,0,4,0,32,8,128,8,160,8,128,0,32,136,0,0,2,0,
+    64,18,32,35,192,153,35,224,1,35,160,0,0,1,0,0,26,64,151,35,224,4,27,0,17,160,17,128,35,224,9,32,133,0,0,3,0,32,9,128,27,0,35,192,130,35,224,3,
+    35,192,26,224,9,96,0,32,135,0,0,1,0,64,18,64,152,35,224,1,35,160,0,0,1,0,0,26,64,149,35,224,6,35,192,9,64,0,0,0,0,0,96,35,224,9,32,132,
+    0,0,1,8,192,35,96,136,35,224,1,35,96,8,224,136,0,0,1,8,192,35,96,150,35,224,1,35,160,0,0,1,0,0,26,64,148,35,224,1,35,192,8,224,130,0,0,2,
+    0,96,35,224,9,32,131,0,0,14,9,64,35,192,35,224,35,224,26,224,17,160,8,224,0,96,8,224,17,160,27,0,35,224,35,224,35,192,9,64,136,0,0,2,0,32,17,224,
+    35,160,148,35,224,1,35,160,0,0,1,0,0,26,64,148,35,224,0,9,64,131,0,0,2,0,96,35,224,9,32,130,0,0,4,9,0,35,224,35,224,35,96,9,32,134,0,0,
+    4,9,32,35,96,35,224,35,224,9,0,137,0,0,2,0,64,35,64,35,192,132,35,128,0,35,192,140,35,224,1,35,160,0,0,1,0,0,26,64,147,35,224,0,26,224,132,0,
+    0,9,0,96,35,224,9,32,0,0,0,0,0,64,35,128,35,224,26,192,0,32,136,0,0,4,0,32,26,224,35,224,35,128,0,64,137,0,0,1,34,224,26,32,132,0,0,0,
+    17,224,140,35,224,1,35,160,0,0,1,0,0,26,64,139,35,224,135,17,128,0,8,160,132,0,0,8,0,96,35,224,9,32,0,0,0,0,26,160,35,224,35,160,0,64,138,0,
+    0,3,0,96,35,192,35,224,18,64,137,0,0,1,34,224,26,32,132,0,0,0,17,224,140,35,224,1,35,160,0,0,1,0,0,26,64,138,35,224,0,43,224,141,0,0,7,0,
+    96,35,224,9,32,0,0,0,128,35,224,35,224,17,224,140,0,0,3,17,224,35,224,35,192,0,96,136,0,0,1,34,224,26,32,132,0,0,0,17,224,140,35,224,1,35,160,0,
+    0,1,0,0,26,64,138,35,224,0,43,224,141,0,0,7,0,96,35,224,9,32,0,0,17,128,35,224,35,192,0,32,140,0,0,3,0,64,35,192,35,224,17,128,136,0,0,1,
+    34,224,26,32,132,0,0,0,17,224,140,35,224,1,35,160,0,0,1,0,0,26,64,138,35,224,0,43,224,141,0,0,6,0,96,35,224,9,32,0,0,26,128,35,224,26,224,142,
+    0,0,2,26,224,35,224,26,96,136,0,0,1,34,224,26,32,132,0,0,0,17,224,140,35,224,1,35,160,0,0,1,0,0,26,64,138,35,224,0,43,224,141,0,0,6,0,96,
+    35,224,9,32,0,0,26,224,35,224,18,0,142,0,0,2,18,64,35,224,26,192,136,0,0,1,34,224,26,32,132,0,0,0,17,224,140,35,224,1,35,160,0,0,1,0,0,26,
+    64,138,35,224,0,43,224,141,0,0,6,0,96,35,224,9,32,0,0,26,224,35,224,17,224,142,0,0,2,18,0,35,224,26,192,136,0,0,1,34,224,26,32,132,0,0,0,17,
+    224,140,35,224,1,35,160,0,0,1,0,0,26,64,138,35,224,0,43,224,141,0,0,6,0,96,35,224,9,32,0,0,26,192,35,224,26,96,142,0,0,2,26,96,35,224,26,128,
+    136,0,0,1,34,224,26,32,132,0,0,0,17,224,140,35,224,1,35,160,0,0,1,0,0,26,64,138,35,224,0,43,224,141,0,0,6,0,96,35,224,9,32,0,0,18,0,35,
+    224,35,64,142,0,0,2,35,96,35,224,17,224,136,0,0,1,34,224,26,32,132,0,0,0,17,224,140,35,224,1,35,160,0,0,1,0,0,26,64,138,35,224,0,43,224,141,0,
+    0,7,0,96,35,224,9,32,0,0,8,192,35,224,35,224,9,32,140,0,0,3,8,192,35,224,35,224,8,224,136,0,0,1,34,224,26,32,132,0,0,0,17,224,140,35,224,1,
+    35,160,0,0,1,0,0,26,64,138,35,224,0,43,224,141,0,0,7,0,96,35,224,9,32,0,0,0,0,26,224,35,224,27,32,140,0,0,2,26,224,35,224,35,32,137,0,0,
+    1,34,224,26,32,132,0,0,0,17,224,140,35,224,1,35,160,0,0,1,0,0,26,64,139,35,224,135,35,96,0,18,0,132,0,0,8,0,96,35,224,9,32,0,0,0,0,8,
+    192,35,224,35,224,17,224,138,0,0,3,17,192,35,224,35,224,8,224,137,0,0,1,34,224,26,32,132,0,0,0,17,224,140,35,224,1,35,160,0,0,1,0,0,26,64,147,35,
+    224,1,35,128,0,32,131,0,0,2,0,96,35,224,9,32,130,0,0,4,18,0,35,224,35,224,18,0,0,32,135,0,0,3,17,192,35,224,35,224,18,64,138,0,0,1,34,224,
+    26,160,132,9,32,0,26,128,140,35,224,1,35,160,0,0,1,0,0,26,64,148,35,224,1,26,192,0,32,130,0,0,2,0,96,35,224,9,32,131,0,0,5,26,96,35,224,35,
+    224,35,64,9,64,0,32,131,0,0,5,9,64,27,32,35,224,35,224,26,192,0,32,137,0,0,1,9,96,35,160,147,35,224,1,35,160,0,0,1,0,0,26,64,149,35,224,6,
+    26,224,0,96,0,0,0,0,0,96,35,224,9,32,132,0,0,0,18,0,130,35,224,4,35,192,27,0,26,192,27,0,35,160,130,35,224,0,18,32,137,0,0,1,8,224,27,32,
+    149,35,224,1,35,160,0,0,1,0,0,26,64,150,35,224,5,35,160,18,64,9,64,9,96,35,224,9,32,133,0,0,2,0,128,18,64,35,160,132,35,224,2,35,160,18,64,0,
+    128,136,0,0,1,0,96,26,128,151,35,224,1,35,160,0,0,1,0,0,26,64,155,35,224,0,9,32,135,0,0,6,0,32,9,0,17,160,17,192,17,128,9,0,0,32,137,0,
+    0,1,17,160,35,192,152,35,224,1,35,160,0,0,1,0,0,26,64,155,35,224,0,18,32,150,0,0,1,9,0,27,32,154,35,224,1,35,160,0,0,1,0,0,26,64,156,35,
+    224,0,26,224,147,26,32,1,26,64,27,0,156,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,
+    0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,
+    0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,
+    224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,26,64,208,35,224,1,35,160,0,0,1,0,0,
+    26,64,208,35,224,1,35,160,0,0,1,0,0,18,0,208,35,224,1,35,128,0,0,1,0,0,9,96,208,35,224,1,27,32,0,0,2,0,0,0,64,35,192,207,35,224,1,17,
+    192,0,0,129,0,0,0,26,96,206,35,224,2,35,192,0,64,0,0,129,0,0,1,0,96,35,96,205,35,224,2,17,224,0,0,0,0,130,0,0,1,0,96,27,32,203,35,224,
+    0,18,32,130,0,0,132,0,0,2,9,64,26,192,35,160,197,43,192,2,35,128,26,96,0,160,131,0,0,212,0,0,
+    // engine_off
+    82,76,85,0,127,0,0,0,0,0,3,0,0,0,42,0,0,0,63,0,0,0,79,0,0,0,95,0,0,0,109,0,0,0,125,0,0,0,141,0,0,0,157,0,0,0,173,0,
+    0,0,189,0,0,0,205,0,0,0,221,0,0,0,237,0,0,0,253,0,0,0,13,1,0,0,29,1,0,0,45,1,0,0,61,1,0,0,77,1,0,0,93,1,0,0,109,1,
+    0,0,125,1,0,0,141,1,0,0,157,1,0,0,173,1,0,0,189,1,0,0,205,1,0,0,221,1,0,0,237,1,0,0,253,1,0,0,13,2,0,0,29,2,0,0,45,2,
+    0,0,61,2,0,0,77,2,0,0,93,2,0,0,109,2,0,0,125,2,0,0,141,2,0,0,157,2,0,0,173,2,0,0,189,2,0,0,205,2,0,0,221,2,0,0,237,2,
+    0,0,253,2,0,0,13,3,0,0,29,3,0,0,45,3,0,0,61,3,0,0,77,3,0,0,93,3,0,0,107,3,0,0,121,3,0,0,137,3,0,0,153,3,0,0,169,3,
+    0,0,187,3,0,0,224,3,0,0,239,3,0,0,254,3,0,0,11,4,0,0,24,4,0,0,37,4,0,0,52,4,0,0,65,4,0,0,80,4,0,0,95,4,0,0,110,4,
+    0,0,125,4,0,0,140,4,0,0,153,4,0,0,166,4,0,0,197,4,0,0,222,4,0,0,253,4,0,0,22,5,0,0,49,5,0,0,80,5,0,0,119,5,0,0,158,5,
+    0,0,221,5,0,0,34,6,0,0,107,6,0,0,184,6,0,0,252,6,0,0,73,7,0,0,138,7,0,0,199,7,0,0,4,8,0,0,63,8,0,0,122,8,0,0,183,8,
+    0,0,242,8,0,0,51,9,0,0,114,9,0,0,192,9,0,0,3,10,0,0,74,10,0,0,147,10,0,0,212,10,0,0,5,11,0,0,36,11,0,0,71,11,0,0,105,11,
+    0,0,120,11,0,0,135,11,0,0,148,11,0,0,161,11,0,0,174,11,0,0,187,11,0,0,202,11,0,0,217,11,0,0,232,11,0,0,247,11,0,0,6,12,0,0,19,12,
+    0,0,32,12,0,0,45,12,0,0,58,12,0,0,72,12,0,0,88,12,0,0,108,12,0,0,129,12,0,0,229,12,0,0,212,0,0,187,0,0,3,49,32,131,0,171,193,188,
+    33,134,196,97,9,204,129,204,97,196,97,196,97,204,129,204,129,196,97,171,193,106,128,16,96,131,0,0,185,0,0,2,0,32,147,97,237,66,146,237,35,1,229,34,98,64,130,0,
+    0,185,0,0,0,171,225,150,237,35,2,98,64,0,0,0,0,184,0,0,0,81,224,151,237,35,2,229,34,16,96,0,0,184,0,0,0,180,1,152,237,35,1,106,128,0,0,183,
+    0,0,1,8,32,237,66,152,237,35,1,188,65,0,0,183,0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,0,0,1,16,96,237,98,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,98,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,96,237,98,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,64,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,0,0,1,16,64,237,66,152,237,35,1,204,225,0,0,183,0,0,1,16,64,237,98,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,64,237,98,152,237,35,1,205,1,0,0,183,0,0,1,16,64,237,66,152,237,35,1,205,1,0,0,183,0,0,1,8,96,237,66,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,96,237,98,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,64,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,0,0,1,8,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,64,237,66,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,96,237,66,152,237,35,1,205,1,0,0,183,0,0,1,16,64,237,66,152,237,35,1,205,1,0,0,183,
+    0,0,1,16,96,237,66,152,237,35,1,204,225,0,0,183,0,0,1,57,64,237,66,152,237,35,1,204,225,0,0,183,0,0,0,90,32,153,237,35,1,204,225,0,0,183,0,0,
+    0,180,1,153,237,35,1,204,225,0,0,182,0,0,1,57,96,237,34,153,237,35,1,204,225,0,0,181,0,0,1,16,96,204,162,154,237,35,1,204,225,0,0,180,0,0,1,41,
+    0,204,130,155,237,35,1,204,225,0,0,178,0,0,2,16,96,122,192,229,34,156,237,35,1,204,225,0,0,2,0,0,98,96,180,1,134,188,1,129,180,1,161,188,1,5,188,33,
+    188,1,188,1,196,65,212,194,237,66,158,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,
+    1,0,0,123,0,208,237,35,1,204,225,0,0,1,0,0,123,0,208,237,35,1,196,225,0,0,1,0,0,123,0,208,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,
+    35,1,205,1,0,0,1,0,0,123,0,208,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,
+    0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,1,0,
+    0,123,0,208,237,35,1,196,225,0,0,1,0,0,123,0,208,237,35,1,204,225,0,0,2,0,0,123,0,237,34,159,237,35,2,229,2,179,225,180,1,138,179,225,0,220,194,160,
+    237,35,1,205,1,0,0,1,0,0,123,0,160,237,35,0,139,32,140,0,0,0,98,64,160,237,35,1,204,225,0,0,2,0,0,123,0,237,34,158,237,35,1,237,66,41,0,140,
+    0,0,1,16,96,229,34,159,237,35,1,204,225,0,0,1,0,0,123,0,159,237,35,0,196,65,142,0,0,0,155,129,159,237,35,1,204,225,0,0,2,0,0,123,0,237,34,158,
+    237,35,0,114,128,142,0,0,0,73,192,159,237,35,1,204,225,0,0,2,0,0,123,0,237,34,157,237,35,1,237,66,32,160,142,0,0,1,8,32,220,226,158,237,35,1,204,225,
+    0,0,2,0,0,123,0,237,34,154,237,35,3,220,226,90,0,49,64,41,32,144,0,0,3,32,224,49,64,81,224,188,65,155,237,35,1,204,225,0,0,2,0,0,123,0,237,34,
+    154,237,35,0,73,192,137,0,0,2,8,32,16,96,8,32,138,0,0,1,98,64,212,226,153,237,35,1,204,225,0,0,2,0,0,123,0,237,34,149,237,35,5,229,2,147,97,81,
+    224,57,96,237,65,32,192,134,0,0,8,57,96,147,128,204,192,229,64,221,32,229,32,196,160,139,64,49,64,136,0,0,2,0,32,106,128,221,2,151,237,35,1,204,225,0,0,2,
+    0,0,123,0,237,34,148,237,35,1,212,194,41,0,130,0,0,1,237,65,32,192,132,0,0,12,24,128,172,0,221,0,220,192,220,224,229,96,229,96,229,64,220,224,220,192,221,0,
+    172,0,24,128,136,0,0,1,24,160,180,1,150,237,35,1,204,225,0,0,2,0,0,123,0,237,34,147,237,35,1,212,194,32,192,131,0,0,1,229,65,32,192,131,0,0,14,49,
+    32,204,192,212,192,221,0,147,96,65,192,16,128,0,0,24,128,73,224,147,128,220,224,212,192,204,192,41,32,137,0,0,1,90,0,204,161,148,237,35,1,204,225,0,0,2,0,0,
+    123,0,237,34,146,237,35,1,229,34,41,0,132,0,0,1,229,65,32,192,130,0,0,4,32,224,212,192,220,224,180,32,32,224,134,0,0,4,40,224,180,32,220,192,212,224,32,192,
+    138,0,0,3,171,225,212,194,196,161,204,161,130,196,161,0,212,225,140,237,35,1,204,225,0,0,2,0,0,123,0,237,34,138,237,35,135,237,34,0,155,97,133,0,0,7,229,65,
+    32,192,0,0,0,0,0,32,188,128,220,224,139,64,138,0,0,2,147,96,220,192,188,96,138,0,0,1,147,96,106,128,132,0,0,0,98,64,140,237,35,1,204,225,0,0,2,0,
+    0,123,0,237,34,137,237,35,0,220,226,131,57,96,129,65,96,129,57,96,0,24,160,133,0,0,6,229,33,32,192,0,0,0,0,114,160,220,224,196,96,139,0,0,3,0,32,204,
+    160,220,224,106,128,137,0,0,1,147,64,114,128,132,0,0,0,98,64,140,237,35,1,204,225,0,0,2,0,0,123,0,237,34,137,237,35,0,220,225,142,0,0,6,229,65,32,192,
+    0,0,8,32,212,224,220,224,73,192,140,0,0,3,82,0,220,224,212,224,0,32,136,0,0,1,147,96,114,160,132,0,0,0,98,32,140,237,35,1,204,225,0,0,2,0,0,123,
+    0,237,34,137,237,35,0,220,225,142,0,0,5,229,65,32,192,0,0,65,160,220,224,196,160,142,0,0,2,204,160,220,224,65,160,136,0,0,1,147,96,114,160,132,0,0,0,98,
+    32,140,237,35,1,204,225,0,0,2,0,0,123,0,237,34,137,237,35,0,220,193,142,0,0,5,229,33,32,192,0,0,122,224,212,160,139,64,142,0,0,2,139,64,220,160,114,192,
+    136,0,0,1,147,96,114,160,132,0,0,0,98,64,140,237,35,1,204,225,0,0,1,0,0,123,0,138,237,35,0,220,193,142,0,0,5,229,33,32,192,0,0,139,64,220,192,106,
+    128,142,0,0,2,106,160,212,160,139,64,136,0,0,1,147,96,114,160,132,0,0,0,98,64,140,237,35,1,204,225,0,0,1,0,0,123,0,138,237,35,0,220,193,142,0,0,5,
+    229,33,32,192,0,0,139,64,212,160,98,128,142,0,0,2,98,128,212,192,139,96,136,0,0,1,147,96,114,160,132,0,0,0,98,64,140,237,35,1,196,225,0,0,2,0,0,123,
+    0,237,34,137,237,35,0,220,225,142,0,0,5,229,33,32,192,0,0,131,0,212,192,114,192,142,0,0,2,114,192,212,192,123,32,136,0,0,1,147,96,114,160,132,0,0,0,98,
+    64,140,237,35,1,204,225,0,0,1,0,0,123,0,138,237,35,0,220,225,142,0,0,5,229,65,32,192,0,0,98,96,220,192,163,192,142,0,0,2,163,224,220,224,90,64,136,0,
+    0,1,147,96,114,160,132,0,0,0,98,64,140,237,35,1,204,225,0,0,2,0,0,123,0,237,34,137,237,35,0,220,193,142,0,0,6,229,33,32,192,0,0,16,128,229,32,221,
+    32,24,160,140,0,0,3,24,128,221,32,229,64,24,128,136,0,0,1,147,96,114,160,132,0,0,0,98,64,140,237,35,1,196,225,0,0,2,0,0,123,0,237,34,137,237,35,0,
+    220,193,142,0,0,6,229,65,32,192,0,0,0,0,139,64,220,192,155,128,140,0,0,2,147,96,220,192,155,160,137,0,0,1,147,96,114,160,132,0,0,0,98,64,140,237,35,1,
+    196,225,0,0,2,0,0,123,0,237,34,137,237,35,1,229,2,179,225,132,180,1,129,180,33,0,82,0,133,0,0,7,229,33,32,192,0,0,0,0,8,64,212,224,221,0,73,192,
+    138,0,0,3,65,160,221,0,221,0,16,96,137,0,0,1,147,96,114,160,132,0,0,0,98,32,140,237,35,1,204,225,0,0,2,0,0,123,0,237,34,146,237,35,0,196,97,133,
+    0,0,1,229,33,32,192,130,0,0,3,90,0,220,224,212,224,90,0,136,0,0,3,65,160,212,192,220,224,98,96,138,0,0,1,147,128,139,32,132,49,64,0,122,192,140,237,35,
+    1,204,225,0,0,1,0,0,123,0,148,237,35,0,139,32,132,0,0,1,229,33,32,192,131,0,0,4,114,192,220,224,221,0,171,224,49,64,132,0,0,4,41,32,163,192,221,0,
+    220,224,131,0,138,0,0,2,49,32,204,130,237,66,132,237,98,0,237,66,140,237,35,1,204,225,0,0,2,0,0,123,0,237,34,147,237,35,2,237,34,147,97,8,32,130,0,0,
+    1,229,33,32,192,132,0,0,12,90,32,212,224,220,192,221,0,196,128,155,128,139,32,147,96,196,96,221,0,220,192,212,224,98,64,137,0,0,2,32,192,163,161,237,34,148,237,35,
+    1,204,225,0,0,1,0,0,123,0,150,237,35,5,212,194,114,160,49,64,41,0,229,34,32,192,133,0,0,10,8,32,106,128,188,96,229,32,220,192,212,192,220,224,229,32,188,96,
+    106,128,8,64,136,0,0,2,8,32,122,224,229,34,150,237,35,1,204,225,0,0,2,0,0,123,0,237,34,151,237,35,3,237,66,237,98,237,66,32,192,136,0,0,4,24,160,74,
+    0,82,64,73,224,24,160,138,0,0,1,65,96,212,161,152,237,35,1,204,225,0,0,2,0,0,123,0,237,34,154,237,35,0,98,64,150,0,0,2,32,224,163,193,237,66,153,237,
+    35,1,204,225,0,0,2,0,0,123,0,237,34,154,237,35,3,237,34,147,96,114,192,122,192,146,114,192,1,155,97,237,34,155,237,35,1,204,225,0,0,2,0,0,123,0,237,34,
+    156,237,35,2,237,34,237,35,237,35,131,237,34,135,237,35,0,237,34,162,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,2,0,0,123,0,237,
+    34,207,237,35,1,204,225,0,0,1,0,0,123,0,208,237,35,1,204,225,0,0,1,0,0,123,0,208,237,35,1,204,225,0,0,1,0,0,123,0,208,237,35,1,204,225,0,0,
+    1,0,0,123,0,208,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,2,0,0,123,0,
+    237,34,207,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,2,0,0,123,0,237,34,207,237,35,1,204,225,0,0,1,0,0,122,224,208,237,35,
+    1,204,225,0,0,1,0,0,122,224,208,237,35,1,204,225,0,0,1,0,0,98,64,208,237,35,1,196,161,0,0,1,0,0,57,96,208,237,35,1,163,161,0,0,129,0,0,0,
+    212,194,207,237,35,1,82,0,0,0,129,0,0,0,114,160,206,237,35,2,220,226,0,32,0,0,129,0,0,1,8,32,188,97,204,237,35,3,237,66,81,224,0,0,0,0,130,0,
+    0,2,16,96,155,129,237,34,201,237,35,1,229,2,98,64,130,0,0,132,0,0,7,49,32,147,65,196,65,212,161,212,161,204,161,204,129,204,161,131,212,161,4,204,161,212,161,212,
+    161,204,161,212,161,130,204,129,2,204,161,212,161,204,129,130,204,161,5,204,129,204,161,212,161,212,161,204,161,204,161,134,212,161,3,204,161,212,161,212,161,204,161,131,212,161,129,204,
+    129,129,204,161,130,212,161,0,204,161,145,212,161,2,180,1,114,160,16,96,131,0,0,212,0,0,
+    0,0,
+    // power_on
+    82,76,51,0,55,0,0,0,0,0,3,0,0,0,19,0,0,0,36,0,0,0,51,0,0,0,64,0,0,0,77,0,0,0,90,0,0,0,103,0,0,0,116,0,0,0,129,0,
+    0,0,156,0,0,0,181,0,0,0,206,0,0,0,231,0,0,0,0,1,0,0,25,1,0,0,50,1,0,0,89,1,0,0,134,1,0,0,185,1,0,0,238,1,0,0,31,2,
+    0,0,82,2,0,0,135,2,0,0,186,2,0,0,235,2,0,0,28,3,0,0,79,3,0,0,116,3,0,0,153,3,0,0,190,3,0,0,229,3,0,0,10,4,0,0,47,4,
+    0,0,88,4,0,0,127,4,0,0,164,4,0,0,201,4,0,0,244,4,0,0,41,5,0,0,82,5,0,0,111,5,0,0,148,5,0,0,167,5,0,0,180,5,0,0,193,5,
+    0,0,206,5,0,0,219,5,0,0,232,5,0,0,245,5,0,0,2,6,0,0,17,6,0,0,34,6,0,0,90,6,0,0,178,0,0,1,0,0,17,32,170,43,32,1,34,192,
+    25,128,131,0,0,1,0,0,25,160,172,35,224,3,35,0,0,64,0,0,0,0,1,0,0,25,160,173,35,224,2,35,32,0,0,0,0,1,0,0,25,160,174,35,224,1,25,192,
+    0,0,1,0,0,25,160,174,35,224,1,35,0,0,0,1,0,0,25,160,174,35,224,1,43,224,0,0,1,0,0,25,160,174,35,224,1,43,224,0,0,1,0,0,25,160,174,35,
+    224,1,43,224,0,0,1,0,0,25,160,174,35,224,1,43,224,0,0,1,0,0,25,160,149,35,224,4,34,224,34,96,34,64,34,96,35,0,147,35,224,1,43,224,0,0,1,0,
+    0,25,160,149,35,224,0,25,128,130,0,0,0,25,128,147,35,224,1,43,224,0,0,1,0,0,25,160,149,35,224,0,25,128,130,0,0,0,25,128,147,35,224,1,43,224,0,0,
+    1,0,0,25,160,149,35,224,0,25,128,130,0,0,0,25,128,147,35,224,1,43,224,0,0,1,0,0,25,160,149,35,224,0,25,128,130,0,0,0,25,128,147,35,224,1,43,224,
+    0,0,1,0,0,25,160,149,35,224,0,25,128,130,0,0,0,25,128,147,35,224,1,43,224,0,0,1,0,0,25,160,149,35,224,0,25,128,130,0,0,0,25,128,147,35,224,1,
+    43,224,0,0,1,0,0,25,160,144,35,224,129,43,128,130,35,224,0,25,128,130,0,0,0,25,128,130,35,224,1,43,128,43,160,142,35,224,1,43,224,0,0,1,0,0,25,160,
+    143,35,224,2,34,160,0,64,34,32,130,35,224,0,25,128,130,0,0,0,25,128,130,35,224,2,25,224,8,96,34,224,141,35,224,1,43,224,0,0,1,0,0,25,160,142,35,224,
+    7,25,224,0,0,0,0,8,96,43,224,35,224,35,224,25,128,130,0,0,0,25,128,130,35,224,3,8,192,0,0,0,0,25,224,140,35,224,1,43,224,0,0,1,0,0,25,160,
+    141,35,224,0,25,224,130,0,0,4,17,32,43,192,35,224,35,224,25,128,130,0,0,4,25,128,35,224,35,224,43,224,17,32,130,0,0,0,25,192,139,35,224,1,43,224,0,0,
+    1,0,0,25,160,140,35,224,0,34,96,130,0,0,0,34,128,131,35,224,0,25,128,130,0,0,0,25,128,131,35,224,0,25,224,130,0,0,0,34,96,138,35,224,1,43,224,0,
+    0,1,0,0,25,160,139,35,224,0,43,128,130,0,0,0,26,0,132,35,224,0,25,128,130,0,0,0,25,128,132,35,224,4,25,128,0,0,0,0,0,64,43,160,137,35,224,1,
+    43,224,0,0,1,0,0,25,160,139,35,224,4,25,128,0,0,0,0,16,224,35,192,132,35,224,0,25,128,130,0,0,0,25,128,132,35,224,4,43,192,8,192,0,0,0,0,25,
+    224,137,35,224,1,43,224,0,0,1,0,0,25,160,138,35,224,0,43,128,130,0,0,0,35,64,133,35,224,0,25,128,130,0,0,0,25,128,133,35,224,4,43,96,0,32,0,0,
+    0,32,43,192,136,35,224,1,43,224,0,0,1,0,0,25,160,138,35,224,3,26,32,0,0,0,0,17,32,134,35,224,0,25,128,130,0,0,0,25,128,134,35,224,3,25,160,0,
+    0,0,0,34,128,136,35,224,1,43,224,0,0,1,0,0,25,160,138,35,224,3,17,0,0,0,0,0,34,128,134,35,224,0,25,128,130,0,0,0,25,128,134,35,224,3,43,64,
+    0,0,0,0,17,64,136,35,224,1,43,224,0,0,1,0,0,25,160,137,35,224,4,43,224,0,64,0,0,0,0,43,96,134,35,224,0,34,32,130,16,224,0,34,32,134,35,224,
+    3,43,224,0,0,0,0,16,160,136,35,224,1,43,224,0,0,1,0,0,25,160,137,35,224,0,43,224,130,0,0,0,43,224,147,35,224,3,16,192,0,0,0,0,51,224,135,35,
+    224,1,43,224,0,0,1,0,0,25,160,137,35,224,0,43,224,130,0,0,0,44,0,147,35,224,3,16,192,0,0,0,0,51,224,135,35,224,1,43,224,0,0,1,0,0,25,160,
+    137,35,224,0,43,224,130,0,0,0,43,224,147,35,224,3,16,192,0,0,0,0,51,224,135,35,224,1,43,224,0,0,1,0,0,25,160,137,35,224,0,43,224,130,0,0,0,43,
+    160,146,35,224,4,43,224,0,64,0,0,8,96,43,224,135,35,224,1,43,224,0,0,1,0,0,25,160,138,35,224,3,16,224,0,0,0,0,34,160,146,35,224,3,43,64,0,0,
+    0,0,17,32,136,35,224,1,43,224,0,0,1,0,0,25,160,138,35,224,3,25,224,0,0,0,0,17,96,146,35,224,3,26,64,0,0,0,0,26,0,136,35,224,1,43,224,0,
+    0,1,0,0,25,160,138,35,224,4,35,0,0,0,0,0,0,32,43,160,144,35,224,4,43,224,8,192,0,0,0,0,43,64,136,35,224,1,43,224,0,0,1,0,0,25,160,139,
+    35,224,3,17,0,0,0,0,0,25,128,144,35,224,4,25,192,0,0,0,0,8,192,43,224,136,35,224,1,43,224,0,0,1,0,0,25,160,139,35,224,0,35,32,130,0,0,0,
+    34,128,142,35,224,0,34,96,130,0,0,0,35,0,137,35,224,1,43,224,0,0,1,0,0,25,160,140,35,224,0,34,64,130,0,0,0,34,128,140,35,224,0,34,96,130,0,0,
+    0,25,160,138,35,224,1,43,224,0,0,1,0,0,25,160,141,35,224,0,25,128,130,0,0,1,17,128,43,192,136,35,224,1,43,224,25,192,130,0,0,1,8,192,43,192,138,35,
+    224,1,43,224,0,0,1,0,0,25,160,141,35,224,1,43,224,17,32,130,0,0,3,8,96,26,32,43,128,43,224,130,35,224,3,43,224,43,128,26,64,8,192,130,0,0,1,8,
+    192,35,128,139,35,224,1,43,224,0,0,1,0,0,25,160,142,35,224,1,35,192,25,224,132,0,0,0,8,128,130,16,192,0,8,128,132,0,0,1,25,192,43,192,140,35,224,1,
+    43,224,0,0,1,0,0,25,160,144,35,224,1,35,32,17,64,138,0,0,1,17,32,35,32,142,35,224,1,43,224,0,0,1,0,0,25,160,146,35,224,3,43,128,26,64,17,32,
+    8,96,130,0,0,3,0,64,16,224,26,0,43,64,144,35,224,1,43,224,0,0,1,0,0,25,160,149,35,224,132,43,224,147,35,224,1,43,224,0,0,1,0,0,25,160,174,35,
+    224,1,43,224,0,0,1,0,0,25,160,174,35,224,1,43,224,0,0,1,0,0,25,160,174,35,224,1,43,224,0,0,1,0,0,25,160,174,35,224,1,43,224,0,0,1,0,0,
+    25,160,174,35,224,1,43,224,0,0,1,0,0,25,160,174,35,224,1,35,32,0,0,1,0,0,25,160,174,35,224,1,26,32,0,0,1,0,0,25,160,173,35,224,2,35,128,8,
+    96,0,0,1,0,0,25,160,172,35,224,3,43,128,8,160,0,0,0,0,1,0,0,25,128,131,44,0,0,52,0,135,44,0,0,52,0,131,44,0,0,52,0,133,44,0,0,52,
+    0,136,44,0,3,52,0,44,0,52,0,52,0,130,44,0,3,43,224,43,96,25,224,0,32,130,0,0,178,0,0,
+    0,
+    // power_off
+    82,76,51,0,55,0,0,0,0,0,3,0,0,0,21,0,0,0,38,0,0,0,53,0,0,0,66,0,0,0,79,0,0,0,92,0,0,0,105,0,0,0,118,0,0,0,131,0,
+    0,0,158,0,0,0,183,0,0,0,208,0,0,0,233,0,0,0,2,1,0,0,27,1,0,0,52,1,0,0,93,1,0,0,138,1,0,0,191,1,0,0,244,1,0,0,37,2,
+    0,0,88,2,0,0,141,2,0,0,192,2,0,0,241,2,0,0,34,3,0,0,85,3,0,0,122,3,0,0,159,3,0,0,196,3,0,0,235,3,0,0,16,4,0,0,53,4,
+    0,0,94,4,0,0,133,4,0,0,170,4,0,0,207,4,0,0,250,4,0,0,43,5,0,0,86,5,0,0,115,5,0,0,152,5,0,0,179,5,0,0,192,5,0,0,205,5,
+    0,0,218,5,0,0,231,5,0,0,244,5,0,0,1,6,0,0,14,6,0,0,29,6,0,0,46,6,0,0,64,6,0,0,178,0,0,1,0,0,65,96,169,188,2,2,179,226,
+    155,65,73,192,131,0,0,1,0,0,89,225,172,237,35,3,171,162,8,64,0,0,0,0,1,0,0,89,225,173,237,35,2,179,226,0,0,0,0,1,0,0,90,1,174,237,35,1,
+    98,33,0,0,1,0,0,89,225,174,237,35,1,171,194,0,0,1,0,0,89,225,174,237,35,1,220,194,0,0,1,0,0,89,225,174,237,35,1,220,226,0,0,1,0,0,89,225,
+    174,237,35,1,220,226,0,0,1,0,0,89,225,174,237,35,1,220,226,0,0,1,0,0,89,225,149,237,35,4,163,130,130,193,130,193,122,193,163,130,147,237,35,1,220,226,0,0,
+    1,0,0,89,225,149,237,35,0,81,192,130,0,0,0,81,193,147,237,35,1,220,226,0,0,1,0,0,89,225,149,237,35,0,81,192,130,0,0,0,81,192,147,237,35,1,220,226,
+    0,0,1,0,0,89,225,149,237,35,0,81,192,130,0,0,0,81,192,147,237,35,1,220,194,0,0,1,0,0,89,225,149,237,35,0,81,192,130,0,0,0,81,192,147,237,35,1,
+    220,226,0,0,1,0,0,89,225,149,237,35,0,81,192,130,0,0,0,81,192,147,237,35,1,220,226,0,0,1,0,0,89,225,149,237,35,0,81,192,130,0,0,0,81,192,147,237,
+    35,1,220,194,0,0,1,0,0,89,225,144,237,35,1,204,130,204,98,130,237,35,0,81,192,130,0,0,0,81,192,130,237,35,1,204,98,212,162,142,237,35,1,220,226,0,0,1,
+    0,0,89,225,143,237,35,2,139,33,8,64,106,97,130,237,35,0,81,192,130,0,0,0,81,192,130,237,35,2,98,33,16,96,155,130,141,237,35,1,220,226,0,0,1,0,0,89,
+    225,142,237,35,7,98,33,0,0,0,0,16,96,229,2,237,35,237,35,81,192,130,0,0,0,81,192,130,237,35,4,32,192,0,0,0,0,90,1,229,2,139,237,35,1,220,226,0,
+    0,1,0,0,89,225,141,237,35,0,106,65,130,0,0,4,57,64,220,194,237,35,237,35,81,192,130,0,0,4,81,192,237,35,237,35,229,2,57,64,130,0,0,0,90,1,139,237,
+    35,1,220,226,0,0,1,0,0,89,225,140,237,35,0,130,193,130,0,0,0,139,1,131,237,35,0,81,192,130,0,0,0,81,192,131,237,35,0,98,33,130,0,0,0,130,225,138,
+    237,35,1,220,226,0,0,1,0,0,89,225,139,237,35,0,196,98,130,0,0,0,106,65,132,237,35,0,81,192,130,0,0,0,81,192,132,237,35,4,73,160,0,0,0,0,8,64,
+    212,130,137,237,35,1,220,226,0,0,1,0,0,89,225,139,237,35,4,73,192,0,0,0,0,49,0,229,2,132,237,35,0,81,192,130,0,0,0,81,192,132,237,35,4,220,194,32,
+    192,0,0,0,0,98,65,137,237,35,1,220,226,0,0,1,0,0,89,225,138,237,35,0,196,66,130,0,0,0,179,226,133,237,35,0,81,192,130,0,0,0,81,192,133,237,35,4,
+    196,66,8,32,0,0,8,32,220,194,136,237,35,1,220,226,0,0,1,0,0,89,225,138,237,35,3,114,129,0,0,0,0,57,64,134,237,35,0,81,192,130,0,0,0,81,192,134,
+    237,35,3,89,225,0,0,0,0,139,1,136,237,35,1,220,194,0,0,1,0,0,89,225,138,237,35,3,49,0,0,0,0,0,139,1,134,237,35,0,81,192,130,0,0,0,81,192,
+    134,237,35,3,180,2,0,0,0,0,65,128,136,237,35,1,220,226,0,0,1,0,0,89,225,137,237,35,4,229,2,8,32,0,0,0,0,188,34,134,237,35,0,106,65,130,40,224,
+    0,106,65,134,237,35,3,228,226,0,0,0,0,24,160,136,237,35,1,220,226,0,0,1,0,0,89,225,137,237,35,0,220,226,130,0,0,0,228,226,147,237,35,3,32,192,0,0,
+    0,0,220,194,135,237,35,1,220,226,0,0,1,0,0,89,225,137,237,35,0,220,226,130,0,0,0,229,2,147,237,35,3,40,224,0,0,0,0,220,194,135,237,35,1,220,226,0,
+    0,1,0,0,89,225,137,237,35,0,220,226,130,0,0,0,229,2,147,237,35,3,32,192,0,0,0,0,220,194,135,237,35,1,220,226,0,0,1,0,0,89,225,137,237,35,0,228,
+    226,130,0,0,0,204,130,146,237,35,4,229,3,8,64,0,0,16,64,229,2,135,237,35,1,220,194,0,0,1,0,0,89,225,138,237,35,3,41,0,0,0,0,0,147,65,146,237,
+    35,3,188,34,0,0,0,0,49,32,136,237,35,1,220,226,0,0,1,0,0,89,225,138,237,35,3,106,65,0,0,0,0,73,160,146,237,35,3,122,161,0,0,0,0,106,97,136,
+    237,35,1,220,226,0,0,1,0,0,89,225,138,237,35,4,171,194,0,0,0,0,8,32,212,162,144,237,35,4,229,2,32,192,0,0,0,0,180,2,136,237,35,1,220,226,0,0,
+    1,0,0,89,225,139,237,35,3,49,32,0,0,0,0,73,192,144,237,35,4,90,1,0,0,0,0,32,192,237,3,136,237,35,1,220,226,0,0,1,0,0,89,225,139,237,35,0,
+    171,194,130,0,0,0,139,1,142,237,35,0,130,193,130,0,0,0,163,162,137,237,35,1,220,194,0,0,1,0,0,89,225,140,237,35,0,122,161,130,0,0,0,139,1,140,237,35,
+    0,130,193,130,0,0,0,81,193,138,237,35,1,220,194,0,0,1,0,0,89,225,141,237,35,0,73,160,130,0,0,1,73,160,220,226,136,237,35,1,229,3,90,1,130,0,0,1,
+    40,224,220,226,138,237,35,1,220,226,0,0,1,0,0,89,225,141,237,35,1,228,226,57,64,130,0,0,2,16,96,114,129,196,66,132,237,35,2,196,66,122,161,32,192,130,0,0,
+    1,32,224,204,130,139,237,35,1,220,226,0,0,1,0,0,89,225,142,237,35,1,229,2,98,33,132,0,0,4,16,128,40,224,41,0,40,224,16,128,132,0,0,1,90,1,220,226,
+    140,237,35,1,220,226,0,0,1,0,0,89,225,144,237,35,1,171,194,65,96,138,0,0,1,49,32,171,226,142,237,35,1,220,226,0,0,1,0,0,89,225,146,237,35,3,204,98,
+    122,161,57,64,8,64,130,0,0,3,8,32,41,0,106,97,180,2,144,237,35,1,220,226,0,0,1,0,0,89,225,149,237,35,4,229,3,220,226,220,194,220,194,229,2,147,237,35,
+    1,220,226,0,0,1,0,0,89,225,174,237,35,1,220,226,0,0,1,0,0,89,225,174,237,35,1,220,226,0,0,1,0,0,89,225,174,237,35,1,220,226,0,0,1,0,0,89,
+    225,174,237,35,1,220,226,0,0,1,0,0,89,225,174,237,35,1,220,194,0,0,1,0,0,89,225,174,237,35,1,179,226,0,0,1,0,0,89,225,174,237,35,1,114,129,0,0,
+    1,0,0,89,225,173,237,35,2,204,130,16,64,0,0,1,0,0,89,225,172,237,35,3,204,130,32,160,0,0,0,0,1,0,0,81,192,170,229,2,2,196,34,98,65,8,32,130,
+    0,0,178,0,0,
+    0,0,0,
+    // forward_on
+    82,76,68,0,46,0,0,0,0,0,3,0,0,0,26,0,0,0,47,0,0,0,64,0,0,0,79,0,0,0,95,0,0,0,130,0,0,0,175,0,0,0,216,0,0,0,3,1,
+    0,0,44,1,0,0,85,1,0,0,124,1,0,0,165,1,0,0,204,1,0,0,243,1,0,0,26,2,0,0,63,2,0,0,100,2,0,0,137,2,0,0,174,2,0,0,224,2,
+    0,0,9,3,0,0,50,3,0,0,93,3,0,0,134,3,0,0,175,3,0,0,209,3,0,0,234,3,0,0,3,4,0,0,46,4,0,0,85,4,0,0,124,4,0,0,163,4,
+    0,0,204,4,0,0,245,4,0,0,32,5,0,0,77,5,0,0,120,5,0,0,160,5,0,0,176,5,0,0,194,5,0,0,213,5,0,0,234,5,0,0,5,6,0,0,195,0,
+    0,134,0,0,2,0,32,9,64,17,224,175,26,64,2,17,224,9,96,0,64,134,0,0,132,0,0,2,0,64,18,32,35,160,180,35,224,1,26,160,8,192,132,0,0,131,0,0,
+    1,9,96,35,192,184,35,224,0,18,32,131,0,0,130,0,0,0,9,96,187,35,224,0,26,96,130,0,0,129,0,0,0,8,224,189,35,224,2,17,128,0,0,0,0,129,0,0,
+    0,26,224,153,35,224,5,43,224,43,192,35,160,35,160,43,160,43,160,130,43,192,154,35,224,2,35,128,0,0,0,0,1,0,0,0,160,150,35,224,8,35,160,26,96,9,64,8,
+    128,0,32,0,0,0,0,0,96,0,64,131,0,0,2,8,224,26,64,35,160,152,35,224,1,9,64,0,0,1,0,0,18,0,149,35,224,1,18,64,0,32,132,0,0,3,17,224,
+    35,192,35,128,9,96,132,0,0,1,0,64,26,96,151,35,224,1,26,128,0,0,1,0,0,26,192,147,35,224,1,35,160,9,32,132,0,0,1,0,32,26,192,131,35,224,0,18,
+    64,133,0,0,1,9,32,35,160,149,35,224,1,35,96,0,0,1,0,0,35,0,146,35,224,1,35,96,0,128,133,0,0,0,26,192,133,35,224,0,18,64,133,0,0,1,0,192,
+    35,96,148,35,224,1,35,128,0,0,1,0,0,35,0,145,35,224,1,35,192,0,160,133,0,0,0,26,160,135,35,224,0,17,224,133,0,0,1,0,160,35,160,147,35,224,1,43,
+    192,0,0,1,0,0,35,0,145,35,224,0,17,128,133,0,0,0,17,192,137,35,224,0,9,0,133,0,0,1,8,192,35,192,146,35,224,1,43,192,0,0,1,0,0,35,0,144,
+    35,224,0,35,32,133,0,0,1,0,64,35,160,137,35,224,1,35,64,0,32,133,0,0,0,17,224,146,35,224,1,43,192,0,0,1,0,0,35,0,144,35,224,0,9,64,133,0,
+    0,0,17,192,139,35,224,0,18,0,133,0,0,1,0,64,35,160,145,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,35,64,134,0,0,0,35,96,139,35,224,1,35,
+    192,0,96,133,0,0,0,17,224,145,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,17,160,133,0,0,0,9,0,141,35,224,0,17,224,133,0,0,1,0,64,35,192,
+    144,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,0,96,133,0,0,0,18,0,141,35,224,0,35,32,134,0,0,0,26,160,144,35,224,1,43,192,0,0,1,0,0,
+    35,0,142,35,224,0,35,0,134,0,0,0,35,64,142,35,224,0,0,64,133,0,0,0,17,128,144,35,224,1,43,192,0,0,1,0,0,35,0,142,35,224,0,18,32,134,0,0,
+    0,35,192,142,35,224,0,8,128,133,0,0,0,8,160,144,35,224,1,43,192,0,0,1,0,0,35,0,142,35,224,0,9,96,133,0,0,0,0,128,143,35,224,0,8,224,134,0,
+    0,0,35,192,143,35,224,1,43,192,0,0,1,0,0,35,0,142,35,224,0,8,192,133,0,0,0,8,160,138,35,224,1,35,32,34,224,130,35,0,0,8,160,134,0,0,1,35,
+    0,35,192,130,43,192,139,35,224,1,43,192,0,0,1,0,0,35,0,142,35,224,0,0,128,133,0,0,0,9,32,138,35,224,1,35,64,9,0,142,0,0,1,9,0,35,64,138,
+    35,224,1,43,192,0,0,1,0,0,35,0,141,35,224,0,43,224,134,0,0,0,17,96,140,35,224,1,18,32,0,32,138,0,0,1,0,128,26,128,140,35,224,1,43,192,0,0,
+    1,0,0,35,0,142,35,224,0,8,128,133,0,0,0,9,64,141,35,224,1,35,160,9,96,135,0,0,2,0,64,18,64,35,192,141,35,224,1,43,192,0,0,1,0,0,35,0,
+    142,35,224,0,8,192,133,0,0,0,9,0,143,35,224,1,26,160,0,96,132,0,0,1,17,128,35,160,143,35,224,1,43,192,0,0,1,0,0,35,0,142,35,224,0,17,96,133,
+    0,0,0,8,128,144,35,224,5,35,160,9,32,0,0,0,0,0,128,27,0,145,35,224,1,43,192,0,0,1,0,0,35,0,142,35,224,0,26,64,134,0,0,0,35,192,145,35,
+    224,129,18,32,0,35,160,146,35,224,1,43,192,0,0,1,0,0,35,0,142,35,224,0,35,128,134,0,0,0,35,32,167,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,
+    0,8,192,133,0,0,0,18,0,167,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,18,64,133,0,0,0,8,192,140,35,224,3,35,96,17,128,17,128,17,160,131,18,
+    0,0,26,64,145,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,1,35,160,0,64,133,0,0,0,26,224,139,35,224,0,9,0,134,0,0,0,17,224,145,35,224,1,43,
+    192,0,0,1,0,0,35,0,144,35,224,0,17,224,133,0,0,0,9,0,138,35,224,0,26,224,134,0,0,1,0,64,35,192,145,35,224,1,43,192,0,0,1,0,0,35,0,144,
+    35,224,1,35,160,0,96,133,0,0,0,27,0,137,35,224,0,8,192,134,0,0,0,26,160,146,35,224,1,43,192,0,0,1,0,0,35,0,145,35,224,1,27,0,0,32,132,0,
+    0,1,0,128,35,160,135,35,224,0,18,0,134,0,0,0,18,32,147,35,224,1,43,192,0,0,1,0,0,35,0,146,35,224,1,26,192,0,32,132,0,0,1,8,192,35,160,133,
+    35,224,0,27,0,134,0,0,0,18,32,148,35,224,1,35,160,0,0,1,0,0,26,192,147,35,224,1,35,64,8,192,132,0,0,1,8,192,35,160,131,35,224,1,27,64,0,96,
+    133,0,0,0,18,32,149,35,224,1,35,128,0,0,1,0,0,18,32,149,35,224,1,18,0,0,64,131,0,0,5,0,128,35,64,35,224,35,224,26,96,0,64,132,0,0,1,0,
+    96,26,160,150,35,224,1,26,192,0,0,1,0,0,9,0,150,35,224,2,35,160,18,32,8,192,131,0,0,1,17,160,0,160,131,0,0,3,8,160,17,96,26,128,35,192,151,35,
+    224,1,17,128,0,0,129,0,0,0,35,128,152,35,224,9,35,192,35,32,34,224,34,224,34,192,26,160,26,160,34,192,35,32,35,160,154,35,224,2,35,192,0,64,0,0,129,0,
+    0,0,17,192,189,35,224,2,18,0,0,0,0,0,130,0,0,0,26,192,187,35,224,3,27,32,0,32,0,0,0,0,130,0,0,1,0,32,26,192,185,35,224,1,27,32,0,96,
+    130,0,0,132,0,0,1,17,160,35,128,181,35,224,2,35,160,17,224,0,32,131,0,0,133,0,0,3,0,32,9,128,26,192,35,128,175,43,192,3,35,128,26,192,17,128,0,32,
+    133,0,0,195,0,0,
+    0,0,
+    // forward_off
+    82,76,68,0,46,0,0,0,0,0,3,0,0,0,63,0,0,0,84,0,0,0,103,0,0,0,120,0,0,0,138,0,0,0,174,0,0,0,217,0,0,0,4,1,0,0,45,1,
+    0,0,86,1,0,0,127,1,0,0,168,1,0,0,205,1,0,0,242,1,0,0,25,2,0,0,62,2,0,0,101,2,0,0,138,2,0,0,175,2,0,0,212,2,0,0,11,3,
+    0,0,49,3,0,0,92,3,0,0,135,3,0,0,176,3,0,0,217,3,0,0,254,3,0,0,23,4,0,0,50,4,0,0,99,4,0,0,138,4,0,0,175,4,0,0,216,4,
+    0,0,255,4,0,0,38,5,0,0,81,5,0,0,124,5,0,0,167,5,0,0,207,5,0,0,223,5,0,0,238,5,0,0,255,5,0,0,18,6,0,0,64,6,0,0,195,0,
+    0,135,0,0,7,49,32,98,33,114,161,122,161,122,225,123,1,122,225,122,193,137,122,225,130,123,1,133,122,225,129,123,1,129,122,225,129,123,1,0,122,193,138,122,225,129,123,1,
+    129,122,225,2,122,193,98,33,57,64,135,0,0,133,0,0,1,98,65,204,162,179,237,35,2,220,227,131,1,24,128,132,0,0,131,0,0,1,57,64,212,162,183,237,35,1,229,3,
+    98,65,131,0,0,130,0,0,1,57,96,229,3,186,237,35,0,114,129,130,0,0,129,0,0,1,24,160,220,226,188,237,35,2,65,128,0,0,0,0,129,0,0,0,147,98,153,237,
+    35,1,220,194,196,66,130,188,34,3,196,66,196,98,196,98,204,98,154,237,35,2,196,66,0,0,0,0,2,0,0,16,96,229,35,149,237,35,3,204,98,114,161,49,0,8,64,130,
+    0,0,0,8,32,132,0,0,2,24,160,106,97,204,130,152,237,35,1,49,32,0,0,1,0,0,90,33,148,237,35,1,228,226,106,65,133,0,0,3,73,193,220,194,188,34,49,0,
+    132,0,0,2,0,32,114,97,229,3,150,237,35,1,122,193,0,0,1,0,0,147,66,147,237,35,1,196,98,32,192,133,0,0,0,130,225,131,237,35,0,98,33,133,0,0,1,40,
+    224,204,130,149,237,35,1,180,2,0,0,1,0,0,163,194,146,237,35,1,179,226,8,64,133,0,0,0,130,225,133,237,35,0,98,33,133,0,0,1,16,128,188,2,148,237,35,1,
+    196,66,0,0,1,0,0,163,162,145,237,35,1,212,130,16,128,133,0,0,0,114,129,135,237,35,0,73,161,133,0,0,1,16,96,196,98,147,237,35,1,204,162,0,0,1,0,0,
+    163,162,145,237,35,0,57,64,133,0,0,0,73,161,136,237,35,1,220,226,32,192,133,0,0,1,24,128,212,130,146,237,35,1,212,162,0,0,1,0,0,163,162,144,237,35,0,163,
+    130,134,0,0,0,196,98,137,237,35,0,171,194,134,0,0,0,81,225,146,237,35,1,212,162,0,0,1,0,0,163,162,144,237,35,0,49,0,133,0,0,0,73,161,139,237,35,0,
+    81,193,134,0,0,0,196,98,145,237,35,1,212,162,0,0,1,0,0,163,162,143,237,35,0,171,194,134,0,0,0,180,2,139,237,35,1,212,162,8,64,133,0,0,0,81,225,145,
+    237,35,1,212,162,0,0,1,0,0,163,162,143,237,35,0,73,161,133,0,0,0,32,192,141,237,35,0,89,225,134,0,0,0,212,162,144,237,35,1,212,162,0,0,1,0,0,163,
+    162,142,237,35,1,220,226,8,32,133,0,0,0,98,33,141,237,35,0,163,162,134,0,0,0,130,225,144,237,35,1,204,162,0,0,1,0,0,163,162,142,237,35,0,155,98,134,0,
+    0,0,163,162,141,237,35,0,220,194,134,0,0,0,65,96,144,237,35,1,204,130,0,0,1,0,0,163,162,142,237,35,0,98,65,134,0,0,0,204,98,142,237,35,0,8,64,133,
+    0,0,0,8,64,144,237,35,1,212,162,0,0,1,0,0,163,194,142,237,35,0,49,32,133,0,0,0,8,32,143,237,35,0,32,192,134,0,0,0,204,130,143,237,35,1,212,162,
+    0,0,1,0,0,163,162,142,237,35,0,16,96,133,0,0,0,24,128,137,237,35,2,237,3,155,98,155,98,130,155,130,0,16,96,134,0,0,1,139,34,196,98,130,204,130,0,220,
+    194,138,237,35,1,212,162,0,0,1,0,0,163,162,142,237,35,134,0,0,0,40,224,138,237,35,1,171,194,32,224,142,0,0,1,32,192,163,162,138,237,35,1,212,162,0,0,1,
+    0,0,163,162,141,237,35,0,212,162,134,0,0,0,57,96,139,237,35,1,228,226,98,65,139,0,0,2,8,64,114,161,229,3,139,237,35,1,212,162,0,0,1,0,0,163,162,141,
+    237,35,1,229,3,8,32,133,0,0,0,49,32,141,237,35,1,188,34,49,32,136,0,0,1,106,97,212,194,141,237,35,1,212,162,0,0,1,0,0,163,162,142,237,35,0,24,128,
+    133,0,0,0,32,192,143,237,35,1,130,193,8,64,132,0,0,1,65,96,196,66,143,237,35,1,212,162,0,0,1,0,0,163,162,142,237,35,0,57,64,133,0,0,0,8,32,144,
+    237,35,5,204,98,32,192,0,0,0,0,8,64,147,33,145,237,35,1,204,162,0,0,1,0,0,163,162,142,237,35,0,106,65,134,0,0,0,204,130,144,237,35,3,220,226,98,33,
+    90,1,204,130,146,237,35,1,204,162,0,0,1,0,0,163,162,142,237,35,0,171,194,134,0,0,0,163,130,167,237,35,1,204,162,0,0,1,0,0,163,162,142,237,35,1,237,3,
+    16,128,133,0,0,0,98,33,167,237,35,1,204,130,0,0,1,0,0,163,162,143,237,35,0,106,65,133,0,0,1,16,128,229,3,139,237,35,3,171,194,73,160,73,160,81,193,130,
+    98,33,2,98,65,106,65,220,227,144,237,35,1,212,130,0,0,1,0,0,163,162,143,237,35,0,204,98,134,0,0,0,147,33,138,237,35,1,229,3,32,160,134,0,0,0,81,193,
+    145,237,35,1,212,162,0,0,1,0,0,163,162,144,237,35,0,81,225,133,0,0,0,32,192,138,237,35,0,139,33,135,0,0,0,204,130,145,237,35,1,212,130,0,0,1,0,0,
+    163,162,144,237,35,1,204,98,8,32,133,0,0,0,155,66,136,237,35,1,220,226,16,128,134,0,0,0,122,193,146,237,35,1,204,130,0,0,1,0,0,163,162,145,237,35,0,147,
+    66,133,0,0,1,8,64,196,66,135,237,35,0,90,1,134,0,0,0,89,225,147,237,35,1,204,130,0,0,1,0,0,163,162,146,237,35,0,130,225,133,0,0,1,24,128,204,130,
+    133,237,35,0,147,66,134,0,0,0,89,225,148,237,35,1,204,98,0,0,1,0,0,147,33,147,237,35,1,171,194,24,128,132,0,0,1,24,128,204,98,131,237,35,1,171,194,0,
+    32,133,0,0,0,89,225,149,237,35,1,188,34,0,0,1,0,0,98,65,148,237,35,1,220,194,89,225,132,0,0,4,8,64,163,162,237,35,220,194,106,97,133,0,0,1,0,32,
+    122,193,150,237,35,1,139,33,0,0,1,0,0,32,192,150,237,35,2,196,98,98,65,24,128,131,0,0,1,65,128,16,96,131,0,0,3,16,64,57,96,122,193,212,194,151,237,35,
+    1,65,128,0,0,129,0,0,0,188,34,152,237,35,9,204,98,163,130,147,66,147,66,147,33,130,225,130,225,139,1,155,130,196,66,154,237,35,2,212,194,0,0,0,0,129,0,0,
+    0,73,161,189,237,35,2,98,33,0,0,0,0,130,0,0,0,139,65,187,237,35,0,163,162,130,0,0,131,0,0,0,147,66,185,237,35,1,163,162,8,32,130,0,0,132,0,0,
+    1,65,160,196,98,181,237,35,1,204,130,81,225,132,0,0,134,0,0,4,65,128,139,33,188,34,204,162,212,163,137,212,162,0,204,162,141,204,130,138,212,162,0,204,162,134,204,130,
+    4,212,162,204,162,188,34,139,33,65,128,134,0,0,195,0,0,
+    0,0,0,
+    // neutral_on
+    82,76,68,0,31,0,0,0,0,0,3,0,0,0,26,0,0,0,47,0,0,0,64,0,0,0,79,0,0,0,95,0,0,0,111,0,0,0,124,0,0,0,137,0,0,0,150,0,
+    0,0,163,0,0,0,176,0,0,0,205,0,0,0,232,0,0,0,1,1,0,0,28,1,0,0,53,1,0,0,78,1,0,0,103,1,0,0,130,1,0,0,157,1,0,0,170,1,
+    0,0,183,1,0,0,196,1,0,0,213,1,0,0,229,1,0,0,247,1,0,0,10,2,0,0,31,2,0,0,58,2,0,0,195,0,0,134,0,0,2,0,32,9,64,17,224,175,
+    26,64,2,17,224,9,96,0,64,134,0,0,132,0,0,2,0,64,18,32,35,160,180,35,224,1,26,160,8,192,132,0,0,131,0,0,1,9,96,35,192,184,35,224,0,18,32,131,
+    0,0,130,0,0,0,9,96,187,35,224,0,26,96,130,0,0,129,0,0,0,8,224,189,35,224,2,17,128,0,0,0,0,129,0,0,0,27,0,189,35,224,2,35,160,0,32,0,
+    0,1,0,0,8,224,191,35,224,1,9,128,0,0,1,0,0,18,32,191,35,224,1,26,192,0,0,1,0,0,26,224,191,35,224,1,35,128,0,0,1,0,0,35,0,191,35,224,
+    1,35,160,0,0,1,0,0,35,0,191,35,224,1,43,192,0,0,1,0,0,35,0,156,35,224,5,35,160,17,224,8,160,0,64,8,192,18,64,156,35,224,1,43,192,0,0,1,
+    0,0,35,0,155,35,224,1,35,160,0,128,132,0,0,0,9,32,155,35,224,1,43,192,0,0,1,0,0,35,0,155,35,224,0,9,96,134,0,0,0,18,64,154,35,224,1,43,
+    192,0,0,1,0,0,35,0,154,35,224,1,35,192,0,32,134,0,0,0,8,192,154,35,224,1,43,192,0,0,1,0,0,35,0,154,35,224,0,35,128,135,0,0,0,0,96,154,
+    35,224,1,43,192,0,0,1,0,0,35,0,155,35,224,0,0,128,134,0,0,0,9,64,154,35,224,1,43,192,0,0,1,0,0,35,0,155,35,224,0,18,64,134,0,0,0,27,
+    0,154,35,224,1,43,192,0,0,1,0,0,35,0,156,35,224,0,17,224,131,0,0,1,0,32,26,128,155,35,224,1,43,192,0,0,1,0,0,35,0,157,35,224,4,35,96,26,
+    64,17,224,26,96,35,160,156,35,224,1,43,192,0,0,1,0,0,26,192,191,35,224,1,35,128,0,0,1,0,0,18,64,191,35,224,1,26,224,0,0,1,0,0,9,64,191,35,
+    224,1,17,192,0,0,2,0,0,0,32,35,160,189,35,224,2,35,192,0,96,0,0,129,0,0,0,17,192,189,35,224,2,18,0,0,0,0,0,130,0,0,0,26,192,187,35,224,
+    3,27,32,0,32,0,0,0,0,130,0,0,1,0,32,26,192,185,35,224,1,27,32,0,96,130,0,0,132,0,0,1,17,160,35,128,181,35,224,2,35,160,17,224,0,32,131,0,
+    0,133,0,0,3,0,32,9,128,26,192,35,128,175,43,192,3,35,128,26,192,17,128,0,32,133,0,0,195,0,0,
+    0,
+    // neutral_off
+    82,76,68,0,31,0,0,0,0,0,3,0,0,0,66,0,0,0,87,0,0,0,106,0,0,0,123,0,0,0,141,0,0,0,157,0,0,0,170,0,0,0,183,0,0,0,196,0,
+    0,0,209,0,0,0,222,0,0,0,253,0,0,0,26,1,0,0,51,1,0,0,76,1,0,0,98,1,0,0,125,1,0,0,150,1,0,0,177,1,0,0,204,1,0,0,217,1,
+    0,0,230,1,0,0,243,1,0,0,3,2,0,0,19,2,0,0,34,2,0,0,51,2,0,0,70,2,0,0,116,2,0,0,195,0,0,135,0,0,8,49,32,98,33,114,161,122,
+    161,122,225,123,1,122,225,122,193,122,193,136,122,225,130,123,1,133,122,225,129,123,1,129,122,225,129,123,1,129,122,193,137,122,225,129,123,1,4,122,225,122,193,114,161,98,33,57,
+    64,135,0,0,133,0,0,1,98,65,204,162,179,237,35,2,220,227,131,1,24,128,132,0,0,131,0,0,1,57,64,212,162,183,237,35,1,229,3,98,65,131,0,0,130,0,0,1,
+    57,96,229,3,186,237,35,0,114,129,130,0,0,129,0,0,1,24,160,220,226,188,237,35,2,65,128,0,0,0,0,129,0,0,0,163,162,189,237,35,2,204,98,0,0,0,0,1,
+    0,0,32,192,191,237,35,1,65,128,0,0,1,0,0,106,97,191,237,35,1,139,33,0,0,1,0,0,147,98,191,237,35,1,180,34,0,0,1,0,0,163,194,191,237,35,1,196,
+    98,0,0,1,0,0,163,162,191,237,35,1,204,162,0,0,1,0,0,163,162,156,237,35,6,204,130,81,225,16,96,0,0,24,128,106,97,220,226,155,237,35,1,212,162,0,0,1,
+    0,0,163,162,155,237,35,1,196,66,16,96,132,0,0,1,40,224,220,194,154,237,35,1,212,162,0,0,1,0,0,163,162,155,237,35,0,49,32,134,0,0,0,98,33,154,237,35,
+    1,212,162,0,0,1,0,0,163,162,154,237,35,0,212,130,135,0,0,0,16,96,154,237,35,1,212,162,0,0,1,0,0,163,162,154,237,35,0,188,34,136,0,0,154,237,35,1,
+    212,162,0,0,1,0,0,163,162,154,237,35,1,228,226,0,32,134,0,0,0,40,224,154,237,35,1,212,162,0,0,1,0,0,163,162,155,237,35,0,106,65,134,0,0,0,147,66,
+    154,237,35,1,204,130,0,0,1,0,0,163,162,155,237,35,1,229,3,81,193,132,0,0,0,122,161,155,237,35,1,204,130,0,0,1,0,0,163,162,157,237,35,4,179,226,106,97,
+    90,1,122,161,196,98,156,237,35,1,204,130,0,0,1,0,0,147,65,191,237,35,1,188,66,0,0,1,0,0,114,129,191,237,35,1,155,98,0,0,1,0,0,49,32,191,237,35,
+    1,81,225,0,0,129,0,0,0,196,98,189,237,35,2,220,226,8,32,0,0,129,0,0,0,73,161,189,237,35,2,98,33,0,0,0,0,130,0,0,0,139,65,187,237,35,0,163,
+    162,130,0,0,131,0,0,0,147,66,185,237,35,1,163,162,8,32,130,0,0,132,0,0,1,65,160,196,98,181,237,35,1,204,130,81,225,132,0,0,134,0,0,4,65,128,139,33,
+    188,34,204,162,212,163,137,212,162,0,204,162,141,204,130,138,212,162,0,204,162,134,204,130,4,212,162,204,162,188,34,139,33,65,128,134,0,0,195,0,0,
+    0,0,0,
+    // backward_on
+    82,76,68,0,45,0,0,0,0,0,17,0,0,0,40,0,0,0,59,0,0,0,78,0,0,0,98,0,0,0,114,0,0,0,149,0,0,0,194,0,0,0,237,0,0,0,22,1,
+    0,0,61,1,0,0,104,1,0,0,143,1,0,0,182,1,0,0,219,1,0,0,0,2,0,0,25,2,0,0,50,2,0,0,85,2,0,0,122,2,0,0,161,2,0,0,202,2,
+    0,0,243,2,0,0,28,3,0,0,77,3,0,0,114,3,0,0,151,3,0,0,188,3,0,0,225,3,0,0,6,4,0,0,45,4,0,0,84,4,0,0,123,4,0,0,162,4,
+    0,0,207,4,0,0,250,4,0,0,37,5,0,0,80,5,0,0,121,5,0,0,157,5,0,0,177,5,0,0,194,5,0,0,213,5,0,0,232,5,0,0,136,0,0,1,0,96,
+    8,192,174,16,224,0,0,96,136,0,0,133,0,0,2,0,160,18,64,35,128,177,35,224,2,35,160,26,128,9,32,133,0,0,131,0,0,1,0,96,26,128,183,35,224,1,27,32,
+    0,192,131,0,0,130,0,0,1,0,96,35,64,185,35,224,1,35,192,9,32,130,0,0,129,0,0,1,0,32,35,64,187,35,224,3,35,160,0,160,0,0,0,0,129,0,0,0,
+    18,64,189,35,224,2,27,0,0,0,0,0,2,0,0,0,64,35,192,153,35,224,1,35,192,35,64,130,34,192,3,34,224,34,192,35,96,43,192,155,35,224,1,8,192,0,0,1,
+    0,0,9,128,151,35,224,8,35,160,18,32,8,224,0,32,0,0,0,0,0,64,17,128,0,96,130,0,0,2,8,160,17,128,26,224,152,35,224,1,18,0,0,0,1,0,0,26,
+    128,150,35,224,1,26,128,0,64,131,0,0,4,8,192,35,160,35,224,35,192,17,192,132,0,0,1,0,96,26,160,150,35,224,1,27,32,0,0,1,0,0,34,224,148,35,224,1,
+    35,160,9,64,132,0,0,1,9,96,35,192,131,35,224,0,18,0,133,0,0,0,18,0,149,35,224,1,35,128,0,0,1,0,0,35,0,147,35,224,1,35,160,8,192,132,0,0,
+    0,8,224,134,35,224,0,9,64,133,0,0,0,18,32,148,35,224,1,43,192,0,0,1,0,0,35,0,146,35,224,1,35,160,0,160,132,0,0,1,0,96,35,128,134,35,224,1,
+    35,160,0,64,133,0,0,0,26,128,147,35,224,1,43,192,0,0,1,0,0,35,0,146,35,224,0,17,128,133,0,0,0,26,192,136,35,224,0,18,32,133,0,0,1,0,32,27,
+    64,146,35,224,1,43,192,0,0,1,0,0,35,0,145,35,224,0,27,32,133,0,0,0,9,32,137,35,224,1,35,192,0,128,133,0,0,0,9,0,146,35,224,1,43,192,0,0,
+    1,0,0,35,0,145,35,224,0,9,32,133,0,0,0,26,224,138,35,224,0,26,160,134,0,0,0,26,96,145,35,224,1,43,192,0,0,1,0,0,35,0,144,35,224,0,35,96,
+    133,0,0,0,0,160,140,35,224,0,9,64,133,8,160,0,17,32,145,35,224,1,43,192,0,0,1,0,0,35,0,144,35,224,0,18,32,133,0,0,0,17,224,166,35,224,1,43,
+    192,0,0,1,0,0,35,0,144,35,224,0,8,224,133,0,0,0,27,0,166,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,35,192,133,0,0,1,0,32,35,192,144,
+    35,224,1,35,96,27,32,147,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,35,96,133,0,0,0,8,128,144,35,224,3,26,224,0,64,0,0,17,224,146,35,224,1,
+    43,192,0,0,1,0,0,35,0,143,35,224,0,26,224,133,0,0,0,9,0,143,35,224,0,17,224,131,0,0,1,9,0,35,64,144,35,224,1,43,192,0,0,1,0,0,35,0,
+    143,35,224,0,26,64,133,0,0,0,9,64,141,35,224,1,27,32,8,224,133,0,0,1,0,32,18,0,143,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,26,64,133,
+    0,0,0,17,96,139,35,224,1,35,160,17,160,137,0,0,1,8,192,26,224,141,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,26,64,133,0,0,0,17,96,138,35,
+    224,1,26,224,0,128,140,0,0,1,9,32,35,160,139,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,26,128,133,0,0,0,17,64,137,35,224,0,35,160,131,26,64,
+    0,8,192,134,0,0,0,26,0,130,26,64,0,26,128,139,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,34,224,133,0,0,0,8,224,142,35,224,0,17,192,133,0,
+    0,0,0,96,144,35,224,1,43,192,0,0,1,0,0,35,0,143,35,224,0,35,96,133,0,0,0,8,128,142,35,224,0,17,96,133,0,0,0,9,0,144,35,224,1,43,192,0,
+    0,1,0,0,35,0,144,35,224,0,0,64,133,0,0,0,35,192,141,35,224,0,9,0,133,0,0,0,18,0,144,35,224,1,43,192,0,0,1,0,0,35,0,144,35,224,0,9,
+    96,133,0,0,0,27,0,141,35,224,0,0,32,133,0,0,0,27,0,144,35,224,1,43,192,0,0,1,0,0,35,0,144,35,224,0,26,128,133,0,0,0,17,224,140,35,224,0,
+    26,224,133,0,0,0,0,128,145,35,224,1,43,192,0,0,1,0,0,35,0,144,35,224,1,35,192,0,64,132,0,0,0,8,160,140,35,224,0,17,128,133,0,0,0,18,32,145,
+    35,224,1,43,192,0,0,1,0,0,35,0,145,35,224,0,17,224,133,0,0,0,27,0,138,35,224,0,35,64,133,0,0,1,0,96,35,192,145,35,224,1,43,192,0,0,1,0,
+    0,35,0,145,35,224,1,35,128,0,32,132,0,0,0,9,96,138,35,224,0,9,0,133,0,0,0,18,32,146,35,224,1,43,192,0,0,1,0,0,35,0,146,35,224,0,17,224,
+    133,0,0,0,35,64,136,35,224,0,26,96,133,0,0,1,0,160,35,192,146,35,224,1,43,192,0,0,1,0,0,35,0,146,35,224,1,35,192,8,192,132,0,0,1,0,160,35,
+    160,134,35,224,1,35,64,0,32,132,0,0,1,0,128,35,160,147,35,224,1,43,192,0,0,1,0,0,26,224,147,35,224,1,35,160,0,192,132,0,0,0,9,64,133,35,224,1,
+    35,160,0,128,132,0,0,1,0,96,35,64,148,35,224,1,35,128,0,0,1,0,0,26,128,148,35,224,1,35,160,8,192,132,0,0,0,17,128,131,35,224,1,35,160,8,192,132,
+    0,0,1,0,160,35,64,149,35,224,1,27,32,0,0,1,0,0,9,128,149,35,224,1,35,160,17,160,132,0,0,4,9,96,35,160,35,224,27,32,0,192,132,0,0,1,17,160,
+    35,192,150,35,224,1,18,32,0,0,1,0,0,0,96,151,35,224,2,35,64,9,32,0,32,130,0,0,2,0,128,17,128,0,32,131,0,0,1,8,224,26,224,152,35,224,1,8,
+    192,0,0,129,0,0,0,26,160,152,35,224,3,35,192,35,64,26,224,26,96,132,26,32,1,26,64,35,32,153,35,224,2,27,0,0,0,0,0,129,0,0,1,0,96,35,160,187,
+    35,224,3,35,192,0,160,0,0,0,0,130,0,0,1,8,224,35,192,186,35,224,0,9,64,130,0,0,131,0,0,1,0,192,35,32,183,35,224,1,35,64,8,224,131,0,0,133,
+    0,0,1,9,96,27,32,179,35,224,1,27,32,9,96,133,0,0,135,0,0,3,0,96,9,32,17,96,17,128,173,17,96,1,9,32,0,96,135,0,0,
+    0,0,0,
+    // backward_off
+    82,76,68,0,45,0,0,0,0,0,51,0,0,0,130,0,0,0,151,0,0,0,170,0,0,0,188,0,0,0,204,0,0,0,238,0,0,0,25,1,0,0,68,1,0,0,109,1,
+    0,0,152,1,0,0,195,1,0,0,232,1,0,0,17,2,0,0,54,2,0,0,97,2,0,0,122,2,0,0,147,2,0,0,180,2,0,0,219,2,0,0,4,3,0,0,45,3,
+    0,0,86,3,0,0,127,3,0,0,176,3,0,0,215,3,0,0,252,3,0,0,33,4,0,0,70,4,0,0,109,4,0,0,148,4,0,0,187,4,0,0,226,4,0,0,9,5,
+    0,0,52,5,0,0,97,5,0,0,142,5,0,0,185,5,0,0,223,5,0,0,5,6,0,0,25,6,0,0,44,6,0,0,63,6,0,0,86,6,0,0,137,0,0,0,24,128,
+    131,32,160,0,24,160,134,32,160,0,24,160,133,32,160,0,24,160,133,32,160,0,24,160,130,32,160,0,24,160,134,32,160,0,24,160,134,32,160,0,24,128,137,0,0,133,0,0,
+    10,16,96,114,129,196,66,237,35,237,67,237,67,237,99,237,131,237,131,237,67,237,67,133,237,131,0,237,99,133,237,131,0,237,99,134,237,131,5,237,99,237,131,237,131,237,99,237,
+    67,237,99,132,237,131,0,237,99,133,237,131,5,237,99,237,67,237,67,204,98,131,1,40,224,133,0,0,131,0,0,2,8,32,122,161,221,2,182,237,35,1,155,130,24,160,131,0,
+    0,130,0,0,1,8,64,188,34,185,237,35,1,212,194,40,224,130,0,0,130,0,0,0,180,2,187,237,35,3,212,162,16,96,0,0,0,0,129,0,0,0,106,97,189,237,35,2,
+    155,98,0,0,0,0,129,0,0,0,220,226,153,237,35,3,212,130,163,162,147,65,147,65,130,147,33,1,179,226,196,98,155,237,35,1,24,128,0,0,1,0,0,65,128,151,237,35,
+    2,204,98,98,65,32,160,131,0,0,1,57,64,8,32,130,0,0,3,16,96,65,128,147,34,220,194,151,237,35,1,98,65,0,0,1,0,0,130,225,149,237,35,1,237,3,114,129,
+    132,0,0,4,24,128,196,66,237,35,212,162,65,129,132,0,0,1,8,32,122,161,150,237,35,1,163,162,0,0,1,0,0,155,162,148,237,35,1,204,130,49,0,132,0,0,1,49,
+    0,212,194,131,237,35,0,81,225,133,0,0,0,81,193,149,237,35,1,188,66,0,0,1,0,0,163,194,147,237,35,1,196,66,24,128,132,0,0,1,24,160,220,194,132,237,35,1,
+    229,3,49,0,133,0,0,0,90,1,148,237,35,1,204,130,0,0,1,0,0,163,162,146,237,35,1,204,98,8,64,132,0,0,1,8,32,188,2,134,237,35,1,196,66,8,32,133,
+    0,0,0,106,97,147,237,35,1,212,162,0,0,1,0,0,163,162,146,237,35,0,57,96,133,0,0,0,122,161,136,237,35,0,98,33,134,0,0,0,163,130,146,237,35,1,204,162,
+    0,0,1,0,0,163,162,145,237,35,0,163,130,133,0,0,0,40,224,137,237,35,1,212,162,8,64,133,0,0,1,32,192,229,3,145,237,35,1,212,162,0,0,1,0,0,163,162,
+    145,237,35,0,40,224,133,0,0,0,147,66,138,237,35,0,122,193,134,0,0,0,114,129,145,237,35,1,212,162,0,0,1,0,0,163,162,144,237,35,0,179,226,133,0,0,1,16,
+    64,229,3,138,237,35,1,228,227,40,224,133,16,96,1,24,160,220,227,144,237,35,1,212,162,0,0,1,0,0,163,162,144,237,35,0,98,33,133,0,0,0,89,225,166,237,35,1,
+    204,162,0,0,1,0,0,163,162,144,237,35,0,24,160,133,0,0,0,155,98,166,237,35,1,204,162,0,0,1,0,0,163,162,143,237,35,0,212,130,134,0,0,0,212,162,144,237,
+    35,1,188,2,155,98,147,237,35,1,204,130,0,0,1,0,0,163,162,143,237,35,0,171,194,133,0,0,0,8,64,144,237,35,4,139,1,0,0,0,0,73,129,220,194,145,237,35,
+    1,212,162,0,0,1,0,0,163,162,143,237,35,0,147,66,133,0,0,0,32,192,142,237,35,1,220,226,73,161,131,0,0,1,32,192,171,162,144,237,35,1,212,162,0,0,1,0,
+    0,163,162,143,237,35,0,114,129,133,0,0,0,57,64,141,237,35,1,155,130,24,128,134,0,0,1,81,225,220,226,142,237,35,1,212,162,0,0,1,0,0,163,162,143,237,35,0,
+    114,129,133,0,0,0,57,96,139,237,35,1,204,98,57,96,137,0,0,1,16,128,139,1,141,237,35,1,212,162,0,0,1,0,0,163,162,143,237,35,0,114,129,133,0,0,0,65,
+    96,138,237,35,1,139,1,8,32,140,0,0,1,40,224,196,66,139,237,35,1,212,162,0,0,1,0,0,163,162,143,237,35,0,122,193,133,0,0,0,57,64,137,237,35,0,196,66,
+    131,114,129,0,32,160,134,0,0,0,98,33,131,114,129,0,220,194,138,237,35,1,212,162,0,0,1,0,0,163,162,143,237,35,0,155,98,133,0,0,0,32,192,142,237,35,0,81,
+    193,133,0,0,1,0,32,228,227,143,237,35,1,212,162,0,0,1,0,0,163,162,143,237,35,0,179,226,133,0,0,0,8,64,142,237,35,0,57,96,133,0,0,0,32,224,144,237,
+    35,1,204,162,0,0,1,0,0,163,162,143,237,35,0,220,226,134,0,0,0,204,130,141,237,35,0,32,160,133,0,0,0,90,1,144,237,35,1,204,162,0,0,1,0,0,163,162,
+    144,237,35,0,49,32,133,0,0,0,155,98,140,237,35,0,212,194,134,0,0,0,155,98,144,237,35,1,204,130,0,0,1,0,0,163,162,144,237,35,0,122,161,133,0,0,0,81,
+    225,140,237,35,0,147,66,133,0,0,1,8,64,228,227,144,237,35,1,204,130,0,0,1,0,0,163,162,144,237,35,0,212,130,133,0,0,1,16,96,229,3,139,237,35,0,57,96,
+    133,0,0,0,98,33,145,237,35,1,212,162,0,0,1,0,0,163,162,145,237,35,0,81,193,133,0,0,0,155,98,138,237,35,0,171,162,133,0,0,1,0,32,204,130,145,237,35,
+    1,212,162,0,0,1,0,0,163,162,145,237,35,0,188,34,133,0,0,0,49,32,137,237,35,1,228,227,24,160,133,0,0,0,90,1,146,237,35,1,204,130,0,0,1,0,0,163,
+    162,146,237,35,0,81,193,133,0,0,0,163,162,136,237,35,0,106,97,133,0,0,1,8,64,212,162,146,237,35,1,204,130,0,0,1,0,0,163,162,146,237,35,1,212,162,24,128,
+    132,0,0,1,8,64,204,98,134,237,35,0,171,194,133,0,0,1,8,64,196,66,147,237,35,1,204,130,0,0,1,0,0,155,98,147,237,35,1,196,66,24,128,132,0,0,1,41,
+    0,220,226,132,237,35,1,196,98,8,64,132,0,0,1,0,32,171,194,148,237,35,1,196,66,0,0,1,0,0,122,193,148,237,35,1,196,98,24,128,132,0,0,1,57,64,229,3,
+    130,237,35,1,204,98,24,128,132,0,0,1,16,96,171,194,149,237,35,1,163,130,0,0,1,0,0,65,128,149,237,35,1,204,130,65,96,132,0,0,4,49,32,204,130,237,35,163,
+    130,16,128,132,0,0,1,65,96,212,162,150,237,35,1,98,65,0,0,129,0,0,0,220,226,150,237,35,1,155,130,32,224,131,0,0,1,8,64,57,64,132,0,0,1,16,96,139,
+    1,152,237,35,1,24,128,0,0,129,0,0,0,130,225,152,237,35,4,212,162,171,194,147,66,122,161,114,97,132,106,97,1,163,162,229,3,152,237,35,2,155,97,0,0,0,0,129,
+    0,0,1,8,64,204,130,187,237,35,3,212,194,16,128,0,0,0,0,130,0,0,1,32,192,212,194,185,237,35,1,220,227,49,32,130,0,0,131,0,0,1,24,160,163,162,183,237,
+    35,1,180,2,32,192,131,0,0,133,0,0,2,49,64,163,162,229,35,177,237,35,2,229,35,163,162,57,96,133,0,0,135,0,0,3,0,32,41,0,65,128,65,161,130,65,129,129,
+    65,128,130,65,129,131,65,128,0,65,96,131,65,128,0,65,129,131,65,128,2,65,96,65,128,65,128,131,65,129,129,65,128,130,65,129,131,65,128,0,65,96,131,65,128,130,65,129,
+    1,41,0,0,32,135,0,0,
+    // warning_off
+    82,76,71,0,177,0,0,0,0,0,3,0,0,0,6,0,0,0,40,0,0,0,60,0,0,0,78,0,0,0,96,0,0,0,112,0,0,0,128,0,0,0,144,0,0,0,160,0,
+    0,0,176,0,0,0,192,0,0,0,210,0,0,0,226,0,0,0,242,0,0,0,2,1,0,0,18,1,0,0,34,1,0,0,50,1,0,0,66,1,0,0,82,1,0,0,98,1,
+    0,0,114,1,0,0,130,1,0,0,146,1,0,0,162,1,0,0,178,1,0,0,194,1,0,0,210,1,0,0,228,1,0,0,244,1,0,0,4,2,0,0,20,2,0,0,36,2,
+    0,0,52,2,0,0,68,2,0,0,84,2,0,0,100,2,0,0,116,2,0,0,132,2,0,0,148,2,0,0,164,2,0,0,180,2,0,0,196,2,0,0,212,2,0,0,228,2,
+    0,0,244,2,0,0,4,3,0,0,20,3,0,0,36,3,0,0,52,3,0,0,68,3,0,0,84,3,0,0,100,3,0,0,116,3,0,0,132,3,0,0,148,3,0,0,164,3,
+    0,0,180,3,0,0,196,3,0,0,212,3,0,0,228,3,0,0,244,3,0,0,4,4,0,0,20,4,0,0,36,4,0,0,52,4,0,0,68,4,0,0,84,4,0,0,100,4,
+    0,0,116,4,0,0,132,4,0,0,148,4,0,0,164,4,0,0,180,4,0,0,196,4,0,0,212,4,0,0,228,4,0,0,244,4,0,0,4,5,0,0,20,5,0,0,36,5,
+    0,0,52,5,0,0,68,5,0,0,84,5,0,0,100,5,0,0,116,5,0,0,132,5,0,0,148,5,0,0,164,5,0,0,180,5,0,0,196,5,0,0,212,5,0,0,228,5,
+    0,0,244,5,0,0,4,6,0,0,20,6,0,0,36,6,0,0,52,6,0,0,68,6,0,0,84,6,0,0,100,6,0,0,116,6,0,0,132,6,0,0,148,6,0,0,164,6,
+    0,0,180,6,0,0,196,6,0,0,212,6,0,0,228,6,0,0,244,6,0,0,4,7,0,0,20,7,0,0,36,7,0,0,52,7,0,0,68,7,0,0,84,7,0,0,100,7,
+    0,0,116,7,0,0,132,7,0,0,148,7,0,0,164,7,0,0,180,7,0,0,196,7,0,0,212,7,0,0,228,7,0,0,244,7,0,0,4,8,0,0,20,8,0,0,36,8,
+    0,0,52,8,0,0,68,8,0,0,84,8,0,0,100,8,0,0,132,8,0,0,154,8,0,0,170,8,0,0,186,8,0,0,202,8,0,0,218,8,0,0,234,8,0,0,250,8,
+    0,0,10,9,0,0,28,9,0,0,44,9,0,0,60,9,0,0,76,9,0,0,92,9,0,0,108,9,0,0,124,9,0,0,140,9,0,0,156,9,0,0,172,9,0,0,188,9,
+    0,0,204,9,0,0,220,9,0,0,236,9,0,0,252,9,0,0,12,10,0,0,28,10,0,0,44,10,0,0,60,10,0,0,76,10,0,0,92,10,0,0,108,10,0,0,124,10,
+    0,0,140,10,0,0,156,10,0,0,172,10,0,0,188,10,0,0,204,10,0,0,220,10,0,0,236,10,0,0,252,10,0,0,106,11,0,0,109,11,0,0,198,0,0,198,0,0,
+    139,0,0,3,16,64,73,66,105,195,130,36,138,138,68,0,138,36,135,138,68,0,138,36,158,138,68,2,113,227,0,0,0,0,137,0,0,2,81,98,170,165,227,135,182,219,103,2,
+    178,197,0,0,0,0,135,0,0,1,56,225,195,6,185,219,103,2,178,197,0,0,0,0,134,0,0,1,73,66,219,135,186,219,103,2,178,197,0,0,0,0,133,0,0,0,73,34,
+    188,219,103,2,178,197,0,0,0,0,132,0,0,0,65,34,189,219,103,2,178,197,0,0,0,0,131,0,0,0,40,193,190,219,103,2,178,197,0,0,0,0,131,0,0,0,186,230,
+    190,219,103,2,178,197,0,0,0,0,130,0,0,0,65,2,191,219,103,2,178,197,0,0,0,0,130,0,0,0,154,101,191,219,103,2,178,197,0,0,0,0,129,0,0,1,8,0,
+    219,135,191,219,103,2,178,197,0,0,0,0,129,0,0,0,57,2,192,219,103,2,178,197,0,0,0,0,129,0,0,0,97,131,192,219,103,2,178,197,0,0,0,0,129,0,0,0,
+    121,228,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,
+    130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,
+    130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,
+    130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,
+    130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,1,130,4,219,102,191,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,
+    0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,176,219,103,0,219,102,135,219,103,2,219,102,
+    219,103,219,102,131,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,138,219,103,0,219,102,180,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,
+    0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,
+    0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,
+    0,0,0,0,129,0,0,1,130,4,219,102,191,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,178,197,0,0,0,0,129,0,0,0,130,4,192,219,103,2,
+    186,229,0,0,0,0,129,0,0,0,130,4,192,219,103,2,186,229,0,0,0,0,129,0,0,2,130,36,227,135,227,135,130,227,167,131,227,135,129,227,167,132,227,135,129,227,167,6,
+    227,135,227,167,227,135,227,135,227,167,227,167,227,135,130,227,167,130,227,135,2,227,167,227,135,227,135,130,227,167,8,227,135,227,167,227,135,227,167,227,135,227,135,227,167,227,167,227,
+    135,131,227,167,129,227,135,5,227,167,227,135,227,167,227,167,227,135,227,135,130,227,167,129,227,135,129,227,167,2,187,6,0,0,0,0,198,0,0,198,0,0,
+    0,0,
+    // warning_pending_engine
+    82,76,71,0,177,0,0,0,0,0,3,0,0,0,6,0,0,0,28,0,0,0,44,0,0,0,60,0,0,0,76,0,0,0,90,0,0,0,106,0,0,0,120,0,0,0,152,0,
+    0,0,182,0,0,0,210,0,0,0,242,0,0,0,26,1,0,0,66,1,0,0,108,1,0,0,148,1,0,0,190,1,0,0,230,1,0,0,24,2,0,0,78,2,0,0,132,2,
+    0,0,184,2,0,0,238,2,0,0,36,3,0,0,86,3,0,0,138,3,0,0,188,3,0,0,242,3,0,0,40,4,0,0,90,4,0,0,144,4,0,0,198,4,0,0,246,4,
+    0,0,42,5,0,0,96,5,0,0,150,5,0,0,202,5,0,0,0,6,0,0,52,6,0,0,90,6,0,0,143,6,0,0,171,6,0,0,197,6,0,0,235,6,0,0,255,6,
+    0,0,13,7,0,0,27,7,0,0,41,7,0,0,55,7,0,0,69,7,0,0,83,7,0,0,97,7,0,0,111,7,0,0,125,7,0,0,139,7,0,0,153,7,0,0,167,7,
+    0,0,181,7,0,0,195,7,0,0,209,7,0,0,253,7,0,0,77,8,0,0,157,8,0,0,233,8,0,0,53,9,0,0,137,9,0,0,217,9,0,0,245,9,0,0,11,10,
+    0,0,25,10,0,0,39,10,0,0,61,10,0,0,91,10,0,0,173,10,0,0,7,11,0,0,97,11,0,0,187,11,0,0,21,12,0,0,111,12,0,0,139,12,0,0,165,12,
+    0,0,179,12,0,0,193,12,0,0,213,12,0,0,239,12,0,0,9,13,0,0,93,13,0,0,175,13,0,0,1,14,0,0,83,14,0,0,167,14,0,0,203,14,0,0,237,14,
+    0,0,251,14,0,0,9,15,0,0,23,15,0,0,53,15,0,0,83,15,0,0,177,15,0,0,17,16,0,0,121,16,0,0,203,16,0,0,41,17,0,0,97,17,0,0,123,17,
+    0,0,137,17,0,0,151,17,0,0,165,17,0,0,195,17,0,0,231,17,0,0,91,18,0,0,207,18,0,0,67,19,0,0,179,19,0,0,45,20,0,0,107,20,0,0,135,20,
+    0,0,149,20,0,0,163,20,0,0,177,20,0,0,191,20,0,0,205,20,0,0,219,20,0,0,233,20,0,0,247,20,0,0,5,21,0,0,19,21,0,0,33,21,0,0,47,21,
+    0,0,61,21,0,0,75,21,0,0,89,21,0,0,119,21,0,0,165,21,0,0,7,22,0,0,109,22,0,0,211,22,0,0,53,23,0,0,159,23,0,0,5,24,0,0,19,24,
+    0,0,33,24,0,0,47,24,0,0,61,24,0,0,95,24,0,0,143,24,0,0,241,24,0,0,93,25,0,0,199,25,0,0,47,26,0,0,169,26,0,0,35,27,0,0,55,27,
+    0,0,75,27,0,0,89,27,0,0,103,27,0,0,117,27,0,0,131,27,0,0,145,27,0,0,159,27,0,0,173,27,0,0,187,27,0,0,201,27,0,0,215,27,0,0,229,27,
+    0,0,243,27,0,0,1,28,0,0,15,28,0,0,29,28,0,0,43,28,0,0,57,28,0,0,71,28,0,0,85,28,0,0,99,28,0,0,115,28,0,0,198,0,0,198,0,0,
+    138,0,0,3,24,0,104,0,168,0,208,0,180,232,0,2,224,0,16,0,0,0,136,0,0,1,56,0,168,0,185,248,0,1,24,0,0,0,134,0,0,1,8,0,152,0,187,248,
+    0,1,24,0,0,0,133,0,0,1,8,0,176,0,188,248,0,1,24,0,0,0,133,0,0,0,176,0,189,248,0,1,24,0,0,0,131,0,0,1,8,0,176,0,190,248,0,1,
+    24,0,0,0,131,0,0,0,136,0,191,248,0,1,24,0,0,0,130,0,0,0,56,0,152,248,0,6,249,4,252,146,254,154,255,60,254,154,251,207,248,65,160,248,0,1,24,0,
+    0,0,130,0,0,0,160,0,151,248,0,1,249,69,255,158,132,255,255,1,254,154,248,130,159,248,0,1,24,0,0,0,129,0,0,1,8,0,240,0,151,248,0,0,254,56,134,255,
+    255,0,253,52,159,248,0,1,24,0,0,0,129,0,0,0,88,0,151,248,0,0,251,12,131,255,255,0,255,60,131,255,255,0,250,138,158,248,0,1,24,0,0,0,129,0,0,0,
+    144,0,150,248,0,1,248,195,255,125,130,255,255,2,251,109,248,0,252,48,130,255,255,1,255,28,248,97,157,248,0,1,24,0,0,0,129,0,0,0,184,0,150,248,0,0,253,85,
+    130,255,255,4,253,182,248,0,248,0,248,32,254,154,130,255,255,0,252,146,157,248,0,1,24,0,0,0,129,0,0,0,224,0,149,248,0,0,250,235,130,255,255,1,255,60,248,162,
+    130,248,0,0,249,199,130,255,255,1,255,223,249,166,156,248,0,1,24,0,0,0,129,0,0,0,232,0,148,248,0,1,248,162,255,158,130,255,255,0,251,44,132,248,0,0,252,113,
+    130,255,255,0,254,56,156,248,0,1,24,0,0,0,129,0,0,0,232,0,148,248,0,0,253,20,130,255,255,1,254,154,248,32,132,248,0,1,248,65,254,219,130,255,255,0,251,109,
+    155,248,0,1,24,0,0,0,129,0,0,0,232,0,147,248,0,0,250,8,131,255,255,0,249,166,134,248,0,0,250,8,130,255,255,1,255,223,249,134,154,248,0,1,24,0,0,0,
+    129,0,0,0,232,0,146,248,0,1,248,65,254,219,130,255,255,0,252,146,130,248,0,2,250,235,252,81,250,170,130,248,0,0,252,243,130,255,255,0,254,89,154,248,0,1,24,0,
+    0,0,129,0,0,0,232,0,146,248,0,0,252,16,130,255,255,4,255,28,248,97,248,0,248,0,253,117,130,255,255,4,252,113,248,0,248,0,248,130,255,60,130,255,255,0,251,142,
+    153,248,0,1,24,0,0,0,129,0,0,0,232,0,145,248,0,1,248,195,255,190,130,255,255,3,251,12,248,0,248,0,249,134,131,255,255,0,255,125,130,248,0,0,251,109,130,255,
+    255,1,255,125,248,130,152,248,0,1,24,0,0,0,129,0,0,0,232,0,145,248,0,0,253,52,130,255,255,0,253,247,130,248,0,0,249,166,131,255,255,0,255,60,130,248,0,1,
+    248,32,254,154,130,255,255,0,252,146,152,248,0,1,24,0,0,0,129,0,0,0,232,0,144,248,0,0,250,138,130,255,255,1,255,60,248,162,130,248,0,0,248,195,131,255,255,0,
+    254,186,131,248,0,0,249,231,130,255,255,1,255,223,249,166,151,248,0,1,24,0,0,0,129,0,0,0,232,0,143,248,0,1,249,4,255,158,130,255,255,0,250,170,131,248,0,0,
+    248,65,131,255,255,0,253,150,132,248,0,0,251,207,130,255,255,1,254,154,248,32,150,248,0,1,24,0,0,0,129,0,0,0,232,0,143,248,0,0,253,182,130,255,255,0,253,182,
+    133,248,0,0,254,251,130,255,255,0,252,211,133,248,0,0,254,24,130,255,255,0,252,211,150,248,0,1,24,0,0,0,129,0,0,0,232,0,142,248,0,0,250,8,130,255,255,1,
+    255,223,249,36,133,248,0,0,254,121,130,255,255,0,251,239,133,248,0,0,249,134,131,255,255,0,250,8,149,248,0,1,24,0,0,0,129,0,0,0,232,0,142,248,0,0,254,121,
+    130,255,255,0,252,146,134,248,0,0,253,52,130,255,255,0,251,142,134,248,0,0,252,243,130,255,255,0,254,121,149,248,0,1,24,0,0,0,129,0,0,0,232,0,141,248,0,0,
+    251,142,130,255,255,1,255,28,248,97,134,248,0,0,252,113,130,255,255,0,250,105,134,248,0,1,248,130,255,60,130,255,255,0,251,142,148,248,0,1,24,0,0,0,129,0,0,0,
+    232,0,140,248,0,1,248,227,255,158,130,255,255,0,250,105,135,248,0,0,251,44,130,255,255,0,249,231,135,248,0,0,250,138,130,255,255,1,255,190,249,36,147,248,0,1,24,0,
+    0,0,129,0,0,0,232,0,140,248,0,0,253,182,130,255,255,0,252,146,136,248,0,0,250,138,130,255,255,0,248,195,136,248,0,0,253,118,130,255,255,0,253,215,147,248,0,1,
+    24,0,0,0,129,0,0,0,232,0,139,248,0,0,251,77,130,255,255,1,254,121,248,32,136,248,0,0,249,101,130,255,255,0,248,97,136,248,0,1,248,227,255,125,130,255,255,0,
+    250,236,146,248,0,1,24,0,0,0,129,0,0,0,232,0,138,248,0,1,249,4,255,190,130,255,255,0,249,231,137,248,0,3,248,33,255,93,255,255,254,121,138,248,0,0,251,12,
+    130,255,255,1,255,93,248,97,145,248,0,1,24,0,0,0,129,0,0,0,232,0,138,248,0,0,253,150,130,255,255,0,253,85,139,248,0,2,249,101,251,174,249,4,139,248,0,0,
+    253,215,130,255,255,0,253,52,145,248,0,1,24,0,0,0,129,0,0,0,232,0,137,248,0,0,250,170,130,255,255,1,255,125,248,195,139,248,0,2,250,105,252,16,250,105,139,248,
+    0,1,249,36,255,190,130,255,255,0,251,12,144,248,0,1,24,0,0,0,129,0,0,0,232,0,136,248,0,1,248,162,255,93,130,255,255,0,251,77,139,248,0,0,253,150,130,255,
+    255,0,252,81,139,248,0,0,251,174,130,255,255,1,255,125,248,227,143,248,0,1,24,0,0,0,129,0,0,0,232,0,136,248,0,0,253,85,130,255,255,0,254,56,139,248,0,0,
+    249,231,131,255,255,1,255,190,248,65,138,248,0,1,248,32,254,154,130,255,255,0,253,150,143,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,0,250,40,131,255,255,0,
+    249,231,139,248,0,0,249,199,131,255,255,1,255,158,248,32,139,248,0,0,250,40,131,255,255,0,250,73,142,248,0,1,24,0,0,0,129,0,0,0,232,0,134,248,0,1,248,65,
+    254,186,130,255,255,0,252,146,141,248,0,0,252,243,130,255,255,0,251,142,141,248,0,0,253,182,130,255,255,1,254,186,248,32,141,248,0,1,24,0,0,0,129,0,0,0,232,0,
+    134,248,0,0,251,77,130,255,255,1,254,24,248,32,142,248,0,2,249,231,251,174,249,166,142,248,0,1,248,227,255,125,130,255,255,0,250,138,141,248,0,1,24,0,0,0,129,0,
+    0,0,232,0,134,248,0,0,253,117,130,255,255,0,250,170,162,248,0,0,251,174,130,255,255,0,251,239,141,248,0,1,24,0,0,0,129,0,0,0,232,0,134,248,0,0,252,243,
+    130,255,255,2,254,186,253,20,252,81,135,252,48,0,252,16,139,251,239,138,252,48,1,252,113,255,28,130,255,255,0,251,44,141,248,0,1,24,0,0,0,129,0,0,0,232,0,134,
+    248,0,0,249,199,169,255,255,1,255,190,248,162,141,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,0,251,174,168,255,255,0,251,77,142,248,0,1,24,0,0,0,129,
+    0,0,0,232,0,136,248,0,4,250,40,253,85,255,60,255,93,255,125,160,255,255,2,255,125,253,247,250,73,143,248,0,1,24,0,0,0,129,0,0,0,232,0,141,248,0,160,248,
+    65,146,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,
+    0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,
+    0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,
+    1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,
+    0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,3,251,12,253,215,253,182,249,134,133,248,0,
+    6,250,105,248,0,248,97,251,77,248,0,248,0,254,24,168,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,30,254,186,248,0,248,0,248,65,248,0,248,130,250,138,249,
+    69,248,0,249,199,254,186,250,40,250,170,254,89,250,8,250,8,249,166,248,0,249,134,248,97,250,105,248,227,248,0,248,0,249,231,250,105,250,8,248,97,248,195,250,138,249,101,154,
+    248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,30,252,243,252,211,248,195,248,0,248,97,253,247,250,105,253,85,249,231,250,170,254,251,251,44,251,174,254,154,251,44,251,
+    44,254,121,248,0,253,215,253,85,251,12,254,154,248,0,252,16,251,239,251,77,254,89,248,162,254,56,250,73,250,235,154,248,0,1,24,0,0,0,129,0,0,0,232,0,136,248,0,
+    28,251,142,255,60,249,166,250,235,253,85,250,138,252,16,252,16,248,0,254,89,248,0,248,195,253,150,248,0,248,0,254,89,248,0,253,215,248,130,248,0,253,117,248,195,253,85,248,
+    227,248,65,253,215,248,0,254,121,250,170,155,248,0,1,24,0,0,0,129,0,0,0,232,0,137,248,0,28,250,73,252,243,251,77,253,85,250,203,250,170,249,36,248,0,254,56,248,
+    0,248,195,253,150,248,0,248,0,254,56,248,0,253,215,248,97,248,0,253,85,248,195,252,113,253,85,253,52,250,40,248,0,248,195,252,16,253,247,154,248,0,1,24,0,0,0,129,
+    0,0,0,232,0,134,248,0,32,248,65,252,16,249,231,252,178,251,142,249,4,254,56,249,134,249,231,249,36,248,0,254,154,249,231,248,97,254,121,249,199,248,65,254,56,248,0,253,
+    215,248,97,248,0,253,85,248,195,253,52,252,113,251,207,250,40,248,97,250,138,249,69,254,56,248,65,153,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,30,250,8,251,
+    174,250,105,248,0,248,0,249,69,251,174,251,44,248,130,248,0,249,199,251,109,248,0,250,73,251,142,248,65,250,138,248,0,250,105,248,32,248,0,250,40,248,65,253,182,249,69,249,
+    36,253,247,249,36,250,235,251,174,249,134,154,248,0,1,24,0,0,0,129,0,0,0,232,0,158,248,0,4,253,117,252,113,252,81,253,150,248,32,157,248,0,1,24,0,0,0,129,
+    0,0,0,232,0,159,248,0,1,248,162,248,195,159,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,
+    0,129,0,0,0,232,0,139,248,0,1,248,97,248,65,179,248,0,1,24,0,0,0,129,0,0,0,232,0,139,248,0,1,252,48,250,203,152,248,0,1,250,138,250,235,152,248,0,
+    1,24,0,0,0,129,0,0,0,232,0,136,248,0,129,248,130,23,248,0,252,48,251,12,248,195,248,32,248,0,248,0,248,65,248,227,248,0,248,0,248,65,248,32,248,162,248,65,
+    248,0,248,0,248,32,248,227,248,97,248,32,248,0,248,65,248,227,131,248,0,129,248,97,2,248,0,248,65,248,227,149,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,
+    27,250,203,254,89,254,89,249,199,252,48,254,121,253,215,254,121,248,0,249,134,254,56,253,117,253,150,248,0,251,207,253,247,253,215,254,186,248,32,248,162,254,56,253,85,255,125,250,
+    8,249,166,254,89,253,85,252,146,130,248,0,5,250,203,251,77,249,36,254,154,252,243,251,12,148,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,35,254,89,248,65,248,
+    0,248,97,252,48,251,207,248,0,253,20,249,101,248,65,248,0,248,0,254,89,248,0,251,207,252,48,248,0,252,211,249,166,251,44,251,109,248,0,254,24,248,0,254,89,249,134,248,
+    97,254,24,248,65,248,0,248,0,250,203,251,77,250,138,253,52,248,32,149,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,0,254,121,130,248,0,32,252,48,250,203,248,
+    0,252,113,249,166,249,101,253,117,252,178,255,93,248,0,251,207,251,12,248,0,252,16,250,8,250,8,254,121,252,178,252,81,248,0,255,158,252,178,252,113,252,48,248,65,248,0,248,
+    0,250,203,251,77,248,32,251,77,253,247,250,73,148,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,27,254,56,249,69,248,227,249,69,252,48,250,203,248,0,252,113,249,
+    166,252,81,251,77,248,130,255,28,248,0,251,207,251,12,248,0,252,16,250,8,251,207,252,113,250,170,249,36,248,0,253,215,250,105,248,0,249,4,130,248,0,5,250,203,251,77,249,
+    4,248,65,249,69,253,52,148,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,27,249,69,252,243,252,146,248,162,250,138,249,166,248,0,250,170,249,4,248,162,252,146,252,
+    81,251,207,248,0,250,73,249,231,248,0,250,138,249,36,251,109,252,81,250,203,253,182,249,199,248,130,252,81,253,20,251,174,130,248,0,5,249,166,250,8,249,166,252,243,252,178,249,
+    36,148,248,0,1,24,0,0,0,129,0,0,0,232,0,154,248,0,4,253,117,251,77,249,4,253,150,249,134,161,248,0,1,24,0,0,0,129,0,0,0,232,0,154,248,0,3,248,
+    162,251,77,251,239,250,8,162,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,
+    0,153,248,0,129,248,65,165,248,0,1,24,0,0,0,129,0,0,0,232,0,153,248,0,3,251,12,252,16,248,32,252,243,163,248,0,1,24,0,0,0,129,0,0,0,232,0,153,
+    248,0,3,251,44,252,16,248,0,249,199,163,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,32,252,178,252,81,253,150,252,81,248,0,248,195,253,85,253,52,251,239,248,
+    0,251,44,252,178,253,150,253,52,248,0,248,65,253,117,253,117,253,247,252,16,248,0,253,85,248,0,253,20,252,113,253,150,252,146,248,0,250,40,253,85,253,150,254,24,248,195,152,
+    248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,31,253,117,249,199,248,0,254,24,248,227,252,146,250,8,248,97,253,182,248,227,251,174,251,109,248,0,253,117,249,69,250,
+    235,251,207,248,0,252,16,252,16,248,0,254,56,248,0,254,56,249,101,248,0,254,56,248,65,253,182,248,97,248,130,253,117,153,248,0,1,24,0,0,0,129,0,0,0,232,0,135,
+    248,0,31,253,117,248,162,248,0,253,20,249,199,253,150,252,211,252,113,252,81,248,162,251,174,250,105,248,0,252,211,249,166,251,174,250,170,248,0,251,12,252,16,248,0,254,56,248,
+    0,254,56,248,0,248,0,253,182,248,97,252,178,253,52,253,85,251,12,153,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,31,253,117,251,44,248,130,254,154,248,97,252,
+    48,251,12,248,0,249,4,248,0,251,174,250,105,248,0,252,211,249,166,250,138,252,211,248,65,253,117,252,16,248,0,254,56,248,0,254,56,248,0,248,0,253,182,248,97,253,182,250,
+    235,250,138,248,195,153,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,32,253,117,252,113,254,154,250,170,248,0,248,65,253,52,254,89,252,243,248,0,250,203,249,199,248,
+    0,251,174,249,69,248,0,252,243,254,89,251,142,251,12,248,0,252,178,248,0,252,178,248,0,248,0,252,81,248,65,253,52,251,109,251,174,254,186,248,97,152,248,0,1,24,0,0,
+    0,129,0,0,0,232,0,135,248,0,1,253,117,248,162,153,248,0,4,254,121,249,69,249,4,254,24,248,130,152,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,1,250,
+    170,248,65,153,248,0,3,249,134,251,207,251,207,249,101,153,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,
+    0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,150,248,0,1,250,105,248,32,142,248,0,1,248,130,251,174,151,248,0,1,24,0,0,0,129,
+    0,0,0,232,0,150,248,0,1,251,12,248,65,142,248,0,1,248,227,253,85,151,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,26,249,36,252,178,253,20,249,101,248,
+    0,251,174,251,44,253,117,250,105,248,0,248,227,252,211,253,52,253,52,248,32,251,239,248,32,250,235,251,77,253,85,252,113,248,0,248,0,251,239,252,243,252,48,248,32,130,248,0,
+    8,250,138,253,117,252,81,253,85,248,0,249,36,252,211,252,243,249,69,146,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,38,253,182,248,195,248,130,254,24,248,0,253,
+    182,250,170,248,97,254,121,248,0,252,243,249,36,249,231,252,48,248,0,253,247,248,32,252,81,252,16,248,0,253,20,249,199,250,235,251,142,248,0,251,142,251,12,248,0,248,0,248,
+    162,254,89,248,32,250,235,253,85,248,0,253,215,248,162,248,162,253,247,146,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,42,255,93,254,24,253,247,254,89,248,0,253,
+    182,248,97,248,0,254,56,248,0,252,48,251,12,251,207,251,142,248,0,253,247,248,32,252,81,249,199,248,0,251,207,250,73,252,113,254,154,254,24,254,89,251,109,248,0,248,0,249,
+    231,252,211,248,0,248,227,253,85,248,0,255,125,254,24,253,247,254,56,248,195,254,121,254,121,248,227,142,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,1,254,121,248,
+    32,130,248,0,18,253,182,248,97,248,0,254,56,248,0,253,52,251,77,251,12,248,32,248,0,253,247,248,32,252,81,249,199,248,0,251,207,250,73,251,239,250,138,132,248,0,6,249,
+    69,253,150,248,0,249,101,253,85,248,0,254,154,149,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,26,251,12,253,150,252,146,251,174,248,0,253,182,248,97,248,0,254,
+    24,248,0,252,178,253,150,253,52,252,113,248,0,253,247,248,32,252,81,249,199,248,0,251,207,250,73,248,227,253,247,252,146,252,243,249,134,130,248,0,8,253,117,253,20,252,243,253,
+    85,248,0,251,44,253,117,252,178,251,142,146,248,0,1,24,0,0,0,129,0,0,0,232,0,136,248,0,1,248,32,248,97,134,248,0,3,254,121,248,0,248,32,254,121,137,248,0,
+    1,248,130,248,32,132,248,0,0,248,130,131,248,0,1,248,32,248,97,147,248,0,1,24,0,0,0,129,0,0,0,232,0,145,248,0,3,250,138,252,243,252,211,250,40,171,248,0,
+    1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,
+    0,0,0,232,0,158,248,0,1,249,231,248,227,139,248,0,1,249,166,249,4,146,248,0,1,24,0,0,0,129,0,0,0,232,0,158,248,0,1,250,73,249,69,136,248,0,4,251,
+    77,250,73,248,0,250,8,249,69,146,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,48,249,36,252,178,253,20,249,101,248,0,251,174,251,44,253,117,250,105,248,0,248,
+    97,252,113,253,20,250,105,248,0,250,138,251,109,253,117,248,97,252,81,253,20,253,52,250,40,250,235,249,101,249,231,253,52,253,52,250,8,249,101,252,211,253,52,250,73,249,199,254,
+    186,254,89,253,85,253,85,249,134,248,0,250,138,253,52,252,243,248,195,248,0,251,207,251,142,253,117,249,231,136,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,48,253,
+    150,248,227,248,162,253,247,248,0,253,182,251,44,248,130,254,121,248,0,251,239,250,138,248,32,254,89,248,65,251,239,253,85,248,97,251,77,251,142,248,0,254,24,248,0,252,113,250,
+    40,248,0,248,0,253,150,249,69,249,101,248,97,248,97,254,89,248,0,252,48,250,235,248,0,251,207,250,105,249,36,254,56,248,32,250,40,253,52,248,0,254,89,250,138,248,227,253,
+    247,136,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,48,255,28,252,211,252,211,254,89,248,0,253,182,248,130,248,0,254,56,248,0,253,182,253,52,252,211,254,154,249,
+    4,251,239,250,73,248,0,250,235,252,178,249,101,254,24,248,0,252,113,250,40,248,0,250,40,252,178,248,0,248,97,251,174,252,178,254,186,248,0,252,48,250,203,248,0,251,207,250,
+    105,251,44,251,207,248,0,248,0,254,121,248,0,254,56,248,0,248,0,254,56,136,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,1,254,121,248,32,130,248,0,6,253,
+    182,248,97,248,0,254,56,248,0,253,85,249,69,130,248,0,33,251,239,250,73,248,0,251,207,252,16,251,174,249,4,248,0,252,113,250,40,248,65,254,56,248,97,248,0,253,85,250,
+    203,248,0,254,121,248,0,252,48,250,203,248,0,251,207,250,105,250,170,252,146,248,0,248,130,253,247,248,0,254,56,248,0,248,0,254,24,136,248,0,1,24,0,0,0,129,0,0,
+    0,232,0,135,248,0,51,251,12,253,150,252,146,251,174,248,0,253,182,248,97,248,0,254,24,248,0,249,166,253,247,252,146,252,211,248,0,251,207,250,40,248,0,251,12,254,89,253,
+    20,253,117,249,4,252,81,250,40,251,12,254,186,253,52,250,170,251,109,253,150,252,211,254,56,248,0,250,73,254,89,251,12,251,207,250,105,248,32,253,150,252,243,253,215,250,8,248,
+    0,254,56,248,0,248,0,254,24,248,0,252,16,251,44,133,248,0,1,24,0,0,0,129,0,0,0,232,0,136,248,0,1,248,32,248,97,136,248,0,0,248,130,132,248,0,4,253,
+    150,249,4,248,0,251,239,250,203,134,248,0,1,248,65,248,32,130,248,0,0,248,65,132,248,0,0,248,97,143,248,0,1,24,0,0,0,129,0,0,0,232,0,153,248,0,4,249,
+    166,252,243,252,211,251,239,248,32,162,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,
+    0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,
+    1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,
+    0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,
+    248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,139,248,0,1,248,32,249,
+    199,144,248,0,1,248,65,249,199,160,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,5,250,105,254,186,254,121,249,69,248,162,253,182,136,248,0,1,248,195,248,162,133,
+    248,0,1,249,69,254,56,160,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,17,254,121,248,97,248,130,248,195,248,162,253,215,248,97,248,130,248,0,248,0,248,97,248,
+    0,248,0,248,97,248,0,251,142,251,109,248,65,131,248,0,19,248,227,249,134,254,56,248,0,248,0,248,130,248,195,248,0,248,0,248,97,248,0,248,0,248,97,248,0,248,0,248,
+    65,248,32,248,0,248,162,248,97,143,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,17,253,215,251,44,248,0,248,0,248,162,255,60,253,20,254,56,250,8,248,0,254,
+    89,248,0,248,0,254,56,248,162,254,24,254,24,250,203,130,248,0,21,253,182,252,146,254,24,254,56,248,0,251,142,253,52,252,211,253,215,248,65,254,121,248,0,250,170,254,251,248,
+    0,250,138,251,174,251,174,253,247,252,211,254,121,248,227,142,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,16,248,130,252,113,254,154,249,69,248,162,253,247,248,0,249,
+    231,252,81,248,0,254,89,248,0,248,0,254,56,248,0,251,44,251,12,130,248,0,22,249,101,253,20,248,0,249,134,254,56,248,0,254,154,248,0,248,0,253,85,250,105,252,146,249,
+    199,252,178,254,56,249,101,252,243,249,36,251,174,251,142,248,0,251,142,250,203,142,248,0,1,24,0,0,0,129,0,0,0,232,0,137,248,0,14,250,73,252,243,248,162,253,150,248,
+    0,249,166,252,113,248,0,254,56,248,0,248,0,254,56,248,0,251,44,250,235,130,248,0,22,249,199,252,146,248,0,249,69,254,56,248,32,254,89,248,0,248,0,252,178,250,170,250,
+    8,252,48,253,85,250,170,251,207,253,215,248,0,251,174,251,12,248,0,251,44,250,235,142,248,0,1,24,0,0,0,129,0,0,0,232,0,134,248,0,43,248,65,251,44,248,97,251,
+    207,252,16,248,162,253,150,248,0,249,166,252,113,248,0,254,24,249,36,251,44,254,56,248,0,250,235,251,207,248,65,248,0,248,0,248,162,254,154,248,65,252,146,254,56,248,0,254,
+    89,249,36,248,227,255,28,248,195,248,32,254,186,252,113,248,65,254,219,252,113,248,0,251,174,251,12,248,0,251,44,250,235,142,248,0,1,24,0,0,0,129,0,0,0,232,0,135,
+    248,0,17,251,142,253,85,252,16,248,65,248,97,251,109,248,0,248,227,250,203,248,0,249,166,253,52,251,12,251,142,248,0,248,130,252,211,250,235,130,248,0,21,250,203,253,52,250,
+    170,251,207,248,0,249,69,252,243,252,243,249,199,248,0,248,0,251,174,249,166,248,0,251,239,249,134,248,0,250,73,249,199,248,0,249,231,249,199,142,248,0,1,24,0,0,0,129,
+    0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,
+    248,0,1,24,0,0,0,129,0,0,0,232,0,138,248,0,1,248,97,248,65,157,248,0,3,248,32,248,97,248,0,248,162,146,248,0,1,24,0,0,0,129,0,0,0,232,0,135,
+    248,0,4,248,195,248,97,248,0,251,174,251,12,147,248,0,1,252,178,248,227,135,248,0,3,249,134,252,178,248,0,254,56,146,248,0,1,24,0,0,0,129,0,0,0,232,0,135,
+    248,0,6,252,48,250,138,248,32,251,174,251,77,248,130,248,97,130,248,0,1,248,227,248,65,131,248,0,26,248,32,248,227,248,0,248,0,248,65,248,32,248,195,248,0,248,0,248,
+    195,248,0,248,32,248,0,248,195,248,97,248,0,248,0,248,32,248,227,249,166,252,178,248,0,254,56,248,0,248,0,248,97,248,195,142,248,0,1,24,0,0,0,129,0,0,0,232,
+    0,134,248,0,44,249,69,254,121,253,182,250,73,251,174,254,121,252,211,254,121,248,227,248,130,253,247,252,48,253,215,249,101,248,0,248,0,248,32,253,215,251,239,250,203,248,0,254,
+    121,253,52,253,117,251,239,248,0,253,117,248,162,251,207,253,215,252,178,254,154,248,227,248,162,254,121,252,113,254,24,252,178,248,0,254,56,248,0,250,105,253,117,252,146,252,113,141,
+    248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,43,252,16,250,40,248,0,251,174,251,142,248,0,251,142,250,203,251,77,252,243,250,8,251,142,252,81,248,0,248,0,248,
+    97,254,89,249,69,248,0,248,0,254,121,248,32,248,0,254,154,248,0,253,117,248,162,251,207,250,170,248,0,251,142,250,170,251,77,251,44,248,0,249,231,252,178,248,0,254,56,248,
+    0,254,56,250,73,250,8,254,186,141,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,12,251,239,250,40,248,0,251,174,251,12,248,0,251,44,250,235,251,239,253,117,251,
+    142,251,109,249,166,130,248,0,27,249,101,253,247,251,109,248,0,254,56,248,0,248,0,254,154,248,0,253,117,248,162,251,207,250,73,248,0,251,77,250,203,251,207,250,138,248,0,249,
+    134,252,178,248,0,254,56,248,0,254,186,251,142,251,109,251,44,141,248,0,1,24,0,0,0,129,0,0,0,232,0,135,248,0,51,251,207,250,203,248,65,251,174,251,12,248,0,251,
+    44,250,235,250,105,253,150,248,32,248,65,248,162,248,0,248,0,248,130,248,162,248,195,253,215,248,0,254,251,249,166,249,134,253,215,248,0,253,117,248,162,251,207,250,73,248,0,251,
+    77,250,203,250,138,252,178,248,0,252,16,252,178,248,0,254,56,248,0,253,85,249,199,248,0,248,227,248,0,249,231,249,4,248,97,250,138,248,0,249,166,249,69,133,248,0,1,24,
+    0,0,0,129,0,0,0,232,0,135,248,0,51,248,227,253,20,250,73,250,73,249,199,248,0,249,231,249,199,248,0,250,235,253,20,252,211,249,36,248,0,248,0,248,130,252,178,252,
+    211,249,101,248,0,254,89,252,16,252,243,249,36,248,0,251,77,248,97,250,73,249,101,248,0,250,8,249,166,248,0,252,16,253,52,250,170,250,235,248,0,251,174,248,0,248,162,252,
+    113,253,20,251,44,248,0,250,203,249,166,248,162,251,207,248,0,250,170,249,231,133,248,0,1,24,0,0,0,129,0,0,0,232,0,155,248,0,0,254,56,164,248,0,1,24,0,0,
+    0,129,0,0,0,232,0,155,248,0,0,249,166,164,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,
+    0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,
+    0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,
+    0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,
+    0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,
+    1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,232,0,193,248,0,1,24,0,0,0,129,
+    0,0,0,232,0,193,248,0,1,24,0,0,0,129,0,0,0,56,0,192,80,0,2,72,0,0,0,0,0,198,0,0,
+    // lube_on
+    82,76,68,0,47,0,0,0,0,0,3,0,0,0,30,0,0,0,51,0,0,0,70,0,0,0,87,0,0,0,105,0,0,0,121,0,0,0,146,0,0,0,171,0,0,0,202,0,
+    0,0,231,0,0,0,252,0,0,0,27,1,0,0,56,1,0,0,99,1,0,0,150,1,0,0,191,1,0,0,246,1,0,0,43,2,0,0,110,2,0,0,187,2,0,0,6,3,
+    0,0,75,3,0,0,154,3,0,0,254,3,0,0,77,4,0,0,164,4,0,0,241,4,0,0,64,5,0,0,127,5,0,0,190,5,0,0,239,5,0,0,30,6,0,0,71,6,
+    0,0,102,6,0,0,133,6,0,0,154,6,0,0,173,6,0,0,192,6,0,0,205,6,0,0,221,6,0,0,237,6,0,0,252,6,0,0,13,7,0,0,32,7,0,0,51,7,
+    0,0,195,0,0,135,0,0,0,0,128,131,9,32,0,17,128,152,9,32,0,17,160,146,9,32,0,0,128,135,0,0,133,0,0,1,17,128,27,32,179,35,224,2,35,96,17,224,
+    0,64,132,0,0,131,0,0,1,8,224,35,64,183,35,224,1,35,160,9,96,131,0,0,130,0,0,1,8,224,35,192,186,35,224,0,17,192,130,0,0,129,0,0,1,0,96,35,
+    160,188,35,224,2,9,0,0,0,0,0,129,0,0,0,26,160,189,35,224,2,35,64,0,0,0,0,1,0,0,8,192,143,35,224,3,26,192,26,160,26,160,35,128,171,35,224,1,
+    9,96,0,0,1,0,0,18,64,142,35,224,0,26,128,130,0,0,0,9,64,171,35,224,1,26,192,0,0,1,0,0,35,64,142,35,224,0,18,96,130,0,0,0,9,32,160,35,
+    224,0,35,64,137,35,224,1,35,192,0,32,1,0,0,35,128,142,35,224,0,26,192,130,9,32,0,17,224,157,35,224,0,35,192,141,35,224,0,0,64,1,0,0,35,128,175,35,
+    224,2,35,128,17,192,26,160,141,35,224,0,0,64,1,0,0,35,128,137,35,224,0,26,224,137,26,64,0,27,32,153,35,224,1,26,192,35,160,142,35,224,0,0,64,1,0,0,
+    35,128,136,35,224,0,9,64,139,0,0,0,27,32,148,35,224,129,35,192,146,35,224,0,0,64,1,0,0,35,128,135,35,224,0,9,96,140,0,0,0,17,224,146,35,224,3,35,
+    128,18,32,18,32,35,160,135,35,224,1,35,96,35,160,136,35,224,0,0,64,1,0,0,35,128,134,35,224,4,17,160,0,0,0,0,18,0,18,0,137,0,0,0,17,224,145,35,
+    224,2,35,160,18,64,35,160,132,35,224,2,27,64,18,64,26,192,140,35,224,0,0,64,1,0,0,35,128,133,35,224,5,18,0,0,0,0,32,26,128,35,224,35,160,137,0,0,
+    0,17,224,153,35,224,1,35,128,35,192,141,35,224,0,0,64,1,0,0,35,128,132,35,224,6,26,160,0,0,0,0,18,32,35,224,35,224,17,160,137,0,0,0,17,224,141,35,
+    224,1,26,128,18,32,131,35,224,3,35,128,18,32,17,192,35,192,145,35,224,0,0,64,1,0,0,35,128,132,35,224,5,0,96,0,0,9,96,35,224,35,224,18,64,138,0,0,
+    0,17,224,139,35,224,2,26,160,18,0,27,32,131,35,224,2,27,64,26,128,35,128,147,35,224,0,0,64,1,0,0,35,128,131,35,224,5,35,128,0,0,0,0,26,160,35,224,
+    18,96,139,0,0,0,17,224,137,35,224,6,26,224,18,32,35,64,35,224,35,96,18,96,27,32,137,35,224,5,35,64,26,160,27,32,35,224,35,224,35,96,136,35,224,0,0,64,
+    1,0,0,35,128,131,35,224,4,35,128,0,0,0,0,0,96,9,64,131,0,0,2,8,192,35,96,9,0,133,0,0,0,17,224,137,35,224,5,35,160,27,32,18,32,18,32,26,
+    192,35,192,131,35,224,3,35,128,27,0,26,96,26,192,130,35,224,1,27,0,35,128,140,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,134,0,0,5,26,224,26,160,
+    35,224,26,160,27,0,0,32,131,0,0,0,17,224,133,35,224,10,26,128,26,192,35,224,35,224,35,96,26,224,35,192,35,192,35,128,26,192,26,160,130,35,224,2,26,224,27,32,
+    35,160,146,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,133,0,0,1,0,64,35,96,130,35,224,1,35,160,0,192,131,0,0,0,17,224,131,35,224,12,26,160,0,
+    160,0,0,17,160,35,224,35,224,35,192,18,64,18,32,18,64,26,192,35,96,35,192,152,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,132,0,0,8,18,32,17,224,
+    0,0,18,32,35,224,18,64,0,32,9,96,26,128,130,0,0,8,17,224,35,224,35,224,26,224,8,160,0,32,0,0,0,0,17,160,130,35,224,133,43,224,130,35,224,131,43,224,
+    130,35,224,130,43,224,139,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,132,0,0,8,27,32,35,96,0,0,9,32,35,224,9,96,0,0,27,0,35,96,130,0,0,
+    8,17,224,35,224,35,192,17,128,0,32,0,32,0,0,0,0,9,96,130,35,224,132,26,64,0,26,128,130,35,224,3,26,192,26,64,26,64,26,128,130,35,224,6,26,224,26,64,
+    26,224,35,224,35,224,35,160,35,128,135,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,130,0,0,14,0,32,26,128,35,96,35,224,26,192,27,0,35,224,27,32,26,
+    192,35,224,35,128,18,96,0,0,0,0,17,224,130,35,224,11,35,128,17,224,0,32,0,0,17,128,35,224,35,224,35,192,26,64,26,96,27,0,35,128,154,35,224,0,0,64,1,
+    0,0,35,128,131,35,224,0,35,128,130,0,0,14,0,32,35,128,35,192,35,224,35,192,35,192,35,224,35,192,35,192,35,224,35,224,35,64,0,0,0,0,17,224,132,35,224,11,
+    35,128,17,192,26,96,35,224,35,224,35,128,35,160,35,160,27,32,26,160,18,64,26,128,130,35,224,1,35,128,35,192,147,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,
+    128,132,0,0,8,26,160,35,192,0,32,9,32,35,224,9,96,0,0,35,96,27,32,130,0,0,0,17,224,137,35,224,4,35,192,18,96,18,0,26,96,35,128,132,35,224,3,26,
+    224,18,96,18,32,26,192,130,35,224,0,35,192,141,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,132,0,0,8,26,192,26,96,0,0,9,160,35,224,17,192,0,0,
+    18,0,35,32,130,0,0,0,17,224,137,35,224,6,26,160,18,96,35,192,35,160,26,160,18,0,27,32,137,35,224,5,26,160,18,64,35,32,35,224,35,224,35,160,136,35,224,0,
+    0,64,1,0,0,35,128,131,35,224,0,35,128,133,0,0,1,0,32,26,224,130,35,224,1,27,64,0,96,131,0,0,0,17,224,138,35,224,2,35,128,17,192,26,192,132,35,224,
+    1,35,160,35,192,138,35,224,0,35,160,136,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,133,0,0,6,0,32,35,192,35,96,35,224,35,96,35,224,0,128,131,0,
+    0,0,17,224,140,35,224,2,26,224,18,0,26,192,130,35,224,3,35,96,18,64,18,32,26,160,146,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,134,0,0,4,0,
+    64,9,32,35,224,9,64,0,64,132,0,0,0,17,224,142,35,224,0,35,160,133,35,224,0,35,128,146,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,136,0,0,0,
+    0,64,134,0,0,0,17,224,145,35,224,1,35,160,26,224,133,35,224,2,26,224,18,32,26,192,140,35,224,0,0,64,1,0,0,35,128,131,35,224,0,35,128,144,0,0,0,17,
+    224,146,35,224,2,27,0,18,0,26,160,136,35,224,1,35,128,35,192,136,35,224,0,0,64,1,0,0,35,128,132,35,224,0,0,64,143,0,0,0,26,128,148,35,224,1,35,64,
+    35,160,146,35,224,0,0,64,1,0,0,35,128,132,35,224,1,26,160,0,128,141,0,96,0,17,128,153,35,224,0,35,192,143,35,224,0,0,64,1,0,0,35,128,175,35,224,2,
+    26,160,17,224,35,64,141,35,224,0,0,64,1,0,0,35,96,177,35,224,0,35,96,140,35,224,1,35,192,0,32,1,0,0,26,96,180,35,224,0,35,64,137,35,224,1,27,32,
+    0,0,1,0,0,9,64,191,35,224,1,17,192,0,0,129,0,0,0,35,96,189,35,224,2,35,160,0,32,0,0,129,0,0,0,9,96,189,35,224,2,17,128,0,0,0,0,130,
+    0,0,0,26,64,187,35,224,0,26,224,130,0,0,131,0,0,0,26,64,185,35,224,1,26,128,0,32,130,0,0,132,0,0,1,8,192,27,0,181,35,224,1,27,0,9,32,132,
+    0,0,134,0,0,1,0,160,17,224,177,26,160,1,17,224,0,160,134,0,0,195,0,0,
+    // lube_off
+    82,76,68,0,47,0,0,0,0,0,3,0,0,0,49,0,0,0,72,0,0,0,91,0,0,0,110,0,0,0,130,0,0,0,146,0,0,0,175,0,0,0,200,0,0,0,231,0,
+    0,0,6,1,0,0,29,1,0,0,64,1,0,0,99,1,0,0,146,1,0,0,201,1,0,0,2,2,0,0,61,2,0,0,126,2,0,0,197,2,0,0,22,3,0,0,101,3,
+    0,0,172,3,0,0,15,4,0,0,117,4,0,0,198,4,0,0,29,5,0,0,112,5,0,0,193,5,0,0,4,6,0,0,69,6,0,0,124,6,0,0,169,6,0,0,220,6,
+    0,0,3,7,0,0,38,7,0,0,61,7,0,0,82,7,0,0,101,7,0,0,114,7,0,0,130,7,0,0,146,7,0,0,161,7,0,0,180,7,0,0,203,7,0,0,226,7,
+    0,0,195,0,0,135,0,0,5,8,32,32,192,40,224,41,0,41,0,65,96,142,41,0,0,40,224,134,41,0,2,40,224,41,0,65,128,142,41,0,130,40,224,1,32,192,8,32,
+    135,0,0,133,0,0,2,49,32,155,97,228,226,177,237,35,2,229,2,171,194,81,192,133,0,0,131,0,0,1,24,160,163,162,183,237,35,1,204,98,57,64,131,0,0,130,0,0,
+    1,32,160,212,130,185,237,35,1,229,2,73,160,130,0,0,129,0,0,1,8,32,204,98,187,237,35,3,228,226,32,192,0,0,0,0,129,0,0,0,122,161,189,237,35,2,171,162,
+    0,0,0,0,2,0,0,16,96,228,226,141,237,35,4,220,194,147,33,139,1,139,1,196,66,171,237,35,1,49,32,0,0,1,0,0,106,65,142,237,35,0,98,33,130,0,0,0,
+    49,32,171,237,35,1,139,1,0,0,1,0,0,163,162,142,237,35,0,81,225,130,0,0,0,41,0,160,237,35,0,147,133,137,237,35,1,196,98,0,0,1,0,0,180,2,142,237,
+    35,0,98,65,130,16,128,0,65,96,157,237,35,0,212,196,140,237,35,1,220,226,0,0,1,0,0,188,2,175,237,35,2,188,67,57,98,106,131,140,237,35,1,229,2,0,0,1,
+    0,0,188,2,136,237,35,1,228,226,139,1,137,114,129,0,163,130,153,237,35,1,131,3,196,100,141,237,35,1,229,2,0,0,1,0,0,188,2,135,237,35,1,220,194,41,0,139,
+    0,0,0,155,98,148,237,35,1,212,164,212,195,145,237,35,1,229,2,0,0,1,0,0,188,2,134,237,35,1,228,226,49,0,140,0,0,0,98,33,146,237,35,3,196,67,90,2,
+    81,226,204,131,135,237,35,1,180,3,196,99,135,237,35,1,229,2,0,0,1,0,0,188,2,133,237,35,5,229,3,65,96,0,0,0,0,90,1,90,1,137,0,0,0,90,1,145,
+    237,35,2,196,99,98,34,204,131,132,237,35,2,171,227,90,2,106,132,139,237,35,1,229,2,0,0,1,0,0,188,2,133,237,35,5,81,193,0,0,0,0,114,97,237,35,196,66,
+    137,0,0,0,90,1,142,237,35,0,229,4,133,237,35,5,229,3,229,35,237,35,237,35,188,35,212,195,140,237,35,1,229,2,0,0,1,0,0,188,2,132,237,35,6,122,193,0,
+    0,0,0,90,1,237,35,237,35,57,64,137,0,0,0,90,1,140,237,35,2,220,227,106,99,57,98,131,237,35,3,180,4,82,2,41,2,204,163,144,237,35,1,229,2,0,0,1,
+    0,0,188,2,131,237,35,6,220,194,0,0,0,0,57,32,229,3,237,35,98,33,138,0,0,0,90,1,138,237,35,3,229,3,122,194,65,130,155,131,131,237,35,2,155,163,114,162,
+    188,35,137,237,35,0,229,3,135,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,5,188,34,0,0,0,0,130,225,237,35,90,1,139,0,0,0,90,1,137,237,35,6,147,
+    67,65,162,163,195,229,36,171,195,98,98,155,131,137,237,35,6,171,195,130,227,163,162,237,35,237,35,163,195,229,35,134,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,4,
+    188,34,0,0,0,0,8,64,41,0,131,0,0,2,24,160,163,130,16,96,133,0,0,0,90,1,137,237,35,5,196,100,163,163,90,2,73,227,131,3,204,132,131,237,35,3,188,35,
+    155,99,114,162,122,227,130,237,35,2,155,99,188,35,229,3,138,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,134,0,0,4,130,225,114,129,237,35,98,33,147,
+    33,132,0,0,0,90,1,132,237,35,17,220,227,122,194,131,3,237,35,237,35,180,3,139,67,220,228,212,164,180,3,139,35,122,195,237,35,237,35,229,35,139,35,163,163,196,99,145,
+    237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,134,0,0,0,179,226,130,237,35,1,188,34,16,96,131,0,0,0,90,1,130,237,35,13,220,227,122,227,16,96,
+    0,0,57,98,237,35,237,35,212,196,82,3,73,227,106,98,139,35,180,3,212,196,151,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,132,0,0,8,89,225,73,
+    161,0,0,81,225,237,35,73,160,0,0,57,64,106,97,130,0,0,8,90,1,237,35,237,35,139,35,16,97,0,32,0,0,0,0,49,34,130,237,35,0,204,132,132,204,164,130,237,
+    35,0,212,196,130,204,164,130,237,35,6,212,196,204,164,212,195,237,35,237,35,229,3,229,3,134,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,132,0,0,8,
+    155,66,171,194,0,0,41,0,237,35,24,160,0,0,147,33,180,2,130,0,0,11,90,1,237,35,220,195,65,130,0,0,0,32,0,0,0,0,32,225,237,35,237,35,220,227,133,114,
+    162,130,237,35,3,131,3,114,162,114,162,122,194,130,237,35,6,139,67,114,162,139,67,237,35,237,35,196,131,196,67,134,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,
+    188,34,131,0,0,13,106,97,171,194,237,35,130,225,147,65,237,35,139,33,130,193,220,226,180,2,98,33,0,0,0,0,90,1,130,237,35,12,188,68,81,226,0,0,0,0,49,66,
+    237,35,237,35,212,196,82,2,114,162,147,99,188,35,221,4,152,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,131,0,0,13,171,194,212,162,237,35,204,98,204,
+    130,237,35,204,130,196,98,237,35,220,194,155,98,0,0,0,0,90,1,132,237,35,11,196,67,73,194,98,66,237,35,237,35,204,99,188,68,196,100,163,163,131,3,90,34,98,99,130,
+    237,35,1,180,3,212,164,146,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,132,0,0,8,122,193,204,98,0,0,41,0,237,35,24,160,0,0,171,194,155,98,
+    130,0,0,0,90,1,137,237,35,4,204,164,114,162,65,162,106,130,180,3,131,237,35,4,229,35,139,35,106,98,73,227,122,228,130,237,35,1,204,131,229,36,139,237,35,1,229,2,
+    0,0,1,0,0,188,2,131,237,35,0,188,34,132,0,0,8,122,193,106,65,0,0,57,64,237,35,49,0,0,0,81,193,155,97,130,0,0,0,90,1,137,237,35,6,114,163,98,
+    66,212,163,196,100,122,194,73,195,155,131,137,237,35,5,122,194,82,2,155,131,237,35,237,35,196,99,135,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,134,0,
+    0,5,130,225,229,3,237,35,237,35,155,66,8,32,131,0,0,0,90,1,138,237,35,3,188,67,49,34,122,195,229,35,131,237,35,1,196,100,204,164,138,237,35,0,188,67,135,237,
+    35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,134,0,0,5,204,98,171,194,237,35,163,130,212,162,8,32,131,0,0,0,90,1,140,237,35,2,139,67,57,98,130,
+    227,130,237,35,4,188,35,90,34,65,163,122,194,220,227,144,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,135,0,0,2,40,224,237,35,24,128,133,0,0,0,
+    90,1,142,237,35,0,188,68,133,237,35,4,188,35,220,227,237,35,237,35,221,4,141,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,144,0,0,0,90,1,145,
+    237,35,2,204,131,139,34,229,3,132,237,35,2,139,35,65,163,122,195,139,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,188,34,144,0,0,0,90,1,146,237,35,3,
+    147,66,57,130,122,194,228,227,132,237,35,4,220,228,237,35,237,35,196,67,204,163,135,237,35,1,229,2,0,0,1,0,0,188,2,131,237,35,0,212,162,144,0,0,0,122,161,148,
+    237,35,1,171,227,196,99,135,237,35,129,220,227,135,237,35,1,229,2,0,0,1,0,0,188,2,132,237,35,1,122,161,0,32,141,0,0,1,49,0,220,194,152,237,35,0,204,131,
+    142,237,35,1,229,2,0,0,1,0,0,180,2,175,237,35,2,122,195,65,163,171,227,140,237,35,1,228,226,0,0,1,0,0,171,194,176,237,35,1,220,227,180,3,140,237,35,1,
+    212,130,0,0,1,0,0,114,129,180,237,35,0,147,133,137,237,35,1,155,97,0,0,1,0,0,40,224,191,237,35,1,73,160,0,0,129,0,0,0,171,194,189,237,35,2,196,66,
+    0,0,0,0,129,0,0,0,49,0,189,237,35,2,57,64,0,0,0,0,130,0,0,0,98,65,187,237,35,0,139,1,130,0,0,131,0,0,1,98,33,229,3,183,237,35,1,229,
+    3,114,129,131,0,0,132,0,0,2,24,128,147,65,229,3,179,237,35,2,229,3,147,65,32,192,132,0,0,134,0,0,2,16,64,81,225,130,193,175,139,1,2,130,193,81,225,16,
+    64,134,0,0,195,0,0,
+    0,
+    // backlight_on
+    82,76,44,0,47,0,0,0,0,0,3,0,0,0,30,0,0,0,53,0,0,0,72,0,0,0,91,0,0,0,111,0,0,0,127,0,0,0,145,0,0,0,159,0,0,0,173,0,
+    0,0,187,0,0,0,201,0,0,0,215,0,0,0,229,0,0,0,243,0,0,0,1,1,0,0,15,1,0,0,37,1,0,0,59,1,0,0,81,1,0,0,115,1,0,0,145,1,
+    0,0,173,1,0,0,205,1,0,0,237,1,0,0,11,2,0,0,39,2,0,0,83,2,0,0,131,2,0,0,157,2,0,0,183,2,0,0,221,2,0,0,235,2,0,0,249,2,
+    0,0,7,3,0,0,21,3,0,0,35,3,0,0,49,3,0,0,63,3,0,0,81,3,0,0,97,3,0,0,117,3,0,0,136,3,0,0,155,3,0,0,174,3,0,0,193,3,
+    0,0,171,0,0,136,0,0,1,0,32,9,0,130,9,32,1,9,96,9,64,145,9,32,1,8,224,0,32,135,0,0,134,0,0,2,9,0,26,160,35,192,152,35,224,2,35,192,
+    26,224,9,32,133,0,0,132,0,0,1,0,32,26,128,158,35,224,1,26,160,0,32,131,0,0,131,0,0,1,0,32,26,224,160,35,224,1,35,96,0,128,130,0,0,130,0,0,
+    1,0,32,35,64,162,35,224,3,35,96,0,32,0,0,0,0,130,0,0,0,18,0,164,35,224,2,18,0,0,0,0,0,129,0,0,1,0,32,35,160,164,35,224,2,35,160,0,
+    32,0,0,129,0,0,0,9,128,166,35,224,1,9,64,0,0,129,0,0,0,26,128,166,35,224,1,18,64,0,0,129,0,0,0,26,160,166,35,224,1,26,160,0,0,129,0,0,
+    0,26,160,166,35,224,1,26,160,0,0,129,0,0,0,26,160,166,35,224,1,26,160,0,0,129,0,0,0,26,160,166,35,224,1,26,160,0,0,129,0,0,0,26,160,166,35,224,
+    1,26,160,0,0,129,0,0,0,26,160,166,35,224,1,26,160,0,0,129,0,0,0,26,160,166,35,224,1,26,160,0,0,129,0,0,0,26,160,145,35,224,1,35,192,26,192,146,
+    35,224,1,26,160,0,0,129,0,0,0,26,160,145,35,224,1,35,128,9,96,146,35,224,1,26,160,0,0,129,0,0,0,26,160,145,35,224,1,35,128,9,96,146,35,224,1,26,
+    160,0,0,129,0,0,0,26,160,138,35,224,0,26,160,134,35,224,0,35,64,133,35,224,1,35,160,26,224,138,35,224,1,26,160,0,0,129,0,0,0,26,160,138,35,224,1,17,
+    224,26,64,140,35,224,1,17,128,26,224,138,35,224,1,26,160,0,0,129,0,0,0,26,160,139,35,224,0,18,32,139,35,224,1,27,32,26,160,139,35,224,1,26,160,0,0,129,
+    0,0,0,26,160,143,35,224,6,35,64,18,32,9,64,9,32,9,128,26,96,35,192,143,35,224,1,26,160,0,0,129,0,0,0,26,160,141,35,224,1,35,128,9,32,133,0,0,
+    2,0,32,18,0,35,192,141,35,224,1,26,160,0,0,129,0,0,0,26,160,140,35,224,1,26,224,0,32,136,0,0,1,8,224,35,192,140,35,224,1,26,160,0,0,129,0,0,
+    0,26,160,139,35,224,1,35,128,0,32,138,0,0,0,9,96,140,35,224,1,26,160,0,0,129,0,0,0,26,160,133,35,224,2,35,192,27,32,35,192,130,35,224,0,17,128,140,
+    0,0,0,27,0,130,35,224,1,35,192,35,96,134,35,224,1,26,160,0,0,129,0,0,0,26,160,133,35,224,6,35,192,18,32,9,96,35,96,35,224,35,160,0,32,140,0,0,
+    5,9,32,35,224,35,224,26,192,9,128,26,96,134,35,224,1,26,160,0,0,129,0,0,0,26,160,138,35,224,0,26,96,142,0,0,0,35,160,138,35,224,1,26,160,0,0,129,
+    0,0,0,26,160,138,35,224,0,17,224,142,0,0,0,26,160,138,35,224,1,26,160,0,0,129,0,0,0,26,160,131,35,224,0,9,128,133,0,160,0,0,96,142,0,64,0,0,
+    128,132,0,160,0,9,128,132,35,224,1,26,160,0,0,129,0,0,0,26,160,166,35,224,1,26,160,0,0,129,0,0,0,26,160,166,35,224,1,26,160,0,0,129,0,0,0,26,
+    160,166,35,224,1,26,160,0,0,129,0,0,0,26,160,166,35,224,1,26,160,0,0,129,0,0,0,26,160,166,35,224,1,26,160,0,0,129,0,0,0,26,96,166,35,224,1,18,
+    64,0,0,129,0,0,0,9,128,166,35,224,1,9,64,0,0,129,0,0,1,0,64,35,192,164,35,224,2,35,160,0,32,0,0,130,0,0,0,26,128,164,35,224,2,18,0,0,
+    0,0,0,130,0,0,1,0,128,35,160,162,35,224,3,35,96,0,32,0,0,0,0,131,0,0,1,0,128,35,96,160,35,224,1,35,160,8,224,130,0,0,132,0,0,1,0,96,
+    35,32,158,35,224,1,26,192,0,96,131,0,0,134,0,0,1,17,192,35,96,154,35,224,1,35,64,17,128,133,0,0,136,0,0,1,0,160,17,160,150,17,224,1,9,128,0,160,
+    135,0,0,171,0,0,
+    0,0,
+    // backlight_off
+    82,76,44,0,47,0,0,0,0,0,3,0,0,0,34,0,0,0,57,0,0,0,76,0,0,0,93,0,0,0,108,0,0,0,124,0,0,0,140,0,0,0,154,0,0,0,168,0,
+    0,0,182,0,0,0,196,0,0,0,210,0,0,0,224,0,0,0,238,0,0,0,252,0,0,0,10,1,0,0,32,1,0,0,54,1,0,0,76,1,0,0,114,1,0,0,146,1,
+    0,0,178,1,0,0,210,1,0,0,240,1,0,0,12,2,0,0,38,2,0,0,82,2,0,0,130,2,0,0,156,2,0,0,182,2,0,0,208,2,0,0,222,2,0,0,236,2,
+    0,0,250,2,0,0,8,3,0,0,22,3,0,0,36,3,0,0,50,3,0,0,66,3,0,0,82,3,0,0,99,3,0,0,118,3,0,0,137,3,0,0,160,3,0,0,198,3,
+    0,0,171,0,0,137,0,0,5,24,160,40,224,41,0,41,0,57,64,49,32,142,41,0,3,40,224,41,0,32,192,16,128,136,0,0,134,0,0,2,32,192,122,193,204,98,152,237,
+    35,2,212,162,139,33,32,192,133,0,0,133,0,0,1,114,129,229,3,156,237,35,1,229,3,122,193,132,0,0,132,0,0,0,147,33,160,237,35,1,179,226,16,96,130,0,0,131,
+    0,0,0,163,162,162,237,35,0,179,226,130,0,0,130,0,0,0,90,1,164,237,35,2,90,1,0,0,0,0,130,0,0,0,196,66,164,237,35,2,196,66,0,0,0,0,129,0,
+    0,0,57,64,166,237,35,1,40,224,0,0,129,0,0,0,122,161,166,237,35,1,106,65,0,0,129,0,0,0,139,1,166,237,35,1,130,193,0,0,129,0,0,0,139,1,166,237,
+    35,1,139,1,0,0,129,0,0,0,139,1,166,237,35,1,139,1,0,0,129,0,0,0,139,1,166,237,35,1,139,1,0,0,129,0,0,0,139,1,166,237,35,1,139,1,0,0,
+    129,0,0,0,139,1,166,237,35,1,139,1,0,0,129,0,0,0,139,1,166,237,35,1,139,1,0,0,129,0,0,0,139,1,145,237,35,1,212,194,114,161,146,237,35,1,139,1,
+    0,0,129,0,0,0,139,1,145,237,35,1,180,2,40,224,146,237,35,1,139,1,0,0,129,0,0,0,139,1,145,237,35,1,188,2,40,224,146,237,35,1,139,1,0,0,129,0,
+    0,0,139,1,137,237,35,1,229,2,114,97,133,237,35,1,229,3,155,130,133,237,35,1,204,98,130,193,138,237,35,1,139,1,0,0,129,0,0,0,139,1,138,237,35,1,81,193,
+    106,65,139,237,35,2,228,226,57,32,139,33,138,237,35,1,139,1,0,0,129,0,0,0,139,1,138,237,35,2,229,2,81,192,228,226,138,237,35,1,155,97,122,193,139,237,35,1,
+    139,1,0,0,129,0,0,0,139,1,143,237,35,6,163,162,90,1,40,224,32,192,57,64,114,129,204,98,143,237,35,1,139,1,0,0,129,0,0,0,139,1,141,237,35,1,188,34,
+    40,224,134,0,0,1,81,225,212,162,141,237,35,1,139,1,0,0,129,0,0,0,139,1,140,237,35,0,139,33,137,0,0,1,32,160,204,130,140,237,35,1,139,1,0,0,129,0,
+    0,0,139,1,139,237,35,0,188,34,139,0,0,0,49,32,140,237,35,1,139,1,0,0,129,0,0,0,139,1,133,237,35,2,220,194,155,130,212,130,130,237,35,0,57,64,140,0,
+    0,0,147,65,130,237,35,1,204,98,163,162,134,237,35,1,139,1,0,0,129,0,0,0,139,1,133,237,35,5,212,162,98,33,40,224,171,162,237,35,196,66,141,0,0,6,32,192,
+    229,3,237,35,122,161,49,0,106,97,229,3,133,237,35,1,139,1,0,0,129,0,0,0,139,1,138,237,35,0,114,129,142,0,0,0,180,2,138,237,35,1,139,1,0,0,129,0,
+    0,0,139,1,138,237,35,0,81,192,142,0,0,0,122,161,138,237,35,1,139,1,0,0,129,0,0,0,139,1,131,237,35,0,41,0,155,0,0,0,41,0,132,237,35,1,139,1,
+    0,0,129,0,0,0,139,1,166,237,35,1,139,1,0,0,129,0,0,0,139,1,166,237,35,1,139,1,0,0,129,0,0,0,139,1,166,237,35,1,139,1,0,0,129,0,0,0,
+    139,1,166,237,35,1,139,1,0,0,129,0,0,0,130,225,166,237,35,1,130,225,0,0,129,0,0,0,114,129,166,237,35,1,106,65,0,0,129,0,0,0,57,64,166,237,35,1,
+    49,0,0,0,130,0,0,0,212,162,164,237,35,2,196,66,0,0,0,0,130,0,0,0,114,129,164,237,35,2,90,1,0,0,0,0,130,0,0,1,8,64,196,98,162,237,35,0,
+    180,2,130,0,0,131,0,0,1,16,64,180,2,160,237,35,1,204,98,24,160,130,0,0,132,0,0,1,8,64,163,130,158,237,35,1,138,225,8,64,131,0,0,134,0,0,2,73,
+    160,171,194,229,3,152,237,35,2,229,2,163,162,57,64,133,0,0,136,0,0,2,16,64,73,128,89,225,140,90,1,129,89,225,8,90,1,89,225,90,1,89,225,90,1,90,1,81,
+    225,57,96,8,64,135,0,0,171,0,0,
+    0,
+    // light_on
+    82,76,44,0,47,0,0,0,0,0,3,0,0,0,6,0,0,0,35,0,0,0,54,0,0,0,73,0,0,0,92,0,0,0,115,0,0,0,139,0,0,0,163,0,0,0,201,0,
+    0,0,232,0,0,0,5,1,0,0,36,1,0,0,65,1,0,0,92,1,0,0,119,1,0,0,162,1,0,0,207,1,0,0,232,1,0,0,1,2,0,0,26,2,0,0,53,2,
+    0,0,78,2,0,0,105,2,0,0,132,2,0,0,159,2,0,0,186,2,0,0,211,2,0,0,236,2,0,0,5,3,0,0,30,3,0,0,55,3,0,0,68,3,0,0,93,3,
+    0,0,118,3,0,0,143,3,0,0,156,3,0,0,181,3,0,0,213,3,0,0,241,3,0,0,1,4,0,0,16,4,0,0,35,4,0,0,54,4,0,0,75,4,0,0,98,4,
+    0,0,171,0,0,171,0,0,134,0,0,2,0,96,17,160,26,224,131,35,128,0,35,192,146,35,128,2,26,224,18,0,0,160,134,0,0,133,0,0,1,17,224,35,192,156,35,224,
+    1,26,160,0,96,132,0,0,131,0,0,1,0,32,26,224,159,35,224,1,35,96,8,192,131,0,0,130,0,0,1,0,96,35,64,161,35,224,1,35,160,8,224,130,0,0,130,0,
+    0,0,26,160,144,35,224,1,35,160,35,96,144,35,224,0,35,96,130,0,0,129,0,0,0,8,192,145,35,224,1,26,160,18,96,145,35,224,2,17,128,0,0,0,0,129,0,0,
+    0,26,128,145,35,224,1,26,160,18,96,145,35,224,2,27,0,0,0,0,0,129,0,0,0,35,160,137,35,224,1,35,192,35,0,133,35,224,1,35,128,35,64,133,35,224,1,35,
+    128,35,96,138,35,224,1,0,64,0,0,1,0,0,0,64,139,35,224,1,9,96,26,224,139,35,224,2,35,192,9,32,35,128,138,35,224,1,9,32,0,0,1,0,0,0,64,139,
+    35,224,1,35,192,26,64,139,35,224,1,26,128,35,32,139,35,224,1,9,32,0,0,1,0,0,0,64,144,35,224,6,27,0,17,224,9,32,9,32,17,160,26,192,35,192,143,35,
+    224,1,9,32,0,0,1,0,0,0,64,142,35,224,1,35,160,8,224,133,0,0,1,0,128,35,0,142,35,224,1,9,32,0,0,1,0,0,0,64,141,35,224,1,26,224,0,64,
+    136,0,0,0,26,64,141,35,224,1,9,32,0,0,1,0,0,0,64,140,35,224,1,35,32,0,32,138,0,0,0,26,128,140,35,224,1,9,32,0,0,1,0,0,0,64,134,35,
+    224,1,35,160,35,64,131,35,224,0,8,192,139,0,0,1,0,32,35,160,130,35,224,1,35,160,35,96,134,35,224,1,9,32,0,0,1,0,0,0,64,134,35,224,5,35,128,17,
+    224,9,128,35,192,35,224,27,0,141,0,0,5,17,224,35,224,35,224,26,64,17,128,26,192,134,35,224,1,9,32,0,0,1,0,0,0,64,139,35,224,0,17,160,141,0,0,0,
+    0,128,139,35,224,1,9,32,0,0,1,0,0,0,64,139,35,224,0,9,32,142,0,0,0,35,128,138,35,224,1,9,32,0,0,1,0,0,0,64,139,35,224,0,9,32,142,0,
+    0,0,35,96,138,35,224,1,9,32,0,0,1,0,0,0,64,139,35,224,0,9,32,141,0,0,1,0,32,35,192,138,35,224,1,9,32,0,0,1,0,0,0,64,139,35,224,0,
+    18,32,141,0,0,0,8,192,139,35,224,1,9,32,0,0,1,0,0,0,64,139,35,224,1,35,160,0,32,140,0,0,0,26,64,139,35,224,1,9,32,0,0,1,0,0,0,64,
+    140,35,224,0,18,0,139,0,0,1,8,160,35,192,139,35,224,1,9,32,0,0,1,0,0,0,64,141,35,224,0,9,0,137,0,0,1,0,32,35,96,140,35,224,1,9,32,0,
+    0,1,0,0,0,64,141,35,224,1,35,160,0,64,136,0,0,0,26,128,141,35,224,1,9,32,0,0,1,0,0,0,64,142,35,224,0,26,192,135,0,0,0,9,0,142,35,224,
+    1,9,32,0,0,1,0,0,0,64,143,35,224,0,8,192,134,0,0,0,27,32,142,35,224,1,9,32,0,0,1,0,0,0,64,143,35,224,0,17,192,133,0,0,0,0,64,143,
+    35,224,1,9,32,0,0,1,0,0,0,64,143,35,224,0,17,224,133,0,0,0,0,128,143,35,224,1,9,32,0,0,1,0,0,0,64,143,35,224,0,27,0,133,17,224,0,26,
+    128,143,35,224,1,9,32,0,0,1,0,0,0,64,167,35,224,1,9,32,0,0,1,0,0,0,64,143,35,224,0,35,96,133,18,96,0,27,32,143,35,224,1,9,32,0,0,1,
+    0,0,0,64,143,35,224,0,26,160,133,0,0,0,17,224,143,35,224,1,9,32,0,0,1,0,0,0,64,143,35,224,0,27,0,133,9,32,0,18,96,143,35,224,1,9,32,0,
+    0,1,0,0,0,64,167,35,224,1,9,32,0,0,1,0,0,0,64,144,35,224,0,35,128,131,26,160,0,35,64,144,35,224,1,9,0,0,0,129,0,0,0,35,96,143,35,224,
+    5,35,160,0,96,0,0,0,0,0,32,35,32,143,35,224,2,35,192,0,32,0,0,129,0,0,0,18,64,144,35,224,3,35,160,26,160,26,160,35,96,144,35,224,2,26,224,0,
+    0,0,0,129,0,0,0,8,224,165,35,224,2,9,64,0,0,0,0,130,0,0,0,26,224,163,35,224,0,35,32,130,0,0,130,0,0,1,0,96,35,64,161,35,224,1,35,160,
+    0,128,130,0,0,131,0,0,1,0,32,26,224,159,35,224,1,35,32,0,128,131,0,0,133,0,0,1,17,224,35,192,155,35,224,2,35,192,18,32,0,32,132,0,0,134,0,0,
+    2,0,96,17,160,26,192,151,35,128,2,26,192,17,160,0,96,134,0,0,171,0,0,
+    0,
+    // light_off
+    82,76,44,0,47,0,0,0,0,0,3,0,0,0,6,0,0,0,39,0,0,0,60,0,0,0,77,0,0,0,96,0,0,0,119,0,0,0,145,0,0,0,169,0,0,0,209,0,
+    0,0,243,0,0,0,17,1,0,0,51,1,0,0,78,1,0,0,104,1,0,0,130,1,0,0,178,1,0,0,224,1,0,0,249,1,0,0,19,2,0,0,45,2,0,0,71,2,
+    0,0,99,2,0,0,125,2,0,0,153,2,0,0,181,2,0,0,207,2,0,0,235,2,0,0,7,3,0,0,33,3,0,0,59,3,0,0,85,3,0,0,99,3,0,0,131,3,
+    0,0,157,3,0,0,180,3,0,0,194,3,0,0,220,3,0,0,250,3,0,0,22,4,0,0,40,4,0,0,55,4,0,0,74,4,0,0,91,4,0,0,110,4,0,0,150,4,
+    0,0,171,0,0,171,0,0,134,0,0,3,8,32,65,96,139,1,179,226,130,188,2,0,204,130,145,188,2,3,179,226,139,33,89,225,16,96,134,0,0,133,0,0,1,81,225,212,
+    162,155,237,35,2,228,226,122,161,8,32,132,0,0,132,0,0,0,147,33,159,237,35,1,180,2,24,128,131,0,0,130,0,0,1,8,64,171,162,161,237,35,1,204,130,32,160,130,
+    0,0,130,0,0,0,122,193,144,237,35,1,196,98,171,162,144,237,35,0,171,194,130,0,0,129,0,0,1,16,96,228,226,144,237,35,1,139,1,98,65,145,237,35,2,57,64,0,
+    0,0,0,129,0,0,0,114,129,145,237,35,1,139,1,98,65,145,237,35,2,147,65,0,0,0,0,129,0,0,0,196,66,137,237,35,1,212,130,155,97,133,237,35,1,196,66,163,
+    162,133,237,35,1,188,34,179,226,137,237,35,2,220,194,0,0,0,0,129,0,0,0,229,2,137,237,35,2,220,226,49,0,147,65,139,237,35,2,212,130,32,192,188,34,138,237,35,
+    1,32,192,0,0,129,0,0,0,229,2,138,237,35,1,212,130,89,225,139,237,35,1,114,129,163,162,139,237,35,1,32,192,0,0,129,0,0,0,237,2,142,237,35,7,228,226,147,
+    65,81,193,32,192,32,192,65,128,130,225,212,162,143,237,35,1,40,224,0,0,129,0,0,142,237,35,1,188,34,24,128,133,0,0,1,8,64,147,65,142,237,35,1,40,224,0,0,
+    129,0,0,0,237,34,140,237,35,0,147,33,137,0,0,0,98,33,141,237,35,1,40,224,0,0,129,0,0,0,237,34,139,237,35,0,163,130,139,0,0,0,114,129,140,237,35,1,
+    40,224,0,0,129,0,0,0,237,34,133,237,35,6,196,98,163,162,220,194,237,35,237,35,228,226,16,96,140,0,0,5,196,66,237,35,237,35,229,3,196,66,179,226,134,237,35,1,
+    40,224,0,0,129,0,0,0,237,34,133,237,35,5,196,66,81,192,32,192,204,130,237,35,147,33,141,0,0,5,81,192,237,35,237,35,81,192,57,64,130,225,134,237,35,1,40,224,
+    0,0,129,0,0,139,237,35,0,65,128,141,0,0,1,8,64,229,2,138,237,35,1,40,224,0,0,129,0,0,0,237,2,138,237,35,0,32,192,142,0,0,0,179,226,138,237,35,
+    1,40,224,0,0,129,0,0,0,237,34,138,237,35,0,32,192,142,0,0,0,163,130,138,237,35,1,40,224,0,0,129,0,0,0,237,2,138,237,35,0,40,224,142,0,0,0,196,
+    66,138,237,35,1,40,224,0,0,129,0,0,0,237,2,138,237,35,0,90,1,141,0,0,1,16,96,229,3,138,237,35,1,40,224,0,0,129,0,0,0,237,2,138,237,35,0,188,
+    34,141,0,0,0,106,65,139,237,35,1,40,224,0,0,129,0,0,0,237,34,139,237,35,0,81,193,139,0,0,1,24,128,212,162,139,237,35,1,40,224,0,0,129,0,0,0,237,
+    34,139,237,35,1,228,226,32,192,138,0,0,0,179,226,140,237,35,1,40,224,0,0,129,0,0,0,237,34,140,237,35,0,196,98,137,0,0,0,114,129,141,237,35,1,40,224,0,
+    0,129,0,0,0,237,34,141,237,35,0,130,193,135,0,0,1,32,192,228,226,141,237,35,1,40,224,0,0,129,0,0,0,237,34,141,237,35,1,229,3,16,96,134,0,0,0,147,
+    65,142,237,35,1,40,224,0,0,129,0,0,0,237,34,142,237,35,0,73,160,134,0,0,0,220,226,142,237,35,1,40,224,0,0,129,0,0,0,237,34,142,237,35,0,81,192,133,
+    0,0,0,8,64,143,237,35,1,40,224,0,0,129,0,0,0,237,2,142,237,35,0,155,98,133,81,192,0,106,97,143,237,35,1,40,224,0,0,129,0,0,0,237,2,166,237,35,
+    1,40,224,0,0,129,0,0,0,237,34,142,237,35,3,171,194,98,33,98,33,98,65,130,98,33,0,147,65,143,237,35,1,40,224,0,0,129,0,0,0,237,34,142,237,35,0,130,
+    193,133,0,0,0,81,192,143,237,35,1,40,224,0,0,129,0,0,143,237,35,0,147,65,133,32,192,0,98,65,143,237,35,1,40,224,0,0,129,0,0,0,229,2,166,237,35,1,
+    40,224,0,0,129,0,0,0,220,226,143,237,35,0,196,66,131,130,193,0,171,194,144,237,35,1,24,160,0,0,129,0,0,0,171,226,143,237,35,1,196,66,8,64,130,0,0,0,
+    163,130,143,237,35,2,212,130,0,0,0,0,129,0,0,0,106,65,144,237,35,3,196,66,122,193,122,193,179,226,144,237,35,2,139,33,0,0,0,0,129,0,0,1,24,128,229,3,
+    164,237,35,2,41,0,0,0,0,0,130,0,0,0,139,1,163,237,35,0,155,130,130,0,0,130,0,0,1,8,64,171,162,161,237,35,1,196,98,16,96,130,0,0,132,0,0,0,
+    147,33,159,237,35,1,163,130,8,64,131,0,0,133,0,0,1,81,193,212,162,155,237,35,1,212,162,90,1,133,0,0,134,0,0,4,8,32,57,96,130,225,179,226,180,2,139,188,
+    2,131,180,2,1,188,2,180,2,130,188,2,3,179,226,130,225,65,96,8,32,134,0,0,171,0,0,
+    0,
+    // digit_0
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,12,0,0,0,39,0,0,0,70,0,0,0,85,0,0,0,100,0,0,0,119,0,0,0,142,0,
+    0,0,167,0,0,0,202,0,0,0,233,0,0,0,14,1,0,0,47,1,0,0,80,1,0,0,113,1,0,0,146,1,0,0,179,1,0,0,212,1,0,0,245,1,0,0,22,2,
+    0,0,55,2,0,0,88,2,0,0,121,2,0,0,154,2,0,0,187,2,0,0,220,2,0,0,253,2,0,0,32,3,0,0,67,3,0,0,100,3,0,0,133,3,0,0,168,3,
+    0,0,199,3,0,0,232,3,0,0,9,4,0,0,44,4,0,0,79,4,0,0,118,4,0,0,153,4,0,0,190,4,0,0,225,4,0,0,4,5,0,0,39,5,0,0,72,5,
+    0,0,107,5,0,0,142,5,0,0,175,5,0,0,208,5,0,0,243,5,0,0,22,6,0,0,53,6,0,0,88,6,0,0,121,6,0,0,154,6,0,0,189,6,0,0,226,6,
+    0,0,4,7,0,0,33,7,0,0,62,7,0,0,92,7,0,0,117,7,0,0,146,7,0,0,171,7,0,0,196,7,0,0,199,7,0,0,202,7,0,0,205,7,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,138,0,0,9,32,160,114,64,163,33,195,193,220,33,220,33,195,193,163,33,106,32,16,96,137,0,0,137,0,0,11,106,32,212,33,220,1,220,
+    1,212,1,220,1,220,1,212,1,212,1,220,1,220,33,97,224,136,0,0,136,0,0,0,138,193,139,220,1,0,146,224,135,0,0,135,0,0,0,106,32,141,220,1,0,114,64,134,
+    0,0,134,0,0,1,16,96,212,33,141,220,1,1,212,1,16,64,133,0,0,134,0,0,1,106,32,211,225,134,220,1,129,212,1,133,220,1,0,122,96,133,0,0,134,0,0,0,
+    171,65,134,220,1,2,220,65,220,33,211,225,133,220,1,0,203,225,133,0,0,133,0,0,1,8,32,220,33,132,220,1,5,203,225,81,160,8,32,16,96,114,64,220,33,132,220,1,
+    1,220,65,24,128,132,0,0,133,0,0,0,49,0,132,220,1,1,212,1,89,224,131,0,0,0,122,128,132,220,1,1,211,225,57,32,132,0,0,133,0,0,1,73,128,211,225,131,
+    220,1,1,220,33,32,160,131,0,0,2,16,96,220,65,212,1,130,220,1,1,211,225,81,160,132,0,0,133,0,0,1,81,160,211,225,131,220,1,0,220,97,133,0,0,1,220,65,
+    212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,81,192,211,225,131,220,1,0,228,97,133,0,0,1,228,65,212,1,130,220,1,1,211,225,81,160,132,0,0,133,0,
+    0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,
+    1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,129,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,
+    0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,
+    133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,
+    160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,
+    0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,
+    211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,192,132,0,0,133,0,0,1,89,192,211,225,
+    131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,
+    220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,2,89,
+    192,211,225,212,1,130,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,6,
+    220,65,212,1,220,1,220,1,212,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,
+    0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,129,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,2,89,192,211,225,212,1,130,220,1,
+    0,228,129,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,129,133,0,0,0,220,65,131,220,1,1,211,225,
+    89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,
+    1,0,228,129,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,6,220,65,212,1,220,1,220,
+    1,212,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,6,220,65,212,1,212,1,220,1,212,1,212,1,89,160,132,0,0,133,0,0,
+    6,89,192,211,225,212,1,212,1,220,1,220,1,228,97,133,0,0,6,220,65,212,1,220,1,220,1,212,1,211,225,89,160,132,0,0,133,0,0,2,89,192,211,225,212,1,130,220,
+    1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,192,132,0,0,133,0,0,6,89,224,211,225,212,1,212,1,220,1,220,1,228,129,133,0,0,1,220,65,212,
+    1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,2,89,192,211,225,212,1,130,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,
+    0,0,2,89,192,211,225,212,1,130,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,2,89,192,211,225,212,1,130,220,1,0,
+    228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,
+    225,89,160,132,0,0,133,0,0,2,89,192,211,225,212,1,130,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,2,89,192,211,
+    225,219,225,130,220,1,0,228,97,133,0,0,1,220,97,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,
+    212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,
+    0,2,89,192,211,225,212,1,130,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,2,89,192,211,225,212,1,130,220,1,0,228,
+    97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,228,97,133,0,0,0,220,65,131,220,1,1,211,225,89,160,
+    132,0,0,133,0,0,2,89,192,211,225,212,1,130,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,81,192,211,225,131,220,
+    1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,1,211,225,89,160,132,0,0,133,0,0,1,73,128,211,225,131,220,1,0,228,97,133,0,0,1,220,65,212,1,130,220,1,
+    1,211,225,89,160,132,0,0,133,0,0,0,57,64,132,220,1,1,220,33,32,192,131,0,0,2,40,192,220,33,212,1,130,220,1,1,211,225,81,160,132,0,0,133,0,0,2,16,
+    64,220,65,212,1,130,220,1,1,212,1,89,224,131,0,0,1,122,128,212,1,131,220,1,1,211,225,49,32,132,0,0,134,0,0,0,203,225,132,220,1,4,195,161,24,128,0,0,
+    0,0,57,64,130,212,1,130,220,1,1,220,65,16,96,132,0,0,134,0,0,0,154,225,134,220,1,4,163,33,171,65,220,33,212,1,212,1,131,220,1,0,187,161,133,0,0,134,
+    0,0,0,73,128,133,220,1,0,212,1,132,220,1,4,212,1,220,1,212,1,212,1,89,224,133,0,0,135,0,0,2,195,193,220,1,212,1,133,220,1,129,212,1,4,220,1,212,
+    1,220,1,212,1,195,193,134,0,0,135,0,0,1,40,224,211,225,136,220,1,4,212,1,220,1,212,1,220,1,65,64,134,0,0,136,0,0,1,73,128,220,33,130,220,1,1,212,
+    1,220,1,131,212,1,2,220,1,212,1,81,160,135,0,0,137,0,0,3,57,64,203,225,212,1,220,1,132,212,1,2,220,1,203,225,57,32,136,0,0,138,0,0,8,8,32,81,
+    160,146,192,179,97,187,161,187,161,171,97,138,160,73,128,138,0,0,158,0,0,158,0,0,158,0,0,158,0,0,
+    0,0,
+    // digit_1
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,12,0,0,0,27,0,0,0,48,0,0,0,63,0,0,0,80,0,0,0,97,0,0,0,114,0,
+    0,0,137,0,0,0,156,0,0,0,171,0,0,0,186,0,0,0,209,0,0,0,242,0,0,0,17,1,0,0,38,1,0,0,59,1,0,0,78,1,0,0,95,1,0,0,110,1,
+    0,0,129,1,0,0,150,1,0,0,169,1,0,0,188,1,0,0,207,1,0,0,226,1,0,0,245,1,0,0,10,2,0,0,29,2,0,0,46,2,0,0,65,2,0,0,82,2,
+    0,0,101,2,0,0,124,2,0,0,143,2,0,0,164,2,0,0,185,2,0,0,204,2,0,0,221,2,0,0,238,2,0,0,1,3,0,0,20,3,0,0,39,3,0,0,58,3,
+    0,0,77,3,0,0,96,3,0,0,117,3,0,0,136,3,0,0,157,3,0,0,174,3,0,0,193,3,0,0,212,3,0,0,231,3,0,0,250,3,0,0,11,4,0,0,28,4,
+    0,0,47,4,0,0,66,4,0,0,85,4,0,0,102,4,0,0,119,4,0,0,140,4,0,0,163,4,0,0,178,4,0,0,181,4,0,0,184,4,0,0,187,4,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,140,0,0,0,114,64,133,138,160,0,73,128,137,0,0,140,0,0,3,187,129,220,1,220,1,212,1,130,220,1,0,114,96,137,0,0,140,0,
+    0,0,203,193,133,220,1,0,114,96,137,0,0,139,0,0,1,24,128,220,33,133,220,1,0,114,96,137,0,0,139,0,0,1,130,160,212,1,133,220,1,0,114,96,137,0,0,138,
+    0,0,1,98,0,220,33,134,220,1,0,114,96,137,0,0,134,0,0,3,32,160,57,64,106,32,187,161,135,220,1,1,219,225,114,96,137,0,0,134,0,0,2,138,160,220,1,211,
+    225,137,220,1,0,114,96,137,0,0,134,0,0,0,130,128,139,220,1,0,114,96,137,0,0,134,0,0,0,130,128,139,220,1,0,114,96,137,0,0,134,0,0,4,130,128,212,1,
+    220,1,212,1,212,1,135,220,1,0,114,96,137,0,0,134,0,0,9,138,128,220,33,220,33,220,65,228,97,212,1,179,129,220,1,212,1,212,1,130,220,1,0,114,96,137,0,0,
+    134,0,0,8,24,128,40,224,32,128,16,64,0,32,0,0,0,0,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,3,8,0,220,97,212,1,212,1,130,220,1,0,114,
+    96,137,0,0,140,0,0,3,8,0,220,65,212,1,212,1,130,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,141,0,0,1,
+    220,65,212,1,131,220,1,0,114,96,137,0,0,141,0,0,0,220,65,132,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,
+    0,0,2,8,32,220,65,212,1,130,220,1,1,219,225,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,
+    1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,97,212,1,131,220,1,0,114,96,137,0,0,140,0,0,1,8,32,220,97,131,220,1,1,219,225,114,96,137,0,0,
+    140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,130,220,1,1,219,225,114,96,137,0,0,140,0,0,1,8,32,220,65,
+    131,220,1,1,219,225,114,96,137,0,0,141,0,0,1,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,
+    0,0,1,8,32,220,65,132,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,7,8,32,220,65,220,1,220,1,212,
+    1,220,1,220,1,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,130,220,1,1,219,225,114,96,137,
+    0,0,140,0,0,2,8,32,220,65,212,1,130,220,1,1,219,225,114,96,137,0,0,140,0,0,1,8,32,220,65,131,220,1,1,219,225,114,96,137,0,0,140,0,0,1,8,32,
+    220,65,132,220,1,0,114,96,137,0,0,140,0,0,1,8,32,220,65,132,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,
+    0,0,2,8,32,220,97,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,0,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,
+    220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,
+    0,2,8,32,220,65,212,1,130,220,1,1,219,225,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,
+    130,220,1,1,219,225,114,96,137,0,0,140,0,0,1,8,32,220,65,132,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,
+    0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,1,8,32,220,65,131,220,1,1,219,225,114,96,137,0,0,140,0,0,2,8,32,220,97,212,1,131,
+    220,1,0,114,96,137,0,0,140,0,0,1,8,32,220,97,132,220,1,0,114,96,137,0,0,140,0,0,1,8,32,220,97,132,220,1,0,114,96,137,0,0,140,0,0,2,8,32,
+    220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,137,0,0,140,0,0,2,8,32,220,65,212,1,131,220,1,0,114,96,
+    137,0,0,140,0,0,1,8,32,220,65,132,220,1,0,114,96,137,0,0,140,0,0,1,8,32,220,65,132,220,1,0,114,96,137,0,0,140,0,0,3,8,32,220,97,212,1,212,
+    1,130,220,1,0,114,96,137,0,0,140,0,0,7,8,32,220,65,220,1,212,1,220,1,220,1,219,225,114,96,137,0,0,141,0,0,0,130,160,132,122,96,0,65,96,137,0,0,
+    158,0,0,158,0,0,158,0,0,158,0,0,
+    // digit_2
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,12,0,0,0,39,0,0,0,62,0,0,0,85,0,0,0,106,0,0,0,123,0,0,0,148,0,
+    0,0,179,0,0,0,210,0,0,0,239,0,0,0,18,1,0,0,49,1,0,0,80,1,0,0,111,1,0,0,142,1,0,0,173,1,0,0,204,1,0,0,235,1,0,0,12,2,
+    0,0,41,2,0,0,74,2,0,0,93,2,0,0,112,2,0,0,129,2,0,0,144,2,0,0,161,2,0,0,178,2,0,0,195,2,0,0,210,2,0,0,225,2,0,0,240,2,
+    0,0,255,2,0,0,16,3,0,0,35,3,0,0,58,3,0,0,79,3,0,0,98,3,0,0,119,3,0,0,136,3,0,0,154,3,0,0,175,3,0,0,194,3,0,0,213,3,
+    0,0,234,3,0,0,253,3,0,0,18,4,0,0,39,4,0,0,56,4,0,0,75,4,0,0,92,4,0,0,107,4,0,0,126,4,0,0,143,4,0,0,158,4,0,0,173,4,
+    0,0,202,4,0,0,235,4,0,0,252,4,0,0,11,5,0,0,28,5,0,0,51,5,0,0,78,5,0,0,99,5,0,0,102,5,0,0,105,5,0,0,108,5,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,138,0,0,9,8,32,89,192,155,1,195,161,220,33,220,33,203,225,179,97,122,96,49,0,137,0,0,137,0,0,2,49,0,195,193,211,225,134,
+    212,1,2,220,1,155,32,8,32,135,0,0,136,0,0,2,65,96,212,1,219,225,136,220,1,2,212,1,195,161,24,128,134,0,0,135,0,0,2,16,96,212,1,211,225,138,220,1,
+    1,219,225,163,65,134,0,0,135,0,0,1,130,160,211,225,141,220,1,0,65,96,133,0,0,134,0,0,2,16,96,220,33,212,1,132,220,1,130,212,1,133,220,1,0,179,129,133,
+    0,0,134,0,0,1,81,160,211,225,133,220,1,3,228,65,228,97,220,1,212,1,132,220,1,1,220,33,32,160,132,0,0,134,0,0,0,130,128,133,220,1,4,114,64,8,32,0,
+    0,81,160,211,225,132,220,1,1,212,1,89,192,132,0,0,134,0,0,0,163,1,132,220,1,0,171,65,131,0,0,1,97,224,211,225,132,220,1,0,130,128,132,0,0,134,0,0,
+    0,179,97,131,220,1,1,219,225,114,32,131,0,0,2,8,32,212,1,212,1,130,220,1,1,212,1,146,192,132,0,0,134,0,0,0,179,129,131,220,1,1,212,1,97,224,132,0,
+    0,1,179,97,212,1,131,220,1,0,155,0,132,0,0,134,0,0,0,187,161,132,220,1,0,97,224,132,0,0,1,179,97,212,1,130,220,1,1,212,1,155,1,132,0,0,134,0,
+    0,0,203,225,131,220,1,1,212,1,97,224,132,0,0,0,179,129,131,220,1,1,212,1,155,1,132,0,0,134,0,0,0,220,33,131,220,1,1,212,1,97,224,132,0,0,0,179,
+    129,131,220,1,1,212,1,154,225,132,0,0,134,0,0,0,220,33,131,220,1,1,211,225,97,224,132,0,0,0,179,129,131,220,1,1,212,1,155,1,132,0,0,134,0,0,0,220,
+    33,131,220,1,1,211,225,97,224,132,0,0,0,187,129,131,220,1,1,212,1,146,192,132,0,0,134,0,0,1,220,33,212,1,130,220,1,1,212,1,97,224,132,0,0,0,187,129,
+    132,220,1,0,138,192,132,0,0,134,0,0,6,220,33,212,1,220,1,219,225,220,1,211,225,97,224,132,0,0,0,195,193,132,220,1,0,138,192,132,0,0,134,0,0,0,228,33,
+    131,220,1,1,219,225,97,224,132,0,0,0,203,225,132,220,1,0,138,160,132,0,0,134,0,0,6,130,128,130,96,130,96,130,128,130,128,130,96,57,32,132,0,0,0,220,33,132,
+    220,1,0,114,64,132,0,0,145,0,0,1,24,128,220,33,131,220,1,1,211,225,89,192,132,0,0,145,0,0,1,81,160,211,225,131,220,1,1,211,225,65,64,132,0,0,145,0,
+    0,0,130,128,132,220,1,1,220,65,24,96,132,0,0,145,0,0,0,195,193,132,220,1,0,195,193,133,0,0,144,0,0,1,24,128,220,33,132,220,1,0,130,128,133,0,0,144,
+    0,0,1,81,160,211,225,132,220,1,0,65,64,133,0,0,144,0,0,1,146,225,212,1,131,220,1,0,203,225,134,0,0,144,0,0,0,212,1,132,220,1,0,130,160,134,0,0,
+    143,0,0,0,89,192,133,220,1,0,57,32,134,0,0,143,0,0,0,187,129,132,220,1,0,195,193,135,0,0,142,0,0,0,49,0,133,220,1,0,89,192,135,0,0,142,0,0,
+    1,138,192,212,1,131,220,1,0,203,225,136,0,0,141,0,0,2,8,32,212,1,212,1,131,220,1,0,130,128,136,0,0,141,0,0,7,114,64,212,1,220,1,212,1,220,1,220,
+    1,220,33,40,192,136,0,0,140,0,0,2,8,32,212,1,212,1,130,220,1,1,212,1,171,65,137,0,0,140,0,0,1,97,224,212,1,131,220,1,1,220,33,65,64,137,0,0,
+    140,0,0,6,187,161,212,1,220,1,212,1,220,1,220,1,179,97,138,0,0,139,0,0,0,73,128,132,220,1,1,212,1,89,224,138,0,0,139,0,0,0,195,193,131,220,1,129,
+    212,1,0,8,64,138,0,0,138,0,0,2,65,64,220,1,212,1,130,220,1,1,212,1,138,160,139,0,0,138,0,0,0,155,1,131,220,1,2,212,1,220,1,24,128,139,0,0,
+    137,0,0,2,24,128,220,33,212,1,131,220,1,0,155,1,140,0,0,137,0,0,1,138,160,211,225,130,220,1,2,212,1,220,1,81,160,140,0,0,136,0,0,2,16,64,220,33,
+    212,1,130,220,1,129,212,1,141,0,0,136,0,0,2,97,224,211,225,212,1,130,220,1,1,211,225,122,96,141,0,0,136,0,0,0,163,65,130,220,1,3,212,1,220,1,220,33,
+    24,96,141,0,0,135,0,0,1,16,64,220,33,132,220,1,0,179,97,142,0,0,135,0,0,1,97,224,212,1,131,220,1,1,211,225,114,32,142,0,0,135,0,0,0,163,65,132,
+    220,1,1,220,33,40,192,142,0,0,135,0,0,0,220,65,132,220,1,0,195,193,143,0,0,134,0,0,1,49,32,212,1,131,220,1,1,219,225,122,96,143,0,0,134,0,0,1,
+    89,224,212,1,132,220,1,0,49,0,143,0,0,134,0,0,0,130,128,132,220,1,0,220,33,144,0,0,134,0,0,0,146,225,132,220,1,0,187,161,144,0,0,134,0,0,1,179,
+    97,212,1,130,220,1,2,212,1,195,161,97,224,136,98,0,1,97,224,65,96,132,0,0,134,0,0,1,187,161,212,1,135,220,1,8,212,1,211,225,212,1,220,1,212,1,220,1,
+    220,1,219,225,146,192,132,0,0,134,0,0,129,212,1,142,220,1,1,212,1,146,224,132,0,0,134,0,0,0,220,33,144,220,1,0,146,224,132,0,0,134,0,0,0,228,65,143,
+    220,1,1,211,225,146,224,132,0,0,134,0,0,0,228,65,130,212,1,130,220,1,137,212,1,1,211,225,146,224,132,0,0,134,0,0,1,228,65,212,1,131,220,1,135,212,1,129,
+    220,1,2,212,1,211,225,146,192,132,0,0,134,0,0,0,90,0,131,89,224,0,90,0,139,89,224,0,65,96,132,0,0,158,0,0,158,0,0,158,0,0,158,0,0,
+    0,0,0,
+    // digit_3
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,18,0,0,0,45,0,0,0,78,0,0,0,105,0,0,0,132,0,0,0,165,0,0,0,200,0,
+    0,0,237,0,0,0,22,1,0,0,58,1,0,0,93,1,0,0,126,1,0,0,160,1,0,0,197,1,0,0,234,1,0,0,8,2,0,0,42,2,0,0,75,2,0,0,112,2,
+    0,0,153,2,0,0,183,2,0,0,204,2,0,0,221,2,0,0,238,2,0,0,255,2,0,0,16,3,0,0,35,3,0,0,62,3,0,0,91,3,0,0,111,3,0,0,136,3,
+    0,0,158,3,0,0,179,3,0,0,207,3,0,0,232,3,0,0,253,3,0,0,16,4,0,0,39,4,0,0,60,4,0,0,79,4,0,0,98,4,0,0,115,4,0,0,132,4,
+    0,0,165,4,0,0,202,4,0,0,239,4,0,0,22,5,0,0,57,5,0,0,92,5,0,0,127,5,0,0,160,5,0,0,195,5,0,0,226,5,0,0,5,6,0,0,42,6,
+    0,0,85,6,0,0,115,6,0,0,141,6,0,0,177,6,0,0,202,6,0,0,230,6,0,0,0,7,0,0,25,7,0,0,28,7,0,0,31,7,0,0,34,7,0,0,158,0,
+    0,158,0,0,158,0,0,142,0,0,0,8,32,142,0,0,138,0,0,9,40,192,122,128,187,129,220,33,220,65,220,65,220,33,179,129,130,128,57,32,137,0,0,137,0,0,12,122,
+    96,220,33,220,1,212,1,212,1,220,1,220,1,212,1,212,1,220,1,220,1,155,32,8,32,135,0,0,136,0,0,2,146,224,220,1,212,1,131,220,1,0,212,1,132,220,1,1,
+    187,161,16,96,134,0,0,135,0,0,0,114,96,131,212,1,129,220,1,0,212,1,132,220,1,129,212,1,0,138,192,134,0,0,134,0,0,8,24,128,220,33,220,1,212,1,220,1,
+    212,1,212,1,220,1,212,1,134,220,1,1,220,33,16,96,133,0,0,134,0,0,5,114,64,212,1,220,1,220,1,212,1,220,1,130,212,1,129,211,225,131,220,1,2,212,1,211,
+    225,114,64,133,0,0,134,0,0,4,187,129,212,1,220,1,212,1,212,1,130,220,1,2,203,225,203,193,220,33,131,220,1,2,212,1,220,1,187,129,133,0,0,133,0,0,3,24,
+    96,220,33,220,1,220,1,130,212,1,7,195,193,57,32,0,0,0,0,49,0,203,225,212,1,220,1,130,212,1,0,220,65,133,0,0,133,0,0,0,65,96,130,220,1,129,212,1,
+    1,220,1,73,128,131,0,0,1,98,0,211,225,131,220,1,1,220,33,32,192,132,0,0,133,0,0,7,98,0,211,225,220,1,220,1,212,1,212,1,220,65,8,32,131,0,0,0,
+    57,32,133,220,1,0,49,0,132,0,0,133,0,0,6,114,32,211,225,220,1,212,1,220,1,212,1,212,1,132,0,0,0,57,32,133,220,1,0,49,0,132,0,0,133,0,0,1,
+    114,32,211,225,130,220,1,1,212,1,203,225,132,0,0,0,57,32,131,220,1,129,212,1,0,49,0,132,0,0,133,0,0,6,114,32,211,225,220,1,220,1,212,1,212,1,203,225,
+    132,0,0,1,57,32,220,33,131,220,1,1,212,1,49,0,132,0,0,133,0,0,6,114,32,211,225,220,1,220,1,212,1,212,1,203,225,132,0,0,2,57,32,220,1,220,1,131,
+    212,1,0,49,0,132,0,0,133,0,0,1,114,32,211,225,132,212,1,132,0,0,1,57,32,220,33,131,220,1,1,211,225,49,0,132,0,0,133,0,0,1,114,32,211,225,132,212,
+    1,132,0,0,7,57,0,220,1,212,1,220,1,220,1,212,1,212,1,49,0,132,0,0,133,0,0,1,114,32,211,225,130,220,1,129,212,1,132,0,0,2,57,0,220,1,212,1,
+    131,220,1,0,49,0,132,0,0,133,0,0,1,114,32,211,225,131,220,1,0,212,1,132,0,0,7,57,0,220,1,212,1,220,1,220,1,212,1,220,1,49,0,132,0,0,133,0,
+    0,6,114,0,211,225,212,1,212,1,220,1,220,1,220,33,132,0,0,7,57,0,220,33,212,1,220,1,220,1,212,1,220,1,49,0,132,0,0,133,0,0,0,40,224,133,89,224,
+    132,0,0,1,57,0,220,33,130,220,1,2,212,1,220,1,49,0,132,0,0,145,0,0,1,57,0,220,33,130,220,1,2,212,1,220,1,49,0,132,0,0,145,0,0,1,49,0,
+    220,33,132,220,1,0,48,224,132,0,0,145,0,0,1,49,0,220,33,132,220,1,0,40,192,132,0,0,145,0,0,0,57,64,131,220,1,1,212,1,220,65,133,0,0,145,0,0,
+    1,106,32,211,225,131,220,1,0,195,193,133,0,0,145,0,0,1,187,161,212,1,130,220,1,1,212,1,138,160,133,0,0,140,0,0,6,40,224,73,128,81,160,97,224,179,97,212,
+    1,212,1,131,220,1,0,40,224,133,0,0,140,0,0,10,122,64,211,225,211,225,212,1,220,1,220,1,212,1,220,1,212,1,211,225,146,225,134,0,0,140,0,0,0,122,64,130,
+    212,1,132,220,1,1,155,33,8,64,134,0,0,140,0,0,8,122,64,220,1,220,1,212,1,220,1,212,1,212,1,203,193,65,64,136,0,0,140,0,0,0,122,64,131,220,1,129,
+    212,1,2,220,1,203,225,106,32,135,0,0,140,0,0,0,122,96,133,220,1,3,212,1,211,225,211,225,130,128,134,0,0,140,0,0,1,122,64,220,1,130,212,1,129,220,1,4,
+    212,1,220,1,212,1,220,33,49,0,133,0,0,140,0,0,4,49,32,89,224,97,224,130,129,203,225,132,220,1,1,212,1,171,97,133,0,0,144,0,0,2,32,128,212,1,212,1,
+    131,220,1,1,220,33,24,96,132,0,0,145,0,0,1,89,224,212,1,131,220,1,1,211,225,65,96,132,0,0,145,0,0,7,8,32,220,65,220,1,220,1,212,1,220,1,211,225,
+    97,224,132,0,0,146,0,0,6,220,33,212,1,220,1,220,1,212,1,211,225,97,224,132,0,0,146,0,0,0,220,33,130,220,1,2,212,1,211,225,97,224,132,0,0,146,0,0,
+    1,220,33,220,1,130,212,1,1,211,225,97,224,132,0,0,146,0,0,0,220,33,131,212,1,1,211,225,97,224,132,0,0,146,0,0,0,220,33,131,212,1,1,211,225,97,224,132,
+    0,0,133,0,0,0,73,96,132,138,192,0,130,160,133,0,0,6,220,33,212,1,212,1,220,1,220,1,211,225,97,224,132,0,0,133,0,0,6,114,32,211,225,220,1,219,225,220,
+    1,211,225,203,225,133,0,0,0,220,33,130,212,1,2,220,1,211,225,97,224,132,0,0,133,0,0,2,114,64,211,225,220,1,130,212,1,0,203,225,133,0,0,6,220,33,212,1,
+    220,1,220,1,212,1,211,225,97,224,132,0,0,133,0,0,6,114,64,211,225,220,1,220,1,212,1,212,1,203,225,133,0,0,6,220,33,212,1,212,1,220,1,212,1,211,225,97,
+    224,132,0,0,133,0,0,6,114,64,211,225,212,1,220,1,212,1,212,1,203,225,133,0,0,0,220,33,131,220,1,1,211,225,97,224,132,0,0,133,0,0,1,114,64,211,225,130,
+    220,1,1,212,1,203,225,133,0,0,1,220,33,212,1,130,220,1,1,211,225,97,224,132,0,0,133,0,0,6,114,64,211,225,212,1,220,1,212,1,212,1,203,225,133,0,0,0,
+    220,33,131,220,1,1,211,225,97,224,132,0,0,133,0,0,1,114,64,211,225,130,220,1,1,212,1,203,193,133,0,0,0,220,33,131,220,1,1,211,225,97,224,132,0,0,133,0,
+    0,6,114,64,211,225,212,1,220,1,220,1,212,1,203,225,133,0,0,0,220,33,131,220,1,1,211,225,97,224,132,0,0,133,0,0,1,114,64,211,225,130,220,1,129,212,1,133,
+    0,0,0,220,33,131,220,1,1,212,1,97,224,132,0,0,133,0,0,1,114,32,211,225,130,220,1,1,212,1,220,65,132,0,0,1,16,64,220,65,131,220,1,1,212,1,89,192,
+    132,0,0,133,0,0,1,89,192,211,225,130,220,1,2,212,1,220,1,40,192,131,0,0,1,81,160,211,225,131,220,1,1,211,225,57,32,132,0,0,133,0,0,7,40,224,220,1,
+    212,1,212,1,220,1,212,1,211,225,146,224,130,0,0,2,8,32,187,129,219,225,130,220,1,2,212,1,220,65,16,64,132,0,0,134,0,0,133,212,1,6,220,1,179,97,114,64,
+    122,96,195,193,212,1,212,1,131,220,1,0,187,129,133,0,0,134,0,0,1,146,192,211,225,132,212,1,129,211,225,129,212,1,133,220,1,0,89,192,133,0,0,134,0,0,2,57,
+    64,212,1,211,225,130,212,1,4,220,1,212,1,220,1,212,1,212,1,130,220,1,129,212,1,0,195,193,134,0,0,135,0,0,3,155,0,211,225,220,1,212,1,136,220,1,2,212,
+    1,220,33,73,96,134,0,0,135,0,0,4,8,32,187,161,211,225,212,1,212,1,133,220,1,129,212,1,1,220,33,89,224,135,0,0,136,0,0,3,24,128,179,161,220,1,212,1,
+    131,220,1,130,212,1,1,220,33,97,224,136,0,0,138,0,0,2,81,160,155,33,203,225,130,220,65,3,212,1,171,97,114,64,24,160,137,0,0,158,0,0,158,0,0,158,0,0,
+    158,0,0,
+    0,
+    // digit_4
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,12,0,0,0,27,0,0,0,52,0,0,0,72,0,0,0,91,0,0,0,116,0,0,0,141,0,
+    0,0,162,0,0,0,185,0,0,0,203,0,0,0,225,0,0,0,252,0,0,0,25,1,0,0,52,1,0,0,77,1,0,0,104,1,0,0,129,1,0,0,154,1,0,0,185,1,
+    0,0,212,1,0,0,245,1,0,0,20,2,0,0,51,2,0,0,80,2,0,0,109,2,0,0,140,2,0,0,169,2,0,0,200,2,0,0,237,2,0,0,16,3,0,0,47,3,
+    0,0,78,3,0,0,109,3,0,0,146,3,0,0,177,3,0,0,208,3,0,0,241,3,0,0,18,4,0,0,51,4,0,0,82,4,0,0,115,4,0,0,146,4,0,0,187,4,
+    0,0,225,4,0,0,252,4,0,0,35,5,0,0,62,5,0,0,92,5,0,0,127,5,0,0,151,5,0,0,166,5,0,0,183,5,0,0,198,5,0,0,213,5,0,0,228,5,
+    0,0,245,5,0,0,4,6,0,0,19,6,0,0,34,6,0,0,49,6,0,0,64,6,0,0,79,6,0,0,96,6,0,0,99,6,0,0,102,6,0,0,105,6,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,141,0,0,0,106,0,134,155,1,0,81,192,135,0,0,141,0,0,8,195,161,211,225,211,225,212,1,212,1,211,225,212,1,212,1,114,96,135,
+    0,0,140,0,0,1,24,96,220,33,130,212,1,131,220,1,0,114,64,135,0,0,140,0,0,2,81,128,211,225,212,1,133,220,1,0,114,64,135,0,0,140,0,0,5,122,64,212,
+    1,212,1,220,1,212,1,212,1,130,220,1,0,114,64,135,0,0,140,0,0,5,163,33,211,225,212,1,220,1,212,1,212,1,130,220,1,0,114,64,135,0,0,140,0,0,3,212,
+    1,211,225,220,1,212,1,132,220,1,0,114,64,135,0,0,139,0,0,4,49,0,220,1,212,1,220,1,212,1,132,220,1,0,114,64,135,0,0,139,0,0,0,114,64,132,212,1,
+    131,220,1,0,114,64,135,0,0,139,0,0,2,171,65,212,1,220,1,130,212,1,131,220,1,0,114,64,135,0,0,138,0,0,6,8,32,220,65,212,1,212,1,220,1,220,1,212,
+    1,131,220,1,0,114,64,135,0,0,138,0,0,7,49,0,212,1,212,1,220,1,212,1,211,225,212,1,212,1,130,220,1,0,114,64,135,0,0,138,0,0,6,97,224,211,225,212,
+    1,220,1,220,1,171,97,212,1,131,220,1,0,114,64,135,0,0,138,0,0,5,146,193,212,1,220,1,212,1,220,33,122,96,132,220,1,0,114,64,135,0,0,138,0,0,6,195,
+    161,212,1,220,1,220,1,203,225,114,96,212,1,131,220,1,0,114,64,135,0,0,137,0,0,1,24,96,220,33,130,220,1,1,171,65,114,96,132,220,1,0,114,64,135,0,0,137,
+    0,0,1,89,192,211,225,130,220,1,1,130,128,122,96,132,220,1,0,114,96,135,0,0,137,0,0,6,146,225,212,1,220,1,220,1,211,225,89,224,122,128,130,220,1,2,212,1,
+    220,1,114,64,135,0,0,137,0,0,6,203,225,212,1,220,1,220,1,212,1,57,32,122,128,132,220,1,0,114,64,135,0,0,136,0,0,8,32,160,220,33,212,1,220,1,212,1,
+    220,65,16,64,122,96,212,1,130,220,1,1,212,1,114,64,135,0,0,136,0,0,8,81,160,211,225,220,1,220,1,212,1,195,193,0,0,122,128,212,1,131,220,1,0,114,64,135,
+    0,0,136,0,0,8,130,129,220,1,220,1,212,1,220,1,146,192,0,0,122,128,212,1,131,220,1,0,114,64,135,0,0,136,0,0,0,179,97,130,220,1,4,211,225,97,224,0,
+    0,122,128,212,1,131,220,1,0,114,64,135,0,0,135,0,0,1,8,32,220,33,130,220,1,3,220,33,40,224,0,0,122,128,132,220,1,0,114,64,135,0,0,135,0,0,1,65,
+    96,212,1,130,220,1,4,220,33,0,0,0,0,122,128,212,1,131,220,1,0,114,64,135,0,0,135,0,0,1,122,96,211,225,130,220,1,3,179,129,0,0,0,0,122,128,132,220,
+    1,0,114,64,135,0,0,135,0,0,1,187,129,212,1,130,220,1,4,138,192,0,0,0,0,122,96,212,1,131,220,1,0,114,64,135,0,0,134,0,0,11,16,64,220,65,220,1,
+    220,1,212,1,212,1,106,0,0,0,0,0,122,128,212,1,212,1,130,220,1,0,114,64,135,0,0,134,0,0,1,65,96,211,225,130,220,1,6,211,225,65,64,0,0,0,0,122,
+    128,211,225,212,1,130,220,1,0,114,64,135,0,0,134,0,0,0,114,64,131,220,1,5,220,65,16,96,0,0,0,0,122,128,212,1,131,220,1,0,114,64,135,0,0,134,0,0,
+    1,163,33,212,1,130,220,1,0,203,225,130,0,0,1,122,128,212,1,131,220,1,0,114,64,135,0,0,134,0,0,129,212,1,130,220,1,0,154,225,130,0,0,2,122,128,212,1,
+    212,1,130,220,1,0,114,64,135,0,0,133,0,0,6,32,192,220,33,212,1,220,1,212,1,211,225,114,64,130,0,0,2,122,128,212,1,212,1,130,220,1,0,114,64,135,0,0,
+    133,0,0,1,106,0,211,225,131,220,1,0,57,32,130,0,0,1,122,128,212,1,131,220,1,0,114,64,135,0,0,133,0,0,5,163,32,212,1,212,1,220,1,220,1,220,65,131,
+    0,0,0,122,128,132,220,1,0,114,64,135,0,0,133,0,0,5,220,33,220,1,212,1,220,1,212,1,187,161,131,0,0,1,122,96,212,1,131,220,1,0,114,64,135,0,0,132,
+    0,0,0,49,0,132,220,1,0,146,224,131,0,0,6,122,128,220,1,220,1,212,1,220,1,220,1,114,64,135,0,0,132,0,0,6,98,0,211,225,220,1,212,1,220,1,220,1,
+    114,32,131,0,0,0,122,128,132,220,1,0,114,64,135,0,0,132,0,0,1,146,225,212,1,130,220,1,1,211,225,73,96,131,0,0,0,122,128,132,220,1,0,114,64,135,0,0,
+    132,0,0,0,187,161,130,212,1,2,220,1,220,33,32,160,131,0,0,1,122,128,212,1,131,220,1,0,114,64,135,0,0,132,0,0,5,220,65,212,1,212,1,220,1,220,1,212,
+    33,132,0,0,0,122,128,132,220,1,0,114,64,135,0,0,132,0,0,1,220,65,212,1,130,220,1,6,195,193,122,128,114,96,114,128,114,96,114,128,179,129,132,220,1,3,171,96,
+    114,96,114,96,97,224,132,0,0,132,0,0,7,220,65,220,1,212,1,212,1,220,1,220,1,211,225,212,1,131,220,1,0,212,1,132,220,1,129,211,225,0,179,97,132,0,0,132,
+    0,0,3,220,65,212,1,220,1,212,1,134,220,1,131,212,1,132,220,1,0,179,97,132,0,0,132,0,0,6,220,65,212,1,212,1,220,1,212,1,220,1,212,1,132,220,1,3,
+    212,1,220,1,220,1,212,1,131,220,1,0,179,97,132,0,0,132,0,0,1,220,65,212,1,137,220,1,2,212,1,220,1,212,1,132,220,1,0,179,97,132,0,0,132,0,0,2,
+    220,65,212,1,212,1,135,220,1,130,212,1,1,220,1,212,1,131,220,1,0,179,97,132,0,0,132,0,0,0,220,65,134,211,225,2,212,1,211,225,211,225,131,220,1,5,212,1,
+    220,1,212,1,211,225,211,225,179,97,132,0,0,132,0,0,138,65,128,0,187,129,132,220,1,3,146,225,65,128,65,128,49,32,132,0,0,143,0,0,0,171,65,132,220,1,0,114,
+    96,135,0,0,143,0,0,1,171,65,212,1,131,220,1,0,114,96,135,0,0,143,0,0,0,171,65,132,220,1,0,114,96,135,0,0,143,0,0,0,171,65,132,220,1,0,114,96,
+    135,0,0,143,0,0,0,171,65,132,220,1,0,114,96,135,0,0,143,0,0,1,171,65,212,1,131,220,1,0,114,96,135,0,0,143,0,0,0,171,65,132,220,1,0,114,96,135,
+    0,0,143,0,0,0,171,65,132,220,1,0,114,64,135,0,0,143,0,0,0,171,65,132,220,1,0,114,64,135,0,0,143,0,0,0,171,65,132,220,1,0,114,64,135,0,0,143,
+    0,0,0,171,65,132,220,1,0,114,64,135,0,0,143,0,0,0,171,65,132,220,1,0,114,96,135,0,0,143,0,0,0,98,0,131,122,96,1,122,128,65,96,135,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,
+    0,0,
+    // digit_5
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,12,0,0,0,27,0,0,0,44,0,0,0,77,0,0,0,95,0,0,0,127,0,0,0,163,0,
+    0,0,184,0,0,0,214,0,0,0,233,0,0,0,254,0,0,0,19,1,0,0,40,1,0,0,61,1,0,0,78,1,0,0,99,1,0,0,116,1,0,0,133,1,0,0,154,1,
+    0,0,173,1,0,0,192,1,0,0,227,1,0,0,6,2,0,0,40,2,0,0,74,2,0,0,109,2,0,0,148,2,0,0,189,2,0,0,225,2,0,0,4,3,0,0,35,3,
+    0,0,68,3,0,0,105,3,0,0,136,3,0,0,167,3,0,0,188,3,0,0,209,3,0,0,226,3,0,0,247,3,0,0,12,4,0,0,33,4,0,0,50,4,0,0,65,4,
+    0,0,94,4,0,0,131,4,0,0,162,4,0,0,201,4,0,0,234,4,0,0,11,5,0,0,44,5,0,0,71,5,0,0,100,5,0,0,129,5,0,0,164,5,0,0,195,5,
+    0,0,232,5,0,0,15,6,0,0,37,6,0,0,64,6,0,0,92,6,0,0,116,6,0,0,149,6,0,0,174,6,0,0,183,6,0,0,186,6,0,0,189,6,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,134,0,0,0,98,0,142,155,1,0,155,64,134,0,0,134,0,0,1,138,161,211,225,141,212,1,0,220,97,134,0,0,134,0,0,1,138,160,
+    211,225,130,220,1,0,212,1,132,220,1,5,212,1,220,1,220,1,212,1,212,1,220,97,134,0,0,134,0,0,0,130,161,131,212,1,138,220,1,0,220,97,134,0,0,134,0,0,
+    1,138,161,211,225,130,212,1,129,220,1,0,212,1,131,220,1,0,212,1,130,220,1,0,220,97,134,0,0,134,0,0,8,138,160,211,225,212,1,212,1,220,1,220,1,212,1,220,
+    1,212,1,130,220,1,130,212,1,1,220,1,220,97,134,0,0,134,0,0,0,138,192,130,212,1,130,220,1,136,220,33,0,228,129,134,0,0,134,0,0,1,138,193,211,225,131,220,
+    1,0,154,225,130,48,224,131,40,224,2,48,224,40,224,49,0,134,0,0,134,0,0,1,138,193,211,225,130,220,1,1,212,1,130,128,144,0,0,134,0,0,6,138,161,212,1,220,
+    1,212,1,220,1,212,1,130,96,144,0,0,134,0,0,6,138,193,212,1,212,1,220,1,220,1,212,1,130,96,144,0,0,134,0,0,6,138,161,211,225,220,1,212,1,220,1,220,
+    1,130,96,144,0,0,134,0,0,6,138,161,211,225,212,1,212,1,220,1,212,1,130,96,144,0,0,134,0,0,1,138,160,211,225,131,212,1,0,130,96,144,0,0,134,0,0,6,
+    138,160,211,225,220,1,212,1,220,1,212,1,122,96,144,0,0,134,0,0,1,138,160,211,225,131,212,1,0,122,96,144,0,0,134,0,0,1,138,161,211,225,131,212,1,0,122,96,
+    144,0,0,134,0,0,6,138,193,211,225,212,1,212,1,220,1,220,1,122,96,144,0,0,134,0,0,1,138,160,212,1,130,220,1,1,212,1,122,64,144,0,0,134,0,0,2,138,
+    160,211,225,212,1,130,220,1,0,122,64,144,0,0,134,0,0,1,138,160,211,225,130,220,1,9,212,1,122,64,0,0,0,0,89,192,155,1,179,97,171,65,114,96,16,96,136,0,
+    0,134,0,0,1,138,161,211,225,131,220,1,9,114,64,24,128,179,97,219,225,211,225,212,1,220,1,211,225,212,1,98,0,135,0,0,134,0,0,0,138,161,130,212,1,129,220,1,
+    3,114,64,195,193,211,225,212,1,131,220,1,2,212,1,220,1,106,0,134,0,0,134,0,0,8,138,192,211,225,212,1,220,1,220,1,212,1,195,161,211,225,212,1,133,220,1,129,
+    212,1,0,32,160,133,0,0,134,0,0,1,138,193,211,225,131,220,1,0,212,1,130,220,1,2,212,1,220,1,212,1,130,220,1,1,211,225,146,224,133,0,0,134,0,0,0,138,
+    193,130,212,1,129,220,1,130,212,1,9,220,1,212,1,220,1,220,1,212,1,212,1,220,1,212,1,220,33,8,32,132,0,0,134,0,0,3,138,193,220,1,212,1,212,1,130,220,
+    1,7,212,1,220,1,220,33,211,225,212,1,212,1,220,1,220,1,130,212,1,0,65,96,132,0,0,134,0,0,0,138,192,130,212,1,130,220,1,3,203,225,81,160,48,224,106,32,
+    131,212,1,3,220,1,212,1,211,225,97,224,132,0,0,134,0,0,1,138,193,211,225,132,212,1,0,32,160,130,0,0,2,65,96,220,33,220,1,130,212,1,1,220,1,130,96,132,
+    0,0,134,0,0,1,138,160,211,225,131,212,1,0,155,1,132,0,0,0,187,129,131,212,1,1,220,1,138,160,132,0,0,134,0,0,0,138,161,132,212,1,0,114,64,132,0,0,
+    6,138,192,212,1,212,1,220,1,212,1,220,1,138,192,132,0,0,134,0,0,1,138,161,211,225,130,212,1,1,211,225,89,224,132,0,0,6,138,128,220,1,212,1,220,1,212,1,
+    212,1,138,193,132,0,0,134,0,0,0,130,161,132,211,225,0,89,224,132,0,0,2,130,128,212,1,212,1,130,220,1,0,138,192,132,0,0,134,0,0,0,41,0,132,73,128,0,
+    32,160,132,0,0,0,138,128,130,220,1,2,212,1,220,1,138,192,132,0,0,146,0,0,6,130,128,220,1,220,1,212,1,220,1,220,1,138,193,132,0,0,146,0,0,6,130,128,
+    220,1,220,1,212,1,220,1,220,1,138,193,132,0,0,146,0,0,0,138,128,131,212,1,1,220,1,138,193,132,0,0,146,0,0,6,130,128,220,1,212,1,212,1,220,1,220,1,
+    138,193,132,0,0,146,0,0,6,138,128,220,1,220,1,212,1,220,1,220,1,138,192,132,0,0,146,0,0,6,138,128,220,1,220,1,212,1,220,1,220,1,138,193,132,0,0,146,
+    0,0,1,138,128,212,1,131,220,1,0,138,161,132,0,0,146,0,0,0,138,128,132,220,1,0,138,160,132,0,0,134,0,0,1,138,224,138,192,131,138,193,0,57,64,132,0,0,
+    0,138,128,132,220,1,0,138,160,132,0,0,134,0,0,6,228,65,212,1,220,1,220,1,212,1,219,225,89,224,132,0,0,2,138,128,220,1,212,1,130,220,1,0,138,192,132,0,
+    0,134,0,0,0,228,65,131,220,1,1,212,1,89,224,132,0,0,0,138,128,131,220,1,1,212,1,138,192,132,0,0,134,0,0,6,228,65,212,1,212,1,220,1,220,1,219,225,
+    89,224,132,0,0,6,138,128,220,1,220,1,212,1,220,1,212,1,138,192,132,0,0,134,0,0,6,228,65,212,1,220,1,212,1,220,1,219,225,89,224,132,0,0,0,138,128,132,
+    220,1,0,138,160,132,0,0,134,0,0,6,228,65,212,1,212,1,220,1,220,1,212,1,89,224,132,0,0,0,138,128,132,220,1,0,138,193,132,0,0,134,0,0,6,228,65,212,
+    1,220,1,212,1,220,1,220,1,89,224,132,0,0,0,138,128,132,220,1,0,138,193,132,0,0,134,0,0,0,228,65,132,220,1,0,89,224,132,0,0,0,138,128,132,220,1,0,
+    138,192,132,0,0,134,0,0,0,228,65,131,220,1,1,212,1,89,224,132,0,0,0,138,128,132,220,1,0,138,192,132,0,0,134,0,0,0,228,65,131,220,1,1,212,1,89,224,
+    132,0,0,0,138,160,132,220,1,0,138,192,132,0,0,134,0,0,2,220,33,212,1,212,1,130,220,1,0,114,64,132,0,0,2,163,33,220,1,212,1,130,220,1,0,138,128,132,
+    0,0,134,0,0,1,195,193,212,1,131,220,1,0,155,0,132,0,0,0,195,193,131,220,1,1,212,1,106,0,132,0,0,134,0,0,7,163,33,212,1,220,1,212,1,220,1,212,
+    1,220,1,73,96,130,0,0,0,106,0,132,220,1,1,211,225,73,128,132,0,0,134,0,0,3,114,64,211,225,212,1,212,1,131,220,1,5,146,192,114,64,155,1,220,1,212,1,
+    212,1,130,220,1,1,220,65,24,128,132,0,0,134,0,0,1,48,224,220,1,136,212,1,132,220,1,1,211,225,163,33,133,0,0,135,0,0,2,171,97,212,1,212,1,130,220,1,
+    131,212,1,132,220,1,1,220,33,49,0,133,0,0,135,0,0,1,32,160,211,225,130,212,1,129,220,1,0,212,1,133,220,1,1,212,1,146,224,134,0,0,136,0,0,1,73,128,
+    220,33,133,212,1,131,220,1,2,212,1,187,161,8,64,134,0,0,137,0,0,12,65,96,203,225,211,225,212,1,212,1,211,225,212,1,212,1,220,1,212,1,211,225,179,97,16,64,
+    135,0,0,138,0,0,3,16,64,106,32,163,65,212,1,130,220,65,2,212,1,155,1,81,160,137,0,0,143,0,0,0,16,96,141,0,0,158,0,0,158,0,0,158,0,0,
+    0,0,
+    // digit_6
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,12,0,0,0,37,0,0,0,64,0,0,0,86,0,0,0,103,0,0,0,120,0,0,0,139,0,
+    0,0,168,0,0,0,199,0,0,0,230,0,0,0,5,1,0,0,36,1,0,0,65,1,0,0,94,1,0,0,125,1,0,0,160,1,0,0,197,1,0,0,228,1,0,0,249,1,
+    0,0,14,2,0,0,37,2,0,0,60,2,0,0,83,2,0,0,106,2,0,0,127,2,0,0,162,2,0,0,197,2,0,0,234,2,0,0,11,3,0,0,32,3,0,0,64,3,
+    0,0,96,3,0,0,129,3,0,0,166,3,0,0,195,3,0,0,226,3,0,0,1,4,0,0,30,4,0,0,61,4,0,0,94,4,0,0,121,4,0,0,150,4,0,0,177,4,
+    0,0,204,4,0,0,231,4,0,0,2,5,0,0,29,5,0,0,58,5,0,0,87,5,0,0,116,5,0,0,143,5,0,0,172,5,0,0,201,5,0,0,230,5,0,0,5,6,
+    0,0,38,6,0,0,69,6,0,0,95,6,0,0,112,6,0,0,131,6,0,0,150,6,0,0,183,6,0,0,210,6,0,0,225,6,0,0,228,6,0,0,231,6,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,138,0,0,8,48,224,114,64,154,225,179,97,179,97,171,65,138,193,97,224,24,128,138,0,0,136,0,0,1,16,96,163,33,130,220,1,0,212,
+    1,130,220,1,2,211,225,220,33,122,96,137,0,0,135,0,0,1,40,192,195,193,136,220,1,129,212,1,1,163,65,8,32,135,0,0,134,0,0,1,16,96,212,1,140,220,1,0,
+    146,225,135,0,0,134,0,0,1,130,128,212,1,141,220,1,0,49,0,134,0,0,133,0,0,1,16,96,212,1,141,220,1,1,212,1,146,225,134,0,0,133,0,0,1,106,32,212,
+    1,133,220,1,3,220,33,171,97,220,1,211,225,132,220,1,0,212,1,134,0,0,133,0,0,0,179,97,132,220,1,5,212,1,138,192,0,0,0,0,16,64,171,65,133,220,1,0,
+    57,32,133,0,0,133,0,0,0,228,65,131,220,1,1,212,1,203,225,131,0,0,0,49,0,132,220,1,1,211,225,106,32,133,0,0,132,0,0,1,32,128,220,65,131,220,1,1,
+    211,225,122,96,132,0,0,0,212,1,132,220,1,0,122,96,133,0,0,132,0,0,0,49,0,131,220,1,2,212,1,211,225,73,160,132,0,0,0,171,97,132,220,1,0,130,128,133,
+    0,0,132,0,0,0,49,0,132,220,1,1,211,225,57,96,132,0,0,0,163,33,132,220,1,0,138,160,133,0,0,132,0,0,0,49,0,132,220,1,1,211,225,65,96,132,0,0,
+    0,146,224,132,220,1,0,138,160,133,0,0,132,0,0,1,49,0,220,33,131,220,1,1,211,225,65,96,132,0,0,0,146,224,132,220,1,0,130,128,133,0,0,132,0,0,7,48,
+    224,220,1,220,1,212,1,212,1,220,1,211,225,65,96,132,0,0,0,146,224,132,220,1,0,130,128,133,0,0,132,0,0,1,48,224,220,33,131,220,1,1,211,225,65,96,132,0,
+    0,6,146,224,211,225,211,225,220,1,212,1,220,1,138,128,133,0,0,132,0,0,1,48,224,220,33,131,220,1,1,211,225,65,96,132,0,0,0,97,192,132,138,128,0,81,160,133,
+    0,0,132,0,0,2,49,0,220,1,212,1,130,220,1,1,211,225,65,96,145,0,0,132,0,0,2,48,224,220,1,212,1,130,220,1,1,211,225,65,96,145,0,0,132,0,0,7,
+    48,224,220,1,212,1,212,1,220,1,212,1,211,225,65,96,145,0,0,132,0,0,7,49,0,220,1,212,1,220,1,212,1,212,1,211,225,65,96,145,0,0,132,0,0,7,48,224,
+    220,1,212,1,220,1,212,1,220,1,211,225,65,128,145,0,0,132,0,0,7,48,224,220,1,212,1,212,1,220,1,220,1,211,225,65,96,145,0,0,132,0,0,2,48,224,220,1,
+    212,1,130,220,1,1,211,225,65,96,145,0,0,132,0,0,3,48,224,220,1,212,1,220,1,130,212,1,7,65,96,0,0,0,0,81,160,138,192,163,65,146,192,81,160,138,0,0,
+    132,0,0,1,48,224,220,1,131,212,1,5,211,225,65,96,24,160,187,161,220,1,220,1,130,212,1,1,187,161,32,192,136,0,0,132,0,0,10,48,224,220,1,212,1,212,1,220,
+    1,212,1,212,1,81,192,195,161,220,1,220,1,132,212,1,1,203,193,40,224,135,0,0,132,0,0,8,48,224,220,1,212,1,212,1,220,1,220,1,212,1,195,193,212,1,135,220,
+    1,1,203,225,8,64,134,0,0,132,0,0,2,48,224,220,1,212,1,141,220,1,1,212,1,114,32,134,0,0,132,0,0,1,49,0,220,1,130,212,1,131,220,1,0,212,1,132,
+    220,1,3,212,1,220,1,220,1,195,193,134,0,0,132,0,0,2,48,224,220,1,212,1,132,220,1,129,212,1,1,220,1,219,225,133,220,1,1,220,33,32,160,133,0,0,132,0,
+    0,2,49,0,220,1,212,1,132,220,1,3,203,193,89,224,57,64,155,0,133,220,1,1,211,225,98,0,133,0,0,132,0,0,0,48,224,131,220,1,3,212,1,220,1,220,1,57,
+    32,130,0,0,1,154,225,212,1,131,220,1,1,211,225,122,96,133,0,0,132,0,0,0,49,0,133,220,1,0,179,97,131,0,0,1,49,0,220,33,132,220,1,0,130,160,133,0,
+    0,132,0,0,0,49,0,132,220,1,1,212,1,130,128,132,0,0,0,228,97,131,220,1,1,212,1,138,160,133,0,0,132,0,0,2,49,0,220,1,212,1,131,220,1,0,114,96,
+    132,0,0,0,212,1,132,220,1,0,138,160,133,0,0,132,0,0,0,49,0,133,220,1,0,114,96,132,0,0,0,212,1,131,220,1,1,212,1,138,160,133,0,0,132,0,0,0,
+    49,0,133,220,1,0,114,64,132,0,0,0,212,1,130,220,1,2,212,1,220,1,138,160,133,0,0,132,0,0,0,49,0,133,220,1,0,114,64,132,0,0,6,212,1,220,1,212,
+    1,220,1,220,1,219,225,138,160,133,0,0,132,0,0,0,49,0,133,220,1,0,114,64,132,0,0,0,212,1,132,220,1,0,138,160,133,0,0,132,0,0,1,32,160,220,33,132,
+    220,1,0,114,64,132,0,0,0,212,1,132,220,1,0,138,160,133,0,0,133,0,0,0,228,65,132,220,1,0,114,64,132,0,0,0,212,1,132,220,1,0,138,160,133,0,0,133,
+    0,0,0,228,97,132,220,1,0,114,96,132,0,0,0,212,1,132,220,1,0,138,160,133,0,0,133,0,0,0,228,97,132,220,1,0,114,64,132,0,0,0,212,1,132,220,1,0,
+    138,160,133,0,0,133,0,0,0,228,97,132,220,1,0,114,64,132,0,0,0,212,1,132,220,1,0,138,160,133,0,0,133,0,0,0,228,97,132,220,1,0,114,96,132,0,0,0,
+    212,1,132,220,1,0,138,160,133,0,0,133,0,0,0,228,97,132,220,1,0,114,64,132,0,0,129,212,1,130,220,1,1,212,1,138,160,133,0,0,133,0,0,0,228,97,132,220,
+    1,0,114,64,132,0,0,0,212,1,131,220,1,1,212,1,138,160,133,0,0,133,0,0,0,228,97,131,220,1,1,212,1,114,64,132,0,0,129,212,1,131,220,1,0,138,160,133,
+    0,0,133,0,0,0,228,97,132,220,1,0,114,64,132,0,0,0,212,1,132,220,1,0,138,160,133,0,0,133,0,0,0,228,97,131,220,1,1,212,1,114,64,132,0,0,0,212,
+    1,132,220,1,0,138,160,133,0,0,133,0,0,0,228,97,131,220,1,1,212,1,114,64,132,0,0,0,220,33,132,220,1,0,146,160,133,0,0,133,0,0,0,228,65,131,220,1,
+    1,212,1,114,64,132,0,0,0,228,65,132,220,1,0,130,128,133,0,0,133,0,0,0,211,225,132,220,1,0,155,1,131,0,0,1,32,160,220,33,131,220,1,1,211,225,114,96,
+    133,0,0,133,0,0,0,179,97,131,220,1,2,212,1,220,1,57,32,130,0,0,0,122,96,132,220,1,1,211,225,81,160,133,0,0,133,0,0,1,130,128,211,225,132,220,1,3,
+    212,1,130,96,97,224,146,192,133,220,1,1,220,33,16,96,133,0,0,133,0,0,0,49,0,133,220,1,0,212,1,130,211,225,132,220,1,1,212,1,171,65,134,0,0,134,0,0,
+    0,179,97,141,220,1,1,211,225,89,192,134,0,0,134,0,0,1,57,64,220,33,139,220,1,1,212,1,179,129,135,0,0,135,0,0,0,106,0,138,220,1,2,212,1,195,161,8,
+    64,135,0,0,136,0,0,12,114,32,220,33,212,1,220,1,212,1,212,1,220,1,211,225,212,1,220,1,211,225,187,193,32,160,136,0,0,137,0,0,9,48,224,138,160,203,225,220,
+    33,220,1,220,1,220,33,212,33,163,33,89,192,138,0,0,140,0,0,3,16,96,49,0,57,64,40,192,141,0,0,158,0,0,158,0,0,158,0,0,
+    // digit_7
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,12,0,0,0,33,0,0,0,53,0,0,0,89,0,0,0,121,0,0,0,160,0,0,0,201,0,
+    0,0,225,0,0,0,6,1,0,0,21,1,0,0,38,1,0,0,55,1,0,0,70,1,0,0,87,1,0,0,102,1,0,0,121,1,0,0,136,1,0,0,153,1,0,0,170,1,
+    0,0,187,1,0,0,204,1,0,0,223,1,0,0,238,1,0,0,253,1,0,0,12,2,0,0,29,2,0,0,48,2,0,0,63,2,0,0,78,2,0,0,97,2,0,0,112,2,
+    0,0,131,2,0,0,150,2,0,0,169,2,0,0,188,2,0,0,209,2,0,0,232,2,0,0,249,2,0,0,12,3,0,0,31,3,0,0,50,3,0,0,69,3,0,0,88,3,
+    0,0,105,3,0,0,126,3,0,0,147,3,0,0,162,3,0,0,179,3,0,0,198,3,0,0,217,3,0,0,232,3,0,0,247,3,0,0,6,4,0,0,25,4,0,0,46,4,
+    0,0,65,4,0,0,80,4,0,0,97,4,0,0,120,4,0,0,141,4,0,0,158,4,0,0,173,4,0,0,190,4,0,0,193,4,0,0,196,4,0,0,199,4,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,134,0,0,0,97,224,141,155,1,3,155,0,155,1,155,1,106,32,132,0,0,134,0,0,1,138,160,211,225,141,212,1,129,211,225,0,155,0,
+    132,0,0,134,0,0,6,138,128,212,1,212,1,220,1,212,1,220,1,212,1,130,220,1,129,212,1,0,220,1,132,212,1,0,155,0,132,0,0,134,0,0,4,138,128,211,225,212,
+    1,220,1,212,1,131,220,1,0,212,1,133,220,1,129,212,1,0,155,0,132,0,0,134,0,0,3,138,128,212,1,220,1,212,1,130,220,1,0,212,1,130,220,1,2,212,1,220,
+    1,220,1,130,212,1,1,220,1,146,224,132,0,0,134,0,0,3,138,128,212,1,212,1,220,1,130,212,1,1,220,1,212,1,130,220,1,6,212,1,220,1,212,1,220,1,212,1,
+    212,1,138,160,132,0,0,134,0,0,0,138,160,138,220,33,129,220,1,0,212,1,130,220,1,0,114,32,132,0,0,134,0,0,6,24,128,48,224,48,224,40,224,40,224,48,224,40,
+    224,131,48,224,1,57,32,220,65,131,220,1,1,211,225,81,160,132,0,0,145,0,0,0,57,64,133,220,1,0,40,224,132,0,0,145,0,0,1,106,32,211,225,131,220,1,0,220,
+    65,133,0,0,145,0,0,1,155,1,212,1,131,220,1,0,187,129,133,0,0,145,0,0,0,195,193,132,220,1,0,146,224,133,0,0,144,0,0,1,8,32,228,65,132,220,1,0,
+    106,32,133,0,0,144,0,0,0,49,0,133,220,1,0,57,64,133,0,0,144,0,0,1,89,192,211,225,131,220,1,1,220,65,8,32,133,0,0,144,0,0,0,122,96,132,220,1,
+    0,195,193,134,0,0,144,0,0,0,155,1,131,220,1,1,212,1,163,33,134,0,0,144,0,0,1,187,193,212,1,131,220,1,0,130,128,134,0,0,144,0,0,1,220,33,212,1,
+    131,220,1,0,97,224,134,0,0,143,0,0,0,49,0,132,220,1,1,212,1,57,64,134,0,0,143,0,0,1,106,0,211,225,131,220,1,1,220,65,24,96,134,0,0,143,0,0,
+    0,138,192,132,220,1,0,212,1,135,0,0,143,0,0,0,187,129,132,220,1,0,163,65,135,0,0,143,0,0,0,220,65,132,220,1,0,122,128,135,0,0,142,0,0,0,40,224,
+    132,220,1,1,211,225,81,160,135,0,0,142,0,0,1,73,128,211,225,131,220,1,1,220,33,40,192,135,0,0,142,0,0,0,106,32,132,220,1,0,220,33,136,0,0,142,0,0,
+    0,146,193,132,220,1,0,179,129,136,0,0,142,0,0,1,179,129,212,1,130,220,1,1,212,1,146,192,136,0,0,142,0,0,0,220,33,132,220,1,0,106,32,136,0,0,141,0,
+    0,1,40,192,220,33,131,220,1,1,211,225,81,160,136,0,0,141,0,0,1,89,224,211,225,131,220,1,1,220,33,40,192,136,0,0,141,0,0,2,122,128,212,1,212,1,130,220,
+    1,0,228,65,137,0,0,141,0,0,2,171,97,220,1,212,1,130,220,1,0,187,161,137,0,0,141,0,0,6,220,33,212,1,220,1,220,1,212,1,220,1,138,192,137,0,0,140,
+    0,0,7,32,160,220,33,220,1,212,1,220,1,220,1,212,1,98,0,137,0,0,140,0,0,1,73,96,211,225,132,220,1,0,57,32,137,0,0,140,0,0,1,106,0,212,1,131,
+    220,1,1,220,65,0,32,137,0,0,140,0,0,1,138,193,212,1,130,220,1,1,212,1,187,161,138,0,0,140,0,0,1,171,65,212,1,130,220,1,1,212,1,163,33,138,0,0,
+    140,0,0,1,204,1,212,1,130,220,1,1,212,1,122,96,138,0,0,139,0,0,1,32,128,220,65,131,220,1,1,211,225,89,192,138,0,0,139,0,0,1,81,160,212,1,132,220,
+    1,0,49,32,138,0,0,139,0,0,1,122,96,212,1,130,220,1,2,212,1,228,97,8,32,138,0,0,139,0,0,6,163,33,212,1,220,1,220,1,212,1,220,1,203,225,139,0,
+    0,139,0,0,0,212,33,132,220,1,0,163,33,139,0,0,138,0,0,1,16,96,220,65,132,220,1,0,122,96,139,0,0,138,0,0,1,65,64,212,1,131,220,1,1,212,1,73,
+    160,139,0,0,138,0,0,1,98,0,212,1,131,220,1,1,220,65,24,128,139,0,0,138,0,0,0,138,160,132,220,1,0,212,1,140,0,0,138,0,0,0,171,97,132,220,1,0,
+    171,97,140,0,0,138,0,0,0,204,1,132,220,1,0,138,160,140,0,0,137,0,0,1,24,96,220,65,131,220,1,1,212,1,98,0,140,0,0,137,0,0,0,73,128,130,220,1,
+    3,212,1,220,1,211,225,73,128,140,0,0,137,0,0,1,114,64,212,1,131,220,1,1,220,33,32,160,140,0,0,137,0,0,0,163,33,132,220,1,0,220,33,141,0,0,137,0,
+    0,1,203,225,212,1,131,220,1,0,171,65,141,0,0,136,0,0,7,16,96,220,65,212,1,212,1,220,1,212,1,212,1,122,128,141,0,0,136,0,0,2,57,64,212,1,212,1,
+    130,220,1,1,212,1,81,160,141,0,0,136,0,0,0,97,224,132,212,1,1,220,33,24,128,141,0,0,136,0,0,0,130,128,132,212,1,0,220,33,142,0,0,136,0,0,0,89,
+    224,131,130,128,1,130,96,106,32,142,0,0,158,0,0,158,0,0,158,0,0,158,0,0,
+    // digit_8
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,12,0,0,0,39,0,0,0,66,0,0,0,85,0,0,0,107,0,0,0,128,0,0,0,165,0,
+    0,0,198,0,0,0,241,0,0,0,16,1,0,0,49,1,0,0,80,1,0,0,113,1,0,0,144,1,0,0,181,1,0,0,220,1,0,0,251,1,0,0,28,2,0,0,59,2,
+    0,0,91,2,0,0,126,2,0,0,163,2,0,0,198,2,0,0,227,2,0,0,2,3,0,0,37,3,0,0,69,3,0,0,102,3,0,0,139,3,0,0,168,3,0,0,194,3,
+    0,0,233,3,0,0,12,4,0,0,46,4,0,0,85,4,0,0,124,4,0,0,157,4,0,0,190,4,0,0,227,4,0,0,2,5,0,0,38,5,0,0,75,5,0,0,112,5,
+    0,0,151,5,0,0,192,5,0,0,229,5,0,0,12,6,0,0,49,6,0,0,82,6,0,0,113,6,0,0,148,6,0,0,181,6,0,0,214,6,0,0,249,6,0,0,26,7,
+    0,0,62,7,0,0,103,7,0,0,136,7,0,0,172,7,0,0,207,7,0,0,236,7,0,0,9,8,0,0,34,8,0,0,37,8,0,0,40,8,0,0,43,8,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,137,0,0,9,16,96,114,32,179,65,212,1,220,65,220,65,220,33,195,161,154,224,81,160,138,0,0,136,0,0,1,73,128,212,33,130,212,1,
+    130,220,1,129,212,1,2,220,1,203,225,40,224,136,0,0,135,0,0,1,97,224,212,1,138,220,1,1,211,225,65,64,135,0,0,134,0,0,2,49,32,220,33,212,1,138,220,1,
+    129,212,1,0,24,160,134,0,0,134,0,0,0,163,1,139,220,1,3,212,1,220,1,220,1,130,160,134,0,0,133,0,0,1,32,192,220,33,133,220,1,10,212,1,220,1,220,1,
+    212,1,220,1,220,1,212,1,220,1,212,1,212,1,8,64,133,0,0,133,0,0,1,122,96,211,225,132,220,1,4,211,225,220,65,220,33,220,33,212,1,132,220,1,1,211,225,89,
+    192,133,0,0,133,0,0,12,187,129,220,1,220,1,212,1,220,1,220,1,219,225,146,192,16,96,0,0,32,160,163,33,211,225,130,220,1,2,212,1,220,1,154,224,133,0,0,133,
+    0,0,0,228,65,132,220,1,1,204,1,8,32,130,0,0,1,8,32,203,225,132,220,1,0,187,129,133,0,0,132,0,0,1,16,96,220,65,130,220,1,2,212,1,220,1,138,160,
+    132,0,0,0,146,193,132,220,1,0,228,65,133,0,0,132,0,0,1,24,128,220,33,131,220,1,1,211,225,122,64,132,0,0,0,114,64,132,220,1,0,228,65,133,0,0,132,0,
+    0,1,24,128,220,33,131,220,1,1,211,225,122,64,132,0,0,1,114,96,212,1,131,220,1,0,228,65,133,0,0,132,0,0,1,24,128,220,65,131,220,1,1,212,1,122,64,132,
+    0,0,0,114,96,132,220,1,0,228,65,133,0,0,132,0,0,7,24,128,220,65,220,1,212,1,220,1,220,1,211,225,122,64,132,0,0,1,114,96,212,1,131,220,1,0,228,65,
+    133,0,0,132,0,0,7,24,128,220,65,220,1,212,1,220,1,220,1,212,1,122,64,132,0,0,2,114,96,212,1,212,1,130,220,1,0,228,65,133,0,0,132,0,0,1,24,128,
+    220,65,131,220,1,1,212,1,114,64,132,0,0,0,114,96,132,220,1,0,228,65,133,0,0,132,0,0,1,24,128,220,65,131,220,1,1,212,1,114,64,132,0,0,0,114,96,131,
+    220,1,1,212,1,228,65,133,0,0,132,0,0,1,24,128,220,65,131,220,1,1,212,1,122,64,132,0,0,0,114,96,132,220,1,0,228,65,133,0,0,132,0,0,1,24,128,220,
+    65,130,220,1,129,212,1,0,114,64,132,0,0,0,114,96,132,220,1,0,228,65,133,0,0,132,0,0,7,16,96,220,65,220,1,212,1,220,1,220,1,212,1,122,64,132,0,0,
+    0,114,96,132,220,1,0,228,65,133,0,0,133,0,0,6,220,65,212,1,220,1,220,1,212,1,212,1,122,64,132,0,0,2,114,96,212,1,212,1,130,220,1,0,228,97,133,0,
+    0,133,0,0,6,228,65,212,1,212,1,220,1,220,1,211,225,122,64,132,0,0,1,114,96,212,1,131,220,1,0,220,33,133,0,0,133,0,0,0,203,225,131,220,1,1,211,225,
+    122,64,132,0,0,0,130,128,132,220,1,0,171,65,133,0,0,133,0,0,1,146,225,212,1,130,220,1,1,212,1,130,128,132,0,0,0,163,33,132,220,1,0,138,160,133,0,0,
+    133,0,0,0,81,160,132,220,1,0,204,1,131,0,0,7,8,32,212,1,220,1,212,1,220,1,212,1,220,1,73,96,133,0,0,133,0,0,1,0,32,212,1,132,220,1,0,106,
+    32,130,0,0,3,114,64,212,1,220,1,220,1,130,212,1,134,0,0,134,0,0,1,122,96,212,1,132,220,1,4,171,65,138,160,179,97,220,1,212,1,130,220,1,1,212,1,114,
+    64,134,0,0,134,0,0,9,8,32,187,161,211,225,220,1,220,1,212,1,212,1,220,1,220,1,212,1,131,220,1,2,211,225,179,129,0,32,134,0,0,135,0,0,3,8,64,130,
+    160,211,225,212,1,130,220,1,0,212,1,131,220,1,1,211,225,114,64,136,0,0,136,0,0,3,73,128,179,97,220,1,220,1,132,212,1,129,220,1,1,155,1,65,64,136,0,0,
+    134,0,0,5,8,32,155,0,220,1,220,1,212,1,220,1,130,212,1,7,220,1,212,1,220,1,212,1,220,1,220,1,146,225,8,32,134,0,0,134,0,0,9,130,160,211,225,220,
+    1,212,1,212,1,220,1,212,1,220,1,220,1,212,1,132,220,1,1,211,225,130,128,134,0,0,133,0,0,1,24,96,212,33,130,220,1,129,212,1,3,220,1,211,225,179,129,220,
+    33,133,220,1,1,212,33,16,96,133,0,0,133,0,0,11,122,96,212,1,212,1,220,1,220,1,212,1,220,1,97,224,0,0,0,0,8,32,138,161,132,220,1,1,211,225,114,64,
+    133,0,0,133,0,0,6,187,161,220,1,220,1,212,1,220,1,220,1,179,97,132,0,0,6,203,225,220,1,220,1,212,1,220,1,220,1,187,129,133,0,0,133,0,0,6,228,65,
+    220,1,220,1,212,1,220,1,212,1,114,64,132,0,0,0,155,0,132,220,1,0,228,65,133,0,0,132,0,0,1,24,128,220,65,131,220,1,1,211,225,97,224,132,0,0,0,114,
+    96,132,220,1,1,220,65,24,96,132,0,0,132,0,0,7,49,0,220,1,220,1,212,1,220,1,212,1,211,225,81,160,132,0,0,0,114,96,132,220,1,1,220,33,32,160,132,0,
+    0,132,0,0,0,49,32,132,220,1,1,211,225,73,160,132,0,0,0,114,96,132,220,1,1,220,33,32,160,132,0,0,132,0,0,0,49,32,130,220,1,129,212,1,1,211,225,73,
+    160,132,0,0,1,114,96,212,1,131,220,1,1,220,33,32,160,132,0,0,132,0,0,0,49,32,131,220,1,2,212,1,211,225,73,160,132,0,0,2,114,96,212,1,212,1,130,220,
+    1,1,220,33,32,160,132,0,0,132,0,0,0,49,32,132,220,1,1,211,225,73,160,132,0,0,7,114,96,220,1,212,1,220,1,212,1,220,1,220,33,32,160,132,0,0,132,0,
+    0,0,49,32,131,220,1,2,212,1,211,225,73,160,132,0,0,7,114,96,212,1,212,1,220,1,212,1,220,1,220,33,32,160,132,0,0,132,0,0,7,49,32,220,1,220,1,212,
+    1,220,1,212,1,211,225,73,160,132,0,0,1,114,96,220,1,130,212,1,2,220,1,220,33,32,160,132,0,0,132,0,0,1,49,32,219,225,131,220,1,1,211,225,73,160,132,0,
+    0,2,114,96,220,1,212,1,130,220,1,1,220,33,32,160,132,0,0,132,0,0,1,49,32,211,225,130,220,1,2,212,1,211,225,73,160,132,0,0,2,114,96,212,1,212,1,130,
+    220,1,1,220,33,32,160,132,0,0,132,0,0,1,49,32,211,225,131,220,1,1,211,225,73,160,132,0,0,2,114,96,220,1,219,225,130,220,1,1,220,33,32,160,132,0,0,132,
+    0,0,0,49,32,132,220,1,1,211,225,73,160,132,0,0,1,114,96,212,1,131,220,1,1,220,33,32,160,132,0,0,132,0,0,0,49,32,132,220,1,1,211,225,73,160,132,0,
+    0,0,114,96,132,220,1,1,220,33,32,160,132,0,0,132,0,0,0,49,32,132,220,1,1,211,225,73,160,132,0,0,2,114,96,220,1,212,1,130,220,1,1,220,33,32,160,132,
+    0,0,132,0,0,0,49,32,131,220,1,2,212,1,211,225,73,160,132,0,0,0,114,96,132,220,1,1,220,33,32,160,132,0,0,132,0,0,0,49,0,131,220,1,2,212,1,211,
+    225,89,192,132,0,0,0,114,96,132,220,1,1,220,33,32,160,132,0,0,132,0,0,0,40,224,130,220,1,3,212,1,220,1,212,1,122,96,132,0,0,0,146,225,132,220,1,1,
+    228,65,16,64,132,0,0,132,0,0,3,16,64,220,65,220,1,212,1,130,220,1,0,179,129,132,0,0,0,203,225,132,220,1,0,220,33,133,0,0,133,0,0,0,203,225,130,212,
+    1,130,220,1,0,81,160,130,0,0,0,98,0,130,220,1,3,212,1,220,1,220,1,179,97,133,0,0,133,0,0,12,138,192,220,1,220,1,212,1,220,1,212,1,212,1,220,33,
+    146,225,114,64,155,1,220,1,212,1,131,220,1,1,212,1,114,64,133,0,0,133,0,0,5,40,224,220,33,220,1,212,1,220,1,220,1,132,212,1,131,220,1,129,212,1,1,220,
+    1,24,160,133,0,0,134,0,0,6,155,1,212,1,220,1,212,1,220,1,220,1,212,1,130,220,1,0,212,1,130,220,1,129,212,1,0,154,224,134,0,0,134,0,0,0,32,192,
+    130,212,1,5,220,1,212,1,212,1,220,1,212,1,212,1,131,220,1,2,212,1,211,225,32,160,134,0,0,135,0,0,2,49,0,212,1,211,225,132,212,1,0,220,1,130,212,1,
+    2,220,1,212,1,49,0,135,0,0,136,0,0,3,40,224,195,193,212,1,211,225,131,212,1,4,220,1,212,1,220,1,195,193,49,0,136,0,0,138,0,0,8,73,128,138,192,179,
+    129,211,225,220,33,212,1,179,129,138,161,73,128,138,0,0,158,0,0,158,0,0,158,0,0,158,0,0,
+    // digit_9
+    82,76,31,0,70,0,0,0,0,0,3,0,0,0,6,0,0,0,9,0,0,0,12,0,0,0,39,0,0,0,66,0,0,0,85,0,0,0,100,0,0,0,119,0,0,0,148,0,
+    0,0,179,0,0,0,214,0,0,0,247,0,0,0,24,1,0,0,57,1,0,0,92,1,0,0,123,1,0,0,160,1,0,0,191,1,0,0,224,1,0,0,255,1,0,0,30,2,
+    0,0,61,2,0,0,92,2,0,0,125,2,0,0,158,2,0,0,191,2,0,0,226,2,0,0,3,3,0,0,38,3,0,0,73,3,0,0,110,3,0,0,147,3,0,0,180,3,
+    0,0,214,3,0,0,247,3,0,0,20,4,0,0,51,4,0,0,81,4,0,0,120,4,0,0,157,4,0,0,194,4,0,0,212,4,0,0,233,4,0,0,252,4,0,0,15,5,
+    0,0,33,5,0,0,52,5,0,0,69,5,0,0,102,5,0,0,131,5,0,0,165,5,0,0,198,5,0,0,233,5,0,0,12,6,0,0,45,6,0,0,76,6,0,0,109,6,
+    0,0,144,6,0,0,173,6,0,0,196,6,0,0,213,6,0,0,230,6,0,0,251,6,0,0,20,7,0,0,47,7,0,0,50,7,0,0,53,7,0,0,56,7,0,0,158,0,
+    0,158,0,0,158,0,0,158,0,0,138,0,0,9,24,128,114,32,163,33,203,225,220,65,220,33,203,225,171,65,114,64,24,128,137,0,0,137,0,0,5,106,32,212,1,211,225,211,
+    225,212,1,220,1,131,212,1,1,220,33,98,0,136,0,0,136,0,0,0,138,160,137,220,1,2,212,1,220,1,130,128,135,0,0,135,0,0,0,106,64,141,220,1,0,89,224,134,
+    0,0,134,0,0,2,16,96,212,33,212,1,140,220,1,0,195,193,134,0,0,134,0,0,1,114,32,212,1,132,220,1,3,219,225,211,225,212,1,212,1,133,220,1,0,89,192,133,
+    0,0,134,0,0,1,179,129,212,1,131,220,1,3,212,1,211,225,146,225,163,33,133,220,1,1,219,225,171,65,133,0,0,133,0,0,1,8,32,220,65,132,220,1,6,187,129,8,
+    64,0,0,0,0,57,32,212,1,212,1,131,220,1,0,220,33,133,0,0,133,0,0,0,57,32,132,220,1,1,219,225,97,192,131,0,0,1,122,96,211,225,131,220,1,1,220,33,
+    24,128,132,0,0,133,0,0,1,73,128,211,225,131,220,1,1,219,225,49,32,131,0,0,1,65,96,212,1,132,220,1,0,40,224,132,0,0,133,0,0,1,89,192,211,225,131,220,
+    1,1,220,33,40,192,131,0,0,1,57,64,212,1,132,220,1,0,49,0,132,0,0,133,0,0,1,89,192,211,225,131,220,1,1,220,33,32,160,131,0,0,2,65,64,220,1,212,
+    1,131,220,1,0,49,32,132,0,0,133,0,0,1,89,192,211,225,131,220,1,1,220,65,32,160,131,0,0,0,65,64,133,220,1,0,49,32,132,0,0,133,0,0,1,89,192,211,
+    225,130,220,1,2,212,1,220,65,32,160,131,0,0,2,65,64,220,1,212,1,131,220,1,0,49,32,132,0,0,133,0,0,1,89,192,211,225,131,220,1,1,220,65,32,160,131,0,
+    0,0,65,64,133,220,1,0,49,32,132,0,0,133,0,0,1,89,192,211,225,131,220,1,1,220,65,32,160,131,0,0,0,57,64,132,220,1,1,219,225,49,0,132,0,0,133,0,
+    0,1,89,192,211,225,131,220,1,1,220,65,32,160,131,0,0,0,57,64,133,220,1,0,49,32,132,0,0,133,0,0,1,89,192,211,225,131,220,1,1,220,65,32,160,131,0,0,
+    0,57,64,133,220,1,0,49,32,132,0,0,133,0,0,1,89,192,211,225,131,220,1,1,220,65,32,160,131,0,0,0,57,96,133,220,1,0,49,0,132,0,0,133,0,0,1,89,
+    192,211,225,131,220,1,1,220,65,32,128,131,0,0,0,57,96,133,220,1,0,49,0,132,0,0,133,0,0,1,89,192,211,225,131,220,1,1,220,65,32,160,131,0,0,0,65,64,
+    132,220,1,1,211,225,49,32,132,0,0,133,0,0,1,89,192,211,225,131,220,1,1,220,65,32,160,131,0,0,0,57,64,132,220,1,1,211,225,81,160,132,0,0,133,0,0,1,
+    89,192,211,225,131,220,1,1,220,65,32,160,131,0,0,0,57,64,132,220,1,1,212,1,97,224,132,0,0,133,0,0,1,89,192,211,225,130,220,1,2,212,1,220,65,32,160,131,
+    0,0,0,57,64,132,220,1,1,212,1,97,224,132,0,0,133,0,0,1,89,192,211,225,131,220,1,1,220,65,32,160,131,0,0,0,65,64,132,220,1,1,212,1,97,192,132,0,
+    0,133,0,0,2,89,192,211,225,212,1,130,220,1,1,220,65,32,128,131,0,0,0,65,96,132,220,1,1,212,1,97,224,132,0,0,133,0,0,2,89,192,211,225,212,1,130,220,
+    1,1,220,65,32,160,131,0,0,0,65,96,132,220,1,1,212,1,97,224,132,0,0,133,0,0,1,89,192,211,225,132,220,1,0,49,0,131,0,0,7,65,96,212,1,220,1,212,
+    1,220,1,220,1,212,1,89,192,132,0,0,133,0,0,2,81,192,211,225,212,1,130,220,1,1,211,225,81,160,131,0,0,1,114,64,211,225,131,220,1,1,212,1,89,192,132,0,
+    0,133,0,0,1,65,96,211,225,132,220,1,0,171,65,130,0,0,1,0,32,195,193,132,220,1,1,212,1,89,192,132,0,0,133,0,0,1,40,192,220,33,133,220,1,4,154,224,
+    57,32,57,64,155,1,219,225,131,220,1,129,212,1,0,89,192,132,0,0,134,0,0,0,212,1,134,220,1,2,211,225,212,1,212,1,130,220,1,4,212,1,220,1,220,1,212,1,
+    89,192,132,0,0,134,0,0,0,163,33,134,220,1,0,212,1,132,220,1,4,212,1,211,225,212,1,212,1,97,192,132,0,0,134,0,0,1,89,192,212,1,130,220,1,0,212,1,
+    135,220,1,4,212,1,220,1,212,1,211,225,89,192,132,0,0,135,0,0,2,195,193,220,1,212,1,133,220,1,1,212,1,211,225,131,220,1,129,212,1,0,89,192,132,0,0,135,
+    0,0,5,32,192,203,193,212,1,220,1,212,1,212,1,131,220,1,7,81,128,220,65,220,1,220,1,212,1,212,1,211,225,89,192,132,0,0,136,0,0,3,40,224,203,225,211,225,
+    211,225,130,212,1,5,220,33,98,0,0,0,220,65,212,1,220,1,130,212,1,0,97,192,132,0,0,137,0,0,10,8,32,89,192,146,225,179,97,163,33,122,96,32,192,0,0,0,
+    0,220,65,220,1,130,212,1,1,211,225,89,192,132,0,0,146,0,0,0,220,65,130,220,1,129,212,1,0,97,192,132,0,0,146,0,0,6,220,65,212,1,212,1,220,1,212,1,
+    211,225,97,192,132,0,0,146,0,0,2,220,65,220,1,220,1,130,212,1,0,97,192,132,0,0,146,0,0,1,220,65,212,1,130,220,1,1,211,225,97,224,132,0,0,146,0,0,
+    0,220,65,130,220,1,129,212,1,0,97,192,132,0,0,146,0,0,1,220,65,212,1,130,220,1,1,211,225,97,224,132,0,0,146,0,0,0,220,65,131,220,1,1,212,1,97,224,
+    132,0,0,133,0,0,1,40,224,114,64,130,122,64,1,114,64,114,32,133,0,0,0,220,65,131,220,1,1,212,1,97,224,132,0,0,133,0,0,0,81,160,132,211,225,0,203,193,
+    133,0,0,0,220,65,131,220,1,1,212,1,97,192,132,0,0,133,0,0,1,81,160,211,225,130,220,1,1,212,1,203,225,133,0,0,0,220,65,130,220,1,129,212,1,0,97,192,
+    132,0,0,133,0,0,1,81,160,211,225,130,220,1,1,212,1,203,225,133,0,0,0,220,65,131,220,1,1,212,1,97,224,132,0,0,133,0,0,1,81,160,211,225,131,220,1,0,
+    203,225,133,0,0,6,220,65,220,1,212,1,220,1,220,1,212,1,97,224,132,0,0,133,0,0,1,89,192,211,225,131,220,1,0,212,1,133,0,0,6,220,65,220,1,220,1,212,
+    1,220,1,212,1,97,224,132,0,0,133,0,0,1,81,160,211,225,131,220,1,0,228,97,132,0,0,1,8,32,220,33,131,220,1,1,212,1,97,224,132,0,0,133,0,0,0,65,
+    96,132,220,1,1,228,65,24,128,131,0,0,0,57,64,132,220,1,1,211,225,81,160,132,0,0,133,0,0,1,57,32,220,33,131,220,1,1,211,225,73,128,131,0,0,1,130,160,
+    212,1,132,220,1,0,49,32,132,0,0,133,0,0,1,8,32,220,65,132,220,1,5,179,97,8,32,0,0,0,0,57,32,212,1,132,220,1,1,220,65,16,64,132,0,0,134,0,
+    0,0,187,129,132,220,1,4,212,1,203,225,122,96,146,225,212,1,133,220,1,0,179,129,133,0,0,134,0,0,1,122,96,212,1,133,220,1,0,212,1,135,220,1,0,89,192,133,
+    0,0,134,0,0,1,32,160,220,33,141,220,1,0,195,193,134,0,0,135,0,0,0,106,32,140,220,1,1,220,33,65,96,134,0,0,136,0,0,2,155,0,212,1,212,1,136,220,
+    1,1,220,33,89,224,135,0,0,136,0,0,3,0,32,138,193,220,33,212,1,133,220,1,2,211,225,220,33,89,192,136,0,0,138,0,0,9,49,0,122,96,179,97,212,1,220,65,
+    220,65,203,225,171,65,114,32,16,96,137,0,0,158,0,0,158,0,0,158,0,0,158,0,0,
+    0,0,0,
+    // scale_0_on
+    82,76,23,0,15,0,0,0,0,0,9,0,0,0,20,0,0,0,33,0,0,0,52,0,0,0,77,0,0,0,104,0,0,0,131,0,0,0,158,0,0,0,185,0,0,0,212,0,
+    0,0,237,0,0,0,0,1,0,0,22,1,0,0,33,1,0,0,0,0,96,148,25,96,0,25,32,0,25,224,147,52,0,1,52,32,59,96,1,25,224,36,0,146,35,224,1,36,
+    0,43,64,1,25,224,36,0,141,35,224,130,36,0,129,35,224,1,36,0,43,64,1,25,224,36,0,140,35,224,7,36,0,35,192,35,64,35,192,36,0,35,224,36,0,43,64,1,
+    25,224,36,0,139,35,224,8,36,0,35,192,26,96,35,64,26,64,35,192,35,224,36,0,43,64,1,25,224,36,0,139,35,224,8,36,32,35,0,43,0,44,96,34,224,35,32,36,
+    0,36,0,43,64,1,25,224,36,0,139,35,224,8,36,0,42,224,51,64,36,32,43,32,27,0,36,0,36,0,43,64,1,25,224,36,0,139,35,224,8,36,32,35,0,43,32,44,
+    96,34,224,35,32,36,0,36,0,43,64,1,25,224,36,0,139,35,224,8,36,0,35,160,26,64,43,128,26,96,35,192,36,0,36,0,43,64,1,25,224,36,0,140,35,224,7,36,
+    0,35,128,35,0,35,160,36,0,35,224,36,0,43,64,1,25,224,36,0,141,35,224,130,36,0,129,35,224,1,36,0,43,64,2,25,224,36,0,35,224,140,36,0,130,35,224,3,
+    36,0,35,224,36,0,43,64,0,25,192,147,51,224,1,52,0,59,64,1,0,64,16,224,146,24,224,1,25,0,24,192,
+    // scale_0_off
+    82,76,23,0,15,0,0,0,0,0,11,0,0,0,24,0,0,0,43,0,0,0,79,0,0,0,108,0,0,0,139,0,0,0,172,0,0,0,205,0,0,0,238,0,0,0,11,1,
+    0,0,38,1,0,0,69,1,0,0,82,1,0,0,108,1,0,0,0,24,224,147,74,64,1,74,96,57,192,1,114,225,237,163,146,229,99,1,237,163,188,162,1,122,225,245,99,139,
+    237,34,0,237,35,133,237,34,1,245,67,188,130,4,122,225,245,99,237,35,237,67,237,35,133,237,67,130,237,35,8,237,67,237,35,237,67,245,99,237,67,237,34,237,34,245,99,188,
+    130,3,122,225,245,99,237,35,237,67,138,237,35,7,237,67,220,226,179,226,220,194,237,67,237,34,245,99,188,130,3,122,225,245,99,237,35,237,67,137,237,35,8,237,67,220,194,122,
+    161,180,2,106,96,220,226,237,67,245,99,188,130,3,122,225,245,99,237,34,237,67,136,237,35,9,237,34,245,99,171,193,171,193,253,195,163,129,179,226,245,99,245,99,188,130,3,122,
+    225,245,99,237,34,237,67,136,237,35,9,237,34,245,99,155,129,180,2,253,131,171,193,171,225,245,99,245,99,188,130,3,122,225,237,99,237,35,237,67,136,237,35,9,237,34,245,99,
+    163,161,179,225,253,195,163,161,180,2,245,99,245,99,188,130,2,122,225,237,99,237,34,138,237,35,8,245,67,204,130,114,128,204,98,114,128,220,194,237,67,245,99,188,130,2,122,225,
+    245,99,237,34,139,237,35,7,237,67,204,130,163,129,212,162,237,67,237,34,245,99,188,130,1,122,225,237,99,136,237,35,0,237,34,130,237,35,7,237,34,237,67,245,99,237,67,237,
+    35,237,34,245,99,188,130,1,122,193,245,99,146,237,35,1,245,99,188,130,5,114,161,229,99,221,67,229,67,221,67,229,67,139,221,67,129,229,67,2,221,67,229,131,180,130,2,8,
+    128,41,192,49,192,130,49,160,9,49,192,41,160,49,160,49,192,49,160,49,160,49,192,49,160,49,160,41,160,130,49,160,130,49,192,0,33,64,
+    0,0,
+    // scale_500_on
+    82,76,24,0,15,0,0,0,0,0,13,0,0,0,26,0,0,0,43,0,0,0,83,0,0,0,130,0,0,0,179,0,0,0,228,0,0,0,21,1,0,0,68,1,0,0,115,1,
+    0,0,162,1,0,0,207,1,0,0,247,1,0,0,4,2,0,0,1,8,32,25,64,147,25,96,1,33,128,8,64,1,16,224,59,192,147,52,0,1,67,224,24,224,2,17,0,43,
+    192,36,0,145,35,224,2,36,0,51,192,16,192,2,17,0,43,192,36,0,130,35,224,4,36,0,44,0,44,0,36,0,35,224,130,36,0,129,35,224,129,36,0,130,35,224,2,36,
+    0,51,224,16,192,17,16,224,51,192,36,0,35,224,35,224,36,0,35,192,35,96,35,64,35,192,36,0,35,192,35,64,35,192,36,0,36,0,35,96,35,96,130,35,224,2,36,0,
+    51,224,16,192,23,40,224,75,224,28,0,43,224,35,224,36,0,34,192,18,160,27,64,35,192,35,224,26,96,35,32,26,64,35,192,35,32,34,192,34,224,34,224,36,0,35,224,36,
+    0,51,192,16,192,23,24,224,51,192,36,0,35,224,35,224,44,32,34,160,35,32,44,0,44,32,35,32,34,224,44,96,43,0,35,0,34,160,43,224,44,0,26,64,35,224,35,224,
+    36,0,51,224,16,192,23,16,224,43,192,36,0,35,224,35,224,36,0,35,96,42,224,26,96,35,128,27,32,35,0,36,32,51,64,42,192,42,192,43,224,43,224,34,128,35,192,36,
+    0,36,0,51,224,16,192,2,16,224,43,192,36,0,130,35,224,17,36,0,44,64,35,160,26,128,35,32,35,0,44,96,43,32,35,0,34,128,43,224,44,0,34,96,35,224,35,224,
+    36,0,51,224,16,192,2,16,224,43,192,36,0,130,35,224,17,35,96,35,128,26,192,35,32,35,192,26,64,43,128,26,96,35,192,26,224,35,0,35,0,34,192,36,0,35,224,36,
+    0,51,224,16,192,17,16,224,43,192,36,0,35,224,35,224,36,0,35,128,35,0,35,96,36,0,36,0,35,128,35,0,35,160,36,0,35,224,35,32,35,32,130,35,224,2,36,0,
+    51,224,16,192,2,16,224,43,192,36,0,130,35,224,11,36,0,44,0,36,0,35,224,35,224,36,0,44,0,36,0,35,224,35,224,36,0,36,0,130,35,224,2,36,0,51,192,16,
+    192,5,17,0,43,192,36,0,35,224,36,0,36,0,130,35,224,129,36,0,130,35,224,129,36,0,129,35,224,129,36,0,3,35,224,36,0,51,224,16,192,1,25,0,59,192,147,51,
+    224,1,59,192,8,160,0,8,32,148,24,224,1,16,224,0,0,
+    0,0,0,
+    // scale_500_off
+    82,76,24,0,15,0,0,0,0,0,17,0,0,0,34,0,0,0,63,0,0,0,112,0,0,0,161,0,0,0,210,0,0,0,3,1,0,0,52,1,0,0,99,1,0,0,146,1,
+    0,0,195,1,0,0,238,1,0,0,5,2,0,0,32,2,0,0,2,0,32,66,32,74,96,145,74,64,2,74,96,66,32,0,32,2,41,32,213,67,237,99,145,229,99,2,237,99,
+    221,99,41,128,1,41,64,221,34,130,237,35,2,237,34,237,35,237,35,137,237,34,129,237,35,129,237,34,1,221,67,41,128,23,41,64,221,34,237,67,237,35,237,67,237,35,237,67,
+    245,99,245,99,237,67,237,35,237,67,245,99,237,67,237,35,237,67,245,99,245,99,237,67,237,35,237,35,237,67,221,67,41,128,23,41,64,221,34,237,67,237,35,237,35,237,67,220,
+    226,196,98,196,66,220,226,245,67,220,226,180,2,212,194,237,67,237,67,196,98,188,34,237,34,237,67,237,35,237,67,221,67,41,128,23,41,64,221,35,237,67,237,35,237,35,245,99,
+    155,97,147,33,179,225,212,194,229,2,114,161,180,2,106,96,220,226,179,225,147,65,155,97,155,97,245,67,237,35,237,66,221,67,41,128,23,41,64,221,35,237,67,237,35,237,34,245,
+    99,147,65,179,226,237,67,253,131,179,226,163,161,253,195,171,193,163,161,139,1,229,34,237,67,114,128,229,2,237,67,237,67,221,67,41,128,23,41,64,221,34,237,67,237,34,237,35,
+    237,67,188,66,147,33,106,96,196,98,180,2,171,193,253,131,188,34,147,33,139,1,229,2,237,34,122,193,220,226,237,67,237,34,221,67,41,128,2,41,64,221,35,237,67,130,237,35,
+    17,245,99,253,163,212,194,130,225,180,2,171,193,253,195,179,225,163,161,139,1,237,35,237,67,122,161,229,2,237,67,237,67,221,67,41,128,2,41,64,221,34,237,67,130,237,35,17,
+    188,34,204,98,147,65,171,193,220,226,106,64,204,98,114,128,220,226,155,97,163,161,171,193,147,65,245,67,237,35,237,66,221,67,41,128,23,41,64,221,34,237,67,237,35,237,35,237,
+    67,204,98,163,129,188,34,237,35,237,67,204,130,163,129,204,130,245,67,229,2,171,226,179,226,229,35,237,67,237,35,237,66,221,67,41,128,2,41,64,221,34,237,67,130,237,35,130,
+    245,99,129,237,35,12,237,67,245,99,237,67,237,34,237,67,245,99,245,99,237,67,237,35,237,35,237,67,221,67,41,128,2,41,64,221,35,245,35,134,237,35,0,237,67,137,237,35,
+    2,245,35,221,67,41,128,7,41,64,213,35,229,99,221,67,229,67,221,67,221,67,229,67,140,221,67,2,229,67,213,67,41,96,1,0,32,41,128,130,49,192,7,41,192,49,160,49,
+    160,49,192,49,160,41,160,41,192,49,192,130,49,160,7,41,160,41,192,49,160,49,192,49,160,49,192,41,128,0,0,
+    0,
+    // scale_1000_on
+    82,76,23,0,15,0,0,0,0,0,9,0,0,0,22,0,0,0,35,0,0,0,77,0,0,0,124,0,0,0,171,0,0,0,218,0,0,0,9,1,0,0,56,1,0,0,103,1,
+    0,0,150,1,0,0,195,1,0,0,232,1,0,0,245,1,0,0,0,9,0,148,25,96,0,33,32,1,35,32,52,32,146,52,0,1,52,32,59,64,1,27,64,36,0,146,35,224,
+    1,36,0,35,64,11,27,64,44,0,35,224,35,224,36,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,130,36,0,129,35,224,129,36,0,129,35,224,1,36,0,43,64,22,
+    27,64,36,0,35,224,36,0,35,160,35,224,35,224,36,0,35,128,35,96,35,224,36,0,35,192,35,64,35,160,36,0,36,0,35,128,35,96,35,224,35,224,36,0,43,64,22,27,
+    64,36,0,35,224,35,32,17,128,35,128,44,32,35,32,34,192,34,224,34,192,36,0,34,96,35,64,26,64,35,192,35,64,34,192,34,224,26,192,36,0,36,0,43,64,22,27,64,
+    36,0,35,224,35,224,26,160,35,128,36,32,34,96,43,224,44,0,26,128,35,32,34,224,44,96,43,32,35,0,34,160,43,192,44,32,34,64,35,192,36,32,43,64,22,27,64,36,
+    0,35,224,44,32,26,128,35,128,44,0,42,96,43,224,35,224,34,192,26,192,27,0,44,32,35,64,34,192,42,192,43,192,44,0,42,128,35,160,36,32,43,64,22,27,64,36,0,
+    35,224,44,32,34,192,35,160,44,32,34,96,43,224,36,0,34,160,35,0,34,224,44,64,43,64,35,0,34,160,43,224,44,32,34,96,35,192,36,32,43,64,22,27,64,36,0,35,
+    224,35,160,26,0,26,224,44,0,26,224,34,224,35,32,34,192,35,224,26,64,43,128,26,96,35,192,35,0,34,224,35,32,34,160,36,0,36,0,43,64,22,27,64,36,0,35,224,
+    35,64,27,32,27,32,35,192,36,0,35,32,35,32,35,224,36,0,35,160,35,0,35,128,36,0,35,224,35,64,35,32,35,224,35,224,36,0,43,64,2,27,64,44,0,35,224,130,
+    44,0,16,36,0,35,224,36,0,36,0,35,224,35,224,36,0,44,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,36,0,43,32,1,27,64,36,0,132,35,224,4,36,0,
+    35,224,35,224,36,0,36,0,130,35,224,129,36,0,129,35,224,3,36,0,35,224,36,32,43,64,1,35,32,52,0,146,51,224,1,52,0,51,32,0,8,160,148,24,224,0,16,160,
+    // scale_1000_off
+    82,76,23,0,15,0,0,0,0,0,13,0,0,0,26,0,0,0,45,0,0,0,92,0,0,0,139,0,0,0,186,0,0,0,233,0,0,0,24,1,0,0,71,1,0,0,118,1,
+    0,0,165,1,0,0,210,1,0,0,223,1,0,0,4,2,0,0,1,57,192,74,96,146,74,64,1,74,96,57,192,1,196,162,237,131,146,229,99,1,237,163,180,130,1,196,130,245,
+    67,140,237,34,130,237,35,130,237,34,1,245,99,188,98,22,196,130,245,99,237,35,237,35,245,67,237,67,237,35,237,35,245,99,245,99,237,67,237,35,237,67,245,99,237,67,237,35,
+    237,35,245,99,245,99,237,67,237,35,245,99,188,98,22,196,130,245,99,237,35,237,67,204,130,229,2,237,67,237,67,196,98,188,34,237,34,237,67,220,226,180,2,212,162,237,67,237,
+    67,204,98,188,34,237,35,237,35,245,99,188,98,22,196,130,245,99,237,35,171,193,40,224,204,130,245,131,179,225,147,65,163,129,147,65,237,35,122,161,180,2,106,96,220,194,188,2,
+    147,33,163,129,147,33,237,67,245,99,180,98,22,196,130,245,99,229,2,229,2,147,33,204,130,245,99,114,129,229,2,245,99,130,225,171,193,163,129,253,195,180,2,163,129,139,33,220,
+    226,245,99,114,128,220,226,245,99,188,98,22,196,130,245,99,237,35,245,99,139,1,204,130,237,35,122,161,229,2,237,35,147,65,155,129,171,225,245,131,196,66,147,33,139,1,220,226,
+    237,67,130,193,212,194,245,131,188,98,22,196,130,245,99,237,35,245,131,147,65,212,162,245,99,114,96,229,2,245,99,139,1,171,161,163,161,253,195,188,2,163,129,139,1,229,2,245,
+    99,122,161,220,226,245,99,188,98,22,196,130,245,99,237,34,212,162,106,64,163,129,237,35,155,97,163,129,179,226,147,65,220,226,106,64,204,98,114,161,220,194,163,161,155,129,179,226,
+    139,33,237,67,245,99,188,98,22,196,130,245,99,237,34,188,34,188,34,180,2,220,194,237,35,179,226,171,193,229,2,245,67,212,162,163,129,204,130,245,67,229,35,179,226,171,193,229,
+    2,237,35,245,99,180,98,2,196,130,245,99,237,35,130,245,99,16,237,67,237,35,245,99,245,99,237,67,237,35,237,67,245,99,237,67,237,35,237,67,245,99,245,99,237,67,237,35,
+    245,99,180,98,1,204,130,245,99,146,237,35,1,245,99,188,98,4,188,130,229,99,221,67,221,67,229,67,133,221,67,6,229,67,221,67,221,67,229,67,221,67,229,67,229,67,130,221,
+    67,1,229,131,172,98,5,33,64,49,192,49,160,49,192,49,192,41,160,133,49,192,5,41,192,41,160,49,160,49,160,41,160,41,160,130,49,160,1,49,192,33,32,
+    0,
+    // scale_1500_on
+    82,76,24,0,15,0,0,0,0,0,13,0,0,0,26,0,0,0,39,0,0,0,80,0,0,0,125,0,0,0,174,0,0,0,223,0,0,0,16,1,0,0,65,1,0,0,114,1,
+    0,0,163,1,0,0,207,1,0,0,243,1,0,0,0,2,0,0,1,8,64,33,96,147,25,96,1,33,96,16,96,1,25,64,59,224,147,52,0,1,59,224,25,96,2,17,64,43,
+    224,36,0,147,35,224,0,1,96,7,17,64,43,224,36,0,35,224,35,224,36,0,35,224,35,224,130,36,0,129,35,224,129,36,0,130,35,224,129,36,0,3,35,224,36,0,35,224,
+    9,96,4,17,64,43,224,35,224,36,0,36,0,130,35,224,6,35,192,35,160,35,160,35,224,36,0,35,192,35,160,130,36,0,5,35,160,35,224,36,0,35,224,35,224,9,96,23,
+    17,64,43,224,36,0,35,192,26,128,26,128,44,0,35,224,18,32,26,192,27,0,36,0,35,128,34,160,34,160,35,0,44,0,34,160,34,192,26,96,35,192,36,0,35,224,9,96,
+    23,17,64,43,224,36,0,35,192,35,64,26,128,44,0,35,192,26,32,44,0,36,32,36,0,26,128,35,160,44,0,34,96,35,96,34,160,44,64,35,0,34,224,36,32,35,224,9,
+    96,23,17,64,43,224,35,224,36,0,35,160,26,96,44,0,35,224,34,160,42,160,26,192,35,224,34,128,43,192,44,0,42,192,42,224,43,0,44,32,35,96,26,192,36,32,35,224,
+    9,96,23,17,64,43,224,35,224,36,0,35,160,26,128,44,0,35,224,44,0,44,32,26,128,35,64,34,160,43,192,44,0,42,160,35,0,43,0,44,64,35,64,34,192,36,32,35,
+    224,9,96,23,17,64,43,224,36,0,35,224,27,64,18,0,35,224,35,192,35,128,35,192,26,96,35,160,34,192,35,32,35,128,34,128,35,192,26,64,43,224,34,160,35,96,36,0,
+    35,224,9,96,23,17,64,43,224,36,0,35,160,26,192,26,160,27,32,35,224,34,224,34,192,35,96,36,0,35,192,34,224,34,192,35,192,36,0,35,96,34,160,35,64,36,0,35,
+    224,35,224,9,96,16,17,64,43,224,35,224,36,0,44,0,44,0,36,0,36,0,44,0,44,0,36,0,35,224,36,0,44,0,44,0,36,0,35,224,130,36,0,130,35,224,0,9,
+    96,2,17,64,43,224,36,0,131,35,224,0,36,0,130,35,224,0,36,0,131,35,224,0,36,0,130,35,224,129,36,0,1,35,224,9,96,1,25,32,59,192,147,51,224,1,51,192,
+    9,96,0,8,32,148,24,224,1,16,224,0,32,
+    0,0,0,
+    // scale_1500_off
+    82,76,24,0,15,0,0,0,0,0,15,0,0,0,30,0,0,0,65,0,0,0,108,0,0,0,157,0,0,0,206,0,0,0,255,0,0,0,48,1,0,0,97,1,0,0,146,1,
+    0,0,195,1,0,0,244,1,0,0,3,2,0,0,30,2,0,0,2,8,96,66,64,74,96,146,74,64,1,74,32,16,128,2,65,160,221,99,237,99,146,229,99,1,221,67,73,192,
+    2,65,160,229,35,237,35,130,237,34,130,237,35,129,237,34,0,237,35,132,237,34,0,237,35,130,237,34,2,237,35,229,35,73,192,6,57,160,229,67,237,67,237,35,237,35,237,67,
+    237,35,132,237,67,11,237,35,237,67,237,67,237,35,237,35,237,67,245,99,237,67,237,35,237,67,229,67,73,192,23,57,160,229,67,237,35,237,67,237,67,229,2,237,67,237,35,229,
+    2,220,194,220,226,237,35,237,67,220,226,212,162,237,67,237,67,237,35,204,130,229,2,237,67,237,35,229,67,73,192,23,57,160,221,67,245,67,220,226,122,193,130,225,245,67,229,2,
+    114,96,147,65,163,129,237,67,196,98,130,225,139,1,163,161,237,67,147,33,155,65,122,161,220,194,245,67,229,35,73,192,23,57,160,221,67,245,67,212,194,188,34,139,1,245,67,229,
+    2,114,128,237,35,245,99,245,67,122,193,220,194,237,67,122,193,188,34,139,33,253,163,171,193,163,129,245,99,229,35,73,192,23,57,160,229,67,237,35,245,99,220,226,130,225,237,67,
+    229,2,130,225,130,193,155,65,229,2,122,193,220,226,237,67,147,33,147,65,171,193,253,131,196,66,155,97,245,99,229,35,73,192,23,57,160,229,67,237,35,237,67,220,194,139,1,245,
+    99,237,67,237,67,245,99,139,1,188,2,139,1,229,2,245,99,147,33,163,129,171,161,253,163,196,66,155,97,245,99,229,35,73,192,23,57,160,229,67,237,67,229,34,196,66,106,64,
+    229,2,220,226,212,162,220,226,114,129,212,162,155,65,180,2,204,130,130,225,212,194,106,96,229,2,139,1,196,66,245,99,229,67,73,192,23,57,160,229,35,245,67,212,162,155,97,155,
+    97,180,2,220,226,155,97,139,1,188,34,245,99,220,226,155,65,147,33,220,194,245,99,188,34,139,1,180,2,237,67,237,35,229,67,73,192,23,57,160,229,67,237,67,237,67,245,99,
+    245,99,237,67,237,67,245,67,237,67,245,99,237,35,237,67,245,99,237,67,237,67,237,35,245,67,237,67,245,99,237,35,237,67,229,67,73,192,2,57,160,229,67,245,67,146,237,35,
+    1,229,35,73,192,4,57,128,213,67,229,67,221,67,229,67,135,221,67,129,229,67,133,221,67,2,229,67,221,67,65,192,10,0,32,41,128,49,192,49,160,41,160,49,160,49,160,49,
+    192,49,160,49,160,49,192,132,49,160,7,41,160,49,192,49,160,41,160,49,160,49,192,41,160,8,64,
+    0,
+    // scale_2000_on
+    82,76,23,0,15,0,0,0,0,0,13,0,0,0,26,0,0,0,39,0,0,0,76,0,0,0,123,0,0,0,170,0,0,0,217,0,0,0,8,1,0,0,55,1,0,0,102,1,
+    0,0,149,1,0,0,194,1,0,0,229,1,0,0,242,1,0,0,1,17,0,25,128,146,25,96,1,33,128,24,224,1,59,0,52,32,146,52,0,1,60,32,50,96,1,59,0,36,
+    32,146,35,224,1,44,0,34,32,4,59,0,44,32,35,224,36,0,36,0,130,35,224,129,36,0,129,35,224,129,36,0,130,35,224,129,36,0,129,35,224,1,44,0,34,64,22,51,
+    0,44,32,35,224,35,160,35,192,36,0,35,224,36,0,35,160,35,224,36,0,36,0,35,192,35,160,36,0,35,224,36,0,35,160,35,224,36,0,35,224,44,0,26,32,22,51,0,
+    44,32,35,96,26,192,26,64,35,64,44,0,34,192,34,192,26,96,35,192,35,160,34,128,34,160,26,224,36,0,26,192,34,192,34,96,35,160,36,0,44,0,26,64,22,59,0,44,
+    32,35,192,36,32,43,128,34,160,35,160,34,128,44,64,35,32,35,0,34,192,43,128,44,32,34,96,35,96,26,128,44,64,35,32,34,224,36,0,52,0,42,64,22,51,0,44,32,
+    35,224,36,32,34,224,35,96,43,96,42,224,36,32,43,96,34,192,26,160,35,160,36,0,26,192,26,224,35,0,36,32,43,128,42,192,36,0,52,0,50,64,22,51,0,44,0,36,
+    0,35,128,26,192,44,32,35,64,42,192,44,64,43,96,34,224,34,160,35,192,44,32,34,160,35,0,34,224,36,64,43,96,34,192,36,0,52,0,42,64,22,59,0,44,32,35,96,
+    26,0,35,160,35,192,35,160,26,32,43,192,34,160,35,128,34,224,35,0,35,160,34,128,35,192,34,32,43,192,34,160,35,64,36,0,52,0,50,64,22,51,0,44,32,27,32,26,
+    192,26,224,35,0,44,0,35,96,34,160,35,32,36,0,35,224,34,224,34,192,35,160,36,0,35,96,34,160,35,32,36,0,35,224,52,32,50,64,6,51,0,44,32,36,0,44,0,
+    44,0,36,0,35,224,130,36,0,12,35,224,36,0,44,0,44,0,36,0,35,224,36,0,44,0,36,0,35,224,35,224,44,0,34,64,1,43,0,36,32,131,35,224,0,36,0,130,
+    35,224,129,36,0,130,35,224,0,36,0,130,35,224,3,36,0,35,224,44,0,34,64,1,42,224,52,0,146,51,224,1,60,0,42,32,1,16,160,25,0,147,24,224,0,8,96,
+    0,
+    // scale_2000_off
+    82,76,23,0,15,0,0,0,0,0,13,0,0,0,28,0,0,0,51,0,0,0,98,0,0,0,141,0,0,0,188,0,0,0,235,0,0,0,26,1,0,0,73,1,0,0,120,1,
+    0,0,167,1,0,0,214,1,0,0,227,1,0,0,246,1,0,0,1,49,160,74,128,146,74,64,1,74,96,33,32,1,172,98,237,163,145,229,99,2,229,67,237,163,131,97,1,172,
+    66,245,99,131,237,34,0,237,35,139,237,34,3,237,35,237,34,245,99,131,97,22,172,66,245,99,237,35,237,67,237,67,237,35,237,35,237,66,245,99,237,67,237,35,237,35,237,67,
+    245,99,237,67,237,35,237,67,245,99,237,67,237,35,237,35,237,131,131,97,4,172,66,245,99,237,35,212,194,220,194,130,237,67,5,212,130,229,2,237,67,237,67,220,226,212,162,130,
+    237,67,5,212,162,229,2,237,67,237,34,237,131,131,97,22,172,66,245,131,188,34,147,33,114,96,188,2,245,99,147,33,147,65,114,129,220,226,204,130,130,225,139,33,163,129,245,67,
+    147,33,147,65,122,161,212,194,237,67,237,99,131,65,22,172,66,245,99,229,2,245,99,204,130,139,1,212,162,130,193,253,163,179,226,163,161,147,65,212,162,245,99,122,193,188,34,139,
+    1,253,163,180,2,155,97,245,99,237,99,131,97,22,172,66,245,99,237,34,245,99,155,97,188,66,196,66,155,97,253,131,196,98,147,65,147,33,220,226,245,67,155,97,155,97,163,161,
+    245,131,196,98,139,33,245,67,237,99,131,97,22,172,66,237,99,245,99,196,98,147,33,253,131,188,34,155,97,253,163,196,66,155,97,139,33,220,226,245,99,147,65,163,129,163,129,253,
+    163,196,98,147,65,245,67,237,99,131,97,22,172,66,245,131,196,66,81,224,212,162,229,2,212,194,106,64,229,2,139,1,196,98,163,129,171,193,212,162,130,193,220,194,106,96,229,2,
+    139,33,188,34,245,67,237,99,131,97,22,172,66,245,131,180,2,155,97,163,161,171,193,237,67,196,66,139,1,179,225,237,67,229,2,155,97,147,33,212,194,245,99,196,66,139,1,171,
+    226,237,67,237,34,237,99,131,97,22,172,66,237,99,237,67,245,99,237,67,245,67,237,35,245,67,237,67,245,99,237,35,237,67,245,99,245,67,237,67,237,35,245,67,237,67,245,99,
+    237,67,237,34,237,99,131,65,1,172,66,245,99,146,237,35,1,245,99,131,97,1,164,34,229,131,134,221,67,0,229,67,138,221,67,1,229,131,123,65,11,25,32,49,192,41,160,41,
+    192,41,160,49,160,49,160,49,192,49,192,49,160,49,160,49,192,130,49,160,129,49,192,129,49,160,3,41,192,41,160,49,160,16,160,
+    0,
+    // scale_2500_on
+    82,76,24,0,15,0,0,0,0,0,11,0,0,0,24,0,0,0,39,0,0,0,83,0,0,0,132,0,0,0,181,0,0,0,230,0,0,0,23,1,0,0,72,1,0,0,121,1,
+    0,0,170,1,0,0,211,1,0,0,248,1,0,0,7,2,0,0,0,8,160,148,25,96,1,25,64,0,0,1,26,96,52,32,147,52,0,1,51,160,24,128,1,18,64,36,0,146,
+    35,224,2,36,0,43,160,24,96,11,18,64,44,0,35,224,36,0,44,0,36,0,35,224,36,0,44,0,44,0,36,0,35,224,130,36,0,129,35,224,129,36,0,129,35,224,2,36,
+    0,59,192,32,64,23,18,64,36,0,35,224,35,160,35,64,35,192,36,0,35,192,35,96,35,64,35,160,36,0,35,224,35,64,35,160,36,0,36,0,35,128,35,64,35,224,35,224,
+    36,0,59,192,32,96,23,18,64,36,0,35,224,35,0,27,0,26,32,36,0,27,32,18,96,27,64,35,128,36,0,26,128,35,32,26,64,35,160,35,96,34,160,35,0,34,160,44,
+    0,36,0,59,192,32,96,23,18,96,36,0,35,224,36,0,44,64,26,96,35,192,27,0,34,192,44,0,36,32,35,96,34,160,44,64,43,64,34,224,34,192,43,160,36,32,26,64,
+    35,192,36,0,59,192,32,96,23,18,96,36,0,35,224,36,0,35,128,26,128,36,0,35,128,42,192,26,96,35,64,35,96,42,224,36,32,43,96,42,192,42,160,43,192,36,0,34,
+    128,35,160,36,0,59,192,32,96,23,18,96,36,0,36,0,35,224,26,160,35,224,36,0,36,0,44,64,35,224,26,96,35,96,34,192,44,64,43,64,34,224,34,160,43,192,44,32,
+    34,96,35,192,36,0,59,192,32,96,23,18,64,36,0,35,224,17,192,26,224,35,96,35,192,35,128,35,96,34,224,34,224,43,224,26,64,43,96,34,96,35,160,35,32,34,192,35,
+    64,34,160,36,0,36,0,59,192,32,96,23,18,64,36,0,35,192,27,32,27,64,27,0,35,192,35,160,35,0,35,64,35,224,36,0,35,160,35,0,35,128,36,0,35,224,35,64,
+    35,32,35,224,35,224,36,0,59,192,32,96,2,18,64,44,0,35,224,130,44,0,131,36,0,129,35,224,11,36,0,44,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,36,
+    0,59,192,32,96,1,18,96,36,0,131,35,224,0,36,0,130,35,224,129,36,0,130,35,224,129,36,0,129,35,224,4,36,0,35,224,28,0,59,192,32,96,1,26,64,52,0,146,
+    51,224,2,52,0,59,160,32,96,1,8,96,25,0,146,24,224,2,25,0,16,192,0,0,
+    // scale_2500_off
+    82,76,24,0,15,0,0,0,0,0,15,0,0,0,32,0,0,0,73,0,0,0,122,0,0,0,171,0,0,0,220,0,0,0,13,1,0,0,62,1,0,0,111,1,0,0,160,1,
+    0,0,209,1,0,0,254,1,0,0,13,2,0,0,40,2,0,0,1,33,64,74,96,146,74,64,2,74,96,66,0,0,0,2,139,161,237,163,229,67,145,229,99,2,237,131,213,35,
+    0,128,2,147,129,245,99,237,2,131,237,34,0,237,35,131,237,34,11,237,35,237,34,237,34,237,35,237,35,237,34,237,34,237,35,237,35,245,35,213,2,0,192,23,147,161,245,131,
+    237,34,237,67,245,99,237,67,237,34,237,67,245,99,245,99,237,67,237,34,237,67,245,99,237,67,237,35,237,35,245,99,245,99,237,67,237,35,237,67,213,34,0,192,23,147,129,245,
+    131,237,35,212,162,180,2,220,194,245,67,228,226,196,98,196,66,220,194,245,67,229,2,180,2,212,162,237,67,237,67,204,130,188,2,229,34,237,67,237,67,213,34,0,192,23,147,129,
+    245,131,228,226,163,129,171,193,106,64,237,35,180,2,122,161,179,226,204,130,237,35,122,161,179,226,114,96,212,162,196,66,139,1,163,161,139,1,237,67,237,67,213,34,0,192,23,147,
+    129,245,131,237,34,237,67,253,131,130,193,220,226,179,225,155,97,237,67,253,131,196,66,147,33,253,195,188,34,155,129,147,33,220,194,253,131,122,161,220,194,245,67,213,34,0,192,23,
+    147,129,245,131,229,34,245,99,204,130,122,193,245,99,204,130,147,33,114,129,188,2,196,66,155,97,245,131,196,98,139,33,139,1,220,194,245,67,139,1,212,194,245,99,213,34,0,192,
+    23,147,161,245,99,237,67,228,226,130,225,229,3,245,67,245,99,253,163,229,2,114,129,188,34,155,97,253,195,188,66,155,129,139,33,220,226,253,131,122,193,220,194,245,67,213,34,0,
+    192,23,147,129,245,131,229,2,73,128,163,129,204,98,220,226,196,66,196,66,163,129,155,97,229,2,106,64,196,98,122,161,212,162,171,193,155,65,188,2,138,225,237,67,237,67,213,34,
+    0,192,23,147,129,245,131,220,226,188,34,188,34,179,225,220,226,212,162,163,161,180,2,229,34,245,67,212,162,163,129,204,98,237,67,237,35,180,2,171,193,229,2,237,67,237,67,213,
+    34,0,192,2,147,129,245,99,237,35,130,245,99,129,237,67,129,245,99,13,237,67,237,35,237,67,245,99,245,67,237,35,237,67,245,99,245,99,237,67,237,35,237,67,213,34,0,192,
+    1,147,129,245,99,146,237,35,2,245,67,221,34,0,192,1,139,129,229,131,134,221,67,0,229,67,134,221,67,0,229,67,130,221,67,2,229,99,205,35,0,128,11,16,192,49,192,49,
+    160,41,160,49,160,49,160,49,192,49,192,49,160,49,160,49,192,49,192,131,49,160,131,49,192,3,41,160,49,192,41,128,0,0,
+};
+
+static_assert(sizeof(asset_data) == asset_data_size, "asset_data does not match the asset table");
+#endif
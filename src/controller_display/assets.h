@@ -0,0 +1,245 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+// Generated by tools/asset_compiler.py from assets/manifest.json, do not edit.
+
+#ifndef _ASSETS_H_
+#define _ASSETS_H_
+
+#include "Arduino.h"
+#include "../display_spi/mcu_spi_magic.h"
+#include "asset_pack.h"
+
+#define ASSET_ALIGN 4
+
+/**
+ * @brief Placement and location of a compiled image
+ */
+struct asset_info {
+    uint32_t offset;    // of the rle565 image in asset_data
+    uint32_t size;      // of the rle565 image in bytes
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+/**
+ * @brief Identifies the compiled images
+ */
+enum asset_id : uint8_t {
+    ASSET_BACKGROUND_LCARS,
+    ASSET_BACKGROUND_EMS,
+    ASSET_ENGINE_ON,
+    ASSET_ENGINE_OFF,
+    ASSET_POWER_ON,
+    ASSET_POWER_OFF,
+    ASSET_FORWARD_ON,
+    ASSET_FORWARD_OFF,
+    ASSET_NEUTRAL_ON,
+    ASSET_NEUTRAL_OFF,
+    ASSET_BACKWARD_ON,
+    ASSET_BACKWARD_OFF,
+    ASSET_WARNING_OFF,
+    ASSET_WARNING_PENDING_ENGINE,
+    ASSET_LUBE_ON,
+    ASSET_LUBE_OFF,
+    ASSET_BACKLIGHT_ON,
+    ASSET_BACKLIGHT_OFF,
+    ASSET_LIGHT_ON,
+    ASSET_LIGHT_OFF,
+    ASSET_DIGIT_0,
+    ASSET_DIGIT_1,
+    ASSET_DIGIT_2,
+    ASSET_DIGIT_3,
+    ASSET_DIGIT_4,
+    ASSET_DIGIT_5,
+    ASSET_DIGIT_6,
+    ASSET_DIGIT_7,
+    ASSET_DIGIT_8,
+    ASSET_DIGIT_9,
+    ASSET_SCALE_0_ON,
+    ASSET_SCALE_0_OFF,
+    ASSET_SCALE_500_ON,
+    ASSET_SCALE_500_OFF,
+    ASSET_SCALE_1000_ON,
+    ASSET_SCALE_1000_OFF,
+    ASSET_SCALE_1500_ON,
+    ASSET_SCALE_1500_OFF,
+    ASSET_SCALE_2000_ON,
+    ASSET_SCALE_2000_OFF,
+    ASSET_SCALE_2500_ON,
+    ASSET_SCALE_2500_OFF,
+    ASSET_COUNT
+};
+
+constexpr uint32_t asset_data_size = 131746;
+constexpr asset_info asset_table[ASSET_COUNT] = {
+    {      0, 34368,   0,   0, 240, 320 },    // background_lcars from layout.png
+    {  34368, 30264,   0,   0, 240, 320 },    // background_ems from EMS.png
+    {  64632,  3488,  78, 142,  85, 127 },    // engine_on from engine-on.png
+    {  68120,  3818,  78, 142,  85, 127 },    // engine_off from engine-off.png
+    {  71940,  1855,  78, 142,  51,  55 },    // power_on from power-on.png
+    {  73796,  1829,  78, 142,  51,  55 },    // power_off from power-off.png
+    {  75628,  1734, 166, 142,  68,  46 },    // forward_on from forward-on.png
+    {  77364,  1793, 166, 142,  68,  46 },    // forward_off from forward-off.png
+    {  79160,   703, 166, 190,  68,  31 },    // neutral_on from neutral-on.png
+    {  79864,   761, 166, 190,  68,  31 },    // neutral_off from neutral-off.png
+    {  80628,  1721, 166, 224,  68,  45 },    // backward_on from backward-on.png
+    {  82352,  1880, 166, 224,  68,  45 },    // backward_off from backward-off.png
+    {  84232,  3642,   4, 140,  71, 177 },    // warning_off from warning-off.png
+    {  87876,  8000,   4, 140,  71, 177 },    // warning_pending_engine from warning-pending-engine.png
+    {  95876,  2040,  78, 271,  68,  47 },    // lube_on from lube-on.png
+    {  97916,  2215,  78, 271,  68,  47 },    // lube_off from lube-off.png
+    { 100132,  1158, 147, 271,  44,  47 },    // backlight_on from backlight-on.png
+    { 101292,  1163, 147, 271,  44,  47 },    // backlight_off from backlight-off.png
+    { 102456,  1319, 191, 271,  44,  47 },    // light_on from light-on.png
+    { 103776,  1371, 191, 271,  44,  47 },    // light_off from light-off.png
+    { 105148,  2286,  96,  48,  31,  70 },    // digit_0 from 0.png
+    { 107436,  1500,  96,  48,  31,  70 },    // digit_1 from 1.png
+    { 108936,  1677,  96,  48,  31,  70 },    // digit_2 from 2.png
+    { 110616,  2115,  96,  48,  31,  70 },    // digit_3 from 3.png
+    { 112732,  1930,  96,  48,  31,  70 },    // digit_4 from 4.png
+    { 114664,  2014,  96,  48,  31,  70 },    // digit_5 from 5.png
+    { 116680,  2056,  96,  48,  31,  70 },    // digit_6 from 6.png
+    { 118736,  1512,  96,  48,  31,  70 },    // digit_7 from 7.png
+    { 120248,  2380,  96,  48,  31,  70 },    // digit_8 from 8.png
+    { 122628,  2137,  96,  48,  31,  70 },    // digit_9 from 9.png
+    { 124768,   368,  75, 124,  23,  15 },    // scale_0_on from scales_0_g.png
+    { 125136,   470,  75, 124,  23,  15 },    // scale_0_off from scales_0_y.png
+    { 125608,   593,  99, 124,  24,  15 },    // scale_500_on from scales_500_g.png
+    { 126204,   655,  99, 124,  24,  15 },    // scale_500_off from scales_500_y.png
+    { 126860,   576, 124, 124,  23,  15 },    // scale_1000_on from scales_1000_g.png
+    { 127436,   619, 124, 124,  23,  15 },    // scale_1000_off from scales_1000_y.png
+    { 128056,   589, 148, 124,  24,  15 },    // scale_1500_on from scales_1500_g.png
+    { 128648,   651, 148, 124,  24,  15 },    // scale_1500_off from scales_1500_y.png
+    { 129300,   575, 173, 124,  23,  15 },    // scale_2000_on from scales_2000_g.png
+    { 129876,   611, 173, 124,  23,  15 },    // scale_2000_off from scales_2000_y.png
+    { 130488,   600, 197, 124,  24,  15 },    // scale_2500_on from scales_2500_g.png
+    { 131088,   658, 197, 124,  24,  15 },    // scale_2500_off from scales_2500_y.png
+};
+
+constexpr asset_id assets_digits[10] = { ASSET_DIGIT_0, ASSET_DIGIT_1, ASSET_DIGIT_2, ASSET_DIGIT_3, ASSET_DIGIT_4, ASSET_DIGIT_5, ASSET_DIGIT_6, ASSET_DIGIT_7, ASSET_DIGIT_8, ASSET_DIGIT_9 };
+constexpr asset_id assets_scales_on[6] = { ASSET_SCALE_0_ON, ASSET_SCALE_500_ON, ASSET_SCALE_1000_ON, ASSET_SCALE_1500_ON, ASSET_SCALE_2000_ON, ASSET_SCALE_2500_ON };
+constexpr asset_id assets_scales_off[6] = { ASSET_SCALE_0_OFF, ASSET_SCALE_500_OFF, ASSET_SCALE_1000_OFF, ASSET_SCALE_1500_OFF, ASSET_SCALE_2000_OFF, ASSET_SCALE_2500_OFF };
+
+#if ASSETS_IN_PARTITION
+/**
+ * @brief Makes the images available
+ * @returns True if the asset pack was loaded
+ */
+inline bool assets_begin() { return asset_pack_begin(); }
+
+/**
+ * @brief Gets a compiled image
+ * @param id - the image
+ * @returns The rle565 image, nullptr if the asset pack was not loaded
+ */
+inline const unsigned char* asset_image(asset_id id) { return asset_pack_image(id); }
+#else
+extern const unsigned char asset_data[] PROGMEM;
+
+/**
+ * @brief Makes the images available
+ * @returns True, the images are linked into the firmware
+ */
+inline bool assets_begin() { return true; }
+
+/**
+ * @brief Gets a compiled image
+ * @param id - the image
+ * @returns The rle565 image
+ */
+inline const unsigned char* asset_image(asset_id id) { return asset_data + asset_table[id].offset; }
+#endif
+
+/**
+ * @brief Checks that an image lies within the display and the packed data
+ */
+constexpr bool asset_is_valid(asset_id id)
+{
+    return asset_table[id].x >= 0 && asset_table[id].y >= 0 &&
+        asset_table[id].x + asset_table[id].w <= TFT_WIDTH && asset_table[id].y + asset_table[id].h <= TFT_HEIGHT &&
+        asset_table[id].offset % ASSET_ALIGN == 0 && asset_table[id].offset + asset_table[id].size <= asset_data_size;
+}
+
+/**
+ * @brief Checks that two images occupy the same screen region
+ */
+constexpr bool asset_same_area(asset_id a, asset_id b)
+{
+    return asset_table[a].x == asset_table[b].x && asset_table[a].y == asset_table[b].y &&
+        asset_table[a].w == asset_table[b].w && asset_table[a].h == asset_table[b].h;
+}
+
+static_assert(TFT_WIDTH == 240 && TFT_HEIGHT == 320, "assets were compiled for a 240x320 display");
+static_assert(asset_is_valid(ASSET_BACKGROUND_LCARS), "background_lcars is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_BACKGROUND_EMS), "background_ems is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_ENGINE_ON), "engine_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_ENGINE_OFF), "engine_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_POWER_ON), "power_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_POWER_OFF), "power_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_FORWARD_ON), "forward_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_FORWARD_OFF), "forward_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_NEUTRAL_ON), "neutral_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_NEUTRAL_OFF), "neutral_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_BACKWARD_ON), "backward_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_BACKWARD_OFF), "backward_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_WARNING_OFF), "warning_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_WARNING_PENDING_ENGINE), "warning_pending_engine is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_LUBE_ON), "lube_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_LUBE_OFF), "lube_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_BACKLIGHT_ON), "backlight_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_BACKLIGHT_OFF), "backlight_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_LIGHT_ON), "light_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_LIGHT_OFF), "light_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_0), "digit_0 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_1), "digit_1 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_2), "digit_2 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_3), "digit_3 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_4), "digit_4 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_5), "digit_5 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_6), "digit_6 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_7), "digit_7 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_8), "digit_8 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_DIGIT_9), "digit_9 is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_0_ON), "scale_0_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_0_OFF), "scale_0_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_500_ON), "scale_500_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_500_OFF), "scale_500_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_1000_ON), "scale_1000_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_1000_OFF), "scale_1000_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_1500_ON), "scale_1500_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_1500_OFF), "scale_1500_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_2000_ON), "scale_2000_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_2000_OFF), "scale_2000_off is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_2500_ON), "scale_2500_on is outside of the display or the asset data");
+static_assert(asset_is_valid(ASSET_SCALE_2500_OFF), "scale_2500_off is outside of the display or the asset data");
+
+static_assert(asset_same_area(ASSET_BACKGROUND_LCARS, ASSET_BACKGROUND_EMS), "background images differ in placement");
+static_assert(asset_same_area(ASSET_ENGINE_ON, ASSET_ENGINE_OFF), "engine images differ in placement");
+static_assert(asset_same_area(ASSET_POWER_ON, ASSET_POWER_OFF), "power images differ in placement");
+static_assert(asset_same_area(ASSET_FORWARD_ON, ASSET_FORWARD_OFF), "forward images differ in placement");
+static_assert(asset_same_area(ASSET_NEUTRAL_ON, ASSET_NEUTRAL_OFF), "neutral images differ in placement");
+static_assert(asset_same_area(ASSET_BACKWARD_ON, ASSET_BACKWARD_OFF), "backward images differ in placement");
+static_assert(asset_same_area(ASSET_WARNING_OFF, ASSET_WARNING_PENDING_ENGINE), "warning images differ in placement");
+static_assert(asset_same_area(ASSET_LUBE_ON, ASSET_LUBE_OFF), "lube images differ in placement");
+static_assert(asset_same_area(ASSET_BACKLIGHT_ON, ASSET_BACKLIGHT_OFF), "backlight images differ in placement");
+static_assert(asset_same_area(ASSET_LIGHT_ON, ASSET_LIGHT_OFF), "light images differ in placement");
+static_assert(asset_same_area(ASSET_DIGIT_0, ASSET_DIGIT_1), "digit images differ in placement");
+static_assert(asset_same_area(ASSET_DIGIT_0, ASSET_DIGIT_2), "digit images differ in placement");
+static_assert(asset_same_area(ASSET_DIGIT_0, ASSET_DIGIT_3), "digit images differ in placement");
+static_assert(asset_same_area(ASSET_DIGIT_0, ASSET_DIGIT_4), "digit images differ in placement");
+static_assert(asset_same_area(ASSET_DIGIT_0, ASSET_DIGIT_5), "digit images differ in placement");
+static_assert(asset_same_area(ASSET_DIGIT_0, ASSET_DIGIT_6), "digit images differ in placement");
+static_assert(asset_same_area(ASSET_DIGIT_0, ASSET_DIGIT_7), "digit images differ in placement");
+static_assert(asset_same_area(ASSET_DIGIT_0, ASSET_DIGIT_8), "digit images differ in placement");
+static_assert(asset_same_area(ASSET_DIGIT_0, ASSET_DIGIT_9), "digit images differ in placement");
+static_assert(asset_same_area(ASSET_SCALE_0_ON, ASSET_SCALE_0_OFF), "scale_0 images differ in placement");
+static_assert(asset_same_area(ASSET_SCALE_500_ON, ASSET_SCALE_500_OFF), "scale_500 images differ in placement");
+static_assert(asset_same_area(ASSET_SCALE_1000_ON, ASSET_SCALE_1000_OFF), "scale_1000 images differ in placement");
+static_assert(asset_same_area(ASSET_SCALE_1500_ON, ASSET_SCALE_1500_OFF), "scale_1500 images differ in placement");
+static_assert(asset_same_area(ASSET_SCALE_2000_ON, ASSET_SCALE_2000_OFF), "scale_2000 images differ in placement");
+static_assert(asset_same_area(ASSET_SCALE_2500_ON, ASSET_SCALE_2500_OFF), "scale_2500 images differ in placement");
+
+#endif
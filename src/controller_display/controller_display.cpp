@@ -3,18 +3,101 @@
 // IMPORTANT: LIBRARY MUST BE SPECIFICALLY CONFIGURED FOR EITHER TFT SHIELD
 // OR BREAKOUT BOARD USAGE.
 
-#include <SPI.h>
 #include "controller_display.h"
-#include "../logging/SerialLogger.h"
+#include "../logging/log.h"
 
-const unsigned int rpm_x = 220;
-const unsigned int rpm_y = 48;
+static const unsigned int speeds[SCALE_BARS] = { 100, 500, 1000, 1500, 2000, 2500 };
+    // upper end of each scale bar in RPM
+
+static const unsigned int digit_w = asset_table[ASSET_DIGIT_0].w;
+static const unsigned int digit_h = asset_table[ASSET_DIGIT_0].h;
+static const unsigned int rpm_x = asset_table[ASSET_DIGIT_0].x + RPM_DIGITS * digit_w;
+static const unsigned int rpm_y = asset_table[ASSET_DIGIT_0].y;
+    // the digit images are placed at the leftmost cell, the number is right aligned to rpm_x
+
+static_assert(sizeof(assets_digits) / sizeof(assets_digits[0]) == 10, "need an image for every digit");
+static_assert(sizeof(assets_scales_on) / sizeof(assets_scales_on[0]) == SCALE_BARS, "need an on image for every scale bar");
+static_assert(sizeof(assets_scales_off) / sizeof(assets_scales_off[0]) == SCALE_BARS, "need an off image for every scale bar");
+static_assert(rpm_x <= TFT_WIDTH, "rpm digits do not fit on the display");
+
+/**
+ * @brief Checks that the scale bars form a single row, left to right, so the fill level maps to columns
+ */
+static constexpr bool scales_in_row(int i = 1)
+{
+  return i >= SCALE_BARS ||
+    (asset_table[assets_scales_on[i]].x >= asset_table[assets_scales_on[i-1]].x + asset_table[assets_scales_on[i-1]].w &&
+     asset_table[assets_scales_on[i]].y == asset_table[assets_scales_on[0]].y &&
+     asset_table[assets_scales_on[i]].h == asset_table[assets_scales_on[0]].h && scales_in_row(i + 1));
+}
+static_assert(scales_in_row(), "scale bars must be in a row, left to right");
+
+/**
+ * @brief Creates a display_rect
+ */
+static display_rect make_rect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  display_rect r;
+  r.x = x; r.y = y; r.w = w; r.h = h;
+  return r;
+}
+
+/**
+ * @brief Checks whether two regions overlap
+ */
+static bool overlaps(const display_rect& a, const display_rect& b)
+{
+  return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+/**
+ * @brief Gets the intersection of two regions, the result is empty if they do not overlap
+ */
+static display_rect intersect(const display_rect& a, const display_rect& b)
+{
+  int16_t x1 = max(a.x, b.x), y1 = max(a.y, b.y);
+  int16_t x2 = min(a.x + a.w, b.x + b.w), y2 = min(a.y + a.h, b.y + b.h);
+  if(x2 <= x1 || y2 <= y1) return make_rect(0, 0, 0, 0);
+  return make_rect(x1, y1, x2 - x1, y2 - y1);
+}
+
+/**
+ * @brief Gets the bounding box of two regions
+ */
+static display_rect unite(const display_rect& a, const display_rect& b)
+{
+  int16_t x1 = min(a.x, b.x), y1 = min(a.y, b.y);
+  int16_t x2 = max(a.x + a.w, b.x + b.w), y2 = max(a.y + a.h, b.y + b.h);
+  return make_rect(x1, y1, x2 - x1, y2 - y1);
+}
+
+/**
+ * @brief Gets the screen region of a compiled image
+ */
+static display_rect asset_rect(asset_id id)
+{
+  return make_rect(asset_table[id].x, asset_table[id].y, asset_table[id].w, asset_table[id].h);
+}
 
 /**
  * @brief Generates a new instance of the Controller_Display class. 
  * @details initializes the SPI and LCD pins including CS, RS, RESET 
  */
-Controller_Display::Controller_Display() {}
+Controller_Display::Controller_Display() 
+{
+  areas[WIDGET_ENGINE] = asset_rect(ASSET_ENGINE_ON);
+  areas[WIDGET_POWER] = asset_rect(ASSET_POWER_ON);
+  areas[WIDGET_FORWARD] = asset_rect(ASSET_FORWARD_ON);
+  areas[WIDGET_NEUTRAL] = asset_rect(ASSET_NEUTRAL_ON);
+  areas[WIDGET_BACKWARD] = asset_rect(ASSET_BACKWARD_ON);
+  areas[WIDGET_LIGHT] = asset_rect(ASSET_LIGHT_ON);
+  areas[WIDGET_BACKLIGHT] = asset_rect(ASSET_BACKLIGHT_ON);
+  areas[WIDGET_LUBE] = asset_rect(ASSET_LUBE_ON);
+  areas[WIDGET_WARNING] = asset_rect(ASSET_WARNING_OFF);
+  areas[WIDGET_DIGITS] = unite(digit_cell(RPM_DIGITS - 1), digit_cell(0));
+  areas[WIDGET_SCALES] = unite(scale_bar(0), scale_bar(SCALE_BARS - 1));
+  for(int i=0; i<WIDGET_COUNT; i++) icons[i] = ASSET_COUNT;
+}
 
 /**
  * @brief Initializes the display
@@ -23,10 +106,23 @@ void Controller_Display::init()
 {
     DISPLAY_SPI::init();
     fill_rect(0, 0, this->width, this->height, 0x0);
+    assets_ready = assets_begin();
+    if(!assets_ready) LOG_ERROR(DISPLAY, "....Display images not available, the screen stays dark");
     
-    Logger.Info_f(F("....Free heap: %d"), ESP.getFreeHeap());
-    Logger.Info_f(F("....Largest free block: %d"), heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
-    Logger.Info(F("....Done."));
+#ifdef ARDUINO
+    LOG_INFO(DISPLAY, "....Free heap: %d", ESP.getFreeHeap());
+    LOG_INFO(DISPLAY, "....Largest free block: %d", heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+#endif
+    LOG_INFO(DISPLAY, "....Done.");
+}
+
+/**
+ * @brief Draws all regions invalidated since the last frame. 
+ */
+void Controller_Display::render_frame()
+{
+  for(int i=0; i<dirty_count; i++) render_region(dirty[i]);
+  dirty_count = 0;
 }
 
 /**
@@ -36,23 +132,24 @@ void Controller_Display::init()
 void Controller_Display::test()
 { 
   
-  Logger.Info(F("Testing display..."));
-  fill_rect(0, 0, this->width, this->height, 0xf800); vTaskDelay(500);
-  fill_rect(0, 0, this->width, this->height, 0x07E0); vTaskDelay(500);
-  fill_rect(0, 0, this->width, this->height, 0x001F); vTaskDelay(500);
-  fill_rect(0, 0, this->width, this->height, 0x0); vTaskDelay(500);
-  draw_background(lcars, lcars_size);
-  Logger.Info(F("Testing display... done."));
+  LOG_INFO(DISPLAY, "Testing display...");
+  fill_rect(0, 0, this->width, this->height, 0xf800); hal_delay_ms(500);
+  fill_rect(0, 0, this->width, this->height, 0x07E0); hal_delay_ms(500);
+  fill_rect(0, 0, this->width, this->height, 0x001F); hal_delay_ms(500);
+  fill_rect(0, 0, this->width, this->height, 0x0); hal_delay_ms(500);
+  draw_background(ASSET_BACKGROUND_LCARS);
+  LOG_INFO(DISPLAY, "Testing display... done.");
   return;
 }
 
 /**
- * @brief Draws the standard background.
+ * @brief Draws the standard background and invalidates all widgets.
  */
 void Controller_Display::update_background()
 {
-    draw_background(lcars, lcars_size);
+    draw_background(ASSET_BACKGROUND_LCARS);
     fill_rect(70, rpm_y, rpm_x, digit_h+5, 0x0);
+    for(int i=0; i<WIDGET_COUNT; i++) invalidate(areas[i]);
 }
 
 /**
@@ -61,7 +158,7 @@ void Controller_Display::update_background()
  */
 void Controller_Display::update_back_light(bool lighted)
 {
-  draw_image(lighted ? backlight_on : backlight_off, lighted ? backlight_on_size : backlight_off_size, backlight_x, backlight_y, backlight_w, backlight_h);
+  set_icon(WIDGET_BACKLIGHT, lighted ? ASSET_BACKLIGHT_ON : ASSET_BACKLIGHT_OFF);
 }
 
 /**
@@ -70,9 +167,7 @@ void Controller_Display::update_back_light(bool lighted)
  */
 void Controller_Display::update_engine_state(bool energized)
 {
-  const unsigned char* icon = energized ? engine_on : engine_off;
-  const size_t size = energized ? engine_on_size : engine_off_size;
-  draw_image(icon, size, engine_x, engine_y, engine_w, engine_h);
+  set_icon(WIDGET_ENGINE, energized ? ASSET_ENGINE_ON : ASSET_ENGINE_OFF);
 }
 
 /**
@@ -82,9 +177,9 @@ void Controller_Display::update_engine_state(bool energized)
  */
 void Controller_Display::update_for_state(bool for_f, bool for_b)
 {
-  draw_image((for_f && !for_b) ? forward_on : forward_off, (for_f && !for_b) ? forward_on_size : forward_off_size, forward_x, forward_y, forward_w, forward_y);
-  draw_image((!for_f && !for_b) ? neutral_on : neutral_off, (!for_f && !for_b) ? neutral_on_size : neutral_off_size, neutral_x, neutral_y, neutral_w, neutral_y);
-  draw_image((!for_f && for_b) ? backward_on : backward_off, (!for_f && for_b) ? backward_on_size : backward_off_size, backward_x, backward_y, backward_w, backward_y);
+  set_icon(WIDGET_FORWARD, (for_f && !for_b) ? ASSET_FORWARD_ON : ASSET_FORWARD_OFF);
+  set_icon(WIDGET_NEUTRAL, (!for_f && !for_b) ? ASSET_NEUTRAL_ON : ASSET_NEUTRAL_OFF);
+  set_icon(WIDGET_BACKWARD, (!for_f && for_b) ? ASSET_BACKWARD_ON : ASSET_BACKWARD_OFF);
 }
 
 /**
@@ -93,7 +188,7 @@ void Controller_Display::update_for_state(bool for_f, bool for_b)
  */
 void Controller_Display::update_light_state(bool lighted)
 {
-  draw_image(lighted ? light_off : light_on, lighted ? light_off_size : light_on_size, light_x, light_y, light_w, light_h);
+  set_icon(WIDGET_LIGHT, lighted ? ASSET_LIGHT_OFF : ASSET_LIGHT_ON);
 }
 
 /**
@@ -102,7 +197,7 @@ void Controller_Display::update_light_state(bool lighted)
  */
 void Controller_Display::update_lube_state(bool active)
 {
-  draw_image(active ? lube_off : lube_on, active ? lube_off_size : lube_on_size, lube_x, lube_y, lube_w, lube_h);
+  set_icon(WIDGET_LUBE, active ? ASSET_LUBE_OFF : ASSET_LUBE_ON);
 }
 
 /**
@@ -111,7 +206,7 @@ void Controller_Display::update_lube_state(bool active)
  */
 void Controller_Display::update_power_state(bool powered)
 {
-  draw_image(powered ? power_off : power_on, powered ? power_off_size : power_on_size, power_x, power_y, power_w, power_h);
+  set_icon(WIDGET_POWER, powered ? ASSET_POWER_OFF : ASSET_POWER_ON);
 }
 
 /**
@@ -120,14 +215,7 @@ void Controller_Display::update_power_state(bool powered)
  */
 void Controller_Display::update_warning(bool has_deferred_action)
 {
-  if(has_deferred_action)
-  {
-    draw_image(warning_pending_engine, warning_pending_engine_size, warning_x, warning_y, warning_w, warning_h);
-  }
-  else
-  {
-    draw_image(warning_off, warning_off_size, warning_x, warning_y, warning_w, warning_h);
-  }
+  set_icon(WIDGET_WARNING, has_deferred_action ? ASSET_WARNING_PENDING_ENGINE : ASSET_WARNING_OFF);
 }
 
 /**
@@ -135,7 +223,7 @@ void Controller_Display::update_warning(bool has_deferred_action)
 */
 void Controller_Display::write_emergency()
 {
-  this->draw_background(ems, ems_size);
+  draw_background(ASSET_BACKGROUND_EMS);
 }
 
 /**
@@ -145,60 +233,22 @@ void Controller_Display::write_emergency()
 void Controller_Display::write_rpm(unsigned int rpm)
 {
   if (rpm > 9999) rpm = 9999; // clamp to max
-    
-  // Clear area on first invocation.
-  static bool is_first = true;
-  if(is_first)
-  {
-    uint16_t n = (rpm_x - 70) * digit_h * 2;
-    uint8_t* blank = (uint8_t*)malloc(n);
-    if (blank) {
-        memset(blank, 0x00, n);
-        draw_image(blank, n, 70, rpm_y, rpm_x-70, digit_h);
-        free(blank);
-    }
-    is_first = false;
-  }
 
   // Extract digits into a buffer (max 4 digits)
-  static int8_t current_digits[4] = { -1, -1, -1, -1 }; 
-  int8_t digit[4] = { -1, -1, -1, -1};
+  int8_t digit[RPM_DIGITS] = { -1, -1, -1, -1};
   uint8_t count = 0;
   do 
   {
       digit[count++] = rpm % 10;
       rpm /= 10;
-  } while (rpm > 0 && count < 4);
+  } while (rpm > 0 && count < RPM_DIGITS);
 
-  // Render only digits that have changed...
-  int16_t x = rpm_x;
-  for(int i=0; i<4; i++)
+  // Invalidate only digits that have changed...
+  for(int i=0; i<RPM_DIGITS; i++)
   {
-    if(digit[i] == current_digits[i])
-    {
-        // digit has not changed, so nothing except adjust x coordinate
-        uint8_t w = digit_width[digit[i] == -1 ? 0 : digit[i]];
-        x -= w;
-    }
-    else
-    {
-      current_digits[i] = digit[i];
-      if(digit[i] == -1)
-      {
-        // digit is now blank, so clear it
-        uint8_t w = digit_width[0];
-        x -= w;
-        fill_rect(x, rpm_y, w, digit_h, 0x0);
-      }
-      else
-      {
-        // digit has changed, so redraw it
-        uint8_t dig = digit[i];
-        uint8_t w = digit_width[dig];
-        x -= w;
-        draw_image(digits[dig], digit_size[dig], x, rpm_y, w, digit_h);
-      }
-    }
+    if(digit[i] == current_digits[i]) continue;
+    current_digits[i] = digit[i];
+    invalidate(digit_cell(i));
   }  
 }
 
@@ -208,73 +258,183 @@ void Controller_Display::write_rpm(unsigned int rpm)
  */
 void Controller_Display::update_scale(unsigned int rpm)
 {
-    static unsigned int current_rpm = -1;
-    static uint16_t current_scale[6] = {0,0,0,0,0,0};
-    uint16_t scale[6] = {0,0,0,0,0,0};
-    if(current_rpm != rpm)
+  for(int i=0; i<SCALE_BARS; i++)
+  {
+    // calculate the number of pixels to which we draw the green on bar. 
+    unsigned int lower = (i==0 ? 0 : speeds[i-1]);
+    unsigned int width = asset_table[assets_scales_on[i]].w;
+    uint16_t fill = 0;
+    if(rpm >= speeds[i]) fill = width;
+      // speed exceeds the cutoff for this bar, so we set the entire bar
+    else if(rpm > lower) fill = (rpm - lower) * width / (speeds[i] - lower);
+      // speed is inside this bar, so calculate a fractional on and off bar.
+    
+    if(fill == current_scale[i]) continue;
+      // bar is already in desired state, do nothing
+
+    // only the columns between the old and the new fill level change
+    display_rect bar = scale_bar(i);
+    uint16_t from = min(fill, current_scale[i]);
+    uint16_t to = max(fill, current_scale[i]);
+    invalidate(make_rect(bar.x + from, bar.y, to - from, bar.h));
+    current_scale[i] = fill;
+  }
+}
+
+#pragma region protected methods
+/**
+ * @brief Gets the screen region of a digit cell
+ * @param index - the digit index, 0 being the least significant digit
+ * @returns The region of the cell
+ */
+display_rect Controller_Display::digit_cell(int index) const
+{
+  // the digits are monospaced, so the cells are laid out right to left from rpm_x
+  return make_rect(rpm_x - (index + 1) * digit_w, rpm_y, digit_w, digit_h);
+}
+
+/**
+ * @brief Draws a full screen image, or clears the screen if the images are not available
+ * @param image - the image
+ */
+void Controller_Display::draw_background(asset_id image)
+{
+  if(assets_ready) draw_compressed_async(asset_image(image), 0, 0);
+  else fill_rect(0, 0, this->width, this->height, 0x0);
+}
+
+/**
+ * @brief Draws the part of an image that falls into the clip region
+ * @param image - the compiled image covering the full area
+ * @param area - the screen region of the image
+ * @param clip - the region to draw
+ */
+void Controller_Display::draw_clipped(asset_id image, const display_rect& area, const display_rect& clip)
+{
+  display_rect r = intersect(area, clip);
+  if(r.w == 0 || !assets_ready) return;
+  draw_compressed_region_async(asset_image(image), r.x - area.x, r.y - area.y, r.x, r.y, r.w, r.h);
+}
+
+/**
+ * @brief Draws the part of two images that falls into the clip region, columns left of the split from the
+ * first image and the others from the second
+ * @param left - the compiled image left of the split
+ * @param right - the compiled image from the split on
+ * @param split - the first column taken from the right image, relative to the area
+ * @param area - the screen region of both images
+ * @param clip - the region to draw
+ */
+void Controller_Display::draw_split_clipped(asset_id left, asset_id right, uint16_t split, const display_rect& area, const display_rect& clip)
+{
+  display_rect r = intersect(area, clip);
+  if(r.w == 0 || !assets_ready) return;
+  draw_compressed_split_async(asset_image(left), asset_image(right), split, r.x - area.x, r.y - area.y, r.x, r.y, r.w, r.h);
+}
+
+/**
+ * @brief Marks a screen region to be redrawn with the next frame. Overlapping regions are merged.
+ * @param area - the region to invalidate
+ */
+void Controller_Display::invalidate(display_rect area)
+{
+  if(area.w <= 0 || area.h <= 0) return;
+  bool merged;
+  do
+  {
+    // merge with any overlapping region, the merged region might now overlap others, so repeat
+    merged = false;
+    for(int i=0; i<dirty_count; i++)
     {
-      // need to update sales... 
-      current_rpm = rpm;
+      if(!overlaps(dirty[i], area)) continue;
+      area = unite(dirty[i], area);
+      dirty[i] = dirty[--dirty_count];
+      merged = true;
+      break;
+    }
+  }
+  while(merged);
+
+  if(dirty_count == MAX_DIRTY_RECTS)
+  {
+    // out of slots, so fold into the last region. This draws more than necessary but is still correct.
+    area = unite(dirty[--dirty_count], area);
+  }
+  dirty[dirty_count++] = area;
+}
 
-      // calculate what bars are set, unset or factional
-      if(current_rpm <= 0) memset(scale, 0x0, sizeof(scale)); 
-          // mark all scales to be unset
-      else if (current_rpm > 0 && current_rpm < speeds[5])
+/**
+ * @brief Draws all widgets intersecting a region, clipped to that region
+ * @param clip - the region to draw
+ */
+void Controller_Display::render_region(const display_rect& clip)
+{
+  for(int i=0; i<WIDGET_COUNT; i++)
+  {
+    if(overlaps(areas[i], clip)) render_widget(static_cast<widget_id>(i), clip);
+  }
+}
+
+/**
+ * @brief Draws a single widget, clipped to a region
+ * @param id - the widget to draw
+ * @param clip - the region to draw
+ */
+void Controller_Display::render_widget(widget_id id, const display_rect& clip)
+{
+  switch(id)
+  {
+    case WIDGET_DIGITS:
+      for(int i=0; i<RPM_DIGITS; i++)
       {
-        for(int i=0; i<6; i++)
+        display_rect cell = digit_cell(i);
+        if(!overlaps(cell, clip)) continue;
+        if(current_digits[i] == -1)
         {
-          if(current_rpm >= speeds[i]) scale[i] = 0xffff;
-            // speed exceeds the cutoff for this bar, so we set the entire bar
-          else if (current_rpm > (i==0 ? 0 : speeds[i-1]) && current_rpm < speeds[i])
-          {
-            // speed is inside this bar, so calculate a fractional on and off bar. We calculate the 
-            // number of pixels to which we draw the on bar
-            float p = (float)(current_rpm - (i==0 ? 0 : speeds[i-1])) / (float)(speeds[i]-(i==0 ? 0 : speeds[i-1]));
-            scale[i] =  static_cast<uint_fast16_t>(p * scales_width[i]);
-          }
-          else scale[i] = 0x00;
-            // speed has not touched this bar, so we unset the entire bar. 
+          // digit is blank, so clear it
+          display_rect r = intersect(cell, clip);
+          fill_rect(r.x, r.y, r.w, r.h, 0x0);
         }
+        else draw_clipped(assets_digits[current_digits[i]], cell, clip);
       }
-      else memset(scale, 0xff, sizeof(scale)); 
-          // mark all scales to be set
+      break;
 
-      // draw the bars
-      for(int i=0; i<6; i++)
+    case WIDGET_SCALES:
+      for(int i=0; i<SCALE_BARS; i++)
       {
-        if(scale[i] == current_scale[i]) continue;
-          // bar is already in desired state, do nothing
-        
-        current_scale[i] = scale [i];
-        if(scale[i] == 0x0) draw_image(scales_o[i], scales_size[i], scales_x[i], scales_y, scales_width[i], scales_h);
-          // bar is set to off, so we draw the yellow off bar.
-        else if(scale[i] == 0xffff) draw_image(scales_g[i], scales_size[i], scales_x[i], scales_y, scales_width[i], scales_h);
-          // bar is set to on, so we draw the green on bar. 
-        else
-        {
-          // this is a frational bar. So we need to generate a partial scale images based on the pixel value present. 
-          // we need to go with gractionals because of the digits and gradients on the bar. It is easier and faster
-          // to manipulate it this was as opposed to calcuate something. 
-          unsigned char* output_g = static_cast<unsigned char*>(malloc(scales_h * scale[i] * 2));
-          unsigned char* output_y = static_cast<unsigned char*>(malloc(scales_h * (scales_width[i] - scale[i]) * 2));
-          if(output_g && output_y)
-          {
-            for(int row=0; row<scales_h; row++)
-            {
-              memcpy(&output_g[row * scale[i] * 2], &scales_g[i][row * scales_width[i] * 2], scale[i] * 2);
-              memcpy(&output_y[row * (scales_width[i]-scale[i]) * 2], &scales_o[i][row * scales_width[i]*2 + scale[i]*2], (scales_width[i]-scale[i])*2);
-            }
-            draw_image(output_g, scales_h * scale[i] * 2, scales_x[i], scales_y, scale[i], scales_h);
-            draw_image(output_y, scales_h * (scales_width[i]-scale[i]) * 2, scales_x[i]+scale[i], scales_y, scales_width[i]-scale[i], scales_h);
-            free(output_g);
-            free(output_y);
-          }
-          else
-          {
-            // memory allocation failed... just draw the full scale
-            draw_image(scales_o[i], scales_size[i], scales_x[i], scales_y, scales_width[i], scales_h);
-          }
-        }
+        // the bar is green up to the fill level and orange beyond. Both parts are cut from the full bar
+        // images, which keeps the digits and gradients on the bar intact, and go out in one address window.
+        display_rect bar = scale_bar(i);
+        if(!overlaps(bar, clip)) continue;
+        draw_split_clipped(assets_scales_on[i], assets_scales_off[i], current_scale[i], bar, clip);
       }
-    }
+      break;
+
+    default:
+      if(icons[id] != ASSET_COUNT) draw_clipped(icons[id], areas[id], clip);
+      break;
+  }
+}
+
+/**
+ * @brief Gets the screen region of a scale bar
+ * @param index - the bar index
+ * @returns The region of the bar
+ */
+display_rect Controller_Display::scale_bar(int index) const
+{
+  return asset_rect(assets_scales_on[index]);
+}
+
+/**
+ * @brief Sets the image of an icon widget and invalidates the widget if the image changed
+ * @param id - the widget
+ * @param image - the new image
+ */
+void Controller_Display::set_icon(widget_id id, asset_id image)
+{
+  if(icons[id] == image) return;
+  icons[id] = image;
+  invalidate(areas[id]);
 }
+#pragma endregion
@@ -6,112 +6,40 @@
 
 #include "Arduino.h"
 #include "../display_spi/display_spi.h"
+#include "assets.h"
 
-#pragma region externals for icons
-extern const unsigned char lcars[] PROGMEM;
-extern const unsigned char ems[] PROGMEM;
-extern const size_t lcars_size;
-extern const size_t ems_size;
-
-extern const unsigned char engine_on[] PROGMEM;
-extern const unsigned char engine_off[] PROGMEM;
-extern const unsigned int engine_x;
-extern const unsigned int engine_y;
-extern const unsigned int engine_w;
-extern const unsigned int engine_h;
-extern const size_t engine_on_size;
-extern const size_t engine_off_size;
-
-extern const unsigned char power_on[] PROGMEM;
-extern const unsigned char power_off[] PROGMEM;
-extern const unsigned int power_x;
-extern const unsigned int power_y;
-extern const unsigned int power_w;
-extern const unsigned int power_h;
-extern const size_t power_on_size;
-extern const size_t power_off_size;
-
-extern const unsigned char forward_on[] PROGMEM;
-extern const unsigned char forward_off[] PROGMEM;
-extern const unsigned int forward_x;
-extern const unsigned int forward_y;
-extern const unsigned int forward_w;
-extern const unsigned int forward_h;
-extern const size_t forward_on_size;
-extern const size_t forward_off_size;
-
-extern const unsigned char warning_off[] PROGMEM;
-extern const unsigned char warning_pending_engine[] PROGMEM;
-extern const unsigned int warning_x;
-extern const unsigned int warning_y;
-extern const unsigned int warning_w;
-extern const unsigned int warning_h;
-extern const size_t warning_off_size;
-extern const size_t warning_pending_engine_size;
-
-extern const unsigned char neutral_on[] PROGMEM;
-extern const unsigned char neutral_off[] PROGMEM;
-extern const unsigned int neutral_x;
-extern const unsigned int neutral_y;
-extern const unsigned int neutral_w;
-extern const unsigned int neutral_h;
-extern const size_t neutral_on_size;
-extern const size_t neutral_off_size;
-
-extern const unsigned char backward_on[] PROGMEM;
-extern const unsigned char backward_off[] PROGMEM;
-extern const unsigned int backward_x;
-extern const unsigned int backward_y;
-extern const unsigned int backward_w;
-extern const unsigned int backward_h;
-extern const size_t backward_on_size;
-extern const size_t backward_off_size;
-
-extern const unsigned char light_on[] PROGMEM;
-extern const unsigned char light_off[] PROGMEM;
-extern const unsigned int light_x;
-extern const unsigned int light_y;
-extern const unsigned int light_w;
-extern const unsigned int light_h;
-extern const size_t light_on_size;
-extern const size_t light_off_size;
-
-extern const unsigned char backlight_on[] PROGMEM;
-extern const unsigned char backlight_off[] PROGMEM;
-extern const unsigned int backlight_x;
-extern const unsigned int backlight_y;
-extern const unsigned int backlight_w;
-extern const unsigned int backlight_h;
-extern const size_t backlight_on_size;
-extern const size_t backlight_off_size;
-
-extern const unsigned char lube_on[] PROGMEM;
-extern const unsigned char lube_off[] PROGMEM;
-extern const unsigned int lube_x;
-extern const unsigned int lube_y;
-extern const unsigned int lube_w;
-extern const unsigned int lube_h;
-extern const size_t lube_on_size;
-extern const size_t lube_off_size;
-#pragma endregion
-
-#pragma region externals for digits
-extern const unsigned char* digits[10] PROGMEM;
-extern const size_t digit_size[10] PROGMEM;
-extern const unsigned int digit_width[10] PROGMEM;
-extern const unsigned int digit_h;
-#pragma endregion
-
-#pragma region externals for scales
-extern const unsigned int scales_h;
-extern const unsigned int scales_y;
-extern const unsigned char* scales_o[6] PROGMEM;
-extern const unsigned char* scales_g[6] PROGMEM;
-extern const unsigned int scales_width[6] PROGMEM;
-extern const unsigned int scales_x[6] PROGMEM;
-extern const size_t scales_size[6] PROGMEM;
-extern const unsigned int speeds[6] PROGMEM;
-#pragma endregion
+#define MAX_DIRTY_RECTS 16
+#define RPM_DIGITS 4
+#define SCALE_BARS 6
+
+/**
+ * @brief Identifies the widgets managed by the compositor. Widgets are drawn in this order, so later
+ * widgets are on top of earlier ones where they overlap (power is drawn on top of engine).
+ */
+enum widget_id {
+    WIDGET_ENGINE = 0,
+    WIDGET_POWER,
+    WIDGET_FORWARD,
+    WIDGET_NEUTRAL,
+    WIDGET_BACKWARD,
+    WIDGET_LIGHT,
+    WIDGET_BACKLIGHT,
+    WIDGET_LUBE,
+    WIDGET_WARNING,
+    WIDGET_DIGITS,
+    WIDGET_SCALES,
+    WIDGET_COUNT
+};
+
+/**
+ * @brief Describes a rectangular screen region
+ */
+struct display_rect {
+    int16_t x = 0;
+    int16_t y = 0;
+    int16_t w = 0;
+    int16_t h = 0;
+};
 
 /**
  * @brief Implements the display for the handwheel
@@ -130,6 +58,13 @@ class Controller_Display:public DISPLAY_SPI
 		 */
 		void init();
 
+		/**
+		 * @brief Draws all regions invalidated since the last frame. The update_* and write_rpm methods only
+		 * record the new state and invalidate the affected regions, nothing is sent to the display until this
+		 * method is called.
+		 */
+		void render_frame();
+
 		/**
 		 * @brief Tests the display by going through a routine of drawing various
 		 * shapes and information
@@ -137,7 +72,7 @@ class Controller_Display:public DISPLAY_SPI
 		void test();
 
 		/**
-		 * @brief Draws the standard background.
+		 * @brief Draws the standard background and invalidates all widgets.
 		 */
 		void update_background();
 
@@ -201,11 +136,82 @@ class Controller_Display:public DISPLAY_SPI
 		 */
 		void update_scale(unsigned int rpm);
 
+	protected:
+		/**
+		 * @brief Gets the screen region of a digit cell
+		 * @param index - the digit index, 0 being the least significant digit
+		 * @returns The region of the cell
+		 */
+		display_rect digit_cell(int index) const;
+
+		/**
+		 * @brief Draws a full screen image, or clears the screen if the images are not available
+		 * @param image - the image
+		 */
+		void draw_background(asset_id image);
+
+		/**
+		 * @brief Draws the part of an image that falls into the clip region
+		 * @param image - the compiled image covering the full area
+		 * @param area - the screen region of the image
+		 * @param clip - the region to draw
+		 */
+		void draw_clipped(asset_id image, const display_rect& area, const display_rect& clip);
+
+		/**
+		 * @brief Draws the part of two images that falls into the clip region, columns left of the split from the
+		 * first image and the others from the second
+		 * @param left - the compiled image left of the split
+		 * @param right - the compiled image from the split on
+		 * @param split - the first column taken from the right image, relative to the area
+		 * @param area - the screen region of both images
+		 * @param clip - the region to draw
+		 */
+		void draw_split_clipped(asset_id left, asset_id right, uint16_t split, const display_rect& area, const display_rect& clip);
+
+		/**
+		 * @brief Marks a screen region to be redrawn with the next frame. Overlapping regions are merged.
+		 * @param area - the region to invalidate
+		 */
+		void invalidate(display_rect area);
+
+		/**
+		 * @brief Draws all widgets intersecting a region, clipped to that region
+		 * @param clip - the region to draw
+		 */
+		void render_region(const display_rect& clip);
+
+		/**
+		 * @brief Draws a single widget, clipped to a region
+		 * @param id - the widget to draw
+		 * @param clip - the region to draw
+		 */
+		void render_widget(widget_id id, const display_rect& clip);
+
+		/**
+		 * @brief Gets the screen region of a scale bar
+		 * @param index - the bar index
+		 * @returns The region of the bar
+		 */
+		display_rect scale_bar(int index) const;
+
+		/**
+		 * @brief Sets the image of an icon widget and invalidates the widget if the image changed
+		 * @param id - the widget
+		 * @param image - the new image
+		 */
+		void set_icon(widget_id id, asset_id image);
+
 	private: 
 
-		uint8_t* buf1 = nullptr;
-		uint8_t* buf2 = nullptr;
-		bool w_area_initialized = false;
+		bool assets_ready = false;
+
+		display_rect areas[WIDGET_COUNT];
+		asset_id icons[WIDGET_COUNT];
+		display_rect dirty[MAX_DIRTY_RECTS];
+		uint8_t dirty_count = 0;
+		int8_t current_digits[RPM_DIGITS] = { -1, -1, -1, -1 };
+		uint16_t current_scale[SCALE_BARS] = { 0, 0, 0, 0, 0, 0 };
 };
 
 #endif
\ No newline at end of file
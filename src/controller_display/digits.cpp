@@ -1,811 +0,0 @@
-// Copyright (c) Thor Schueler. All rights reserved.
-// SPDX-License-Identifier: MIT
-/*
-This is the core GUI library for the TFT display, providing a common
-set of graphics primitives (points, lines, circles, etc.).  It needs to be
-paired with a hardware-specific library for each display device we carry
-(to handle the lower-level functions).
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
-ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
-LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
-CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
-SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
-INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
-CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
-ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#include "controller_display.h"
-
-
-const unsigned int digit_h = 70;
-const unsigned int digit_0_w = 31;
-const unsigned char digit_0[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,32,160,32,160,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,138,192,195,193,212,33,220,33,220,33,212,33,187,129,122,64,24,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,138,192,220,33,220,1,220,1,212,1,220,1,220,1,212,1,212,1,220,1,212,1,97,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,171,65,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,130,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,160,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,203,225,16,64,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,160,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,98,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,225,220,1,220,1,220,1,220,1,220,1,220,1,220,1,195,161,211,225,220,1,220,1,220,1,220,1,220,1,220,1,220,1,171,33,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,40,192,220,1,220,1,220,1,220,1,220,1,220,1,195,193,40,224,0,0,8,32,114,32,220,1,220,1,220,1,220,1,220,1,220,1,212,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,73,128,212,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,138,192,220,1,220,1,220,1,220,1,220,1,220,65,16,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,89,224,212,1,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,57,64,212,1,212,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,98,0,212,1,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,40,224,220,1,220,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,212,1,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,212,1,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,212,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,212,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,195,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,212,1,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,212,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,212,1,220,1,220,1,220,1,195,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,212,1,212,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,212,1,212,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,212,1,212,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,220,1,220,1,220,1,220,33,40,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,48,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,89,224,219,225,220,1,220,1,220,1,220,1,187,193,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,81,160,212,1,220,1,220,1,220,1,220,1,212,33,8,64,0,0,0,0,0,0,0,0,81,160,220,1,212,1,220,1,220,1,220,1,220,65,32,160,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,40,224,220,1,212,1,220,1,220,1,220,1,220,1,81,160,0,0,0,0,0,0,0,0,163,33,212,1,220,1,220,1,220,1,220,1,220,65,0,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,8,64,212,1,220,1,220,1,220,1,220,1,220,1,195,193,32,192,0,0,0,0,106,0,220,1,212,1,212,1,220,1,220,1,220,1,195,193,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,65,220,1,220,1,220,1,220,1,220,1,220,1,212,1,187,129,195,161,220,1,212,1,212,1,220,1,220,1,220,1,212,1,138,192,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,160,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,212,1,220,1,211,225,163,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,212,1,203,225,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,160,212,1,220,1,220,1,220,1,212,1,212,1,212,1,212,1,212,1,212,1,220,1,203,225,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,179,129,220,33,212,1,220,1,212,1,212,1,212,1,211,225,220,33,146,225,24,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,32,130,128,163,32,171,97,163,65,154,225,106,32,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_0_size = sizeof(digit_0) / sizeof(digit_0[0]);
-
-const unsigned int digit_1_w = 31;
-const unsigned char digit_1[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,1,163,33,163,33,163,33,163,33,163,33,163,33,65,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,1,220,1,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,220,1,220,1,220,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,65,212,1,220,1,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,64,146,192,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,64,89,192,138,160,203,225,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,224,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,224,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,224,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,224,212,1,212,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,0,220,65,203,225,195,193,187,161,163,33,146,192,220,33,212,1,212,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,0,0,0,0,0,0,0,0,16,96,220,65,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,65,212,1,212,1,220,1,212,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,212,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,219,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,220,1,220,1,220,1,219,225,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,212,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,211,225,211,225,211,225,211,225,211,225,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,98,0,98,0,98,0,98,0,98,0,98,0,32,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_1_size = sizeof(digit_1) / sizeof(digit_1[0]);
-
-const unsigned int digit_2_w = 31;
-const unsigned char digit_2[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,32,160,32,160,16,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,122,96,187,161,212,33,220,33,220,33,220,33,195,193,138,160,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,192,211,225,211,225,212,1,212,1,212,1,212,1,212,1,212,1,220,1,220,33,146,224,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,179,129,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,224,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,219,225,146,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,219,225,154,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,212,1,220,1,220,1,220,1,220,1,220,1,220,1,195,161,195,193,220,1,212,1,220,1,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,224,220,1,220,1,220,1,220,1,220,1,220,1,81,128,0,0,0,0,73,96,211,225,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,220,1,220,1,220,1,220,1,220,1,154,224,0,0,0,0,0,0,0,0,114,64,211,225,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,225,220,1,220,1,220,1,212,1,211,225,89,192,0,0,0,0,0,0,0,0,32,160,220,1,212,1,220,1,220,1,220,1,212,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,1,220,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,212,1,212,1,220,1,220,1,220,1,220,1,130,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,32,212,1,220,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,212,33,220,1,220,1,220,1,220,1,212,1,130,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,16,64,220,33,220,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,212,33,220,1,220,1,220,1,220,1,220,1,130,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,24,128,220,33,220,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,212,33,212,1,220,1,220,1,220,1,212,1,130,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,128,220,33,220,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,212,1,220,1,220,1,220,1,220,1,212,1,130,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,128,220,33,220,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,212,33,220,1,220,1,220,1,220,1,212,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,128,220,33,212,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,8,32,212,33,220,1,220,1,220,1,220,1,220,1,106,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,128,220,33,212,1,220,1,219,225,220,1,220,1,65,96,0,0,0,0,0,0,0,0,16,64,220,33,220,1,220,1,220,1,220,1,220,1,106,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,24,128,220,1,211,225,211,225,211,225,211,225,219,225,65,96,0,0,0,0,0,0,0,0,24,128,220,33,220,1,220,1,220,1,220,1,212,1,106,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,8,64,106,32,106,0,106,0,106,32,106,32,106,32,32,160,0,0,0,0,0,0,0,0,40,224,220,1,220,1,220,1,220,1,220,1,211,225,81,160,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,128,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,32,220,1,220,1,220,1,220,1,220,1,220,65,16,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,1,220,1,220,1,220,1,220,1,220,1,195,193,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,203,225,220,1,220,1,220,1,220,1,220,1,154,225,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,220,1,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,64,212,1,220,1,220,1,220,1,220,1,220,33,24,128,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,212,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,220,1,220,1,220,1,220,1,220,1,220,1,97,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,96,212,1,220,1,220,1,220,1,220,1,220,33,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,203,193,220,1,220,1,220,1,220,1,220,1,146,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,128,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,97,212,1,220,1,220,1,220,1,220,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,220,1,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,225,212,1,220,1,212,1,220,1,220,1,203,225,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,212,1,212,1,220,1,220,1,220,1,212,1,122,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,128,212,1,220,1,212,1,220,1,220,1,220,33,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,212,1,212,1,220,1,212,1,220,1,212,1,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,32,220,1,220,1,220,1,212,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,203,225,220,1,220,1,220,1,220,1,212,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,224,212,1,212,1,220,1,212,1,212,1,212,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,220,1,220,1,220,1,220,1,220,1,203,225,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,96,220,1,220,1,220,1,220,1,220,1,212,1,130,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,212,1,220,1,220,1,220,1,212,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,220,1,220,1,220,1,211,225,171,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,96,211,225,212,1,220,1,220,1,220,1,212,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,195,193,220,1,220,1,220,1,212,1,220,1,212,1,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,146,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,96,212,1,220,1,220,1,220,1,220,1,220,1,73,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,129,220,1,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,220,65,220,1,220,1,220,1,220,1,220,1,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,96,212,1,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,32,212,1,220,1,220,1,220,1,220,1,220,1,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,225,220,1,220,1,220,1,220,1,220,1,211,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,129,220,1,220,1,220,1,220,1,220,1,171,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,225,220,1,220,1,220,1,220,1,212,1,195,161,122,129,122,128,122,128,130,128,122,128,122,128,122,128,122,128,122,128,122,128,122,128,65,96,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,8,32,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,211,225,212,1,220,1,212,1,220,1,220,1,219,225,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,24,96,220,33,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,122,96,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,122,96,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,212,1,212,1,220,1,220,1,220,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,211,225,122,96,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,211,225,122,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,8,32,65,96,65,96,65,96,65,96,65,96,65,128,65,128,65,128,65,96,65,96,65,128,65,96,65,96,65,96,65,128,65,128,65,128,65,96,32,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_2_size = sizeof(digit_2) / sizeof(digit_2[0]);
-
-const unsigned int digit_3_w = 31;
-const unsigned char digit_3[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,32,192,49,32,41,0,24,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,64,155,1,212,1,220,1,220,1,220,1,220,33,203,225,146,192,57,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,64,155,0,220,1,220,1,212,1,212,1,220,1,212,1,212,1,212,1,220,1,220,33,147,0,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,171,97,212,1,220,1,220,1,212,1,220,1,220,1,212,1,220,1,220,1,212,1,220,1,220,1,171,97,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,192,212,1,212,1,212,1,212,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,122,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,220,33,220,1,212,1,220,1,212,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,16,64,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,192,212,1,212,1,220,1,212,1,212,1,212,1,212,1,212,1,211,225,211,225,220,1,220,1,220,1,220,1,212,1,212,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,212,1,212,1,220,1,212,1,212,1,163,33,171,65,212,1,220,1,220,1,220,1,220,1,212,1,220,1,154,225,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,212,1,212,1,212,1,179,129,24,128,0,0,0,0,40,224,203,225,212,1,220,1,212,1,212,1,212,1,187,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,89,192,220,1,220,1,220,1,212,1,219,225,220,33,40,224,0,0,0,0,0,0,0,0,122,96,212,1,220,1,220,1,220,1,220,1,220,33,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,114,64,211,225,220,1,220,1,212,1,212,1,195,161,0,0,0,0,0,0,0,0,0,0,89,192,212,1,220,1,220,1,220,1,220,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,96,211,225,220,1,212,1,212,1,212,1,179,97,0,0,0,0,0,0,0,0,0,0,97,192,212,1,220,1,220,1,220,1,212,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,96,212,1,220,1,220,1,220,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,97,192,212,1,220,1,220,1,220,1,212,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,96,212,1,212,1,220,1,212,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,97,192,212,1,220,1,220,1,220,1,212,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,96,211,225,212,1,220,1,212,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,97,192,212,1,220,1,212,1,212,1,212,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,96,211,225,212,1,212,1,212,1,212,1,179,97,0,0,0,0,0,0,0,0,0,0,89,192,212,1,220,1,212,1,220,1,212,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,122,96,211,225,212,1,212,1,212,1,212,1,179,97,0,0,0,0,0,0,0,0,0,0,89,192,212,1,212,1,220,1,220,1,212,1,220,33,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,122,96,212,1,220,1,220,1,212,1,212,1,179,97,0,0,0,0,0,0,0,0,0,0,89,192,212,1,212,1,220,1,220,1,220,1,220,33,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,122,96,211,225,212,1,212,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,89,192,212,1,212,1,220,1,220,1,212,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,122,64,211,225,211,225,211,225,212,1,211,225,179,97,0,0,0,0,0,0,0,0,0,0,89,192,212,1,212,1,220,1,220,1,212,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,192,65,96,65,96,65,96,65,96,65,96,49,32,0,0,0,0,0,0,0,0,0,0,89,192,212,1,220,1,220,1,220,1,212,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,192,212,1,220,1,212,1,220,1,212,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,192,212,1,220,1,220,1,220,1,220,1,220,33,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,192,212,1,220,1,220,1,220,1,220,1,212,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,224,212,1,220,1,220,1,220,1,212,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,161,212,1,220,1,220,1,220,1,220,1,154,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,203,225,212,1,220,1,220,1,220,1,212,1,97,192,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,96,98,0,106,32,130,128,203,225,212,1,220,1,220,1,220,1,220,1,211,225,16,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,192,211,225,211,225,212,1,220,1,220,1,212,1,220,1,212,1,220,1,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,192,212,1,212,1,212,1,220,1,220,1,220,1,212,1,220,33,114,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,192,212,1,220,1,212,1,220,1,212,1,212,1,195,161,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,192,220,1,220,1,220,1,220,1,212,1,212,1,220,1,212,1,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,192,220,1,220,1,220,1,220,1,220,1,220,1,212,1,211,225,220,1,106,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,192,212,1,211,225,211,225,212,1,220,1,220,1,220,1,220,1,212,1,212,1,40,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,65,96,65,128,122,64,203,225,220,1,220,1,220,1,220,1,220,1,212,1,146,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,203,225,212,1,220,1,220,1,220,1,220,1,203,225,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,64,212,1,220,1,220,1,212,1,220,1,220,65,24,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,220,1,220,1,220,1,212,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,220,33,212,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,220,33,220,1,220,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,220,33,212,1,212,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,220,33,212,1,220,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,220,33,212,1,212,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,97,224,163,65,163,65,163,33,163,33,163,33,130,160,0,0,0,0,0,0,0,0,0,0,32,192,220,33,212,1,212,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,96,211,225,220,1,219,225,220,1,211,225,171,65,0,0,0,0,0,0,0,0,0,0,32,192,220,33,212,1,212,1,212,1,220,1,220,33,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,96,211,225,220,1,212,1,220,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,220,1,220,1,212,1,220,33,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,128,211,225,220,1,220,1,212,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,32,192,220,33,212,1,212,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,128,211,225,212,1,220,1,212,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,32,192,220,33,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,128,211,225,220,1,220,1,212,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,128,211,225,212,1,220,1,220,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,128,211,225,220,1,220,1,220,1,212,1,171,33,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,128,211,225,212,1,220,1,220,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,220,33,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,128,211,225,220,1,220,1,212,1,212,1,179,97,0,0,0,0,0,0,0,0,0,0,40,192,220,33,220,1,212,1,220,1,220,1,220,33,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,122,96,211,225,220,1,220,1,220,1,212,1,187,161,0,0,0,0,0,0,0,0,0,0,65,64,220,1,220,1,220,1,220,1,220,1,220,33,40,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,97,224,211,225,220,1,220,1,220,1,212,1,220,1,24,128,0,0,0,0,0,0,0,0,114,96,219,225,220,1,220,1,220,1,220,1,220,65,8,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,65,64,212,1,212,1,212,1,220,1,212,1,212,1,146,224,0,0,0,0,0,0,32,160,203,225,220,1,220,1,220,1,220,1,212,1,187,161,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,16,64,212,1,212,1,212,1,212,1,212,1,212,1,220,1,179,97,138,161,146,225,203,225,212,1,212,1,220,1,220,1,220,1,212,1,130,160,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,1,211,225,212,1,212,1,212,1,212,1,212,1,212,1,211,225,212,1,212,1,220,1,212,1,220,1,220,1,220,1,220,1,49,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,64,220,1,212,1,212,1,212,1,212,1,220,1,212,1,220,1,212,1,212,1,220,1,220,1,220,1,212,1,212,1,163,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,0,211,225,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,32,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,187,161,211,225,212,1,212,1,220,1,220,1,220,1,212,1,220,1,220,1,212,1,212,1,212,1,57,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,155,33,220,33,212,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,187,161,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,32,138,192,195,161,212,1,212,33,212,1,195,161,146,224,81,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_3_size = sizeof(digit_3) / sizeof(digit_3[0]);
-
-const unsigned int digit_4_w = 31;
-const unsigned char digit_4[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,192,179,129,179,129,179,129,179,129,179,129,179,129,187,129,73,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,225,211,225,211,225,212,1,212,1,211,225,212,1,212,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,220,1,212,1,211,225,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,224,211,225,212,1,220,1,212,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,224,212,1,220,1,220,1,212,1,212,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,193,211,225,212,1,220,1,212,1,212,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,1,220,1,220,1,212,1,220,1,212,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,160,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,160,212,1,212,1,212,1,212,1,212,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,212,1,220,1,212,1,212,1,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,212,1,212,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,128,211,225,212,1,220,1,212,1,203,225,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,96,211,225,212,1,212,1,220,1,171,97,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,97,212,1,220,1,220,1,212,1,146,193,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,212,1,212,1,220,1,220,1,187,129,138,193,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,64,220,1,220,1,220,1,220,1,146,225,138,225,220,1,220,1,220,1,220,1,220,1,89,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,64,211,225,220,1,220,1,212,1,114,32,138,225,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,212,1,220,1,220,1,220,1,65,64,146,225,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,212,1,212,1,220,1,220,1,220,33,16,96,146,225,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,220,1,212,1,220,1,212,1,195,193,0,0,146,224,212,1,220,1,212,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,220,1,212,1,212,1,155,1,0,0,146,225,212,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,1,220,1,220,1,220,1,220,1,114,64,0,0,146,224,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,225,220,1,220,1,220,1,212,1,65,96,0,0,146,224,212,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,220,1,220,1,220,1,220,1,220,33,24,128,0,0,146,224,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,192,211,225,220,1,220,1,220,1,203,225,0,0,0,0,146,225,212,1,220,1,220,1,220,1,220,1,81,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,225,212,1,220,1,220,1,220,1,163,32,0,0,0,0,146,225,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,195,193,212,1,220,1,220,1,212,1,114,64,0,0,0,0,146,225,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,128,220,33,220,1,220,1,212,1,220,1,73,128,0,0,0,0,146,224,212,1,212,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,192,211,225,220,1,220,1,220,1,220,33,24,128,0,0,0,0,146,225,212,1,212,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,160,220,1,220,1,220,1,212,1,203,225,0,0,0,0,0,0,146,225,212,1,212,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,212,1,220,1,220,1,220,1,163,33,0,0,0,0,0,0,146,224,212,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,24,128,220,1,212,1,212,1,220,1,212,1,122,96,0,0,0,0,0,0,146,224,212,1,212,1,220,1,220,1,220,1,81,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,73,128,212,1,212,1,220,1,212,1,220,1,81,160,0,0,0,0,0,0,146,224,212,1,212,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,128,212,1,220,1,220,1,220,1,220,33,32,192,0,0,0,0,0,0,146,225,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,179,129,212,1,212,1,220,1,220,1,212,33,0,0,0,0,0,0,0,0,146,225,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,64,220,33,220,1,212,1,220,1,212,1,171,65,0,0,0,0,0,0,0,0,146,225,212,1,220,1,220,1,220,1,220,1,89,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,220,1,212,1,212,1,220,1,220,1,130,128,0,0,0,0,0,0,0,0,146,225,220,1,220,1,212,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,122,64,211,225,220,1,212,1,212,1,211,225,89,192,0,0,0,0,0,0,0,0,146,225,220,1,220,1,220,1,220,1,220,1,81,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,171,65,212,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,146,225,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,8,64,212,1,212,1,212,1,212,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,146,225,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,32,160,220,33,212,1,212,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,146,225,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,32,192,220,33,212,1,220,1,220,1,220,1,195,161,138,224,138,224,138,224,138,224,138,224,195,161,220,1,220,1,220,1,220,1,220,1,171,97,138,224,138,192,98,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,32,192,220,33,220,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,154,225,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,32,192,220,33,212,1,220,1,212,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,154,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,32,192,220,1,212,1,212,1,220,1,212,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,154,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,32,192,220,33,212,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,154,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,32,192,220,33,212,1,212,1,212,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,212,1,212,1,212,1,220,1,212,1,220,1,220,1,220,1,220,1,154,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,32,192,220,33,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,33,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,155,1,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,32,41,0,41,0,41,0,40,224,40,224,41,0,40,224,40,224,40,224,40,224,40,224,195,161,220,1,220,1,220,1,220,1,220,1,114,64,40,224,40,224,24,160,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,220,1,220,1,220,1,220,1,220,1,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,129,211,225,211,225,211,225,211,225,211,225,81,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,192,98,0,98,0,98,0,98,0,106,0,40,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_4_size = sizeof(digit_4) / sizeof(digit_4[0]);
-
-const unsigned int digit_5_w = 31;
-const unsigned char digit_5[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,160,179,129,179,129,179,129,179,129,179,129,179,129,179,129,179,129,179,129,179,129,179,129,179,129,179,129,179,129,179,129,171,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,204,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,212,1,212,1,212,1,204,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,204,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,204,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,220,1,220,1,212,1,220,1,212,1,220,1,220,1,212,1,212,1,212,1,212,1,220,1,204,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,220,1,220,1,220,33,228,65,228,65,228,65,228,65,220,33,220,65,228,65,228,65,228,65,212,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,220,1,220,1,220,1,211,225,122,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,220,1,220,1,220,1,211,225,114,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,220,1,211,225,114,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,220,1,212,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,212,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,212,1,212,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,220,1,212,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,212,1,212,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,212,1,212,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,212,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,220,1,220,1,211,225,97,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,220,1,220,1,220,1,211,225,97,224,0,0,16,96,122,96,179,97,195,161,187,129,130,129,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,220,1,220,1,211,225,97,224,49,0,203,193,211,225,220,1,212,1,220,1,212,1,212,1,97,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,220,1,211,225,106,32,203,225,212,1,212,1,220,1,220,1,220,1,220,1,212,1,220,1,89,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,220,1,220,1,220,1,195,193,211,225,212,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,211,225,16,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,212,1,220,1,212,1,220,1,220,1,220,1,211,225,114,64,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,220,1,220,1,212,1,212,1,212,1,220,1,220,1,220,1,212,1,212,1,220,1,212,1,212,1,195,193,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,220,1,212,1,212,1,220,1,220,1,220,1,211,225,220,1,220,33,220,1,212,1,212,1,220,1,220,1,212,1,212,1,220,65,24,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,220,1,212,1,212,1,220,1,220,1,220,1,171,65,49,0,32,160,97,224,211,225,212,1,212,1,212,1,220,1,212,1,211,225,73,96,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,212,1,212,1,203,225,8,64,0,0,0,0,0,0,89,192,220,1,220,1,212,1,212,1,212,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,212,1,212,1,212,1,130,160,0,0,0,0,0,0,0,0,8,32,212,1,212,1,212,1,220,1,212,1,211,225,114,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,212,1,212,1,211,225,89,224,0,0,0,0,0,0,0,0,0,0,171,65,212,1,212,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,211,225,212,1,212,1,212,1,211,225,65,128,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,220,1,212,1,212,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,65,220,33,220,33,220,33,220,33,220,33,73,128,0,0,0,0,0,0,0,0,0,0,163,33,212,1,212,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,32,160,32,160,32,160,32,160,32,160,8,64,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,212,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,212,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,212,1,212,1,212,1,220,1,220,1,114,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,220,1,212,1,220,1,212,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,212,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,220,1,212,1,212,1,220,1,212,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,32,220,1,220,1,220,1,220,1,220,1,114,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,32,220,1,212,1,220,1,220,1,220,1,114,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,24,128,163,65,163,65,163,65,163,65,163,65,163,33,49,64,0,0,0,0,0,0,0,0,0,0,163,32,220,1,220,1,220,1,220,1,220,1,114,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,212,1,211,225,65,128,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,220,1,220,1,220,1,114,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,211,225,65,160,0,0,0,0,0,0,0,0,0,0,163,32,220,1,220,1,212,1,220,1,212,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,212,1,220,1,220,1,211,225,65,160,0,0,0,0,0,0,0,0,0,0,163,32,220,1,220,1,220,1,220,1,212,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,220,1,220,1,220,1,211,225,65,160,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,212,1,212,1,220,1,211,225,65,160,0,0,0,0,0,0,0,0,0,0,163,32,220,1,220,1,220,1,220,1,220,1,114,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,220,1,212,1,220,1,211,225,65,160,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,212,1,220,1,220,1,211,225,65,128,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,211,225,65,128,0,0,0,0,0,0,0,0,0,0,163,33,220,1,212,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,220,1,220,1,220,1,211,225,73,128,0,0,0,0,0,0,0,0,0,0,171,33,220,1,220,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,24,128,220,1,212,1,212,1,220,1,220,1,211,225,97,224,0,0,0,0,0,0,0,0,0,0,195,193,220,1,212,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,8,32,212,1,212,1,220,1,220,1,220,1,212,1,155,0,0,0,0,0,0,0,0,0,24,128,220,33,220,1,220,1,220,1,220,1,211,225,73,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,129,212,1,212,1,212,1,220,1,212,1,220,1,73,128,0,0,0,0,0,0,146,225,212,1,220,1,220,1,220,1,220,1,220,33,24,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,129,211,225,212,1,212,1,220,1,212,1,220,1,212,1,155,1,138,160,179,129,220,1,212,1,212,1,220,1,220,1,212,1,195,193,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,220,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,211,225,122,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,65,212,1,212,1,220,1,220,1,220,1,212,1,212,1,212,1,212,1,220,1,220,1,220,1,212,1,220,1,212,1,24,128,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,224,212,1,212,1,212,1,212,1,220,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,114,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,160,212,1,211,225,212,1,212,1,212,1,212,1,212,1,220,1,220,1,212,1,212,1,220,1,146,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,32,187,161,212,1,212,1,211,225,211,225,212,1,212,1,212,1,212,1,220,1,122,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,192,147,1,195,193,212,1,212,33,212,1,187,129,130,128,32,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_5_size = sizeof(digit_5) / sizeof(digit_5[0]);
-
-const unsigned int digit_6_w = 31;
-const unsigned char digit_6[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,96,138,192,179,129,212,1,212,1,203,225,163,33,106,32,24,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,179,129,220,1,220,1,220,1,212,1,220,1,220,1,220,1,211,225,212,1,114,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,64,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,155,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,122,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,65,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,32,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,49,0,220,33,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,212,1,130,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,130,160,212,1,220,1,220,1,220,1,220,1,220,1,220,1,179,97,146,192,203,193,212,1,220,1,220,1,220,1,220,1,220,1,203,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,187,161,220,1,220,1,220,1,220,1,220,1,220,1,97,224,0,0,0,0,16,64,179,129,220,1,220,1,220,1,220,1,220,1,220,33,32,160,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,32,220,65,220,1,220,1,220,1,220,1,212,1,171,65,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,73,128,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,40,192,220,33,220,1,220,1,220,1,220,1,211,225,97,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,212,1,211,225,49,32,0,0,0,0,0,0,0,0,0,0,195,193,220,1,220,1,220,1,220,1,212,1,97,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,179,97,220,1,220,1,220,1,220,1,212,1,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,212,1,220,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,171,65,220,1,220,1,220,1,220,1,212,1,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,171,65,212,1,220,1,220,1,220,1,211,225,97,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,212,1,220,1,220,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,171,65,212,1,220,1,220,1,220,1,211,225,97,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,171,64,211,225,211,225,211,225,211,225,211,225,97,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,97,224,130,96,130,96,130,96,130,96,122,96,57,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,220,1,220,1,220,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,212,1,212,1,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,212,1,220,1,212,1,212,1,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,220,1,212,1,212,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,220,1,212,1,220,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,212,1,212,1,212,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,220,1,220,1,220,1,220,1,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,220,1,212,1,212,1,220,1,41,0,0,0,16,64,106,32,155,1,171,65,146,192,81,160,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,212,1,220,1,212,1,220,1,41,0,65,64,203,225,212,1,212,1,212,1,211,225,212,1,187,161,40,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,212,1,220,1,212,1,220,1,89,224,212,1,220,1,220,1,220,1,212,1,212,1,220,1,212,1,203,225,40,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,212,1,220,1,220,1,220,1,203,225,212,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,187,161,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,212,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,212,1,212,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,220,1,212,1,220,1,220,1,220,1,212,1,212,1,211,225,219,225,220,1,220,1,220,1,220,1,220,1,220,1,212,1,16,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,220,1,220,1,220,1,220,1,219,225,187,129,73,160,57,64,155,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,211,225,24,128,0,0,0,0,0,0,163,33,212,1,220,1,220,1,220,1,220,1,211,225,89,192,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,212,1,138,193,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,211,225,98,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,212,1,98,0,0,0,0,0,0,0,0,0,16,96,220,65,220,1,220,1,220,1,220,1,211,225,106,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,212,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,33,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,40,192,220,33,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,32,220,65,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,32,220,65,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,220,65,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,212,1,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,32,228,65,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,32,228,65,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,220,1,220,1,220,1,220,1,220,1,212,1,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,32,220,65,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,212,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,32,220,65,220,1,220,1,220,1,220,1,220,1,97,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,32,220,65,220,1,220,1,220,1,220,1,212,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,212,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,32,228,65,220,1,220,1,220,1,212,1,220,1,89,224,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,228,65,220,1,220,1,220,1,220,1,212,1,89,224,0,0,0,0,0,0,0,0,8,32,220,1,220,1,220,1,220,1,220,1,211,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,220,65,220,1,220,1,220,1,220,1,212,1,89,224,0,0,0,0,0,0,0,0,8,64,220,33,220,1,220,1,220,1,220,1,219,225,106,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,220,65,220,1,220,1,220,1,220,1,212,1,97,224,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,212,1,97,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,211,225,220,1,220,1,220,1,220,1,211,225,138,193,0,0,0,0,0,0,0,0,65,64,220,1,220,1,220,1,220,1,220,1,212,1,81,160,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,179,129,220,1,220,1,220,1,220,1,212,1,212,1,57,32,0,0,0,0,0,0,163,33,220,1,220,1,220,1,220,1,220,1,220,1,40,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,138,160,211,225,220,1,220,1,220,1,220,1,220,1,212,1,146,193,122,64,179,97,220,1,220,1,220,1,220,1,220,1,212,1,203,225,8,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,211,225,211,225,220,1,220,1,220,1,220,1,220,1,212,1,146,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,40,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,138,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,32,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,171,65,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,224,212,1,211,225,212,1,212,1,212,1,220,1,212,1,212,1,211,225,220,1,138,160,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,130,128,195,161,212,1,220,1,220,33,220,33,195,193,138,160,40,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,32,160,32,192,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_6_size = sizeof(digit_6) / sizeof(digit_6[0]);
-
-const unsigned int digit_7_w = 31;
-const unsigned char digit_7[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,128,179,129,179,129,179,129,179,129,179,129,179,129,179,129,187,129,179,129,187,129,179,129,179,129,179,129,179,129,179,129,179,129,179,129,106,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,0,211,225,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,122,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,0,212,1,212,1,220,1,212,1,220,1,212,1,220,1,220,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,220,1,122,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,1,211,225,212,1,212,1,212,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,220,1,122,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,0,220,1,212,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,212,1,212,1,220,1,212,1,220,1,122,96,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,0,212,1,212,1,220,1,212,1,212,1,212,1,220,1,212,1,220,1,220,1,220,1,212,1,220,1,212,1,220,1,212,1,212,1,106,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,228,65,228,65,228,65,228,65,228,65,228,65,228,65,228,65,228,65,228,65,228,65,220,1,212,1,212,1,220,1,220,1,211,225,81,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,16,64,16,64,65,96,220,1,220,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,224,212,1,220,1,220,1,220,1,220,1,220,33,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,160,212,1,220,1,220,1,220,1,220,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,97,212,1,220,1,220,1,220,1,220,1,138,192,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,212,1,220,1,220,1,220,1,220,1,220,1,106,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,220,1,73,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,128,220,1,220,1,220,1,220,1,220,1,220,33,24,160,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,96,220,1,220,1,220,1,220,1,220,1,212,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,0,220,1,220,1,220,1,220,1,220,1,171,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,161,220,1,220,1,220,1,220,1,212,1,130,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,64,212,33,212,1,220,1,220,1,220,1,212,1,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,220,1,212,1,220,1,220,1,220,1,220,1,57,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,192,212,1,220,1,220,1,220,1,220,1,220,65,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,128,212,1,220,1,220,1,220,1,220,1,203,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,220,1,220,1,220,1,163,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,225,220,1,220,1,220,1,220,1,220,1,130,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,220,33,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,64,220,1,220,1,220,1,212,1,220,1,220,1,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,220,33,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,220,1,220,1,220,1,195,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,97,220,1,220,1,220,1,220,1,220,1,155,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,1,212,1,220,1,220,1,220,1,212,1,114,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,220,1,220,1,220,1,220,1,220,1,212,1,81,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,128,212,1,220,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,96,212,1,220,1,220,1,220,1,220,1,212,1,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,224,220,1,212,1,220,1,220,1,220,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,187,193,220,1,220,1,220,1,220,1,220,1,146,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,220,33,212,1,220,1,220,1,212,1,212,1,106,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,220,33,220,1,212,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,224,211,225,220,1,220,1,220,1,220,1,220,33,24,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,128,212,1,220,1,220,1,220,1,212,1,204,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,65,212,1,220,1,220,1,220,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,225,212,1,220,1,220,1,220,1,212,1,130,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,220,33,212,1,220,1,220,1,212,1,211,225,97,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,96,220,1,220,1,220,1,220,1,220,1,220,1,49,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,32,212,1,220,1,220,1,220,1,220,1,220,33,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,192,212,1,220,1,220,1,220,1,212,1,195,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,129,212,1,220,1,220,1,212,1,220,1,163,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,220,33,220,1,220,1,220,1,212,1,212,1,122,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,220,33,220,1,220,1,220,1,220,1,220,1,89,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,192,212,1,220,1,220,1,220,1,220,1,220,1,40,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,96,212,1,220,1,220,1,220,1,220,1,212,33,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,220,1,220,1,220,1,187,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,225,220,1,220,1,220,1,220,1,212,1,154,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,220,33,220,1,220,1,220,1,220,1,212,1,114,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,64,220,1,220,1,220,1,220,1,220,1,212,1,73,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,220,1,220,1,220,1,212,1,220,1,220,33,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,161,220,1,220,1,220,1,220,1,220,1,211,225,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,97,220,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,212,1,220,1,220,1,220,1,220,1,220,1,138,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,212,1,220,1,212,1,212,1,97,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,128,212,1,212,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,64,212,1,212,1,212,1,212,1,211,225,212,33,16,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,1,211,225,211,225,211,225,211,225,211,225,195,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,224,106,0,106,0,106,0,106,0,106,0,73,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_7_size = sizeof(digit_7) / sizeof(digit_7[0]);
-
-const unsigned int digit_8_w = 31;
-const unsigned char digit_8[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,40,224,40,224,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,138,192,203,225,220,33,220,1,220,1,220,33,212,1,171,65,89,192,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,32,212,1,212,1,212,1,212,1,220,1,220,1,220,1,212,1,212,1,220,1,187,161,40,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,128,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,128,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,203,193,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,195,161,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,211,225,122,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,73,128,220,1,220,1,220,1,220,1,220,1,220,1,212,1,212,1,212,1,212,1,220,1,220,1,220,1,220,1,220,1,212,1,203,225,8,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,146,192,220,1,220,1,220,1,220,1,220,1,220,1,220,1,203,193,187,129,212,1,212,1,220,1,220,1,220,1,220,1,212,1,220,1,65,64,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,195,193,220,1,220,1,212,1,220,1,212,1,220,1,106,32,0,0,0,0,24,96,163,65,211,225,220,1,220,1,220,1,212,1,212,1,122,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,32,220,65,220,1,220,1,220,1,220,1,220,1,171,97,0,0,0,0,0,0,0,0,16,96,211,225,220,1,220,1,220,1,220,1,220,1,146,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,24,128,220,33,220,1,220,1,220,1,212,1,220,1,106,32,0,0,0,0,0,0,0,0,0,0,163,33,220,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,220,1,97,192,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,212,1,97,192,0,0,0,0,0,0,0,0,0,0,138,193,212,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,212,1,220,1,212,1,97,224,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,220,1,220,1,220,1,187,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,212,1,220,1,220,1,212,1,97,192,0,0,0,0,0,0,0,0,0,0,138,192,212,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,212,1,89,192,0,0,0,0,0,0,0,0,0,0,138,193,212,1,212,1,220,1,220,1,220,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,212,1,220,1,220,1,220,1,212,1,89,192,0,0,0,0,0,0,0,0,0,0,138,192,220,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,212,1,89,192,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,220,1,220,1,212,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,212,1,97,192,0,0,0,0,0,0,0,0,0,0,138,192,220,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,212,1,89,192,0,0,0,0,0,0,0,0,0,0,138,192,220,1,220,1,220,1,220,1,220,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,24,128,220,33,212,1,212,1,220,1,220,1,212,1,97,192,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,212,1,220,1,220,1,187,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,32,220,33,212,1,220,1,220,1,212,1,212,1,97,192,0,0,0,0,0,0,0,0,0,0,138,193,220,1,212,1,220,1,220,1,220,1,187,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,32,228,65,212,1,212,1,212,1,212,1,212,1,97,192,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,220,1,220,1,220,1,171,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,203,225,220,1,220,1,220,1,220,1,212,1,97,192,0,0,0,0,0,0,0,0,0,0,155,1,220,1,220,1,220,1,220,1,220,1,130,128,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,163,33,212,1,220,1,220,1,220,1,212,1,106,32,0,0,0,0,0,0,0,0,0,0,179,129,220,1,220,1,220,1,220,1,220,1,97,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,97,224,212,1,220,1,220,1,220,1,220,1,179,129,0,0,0,0,0,0,0,0,24,128,212,1,220,1,220,1,220,1,212,1,220,1,40,192,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,16,96,212,1,220,1,220,1,220,1,220,1,220,1,114,64,0,0,0,0,8,64,163,33,212,1,220,1,220,1,212,1,212,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,128,212,1,220,1,220,1,220,1,220,1,212,1,195,193,171,65,212,1,212,1,212,1,212,1,220,1,212,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,179,97,212,1,220,1,220,1,212,1,212,1,220,1,220,1,212,1,220,1,220,1,220,1,212,1,212,1,114,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,122,128,203,225,212,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,187,161,73,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,106,32,195,161,220,1,220,1,212,1,212,1,212,1,212,1,212,1,220,1,212,1,163,1,73,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,179,129,220,1,220,1,212,1,212,1,212,1,212,1,212,1,212,1,212,1,220,1,212,1,220,1,220,1,138,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,33,211,225,220,1,220,1,212,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,106,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,65,64,212,1,220,1,220,1,220,1,212,1,212,1,212,1,163,1,146,193,195,161,220,1,220,1,220,1,220,1,220,1,220,1,204,1,16,64,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,146,224,212,1,212,1,220,1,220,1,212,1,211,225,48,224,0,0,0,0,0,0,130,160,220,1,220,1,220,1,220,1,220,1,220,1,89,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,195,193,220,1,212,1,212,1,212,1,212,1,138,160,0,0,0,0,0,0,0,0,8,32,203,225,220,1,220,1,220,1,212,1,220,1,146,224,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,32,220,65,220,1,220,1,212,1,220,1,212,1,89,192,0,0,0,0,0,0,0,0,0,0,171,65,220,1,220,1,220,1,220,1,220,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,212,1,73,96,0,0,0,0,0,0,0,0,0,0,146,225,220,1,220,1,220,1,220,1,220,1,211,225,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,32,220,1,220,1,212,1,220,1,212,1,212,1,57,64,0,0,0,0,0,0,0,0,0,0,138,225,220,1,220,1,220,1,212,1,220,1,212,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,64,220,1,220,1,220,1,220,1,220,1,212,1,57,32,0,0,0,0,0,0,0,0,0,0,138,225,220,1,220,1,220,1,220,1,220,1,212,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,96,220,1,220,1,220,1,220,1,212,1,212,1,57,64,0,0,0,0,0,0,0,0,0,0,138,225,212,1,212,1,220,1,220,1,220,1,212,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,220,1,212,1,57,64,0,0,0,0,0,0,0,0,0,0,138,193,212,1,220,1,212,1,220,1,220,1,212,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,220,1,212,1,57,64,0,0,0,0,0,0,0,0,0,0,138,225,220,1,212,1,220,1,212,1,220,1,220,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,212,1,212,1,57,64,0,0,0,0,0,0,0,0,0,0,138,224,212,1,212,1,220,1,220,1,220,1,220,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,212,1,220,1,212,1,212,1,57,64,0,0,0,0,0,0,0,0,0,0,138,225,220,1,212,1,212,1,220,1,220,1,220,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,96,219,225,220,1,220,1,220,1,220,1,212,1,57,32,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,220,1,220,1,220,1,212,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,96,212,1,220,1,220,1,220,1,212,1,212,1,57,32,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,220,1,220,1,220,1,220,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,219,225,220,1,220,1,220,1,212,1,212,1,57,32,0,0,0,0,0,0,0,0,0,0,138,225,220,1,212,1,220,1,220,1,220,1,220,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,212,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0,138,225,220,1,220,1,220,1,220,1,220,1,220,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,220,1,220,1,57,64,0,0,0,0,0,0,0,0,0,0,138,225,220,1,220,1,220,1,220,1,220,1,220,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,220,1,212,1,57,64,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,220,1,220,1,220,1,212,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,212,1,212,1,57,32,0,0,0,0,0,0,0,0,0,0,138,193,220,1,220,1,220,1,220,1,220,1,220,1,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,57,64,220,1,220,1,220,1,220,1,212,1,212,1,65,96,0,0,0,0,0,0,0,0,0,0,138,192,220,1,220,1,220,1,220,1,220,1,220,33,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,49,0,220,1,220,1,220,1,212,1,220,1,212,1,98,0,0,0,0,0,0,0,0,0,0,0,171,65,220,1,220,1,220,1,220,1,220,1,195,193,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,16,96,220,65,220,1,212,1,220,1,220,1,220,1,163,33,0,0,0,0,0,0,0,0,16,96,212,1,220,1,212,1,220,1,220,1,220,1,171,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,203,225,220,1,212,1,212,1,220,1,220,1,220,1,81,160,0,0,0,0,0,0,146,224,212,1,220,1,212,1,212,1,212,1,220,1,130,128,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,146,192,220,1,220,1,212,1,220,1,212,1,211,225,220,1,163,33,138,193,187,129,220,1,212,1,220,1,220,1,220,1,220,1,220,1,73,128,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,57,32,220,1,212,1,220,1,220,1,220,1,212,1,212,1,212,1,212,1,220,1,220,1,212,1,220,1,212,1,212,1,212,1,203,225,8,64,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,97,212,1,220,1,212,1,220,1,220,1,212,1,220,1,212,1,220,1,212,1,220,1,220,1,212,1,212,1,212,1,114,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,212,1,212,1,220,1,220,1,212,1,220,1,220,1,212,1,212,1,220,1,220,1,220,1,220,1,212,1,187,161,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,32,204,1,211,225,212,1,212,1,212,1,212,1,212,1,220,1,212,1,212,1,212,1,212,1,195,193,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,163,33,220,33,211,225,212,1,212,1,220,1,212,1,220,1,212,1,220,33,146,192,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,122,96,163,33,195,193,203,225,195,161,155,1,106,32,24,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_8_size = sizeof(digit_8) / sizeof(digit_8[0]);
-
-const unsigned int digit_9_w = 31;
-const unsigned char digit_9[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,32,192,32,160,16,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,138,160,195,193,220,33,220,33,220,1,212,1,195,161,130,128,24,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,138,160,220,1,211,225,212,1,212,1,220,1,212,1,212,1,212,1,211,225,212,1,97,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,171,65,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,114,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,160,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,187,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,192,212,1,220,1,220,1,220,1,220,1,220,1,211,225,211,225,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,65,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,8,32,203,225,212,1,220,1,220,1,220,1,220,1,220,1,179,97,122,64,146,193,212,1,220,1,220,1,220,1,220,1,220,1,211,225,138,160,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,40,224,220,1,220,1,220,1,220,1,220,1,220,1,163,33,0,0,0,0,0,0,57,32,212,1,212,1,220,1,220,1,220,1,220,1,179,129,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,81,160,212,1,220,1,220,1,220,1,220,1,220,1,65,64,0,0,0,0,0,0,0,0,138,193,211,225,220,1,220,1,220,1,220,1,211,225,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,97,224,212,1,220,1,220,1,220,1,220,1,220,33,16,96,0,0,0,0,0,0,0,0,97,224,212,1,220,1,220,1,220,1,220,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,219,225,220,1,220,1,220,1,220,1,220,33,8,64,0,0,0,0,0,0,0,0,89,224,212,1,220,1,220,1,220,1,220,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,220,1,8,32,0,0,0,0,0,0,0,0,89,224,212,1,220,1,220,1,220,1,220,1,228,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,212,1,220,1,220,1,220,1,228,65,0,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,212,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,212,1,220,1,220,1,220,1,220,1,220,65,0,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,97,224,220,1,220,1,220,1,220,1,220,1,220,65,0,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,212,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,65,0,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,212,1,220,1,220,1,220,1,220,1,220,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,228,65,0,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,228,65,0,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,212,1,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,65,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,65,0,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,65,8,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,33,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,212,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,211,225,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,89,224,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,32,211,225,220,1,220,1,220,1,220,1,220,65,16,96,0,0,0,0,0,0,0,0,98,0,212,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,98,0,211,225,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,138,193,212,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,89,192,211,225,220,1,220,1,220,1,220,1,212,1,163,33,0,0,0,0,0,0,24,128,211,225,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,65,96,220,1,220,1,220,1,220,1,220,1,220,1,220,1,155,1,57,64,73,160,187,129,219,225,220,1,220,1,220,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,16,96,212,1,220,1,220,1,220,1,220,1,220,1,220,1,219,225,211,225,212,1,212,1,220,1,220,1,220,1,212,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,97,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,212,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,192,212,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,187,161,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,203,225,220,1,220,1,220,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,192,203,225,212,1,220,1,212,1,212,1,220,1,220,1,220,1,212,1,89,224,220,1,212,1,220,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,187,161,212,1,211,225,212,1,212,1,212,1,203,225,65,64,41,0,220,1,212,1,220,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,81,160,146,192,171,65,155,1,106,32,16,64,0,0,41,0,220,1,212,1,212,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,220,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,212,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,212,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,220,1,212,1,212,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,212,1,212,1,220,1,212,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,212,1,212,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,220,1,220,1,212,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,57,32,122,96,130,96,130,96,130,96,130,96,97,224,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,97,224,211,225,211,225,211,225,211,225,211,225,171,64,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,97,224,211,225,220,1,220,1,220,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,220,1,212,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,97,224,211,225,220,1,220,1,220,1,212,1,171,65,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,212,1,220,1,220,1,220,1,220,1,171,65,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,212,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,106,0,212,1,220,1,220,1,220,1,220,1,179,97,0,0,0,0,0,0,0,0,0,0,41,0,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,97,224,212,1,220,1,220,1,220,1,220,1,195,193,0,0,0,0,0,0,0,0,0,0,49,32,211,225,212,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,89,192,220,1,220,1,220,1,220,1,220,1,212,1,8,32,0,0,0,0,0,0,0,0,97,224,211,225,220,1,220,1,220,1,220,1,220,33,40,192,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,73,128,220,1,220,1,220,1,220,1,220,1,220,1,57,32,0,0,0,0,0,0,0,0,171,65,212,1,220,1,220,1,220,1,220,1,220,65,8,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,32,160,220,33,220,1,220,1,220,1,220,1,220,1,179,129,16,64,0,0,0,0,97,224,220,1,220,1,220,1,220,1,220,1,220,1,187,161,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,193,220,1,220,1,220,1,220,1,220,1,212,1,203,193,146,192,179,97,220,1,220,1,220,1,220,1,220,1,220,1,212,1,130,160,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,160,212,1,220,1,220,1,220,1,220,1,220,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,33,49,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,163,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,96,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,33,212,1,212,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,220,1,212,1,57,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,64,212,1,211,225,220,1,220,1,220,1,212,1,220,1,220,1,220,1,179,129,40,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,106,32,163,33,203,225,212,1,212,1,179,129,138,192,73,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t digit_9_size = sizeof(digit_9) / sizeof(digit_9[0]);
-
-const unsigned char* digits[10] PROGMEM = {
-    digit_0,
-    digit_1,
-    digit_2,
-    digit_3,
-    digit_4,
-    digit_5,
-    digit_6,
-    digit_7,
-    digit_8,
-    digit_9
-}; 
-const unsigned int digit_width[10] PROGMEM = {
-    digit_0_w,
-    digit_1_w,
-    digit_2_w,
-    digit_3_w,
-    digit_4_w,
-    digit_5_w,
-    digit_6_w,
-    digit_7_w,
-    digit_8_w,
-    digit_9_w
-}; 
-const size_t digit_size[10] PROGMEM = {
-    digit_0_size,
-    digit_1_size,
-    digit_2_size,
-    digit_3_size,
-    digit_4_size,
-    digit_5_size,
-    digit_6_size,
-    digit_7_size,
-    digit_8_size,
-    digit_9_size
-};
@@ -1,1366 +0,0 @@
-// Copyright (c) Thor Schueler. All rights reserved.
-// SPDX-License-Identifier: MIT
-/*
-This is the core GUI library for the TFT display, providing a common
-set of graphics primitives (points, lines, circles, etc.).  It needs to be
-paired with a hardware-specific library for each display device we carry
-(to handle the lower-level functions).
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
-ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
-LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
-CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
-SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
-INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
-CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
-ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#include "controller_display.h"
-
-
-const unsigned int power_x = 78;
-const unsigned int power_y = 142;
-const unsigned int power_w = 51;
-const unsigned int power_h = 55;
-const unsigned char power_on[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,34,0,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,64,25,160,0,0,0,0,0,0,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,0,0,64,0,0,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,0,0,0,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,160,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,0,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,34,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,34,224,34,64,34,64,34,64,43,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,0,43,128,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,32,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,25,224,0,0,34,64,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,17,64,0,64,34,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,17,32,0,0,0,0,17,0,35,224,35,224,35,224,17,96,0,0,0,0,0,0,25,224,35,224,35,224,43,192,0,64,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,32,0,0,0,0,0,0,25,192,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,43,160,17,0,0,0,0,0,0,0,26,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,34,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,224,0,0,0,0,0,32,34,192,35,224,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,25,160,0,0,0,0,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,64,0,0,0,0,0,0,34,128,35,224,35,224,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,25,160,0,0,0,0,8,96,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,0,0,0,0,0,25,192,35,224,35,224,35,224,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,43,192,8,192,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,32,0,0,0,0,8,96,35,160,35,224,35,224,35,224,35,224,35,224,35,224,25,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,32,0,0,0,0,0,64,43,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,192,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,0,0,0,0,0,34,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,8,160,0,0,0,0,43,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,96,0,0,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,34,160,0,0,0,0,25,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0,0,0,0,64,43,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,34,96,25,128,25,128,25,128,34,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,96,0,0,0,0,16,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,128,0,0,0,0,16,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,0,32,0,0,0,32,43,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,128,0,0,0,0,16,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,0,32,0,0,0,32,43,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,128,0,0,0,0,16,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,0,32,0,0,0,32,43,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0,0,0,8,96,43,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,128,0,0,0,0,8,128,43,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,8,160,0,0,0,0,43,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,34,160,0,0,0,0,17,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,192,0,0,0,0,25,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,96,0,0,0,0,34,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,32,0,0,0,0,8,96,43,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,96,0,32,0,0,0,32,43,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,32,0,0,0,0,25,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,32,0,0,0,0,17,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,32,0,0,0,0,0,0,34,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,0,0,0,0,0,0,32,43,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,0,0,0,0,0,0,0,34,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,0,0,0,0,0,0,0,26,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,34,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,64,0,0,0,0,0,0,17,128,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,96,17,0,0,0,0,0,0,0,25,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,96,0,0,0,0,0,0,0,32,25,160,34,224,43,192,43,224,44,0,43,224,43,160,34,192,17,96,0,32,0,0,0,0,0,0,25,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,32,0,32,0,0,0,0,0,0,0,0,0,32,0,64,0,64,0,64,0,32,0,0,0,0,0,0,0,0,0,64,34,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,96,25,96,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,25,160,43,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,128,26,96,17,64,8,128,0,32,0,32,0,32,8,96,17,32,34,96,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,43,224,43,224,43,224,43,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,34,224,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,25,160,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,0,0,32,0,0
-    ,0,0,26,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,0,0,64,0,0,0,0
-    ,0,0,34,0,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,0,17,64,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t power_on_size = sizeof(power_on) / sizeof(power_on[0]);
-const unsigned char power_off[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,106,97,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,212,194,180,2,90,1,0,0,0,0,0,0,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,162,8,64,0,0,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,162,0,0,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,81,225,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,97,122,161,122,161,122,161,171,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,196,66,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,171,194,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,98,33,0,0,122,161,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,57,64,8,64,139,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,57,64,0,0,0,0,41,0,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,220,194,8,64,0,0,0,0,90,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,57,64,0,0,0,0,0,0,90,1,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,212,162,49,32,0,0,0,0,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,98,65,0,0,0,0,0,32,147,65,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,229,3,81,225,0,0,0,0,0,0,155,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,0,0,0,0,0,0,139,1,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,229,3,81,225,0,0,0,0,16,96,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,49,32,0,0,0,0,90,1,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,228,226,40,224,0,0,0,0,106,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,0,0,0,16,96,212,162,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,179,226,0,0,0,0,8,64,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,90,1,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,49,32,0,0,0,0,147,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,24,160,0,0,0,0,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,65,0,0,0,0,73,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,130,0,0,0,0,8,64,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,73,160,73,192,81,192,147,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,0,0,0,32,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0,0,0,32,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,2,8,32,0,0,0,32,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,0,0,0,40,224,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,2,8,64,0,0,0,32,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0,0,0,32,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,8,32,0,0,0,32,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,130,0,0,0,0,16,96,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,98,0,0,0,0,24,128,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,24,160,0,0,0,0,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,65,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,89,225,0,0,0,0,98,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,128,0,0,0,0,130,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,0,0,0,16,96,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,0,0,0,0,0,204,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,57,32,0,0,0,0,81,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,57,64,0,0,0,0,65,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,179,226,0,0,0,0,0,0,139,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,106,65,0,0,0,0,0,32,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,106,65,0,0,0,0,0,0,139,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,106,65,0,0,0,0,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,2,65,128,0,0,0,0,0,0,73,160,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,49,32,0,0,0,0,0,0,90,1,237,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,65,128,0,0,0,0,0,0,8,32,89,225,163,162,212,194,229,2,237,35,229,2,212,162,155,98,73,128,0,0,0,0,0,0,0,0,90,1,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,114,129,0,32,0,0,0,0,0,0,0,0,0,32,8,64,8,64,8,64,0,32,0,0,0,0,0,0,0,0,8,64,130,193,237,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,73,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,89,225,204,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,98,122,193,65,96,16,128,0,32,0,32,0,32,16,96,57,64,130,225,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,220,226,220,226,220,226,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,130,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,163,130,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,81,225,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,32,0,0
-    ,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,162,8,64,0,0,0,0
-    ,0,0,106,97,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,226,220,194,171,194,65,128,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t power_off_size = sizeof(power_off) / sizeof(power_off[0]);
-
-const unsigned int engine_x = 78;
-const unsigned int engine_y = 142;
-const unsigned int engine_w = 85;
-const unsigned int engine_h = 127;
-const unsigned char engine_on[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,64,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,0,96,8,96,8,96,0,96,0,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,17,224,35,64,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,26,192,8,224,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,192,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,224,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,0,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,64,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,64,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,160,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,0,32,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,96,8,224,17,128,35,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,35,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,224,26,224,26,224,26,224,26,224,26,224,26,224,26,224,26,224,26,224,26,224,26,224,26,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,17,96,8,192,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,8,192,17,128,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,8,160,8,224,8,160,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,18,0,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,17,128,17,224,35,224,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,64,17,192,35,64,35,192,35,224,35,224,35,224,35,192,26,224,9,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,8,192,0,0,0,0,9,0,35,224,0,160,0,0,0,0,0,0,0,0,0,0,9,96,35,160,35,224,35,224,35,224,35,224,35,160,35,224,35,224,35,224,35,224,35,64,8,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,224,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,64,0,0,0,0,0,0,9,0,35,224,0,160,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,160,18,32,8,224,0,64,0,0,0,96,9,64,26,160,35,224,35,224,35,192,9,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,96,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,0,0,0,0,17,192,35,224,35,224,26,192,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,224,35,64,35,224,35,224,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,35,192,35,128,35,64,35,64,35,64,35,64,35,64,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,0,0,8,192,35,192,35,224,26,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,35,32,35,224,35,128,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,9,32,9,0,9,0,9,0,9,0,9,0,9,0,9,0,0,96,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,0,0,27,0,35,224,27,32,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,35,192,35,224,17,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,8,192,35,224,35,224,9,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,35,224,35,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,17,192,35,224,35,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,35,192,35,224,8,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,26,192,35,224,18,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,32,35,224,17,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,35,0,35,224,9,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,96,35,224,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,27,0,35,224,9,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,64,35,224,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,26,192,35,224,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,192,35,224,17,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,192,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,17,224,35,224,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,35,160,35,224,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,192,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,0,160,35,224,35,224,8,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,96,35,224,35,192,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,0,0,27,0,35,224,26,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,35,96,35,224,26,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,192,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,35,128,35,128,35,128,35,128,35,128,35,128,35,128,18,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,0,0,8,224,35,224,35,224,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,26,160,35,224,35,192,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,17,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,64,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,0,0,0,0,18,0,35,224,35,224,26,96,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,26,192,35,224,35,224,17,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,160,26,160,17,192,17,192,17,192,17,192,17,192,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,0,0,0,0,0,0,0,0,9,0,35,224,0,160,0,0,0,0,0,0,0,0,18,64,35,224,35,224,35,96,17,160,0,96,0,0,0,0,0,0,0,128,17,224,35,128,35,224,35,224,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,96,0,0,0,0,9,0,35,224,0,160,0,0,0,0,0,0,0,0,0,0,17,224,35,192,35,224,35,224,35,192,35,96,27,32,35,96,35,192,35,224,35,224,35,160,9,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,96,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,26,96,9,96,18,0,35,224,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,160,26,96,35,160,35,224,35,224,35,224,35,224,35,224,35,96,18,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,192,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,192,9,64,17,96,9,32,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,26,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,17,224,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,34,192,34,192,26,192,26,160,26,192,26,160,26,160,26,160,26,160,26,160,26,160,26,160,26,160,26,160,26,160,26,160,26,192,26,160,26,160,34,192,34,192,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,34,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,0
-    ,0,0,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,0
-    ,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,0,0
-    ,0,0,0,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,128,0,0
-    ,0,0,0,0,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,32,0,0
-    ,0,0,0,0,0,64,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,9,0,0,0,0,0
-    ,0,0,0,0,0,0,0,96,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,9,64,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,9,96,26,192,35,128,43,160,43,160,35,160,35,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,35,160,35,160,43,160,35,160,35,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,35,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,35,64,18,32,0,96,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t engine_on_size = sizeof(engine_on) / sizeof(engine_on[0]);
-const unsigned char engine_off[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,32,0,32,0,32,8,32,8,32,8,32,8,32,8,32,8,32,8,32,8,32,8,32,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,224,171,225,212,162,220,226,229,2,229,2,229,2,229,34,229,34,229,34,229,34,229,34,229,34,229,34,229,34,229,34,229,34,229,2,204,130,139,33,32,192,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,180,33,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,2,90,32,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,196,129,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,82,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,32,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,221,2,16,96,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,64,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,106,128,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,64,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,33,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,32,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,160,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,24,128,73,160,171,193,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,228,226,229,2,229,2,229,2,229,2,229,2,229,2,229,2,228,226,228,226,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,229,2,237,34,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,147,33,147,64,147,33,147,33,147,32,147,33,147,33,147,33,147,33,139,33,147,33,139,33,139,1,212,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,192,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,106,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,34,16,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,160,229,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,163,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,65,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,224,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,66,212,193,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,220,225,237,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,97,57,64,24,128,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,24,160,65,128,180,1,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,237,34,40,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,128,32,160,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,212,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,139,33,65,160,81,192,229,65,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,224,163,224,212,224,229,32,221,32,229,32,196,160,139,64,49,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,64,130,224,229,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,225,24,128,0,0,0,0,32,192,229,65,8,64,0,0,0,0,0,0,0,0,0,0,49,32,188,96,220,224,220,224,221,32,204,224,196,128,212,224,221,32,220,192,221,0,163,224,24,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,163,161,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,225,0,32,0,0,0,0,0,0,32,192,229,65,8,64,0,0,0,0,0,0,0,0,90,32,220,224,220,192,196,128,106,96,24,160,0,0,0,0,0,32,41,32,123,0,212,192,212,192,212,192,49,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,64,188,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,221,2,24,128,0,0,0,0,0,0,0,0,32,192,229,65,8,64,0,0,0,0,0,0,73,192,220,224,220,224,139,32,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,160,172,0,220,192,212,224,32,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,129,196,97,180,33,180,64,180,64,180,64,180,64,204,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,139,32,0,0,0,0,0,0,0,0,0,0,32,192,229,65,8,64,0,0,0,0,24,128,212,224,220,224,114,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,163,224,220,192,188,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,64,81,224,0,0,0,0,0,0,0,0,0,0,106,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,193,40,224,40,224,41,0,41,0,40,224,41,0,41,0,41,0,16,96,0,0,0,0,0,0,0,0,0,0,32,192,229,65,8,64,0,0,0,0,147,96,220,192,163,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,204,160,220,224,90,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,64,81,224,0,0,0,0,0,0,0,0,0,0,106,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,65,8,64,0,0,16,96,221,0,221,0,32,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,0,220,224,188,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,64,81,224,0,0,0,0,0,0,0,0,0,0,114,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,65,8,64,0,0,82,0,220,192,163,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,204,192,229,32,24,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,64,81,224,0,0,0,0,0,0,0,0,0,0,114,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,33,8,64,0,0,131,0,220,192,106,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,128,220,192,73,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,64,81,224,0,0,0,0,0,0,0,0,0,0,114,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,33,8,64,0,0,147,128,220,224,65,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,224,212,160,98,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,96,81,224,0,0,0,0,0,0,0,0,0,0,106,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,33,8,64,0,0,147,96,220,224,57,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,192,212,192,98,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,96,81,224,0,0,0,0,0,0,0,0,0,0,114,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,65,8,64,0,0,131,32,220,192,90,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,64,220,192,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,96,82,0,0,0,0,0,0,0,0,0,0,0,106,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,65,8,64,0,0,90,64,220,192,147,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,96,229,32,32,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,96,81,224,0,0,0,0,0,0,0,0,0,0,106,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,33,8,64,0,0,16,96,221,0,212,224,16,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,64,221,0,204,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,96,81,224,0,0,0,0,0,0,0,0,0,0,114,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,33,8,64,0,0,0,0,147,96,220,192,139,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,0,220,224,114,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,96,81,224,0,0,0,0,0,0,0,0,0,0,114,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,2,196,65,196,97,196,97,196,97,196,97,196,97,196,97,196,97,90,0,0,0,0,0,0,0,0,0,0,0,32,192,229,33,8,64,0,0,0,0,24,160,212,224,221,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,123,0,220,224,204,160,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,96,81,224,0,0,0,0,0,0,0,0,0,0,114,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,129,8,32,0,0,0,0,0,0,0,0,32,192,229,33,8,64,0,0,0,0,0,0,90,32,220,224,221,0,106,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,131,0,220,224,220,224,57,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,64,139,64,90,96,90,96,90,96,90,64,90,96,155,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,131,0,0,0,0,0,0,0,0,0,32,192,229,33,8,64,0,0,0,0,0,0,0,0,106,128,221,0,220,224,172,0,65,160,0,32,0,0,0,0,0,0,8,32,81,224,188,96,220,224,220,224,81,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,32,229,2,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,139,32,8,64,0,0,0,0,32,192,229,33,8,64,0,0,0,0,0,0,0,0,0,0,81,224,204,192,220,192,220,224,212,224,171,224,155,160,180,0,212,224,220,224,220,224,196,128,49,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,64,188,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,122,192,57,96,81,224,229,34,8,64,0,0,0,0,0,0,0,0,0,0,0,0,16,64,114,160,188,96,221,32,220,224,220,192,220,224,221,32,180,32,90,32,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,160,155,129,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,66,237,66,229,34,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,49,128,57,160,49,96,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,114,160,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,98,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,224,204,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,172,1,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,147,96,196,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,160,0,0
-    ,0,0,155,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,128,0,0
-    ,0,0,130,224,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,65,0,0
-    ,0,0,90,0,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,65,0,0
-    ,0,0,16,96,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,66,65,128,0,0
-    ,0,0,0,0,122,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,65,0,0,0,0
-    ,0,0,0,0,0,32,180,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,221,2,41,0,0,0,0,0
-    ,0,0,0,0,0,0,8,64,155,97,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,129,49,32,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,49,32,139,32,188,33,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,65,196,97,196,97,196,97,196,97,196,65,196,97,196,97,196,97,196,65,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,65,196,65,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,196,97,163,193,98,64,8,32,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t engine_off_size = sizeof(engine_off) / sizeof(engine_off[0]);
-
-const unsigned int forward_x = 166;
-const unsigned int forward_y = 142;
-const unsigned int forward_w = 68;
-const unsigned int forward_h = 46;
-const unsigned char forward_off[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,90,33,131,1,155,98,155,130,155,194,155,194,155,194,155,130,155,162,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,162,155,194,155,194,155,194,155,130,155,162,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,194,155,162,155,98,130,225,90,1,24,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,32,160,147,98,229,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,35,163,162,32,224,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,81,225,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,90,33,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,90,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,98,33,0,0,0,0,0,0
-    ,0,0,0,0,49,32,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,49,32,0,0,0,0
-    ,0,0,0,0,188,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,204,98,171,162,155,98,147,66,155,98,155,98,155,98,155,130,163,130,163,162,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,0,0,0,0
-    ,0,0,65,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,155,98,65,128,8,32,0,0,0,0,0,0,0,0,32,192,16,96,0,0,0,0,0,0,0,0,0,32,73,160,188,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,49,32,0,0
-    ,0,0,139,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,49,32,0,0,0,0,0,0,0,0,0,0,0,32,122,193,229,3,212,130,65,96,0,0,0,0,0,0,0,0,0,0,0,0,98,33,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,193,0,0
-    ,0,0,188,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,98,8,32,0,0,0,0,0,0,0,0,0,0,16,64,171,194,237,35,237,35,237,35,229,3,90,1,0,0,0,0,0,0,0,0,0,0,0,0,32,192,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,0
-    ,0,0,204,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,130,0,32,0,0,0,0,0,0,0,0,0,0,8,32,179,226,237,35,237,35,237,35,237,35,237,35,229,3,89,225,0,0,0,0,0,0,0,0,0,0,0,0,16,96,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,34,8,64,0,0,0,0,0,0,0,0,0,0,0,0,147,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,65,128,0,0,0,0,0,0,0,0,0,0,0,0,16,96,204,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,40,224,0,0,0,0,0,0,0,0,0,0,0,0,81,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,32,160,0,0,0,0,0,0,0,0,0,0,0,0,40,224,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0,0,0,0,0,0,0,0,0,0,0,8,64,212,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,16,64,0,0,0,0,0,0,0,0,0,0,0,0,106,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,81,193,0,0,0,0,0,0,0,0,0,0,0,0,8,32,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0,0,0,0,0,0,0,0,0,0,0,0,32,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,3,24,160,0,0,0,0,0,0,0,0,0,0,0,0,65,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,49,32,0,0,0,0,0,0,0,0,0,0,0,0,8,32,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,130,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,161,0,0,0,0,0,0,0,0,0,0,0,0,8,32,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,32,192,0,0,0,0,0,0,0,0,0,0,0,0,40,224,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,227,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,8,64,0,0,0,0,0,0,0,0,0,0,0,0,57,32,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,122,193,122,161,122,193,122,161,114,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,193,163,162,171,194,171,194,171,194,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,128,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,227,114,129,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,155,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,0,32,0,0,0,0,0,0,0,0,0,0,0,0,81,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,2,40,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,64,122,161,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,16,96,0,0,0,0,0,0,0,0,0,0,0,0,65,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,114,129,0,32,0,0,0,0,0,0,0,0,0,0,81,193,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,49,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,49,32,0,0,0,0,49,32,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,90,1,0,0,0,0,0,0,0,0,0,0,0,0,0,32,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,130,225,139,33,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,0,32,0,0,0,0,0,0,0,0,0,0,0,0,114,129,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,161,0,0,0,0,0,0,0,0,0,0,0,0,32,160,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,1,49,32,49,32,65,96,81,193,81,193,81,193,81,225,98,33,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,179,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,129,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,160,0,0,0,0,0,0,0,0,0,0,0,0,32,192,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,114,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,192,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,98,8,64,0,0,0,0,0,0,0,0,0,0,0,0,130,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,32,188,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,130,0,32,0,0,0,0,0,0,0,0,0,0,0,32,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,49,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,196,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,65,0,32,0,0,0,0,0,0,0,0,0,0,24,160,212,162,237,35,237,35,237,35,237,35,237,35,237,35,98,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,0,0
-    ,0,0,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,16,96,0,0,0,0,0,0,0,0,0,0,32,192,204,98,237,35,237,35,237,35,237,35,122,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,226,0,0
-    ,0,0,131,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,130,81,225,0,0,0,0,0,0,0,0,0,0,16,96,163,162,237,35,212,130,81,193,0,0,0,0,0,0,0,0,0,0,0,0,16,96,155,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,193,0,0
-    ,0,0,65,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,98,65,24,128,0,0,0,0,0,0,0,0,57,96,8,64,0,0,0,0,0,0,0,0,16,96,73,160,147,65,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,49,32,0,0
-    ,0,0,0,32,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,130,171,194,171,162,171,162,163,130,155,98,155,98,155,130,179,226,204,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,0,0,0,0
-    ,0,0,0,0,73,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,35,49,32,0,0,0,0
-    ,0,0,0,0,0,0,131,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,106,97,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,130,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,35,106,97,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,65,128,196,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,34,49,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,128,139,1,180,2,196,98,204,130,204,130,204,98,204,130,204,98,204,98,204,98,204,98,204,98,204,98,204,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,204,98,204,130,204,98,204,130,204,98,204,98,204,98,204,98,204,98,204,98,204,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,196,98,204,98,196,98,171,226,122,193,49,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const unsigned char forward_on[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,160,18,0,26,128,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,34,224,26,128,17,224,8,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,224,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,9,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,0,0,0,0,0,0,0
-    ,0,0,0,0,9,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,64,0,0,0,0
-    ,0,0,0,32,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,35,32,35,0,26,224,34,224,34,224,35,0,35,0,35,0,35,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,32,0,0
-    ,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,17,160,0,128,0,0,0,0,0,0,0,0,9,0,0,128,0,0,0,0,0,0,0,0,0,64,17,192,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,64,0,0
-    ,0,0,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,9,96,0,0,0,0,0,0,0,0,0,0,0,64,26,160,35,224,35,192,17,160,0,0,0,0,0,0,0,0,0,0,0,32,18,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,0
-    ,0,0,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,0,96,0,0,0,0,0,0,0,0,0,0,0,128,35,96,35,224,35,224,35,224,35,224,18,32,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,0,64,0,0,0,0,0,0,0,0,0,0,0,96,35,96,35,224,35,224,35,224,35,224,35,224,35,224,18,32,0,0,0,0,0,0,0,0,0,0,0,0,0,160,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,128,0,0,0,0,0,0,0,0,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,160,0,0,0,0,0,0,0,0,0,0,0,0,0,160,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,32,0,0,0,0,0,0,0,0,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,8,224,0,0,0,0,0,0,0,0,0,0,0,0,9,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,0,0,0,0,0,0,0,0,0,0,0,0,128,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,32,0,0,0,0,0,0,0,0,0,0,0,0,26,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,0,160,0,0,0,0,0,0,0,0,0,0,0,0,26,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,224,0,0,0,0,0,0,0,0,0,0,0,0,0,96,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,0,0,0,0,0,0,0,0,0,0,0,0,64,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,32,0,0,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,224,0,0,0,0,0,0,0,0,0,0,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,64,0,0,0,0,0,0,0,0,0,0,0,0,0,128,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,0,0,0,0,0,0,0,0,0,0,0,0,32,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,160,0,0,0,0,0,0,0,0,0,0,0,0,0,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,0,32,0,0,0,0,0,0,0,0,0,0,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,32,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,128,0,0,0,0,0,0,0,0,0,0,0,0,17,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,26,96,26,96,26,96,26,96,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,160,35,32,35,64,35,64,35,64,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,96,0,0,0,0,0,0,0,0,0,0,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,9,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,192,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,224,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,96,0,0,0,0,0,0,0,0,0,0,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,9,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,160,0,0,0,0,0,0,0,0,0,0,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,96,0,0,0,0,0,0,0,0,0,32,17,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,64,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,9,96,0,0,0,0,9,96,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,96,0,0,0,0,0,0,0,0,0,0,0,0,26,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,192,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,17,32,17,32,17,96,17,192,17,160,17,192,17,192,26,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,32,0,0,0,0,0,0,0,0,0,0,0,0,35,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,192,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,128,0,0,0,0,0,0,0,0,0,0,0,0,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,96,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,0,64,0,0,0,0,0,0,0,0,0,0,0,64,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,96,0,0,0,0,0,0,0,0,0,0,0,0,0,32,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,64,0,0,0,0,0,0,0,0,0,0,8,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,18,64,0,0,0,0,0,0,0,0,0,0,0,0,0,32,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,160,0,0,0,0,0,0,0,0,0,0,9,0,35,160,35,224,35,224,35,224,35,224,26,160,0,32,0,0,0,0,0,0,0,0,0,0,0,32,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,0
-    ,0,0,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,17,224,0,64,0,0,0,0,0,0,0,0,0,160,35,64,35,224,35,192,17,224,0,0,0,0,0,0,0,0,0,0,0,0,8,192,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,0
-    ,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,18,32,8,224,0,32,0,0,0,0,0,32,17,128,0,128,0,0,0,0,0,0,0,0,8,192,17,160,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,64,0,0
-    ,0,0,0,64,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,35,64,35,32,35,32,35,0,34,224,34,224,35,0,35,96,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,32,0,0
-    ,0,0,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,64,0,0,0,0
-    ,0,0,0,0,0,0,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,64,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,32,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,64,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,17,128,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,9,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,64,9,128,26,160,35,96,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,43,160,35,160,35,64,26,96,9,64,0,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t forward_off_size = sizeof(forward_off) / sizeof(forward_off[0]);
-const size_t forward_on_size = sizeof(forward_on) / sizeof(forward_on[0]);
-
-const unsigned int warning_x = 4;
-const unsigned int warning_y = 140;
-const unsigned int warning_w = 71;
-const unsigned int warning_h = 177;
-const unsigned char warning_off[] PROGMEM={
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0xc1,0x61,0xa3,0x82,0x24,0xa2,0x85,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0xa2,0xa5,0x79,0xe4,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x20,0x69,0xc3,0xc3,0x06,0xe3,0x87,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x22,0xcb,0x26,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xe4,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8a,0x44,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0xe3,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x02,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc3,0x06,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x63,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0xb2,0xe6,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x20,0x81,0xdb,0x87,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x51,0x62,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x79,0xe4,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x92,0x44,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x66,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x66,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x66,0xdb,0x66,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x84,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x66,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x64,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x65,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x9a,0x65,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xdb,0x67,0xa2,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x92,0x44,0xd3,0x47,0xd3,0x46,0xd3,0x67,0xd3,0x47,0xd3,0x67,0xd3,0x47,0xd3,0x46,0xd3,0x47,0xd3,0x46,0xd3,0x67,0xd3,0x67,0xd3,0x47,0xd3,0x46,0xd3,0x46,0xd3,0x46,0xd3,0x47,0xd3,0x46,0xd3,0x66,0xd3,0x46,0xd3,0x66,0xd3,0x46,0xd3,0x47,0xd3,0x46,0xd3,0x46,0xd3,0x47,0xd3,0x66,0xd3,0x67,0xd3,0x66,0xd3,0x46,0xd3,0x46,0xd3,0x47,0xd3,0x47,0xd3,0x46,0xd3,0x47,0xd3,0x66,0xd3,0x67,0xd3,0x66,0xd3,0x46,0xd3,0x46,0xd3,0x46,0xd3,0x67,0xd3,0x46,0xd3,0x47,0xd3,0x46,0xd3,0x66,0xd3,0x46,0xd3,0x67,0xd3,0x67,0xd3,0x66,0xd3,0x46,0xd3,0x47,0xd3,0x47,0xd3,0x46,0xd3,0x47,0xd3,0x66,0xd3,0x66,0xd3,0x46,0xd3,0x47,0xd3,0x66,0xd3,0x47,0xd3,0x47,0xd3,0x66,0xd3,0x66,0xd3,0x66,0xd3,0x67,0x9a,0x85,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-const size_t warning_off_size = sizeof(warning_off) / sizeof(warning_off[0]);
-const unsigned char warning_pending_engine[] PROGMEM={
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x08,0x00,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x88,0x00,0xc8,0x00,0xe8,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xf0,0x00,0xe8,0x00,0x08,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0xc0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0xa8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x00,0xd0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0xe0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0xd0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x65,0xfd,0x34,0xff,0x3c,0xff,0x7d,0xfe,0xdb,0xfc,0x10,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x49,0xff,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x38,0xf8,0x61,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x28,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xff,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xd3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x80,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0xb2,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xfe,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x28,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0xb0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x08,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xbe,0xf9,0xa6,0xf8,0x00,0xfc,0x30,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xba,0xf8,0x61,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0xd0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xfe,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x51,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xfe,0x9a,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x30,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1c,0xf8,0x61,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf9,0x65,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x45,0xff,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x69,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0xb2,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x59,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x18,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x55,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xff,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x6d,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x2c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xf8,0xe3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf9,0x04,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xc3,0xff,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x4d,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xfb,0xef,0xfc,0xf3,0xfb,0x0c,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xfd,0x96,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x75,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x34,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x18,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xfe,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x51,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xff,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0xaa,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x49,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf9,0x65,0xf8,0x00,0xf8,0x00,0xf9,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5d,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1c,0xf8,0x82,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xfe,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x10,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xfb,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xb2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x30,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xba,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xe3,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x59,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xa6,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xf9,0xe7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x65,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xdf,0xfa,0x08,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x55,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x31,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xba,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x18,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xd3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xff,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x92,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xfe,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x10,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x2c,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1c,0xf8,0x82,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0xba,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x8e,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x28,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xbe,0xf9,0x45,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xc3,0xff,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0xaa,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x96,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0xeb,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x18,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x34,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x96,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x14,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x08,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xa2,0xff,0x3c,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x4d,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x28,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0x7d,0xf9,0x04,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x10,0xff,0xff,0xff,0xff,0xff,0xff,0xf9,0x65,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0xaa,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xf9,0x04,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xfe,0xdb,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x4d,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x8e,0xff,0xff,0xff,0xff,0xff,0xbe,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x96,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x75,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x51,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0x38,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0xaa,0xff,0xff,0xff,0xff,0xff,0x9e,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xff,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0xaa,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xa6,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xbe,0xf9,0x65,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xe3,0xff,0x9e,0xff,0xff,0xfd,0x75,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x8e,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xf8,0x82,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0xef,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xfa,0x49,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x59,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xf3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xba,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xfb,0xcf,0xfc,0xf3,0xfa,0xeb,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xa6,0xff,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x49,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x65,0xff,0x9e,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x08,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x79,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x92,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x51,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xfb,0xf8,0x82,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x38,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xd3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x28,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xfe,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0xd3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5d,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x49,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xfa,0x28,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x45,0xff,0xbe,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0xcb,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x51,0xff,0xff,0xff,0xff,0xff,0x7d,0xfa,0x49,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x34,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xba,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x92,0xff,0xff,0xff,0xff,0xff,0xff,0xfd,0x55,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x65,0xfa,0x8a,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xc3,0xff,0x5d,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x69,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0x18,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0x69,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x92,0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x8e,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x75,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xfb,0xfd,0x96,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x71,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfc,0x92,0xfd,0x14,0xff,0x7d,0xff,0xff,0xff,0xff,0xff,0xff,0xfa,0xaa,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x49,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfe,0xdb,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x6d,0xff,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xf9,0xa6,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x86,0xfc,0x71,0xfe,0x38,0xfe,0x59,0xfe,0x9a,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xff,0x3c,0xfe,0x59,0xfc,0x51,0xf8,0xe3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0xd3,0xfd,0x55,0xfd,0xb6,0xf9,0x86,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xfa,0x8a,0xf8,0x00,0xf8,0xc3,0xfb,0xcf,0xf8,0x00,0xf8,0xe3,0xfc,0xf3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xfe,0x79,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf8,0x00,0xf9,0x24,0xfb,0x0c,0xf9,0x86,0xf8,0x00,0xfb,0x0c,0xfe,0x38,0xfa,0xaa,0xfb,0x8e,0xfe,0x59,0xfa,0x8a,0xfa,0x8a,0xf9,0xc7,0xf8,0x00,0xf9,0xe7,0xf9,0x04,0xfb,0x0c,0xf8,0xc3,0xf8,0x00,0xf8,0x20,0xfa,0x8a,0xfa,0xcb,0xfa,0x8a,0xf8,0x41,0xf9,0x24,0xfb,0x0c,0xf9,0x45,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0xd7,0xfc,0x92,0xf8,0xc3,0xf8,0x00,0xf9,0x45,0xfd,0xb6,0xfa,0x08,0xfd,0x96,0xf9,0xc7,0xfb,0x4d,0xfe,0x59,0xfa,0xeb,0xfb,0xcf,0xfe,0x59,0xfa,0xeb,0xfb,0x6d,0xfd,0xb6,0xf8,0x00,0xfe,0x38,0xfc,0xd3,0xfb,0x0c,0xfe,0x38,0xf8,0x00,0xfc,0x71,0xfb,0x2c,0xfb,0xef,0xfd,0x96,0xf8,0x82,0xfe,0x38,0xfa,0x08,0xfa,0x69,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfb,0x4d,0xfe,0xdb,0xfa,0x08,0xfb,0xef,0xfd,0x14,0xfb,0x8e,0xfd,0x14,0xfb,0xcf,0xf9,0x24,0xfd,0x55,0xf8,0x00,0xf9,0x45,0xfd,0x55,0xf8,0x00,0xf8,0xc3,0xfd,0xb6,0xf8,0x00,0xfe,0x18,0xf8,0x41,0xf8,0x00,0xfe,0x18,0xf8,0x61,0xfd,0x55,0xf9,0x04,0xf9,0xc7,0xfc,0xb2,0xf8,0x20,0xfe,0x18,0xfb,0x4d,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x69,0xfc,0xf3,0xfb,0xef,0xfb,0xcf,0xf9,0x65,0xf9,0x45,0xf8,0x61,0xf9,0x24,0xfd,0x55,0xf8,0x00,0xf9,0x45,0xfd,0x55,0xf8,0x00,0xf8,0xc3,0xfd,0xb6,0xf8,0x00,0xfe,0x18,0xf8,0x41,0xf8,0x00,0xfd,0xf7,0xf8,0x61,0xfd,0x14,0xfc,0xd3,0xfc,0xd3,0xf8,0xe3,0xf8,0x00,0xf8,0x41,0xfb,0x2c,0xfd,0xd7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x45,0xfc,0x92,0xfa,0xcb,0xfd,0x96,0xfa,0xaa,0xf9,0x86,0xfd,0xf7,0xfa,0x49,0xfa,0xeb,0xf9,0x45,0xf8,0x82,0xfe,0x9a,0xfa,0x8a,0xf8,0xc3,0xfe,0x79,0xfa,0x8a,0xf8,0xc3,0xfd,0xb6,0xf8,0x00,0xfe,0x18,0xf8,0x41,0xf8,0x00,0xfd,0xf7,0xf8,0x61,0xfd,0x55,0xfd,0x14,0xfc,0x92,0xfa,0xaa,0xf8,0xc3,0xfb,0x6d,0xfa,0x69,0xfd,0xf7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xc7,0xfb,0x0c,0xf9,0x86,0xf8,0x00,0xf8,0x00,0xf9,0x24,0xfb,0x0c,0xfa,0x49,0xf8,0x41,0xf8,0x00,0xf9,0xc7,0xfa,0x69,0xf8,0x00,0xf9,0xc7,0xfa,0x69,0xf8,0x20,0xf9,0xc7,0xf8,0x00,0xf9,0xe7,0xf8,0x00,0xf8,0x00,0xf9,0xe7,0xf8,0x41,0xfd,0xf7,0xf8,0xa2,0xf8,0xc3,0xfe,0x59,0xf8,0xa2,0xfa,0x49,0xfa,0xcb,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x75,0xfc,0x92,0xfc,0xd3,0xfc,0xf3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xf8,0x61,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xe3,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0xf3,0xf9,0x86,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x8e,0xfa,0x8a,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xc3,0xf8,0x82,0xf8,0x00,0xfc,0xf3,0xf9,0xc7,0xf8,0xe3,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xf8,0xe3,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xf8,0x00,0xf8,0xe3,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xf8,0xe3,0xf8,0x82,0xf8,0x20,0xf8,0x00,0xf8,0x82,0xf8,0xc3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xf8,0x41,0xf8,0x00,0xf8,0x61,0xf8,0xc3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x51,0xfd,0x14,0xfd,0x75,0xf9,0x86,0xfc,0xf3,0xfd,0xf7,0xfc,0xd3,0xfe,0x38,0xf8,0x20,0xfa,0x49,0xfc,0xf3,0xfc,0xd3,0xfd,0x55,0xf8,0x00,0xfc,0x92,0xfd,0xb6,0xfc,0xd3,0xfe,0x59,0xf8,0x41,0xf9,0xe7,0xfd,0x96,0xfc,0xd3,0xff,0x1c,0xf9,0x86,0xfb,0x2c,0xfd,0x34,0xfc,0xd3,0xfc,0x71,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0xcf,0xfa,0x8a,0xf9,0xc7,0xfd,0xb6,0xfc,0x51,0xf9,0xc7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xfe,0x18,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0xf3,0xfa,0x08,0xf8,0x00,0xfd,0x75,0xf9,0x24,0xf8,0x00,0xf8,0x61,0xf9,0x04,0xfe,0xba,0xf8,0x00,0xfc,0x92,0xfa,0x69,0xf8,0x00,0xfd,0x34,0xf9,0x65,0xfc,0x10,0xfa,0x28,0xf8,0x41,0xfd,0xf7,0xf8,0x00,0xfe,0x9a,0xf9,0xa6,0xf9,0x86,0xfe,0x9a,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xfb,0xcf,0xfa,0x8a,0xfa,0x8a,0xfd,0x14,0xf8,0x82,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xfd,0xb6,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0xf3,0xf9,0x65,0xf8,0x00,0xfd,0x14,0xf9,0x45,0xfa,0xaa,0xfd,0x55,0xfb,0xef,0xff,0x1c,0xf8,0x00,0xfc,0x92,0xf9,0xc7,0xf8,0x00,0xfc,0xd3,0xf9,0x86,0xfb,0x2c,0xfd,0xf7,0xfd,0x34,0xfb,0x2c,0xf8,0x20,0xff,0x1c,0xfb,0x8e,0xfb,0x6d,0xfb,0x2c,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xfb,0xcf,0xfa,0x8a,0xf8,0x00,0xfa,0xcb,0xfd,0xf7,0xfa,0x28,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x9a,0xf9,0x65,0xf9,0xa6,0xf9,0x65,0xfc,0xf3,0xf9,0x65,0xf8,0x00,0xfd,0x14,0xf9,0x45,0xfc,0xf3,0xfa,0x49,0xf9,0x45,0xff,0x1c,0xf8,0x00,0xfc,0x92,0xf9,0xc7,0xf8,0x00,0xfc,0xd3,0xf9,0x86,0xfc,0x71,0xfb,0xef,0xfb,0x0c,0xf9,0x65,0xf8,0x00,0xfd,0xf7,0xf9,0xc7,0xf8,0x61,0xf9,0x65,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0xcf,0xfa,0x8a,0xf9,0x65,0xf8,0xa2,0xfa,0xeb,0xfc,0x30,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xa6,0xfc,0xd3,0xfc,0x30,0xf8,0x82,0xfa,0xcb,0xf8,0xc3,0xf8,0x00,0xfa,0xeb,0xf8,0xa2,0xf9,0x04,0xfc,0x92,0xfb,0xcf,0xfb,0x8e,0xf8,0x00,0xfa,0xaa,0xf9,0x04,0xf8,0x00,0xfa,0xcb,0xf8,0xe3,0xfc,0x71,0xfb,0x0c,0xfa,0x8a,0xfd,0xf7,0xf9,0x86,0xf8,0xe3,0xfc,0x71,0xfc,0xd3,0xfb,0x0c,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x28,0xf9,0x65,0xf9,0xa6,0xfc,0xd3,0xfc,0x30,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x96,0xfb,0x4d,0xfa,0x69,0xfd,0xf7,0xf9,0x04,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xfa,0x28,0xfa,0x8a,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xf8,0x61,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x6d,0xfb,0x2c,0xf9,0x24,0xfc,0xd3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xf8,0x00,0xf8,0xc3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xf8,0x00,0xf8,0xa2,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xf8,0xa2,0xfb,0x6d,0xfb,0x2c,0xf8,0x00,0xf8,0xc3,0xf8,0x00,0xf8,0x41,0xf8,0x00,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xf8,0x82,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0xf7,0xfd,0x14,0xfd,0x34,0xfd,0x34,0xf8,0x00,0xfa,0x08,0xfd,0x96,0xfc,0xb2,0xfc,0xd3,0xf8,0x00,0xfc,0xd3,0xfd,0x34,0xfd,0x34,0xfd,0xf7,0xf8,0x00,0xf9,0x24,0xfe,0x38,0xfd,0x14,0xfe,0x9a,0xfb,0x2c,0xf8,0xe3,0xfd,0x34,0xf8,0x00,0xfe,0x18,0xfd,0x14,0xfd,0x75,0xfc,0xb2,0xf8,0x00,0xfb,0x2c,0xfd,0x14,0xfd,0xd7,0xfe,0x18,0xf8,0x61,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0x59,0xf8,0xc3,0xf8,0x00,0xfe,0x18,0xf8,0xe3,0xfd,0xf7,0xf9,0xa6,0xf9,0x04,0xfe,0x18,0xf8,0xc3,0xfc,0xf3,0xfa,0x28,0xf8,0x00,0xfd,0x96,0xf9,0x24,0xfc,0x51,0xfa,0x8a,0xf8,0x00,0xfb,0xef,0xfb,0x2c,0xf8,0xe3,0xfd,0x75,0xf8,0x00,0xfe,0x79,0xf8,0xa2,0xf8,0x00,0xfe,0x79,0xf8,0x20,0xfd,0xf7,0xf8,0x41,0xf9,0xc7,0xfc,0x92,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0x38,0xf8,0x41,0xf8,0x00,0xfd,0x55,0xf9,0x65,0xfe,0xba,0xfc,0x30,0xfb,0xcf,0xfb,0xae,0xf8,0x61,0xfc,0xf3,0xf9,0x65,0xf8,0x00,0xfd,0x14,0xf9,0x45,0xfc,0xf3,0xf9,0xa6,0xf8,0x00,0xfb,0x4d,0xfb,0x2c,0xf8,0xe3,0xfd,0x75,0xf8,0x00,0xfe,0x79,0xf8,0x00,0xf8,0x00,0xfe,0x18,0xf8,0x20,0xfd,0x14,0xfd,0x34,0xfd,0x96,0xf9,0xe7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0x9a,0xfa,0x8a,0xf8,0xc3,0xfe,0xba,0xf8,0x41,0xfd,0x55,0xfa,0x28,0xf8,0x00,0xf9,0x24,0xf8,0x00,0xfc,0xf3,0xf9,0x65,0xf8,0x00,0xfd,0x14,0xf9,0x45,0xfb,0xae,0xfb,0xef,0xf8,0x61,0xfd,0xd7,0xfb,0x2c,0xf8,0xe3,0xfd,0x75,0xf8,0x00,0xfe,0x79,0xf8,0x00,0xf8,0x00,0xfe,0x38,0xf8,0x41,0xfd,0xf7,0xfb,0x0c,0xfa,0x69,0xf8,0x82,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0x38,0xfb,0xcf,0xfd,0x55,0xfa,0x08,0xf8,0x00,0xf8,0xa2,0xfc,0x92,0xfd,0x34,0xfb,0xef,0xf8,0x00,0xfb,0x0c,0xf8,0xe3,0xf8,0x00,0xfb,0x2c,0xf8,0xc3,0xf8,0x61,0xfc,0x71,0xfd,0x14,0xfa,0xeb,0xf9,0xe7,0xf8,0x82,0xfb,0x6d,0xf8,0x00,0xfb,0xef,0xf8,0x00,0xf8,0x00,0xfb,0xcf,0xf8,0x41,0xfd,0x75,0xfa,0xcb,0xfb,0x2c,0xfe,0x79,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0x18,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xfe,0x79,0xfa,0x49,0xfa,0x8a,0xfd,0xf7,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x49,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xfa,0xeb,0xfa,0xaa,0xf8,0x82,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0xef,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x45,0xfc,0x51,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x69,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x86,0xfd,0x14,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x28,0xfd,0x34,0xfd,0x55,0xf9,0xa6,0xf8,0x00,0xfc,0xb2,0xfc,0x30,0xfd,0xd7,0xfa,0xaa,0xf8,0x00,0xfa,0x08,0xfd,0x34,0xfd,0xb6,0xfd,0x96,0xf8,0x20,0xfc,0xd3,0xf8,0x00,0xfb,0xcf,0xfb,0xcf,0xfd,0xb6,0xfc,0x30,0xf8,0x00,0xf8,0x61,0xfc,0xb2,0xfd,0x34,0xfc,0x30,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x30,0xfd,0xb6,0xfc,0xf3,0xfd,0x14,0xf8,0x00,0xfa,0x69,0xfd,0x34,0xfd,0x55,0xf9,0x86,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x38,0xf8,0x61,0xf8,0xc3,0xfe,0x18,0xf8,0x00,0xfe,0xba,0xf9,0xa6,0xf8,0xa2,0xfe,0x79,0xf8,0x00,0xfd,0xd7,0xf8,0x61,0xfa,0x49,0xfc,0x10,0xf8,0x00,0xfe,0x59,0xf8,0x00,0xfc,0xf3,0xfb,0x6d,0xf8,0x00,0xfe,0x18,0xf8,0xc3,0xfb,0xae,0xfb,0x0c,0xf8,0x00,0xfc,0xb2,0xfa,0x28,0xf8,0x00,0xf8,0x00,0xf9,0xe7,0xfd,0x34,0xf8,0x00,0xfb,0x4d,0xfd,0x14,0xf8,0x41,0xfe,0x18,0xf8,0x41,0xf9,0x04,0xfd,0xd7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xff,0x1c,0xfc,0xf3,0xfc,0xf3,0xfc,0xf3,0xf8,0x00,0xfe,0x38,0xf8,0x20,0xf8,0x00,0xfe,0x59,0xf8,0x00,0xfd,0x55,0xfb,0x8e,0xfd,0x14,0xfa,0xaa,0xf8,0x00,0xfe,0x59,0xf8,0x00,0xfc,0xf3,0xf9,0x65,0xf8,0x00,0xfd,0x14,0xf9,0x45,0xfd,0x34,0xfd,0x96,0xfc,0xf3,0xfd,0x55,0xf9,0xe7,0xf8,0x00,0xf8,0x00,0xfb,0x2c,0xfb,0x8e,0xf8,0x00,0xf9,0x86,0xfd,0x14,0xf9,0x45,0xfe,0xfb,0xfc,0xf3,0xfc,0xf3,0xfc,0xb2,0xf9,0x86,0xfd,0x34,0xfd,0x14,0xf8,0x61,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xfe,0x79,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0x38,0xf8,0x20,0xf8,0x00,0xfe,0x59,0xf8,0x00,0xfe,0x38,0xfa,0xaa,0xf9,0xc7,0xf8,0x00,0xf8,0x00,0xfe,0x59,0xf8,0x00,0xfc,0xf3,0xf9,0x65,0xf8,0x00,0xfd,0x14,0xf9,0x45,0xfc,0x51,0xfa,0xaa,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x69,0xfc,0xb2,0xf8,0x00,0xfa,0xaa,0xfd,0x14,0xf8,0x82,0xfe,0x59,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x0c,0xfd,0x96,0xfd,0x14,0xfb,0xae,0xf8,0x00,0xfd,0x75,0xf8,0x20,0xf8,0x00,0xfd,0x96,0xf8,0x00,0xfd,0xb6,0xfc,0x92,0xfd,0x14,0xfd,0x55,0xf8,0x00,0xfd,0x96,0xf8,0x00,0xfc,0x51,0xf9,0x24,0xf8,0x00,0xfc,0x92,0xf9,0x04,0xf8,0xc3,0xfd,0x75,0xfd,0x14,0xfd,0x34,0xf8,0xe3,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfd,0x55,0xfd,0x75,0xfc,0x71,0xfc,0x71,0xf8,0x00,0xfb,0x6d,0xfd,0x75,0xfd,0x14,0xfb,0x6d,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xa2,0xfe,0x38,0xf8,0x61,0xf8,0xc3,0xfe,0x79,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0xcb,0xfc,0x92,0xfc,0x71,0xf9,0x86,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0xaa,0xf9,0x04,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x8a,0xf9,0x24,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x08,0xf8,0xc3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0x71,0xf9,0x45,0xf8,0x00,0xf9,0xe7,0xf8,0xe3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xe7,0xfd,0x14,0xfd,0x34,0xf9,0x65,0xf8,0x00,0xfc,0x51,0xfb,0xef,0xfd,0xd7,0xfa,0x69,0xf8,0x00,0xf8,0xe3,0xfc,0xf3,0xfd,0x55,0xfa,0x8a,0xf8,0x00,0xfb,0xae,0xfb,0xcf,0xfd,0x75,0xf8,0x82,0xfc,0xd3,0xfd,0x55,0xfd,0x96,0xf9,0xc7,0xfb,0x6d,0xf9,0x24,0xfa,0xcb,0xfd,0x75,0xfd,0x96,0xf9,0xe7,0xfa,0x28,0xfd,0x34,0xfd,0x75,0xfa,0x28,0xfa,0x08,0xff,0x1c,0xfd,0xf7,0xfd,0x75,0xfd,0x96,0xf9,0x45,0xf8,0x00,0xfb,0xcf,0xfd,0x75,0xfd,0x14,0xf8,0xc3,0xf8,0x00,0xfc,0x92,0xfc,0x51,0xfd,0xb6,0xf9,0xc7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x18,0xf8,0x61,0xf8,0xe3,0xfd,0xf7,0xf8,0x00,0xfe,0xba,0xf9,0xe7,0xf8,0xc3,0xfe,0x59,0xf8,0x00,0xfd,0x55,0xf9,0x65,0xf8,0x20,0xfe,0x59,0xf8,0x41,0xfd,0x34,0xfb,0xcf,0xf8,0x41,0xfb,0xae,0xfa,0xaa,0xf8,0x41,0xfe,0x18,0xf8,0x00,0xfc,0xb2,0xf9,0xa6,0xf8,0x00,0xf8,0x41,0xfe,0x18,0xf8,0xc3,0xf9,0x04,0xf8,0x20,0xf9,0x04,0xfd,0xd7,0xf8,0x00,0xfd,0x14,0xf9,0x86,0xf8,0x00,0xfc,0x92,0xfa,0x08,0xfa,0xaa,0xfc,0x92,0xf8,0x00,0xfa,0x49,0xfd,0x34,0xf8,0x00,0xff,0x5d,0xf9,0x45,0xf9,0x45,0xfd,0xb6,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xff,0x1c,0xfd,0x14,0xfc,0xf3,0xfd,0x55,0xf8,0x00,0xfe,0x38,0xf8,0x20,0xf8,0x00,0xfe,0x59,0xf8,0x00,0xfe,0xfb,0xfd,0x34,0xfc,0xf3,0xfd,0xb6,0xf8,0xa2,0xfd,0x34,0xf9,0x24,0xf8,0x00,0xfa,0xeb,0xfc,0xf3,0xfb,0x0c,0xfd,0x55,0xf8,0x00,0xfc,0xb2,0xf9,0xa6,0xf8,0x00,0xfc,0x10,0xfb,0x2c,0xf8,0x00,0xf9,0xa6,0xfc,0xd3,0xfd,0x14,0xfe,0x38,0xf8,0x00,0xfd,0x14,0xf9,0x65,0xf8,0x00,0xfc,0x92,0xfa,0x08,0xfc,0x51,0xfa,0x69,0xf8,0x00,0xf8,0x61,0xfe,0x59,0xf8,0x00,0xfe,0x79,0xf8,0x00,0xf8,0x61,0xfd,0xf7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xfe,0x59,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0x38,0xf8,0x20,0xf8,0x00,0xfe,0x59,0xf8,0x00,0xfe,0x18,0xf8,0xc3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x34,0xf9,0x24,0xf8,0x00,0xfc,0x71,0xfb,0x8e,0xfa,0xcb,0xf8,0x41,0xf8,0x00,0xfc,0xb2,0xf9,0xa6,0xf9,0x45,0xfd,0xd7,0xf8,0x20,0xf8,0x00,0xfe,0x18,0xf8,0xc3,0xf8,0xa2,0xfe,0x18,0xf8,0x00,0xfc,0xf3,0xf9,0x86,0xf8,0x00,0xfc,0x92,0xfa,0x08,0xfb,0x8e,0xfb,0x8e,0xf8,0x00,0xf9,0x86,0xfd,0x55,0xf8,0x00,0xfe,0x79,0xf8,0x00,0xf8,0x61,0xfd,0xf7,0xf8,0x00,0xf8,0xc3,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x6d,0xfd,0x96,0xfd,0x14,0xfb,0xae,0xf8,0x00,0xfd,0xb6,0xf8,0x20,0xf8,0x00,0xfd,0xd7,0xf8,0x00,0xfa,0x08,0xfd,0xd7,0xfc,0xf3,0xfc,0xd3,0xf8,0x00,0xfc,0xd3,0xf9,0x24,0xf8,0x00,0xfb,0x6d,0xfd,0xb6,0xfc,0xf3,0xfd,0xd7,0xf8,0xe3,0xfc,0x71,0xf9,0x86,0xfc,0x30,0xfe,0x38,0xfd,0x75,0xfa,0x8a,0xfb,0xae,0xfd,0x55,0xfc,0xd3,0xfd,0x96,0xf8,0x00,0xfa,0xcb,0xfe,0x18,0xfa,0x8a,0xfc,0x30,0xf9,0xc7,0xf8,0x82,0xfd,0x96,0xfd,0x34,0xfd,0xb6,0xf9,0x45,0xf8,0x00,0xfd,0xf7,0xf8,0x00,0xf8,0x41,0xfd,0x96,0xf8,0x00,0xfd,0x34,0xf9,0xe7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0xd7,0xf9,0x04,0xf8,0x20,0xfc,0xf3,0xfa,0x08,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xc7,0xfc,0xd3,0xfc,0xd3,0xfb,0x4d,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xa2,0xf9,0x65,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xf9,0x86,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0xef,0xfd,0xd7,0xfd,0xd7,0xf9,0x45,0xfa,0x08,0xfc,0x92,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xa6,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x86,0xfd,0x14,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xfe,0x79,0xf8,0x00,0xf8,0x20,0xf8,0x41,0xfa,0x08,0xfc,0xb2,0xf9,0x65,0xf9,0x65,0xf8,0x00,0xf8,0x00,0xf9,0x45,0xf8,0x00,0xf8,0x00,0xf9,0x24,0xf8,0x61,0xfd,0x34,0xfb,0x4d,0xf8,0xc3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xa2,0xfa,0x08,0xfa,0x28,0xfd,0x14,0xf8,0x00,0xf8,0x00,0xf9,0xa6,0xf9,0xc7,0xf8,0x20,0xf8,0x20,0xf9,0x24,0xf8,0x00,0xf8,0x61,0xf8,0xe3,0xf8,0x00,0xf8,0x82,0xf8,0xc3,0xf8,0xc3,0xf8,0x61,0xf9,0xe7,0xf8,0xe3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfe,0x59,0xfb,0x8e,0xf8,0x41,0xf8,0x00,0xfa,0x08,0xff,0x1c,0xfc,0x30,0xfe,0x18,0xfa,0x49,0xf8,0x41,0xfe,0x38,0xf8,0x00,0xf8,0x61,0xfd,0xf7,0xf9,0x24,0xfe,0x38,0xfd,0x14,0xf9,0xe7,0xf8,0x00,0xf8,0x00,0xf8,0xa2,0xfe,0x59,0xfb,0xae,0xfe,0x18,0xfd,0x14,0xf8,0x00,0xfd,0x34,0xfc,0x30,0xfc,0x10,0xfd,0x96,0xf8,0x61,0xfe,0x59,0xf8,0x00,0xfb,0x2c,0xfd,0xd7,0xf8,0x00,0xfb,0xcf,0xfa,0xaa,0xfc,0x10,0xfd,0xf7,0xfb,0xcf,0xfe,0x9a,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x82,0xfc,0x51,0xfe,0x9a,0xf9,0x65,0xfa,0x08,0xfc,0xb2,0xf8,0x00,0xfa,0x69,0xfc,0x30,0xf8,0x41,0xfe,0x38,0xf8,0x00,0xf8,0x61,0xfd,0xf7,0xf8,0x00,0xfc,0x71,0xfa,0x08,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0xcb,0xfc,0x10,0xf8,0x00,0xf9,0xa6,0xfd,0x14,0xf9,0x04,0xfd,0xd7,0xf8,0x00,0xf8,0x00,0xfd,0xd7,0xf9,0x04,0xfd,0x55,0xf9,0x45,0xfd,0x14,0xfe,0x18,0xf8,0x61,0xfd,0xd7,0xf8,0x82,0xfc,0x10,0xfa,0x8a,0xf8,0x00,0xfc,0x92,0xfa,0x08,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0xcb,0xfc,0xd3,0xfa,0x08,0xfc,0x71,0xf8,0x00,0xfa,0x28,0xfc,0x30,0xf8,0x41,0xfe,0x38,0xf8,0x00,0xf8,0x61,0xfd,0xf7,0xf8,0x00,0xfc,0x71,0xf9,0xe7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfb,0x0c,0xfb,0x8e,0xf8,0x00,0xf9,0x86,0xfd,0x14,0xf9,0x45,0xfd,0x75,0xf8,0x00,0xf8,0x00,0xfd,0x75,0xf9,0x24,0xfa,0xeb,0xfb,0xcf,0xfd,0x55,0xfb,0xae,0xfb,0x2c,0xfd,0x75,0xf8,0x00,0xfc,0x10,0xfa,0x49,0xf8,0x00,0xfc,0x51,0xfa,0x08,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x24,0xfb,0x8e,0xf9,0xc7,0xfd,0x14,0xfb,0x4d,0xfa,0x08,0xfc,0x71,0xf8,0x00,0xfa,0x28,0xfc,0x30,0xf8,0x00,0xfe,0x9a,0xfa,0x08,0xfc,0x71,0xfd,0xf7,0xf8,0x00,0xfb,0xef,0xfb,0xcf,0xf9,0x04,0xf8,0x00,0xf8,0x00,0xf9,0x65,0xfe,0x38,0xf9,0xa6,0xfd,0x34,0xfd,0x14,0xf8,0x20,0xfe,0x79,0xfa,0x28,0xfa,0x49,0xfe,0x38,0xf8,0x00,0xf8,0xa2,0xfe,0xfb,0xfb,0xcf,0xf9,0x45,0xff,0x3c,0xfb,0x2c,0xf8,0x00,0xfc,0x10,0xfa,0x49,0xf8,0x00,0xfc,0x51,0xfa,0x08,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xfa,0xaa,0xfc,0x10,0xfa,0x8a,0xf8,0x00,0xf8,0xe3,0xf9,0xe7,0xf8,0x00,0xf8,0xe3,0xf9,0xe7,0xf8,0x00,0xf9,0x65,0xfb,0xef,0xf9,0xc7,0xfa,0x8a,0xf8,0x00,0xf8,0xa2,0xfb,0xcf,0xf9,0xc7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0x28,0xfb,0xef,0xf9,0x65,0xfa,0x49,0xf8,0x00,0xf8,0xe3,0xfb,0xcf,0xfb,0x8e,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xfa,0xeb,0xf8,0xe3,0xf8,0x00,0xfb,0x6d,0xf8,0x82,0xf8,0x00,0xf9,0xc7,0xf9,0x04,0xf8,0x00,0xf9,0xe7,0xf8,0xe3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xa2,0xf8,0xe3,0xf8,0x20,0xf9,0xa6,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xa6,0xf8,0x61,0xf8,0x00,0xfb,0xef,0xfa,0x8a,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfe,0x18,0xf8,0x41,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfa,0xcb,0xfb,0xae,0xf8,0x82,0xfd,0xd7,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xfd,0x96,0xfa,0x49,0xf8,0x61,0xfb,0xef,0xfa,0xcb,0xf9,0x65,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0x61,0xf9,0xa6,0xf8,0x82,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xa2,0xf9,0xa6,0xf8,0x41,0xf8,0x20,0xf8,0xa2,0xf8,0xc3,0xf9,0x65,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xf8,0x00,0xf8,0xa2,0xf8,0x41,0xf9,0x86,0xf8,0x82,0xf8,0x00,0xf8,0x00,0xf8,0xa2,0xf9,0x86,0xfa,0xeb,0xfb,0xae,0xf8,0x82,0xfd,0xd7,0xf8,0x00,0xf8,0x00,0xf9,0x24,0xf9,0x65,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0xa6,0xfe,0xba,0xfc,0xf3,0xf9,0xc7,0xfb,0xef,0xfe,0x59,0xfc,0x30,0xfe,0x9a,0xf8,0xa2,0xf8,0xc3,0xfd,0xd7,0xfb,0x6d,0xfd,0xd7,0xf9,0x24,0xf8,0x00,0xf8,0x00,0xf8,0xe3,0xfd,0xd7,0xfb,0x6d,0xfa,0x69,0xf8,0xe3,0xfe,0xdb,0xfc,0xb2,0xfd,0x34,0xfc,0x10,0xf8,0x00,0xfe,0x38,0xf8,0x20,0xfc,0x71,0xfd,0xb6,0xfc,0x30,0xfe,0x9a,0xf8,0x61,0xf9,0x45,0xfe,0x79,0xfc,0x30,0xfe,0x9a,0xfb,0xae,0xf8,0x82,0xfd,0xd7,0xf8,0x00,0xfb,0xef,0xfc,0x92,0xfc,0x51,0xfc,0x71,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x55,0xf9,0x24,0xf8,0x00,0xfb,0xef,0xfa,0xcb,0xf8,0x00,0xfc,0x71,0xfa,0x28,0xfb,0x8e,0xfc,0x71,0xfa,0x28,0xfc,0x30,0xfb,0xae,0xf8,0x00,0xf8,0x00,0xf9,0x24,0xfe,0x18,0xf9,0x24,0xf8,0x00,0xf8,0xe3,0xfd,0xd7,0xf8,0x00,0xf8,0x41,0xfe,0x9a,0xf8,0x00,0xfe,0x38,0xf8,0x20,0xfc,0x71,0xfa,0x49,0xf8,0x00,0xfc,0xf3,0xf9,0xa6,0xfc,0x10,0xfa,0xcb,0xf8,0x00,0xfb,0x2c,0xfb,0xae,0xf8,0x82,0xfd,0xd7,0xf8,0x20,0xfe,0xdb,0xfa,0x28,0xfa,0x28,0xfe,0xdb,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfd,0x34,0xf9,0x24,0xf8,0x00,0xfb,0xef,0xfa,0x69,0xf8,0x00,0xfc,0x10,0xfa,0x49,0xfc,0x10,0xfc,0xb2,0xfa,0xcb,0xfa,0xcb,0xf9,0x24,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x86,0xfd,0x75,0xfb,0x8e,0xf8,0xe3,0xfd,0x75,0xf8,0x00,0xf8,0x20,0xfe,0x9a,0xf8,0x00,0xfe,0x38,0xf8,0x20,0xfc,0x71,0xf9,0xe7,0xf8,0x00,0xfc,0x92,0xf9,0xc7,0xfc,0x71,0xfa,0x28,0xf8,0x00,0xfa,0xcb,0xfb,0xae,0xf8,0x82,0xfd,0xd7,0xf8,0x41,0xff,0x1c,0xfa,0xeb,0xfa,0xcb,0xfa,0x8a,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xfc,0xd3,0xfa,0xcb,0xf8,0xa2,0xfb,0xef,0xfa,0x69,0xf8,0x00,0xfc,0x10,0xfa,0x49,0xfa,0x08,0xfd,0x75,0xf8,0xe3,0xf9,0x86,0xf8,0xe3,0xf8,0x00,0xf8,0x00,0xf9,0x45,0xf9,0x86,0xfa,0x08,0xfd,0x55,0xf8,0xe3,0xff,0x5d,0xfa,0x49,0xfb,0x2c,0xfd,0x34,0xf8,0x00,0xfe,0x38,0xf8,0x20,0xfc,0x71,0xf9,0xe7,0xf8,0x00,0xfc,0x92,0xf9,0xc7,0xfa,0xcb,0xfd,0x34,0xf9,0x45,0xfd,0xf7,0xfb,0xae,0xf8,0x82,0xfd,0xd7,0xf8,0x00,0xfd,0xf7,0xfa,0x28,0xf8,0xe3,0xf9,0xe7,0xf8,0x00,0xfb,0x6d,0xf8,0xe3,0xf9,0x04,0xfb,0x4d,0xf8,0x00,0xfb,0x4d,0xf9,0x04,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf9,0x04,0xfc,0x30,0xf9,0x86,0xf9,0xe7,0xf9,0x24,0xf8,0x00,0xfa,0x08,0xf9,0x24,0xf8,0x00,0xfa,0x49,0xfc,0x51,0xfb,0xae,0xf8,0xa2,0xf8,0x00,0xf8,0x00,0xf8,0xc3,0xfc,0x10,0xfb,0xef,0xf8,0xc3,0xf8,0xe3,0xfd,0xb6,0xfb,0x8e,0xfb,0xef,0xf8,0x82,0xf8,0x00,0xfb,0x0c,0xf8,0x00,0xfa,0x28,0xf8,0xe3,0xf8,0x00,0xfa,0x49,0xf8,0xc3,0xf8,0x00,0xfb,0x2c,0xfc,0x10,0xf9,0xe7,0xf9,0xc7,0xf8,0x41,0xfa,0xeb,0xf8,0x00,0xf8,0xc3,0xfb,0xcf,0xfc,0x51,0xfa,0x28,0xf8,0x00,0xfb,0x0c,0xf8,0xc3,0xf8,0xe3,0xfa,0xeb,0xf8,0x00,0xfa,0xcb,0xf8,0xe3,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xe3,0xfd,0x75,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x20,0xf9,0x45,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x10,0x00,0xf0,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf0,0x00,0x10,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x30,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x30,0x00,0x00,0x00,0x00,0x00
-    ,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-};
-const size_t warning_pending_engine_size = sizeof(warning_pending_engine) / sizeof(warning_pending_engine[0]);
-
-const unsigned int neutral_x = 166;
-const unsigned int neutral_y = 190;
-const unsigned int neutral_w = 68;
-const unsigned int neutral_h = 31;
-const unsigned char neutral_on[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,224,18,32,26,160,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,35,0,26,160,18,0,8,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,9,0,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,9,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,64,0,32,0,0,0,0,0,0
-    ,0,0,0,0,0,0,18,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0,0,0,0,0
-    ,0,0,0,0,17,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,160,0,0,0,0
-    ,0,0,0,64,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,64,0,0
-    ,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,128,0,0
-    ,0,0,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,0
-    ,0,0,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,9,96,0,64,0,32,0,128,18,0,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,0,32,0,0,0,0,0,0,0,0,0,0,9,0,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,224,0,32,0,0,0,0,0,0,0,128,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,26,128,18,32,26,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,0
-    ,0,0,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,0
-    ,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,128,0,0
-    ,0,0,0,96,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,64,0,0
-    ,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,160,0,0,0,0
-    ,0,0,0,0,0,32,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,32,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,0,32,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,17,192,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,17,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,96,17,160,26,192,35,128,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,192,43,160,35,96,26,160,9,96,0,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t neutral_on_size = sizeof(neutral_on) / sizeof(neutral_on[0]);
-const unsigned char neutral_off[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,160,98,65,139,33,163,130,163,162,163,226,163,226,163,226,163,162,163,194,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,194,163,194,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,226,163,194,163,130,139,1,98,65,32,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,40,224,163,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,226,49,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,98,65,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,106,129,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,114,129,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0,0,0,0,0
-    ,0,0,0,0,65,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0
-    ,0,0,0,32,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0,0,0
-    ,0,0,81,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,96,0,0
-    ,0,0,155,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,1,0,0
-    ,0,0,188,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,179,226,0,0
-    ,0,0,204,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,66,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,204,130,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,49,32,0,32,0,0,16,64,90,1,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,98,0,32,0,0,0,0,0,0,0,0,0,0,32,192,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,64,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,89,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,81,193,0,0,0,0,0,0,0,0,8,64,147,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,122,193,114,97,147,33,212,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,0
-    ,0,0,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,0,0
-    ,0,0,147,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,1,0,0
-    ,0,0,81,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0
-    ,0,0,8,32,212,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0,0,0
-    ,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0
-    ,0,0,0,0,0,0,155,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,130,225,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,32,147,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,193,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,81,225,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,65,96,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,193,147,66,188,34,204,130,212,162,212,162,212,162,212,162,204,162,204,162,204,162,204,130,204,162,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,212,162,204,162,212,162,204,162,204,130,204,162,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,130,204,162,204,130,180,2,131,1,57,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t neutral_off_size = sizeof(neutral_off) / sizeof(neutral_off[0]);
-
-const unsigned int backward_x = 166;
-const unsigned int backward_y = 224;
-const unsigned int backward_w = 68;
-const unsigned int backward_h = 45;
-const unsigned char backward_on[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,9,0,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,9,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,9,128,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,17,160,0,32,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,160,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,8,192,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,8,192,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,9,0,0,0,0,0,0,0
-    ,0,0,0,0,0,128,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,128,0,0,0,0
-    ,0,0,0,0,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0
-    ,0,0,8,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,32,26,128,26,64,26,64,26,64,26,64,26,64,26,224,35,32,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,18,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,17,96,0,64,0,0,0,0,0,0,8,192,18,32,8,192,0,0,0,0,0,0,0,32,9,0,26,128,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,0,0,0
-    ,0,0,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,17,192,0,0,0,0,0,0,0,0,0,0,9,128,35,192,35,224,35,224,17,192,0,0,0,0,0,0,0,0,0,0,0,64,26,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,0,160,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,18,0,0,0,0,0,0,0,0,0,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,0,64,0,0,0,0,0,0,0,0,0,0,17,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,64,0,0,0,0,0,0,0,0,0,0,0,0,18,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,96,0,0,0,0,0,0,0,0,0,0,8,192,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,64,0,0,0,0,0,0,0,0,0,0,0,0,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,32,0,0,0,0,0,0,0,0,0,0,0,0,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0,0,0,0,0,0,0,0,0,0,0,0,64,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,0,0,0,0,0,0,0,0,0,0,0,17,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,160,0,0,0,0,0,0,0,0,0,0,0,0,9,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,0,160,0,0,0,0,0,0,0,0,0,0,0,0,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,17,64,9,32,9,32,9,32,9,32,9,32,9,32,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,128,0,0,0,0,0,0,0,0,0,0,0,0,26,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,96,0,0,0,0,0,0,0,0,0,0,0,0,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,0,0,0,0,0,0,0,0,0,0,0,0,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,8,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,64,0,32,0,0,17,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,64,0,0,0,0,0,0,0,0,0,0,0,0,9,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,9,0,0,0,0,0,0,0,0,0,8,192,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,160,0,0,0,0,0,0,0,0,0,0,0,0,17,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,64,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,128,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,160,0,0,0,0,0,0,0,0,0,0,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,8,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,160,0,0,0,0,0,0,0,0,0,0,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,64,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,224,0,0,0,0,0,0,0,0,0,0,0,0,17,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,26,96,26,96,26,96,26,96,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,64,26,96,26,96,26,96,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0,0,0,0,0,0,0,0,0,0,0,9,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,32,0,0,0,0,0,0,0,0,0,0,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,0,0,0,0,0,0,0,0,0,0,0,0,0,8,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0,0,0,0,0,0,0,0,0,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,32,0,0,0,0,0,0,0,0,0,0,0,64,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,96,0,0,0,0,0,0,0,0,0,0,0,0,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,0,0,0,0,0,0,0,0,0,0,0,0,0,35,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,32,0,0,0,0,0,0,0,0,0,0,0,0,18,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,32,0,0,0,0,0,0,0,0,0,0,0,0,9,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,32,0,0,0,0,0,0,0,0,0,0,8,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0,0,0,0,0,0,0,0,0,0,0,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,160,0,0,0,0,0,0,0,0,0,0,0,0,35,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,64,0,0,0,0,0,0,0,0,0,0,9,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,0,160,0,0,0,0,0,0,0,0,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,32,0,0,0,0,0,0,0,0,0,0,0,0,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,192,0,0,0,0,0,0,0,0,0,0,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,160,0,0
-    ,0,0,43,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,224,0,0,0,0,0,0,0,0,0,0,8,192,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,8,192,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0
-    ,0,0,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,160,0,0,0,0,0,0,0,0,0,0,9,128,35,224,35,224,35,224,35,224,35,224,35,224,27,64,0,64,0,0,0,0,0,0,0,0,0,0,0,160,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,0
-    ,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,160,0,0,0,0,0,0,0,0,0,0,17,192,35,224,35,224,35,224,35,224,27,64,0,96,0,0,0,0,0,0,0,0,0,0,9,0,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,0,0
-    ,0,0,18,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,9,128,0,0,0,0,0,0,0,0,0,0,9,128,35,192,35,224,26,224,0,96,0,0,0,0,0,0,0,0,0,32,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,17,160,8,160,0,0,0,0,0,0,0,128,9,32,0,0,0,0,0,0,0,0,0,64,17,160,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,0,128,0,0
-    ,0,0,0,0,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,43,192,35,128,35,0,34,224,34,224,34,224,34,224,34,224,35,0,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,64,0,0,0,0
-    ,0,0,0,0,0,128,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,64,0,0,0,0
-    ,0,0,0,0,0,0,8,192,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,160,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,160,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,0,96,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,9,128,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,224,9,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,9,0,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,96,17,64,17,64,17,64,17,64,17,64,17,64,17,64,17,96,17,64,9,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t backward_on_size = sizeof(backward_on) / sizeof(backward_on[0]);
-const unsigned char backward_off[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,41,0,65,96,65,129,65,193,65,193,65,193,65,129,65,129,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,193,65,161,65,193,65,193,65,193,65,129,65,129,65,193,65,193,65,193,65,193,65,193,65,193,65,161,65,193,65,193,65,193,65,193,65,193,65,193,65,161,65,96,32,224,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,57,96,163,162,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,163,194,73,161,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,16,128,163,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,226,24,160,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,24,160,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,32,192,0,0,0,0,0,0
-    ,0,0,0,0,8,64,196,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,130,8,64,0,0,0,0
-    ,0,0,0,0,139,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,1,0,0,0,0
-    ,0,0,32,160,229,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,163,130,130,225,114,129,114,129,114,129,114,129,114,129,147,33,163,162,212,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,16,128,0,0
-    ,0,0,114,129,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,163,130,57,64,0,0,0,0,0,0,0,0,16,128,98,33,24,128,0,0,0,0,0,0,0,0,32,192,122,161,196,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,98,65,0,0
-    ,0,0,171,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,65,128,0,0,0,0,0,0,0,0,0,0,57,64,220,194,237,35,220,226,73,128,0,0,0,0,0,0,0,0,0,0,0,32,106,97,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,130,0,0
-    ,0,0,196,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,163,130,16,96,0,0,0,0,0,0,0,0,0,0,90,1,229,3,237,35,237,35,237,35,229,3,81,193,0,0,0,0,0,0,0,0,0,0,0,0,73,161,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,130,0,32,0,0,0,0,0,0,0,0,0,0,65,96,229,3,237,35,237,35,237,35,237,35,237,35,229,3,40,224,0,0,0,0,0,0,0,0,0,0,0,0,81,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,8,32,0,0,0,0,0,0,0,0,0,0,24,128,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,0,32,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,40,224,0,0,0,0,0,0,0,0,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,106,65,0,0,0,0,0,0,0,0,0,0,0,0,0,32,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,114,129,0,0,0,0,0,0,0,0,0,0,0,0,65,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,16,64,0,0,0,0,0,0,0,0,0,0,0,0,40,224,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,16,64,0,0,0,0,0,0,0,0,0,0,0,0,171,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,114,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,33,0,0,0,0,0,0,0,0,0,0,0,0,32,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,49,0,40,224,40,224,40,224,40,224,40,224,40,224,65,96,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,57,96,0,0,0,0,0,0,0,0,0,0,0,0,106,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,8,32,0,0,0,0,0,0,0,0,0,0,0,0,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,226,0,0,0,0,0,0,0,0,0,0,0,0,8,32,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,179,226,163,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,131,1,0,0,0,0,0,0,0,0,0,0,0,0,32,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,98,33,0,0,0,0,81,193,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,106,65,0,0,0,0,0,0,0,0,0,0,0,0,57,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,179,226,32,160,0,0,0,0,0,0,0,0,16,96,147,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,161,0,0,0,0,0,0,0,0,0,0,0,0,81,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,98,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,64,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,161,0,0,0,0,0,0,0,0,0,0,0,0,81,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,179,226,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,130,225,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,161,0,0,0,0,0,0,0,0,0,0,0,0,89,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,227,114,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,90,1,0,0,0,0,0,0,0,0,0,0,0,0,73,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,2,122,193,122,193,122,193,122,193,16,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,97,122,161,122,161,122,161,130,225,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0,0,0,0,0,0,0,0,0,0,0,49,32,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,40,224,0,0,0,0,0,0,0,0,0,0,0,0,16,128,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,98,0,0,0,0,0,0,0,0,0,0,0,0,24,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0,0,0,0,0,0,0,0,0,0,0,65,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0,0,0,0,0,0,0,0,0,0,0,0,32,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,0,32,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,32,192,0,0,0,0,0,0,0,0,0,0,0,0,163,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,98,65,0,0,0,0,0,0,0,0,0,0,0,0,98,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,98,33,0,0,0,0,0,0,0,0,0,0,0,0,40,224,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,0,0,0,0,0,0,0,0,0,0,0,0,24,128,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,227,16,96,0,0,0,0,0,0,0,0,0,0,0,0,130,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,96,0,0,0,0,0,0,0,0,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,130,225,0,0,0,0,0,0,0,0,0,0,0,0,24,128,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,0,0,0,0,0,0,0,0,0,0,0,0,41,0,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,16,96,0,0,0,0,0,0,0,0,0,0,0,0,147,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,90,1,0,0,0,0,0,0,0,0,0,0,0,0,155,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,160,0,0,0,0,0,0,0,0,0,0,0,0,57,64,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,0,0
-    ,0,0,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,24,160,0,0,0,0,0,0,0,0,0,0,16,96,212,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,130,225,0,0,0,0,0,0,0,0,0,0,0,0,24,128,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,0
-    ,0,0,188,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,16,64,0,0,0,0,0,0,0,0,0,0,57,64,229,3,237,35,237,35,237,35,237,35,237,35,163,162,0,0,0,0,0,0,0,0,0,0,0,0,16,96,188,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,0,0
-    ,0,0,155,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,2,16,96,0,0,0,0,0,0,0,0,0,0,73,128,229,3,237,35,237,35,237,35,163,162,8,32,0,0,0,0,0,0,0,0,0,0,32,192,188,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,66,0,0
-    ,0,0,98,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,57,64,0,0,0,0,0,0,0,0,0,0,57,64,204,130,237,35,139,1,8,32,0,0,0,0,0,0,0,0,0,0,90,1,220,227,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,81,225,0,0
-    ,0,0,16,128,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,73,160,16,96,0,0,0,0,0,0,8,64,40,224,0,0,0,0,0,0,0,0,0,0,65,128,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,8,64,0,0
-    ,0,0,0,0,131,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,130,188,34,155,130,155,98,147,65,147,66,147,65,147,66,155,98,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,106,97,0,0,0,0
-    ,0,0,0,0,8,64,196,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,0,32,0,0,0,0
-    ,0,0,0,0,0,0,32,192,204,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,66,16,96,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,16,128,163,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,65,8,64,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,65,96,163,162,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,147,65,49,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,32,40,224,57,96,65,129,65,96,65,96,65,96,57,96,57,96,65,96,65,97,65,96,57,96,57,96,57,96,57,64,57,64,57,96,57,64,57,64,57,96,57,96,57,96,57,64,57,64,57,96,57,64,57,96,57,64,57,96,65,96,65,96,65,96,57,96,57,96,65,96,65,96,65,96,57,96,57,96,57,96,57,64,57,64,57,96,57,64,57,64,57,96,57,96,57,97,57,64,32,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t backward_off_size = sizeof(backward_off) / sizeof(backward_off[0]);
-
-const unsigned int lube_x = 78;
-const unsigned int lube_y = 271;
-const unsigned int lube_w = 68;
-const unsigned int lube_h = 47;
-const unsigned char lube_on[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,9,32,17,160,17,160,17,160,17,160,18,32,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,18,32,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,17,160,9,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,96,18,64,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,18,64,0,96,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,9,32,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,9,64,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,9,64,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,17,128,0,0,0,0,0,0
-    ,0,0,0,0,9,0,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,9,0,0,0,0,0
-    ,0,0,0,32,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,32,0,0
-    ,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,18,32,18,32,18,32,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,96,0,0
-    ,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,0,0,0,0,0,0,0,9,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,0
-    ,0,32,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,224,0,0,0,0,0,0,9,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,32
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,9,64,9,64,9,64,18,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,17,224,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,17,224,17,128,17,128,17,128,17,128,17,128,17,128,17,128,17,128,17,128,17,160,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,64,18,0,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,32,0,0,0,32,26,160,17,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,26,128,35,192,35,224,35,224,35,224,35,224,35,224,27,0,18,32,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,160,0,0,0,32,26,224,35,224,35,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,17,192,0,0,0,0,26,160,35,224,35,192,8,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,18,32,26,192,35,224,35,224,35,224,35,192,26,192,18,32,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,96,0,0,0,0,18,32,35,224,35,192,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,18,32,18,96,35,192,35,224,35,224,35,224,35,224,35,64,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,26,192,35,224,9,128,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,26,96,35,160,35,192,26,192,18,32,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,192,18,64,35,64,35,224,35,224,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,64,8,224,0,0,0,0,0,0,0,0,9,32,35,192,8,224,0,0,0,0,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,26,160,18,32,18,64,35,64,35,224,35,224,35,224,35,224,35,224,35,64,26,128,18,64,26,224,35,224,35,224,35,224,35,96,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,0,64,27,64,26,224,35,224,26,224,27,32,0,32,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,160,18,0,26,192,35,224,35,224,35,64,35,64,35,192,35,160,27,32,26,128,26,224,35,224,35,224,35,224,27,0,35,128,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,0,128,35,128,35,224,35,224,35,224,35,96,0,96,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,192,18,32,0,96,0,0,17,192,35,224,35,224,35,128,18,32,18,32,26,128,27,0,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,32,26,224,9,160,0,32,18,0,35,224,17,192,0,0,18,0,26,160,0,0,0,0,0,0,18,96,35,224,35,192,18,64,0,96,0,32,0,0,0,0,17,160,35,224,35,224,35,192,35,32,35,32,35,32,35,32,35,32,35,64,35,224,35,224,35,224,35,64,35,32,35,32,35,64,35,224,35,224,35,224,35,64,35,32,35,96,35,224,35,224,35,160,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,35,128,27,32,0,0,9,64,35,224,9,32,0,32,35,160,27,0,0,0,0,0,0,0,18,96,35,224,35,192,18,32,0,96,0,0,0,0,0,0,17,160,35,224,35,224,35,192,35,0,35,0,35,0,35,0,35,0,35,64,35,224,35,224,35,224,35,32,35,0,35,0,35,32,35,224,35,224,35,224,35,32,35,0,35,96,35,224,35,224,35,160,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,32,27,32,35,160,35,224,27,64,35,96,35,224,35,96,35,96,35,224,35,160,26,192,0,0,0,0,18,96,35,224,35,224,35,224,35,160,18,0,0,96,0,32,25,224,35,224,35,224,35,128,18,32,18,64,26,128,27,32,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,32,35,64,35,192,35,224,35,96,35,128,35,224,35,128,35,128,35,224,35,192,26,192,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,160,18,0,26,192,35,224,35,224,35,64,35,96,35,192,35,128,27,0,18,96,26,192,35,224,35,224,35,224,27,32,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,35,64,35,96,0,0,9,64,35,224,9,32,0,32,35,160,26,224,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,26,128,18,0,18,64,35,96,35,224,35,224,35,224,35,224,35,224,27,0,26,96,18,64,26,224,35,224,35,224,35,224,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,32,27,32,17,192,0,0,17,224,35,224,9,160,0,0,18,64,26,192,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,64,26,128,35,192,35,160,26,160,18,0,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,160,18,64,35,64,35,224,35,224,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,0,96,27,64,35,224,35,224,35,224,27,32,0,64,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,18,32,18,96,35,192,35,224,35,224,35,224,35,224,35,96,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,0,96,35,128,27,0,35,224,27,0,35,64,0,32,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,18,32,26,192,35,224,35,224,35,224,35,160,26,160,18,32,26,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,32,35,160,8,224,0,0,0,0,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,35,224,35,224,35,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,26,160,35,224,35,224,35,224,35,224,35,224,35,224,26,224,18,32,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,18,0,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,64,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,26,128,9,32,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,9,0,18,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,17,224,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64
-    ,0,32,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,32
-    ,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,0,0
-    ,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,96,0,0
-    ,0,0,0,64,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,32,0,0
-    ,0,0,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,0,0,0,0,0
-    ,0,0,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,224,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,17,128,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,224,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,160,0,160,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,17,224,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,26,128,17,160,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t lube_on_size = sizeof(lube_on) / sizeof(lube_on[0]);
-const unsigned char lube_off[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,224,65,128,73,160,73,160,81,192,98,33,73,160,73,192,73,192,73,192,73,192,73,160,81,192,73,192,73,192,73,192,81,160,73,160,73,192,73,192,73,192,73,160,73,192,73,160,73,192,73,160,73,192,73,192,73,160,73,160,73,192,98,33,73,192,73,192,73,192,73,192,73,192,73,160,81,192,73,192,73,192,73,160,81,160,73,192,73,192,73,192,73,192,73,160,73,160,73,160,65,128,24,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,32,98,65,188,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,196,66,98,65,8,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,41,0,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,49,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,49,0,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,57,64,0,0,0,0,0,0
-    ,0,0,0,0,32,192,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,32,192,0,0,0,0
-    ,0,0,0,0,171,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,0,0,0
-    ,0,0,57,64,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,106,97,106,65,106,65,171,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,49,32,0,0
-    ,0,0,147,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,160,0,0,0,0,0,0,57,32,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,130,225,0,0
-    ,0,0,212,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,128,0,0,0,0,0,0,49,32,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,100,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,90,1,24,160,24,160,24,160,73,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,35,212,163,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,131,65,130,163,163,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,81,225,73,160,73,160,73,160,73,160,73,160,73,160,73,160,73,160,73,160,73,160,139,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,163,163,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,195,212,195,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,227,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,130,32,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,195,65,162,122,162,229,3,237,35,237,35,237,35,237,35,237,35,229,3,237,35,237,35,171,195,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,237,35,237,35,220,194,41,0,0,0,0,0,130,225,89,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,67,114,162,220,227,237,35,237,35,237,35,237,35,237,35,147,99,73,194,122,228,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,237,35,228,226,57,64,0,0,0,0,139,33,237,35,163,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,221,4,237,35,237,35,237,35,237,35,237,35,237,35,220,227,237,35,237,35,237,35,196,99,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,229,2,73,160,0,0,0,0,122,161,237,35,204,130,24,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,35,73,194,122,194,237,35,237,35,237,35,212,195,131,2,65,195,90,2,220,227,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,171,194,0,0,0,0,90,1,237,35,220,194,32,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,67,81,226,90,34,212,163,237,35,237,35,237,35,237,35,171,227,163,163,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,131,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,139,1,220,226,49,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,90,35,98,66,204,131,204,164,131,3,73,194,180,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,227,130,227,98,66,163,195,237,35,237,35,180,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,32,24,128,0,0,0,0,0,0,0,0,40,224,188,34,16,96,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,100,130,227,73,194,90,34,171,195,229,3,237,35,237,35,237,35,237,35,163,163,122,195,90,34,131,4,237,35,237,35,229,3,180,3,212,195,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,98,130,225,237,35,114,129,147,33,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,204,131,90,34,131,3,237,35,237,35,171,195,171,195,212,196,196,99,155,131,114,195,130,227,237,35,237,35,229,35,155,131,188,35,212,195,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,0,0,16,64,179,226,237,35,237,35,237,35,163,162,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,212,163,98,66,8,32,0,0,65,163,237,35,237,35,188,68,73,227,82,3,114,162,155,99,188,68,221,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,139,1,65,96,0,0,81,225,237,35,49,32,0,0,89,225,114,129,0,0,0,0,0,0,122,193,237,35,220,227,106,98,8,64,0,32,0,0,0,0,49,34,237,35,237,35,220,195,163,163,163,163,163,163,163,163,163,163,171,227,237,35,237,35,237,35,171,227,163,163,163,163,171,227,237,35,237,35,237,35,171,227,163,163,188,35,237,35,237,35,204,131,220,227,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,179,226,163,130,0,0,57,32,237,35,16,128,0,0,188,34,147,65,0,0,0,0,0,0,122,193,237,35,220,227,98,66,8,64,0,0,0,0,0,0,49,34,237,35,237,35,212,195,155,131,155,131,155,131,155,131,155,131,163,195,237,35,237,35,237,35,163,195,155,131,155,131,163,195,237,35,237,35,237,35,163,163,155,131,180,3,237,35,237,35,196,131,220,227,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,139,33,204,98,229,2,163,130,179,226,237,35,171,162,163,162,229,2,188,34,122,161,0,0,0,0,122,193,237,35,237,35,237,35,204,131,90,2,0,32,0,32,65,195,237,35,237,35,188,68,73,227,90,35,122,194,163,163,196,132,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,155,98,212,130,229,2,179,226,188,34,237,35,188,2,180,2,237,2,204,98,130,225,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,196,99,82,2,122,227,237,35,237,35,179,227,180,4,212,196,188,35,147,99,106,130,122,227,237,35,237,35,229,35,163,163,196,100,220,227,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,171,194,171,194,0,0,57,32,237,35,16,128,0,0,196,66,139,33,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,100,122,195,65,162,98,66,180,3,229,3,237,35,237,35,237,35,229,35,155,131,114,130,82,3,131,4,237,35,237,35,229,3,188,67,220,227,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,155,98,73,160,0,0,73,128,237,35,40,224,0,0,98,33,130,225,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,82,3,98,98,212,195,204,132,122,195,65,163,180,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,227,122,194,82,3,163,195,237,35,237,35,188,67,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,0,0,8,64,163,130,237,2,237,35,229,2,147,65,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,35,73,194,98,66,212,195,237,35,237,35,237,35,237,35,171,227,171,227,229,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,99,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,0,0,0,32,171,194,147,33,237,35,130,225,163,130,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,3,73,194,122,194,237,35,237,35,237,35,212,163,122,194,65,163,90,34,228,227,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,204,130,16,96,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,196,237,35,237,35,237,35,237,35,237,35,237,35,212,163,229,35,237,35,237,35,204,132,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,67,122,194,220,227,237,35,237,35,237,35,237,35,237,35,147,67,65,162,131,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,163,130,65,162,130,226,229,3,237,35,237,35,237,35,237,35,237,35,229,3,237,35,237,35,171,227,220,227,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,179,226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,163,163,212,163,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,195,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,226,237,35,237,35,237,35,237,35,237,35,122,161,40,224,40,224,40,224,40,224,40,224,40,224,40,224,40,224,40,224,40,224,40,224,40,224,40,224,40,224,40,224,98,65,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,195,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,0,0
-    ,0,0,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,99,57,130,163,195,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,0,0
-    ,0,0,204,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,204,163,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,0,0
-    ,0,0,147,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,101,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,1,0,0
-    ,0,0,65,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,57,64,0,0
-    ,0,0,0,0,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,0,0,0
-    ,0,0,0,0,57,64,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,32,192,0,0,0,0
-    ,0,0,0,0,0,0,81,225,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,81,192,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,81,193,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,57,64,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,24,128,147,65,220,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,194,122,193,16,96,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,81,192,114,129,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,193,122,161,114,129,65,96,8,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t lube_off_size = sizeof(lube_off) / sizeof(lube_off[0]);
-
-const unsigned int backlight_x = 147;
-const unsigned int backlight_y = 271;
-const unsigned int backlight_w = 44;
-const unsigned int backlight_h = 47;
-const unsigned char backlight_on[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,192,17,160,17,192,17,192,17,192,18,0,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,160,17,160,17,192,17,160,9,96,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,160,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,32,9,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,128,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,0,64,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,128,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,64,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,64,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,192,0,0,0,0
-    ,0,0,0,0,0,160,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,32,0,0
-    ,0,0,0,0,18,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,32,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,32,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,96,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,224,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,9,64,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,192,17,160,8,192,0,160,9,32,18,32,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,32,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,32,17,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,64,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,128,26,128,35,96,35,224,35,224,35,224,8,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,224,35,224,35,224,35,192,27,32,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,160,17,192,35,96,35,224,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,35,224,35,224,26,160,18,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,192,35,192,35,192,35,192,35,192,35,192,35,192,9,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,192,35,192,35,192,35,192,35,192,35,192,35,192,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,9,96,0,192,0,192,0,192,0,192,0,192,0,192,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,128,0,160,0,192,0,192,0,192,0,192,0,192,18,0,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0
-    ,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,96,0,0
-    ,0,0,0,0,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,224,0,0
-    ,0,0,0,0,17,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,224,0,0
-    ,0,0,0,0,0,128,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,0,0,0
-    ,0,0,0,0,0,0,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,96,0,0,0,0
-    ,0,0,0,0,0,0,0,64,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,128,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,64,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,128,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,64,0,32,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,160,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,192,9,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,17,160,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,192,17,160,17,192,17,192,17,160,9,64,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t backlight_on_size = sizeof(backlight_on) / sizeof(backlight_on[0]);
-const unsigned char backlight_off[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,65,128,73,160,81,192,81,192,98,33,81,193,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,81,192,73,160,49,32,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,96,171,162,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,226,155,130,49,32,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,16,64,155,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,139,1,0,32,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,16,96,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,32,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0
-    ,0,0,0,0,0,0,114,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,160,0,0,0,0
-    ,0,0,0,0,16,96,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,2,0,0,0,0
-    ,0,0,0,0,81,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,32,192,0,0
-    ,0,0,0,0,147,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,90,1,0,0
-    ,0,0,0,0,155,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,114,129,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,73,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,73,160,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,130,106,65,229,3,237,35,237,35,237,35,237,35,237,35,229,3,180,2,237,35,237,35,237,35,237,35,237,35,237,35,179,226,139,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,81,192,90,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,98,40,224,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,106,65,229,3,237,35,237,35,237,35,237,35,229,3,229,2,237,35,237,35,237,35,237,35,237,35,147,33,155,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,130,225,65,96,16,96,8,64,40,224,98,33,180,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,97,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,225,220,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,64,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,188,2,122,161,171,194,229,3,237,35,220,226,16,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,33,237,35,237,35,212,162,155,130,122,193,229,3,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,212,162,122,161,73,128,179,226,237,35,147,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,160,229,3,237,35,114,129,81,225,147,33,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,73,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,220,194,220,194,220,194,220,194,220,194,220,194,220,194,40,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,225,220,194,220,194,220,194,220,194,220,194,220,226,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,32,192,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,8,64,81,225,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,163,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0
-    ,0,0,0,0,155,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,114,129,0,0
-    ,0,0,0,0,130,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,81,193,0,0
-    ,0,0,0,0,73,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,24,160,0,0
-    ,0,0,0,0,8,32,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,162,0,0,0,0
-    ,0,0,0,0,0,0,114,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,49,32,0,0,0,0
-    ,0,0,0,0,0,0,0,0,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,161,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,16,96,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,155,97,0,32,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,16,64,155,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,98,65,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,96,171,162,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,130,225,32,160,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,65,96,73,160,81,192,81,192,81,192,81,192,81,192,73,192,81,192,81,192,81,192,81,192,73,192,81,192,73,160,73,160,73,160,73,160,73,160,73,192,73,160,73,160,73,192,73,128,49,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t backlight_off_size = sizeof(backlight_off) / sizeof(backlight_off[0]);
-
-const unsigned int light_x = 191;
-const unsigned int light_y = 271;
-const unsigned int light_w = 44;
-const unsigned int light_h = 47;
-const unsigned char light_on[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,64,0,64,0,64,0,128,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,64,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,224,18,64,35,128,35,192,35,192,35,192,35,192,35,224,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,192,35,96,26,96,8,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,96,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,128,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,128,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,8,192,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,128,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,128,0,0,0,0,0,0
-    ,0,0,0,0,0,0,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,0,0,0,0,0
-    ,0,0,0,0,9,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,96,0,0,0,0
-    ,0,0,0,0,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,0,0,0
-    ,0,0,0,96,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,160,35,128,35,224,35,224,35,224,35,224,35,224,35,224,27,32,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,0,64,0,0
-    ,0,0,0,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,9,32,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,9,64,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,26,224,17,192,9,0,8,224,17,160,26,192,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,192,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,128,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,27,0,35,192,35,224,35,224,35,160,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,35,160,35,224,35,224,35,192,35,64,35,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,18,0,17,192,35,192,35,224,18,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,35,224,35,224,18,0,17,224,27,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,17,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,32,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,192,8,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,128,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,32,0,0,0,0,0,0,0,0,0,0,0,0,0,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,9,64,0,0,0,0,0,0,0,0,0,0,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,18,32,18,32,18,32,18,32,18,32,18,32,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,17,224,17,224,17,224,17,224,17,224,17,224,26,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,224,17,160,17,160,17,160,17,160,17,160,17,160,26,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,8,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,8,192,0,0
-    ,0,0,0,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,64,18,96,18,96,18,96,18,96,35,64,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,160,0,0
-    ,0,0,0,32,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,96,0,96,0,0,0,0,0,96,35,96,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,0,0,0,0
-    ,0,0,0,0,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,160,26,192,26,192,35,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,96,0,0,0,0
-    ,0,0,0,0,9,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,0,160,0,0,0,0
-    ,0,0,0,0,0,0,26,160,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,18,32,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,64,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,27,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,64,27,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,26,160,0,64,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,32,17,224,35,192,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,128,17,160,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,17,128,26,192,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,96,35,64,26,128,9,64,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t light_on_size = sizeof(light_on) / sizeof(light_on[0]);
-const unsigned char light_off[] PROGMEM={
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,160,106,65,180,2,212,162,220,194,220,194,220,194,228,226,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,220,194,212,130,171,194,106,97,24,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,8,32,122,193,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,130,225,8,64,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,16,96,180,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,2,24,128,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,16,96,188,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,34,16,96,0,0,0,0,0,0
-    ,0,0,0,0,0,0,147,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,2,163,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0
-    ,0,0,0,0,49,0,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,130,225,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,49,0,0,0,0,0
-    ,0,0,0,0,155,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,130,225,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,1,0,0,0,0
-    ,0,0,8,32,212,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,179,226,147,65,237,35,237,35,237,35,237,35,237,35,237,35,204,130,188,34,237,35,237,35,237,35,237,35,237,35,237,35,163,130,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,130,0,0,0,0
-    ,0,0,16,128,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,32,192,155,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,32,192,212,130,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,2,16,96,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,98,106,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,98,33,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,16,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,139,1,73,128,24,160,24,160,65,96,130,225,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,130,225,8,32,0,0,0,0,0,0,0,0,0,0,0,0,8,64,130,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,98,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,33,229,3,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,114,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,129,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,163,162,147,65,204,98,237,35,237,35,196,66,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,196,66,237,35,237,35,212,162,163,162,155,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,90,1,57,32,212,162,237,35,106,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,225,237,35,229,3,65,128,81,192,155,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,2,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,162,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,224,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,65,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,32,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,204,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,204,98,8,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,122,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,212,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,32,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,228,226,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,40,224,0,0,0,0,0,0,0,0,0,0,0,0,16,96,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,33,90,1,90,1,90,1,90,1,90,1,90,1,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,1,73,192,73,192,73,192,73,192,73,192,73,192,139,1,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,89,225,0,0,0,0,0,0,0,0,0,0,0,0,89,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,139,1,65,96,65,96,65,96,65,96,65,96,65,96,130,225,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,24,128,0,0
-    ,0,0,24,128,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,16,96,0,0
-    ,0,0,16,96,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,171,194,106,97,106,97,106,97,106,97,171,194,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,228,226,8,64,0,0
-    ,0,0,0,0,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,8,64,0,0,0,0,8,64,188,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,180,2,0,0,0,0
-    ,0,0,0,0,122,161,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,196,66,130,225,130,225,196,66,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,114,97,0,0,0,0
-    ,0,0,0,0,32,160,229,2,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,220,194,16,96,0,0,0,0
-    ,0,0,0,0,0,0,122,193,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,90,1,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,32,155,97,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,147,65,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,32,147,65,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,3,130,193,0,32,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,81,192,204,98,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,188,2,65,96,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,57,64,130,225,171,162,171,226,179,226,179,226,179,226,179,226,171,226,171,226,179,226,179,226,179,226,171,226,171,226,171,226,171,194,171,194,171,194,171,194,171,194,171,194,171,194,171,226,171,194,163,162,122,161,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    ,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-};
-const size_t light_off_size = sizeof(light_off) / sizeof(light_off[0]);
@@ -1,309 +0,0 @@
-// Copyright (c) Thor Schueler. All rights reserved.
-// SPDX-License-Identifier: MIT
-/*
-This is the core GUI library for the TFT display, providing a common
-set of graphics primitives (points, lines, circles, etc.).  It needs to be
-paired with a hardware-specific library for each display device we carry
-(to handle the lower-level functions).
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
-ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
-LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
-CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
-SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
-INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
-CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
-ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
-POSSIBILITY OF SUCH DAMAGE.
-*/
-
-#include "controller_display.h"
-
-
-const unsigned int scales_h = 15;
-const unsigned int scales_y = 124;
-const unsigned int scales_0_w = 23;
-const unsigned int scales_0_x = 75;
-const unsigned int scales_0_y = 124;
-const unsigned char scales_0_o[] PROGMEM={
-    24,224,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,96,57,192
-    ,114,225,237,163,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,237,163,188,162
-    ,122,225,245,99,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,35,237,34,237,34,237,34,237,34,237,34,237,34,245,67,188,130
-    ,122,225,245,99,237,35,237,67,237,35,237,67,237,67,237,67,237,67,237,67,237,67,237,35,237,35,237,35,237,67,237,35,237,67,245,99,237,67,237,34,237,34,245,99,188,130
-    ,122,225,245,99,237,35,237,67,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,67,220,226,179,226,220,194,237,67,237,34,245,99,188,130
-    ,122,225,245,99,237,35,237,67,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,67,220,194,122,161,180,2,106,96,220,226,237,67,245,99,188,130
-    ,122,225,245,99,237,34,237,67,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,245,99,171,193,171,193,253,195,163,129,179,226,245,99,245,99,188,130
-    ,122,225,245,99,237,34,237,67,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,245,99,155,129,180,2,253,131,171,193,171,225,245,99,245,99,188,130
-    ,122,225,237,99,237,35,237,67,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,245,99,163,161,179,225,253,195,163,161,180,2,245,99,245,99,188,130
-    ,122,225,237,99,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,245,67,204,130,114,128,204,98,114,128,220,194,237,67,245,99,188,130
-    ,122,225,245,99,237,34,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,67,204,130,163,129,212,162,237,67,237,34,245,99,188,130
-    ,122,225,237,99,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,34,237,35,237,35,237,35,237,34,237,67,245,99,237,67,237,35,237,34,245,99,188,130
-    ,122,193,245,99,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,245,99,188,130
-    ,114,161,229,99,221,67,229,67,221,67,229,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,229,67,229,67,221,67,229,131,180,130
-    ,8,128,41,192,49,192,49,160,49,160,49,160,49,192,41,160,49,160,49,192,49,160,49,160,49,192,49,160,49,160,41,160,49,160,49,160,49,160,49,192,49,192,49,192,33,64
-};
-const unsigned char scales_0_g[] PROGMEM={
-    0,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,32
-    ,25,224,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,32,59,96
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,43,64
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,36,0,36,0,35,224,35,224,36,0,43,64
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,35,192,35,64,35,192,36,0,35,224,36,0,43,64
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,35,192,26,96,35,64,26,64,35,192,35,224,36,0,43,64
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,32,35,0,43,0,44,96,34,224,35,32,36,0,36,0,43,64
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,42,224,51,64,36,32,43,32,27,0,36,0,36,0,43,64
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,32,35,0,43,32,44,96,34,224,35,32,36,0,36,0,43,64
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,35,160,26,64,43,128,26,96,35,192,36,0,36,0,43,64
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,35,128,35,0,35,160,36,0,35,224,36,0,43,64
-    ,25,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,36,0,36,0,35,224,35,224,36,0,43,64
-    ,25,224,36,0,35,224,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,36,0,35,224,35,224,35,224,36,0,35,224,36,0,43,64
-    ,25,192,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,52,0,59,64
-    ,0,64,16,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,25,0,24,192 
-};
-const size_t scales_0_size = sizeof(scales_0_o) / sizeof(scales_0_o[0]);
-
-const unsigned int scales_500_w = 24;
-const unsigned int scales_500_x = 99;
-const unsigned int scales_500_y = 124;
-const unsigned char scales_500_o[] PROGMEM={
-    0,32,66,32,74,96,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,96,66,32,0,32
-    ,41,32,213,67,237,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,237,99,221,99,41,128
-    ,41,64,221,34,237,35,237,35,237,35,237,34,237,35,237,35,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,35,237,35,237,34,237,34,221,67,41,128
-    ,41,64,221,34,237,67,237,35,237,67,237,35,237,67,245,99,245,99,237,67,237,35,237,67,245,99,237,67,237,35,237,67,245,99,245,99,237,67,237,35,237,35,237,67,221,67,41,128
-    ,41,64,221,34,237,67,237,35,237,35,237,67,220,226,196,98,196,66,220,226,245,67,220,226,180,2,212,194,237,67,237,67,196,98,188,34,237,34,237,67,237,35,237,67,221,67,41,128
-    ,41,64,221,35,237,67,237,35,237,35,245,99,155,97,147,33,179,225,212,194,229,2,114,161,180,2,106,96,220,226,179,225,147,65,155,97,155,97,245,67,237,35,237,66,221,67,41,128
-    ,41,64,221,35,237,67,237,35,237,34,245,99,147,65,179,226,237,67,253,131,179,226,163,161,253,195,171,193,163,161,139,1,229,34,237,67,114,128,229,2,237,67,237,67,221,67,41,128
-    ,41,64,221,34,237,67,237,34,237,35,237,67,188,66,147,33,106,96,196,98,180,2,171,193,253,131,188,34,147,33,139,1,229,2,237,34,122,193,220,226,237,67,237,34,221,67,41,128
-    ,41,64,221,35,237,67,237,35,237,35,237,35,245,99,253,163,212,194,130,225,180,2,171,193,253,195,179,225,163,161,139,1,237,35,237,67,122,161,229,2,237,67,237,67,221,67,41,128
-    ,41,64,221,34,237,67,237,35,237,35,237,35,188,34,204,98,147,65,171,193,220,226,106,64,204,98,114,128,220,226,155,97,163,161,171,193,147,65,245,67,237,35,237,66,221,67,41,128
-    ,41,64,221,34,237,67,237,35,237,35,237,67,204,98,163,129,188,34,237,35,237,67,204,130,163,129,204,130,245,67,229,2,171,226,179,226,229,35,237,67,237,35,237,66,221,67,41,128
-    ,41,64,221,34,237,67,237,35,237,35,237,35,245,99,245,99,245,99,237,35,237,35,237,67,245,99,237,67,237,34,237,67,245,99,245,99,237,67,237,35,237,35,237,67,221,67,41,128
-    ,41,64,221,35,245,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,67,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,245,35,221,67,41,128
-    ,41,64,213,35,229,99,221,67,229,67,221,67,221,67,229,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,229,67,213,67,41,96
-    ,0,32,41,128,49,192,49,192,49,192,41,192,49,160,49,160,49,192,49,160,41,160,41,192,49,192,49,160,49,160,49,160,41,160,41,192,49,160,49,192,49,160,49,192,41,128,0,0
-};
-const unsigned char scales_500_g[] PROGMEM={
-    8,32,25,64,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,33,128,8,64
-    ,16,224,59,192,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,67,224,24,224
-    ,17,0,43,192,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,51,192,16,192
-    ,17,0,43,192,36,0,35,224,35,224,35,224,36,0,44,0,44,0,36,0,35,224,36,0,36,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,35,224,36,0,51,224,16,192
-    ,16,224,51,192,36,0,35,224,35,224,36,0,35,192,35,96,35,64,35,192,36,0,35,192,35,64,35,192,36,0,36,0,35,96,35,96,35,224,35,224,35,224,36,0,51,224,16,192
-    ,40,224,75,224,28,0,43,224,35,224,36,0,34,192,18,160,27,64,35,192,35,224,26,96,35,32,26,64,35,192,35,32,34,192,34,224,34,224,36,0,35,224,36,0,51,192,16,192
-    ,24,224,51,192,36,0,35,224,35,224,44,32,34,160,35,32,44,0,44,32,35,32,34,224,44,96,43,0,35,0,34,160,43,224,44,0,26,64,35,224,35,224,36,0,51,224,16,192
-    ,16,224,43,192,36,0,35,224,35,224,36,0,35,96,42,224,26,96,35,128,27,32,35,0,36,32,51,64,42,192,42,192,43,224,43,224,34,128,35,192,36,0,36,0,51,224,16,192
-    ,16,224,43,192,36,0,35,224,35,224,35,224,36,0,44,64,35,160,26,128,35,32,35,0,44,96,43,32,35,0,34,128,43,224,44,0,34,96,35,224,35,224,36,0,51,224,16,192
-    ,16,224,43,192,36,0,35,224,35,224,35,224,35,96,35,128,26,192,35,32,35,192,26,64,43,128,26,96,35,192,26,224,35,0,35,0,34,192,36,0,35,224,36,0,51,224,16,192
-    ,16,224,43,192,36,0,35,224,35,224,36,0,35,128,35,0,35,96,36,0,36,0,35,128,35,0,35,160,36,0,35,224,35,32,35,32,35,224,35,224,35,224,36,0,51,224,16,192
-    ,16,224,43,192,36,0,35,224,35,224,35,224,36,0,44,0,36,0,35,224,35,224,36,0,44,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,35,224,36,0,51,192,16,192
-    ,17,0,43,192,36,0,35,224,36,0,36,0,35,224,35,224,35,224,36,0,36,0,35,224,35,224,35,224,36,0,36,0,35,224,35,224,36,0,36,0,35,224,36,0,51,224,16,192
-    ,25,0,59,192,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,59,192,8,160
-    ,8,32,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,16,224,0,0
-};
-const size_t scales_500_size = sizeof(scales_500_o) / sizeof(scales_500_o[0]);
-
-const unsigned int scales_1000_w = 23;
-const unsigned int scales_1000_x = 124;
-const unsigned int scales_1000_y = 124;
-const unsigned char scales_1000_o[] PROGMEM={
-    57,192,74,96,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,96,57,192
-    ,196,162,237,131,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,237,163,180,130
-    ,196,130,245,67,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,35,237,35,237,35,237,34,237,34,237,34,245,99,188,98
-    ,196,130,245,99,237,35,237,35,245,67,237,67,237,35,237,35,245,99,245,99,237,67,237,35,237,67,245,99,237,67,237,35,237,35,245,99,245,99,237,67,237,35,245,99,188,98
-    ,196,130,245,99,237,35,237,67,204,130,229,2,237,67,237,67,196,98,188,34,237,34,237,67,220,226,180,2,212,162,237,67,237,67,204,98,188,34,237,35,237,35,245,99,188,98
-    ,196,130,245,99,237,35,171,193,40,224,204,130,245,131,179,225,147,65,163,129,147,65,237,35,122,161,180,2,106,96,220,194,188,2,147,33,163,129,147,33,237,67,245,99,180,98
-    ,196,130,245,99,229,2,229,2,147,33,204,130,245,99,114,129,229,2,245,99,130,225,171,193,163,129,253,195,180,2,163,129,139,33,220,226,245,99,114,128,220,226,245,99,188,98
-    ,196,130,245,99,237,35,245,99,139,1,204,130,237,35,122,161,229,2,237,35,147,65,155,129,171,225,245,131,196,66,147,33,139,1,220,226,237,67,130,193,212,194,245,131,188,98
-    ,196,130,245,99,237,35,245,131,147,65,212,162,245,99,114,96,229,2,245,99,139,1,171,161,163,161,253,195,188,2,163,129,139,1,229,2,245,99,122,161,220,226,245,99,188,98
-    ,196,130,245,99,237,34,212,162,106,64,163,129,237,35,155,97,163,129,179,226,147,65,220,226,106,64,204,98,114,161,220,194,163,161,155,129,179,226,139,33,237,67,245,99,188,98
-    ,196,130,245,99,237,34,188,34,188,34,180,2,220,194,237,35,179,226,171,193,229,2,245,67,212,162,163,129,204,130,245,67,229,35,179,226,171,193,229,2,237,35,245,99,180,98
-    ,196,130,245,99,237,35,245,99,245,99,245,99,237,67,237,35,245,99,245,99,237,67,237,35,237,67,245,99,237,67,237,35,237,67,245,99,245,99,237,67,237,35,245,99,180,98
-    ,204,130,245,99,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,245,99,188,98
-    ,188,130,229,99,221,67,221,67,229,67,221,67,221,67,221,67,221,67,221,67,221,67,229,67,221,67,221,67,229,67,221,67,229,67,229,67,221,67,221,67,221,67,229,131,172,98
-    ,33,64,49,192,49,160,49,192,49,192,41,160,49,192,49,192,49,192,49,192,49,192,49,192,41,192,41,160,49,160,49,160,41,160,41,160,49,160,49,160,49,160,49,192,33,32
-};
-const unsigned char scales_1000_g[] PROGMEM={
-    9,0,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,33,32
-    ,35,32,52,32,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,32,59,64
-    ,27,64,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,35,64
-    ,27,64,44,0,35,224,35,224,36,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,36,0,36,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,36,0,43,64
-    ,27,64,36,0,35,224,36,0,35,160,35,224,35,224,36,0,35,128,35,96,35,224,36,0,35,192,35,64,35,160,36,0,36,0,35,128,35,96,35,224,35,224,36,0,43,64
-    ,27,64,36,0,35,224,35,32,17,128,35,128,44,32,35,32,34,192,34,224,34,192,36,0,34,96,35,64,26,64,35,192,35,64,34,192,34,224,26,192,36,0,36,0,43,64
-    ,27,64,36,0,35,224,35,224,26,160,35,128,36,32,34,96,43,224,44,0,26,128,35,32,34,224,44,96,43,32,35,0,34,160,43,192,44,32,34,64,35,192,36,32,43,64
-    ,27,64,36,0,35,224,44,32,26,128,35,128,44,0,42,96,43,224,35,224,34,192,26,192,27,0,44,32,35,64,34,192,42,192,43,192,44,0,42,128,35,160,36,32,43,64
-    ,27,64,36,0,35,224,44,32,34,192,35,160,44,32,34,96,43,224,36,0,34,160,35,0,34,224,44,64,43,64,35,0,34,160,43,224,44,32,34,96,35,192,36,32,43,64
-    ,27,64,36,0,35,224,35,160,26,0,26,224,44,0,26,224,34,224,35,32,34,192,35,224,26,64,43,128,26,96,35,192,35,0,34,224,35,32,34,160,36,0,36,0,43,64
-    ,27,64,36,0,35,224,35,64,27,32,27,32,35,192,36,0,35,32,35,32,35,224,36,0,35,160,35,0,35,128,36,0,35,224,35,64,35,32,35,224,35,224,36,0,43,64
-    ,27,64,44,0,35,224,44,0,44,0,44,0,36,0,35,224,36,0,36,0,35,224,35,224,36,0,44,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,36,0,43,32
-    ,27,64,36,0,35,224,35,224,35,224,35,224,35,224,36,0,35,224,35,224,36,0,36,0,35,224,35,224,35,224,36,0,36,0,35,224,35,224,36,0,35,224,36,32,43,64
-    ,35,32,52,0,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,52,0,51,32
-    ,8,160,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,16,160
-};
-const size_t scales_1000_size = sizeof(scales_1000_o) / sizeof(scales_1000_o[0]);
-
-const unsigned int scales_1500_w = 24;
-const unsigned int scales_1500_x = 148;
-const unsigned int scales_1500_y = 124;
-const unsigned char scales_1500_o[] PROGMEM={
-    8,96,66,64,74,96,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,32,16,128
-    ,65,160,221,99,237,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,221,67,73,192
-    ,65,160,229,35,237,35,237,34,237,34,237,34,237,35,237,35,237,35,237,34,237,34,237,35,237,34,237,34,237,34,237,34,237,34,237,35,237,34,237,34,237,34,237,35,229,35,73,192
-    ,57,160,229,67,237,67,237,35,237,35,237,67,237,35,237,67,237,67,237,67,237,67,237,67,237,35,237,67,237,67,237,35,237,35,237,67,245,99,237,67,237,35,237,67,229,67,73,192
-    ,57,160,229,67,237,35,237,67,237,67,229,2,237,67,237,35,229,2,220,194,220,226,237,35,237,67,220,226,212,162,237,67,237,67,237,35,204,130,229,2,237,67,237,35,229,67,73,192
-    ,57,160,221,67,245,67,220,226,122,193,130,225,245,67,229,2,114,96,147,65,163,129,237,67,196,98,130,225,139,1,163,161,237,67,147,33,155,65,122,161,220,194,245,67,229,35,73,192
-    ,57,160,221,67,245,67,212,194,188,34,139,1,245,67,229,2,114,128,237,35,245,99,245,67,122,193,220,194,237,67,122,193,188,34,139,33,253,163,171,193,163,129,245,99,229,35,73,192
-    ,57,160,229,67,237,35,245,99,220,226,130,225,237,67,229,2,130,225,130,193,155,65,229,2,122,193,220,226,237,67,147,33,147,65,171,193,253,131,196,66,155,97,245,99,229,35,73,192
-    ,57,160,229,67,237,35,237,67,220,194,139,1,245,99,237,67,237,67,245,99,139,1,188,2,139,1,229,2,245,99,147,33,163,129,171,161,253,163,196,66,155,97,245,99,229,35,73,192
-    ,57,160,229,67,237,67,229,34,196,66,106,64,229,2,220,226,212,162,220,226,114,129,212,162,155,65,180,2,204,130,130,225,212,194,106,96,229,2,139,1,196,66,245,99,229,67,73,192
-    ,57,160,229,35,245,67,212,162,155,97,155,97,180,2,220,226,155,97,139,1,188,34,245,99,220,226,155,65,147,33,220,194,245,99,188,34,139,1,180,2,237,67,237,35,229,67,73,192
-    ,57,160,229,67,237,67,237,67,245,99,245,99,237,67,237,67,245,67,237,67,245,99,237,35,237,67,245,99,237,67,237,67,237,35,245,67,237,67,245,99,237,35,237,67,229,67,73,192
-    ,57,160,229,67,245,67,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,229,35,73,192
-    ,57,128,213,67,229,67,221,67,229,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,229,67,229,67,221,67,221,67,221,67,221,67,221,67,221,67,229,67,221,67,65,192
-    ,0,32,41,128,49,192,49,160,41,160,49,160,49,160,49,192,49,160,49,160,49,192,49,160,49,160,49,160,49,160,49,160,41,160,49,192,49,160,41,160,49,160,49,192,41,160,8,64
-};
-const unsigned char scales_1500_g[] PROGMEM={
-    8,64,33,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,33,96,16,96
-    ,25,64,59,224,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,59,224,25,96
-    ,17,64,43,224,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,1,96
-    ,17,64,43,224,36,0,35,224,35,224,36,0,35,224,35,224,36,0,36,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,35,224,36,0,36,0,35,224,36,0,35,224,9,96
-    ,17,64,43,224,35,224,36,0,36,0,35,224,35,224,35,224,35,192,35,160,35,160,35,224,36,0,35,192,35,160,36,0,36,0,36,0,35,160,35,224,36,0,35,224,35,224,9,96
-    ,17,64,43,224,36,0,35,192,26,128,26,128,44,0,35,224,18,32,26,192,27,0,36,0,35,128,34,160,34,160,35,0,44,0,34,160,34,192,26,96,35,192,36,0,35,224,9,96
-    ,17,64,43,224,36,0,35,192,35,64,26,128,44,0,35,192,26,32,44,0,36,32,36,0,26,128,35,160,44,0,34,96,35,96,34,160,44,64,35,0,34,224,36,32,35,224,9,96
-    ,17,64,43,224,35,224,36,0,35,160,26,96,44,0,35,224,34,160,42,160,26,192,35,224,34,128,43,192,44,0,42,192,42,224,43,0,44,32,35,96,26,192,36,32,35,224,9,96
-    ,17,64,43,224,35,224,36,0,35,160,26,128,44,0,35,224,44,0,44,32,26,128,35,64,34,160,43,192,44,0,42,160,35,0,43,0,44,64,35,64,34,192,36,32,35,224,9,96
-    ,17,64,43,224,36,0,35,224,27,64,18,0,35,224,35,192,35,128,35,192,26,96,35,160,34,192,35,32,35,128,34,128,35,192,26,64,43,224,34,160,35,96,36,0,35,224,9,96
-    ,17,64,43,224,36,0,35,160,26,192,26,160,27,32,35,224,34,224,34,192,35,96,36,0,35,192,34,224,34,192,35,192,36,0,35,96,34,160,35,64,36,0,35,224,35,224,9,96
-    ,17,64,43,224,35,224,36,0,44,0,44,0,36,0,36,0,44,0,44,0,36,0,35,224,36,0,44,0,44,0,36,0,35,224,36,0,36,0,36,0,35,224,35,224,35,224,9,96
-    ,17,64,43,224,36,0,35,224,35,224,35,224,35,224,36,0,35,224,35,224,35,224,36,0,35,224,35,224,35,224,35,224,36,0,35,224,35,224,35,224,36,0,36,0,35,224,9,96
-    ,25,32,59,192,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,192,9,96
-    ,8,32,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,16,224,0,32
-};
-const size_t scales_1500_size = sizeof(scales_1500_o) / sizeof(scales_1500_o[0]);
-
-const unsigned int scales_2000_w = 23;
-const unsigned int scales_2000_x = 173;
-const unsigned int scales_2000_y = 124;
-const unsigned char scales_2000_o[] PROGMEM={
-    49,160,74,128,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,96,33,32
-    ,172,98,237,163,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,67,237,163,131,97
-    ,172,66,245,99,237,34,237,34,237,34,237,34,237,35,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,35,237,34,245,99,131,97
-    ,172,66,245,99,237,35,237,67,237,67,237,35,237,35,237,66,245,99,237,67,237,35,237,35,237,67,245,99,237,67,237,35,237,67,245,99,237,67,237,35,237,35,237,131,131,97
-    ,172,66,245,99,237,35,212,194,220,194,237,67,237,67,237,67,212,130,229,2,237,67,237,67,220,226,212,162,237,67,237,67,237,67,212,162,229,2,237,67,237,34,237,131,131,97
-    ,172,66,245,131,188,34,147,33,114,96,188,2,245,99,147,33,147,65,114,129,220,226,204,130,130,225,139,33,163,129,245,67,147,33,147,65,122,161,212,194,237,67,237,99,131,65
-    ,172,66,245,99,229,2,245,99,204,130,139,1,212,162,130,193,253,163,179,226,163,161,147,65,212,162,245,99,122,193,188,34,139,1,253,163,180,2,155,97,245,99,237,99,131,97
-    ,172,66,245,99,237,34,245,99,155,97,188,66,196,66,155,97,253,131,196,98,147,65,147,33,220,226,245,67,155,97,155,97,163,161,245,131,196,98,139,33,245,67,237,99,131,97
-    ,172,66,237,99,245,99,196,98,147,33,253,131,188,34,155,97,253,163,196,66,155,97,139,33,220,226,245,99,147,65,163,129,163,129,253,163,196,98,147,65,245,67,237,99,131,97
-    ,172,66,245,131,196,66,81,224,212,162,229,2,212,194,106,64,229,2,139,1,196,98,163,129,171,193,212,162,130,193,220,194,106,96,229,2,139,33,188,34,245,67,237,99,131,97
-    ,172,66,245,131,180,2,155,97,163,161,171,193,237,67,196,66,139,1,179,225,237,67,229,2,155,97,147,33,212,194,245,99,196,66,139,1,171,226,237,67,237,34,237,99,131,97
-    ,172,66,237,99,237,67,245,99,237,67,245,67,237,35,245,67,237,67,245,99,237,35,237,67,245,99,245,67,237,67,237,35,245,67,237,67,245,99,237,67,237,34,237,99,131,65
-    ,172,66,245,99,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,245,99,131,97
-    ,164,34,229,131,221,67,221,67,221,67,221,67,221,67,221,67,221,67,229,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,229,131,123,65
-    ,25,32,49,192,41,160,41,192,41,160,49,160,49,160,49,192,49,192,49,160,49,160,49,192,49,160,49,160,49,160,49,192,49,192,49,160,49,160,41,192,41,160,49,160,16,160
-};
-const unsigned char scales_2000_g[] PROGMEM={
-    49,160,74,128,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,96,33,32
-    ,172,98,237,163,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,67,237,163,131,97
-    ,172,66,245,99,237,34,237,34,237,34,237,34,237,35,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,34,237,35,237,34,245,99,131,97
-    ,172,66,245,99,237,35,237,67,237,67,237,35,237,35,237,66,245,99,237,67,237,35,237,35,237,67,245,99,237,67,237,35,237,67,245,99,237,67,237,35,237,35,237,131,131,97
-    ,172,66,245,99,237,35,212,194,220,194,237,67,237,67,237,67,212,130,229,2,237,67,237,67,220,226,212,162,237,67,237,67,237,67,212,162,229,2,237,67,237,34,237,131,131,97
-    ,172,66,245,131,188,34,147,33,114,96,188,2,245,99,147,33,147,65,114,129,220,226,204,130,130,225,139,33,163,129,245,67,147,33,147,65,122,161,212,194,237,67,237,99,131,65
-    ,172,66,245,99,229,2,245,99,204,130,139,1,212,162,130,193,253,163,179,226,163,161,147,65,212,162,245,99,122,193,188,34,139,1,253,163,180,2,155,97,245,99,237,99,131,97
-    ,172,66,245,99,237,34,245,99,155,97,188,66,196,66,155,97,253,131,196,98,147,65,147,33,220,226,245,67,155,97,155,97,163,161,245,131,196,98,139,33,245,67,237,99,131,97
-    ,172,66,237,99,245,99,196,98,147,33,253,131,188,34,155,97,253,163,196,66,155,97,139,33,220,226,245,99,147,65,163,129,163,129,253,163,196,98,147,65,245,67,237,99,131,97
-    ,172,66,245,131,196,66,81,224,212,162,229,2,212,194,106,64,229,2,139,1,196,98,163,129,171,193,212,162,130,193,220,194,106,96,229,2,139,33,188,34,245,67,237,99,131,97
-    ,172,66,245,131,180,2,155,97,163,161,171,193,237,67,196,66,139,1,179,225,237,67,229,2,155,97,147,33,212,194,245,99,196,66,139,1,171,226,237,67,237,34,237,99,131,97
-    ,172,66,237,99,237,67,245,99,237,67,245,67,237,35,245,67,237,67,245,99,237,35,237,67,245,99,245,67,237,67,237,35,245,67,237,67,245,99,237,67,237,34,237,99,131,65
-    ,172,66,245,99,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,245,99,131,97
-    ,164,34,229,131,221,67,221,67,221,67,221,67,221,67,221,67,221,67,229,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,229,131,123,65
-    ,25,32,49,192,41,160,41,192,41,160,49,160,49,160,49,192,49,192,49,160,49,160,49,192,49,160,49,160,49,160,49,192,49,192,49,160,49,160,41,192,41,160,49,160,16,160
-};
-const size_t scales_2000_size = sizeof(scales_2000_o) / sizeof(scales_2000_o[0]);
-
-const unsigned int scales_2500_w = 24;
-const unsigned int scales_2500_x = 197;
-const unsigned int scales_2500_y = 124;
-const unsigned char scales_2500_o[] PROGMEM={
-    33,64,74,96,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,64,74,96,66,0,0,0
-    ,139,161,237,163,229,67,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,229,99,237,131,213,35,0,128
-    ,147,129,245,99,237,2,237,34,237,34,237,34,237,34,237,35,237,34,237,34,237,34,237,34,237,35,237,34,237,34,237,35,237,35,237,34,237,34,237,35,237,35,245,35,213,2,0,192
-    ,147,161,245,131,237,34,237,67,245,99,237,67,237,34,237,67,245,99,245,99,237,67,237,34,237,67,245,99,237,67,237,35,237,35,245,99,245,99,237,67,237,35,237,67,213,34,0,192
-    ,147,129,245,131,237,35,212,162,180,2,220,194,245,67,228,226,196,98,196,66,220,194,245,67,229,2,180,2,212,162,237,67,237,67,204,130,188,2,229,34,237,67,237,67,213,34,0,192
-    ,147,129,245,131,228,226,163,129,171,193,106,64,237,35,180,2,122,161,179,226,204,130,237,35,122,161,179,226,114,96,212,162,196,66,139,1,163,161,139,1,237,67,237,67,213,34,0,192
-    ,147,129,245,131,237,34,237,67,253,131,130,193,220,226,179,225,155,97,237,67,253,131,196,66,147,33,253,195,188,34,155,129,147,33,220,194,253,131,122,161,220,194,245,67,213,34,0,192
-    ,147,129,245,131,229,34,245,99,204,130,122,193,245,99,204,130,147,33,114,129,188,2,196,66,155,97,245,131,196,98,139,33,139,1,220,194,245,67,139,1,212,194,245,99,213,34,0,192
-    ,147,161,245,99,237,67,228,226,130,225,229,3,245,67,245,99,253,163,229,2,114,129,188,34,155,97,253,195,188,66,155,129,139,33,220,226,253,131,122,193,220,194,245,67,213,34,0,192
-    ,147,129,245,131,229,2,73,128,163,129,204,98,220,226,196,66,196,66,163,129,155,97,229,2,106,64,196,98,122,161,212,162,171,193,155,65,188,2,138,225,237,67,237,67,213,34,0,192
-    ,147,129,245,131,220,226,188,34,188,34,179,225,220,226,212,162,163,161,180,2,229,34,245,67,212,162,163,129,204,98,237,67,237,35,180,2,171,193,229,2,237,67,237,67,213,34,0,192
-    ,147,129,245,99,237,35,245,99,245,99,245,99,237,67,237,67,245,99,245,99,237,67,237,35,237,67,245,99,245,67,237,35,237,67,245,99,245,99,237,67,237,35,237,67,213,34,0,192
-    ,147,129,245,99,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,237,35,245,67,221,34,0,192
-    ,139,129,229,131,221,67,221,67,221,67,221,67,221,67,221,67,221,67,229,67,221,67,221,67,221,67,221,67,221,67,221,67,221,67,229,67,221,67,221,67,221,67,229,99,205,35,0,128
-    ,16,192,49,192,49,160,41,160,49,160,49,160,49,192,49,192,49,160,49,160,49,192,49,192,49,160,49,160,49,160,49,160,49,192,49,192,49,192,49,192,41,160,49,192,41,128,0,0
-};
-const unsigned char scales_2500_g[] PROGMEM={
-    8,160,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,96,25,64,0,0
-    ,26,96,52,32,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,52,0,51,160,24,128
-    ,18,64,36,0,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,35,224,36,0,43,160,24,96
-    ,18,64,44,0,35,224,36,0,44,0,36,0,35,224,36,0,44,0,44,0,36,0,35,224,36,0,36,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,36,0,59,192,32,64
-    ,18,64,36,0,35,224,35,160,35,64,35,192,36,0,35,192,35,96,35,64,35,160,36,0,35,224,35,64,35,160,36,0,36,0,35,128,35,64,35,224,35,224,36,0,59,192,32,96
-    ,18,64,36,0,35,224,35,0,27,0,26,32,36,0,27,32,18,96,27,64,35,128,36,0,26,128,35,32,26,64,35,160,35,96,34,160,35,0,34,160,44,0,36,0,59,192,32,96
-    ,18,96,36,0,35,224,36,0,44,64,26,96,35,192,27,0,34,192,44,0,36,32,35,96,34,160,44,64,43,64,34,224,34,192,43,160,36,32,26,64,35,192,36,0,59,192,32,96
-    ,18,96,36,0,35,224,36,0,35,128,26,128,36,0,35,128,42,192,26,96,35,64,35,96,42,224,36,32,43,96,42,192,42,160,43,192,36,0,34,128,35,160,36,0,59,192,32,96
-    ,18,96,36,0,36,0,35,224,26,160,35,224,36,0,36,0,44,64,35,224,26,96,35,96,34,192,44,64,43,64,34,224,34,160,43,192,44,32,34,96,35,192,36,0,59,192,32,96
-    ,18,64,36,0,35,224,17,192,26,224,35,96,35,192,35,128,35,96,34,224,34,224,43,224,26,64,43,96,34,96,35,160,35,32,34,192,35,64,34,160,36,0,36,0,59,192,32,96
-    ,18,64,36,0,35,192,27,32,27,64,27,0,35,192,35,160,35,0,35,64,35,224,36,0,35,160,35,0,35,128,36,0,35,224,35,64,35,32,35,224,35,224,36,0,59,192,32,96
-    ,18,64,44,0,35,224,44,0,44,0,44,0,36,0,36,0,36,0,36,0,35,224,35,224,36,0,44,0,36,0,35,224,35,224,36,0,36,0,35,224,35,224,36,0,59,192,32,96
-    ,18,96,36,0,35,224,35,224,35,224,35,224,36,0,35,224,35,224,35,224,36,0,36,0,35,224,35,224,35,224,36,0,36,0,35,224,35,224,36,0,35,224,28,0,59,192,32,96
-    ,26,64,52,0,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,51,224,52,0,59,160,32,96
-    ,8,96,25,0,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,24,224,25,0,16,192,0,0
-};
-const size_t scales_2500_size = sizeof(scales_2500_o) / sizeof(scales_2500_o[0]);
-
-
-const unsigned int speeds[6] PROGMEM = {
-    100,
-    500,
-    1000,
-    1500,
-    2000,
-    2500
-}; 
-const unsigned char* scales_o[6] PROGMEM = {
-    scales_0_o,
-    scales_500_o,
-    scales_1000_o,
-    scales_1500_o,
-    scales_2000_o,
-    scales_2500_o
-}; 
-const unsigned char* scales_g[6] PROGMEM = {
-    scales_0_g,
-    scales_500_g,
-    scales_1000_g,
-    scales_1500_g,
-    scales_2000_g,
-    scales_2500_g
-};
-const unsigned int scales_width[6] PROGMEM = {
-    scales_0_w,
-    scales_500_w,
-    scales_1000_w,
-    scales_1500_w,
-    scales_2000_w,
-    scales_2500_w
-}; 
-const unsigned int scales_x[6] PROGMEM = {
-    scales_0_x,
-    scales_500_x,
-    scales_1000_x,
-    scales_1500_x,
-    scales_2000_x,
-    scales_2500_x
-}; 
-const size_t scales_size[6] PROGMEM = {
-    scales_0_size,
-    scales_500_size,
-    scales_1000_size,
-    scales_1500_size,
-    scales_2000_size,
-    scales_2500_size
-};
@@ -4,17 +4,21 @@
 // IMPORTANT: LIBRARY MUST BE SPECIFICALLY CONFIGURED FOR EITHER TFT SHIELD
 // OR BREAKOUT BOARD USAGE.
 
-#include <SPI.h>
-#include "../logging/SerialLogger.h"
+#include "../logging/log.h"
+#include "../metrics/trace.h"
 #include "display_spi.h"
 #include "lcd_spi_registers.h"
 #include "mcu_spi_magic.h"
+#include "rle565.h"
 
 #define TFTLCD_DELAY16  0xFFFF
 #define TFTLCD_DELAY8   0x7F
 #define MAX_REG_NUM     24
 #define swap(a, b) { int16_t t = a; a = b; b = t; }
 
+TRACE_POINT(trace_spi_blit, "spiBlit");
+TRACE_POINT(trace_blit_wait, "blitWait");
+
 
 static const uint8_t display_buffer[TFT_WIDTH * TFT_HEIGHT * 2] PROGMEM = {0};
 static const uint8_t PROGMEM initcmd[] = {
@@ -72,14 +76,99 @@ uint16_t DISPLAY_SPI::RGB_to_565(uint8_t r, uint8_t g, uint8_t b)
  */
 void DISPLAY_SPI::draw_background(const unsigned char* image, size_t size)
 {
-  SPI_BEGIN_TRANSACTION();
-	CS_ACTIVE;
-	set_addr_window(0, 0, width, height);
-	writeCommand(ILI9341_MEMORYWRITE);
-	CD_DATA;
-	spi->transferBytes(image, nullptr, size);
-	CS_IDLE;
-  SPI_END_TRANSACTION();
+  wait_for_blit(draw_background_async(image, size));
+}
+
+/**
+ * @brief Queues a backgound image for transfer and returns immediately
+ * @param image - array to image containing 565 color values per pixel. Must remain valid until the blit completed.
+ * @param size - the number of elements in the image (should be wxhx2)
+ * @param callback - optional callback invoked from the blitter task on completion
+ * @param context - context pointer handed to the callback
+ * @returns the fence identifying the blit
+ */
+uint32_t DISPLAY_SPI::draw_background_async(const unsigned char* image, size_t size, blit_callback_t callback, void* context)
+{
+  return draw_image_async(image, size, 0, 0, width, height, callback, context);
+}
+
+/**
+ * @brief Queues a compressed image for transfer and returns immediately
+ * @param image - the rle565 image. Must remain valid until the blit completed.
+ * @param x - starting x coordinate
+ * @param y - starting y coordinate
+ * @param callback - optional callback invoked from the blitter task on completion
+ * @param context - context pointer handed to the callback
+ * @returns the fence identifying the blit
+ */
+uint32_t DISPLAY_SPI::draw_compressed_async(const unsigned char* image, uint16_t x, uint16_t y, blit_callback_t callback, void* context)
+{
+  return draw_compressed_region_async(image, 0, 0, x, y, rle565_width(image), rle565_height(image), callback, context);
+}
+
+/**
+ * @brief Queues a rectangular region of a compressed image for transfer and returns immediately
+ * @param image - the rle565 image. Must remain valid until the blit completed.
+ * @param src_x - x coordinate of the region in the image
+ * @param src_y - y coordinate of the region in the image
+ * @param x - starting x coordinate on the display
+ * @param y - starting y coordinate on the display
+ * @param w - region width
+ * @param h - region height
+ * @param callback - optional callback invoked from the blitter task on completion
+ * @param context - context pointer handed to the callback
+ * @returns the fence identifying the blit
+ */
+uint32_t DISPLAY_SPI::draw_compressed_region_async(const unsigned char* image, uint16_t src_x, uint16_t src_y, uint16_t x, uint16_t y, uint16_t w, uint16_t h, blit_callback_t callback, void* context)
+{
+  blit_job job;
+  job.image = image;
+  job.size = (size_t)w * h * 2;
+  job.compressed = true;
+  job.src_x = src_x;
+  job.src_y = src_y;
+  job.x = x;
+  job.y = y;
+  job.w = w;
+  job.h = h;
+  job.callback = callback;
+  job.context = context;
+  return queue_blit(job);
+}
+
+/**
+ * @brief Queues a rectangular region composed of two compressed images of the same size and returns immediately.
+ * Columns left of the split come from the first image, the others from the second, all in one address window.
+ * @param left - the rle565 image left of the split. Must remain valid until the blit completed.
+ * @param right - the rle565 image from the split on. Must remain valid until the blit completed.
+ * @param split - the first column in image coordinates taken from the right image
+ * @param src_x - x coordinate of the region in the images
+ * @param src_y - y coordinate of the region in the images
+ * @param x - starting x coordinate on the display
+ * @param y - starting y coordinate on the display
+ * @param w - region width
+ * @param h - region height
+ * @param callback - optional callback invoked from the blitter task on completion
+ * @param context - context pointer handed to the callback
+ * @returns the fence identifying the blit
+ */
+uint32_t DISPLAY_SPI::draw_compressed_split_async(const unsigned char* left, const unsigned char* right, uint16_t split, uint16_t src_x, uint16_t src_y, uint16_t x, uint16_t y, uint16_t w, uint16_t h, blit_callback_t callback, void* context)
+{
+  blit_job job;
+  job.image = left;
+  job.right = right;
+  job.split = split;
+  job.size = (size_t)w * h * 2;
+  job.compressed = true;
+  job.src_x = src_x;
+  job.src_y = src_y;
+  job.x = x;
+  job.y = y;
+  job.w = w;
+  job.h = h;
+  job.callback = callback;
+  job.context = context;
+  return queue_blit(job);
 }
 
 /**
@@ -93,14 +182,60 @@ void DISPLAY_SPI::draw_background(const unsigned char* image, size_t size)
  */
 void DISPLAY_SPI::draw_image(const unsigned char* image, size_t size, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-  SPI_BEGIN_TRANSACTION();
-	CS_ACTIVE;
-	set_addr_window(x, y, w, h);
-	writeCommand(ILI9341_MEMORYWRITE);
-	CD_DATA;
-	spi->transferBytes(image, nullptr, size);
-	CS_IDLE;
-  SPI_END_TRANSACTION();
+  wait_for_blit(draw_image_async(image, size, x, y, w, h));
+}
+
+/**
+ * @brief Queues an image for transfer and returns immediately
+ * @param image - array to image containing 565 color values per pixel. Must remain valid until the blit completed.
+ * @param size - the number of elements in the image (should be wxhx2)
+ * @param x - starting x coordinate
+ * @param y - starting y coordinate
+ * @param w - image width
+ * @param h - image height
+ * @param callback - optional callback invoked from the blitter task on completion
+ * @param context - context pointer handed to the callback
+ * @returns the fence identifying the blit
+ */
+uint32_t DISPLAY_SPI::draw_image_async(const unsigned char* image, size_t size, uint16_t x, uint16_t y, uint16_t w, uint16_t h, blit_callback_t callback, void* context)
+{
+  blit_job job;
+  job.image = image;
+  job.size = size;
+  job.x = x;
+  job.y = y;
+  job.w = w;
+  job.h = h;
+  job.callback = callback;
+  job.context = context;
+  return queue_blit(job);
+}
+
+/**
+ * @brief Queues a rectangular region of a larger image for transfer and returns immediately
+ * @param image - pointer to the first pixel of the region. Must remain valid until the blit completed.
+ * @param stride - the number of bytes per row in the source image
+ * @param x - starting x coordinate
+ * @param y - starting y coordinate
+ * @param w - region width
+ * @param h - region height
+ * @param callback - optional callback invoked from the blitter task on completion
+ * @param context - context pointer handed to the callback
+ * @returns the fence identifying the blit
+ */
+uint32_t DISPLAY_SPI::draw_image_region_async(const unsigned char* image, size_t stride, uint16_t x, uint16_t y, uint16_t w, uint16_t h, blit_callback_t callback, void* context)
+{
+  blit_job job;
+  job.image = image;
+  job.size = (size_t)w * h * 2;
+  job.stride = stride;
+  job.x = x;
+  job.y = y;
+  job.w = w;
+  job.h = h;
+  job.callback = callback;
+  job.context = context;
+  return queue_blit(job);
 }
 
 /**
@@ -114,6 +249,7 @@ void DISPLAY_SPI::draw_pixel(int16_t x, int16_t y, uint16_t color)
   // Clip first...
   if ((x >= 0) && (x < width) && (y >= 0) && (y < height)) {
     // THEN set up transaction (if needed) and draw...
+    flush();
     START_WRITE();
     set_addr_window(x, y, 1, 1);
     SPI_WRITE16(color);
@@ -130,7 +266,7 @@ void DISPLAY_SPI::draw_pixel(int16_t x, int16_t y, uint16_t color)
  */
 void DISPLAY_SPI::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) 
 {
-  drawLine(x, y, x+w-1, y, color);
+  fill_rect(x, y, w, 1, color);
 }
 		
 /**
@@ -142,7 +278,7 @@ void DISPLAY_SPI::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
  */
 void DISPLAY_SPI::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) 
 {
-  drawLine(x, y, x, y+h-1, color);
+  fill_rect(x, y, 1, h, color);
 }
 
 /**
@@ -203,9 +339,20 @@ void DISPLAY_SPI::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint1
  */
 void DISPLAY_SPI::fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
-  for (int16_t i=x; i<x+w; i++) {
-    drawFastVLine(i, y, h, color);
-  }
+  // clip to the display first...
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > (int16_t)width) w = width - x;
+  if (y + h > (int16_t)height) h = height - y;
+  if (w <= 0 || h <= 0) return;
+
+  // ...then set the address window once and stream the color for the whole area
+  const uint8_t pattern[2] = { (uint8_t)(color >> 8), (uint8_t)(color & 0xff) };
+  flush();
+  START_WRITE();
+  set_addr_window(x, y, w, h);
+  spi->write_pattern(pattern, sizeof(pattern), (uint32_t)w * h);
+  END_WRITE();
 }
 
 /**
@@ -217,6 +364,14 @@ void DISPLAY_SPI::fillScreen(uint16_t color)
   fill_rect(0, 0, width, height, color);
 }
 
+/**
+ * @brief Blocks until all queued blits have been written to the bus
+ */
+void DISPLAY_SPI::flush()
+{
+  wait_for_blit(fence_issued);
+}
+
 /**
  * @brief Gets the display height
  * @returns The display height
@@ -253,25 +408,31 @@ int16_t DISPLAY_SPI::get_width() const
  */
 void DISPLAY_SPI::init()
 {
-	Logger.Info(F("....Starting SPI display init."));
-	pinMode(RS, OUTPUT);
-	pinMode(CS, OUTPUT);
+	LOG_INFO(SPI, "....Starting SPI display init.");
+	hal_gpio_mode(RS, HAL_PIN_OUTPUT);
+	hal_gpio_mode(CS, HAL_PIN_OUTPUT);
 	CS_IDLE;
 	CD_DATA;
 	
-	spi_settings = SPISettings(SPI_BUS_FREQUENCY, MSBFIRST, SPI_MODE0);
-  spi = new SPIClass(HSPI);
-  spi->begin(SCK, -1, SID, CS);
+  spi = HAL_SPI_Bus::create(SCK, -1, SID, CS, SPI_BUS_FREQUENCY);
 	  // explicitely pass the PINs since we need to avoid the assignment of the MISO pin as 
 		// this pin is required elsewhere.
-	if(RESET > 0) pinMode(RESET, OUTPUT);
+	if(RESET > 0) hal_gpio_mode(RESET, HAL_PIN_OUTPUT);
 	if(LED > 0)
 	{
-		pinMode(LED, OUTPUT);
-		digitalWrite(LED, LOW);
+		hal_gpio_mode(LED, HAL_PIN_OUTPUT);
+		hal_gpio_write(LED, false);
 	}
 	reset();
 
+	if(blit_queue == nullptr)
+	{
+		blit_queue = hal_queue_create(BLIT_QUEUE_DEPTH, sizeof(blit_job));
+		blit_done = hal_sem_create();
+		blit_task = hal_task_create(blit_runner, "blitRunner", BLIT_TASK_STACK, this, BLIT_TASK_PRIORITY, BLIT_TASK_CORE);
+		Trace.add_task(blit_task, "blitRunner");
+	}
+
 	uint8_t cmd, x, numArgs;
 	const uint8_t *addr = initcmd;
 	while ((cmd = pgm_read_byte(addr++)) > 0) {
@@ -280,14 +441,25 @@ void DISPLAY_SPI::init()
 		sendCommand(cmd, addr, numArgs);
 		addr += numArgs;
 		if (x & 0x80)
-		delay(150);
+		hal_delay_ms(150);
 	}
 
 	rotation = 0;
 	width = TFT_WIDTH;
 	height = TFT_HEIGHT;
 	toggle_backlight(true);
-	Logger.Info(F("....SPI display init complete."));
+	LOG_INFO(SPI, "....SPI display init complete.");
+}
+
+/**
+ * @brief Checks whether a queued blit has completed
+ * @param fence - the fence returned when the blit was queued
+ * @returns True if the blit has been written to the bus
+ */
+bool DISPLAY_SPI::is_blit_complete(uint32_t fence) const
+{
+	return (int32_t)(fence_completed - fence) >= 0;
+		// wrap safe comparison of the fence counters
 }
 
 /**
@@ -297,17 +469,17 @@ void DISPLAY_SPI::reset()
 {
 	if(RESET > 0)
 	{
-		digitalWrite(RESET, LOW);
-		delay(20);
-		digitalWrite(RESET, HIGH);
-		delay(120);
+		hal_gpio_write(RESET, false);
+		hal_delay_ms(20);
+		hal_gpio_write(RESET, true);
+		hal_delay_ms(120);
 
 		sendCommand(ILI9341_NOP);
 	}
 	else
 	{
 		sendCommand(ILI9341_SOFTRESET);
-		delay(120);
+		hal_delay_ms(120);
 	}
 }
 
@@ -339,6 +511,17 @@ void DISPLAY_SPI::set_rotation(uint8_t r)
   sendCommand(ILI9341_MADCTL, &r, 1);
 }
 
+/**
+ * @brief Selects whether blits are handed to the blitter task or written by the calling task. Waits for the
+ * queued blits before it writes synchronously.
+ * @param queued - true to queue the blits (the default), false to write them synchronously
+ */
+void DISPLAY_SPI::set_blit_queued(bool queued)
+{
+	if(!queued) flush();
+	blit_queued = queued;
+}
+
 /**
  * @brief Toggles the backlight on or off if an LED Pin is connected
  * @param state - true to turn the backlight on, false to turn it off. 
@@ -349,18 +532,107 @@ void DISPLAY_SPI::toggle_backlight(boolean state)
 	{
 		if(state)
 		{
-			digitalWrite(LED, HIGH);
+			hal_gpio_write(LED, true);
 		}
 		else
 		{
-			digitalWrite(LED, LOW);
+			hal_gpio_write(LED, false);
 		}
 	}
 }
 
+/**
+ * @brief Blocks until a queued blit has completed
+ * @param fence - the fence returned when the blit was queued
+ */
+void DISPLAY_SPI::wait_for_blit(uint32_t fence)
+{
+	TRACE_SCOPE(trace_blit_wait);
+	while(!is_blit_complete(fence)) hal_sem_take(blit_done, HAL_WAIT_FOREVER);
+}
+
 #pragma endregion
 
 #pragma region protected methods
+/**
+ * @brief Task function draining the blit queue onto the SPI bus
+ * @param args - pointer to the DISPLAY_SPI instance
+ */
+void DISPLAY_SPI::blit_runner(void* args)
+{
+	DISPLAY_SPI *_this = reinterpret_cast<DISPLAY_SPI *>(args);
+	blit_job job;
+	for(;;)
+	{
+		if(!hal_queue_receive(_this->blit_queue, &job, HAL_WAIT_FOREVER)) continue;
+		_this->blit(job);
+		_this->fence_completed = job.fence;
+		if(job.callback != nullptr) job.callback(job.fence, job.context);
+		hal_sem_give(_this->blit_done);
+	}
+}
+
+/**
+ * @brief Writes a single blit job to the bus
+ * @param job - the job to write
+ */
+void DISPLAY_SPI::blit(const blit_job& job)
+{
+	TRACE_SCOPE(trace_spi_blit);
+  SPI_BEGIN_TRANSACTION();
+	CS_ACTIVE;
+	set_addr_window(job.x, job.y, job.w, job.h);
+	writeCommand(ILI9341_MEMORYWRITE);
+	CD_DATA;
+	size_t row = (size_t)job.w * 2;
+	if(job.compressed)
+	{
+		// decode row by row into the chunk buffer and hand it to the bus whenever the next row would not fit.
+		// A split job decodes the row from two images, the left span from image and the rest from right.
+		uint16_t lw = job.w;
+		if(job.right != nullptr && job.split < job.src_x + job.w) lw = job.split > job.src_x ? job.split - job.src_x : 0;
+		size_t fill = 0;
+		for(uint16_t i = 0; i < job.h; i++)
+		{
+			if(fill + row > BLIT_CHUNK_BYTES) { spi->write_bytes(blit_chunk, fill); fill = 0; }
+			if(lw > 0) rle565_decode_span(job.image, job.src_y + i, job.src_x, lw, blit_chunk + fill);
+			if(lw < job.w) rle565_decode_span(job.right, job.src_y + i, job.src_x + lw, job.w - lw, blit_chunk + fill + lw * 2);
+			fill += row;
+		}
+		if(fill > 0) spi->write_bytes(blit_chunk, fill);
+	}
+	else if(job.stride == 0 || job.stride == row) spi->write_bytes(job.image, job.size);
+	else
+	{
+		// region of a larger image, stream it row by row into the same address window
+		for(uint16_t i = 0; i < job.h; i++) spi->write_bytes(job.image + i * job.stride, row);
+	}
+	CS_IDLE;
+  SPI_END_TRANSACTION();
+}
+
+/**
+ * @brief Queues a blit job and assigns its fence
+ * @param job - the job to queue
+ * @returns the fence identifying the blit
+ */
+uint32_t DISPLAY_SPI::queue_blit(blit_job& job)
+{
+	job.fence = fence_issued + 1;
+	if(blit_queue == nullptr || !blit_queued)
+	{
+		// blitter not running yet (before init) or switched off, so write synchronously
+		blit(job);
+		fence_issued = job.fence;
+		fence_completed = job.fence;
+		if(job.callback != nullptr) job.callback(job.fence, job.context);
+		return job.fence;
+	}
+	fence_issued = job.fence;
+	hal_queue_send(blit_queue, &job, HAL_WAIT_FOREVER);
+		// blocks if the queue is full, which throttles the producer to the bus speed
+	return job.fence;
+}
 /**
  * @brief Sets the LCD address window 
  * @param x1 - Upper left x
@@ -399,6 +671,7 @@ void DISPLAY_SPI::set_addr_window(unsigned int x1, unsigned int y1, unsigned int
  */
 void DISPLAY_SPI::sendCommand(uint8_t commandByte, const uint8_t *dataBytes, uint8_t numDataBytes) 
 {
+  flush();
   SPI_BEGIN_TRANSACTION();
   if (CS >= 0)
     SPI_CS_LOW();
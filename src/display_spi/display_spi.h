@@ -5,9 +5,53 @@
 #define _DISPLAY_SPI_H_
 
 #include "Arduino.h"
-#include <SPI.h>
+#include "../hal/hal.h"
 #include "mcu_spi_magic.h"
 
+#ifndef DISPLAY_CORE
+#define DISPLAY_CORE 1                  // display task and Arduino loop, see the task placement in controller.h
+#endif
+#define BLIT_QUEUE_DEPTH 16
+#define BLIT_TASK_STACK 2048
+#define BLIT_TASK_PRIORITY 2            // above the display task, so a queued region goes out before the next is drawn
+#ifndef BLIT_TASK_CORE
+#define BLIT_TASK_CORE DISPLAY_CORE
+    // the driver writes the bus with the CPU, there is no DMA, so a blitter on the control core would take its
+    // time from the input and RPM tasks. Placing it there (-DBLIT_TASK_CORE=0) is for comparison only, it has
+    // not been measured on the target.
+#endif
+#define BLIT_CHUNK_BYTES 2048
+    // compressed images are decoded row by row into a buffer of this size and written when it is full,
+    // must hold at least one row of TFT_HEIGHT pixels
+
+/**
+ * @brief Callback invoked from the blitter task once a queued blit has been written to the bus
+ * @param fence - the fence of the completed blit
+ * @param context - the context pointer passed when the blit was queued
+ */
+typedef void (*blit_callback_t)(uint32_t fence, void* context);
+
+/**
+ * @brief Describes a queued image transfer
+ */
+struct blit_job {
+    const unsigned char* image = nullptr;
+    size_t size = 0;
+    size_t stride = 0;      // bytes between source rows, 0 if the image is contiguous
+    bool compressed = false;    // image is an rle565 image, decoded from src_x, src_y
+    const unsigned char* right = nullptr;   // compressed only, image for the columns from split on
+    uint16_t split = 0;
+    uint16_t src_x = 0;
+    uint16_t src_y = 0;
+    uint16_t x = 0;
+    uint16_t y = 0;
+    uint16_t w = 0;
+    uint16_t h = 0;
+    uint32_t fence = 0;
+    blit_callback_t callback = nullptr;
+    void* context = nullptr;
+};
+
 /** 
  * This program implements the SPI display for the wheel.
  * if you don't need to control the LED pin,you can set it to 3.3V and set the pin definition to -1.
@@ -45,6 +89,60 @@ class DISPLAY_SPI
 		 */
 		void draw_background(const unsigned char* image, size_t size);
 
+		/**
+		 * @brief Queues a backgound image for transfer and returns immediately
+		 * @param image - array to image containing 565 color values per pixel. Must remain valid until the blit completed.
+		 * @param size - the number of elements in the image (should be wxhx2)
+		 * @param callback - optional callback invoked from the blitter task on completion
+		 * @param context - context pointer handed to the callback
+		 * @returns the fence identifying the blit
+		 */
+		uint32_t draw_background_async(const unsigned char* image, size_t size, blit_callback_t callback = nullptr, void* context = nullptr);
+
+		/**
+		 * @brief Queues a compressed image for transfer and returns immediately
+		 * @param image - the rle565 image. Must remain valid until the blit completed.
+		 * @param x - starting x coordinate
+		 * @param y - starting y coordinate
+		 * @param callback - optional callback invoked from the blitter task on completion
+		 * @param context - context pointer handed to the callback
+		 * @returns the fence identifying the blit
+		 */
+		uint32_t draw_compressed_async(const unsigned char* image, uint16_t x, uint16_t y, blit_callback_t callback = nullptr, void* context = nullptr);
+
+		/**
+		 * @brief Queues a rectangular region of a compressed image for transfer and returns immediately
+		 * @param image - the rle565 image. Must remain valid until the blit completed.
+		 * @param src_x - x coordinate of the region in the image
+		 * @param src_y - y coordinate of the region in the image
+		 * @param x - starting x coordinate on the display
+		 * @param y - starting y coordinate on the display
+		 * @param w - region width
+		 * @param h - region height
+		 * @param callback - optional callback invoked from the blitter task on completion
+		 * @param context - context pointer handed to the callback
+		 * @returns the fence identifying the blit
+		 */
+		uint32_t draw_compressed_region_async(const unsigned char* image, uint16_t src_x, uint16_t src_y, uint16_t x, uint16_t y, uint16_t w, uint16_t h, blit_callback_t callback = nullptr, void* context = nullptr);
+
+		/**
+		 * @brief Queues a rectangular region composed of two compressed images of the same size and returns immediately.
+		 * Columns left of the split come from the first image, the others from the second, all in one address window.
+		 * @param left - the rle565 image left of the split. Must remain valid until the blit completed.
+		 * @param right - the rle565 image from the split on. Must remain valid until the blit completed.
+		 * @param split - the first column in image coordinates taken from the right image
+		 * @param src_x - x coordinate of the region in the images
+		 * @param src_y - y coordinate of the region in the images
+		 * @param x - starting x coordinate on the display
+		 * @param y - starting y coordinate on the display
+		 * @param w - region width
+		 * @param h - region height
+		 * @param callback - optional callback invoked from the blitter task on completion
+		 * @param context - context pointer handed to the callback
+		 * @returns the fence identifying the blit
+		 */
+		uint32_t draw_compressed_split_async(const unsigned char* left, const unsigned char* right, uint16_t split, uint16_t src_x, uint16_t src_y, uint16_t x, uint16_t y, uint16_t w, uint16_t h, blit_callback_t callback = nullptr, void* context = nullptr);
+
 		/**
 		 * @brief Draws a bitmap on the display
 		 * @param x - X coordinate of the upper left corner
@@ -67,6 +165,34 @@ class DISPLAY_SPI
 		 */
 		void draw_image(const unsigned char* image, size_t size, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 
+		/**
+		 * @brief Queues an image for transfer and returns immediately
+		 * @param image - array to image containing 565 color values per pixel. Must remain valid until the blit completed.
+		 * @param size - the number of elements in the image (should be wxhx2)
+		 * @param x - starting x coordinate
+		 * @param y - starting y coordinate
+		 * @param w - image width
+		 * @param h - image height
+		 * @param callback - optional callback invoked from the blitter task on completion
+		 * @param context - context pointer handed to the callback
+		 * @returns the fence identifying the blit
+		 */
+		uint32_t draw_image_async(const unsigned char* image, size_t size, uint16_t x, uint16_t y, uint16_t w, uint16_t h, blit_callback_t callback = nullptr, void* context = nullptr);
+
+		/**
+		 * @brief Queues a rectangular region of a larger image for transfer and returns immediately
+		 * @param image - pointer to the first pixel of the region. Must remain valid until the blit completed.
+		 * @param stride - the number of bytes per row in the source image
+		 * @param x - starting x coordinate
+		 * @param y - starting y coordinate
+		 * @param w - region width
+		 * @param h - region height
+		 * @param callback - optional callback invoked from the blitter task on completion
+		 * @param context - context pointer handed to the callback
+		 * @returns the fence identifying the blit
+		 */
+		uint32_t draw_image_region_async(const unsigned char* image, size_t stride, uint16_t x, uint16_t y, uint16_t w, uint16_t h, blit_callback_t callback = nullptr, void* context = nullptr);
+
 		/**
 		 * @brief Draws a pixel of a certain color at a certain location
 		 * @param x - x coordinate of the pixel
@@ -119,6 +245,11 @@ class DISPLAY_SPI
 		 */
 		void fillScreen(uint16_t color); 
 
+		/**
+		 * @brief Blocks until all queued blits have been written to the bus
+		 */
+		void flush();
+
 		/**
 		 * @brief Gets teh display height
 		 * @returns The display height
@@ -152,6 +283,13 @@ class DISPLAY_SPI
 		 */
 		void invert_display(boolean i);
 
+		/**
+		 * @brief Checks whether a queued blit has completed
+		 * @param fence - the fence returned when the blit was queued
+		 * @returns True if the blit has been written to the bus
+		 */
+		bool is_blit_complete(uint32_t fence) const;
+
 		/**
 		* @brief Reset the display
 		*/
@@ -167,13 +305,45 @@ class DISPLAY_SPI
 		 */
 		void set_rotation(uint8_t r); 
 
+		/**
+		 * @brief Selects whether blits are handed to the blitter task or written by the calling task. Waits for the
+		 * queued blits before it writes synchronously.
+		 * @param queued - true to queue the blits (the default), false to write them synchronously
+		 */
+		void set_blit_queued(bool queued);
+
 		/**
 		 * @brief Toggles the backlight on or off if an LED Pin is connected
 		 * @param state - true to turn the backlight on, false to turn it off. 
 		 */
 		void toggle_backlight(boolean state);
 
+		/**
+		 * @brief Blocks until a queued blit has completed
+		 * @param fence - the fence returned when the blit was queued
+		 */
+		void wait_for_blit(uint32_t fence);
+
 	protected:
+		/**
+		 * @brief Task function draining the blit queue onto the SPI bus
+		 * @param args - pointer to the DISPLAY_SPI instance
+		 */
+		static void blit_runner(void* args);
+
+		/**
+		 * @brief Writes a single blit job to the bus
+		 * @param job - the job to write
+		 */
+		void blit(const blit_job& job);
+
+		/**
+		 * @brief Queues a blit job and assigns its fence
+		 * @param job - the job to queue
+		 * @returns the fence identifying the blit
+		 */
+		uint32_t queue_blit(blit_job& job);
+
 		/**
 		 * @brief Read the value from LCD register
 		 * @param reg - the register to read
@@ -198,12 +368,12 @@ class DISPLAY_SPI
 		 */
 		void sendCommand(uint8_t commandByte, const uint8_t *dataBytes = NULL, uint8_t numDataBytes = 0);
 
-		inline void SPI_BEGIN_TRANSACTION(void) { spi->beginTransaction(spi_settings); };
-		inline void SPI_END_TRANSACTION(void) { spi->endTransaction(); };
-		inline void SPI_CS_LOW(void) { digitalWrite(CS, LOW); };
-		inline void SPI_CS_HIGH(void) { digitalWrite(CS, HIGH); };
-		inline void SPI_DC_LOW(void) { digitalWrite(RS, LOW); };
-		inline void SPI_DC_HIGH(void) { digitalWrite(RS, HIGH); };
+		inline void SPI_BEGIN_TRANSACTION(void) { spi->begin_transaction(); };
+		inline void SPI_END_TRANSACTION(void) { spi->end_transaction(); };
+		inline void SPI_CS_LOW(void) { hal_gpio_write(CS, false); };
+		inline void SPI_CS_HIGH(void) { hal_gpio_write(CS, true); };
+		inline void SPI_DC_LOW(void) { hal_gpio_write(RS, false); };
+		inline void SPI_DC_HIGH(void) { hal_gpio_write(RS, true); };
 		inline void SPI_WRITE(uint8_t b) {spi->write(b); };
 		inline void SPI_WRITE16(uint16_t u) {spi->write16(u); };
 		inline void START_WRITE(void) { SPI_BEGIN_TRANSACTION(); SPI_CS_LOW(); };
@@ -214,8 +384,15 @@ class DISPLAY_SPI
     	uint16_t rotation;
 		unsigned int width = TFT_WIDTH;
 		unsigned int height = TFT_HEIGHT;
-		SPIClass *spi = NULL;
-		SPISettings spi_settings;
+		HAL_SPI_Bus *spi = NULL;
+
+		hal_queue_t blit_queue = nullptr;
+		hal_sem_t blit_done = nullptr;
+		hal_task_t blit_task = nullptr;
+		bool blit_queued = true;
+		volatile uint32_t fence_issued = 0;
+		volatile uint32_t fence_completed = 0;
+		uint8_t blit_chunk[BLIT_CHUNK_BYTES];
 };
 
 #endif
@@ -0,0 +1,269 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include "ili9341_framebuffer.h"
+#include "lcd_spi_registers.h"
+#include "rle565.h"
+
+/**
+ * @brief Generates a new instance of the ILI9341_Framebuffer class
+ */
+ILI9341_Framebuffer::ILI9341_Framebuffer()
+{
+	memset(_pixels, 0, sizeof(_pixels));
+	_windows.reserve(FB_MAX_WINDOWS);
+}
+
+#pragma region public methods
+/**
+ * @brief Called for every transfer on the bus
+ * @param data - the bytes written
+ * @param len - the number of bytes
+ */
+void ILI9341_Framebuffer::on_write(const uint8_t* data, size_t len)
+{
+	if(hal_gpio_read(CS)) return;
+		// panel not selected
+	std::lock_guard<std::mutex> guard(_lock);
+	_bytes += len;
+	if(!hal_gpio_read(RS))
+	{
+		for(size_t i = 0; i < len; i++) command(data[i]);
+		return;
+	}
+	for(size_t i = 0; i < len; i++) this->data(data[i]);
+}
+
+/**
+ * @brief Gets the total number of bytes the panel received
+ * @returns The number of bytes
+ */
+uint64_t ILI9341_Framebuffer::get_bytes() const
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	return _bytes;
+}
+
+/**
+ * @brief Gets the framebuffer height
+ * @returns The height in pixels
+ */
+uint16_t ILI9341_Framebuffer::get_height() const
+{
+	return _height;
+}
+
+/**
+ * @brief Gets a pixel of the framebuffer
+ * @param x - x coordinate
+ * @param y - y coordinate
+ * @returns The RGB565 color
+ */
+uint16_t ILI9341_Framebuffer::get_pixel(uint16_t x, uint16_t y) const
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	if(x >= _width || y >= _height) return 0;
+	return _pixels[y * _width + x];
+}
+
+/**
+ * @brief Gets the framebuffer width
+ * @returns The width in pixels
+ */
+uint16_t ILI9341_Framebuffer::get_width() const
+{
+	return _width;
+}
+
+/**
+ * @brief Checks whether an image is on screen
+ * @param image - the rle565 image
+ * @param x - x coordinate of the image
+ * @param y - y coordinate of the image
+ * @returns True if every pixel of the image is shown
+ */
+bool ILI9341_Framebuffer::shows(const unsigned char* image, uint16_t x, uint16_t y) const
+{
+	uint16_t w = rle565_width(image), h = rle565_height(image);
+	std::vector<uint8_t> row(w * 2);
+	std::lock_guard<std::mutex> guard(_lock);
+	if(x + w > _width || y + h > _height) return false;
+	for(uint16_t r = 0; r < h; r++)
+	{
+		rle565_decode_span(image, r, 0, w, row.data());
+		const uint16_t* line = _pixels + (y + r) * _width + x;
+		for(uint16_t c = 0; c < w; c++)
+		{
+			if(line[c] != ((row[c * 2] << 8) | row[c * 2 + 1])) return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Gets the address windows written since the last call and clears the record. Does not allocate
+ * as long as the vectors have the capacity, so the emulator stays out of heap measurements.
+ * @param windows - receives the windows in the order they were written
+ */
+void ILI9341_Framebuffer::take_windows(std::vector<fb_window>& windows)
+{
+	std::lock_guard<std::mutex> guard(_lock);
+	windows.assign(_windows.begin(), _windows.end());
+	_windows.clear();
+}
+
+/**
+ * @brief Writes the framebuffer as a 24 bit PNG
+ * @param path - the file to write
+ * @returns True if the file was written
+ */
+bool ILI9341_Framebuffer::write_png(const char* path) const
+{
+	static uint32_t crc_table[256] = {0};
+	if(crc_table[1] == 0)
+	{
+		for(uint32_t n = 0; n < 256; n++)
+		{
+			uint32_t c = n;
+			for(int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			crc_table[n] = c;
+		}
+	}
+
+	// raw scanlines, each with filter type 0
+	std::vector<uint8_t> raw;
+	{
+		std::lock_guard<std::mutex> guard(_lock);
+		raw.reserve((size_t)_height * (_width * 3 + 1));
+		for(uint16_t y = 0; y < _height; y++)
+		{
+			raw.push_back(0);
+			for(uint16_t x = 0; x < _width; x++)
+			{
+				uint16_t c = _pixels[y * _width + x];
+				uint8_t r = (c >> 11) & 0x1f, g = (c >> 5) & 0x3f, b = c & 0x1f;
+				raw.push_back((r << 3) | (r >> 2));
+				raw.push_back((g << 2) | (g >> 4));
+				raw.push_back((b << 3) | (b >> 2));
+			}
+		}
+	}
+
+	// zlib stream with stored blocks, the files are for inspection, not for size
+	std::vector<uint8_t> z = { 0x78, 0x01 };
+	uint32_t a = 1, b = 0;
+	for(size_t pos = 0; pos < raw.size() || pos == 0;)
+	{
+		size_t n = std::min<size_t>(raw.size() - pos, 65535);
+		z.push_back(pos + n == raw.size() ? 1 : 0);
+		z.push_back(n & 0xff); z.push_back(n >> 8);
+		z.push_back(~n & 0xff); z.push_back((~n >> 8) & 0xff);
+		for(size_t i = 0; i < n; i++)
+		{
+			uint8_t v = raw[pos + i];
+			z.push_back(v);
+			a = (a + v) % 65521;
+			b = (b + a) % 65521;
+		}
+		pos += n;
+		if(pos == raw.size()) break;
+	}
+	uint32_t adler = (b << 16) | a;
+	for(int s = 24; s >= 0; s -= 8) z.push_back((adler >> s) & 0xff);
+
+	FILE* f = fopen(path, "wb");
+	if(f == nullptr) return false;
+	auto put32 = [](std::vector<uint8_t>& v, uint32_t x) { for(int s = 24; s >= 0; s -= 8) v.push_back((x >> s) & 0xff); };
+	auto chunk = [&](const char* type, const std::vector<uint8_t>& payload) {
+		std::vector<uint8_t> c;
+		put32(c, payload.size());
+		c.insert(c.end(), type, type + 4);
+		c.insert(c.end(), payload.begin(), payload.end());
+		uint32_t crc = 0xffffffffu;
+		for(size_t i = 4; i < c.size(); i++) crc = crc_table[(crc ^ c[i]) & 0xff] ^ (crc >> 8);
+		put32(c, crc ^ 0xffffffffu);
+		fwrite(c.data(), 1, c.size(), f);
+	};
+	static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	fwrite(signature, 1, sizeof(signature), f);
+	std::vector<uint8_t> ihdr;
+	put32(ihdr, _width);
+	put32(ihdr, _height);
+	ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 });
+		// 8 bit, truecolor, deflate, no filter, no interlace
+	chunk("IHDR", ihdr);
+	chunk("IDAT", z);
+	chunk("IEND", {});
+	return fclose(f) == 0;
+}
+#pragma endregion
+
+#pragma region protected methods
+/**
+ * @brief Handles a command byte
+ * @param cmd - the command
+ */
+void ILI9341_Framebuffer::command(uint8_t cmd)
+{
+	_cmd = cmd;
+	_arg_count = 0;
+	_has_hi = false;
+	if(cmd == ILI9341_RAMWR)
+	{
+		_cx = _x1;
+		_cy = _y1;
+		if(!_windows.empty() && _windows.back().bytes == 0) _windows.pop_back();
+			// the blitter issues RAMWR twice, only count the window once
+		_windows.push_back({ _x1, _y1, _x2, _y2, 0 });
+	}
+}
+
+/**
+ * @brief Handles a data byte
+ * @param b - the byte
+ */
+void ILI9341_Framebuffer::data(uint8_t b)
+{
+	switch(_cmd)
+	{
+		case ILI9341_CASET:
+		case ILI9341_PASET:
+			if(_arg_count < 4) _args[_arg_count++] = b;
+			if(_arg_count == 4)
+			{
+				uint16_t start = (_args[0] << 8) | _args[1];
+				uint16_t end = (_args[2] << 8) | _args[3];
+				if(_cmd == ILI9341_CASET) { _x1 = start; _x2 = end; }
+				else { _y1 = start; _y2 = end; }
+			}
+			break;
+		case ILI9341_MADCTL:
+		{
+			// MV swaps rows and columns. Mirroring only compensates for how the panel is mounted, so the
+			// framebuffer keeps the orientation the user sees.
+			bool mv = (b & MADCTL_MV) != 0;
+			_width = mv ? TFT_HEIGHT : TFT_WIDTH;
+			_height = mv ? TFT_WIDTH : TFT_HEIGHT;
+			break;
+		}
+		case ILI9341_RAMWR:
+			if(!_windows.empty()) _windows.back().bytes++;
+			if(!_has_hi) { _hi = b; _has_hi = true; break; }
+			_has_hi = false;
+			if(_cx < _width && _cy < _height) _pixels[_cy * _width + _cx] = (_hi << 8) | b;
+			if(++_cx > _x2)
+			{
+				_cx = _x1;
+				if(++_cy > _y2) _cy = _y1;
+			}
+			break;
+		default:
+			break;
+	}
+}
+#pragma endregion
+
+#endif
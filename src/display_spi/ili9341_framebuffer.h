@@ -0,0 +1,134 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _ILI9341_FRAMEBUFFER_H_
+#define _ILI9341_FRAMEBUFFER_H_
+
+#ifndef ARDUINO
+
+#include <Arduino.h>
+#include <mutex>
+#include <vector>
+#include "../hal/hal.h"
+#include "mcu_spi_magic.h"
+
+#define FB_FRAME_RATE 30
+#define FB_FRAME_BUDGET_BYTES (SPI_BUS_FREQUENCY / 8 / FB_FRAME_RATE)
+    // bytes the bus can move per frame at the target frame rate
+#define FB_MAX_WINDOWS 256              // windows recorded without allocating
+
+/**
+ * @brief An address window written by the display driver
+ */
+struct fb_window {
+    uint16_t x1;
+    uint16_t y1;
+    uint16_t x2;
+    uint16_t y2;
+    uint32_t bytes;     // pixel data written into the window
+};
+
+/**
+ * @brief Emulates the ILI9341 on the in-memory SPI bus of the host HAL
+ * @details Decodes the command stream DISPLAY_SPI sends (using the DC and CS pins like the panel does) and
+ * renders RAMWR data into a TFT_WIDTH x TFT_HEIGHT RGB565 framebuffer in the orientation the user sees. Every
+ * address window and the bytes written to it are recorded, so the cost of a screen update can be measured
+ * without the hardware. Attach with hal_host_spi_attach.
+ */
+class ILI9341_Framebuffer : public HAL_SPI_Device
+{
+	public:
+		/**
+		 * @brief Generates a new instance of the ILI9341_Framebuffer class
+		 */
+		ILI9341_Framebuffer();
+
+		/**
+		 * @brief Called for every transfer on the bus
+		 * @param data - the bytes written
+		 * @param len - the number of bytes
+		 */
+		void on_write(const uint8_t* data, size_t len) override;
+
+		/**
+		 * @brief Gets the total number of bytes the panel received
+		 * @returns The number of bytes
+		 */
+		uint64_t get_bytes() const;
+
+		/**
+		 * @brief Gets the framebuffer height
+		 * @returns The height in pixels
+		 */
+		uint16_t get_height() const;
+
+		/**
+		 * @brief Gets a pixel of the framebuffer
+		 * @param x - x coordinate
+		 * @param y - y coordinate
+		 * @returns The RGB565 color
+		 */
+		uint16_t get_pixel(uint16_t x, uint16_t y) const;
+
+		/**
+		 * @brief Gets the framebuffer width
+		 * @returns The width in pixels
+		 */
+		uint16_t get_width() const;
+
+		/**
+		 * @brief Checks whether an image is on screen
+		 * @param image - the rle565 image
+		 * @param x - x coordinate of the image
+		 * @param y - y coordinate of the image
+		 * @returns True if every pixel of the image is shown
+		 */
+		bool shows(const unsigned char* image, uint16_t x, uint16_t y) const;
+
+		/**
+		 * @brief Gets the address windows written since the last call and clears the record. Does not allocate
+		 * as long as the vectors have the capacity, so the emulator stays out of heap measurements.
+		 * @param windows - receives the windows in the order they were written
+		 */
+		void take_windows(std::vector<fb_window>& windows);
+
+		/**
+		 * @brief Writes the framebuffer as a 24 bit PNG
+		 * @param path - the file to write
+		 * @returns True if the file was written
+		 */
+		bool write_png(const char* path) const;
+
+	protected:
+		/**
+		 * @brief Handles a command byte
+		 * @param cmd - the command
+		 */
+		void command(uint8_t cmd);
+
+		/**
+		 * @brief Handles a data byte
+		 * @param b - the byte
+		 */
+		void data(uint8_t b);
+
+	private:
+		mutable std::mutex _lock;
+		uint16_t _pixels[TFT_WIDTH * TFT_HEIGHT];
+		uint16_t _width = TFT_WIDTH;
+		uint16_t _height = TFT_HEIGHT;
+		uint64_t _bytes = 0;
+		std::vector<fb_window> _windows;
+
+		uint8_t _cmd = 0;
+		uint8_t _args[4] = {0};
+		uint8_t _arg_count = 0;
+		uint16_t _x1 = 0, _x2 = TFT_WIDTH - 1;
+		uint16_t _y1 = 0, _y2 = TFT_HEIGHT - 1;
+		uint16_t _cx = 0, _cy = 0;
+		uint8_t _hi = 0;
+		bool _has_hi = false;
+};
+
+#endif
+#endif
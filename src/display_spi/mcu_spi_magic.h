@@ -31,15 +31,15 @@
 #define TFT_WIDTH 240
 #define TFT_HEIGHT 320
 
-#define CD_COMMAND  (digitalWrite(RS,LOW))    
-#define CD_DATA     (digitalWrite(RS,HIGH)) 
-#define CS_ACTIVE   (digitalWrite(CS,LOW)) 
-#define CS_IDLE     (digitalWrite(CS, HIGH)) 
-#define MISO_STATE(x) { x = digitalRead(SID);}
-#define MOSI_LOW    (digitalWrite(SID,LOW)) 
-#define MOSI_HIGH   (digitalWrite(SID,HIGH)) 
-#define CLK_LOW     (digitalWrite(SCK,LOW)) 
-#define CLK_HIGH    (digitalWrite(SCK,HIGH)) 
+#define CD_COMMAND  (hal_gpio_write(RS, false))    
+#define CD_DATA     (hal_gpio_write(RS, true)) 
+#define CS_ACTIVE   (hal_gpio_write(CS, false)) 
+#define CS_IDLE     (hal_gpio_write(CS, true)) 
+#define MISO_STATE(x) { x = hal_gpio_read(SID);}
+#define MOSI_LOW    (hal_gpio_write(SID, false)) 
+#define MOSI_HIGH   (hal_gpio_write(SID, true)) 
+#define CLK_LOW     (hal_gpio_write(SCK, false)) 
+#define CLK_HIGH    (hal_gpio_write(SCK, true)) 
 
 #define write_16(d) write8(d>>8); write8(d)
 #define read_16(dst) { uint8_t hi; read8(hi); read8(dst); dst |= (hi << 8); }
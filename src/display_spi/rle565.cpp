@@ -0,0 +1,75 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "rle565.h"
+
+/**
+ * @brief Checks whether an asset is an rle565 image
+ * @param image - the asset
+ * @returns True if the asset starts with the rle565 magic
+ */
+bool rle565_is_image(const unsigned char* image)
+{
+	return image[0] == 'R' && image[1] == 'L';
+}
+
+/**
+ * @brief Gets the width of an rle565 image
+ * @param image - the image
+ * @returns The width in pixels
+ */
+uint16_t rle565_width(const unsigned char* image)
+{
+	return image[2] | (image[3] << 8);
+}
+
+/**
+ * @brief Gets the height of an rle565 image
+ * @param image - the image
+ * @returns The height in pixels
+ */
+uint16_t rle565_height(const unsigned char* image)
+{
+	return image[4] | (image[5] << 8);
+}
+
+/**
+ * @brief Decodes a span of a row
+ * @param image - the image
+ * @param row - the row to decode
+ * @param x - the first column of the span
+ * @param w - the number of pixels to decode
+ * @param out - buffer receiving w big endian pixels (w * 2 bytes)
+ */
+void rle565_decode_span(const unsigned char* image, uint16_t row, uint16_t x, uint16_t w, uint8_t* out)
+{
+	const unsigned char* entry = image + RLE565_HEADER_SIZE + row * 4;
+	uint32_t offset = entry[0] | (entry[1] << 8) | (entry[2] << 16) | ((uint32_t)entry[3] << 24);
+	const unsigned char* p = image + RLE565_HEADER_SIZE + rle565_height(image) * 4 + offset;
+
+	uint16_t col = 0;
+	uint16_t end = x + w;
+	while(col < end)
+	{
+		uint8_t token = *p++;
+		uint16_t count = (token & ~RLE565_RUN) + 1;
+		uint16_t from = col < x ? x : col;
+		uint16_t to = col + count > end ? end : col + count;
+			// the part of the token that falls into the span
+		if(token & RLE565_RUN)
+		{
+			for(uint16_t i = from; i < to; i++) { *out++ = p[0]; *out++ = p[1]; }
+			p += 2;
+		}
+		else
+		{
+			if(to > from)
+			{
+				memcpy(out, p + (from - col) * 2, (to - from) * 2);
+				out += (to - from) * 2;
+			}
+			p += count * 2;
+		}
+		col += count;
+	}
+}
@@ -0,0 +1,55 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _RLE565_H_
+#define _RLE565_H_
+
+#include "Arduino.h"
+
+/**
+ * Compressed RGB565 images. The layout is produced by tools/rle565.py:
+ *
+ *     'R' 'L'  width (u16 le)  height (u16 le)
+ *     height x row offset (u32 le, relative to the first data byte)
+ *     row data
+ *
+ * Each row is a sequence of tokens. A token with the high bit set is a run of (token & 0x7f) + 1 copies of the
+ * pixel that follows, otherwise token + 1 literal pixels follow. Pixels are stored big endian, as they go on the
+ * bus. Rows are encoded independently, so any region of an image can be decoded without touching the rows above.
+ */
+
+#define RLE565_HEADER_SIZE 6
+#define RLE565_RUN 0x80
+
+/**
+ * @brief Checks whether an asset is an rle565 image
+ * @param image - the asset
+ * @returns True if the asset starts with the rle565 magic
+ */
+bool rle565_is_image(const unsigned char* image);
+
+/**
+ * @brief Gets the width of an rle565 image
+ * @param image - the image
+ * @returns The width in pixels
+ */
+uint16_t rle565_width(const unsigned char* image);
+
+/**
+ * @brief Gets the height of an rle565 image
+ * @param image - the image
+ * @returns The height in pixels
+ */
+uint16_t rle565_height(const unsigned char* image);
+
+/**
+ * @brief Decodes a span of a row
+ * @param image - the image
+ * @param row - the row to decode
+ * @param x - the first column of the span
+ * @param w - the number of pixels to decode
+ * @param out - buffer receiving w big endian pixels (w * 2 bytes)
+ */
+void rle565_decode_span(const unsigned char* image, uint16_t row, uint16_t x, uint16_t w, uint8_t* out);
+
+#endif
@@ -0,0 +1,610 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _HAL_H_
+#define _HAL_H_
+
+/**
+ * Thin hardware abstraction used by the controller, the RPM math, the display pipeline and the logger.
+ * hal_esp32.cpp implements it on the ESP32 (Arduino core and ESP-IDF drivers), hal_linux.cpp on a
+ * workstation with pthreads and in-memory devices. On the host, put src/hal/host on the include path, which
+ * provides the few Arduino types (String, F(), PROGMEM...) the firmware uses, and compile main.cpp with
+ * every .cpp under src, for example
+ *
+ *   g++ -std=gnu++17 -O2 -Isrc/hal/host -x c++ main.cpp $(find src -name '*.cpp') -pthread -o lathe
+ *
+ * The peripherals that only exist on the ESP32 (pulse counter, MCPWM capture, hardware timer sampling)
+ * stay in their components behind #ifdef ARDUINO.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef ARDUINO
+  #include <esp_attr.h>
+  #define HAL_TIMER_GROUP TIMER_GROUP_0
+  #define HAL_TIMER_COUNTER TIMER_1
+  #define HAL_TIMER_DIVIDER 80
+      // 80 MHz / 80 = 1 MHz → 1 tick = 1 µs
+#else
+  #ifndef IRAM_ATTR
+    #define IRAM_ATTR
+  #endif
+#endif
+
+#define HAL_WAIT_FOREVER 0xffffffff
+#define HAL_PRIORITY_HIGHEST -1         // maps to the highest task priority of the platform
+#define HAL_CORE_ANY -1
+#define HAL_EVENT_BITS 24               // usable bits of an event group, FreeRTOS reserves the upper 8
+#define HAL_FLASH_SECTOR_SIZE 4096      // erase unit of the SPI flash
+#define HAL_RUNTIME_UNKNOWN UINT64_MAX  // the platform does not account the run time of tasks
+#ifndef HAL_STATIC_ALLOCATION
+#define HAL_STATIC_ALLOCATION 1         // tasks, queues, semaphores and event groups come from a static arena
+#endif
+#define HAL_STATIC_ARENA_SIZE 28672     // stacks and kernel objects of all tasks, objects that do not fit use the heap
+
+/**
+ * @brief Pin configurations
+ */
+enum hal_pin_mode {
+    HAL_PIN_INPUT,
+    HAL_PIN_INPUT_PULLUP,
+    HAL_PIN_INPUT_PULLDOWN,
+    HAL_PIN_OUTPUT
+};
+
+/**
+ * @brief Pin edges triggering an interrupt
+ */
+enum hal_edge {
+    HAL_EDGE_RISING,
+    HAL_EDGE_FALLING,
+    HAL_EDGE_CHANGE
+};
+
+typedef void (*hal_isr_t)(void* arg);
+typedef void (*hal_task_fn_t)(void* arg);
+typedef void* hal_task_t;
+typedef void* hal_queue_t;
+typedef void* hal_sem_t;
+typedef void* hal_events_t;
+
+#pragma region GPIO
+/**
+ * @brief Configures a pin
+ * @param pin - the pin
+ * @param mode - the pin configuration
+ */
+void hal_gpio_mode(uint8_t pin, hal_pin_mode mode);
+
+/**
+ * @brief Reads the level of a pin
+ * @param pin - the pin
+ * @returns True if the pin is high
+ */
+bool hal_gpio_read(uint8_t pin);
+
+/**
+ * @brief Drives an output pin
+ * @param pin - the pin
+ * @param level - true for high, false for low
+ */
+void hal_gpio_write(uint8_t pin, bool level);
+
+/**
+ * @brief Attaches an interrupt handler to a pin
+ * @param pin - the pin
+ * @param edge - the edge triggering the handler
+ * @param isr - the handler, runs in interrupt context
+ * @param arg - argument passed to the handler
+ */
+void hal_gpio_attach(uint8_t pin, hal_edge edge, hal_isr_t isr, void* arg);
+
+/**
+ * @brief Detaches the interrupt handler from a pin
+ * @param pin - the pin
+ */
+void hal_gpio_detach(uint8_t pin);
+
+/**
+ * @brief Masks or unmasks the interrupt of a pin without detaching the handler
+ * @param pin - the pin
+ * @param enable - true to unmask, false to mask
+ */
+void hal_gpio_interrupt(uint8_t pin, bool enable);
+#pragma endregion
+
+#pragma region Timer
+/**
+ * @brief Starts the free running microsecond counter. Must be called before hal_timer_us. Calls while the
+ * counter runs have no effect.
+ */
+void hal_timer_init();
+
+/**
+ * @brief Stops the free running microsecond counter
+ */
+void hal_timer_deinit();
+
+/**
+ * @brief Reads the free running microsecond counter. Safe to call from interrupt context, also while a flash
+ * erase or write has disabled the flash cache.
+ * @returns The time in us since hal_timer_init
+ */
+uint64_t IRAM_ATTR hal_timer_us();
+
+/**
+ * @brief Reads the cycle counter of the calling core. Cheap enough to time short interrupt handlers, and safe
+ * to call from interrupt context. Wraps, so only the difference of two close readings on the same core is valid.
+ * @returns The cycle count
+ */
+uint32_t IRAM_ATTR hal_cycles();
+
+/**
+ * @brief Gets the rate of the cycle counter
+ * @returns The cycles per us
+ */
+uint32_t hal_cycles_per_us();
+
+/**
+ * @brief Blocks the calling task
+ * @param ms - the time to block in ms
+ */
+void hal_delay_ms(uint32_t ms);
+#pragma endregion
+
+#pragma region Static allocation
+/**
+ * With HAL_STATIC_ALLOCATION set, the ESP32 HAL creates tasks, queues, semaphores and event groups with the
+ * static FreeRTOS calls, in memory taken from an arena of HAL_STATIC_ARENA_SIZE bytes that is reserved at link
+ * time. The firmware creates them once during setup, so the heap does not change afterwards and cannot fragment.
+ * Arena memory is never returned, a deleted task keeps its stack reserved. The workstation HAL allocates its
+ * objects on the heap and reports an empty arena.
+ */
+
+/**
+ * @brief Gets the bytes of the static arena handed out so far
+ * @returns The bytes
+ */
+size_t hal_static_used();
+
+/**
+ * @brief Gets the number of objects that did not fit into the static arena and were allocated on the heap
+ * @returns The count
+ */
+uint32_t hal_static_overflows();
+#pragma endregion
+
+#pragma region Tasks
+/**
+ * @brief Creates and starts a task
+ * @param fn - the task function
+ * @param name - the task name
+ * @param stack - the stack size in bytes
+ * @param arg - argument passed to the task function
+ * @param priority - the task priority or HAL_PRIORITY_HIGHEST
+ * @param core - the core to pin the task to or HAL_CORE_ANY
+ * @returns The task handle
+ */
+hal_task_t hal_task_create(hal_task_fn_t fn, const char* name, uint32_t stack, void* arg, int priority, int core);
+
+/**
+ * @brief Deletes a task
+ * @param task - the task handle
+ */
+void hal_task_delete(hal_task_t task);
+
+/**
+ * @brief Gets the core the caller runs on. Safe to call from interrupt context.
+ * @returns The core, 0 or 1
+ */
+int IRAM_ATTR hal_core_id();
+
+/**
+ * @brief Gets the calling task
+ * @returns The task handle
+ */
+hal_task_t hal_task_current();
+
+/**
+ * @brief Gets the stack the task has never used so far
+ * @param task - the task handle
+ * @returns The free bytes at the high water mark, 0 if the platform does not tell
+ */
+uint32_t hal_task_stack_free(hal_task_t task);
+
+/**
+ * @brief Gets the processor time a task consumed so far
+ * @param task - the task handle
+ * @returns The time in us, HAL_RUNTIME_UNKNOWN if the platform does not account it
+ */
+uint64_t hal_task_runtime_us(hal_task_t task);
+
+/**
+ * @brief Notifies a task, waking it from hal_task_wait
+ * @param task - the task handle
+ */
+void hal_task_notify(hal_task_t task);
+
+/**
+ * @brief Notifies a task from interrupt context, waking it from hal_task_wait
+ * @param task - the task handle
+ */
+void IRAM_ATTR hal_task_notify_from_isr(hal_task_t task);
+
+/**
+ * @brief Waits for a notification of the calling task and clears it
+ * @param timeout_ms - the maximum time to wait or HAL_WAIT_FOREVER
+ * @returns The number of notifications received, 0 on timeout
+ */
+uint32_t hal_task_wait(uint32_t timeout_ms);
+
+/**
+ * @brief Creates a queue of fixed size items
+ * @param depth - the number of items the queue holds
+ * @param item_size - the size of an item in bytes
+ * @returns The queue handle
+ */
+hal_queue_t hal_queue_create(size_t depth, size_t item_size);
+
+/**
+ * @brief Copies an item to the back of the queue
+ * @param queue - the queue handle
+ * @param item - the item
+ * @param timeout_ms - the maximum time to wait for space or HAL_WAIT_FOREVER
+ * @returns True if the item was queued
+ */
+bool hal_queue_send(hal_queue_t queue, const void* item, uint32_t timeout_ms);
+
+/**
+ * @brief Copies an item from the front of the queue and removes it
+ * @param queue - the queue handle
+ * @param item - buffer receiving the item
+ * @param timeout_ms - the maximum time to wait for an item or HAL_WAIT_FOREVER
+ * @returns True if an item was received
+ */
+bool hal_queue_receive(hal_queue_t queue, void* item, uint32_t timeout_ms);
+
+/**
+ * @brief Creates a binary semaphore, initially taken
+ * @returns The semaphore handle
+ */
+hal_sem_t hal_sem_create();
+
+/**
+ * @brief Takes a semaphore
+ * @param sem - the semaphore handle
+ * @param timeout_ms - the maximum time to wait or HAL_WAIT_FOREVER
+ * @returns True if the semaphore was taken
+ */
+bool hal_sem_take(hal_sem_t sem, uint32_t timeout_ms);
+
+/**
+ * @brief Gives a semaphore
+ * @param sem - the semaphore handle
+ */
+void hal_sem_give(hal_sem_t sem);
+
+/**
+ * @brief Creates an event group with all bits cleared
+ * @returns The event group handle
+ */
+hal_events_t hal_events_create();
+
+/**
+ * @brief Sets bits in an event group, waking the tasks waiting for them
+ * @param events - the event group handle
+ * @param bits - the bits to set, within HAL_EVENT_BITS
+ */
+void hal_events_set(hal_events_t events, uint32_t bits);
+
+/**
+ * @brief Waits for any of a set of bits and clears them
+ * @param events - the event group handle
+ * @param bits - the bits to wait for, within HAL_EVENT_BITS
+ * @param timeout_ms - the maximum time to wait or HAL_WAIT_FOREVER
+ * @returns The bits that were set out of the ones waited for, 0 on timeout
+ */
+uint32_t hal_events_wait(hal_events_t events, uint32_t bits, uint32_t timeout_ms);
+#pragma endregion
+
+#pragma region Serial
+/**
+ * @brief Opens the serial console
+ * @param baud - the transmission speed
+ */
+void hal_serial_begin(uint32_t baud);
+
+/**
+ * @brief Flushes and closes the serial console
+ */
+void hal_serial_end();
+
+/**
+ * @brief Writes to the serial console
+ * @param data - the bytes to write
+ * @param len - the number of bytes
+ * @returns The number of bytes written
+ */
+size_t hal_serial_write(const char* data, size_t len);
+
+/**
+ * @brief Reads the bytes received on the serial console so far, without waiting
+ * @param data - buffer receiving the bytes
+ * @param len - the size of the buffer
+ * @returns The number of bytes read, 0 if nothing was received
+ */
+size_t hal_serial_read(char* data, size_t len);
+#pragma endregion
+
+#pragma region SPI
+/**
+ * @brief A SPI bus with a single device. Chip select and data/command lines are driven through the GPIO
+ * functions by the device driver.
+ */
+class HAL_SPI_Bus
+{
+    public:
+        /**
+         * @brief Creates and starts a SPI bus
+         * @param sck - the clock pin
+         * @param miso - the MISO pin, -1 if not used
+         * @param mosi - the MOSI pin
+         * @param cs - the chip select pin
+         * @param frequency - the bus frequency in Hz
+         * @returns The bus
+         */
+        static HAL_SPI_Bus* create(int8_t sck, int8_t miso, int8_t mosi, int8_t cs, uint32_t frequency);
+
+        /**
+         * @brief Cleans up resources used by class
+         */
+        virtual ~HAL_SPI_Bus() {}
+
+        /**
+         * @brief Acquires the bus for a sequence of transfers
+         */
+        virtual void begin_transaction() = 0;
+
+        /**
+         * @brief Releases the bus
+         */
+        virtual void end_transaction() = 0;
+
+        /**
+         * @brief Writes a byte
+         * @param b - the byte
+         */
+        virtual void write(uint8_t b) = 0;
+
+        /**
+         * @brief Writes a 16 bit word, MSB first
+         * @param w - the word
+         */
+        virtual void write16(uint16_t w) = 0;
+
+        /**
+         * @brief Writes a buffer
+         * @param data - the bytes to write
+         * @param len - the number of bytes
+         */
+        virtual void write_bytes(const uint8_t* data, size_t len) = 0;
+
+        /**
+         * @brief Writes a pattern repeatedly
+         * @param pattern - the pattern
+         * @param size - the size of the pattern in bytes
+         * @param repeat - the number of repetitions
+         */
+        virtual void write_pattern(const uint8_t* pattern, uint8_t size, uint32_t repeat) = 0;
+};
+#pragma endregion
+
+#pragma region Flash
+/**
+ * @brief Gets the size of a data partition
+ * @param label - the partition label from partitions.csv
+ * @returns The size in bytes, 0 if the partition does not exist
+ */
+size_t hal_partition_size(const char* label);
+
+/**
+ * @brief Reads from a data partition
+ * @param label - the partition label from partitions.csv
+ * @param offset - the offset in the partition
+ * @param data - buffer receiving the bytes
+ * @param len - the number of bytes to read
+ * @returns True if the bytes were read
+ */
+bool hal_partition_read(const char* label, size_t offset, void* data, size_t len);
+
+/**
+ * @brief Maps the start of a data partition into the address space, read only. The mapping stays valid until
+ * the program ends.
+ * @param label - the partition label from partitions.csv
+ * @param len - the number of bytes to map
+ * @returns The mapped bytes, nullptr if the partition does not exist or cannot be mapped
+ */
+const uint8_t* hal_partition_map(const char* label, size_t len);
+
+/**
+ * @brief Erases a range of a data partition, setting all bits. Blocks until the flash is done, and on the ESP32
+ * stalls code running from flash on both cores meanwhile, for about 50 ms per sector. Interrupt handlers in IRAM
+ * keep running, so they must only call the IRAM_ATTR functions of the HAL.
+ * @param label - the partition label from partitions.csv
+ * @param offset - the offset in the partition, a multiple of HAL_FLASH_SECTOR_SIZE
+ * @param len - the number of bytes, a multiple of HAL_FLASH_SECTOR_SIZE
+ * @returns True if the range was erased
+ */
+bool hal_partition_erase(const char* label, size_t offset, size_t len);
+
+/**
+ * @brief Writes to a data partition. Writing can only clear bits, so the range must have been erased since it
+ * was last written. Stalls code running from flash like hal_partition_erase, for about 1 ms per 256 bytes.
+ * @param label - the partition label from partitions.csv
+ * @param offset - the offset in the partition
+ * @param data - the bytes to write
+ * @param len - the number of bytes
+ * @returns True if the bytes were written
+ */
+bool hal_partition_write(const char* label, size_t offset, const void* data, size_t len);
+#pragma endregion
+
+#ifndef ARDUINO
+#pragma region Host devices
+/**
+ * @brief Receives the bytes written to the in-memory SPI bus on the host
+ */
+class HAL_SPI_Device
+{
+    public:
+        /**
+         * @brief Cleans up resources used by class
+         */
+        virtual ~HAL_SPI_Device() {}
+
+        /**
+         * @brief Called for every transfer on the bus
+         * @param data - the bytes written
+         * @param len - the number of bytes
+         */
+        virtual void on_write(const uint8_t* data, size_t len) = 0;
+};
+
+/**
+ * @brief Connects a device to the in-memory SPI bus. The bus only counts the bytes if no device is connected.
+ * @param device - the device, nullptr to disconnect
+ */
+void hal_host_spi_attach(HAL_SPI_Device* device);
+
+/**
+ * @brief Gets the number of bytes written to the in-memory SPI bus
+ * @returns The number of bytes
+ */
+uint64_t hal_host_spi_bytes();
+
+/**
+ * @brief Gets the number of transactions on the in-memory SPI bus
+ * @returns The number of transactions
+ */
+uint64_t hal_host_spi_transactions();
+
+/**
+ * @brief Drives a pin from outside, as the connected hardware would, firing the attached interrupt handlers
+ * @param pin - the pin
+ * @param level - true for high, false for low
+ */
+void hal_host_gpio_set(uint8_t pin, bool level);
+
+/**
+ * @brief Delays the interrupt handler of a pin by a random time after each edge, like the interrupt latency on the
+ * target. Simulated peripherals on the pin still see the edge on time.
+ * @param pin - the pin
+ * @param max_us - the longest delay in simulated us, 0 to run the handler right away
+ */
+void hal_host_gpio_latency(uint8_t pin, uint32_t max_us);
+
+/**
+ * @brief Receives the level changes of a pin on the host, like a peripheral the GPIO matrix routes the pin to
+ * @param level - the new level
+ * @param at - the time of the change in us
+ * @param arg - the argument passed to hal_host_gpio_tap
+ */
+typedef void (*hal_host_tap_t)(bool level, uint64_t at, void* arg);
+
+/**
+ * @brief Connects a simulated peripheral to a pin, e.g. a stand-in for the pulse counter or the capture unit.
+ * Peripherals watch the pin besides the interrupt handler and see every level change before it runs.
+ * @param pin - the pin
+ * @param tap - the function receiving the level changes
+ * @param arg - argument passed to the function
+ * @returns True if connected, false if the pin has no free tap
+ */
+bool hal_host_gpio_tap(uint8_t pin, hal_host_tap_t tap, void* arg);
+
+/**
+ * @brief Disconnects a simulated peripheral from a pin
+ * @param pin - the pin
+ * @param tap - the function passed to hal_host_gpio_tap
+ * @param arg - the argument passed to hal_host_gpio_tap
+ */
+void hal_host_gpio_untap(uint8_t pin, hal_host_tap_t tap, void* arg);
+
+/**
+ * @brief Discards everything written to the serial console, e.g. while benchmarking the logger
+ * @param mute - true to discard, false to write to stdout again
+ */
+void hal_host_serial_mute(bool mute);
+
+/**
+ * @brief Backs a data partition with a file. Partitions without a file are read from LABEL.bin in the working
+ * directory.
+ * @param label - the partition label
+ * @param path - the file
+ */
+void hal_host_partition_file(const char* label, const char* path);
+
+/**
+ * @brief Write statistics of a data partition on the host, which behaves like NOR flash
+ */
+struct hal_host_flash_stats {
+    uint64_t programmed = 0;            // bytes written
+    uint32_t writes = 0;                // calls to hal_partition_write
+    uint32_t erases = 0;                // sectors erased
+    uint32_t min_sector_erases = 0;     // erases of the least and the most erased sector
+    uint32_t max_sector_erases = 0;
+    uint32_t overwrites = 0;            // writes that had to set bits, which the flash cannot do without an erase
+};
+
+/**
+ * @brief Creates the file backing a data partition, erased, unless a file of that size exists
+ * @param label - the partition label
+ * @param size - the size of the partition in bytes, as in partitions.csv
+ */
+void hal_host_partition_create(const char* label, size_t size);
+
+/**
+ * @brief Gets the write statistics of a data partition since the program started
+ * @param label - the partition label
+ * @returns The statistics
+ */
+hal_host_flash_stats hal_host_flash_statistics(const char* label);
+
+/**
+ * @brief Interrupt handlers that ran while a partition was erased or written on the host. The ESP32 disables the
+ * flash cache meanwhile and only runs the handlers in IRAM, which must not call into flash.
+ */
+struct hal_host_isr_flash_stats {
+    uint32_t handlers = 0;              // handlers and simulated peripherals that ran meanwhile
+    uint32_t flash_calls = 0;           // their calls of HAL functions that run from flash on the ESP32
+};
+
+/**
+ * @brief Gets how the interrupt handlers behaved while partitions were erased or written, since the program started
+ * @returns The statistics
+ */
+hal_host_isr_flash_stats hal_host_isr_flash_statistics();
+
+/**
+ * @brief Runs the simulated time faster than the wall clock. Must be called before hal_timer_init.
+ * @details Scales the microsecond counter, the delays and the timeouts alike, so the firmware sees consistent
+ * time, just more of it per wall clock second.
+ * @param factor - the speedup, 1 for real time
+ */
+void hal_host_time_scale(uint32_t factor);
+
+/**
+ * @brief Blocks the calling thread until the microsecond counter reaches a time
+ * @param us - the time in us
+ */
+void hal_host_sleep_until(uint64_t us);
+
+/**
+ * @brief Gets the name of the calling task. Does not allocate, so a heap wrapper can call it.
+ * @returns The name passed to hal_task_create, nullptr on threads not created by it
+ */
+const char* hal_host_task_name();
+#pragma endregion
+#endif
+
+#endif
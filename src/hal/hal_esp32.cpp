@@ -0,0 +1,645 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/event_groups.h>
+#include "hal.h"
+extern "C" {
+  #include <esp_partition.h>
+  #include <driver/timer.h>
+  #include <driver/gpio.h>
+}
+
+#pragma region GPIO
+/**
+ * @brief Configures a pin
+ * @param pin - the pin
+ * @param mode - the pin configuration
+ */
+void hal_gpio_mode(uint8_t pin, hal_pin_mode mode)
+{
+    switch(mode)
+    {
+        case HAL_PIN_INPUT_PULLUP: pinMode(pin, INPUT_PULLUP); break;
+        case HAL_PIN_INPUT_PULLDOWN: pinMode(pin, INPUT_PULLDOWN); break;
+        case HAL_PIN_OUTPUT: pinMode(pin, OUTPUT); break;
+        default: pinMode(pin, INPUT); break;
+    }
+}
+
+/**
+ * @brief Reads the level of a pin
+ * @param pin - the pin
+ * @returns True if the pin is high
+ */
+bool hal_gpio_read(uint8_t pin)
+{
+    return digitalRead(pin) == HIGH;
+}
+
+/**
+ * @brief Drives an output pin
+ * @param pin - the pin
+ * @param level - true for high, false for low
+ */
+void hal_gpio_write(uint8_t pin, bool level)
+{
+    digitalWrite(pin, level ? HIGH : LOW);
+}
+
+/**
+ * @brief Attaches an interrupt handler to a pin
+ * @param pin - the pin
+ * @param edge - the edge triggering the handler
+ * @param isr - the handler, runs in interrupt context
+ * @param arg - argument passed to the handler
+ */
+void hal_gpio_attach(uint8_t pin, hal_edge edge, hal_isr_t isr, void* arg)
+{
+    int mode = edge == HAL_EDGE_RISING ? RISING : edge == HAL_EDGE_FALLING ? FALLING : CHANGE;
+    attachInterruptArg(digitalPinToInterrupt(pin), isr, arg, mode);
+}
+
+/**
+ * @brief Detaches the interrupt handler from a pin
+ * @param pin - the pin
+ */
+void hal_gpio_detach(uint8_t pin)
+{
+    detachInterrupt(digitalPinToInterrupt(pin));
+}
+
+/**
+ * @brief Masks or unmasks the interrupt of a pin without detaching the handler
+ * @param pin - the pin
+ * @param enable - true to unmask, false to mask
+ */
+void hal_gpio_interrupt(uint8_t pin, bool enable)
+{
+    if(enable) gpio_intr_enable(static_cast<gpio_num_t>(pin));
+    else gpio_intr_disable(static_cast<gpio_num_t>(pin));
+}
+#pragma endregion
+
+#pragma region Timer
+static bool timer_running = false;
+static portMUX_TYPE timer_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Starts the free running microsecond counter. Must be called before hal_timer_us.
+ */
+void hal_timer_init()
+{
+    if(timer_running) return;
+        // the logger starts it before the controller, restarting would move time stamps backwards
+    timer_running = true;
+    timer_config_t cnt_config =
+    {
+        .alarm_en = TIMER_ALARM_DIS,
+        .counter_en = TIMER_PAUSE,
+        .counter_dir = TIMER_COUNT_UP,
+        .auto_reload = TIMER_AUTORELOAD_DIS,
+        .divider = HAL_TIMER_DIVIDER,
+    };
+    timer_init(HAL_TIMER_GROUP, HAL_TIMER_COUNTER, &cnt_config);
+    timer_set_counter_value(HAL_TIMER_GROUP, HAL_TIMER_COUNTER, 0);
+    timer_start(HAL_TIMER_GROUP, HAL_TIMER_COUNTER);
+}
+
+/**
+ * @brief Stops the free running microsecond counter
+ */
+void hal_timer_deinit()
+{
+    timer_pause(HAL_TIMER_GROUP, HAL_TIMER_COUNTER);
+    timer_deinit(HAL_TIMER_GROUP, HAL_TIMER_COUNTER);
+    timer_running = false;
+}
+
+/**
+ * @brief Reads the free running microsecond counter. Safe to call from interrupt context, also while a flash
+ * erase or write has disabled the flash cache.
+ * @returns The time in us since hal_timer_init
+ */
+uint64_t IRAM_ATTR hal_timer_us()
+{
+    portENTER_CRITICAL_SAFE(&timer_lock);
+    uint64_t now = timer_group_get_counter_value_in_isr(HAL_TIMER_GROUP, HAL_TIMER_COUNTER);
+        // Read hardware timer, this is a 64bit value, so it rolls over every
+        // 584,942 years. Unlike timer_get_counter_value, the _in_isr variant is in IRAM, but it does not
+        // lock the counter latch, so the lock keeps the other core from latching between the two halves.
+    portEXIT_CRITICAL_SAFE(&timer_lock);
+    return now;
+}
+
+/**
+ * @brief Reads the cycle counter of the calling core. Cheap enough to time short interrupt handlers, and safe
+ * to call from interrupt context. Wraps, so only the difference of two close readings on the same core is valid.
+ * @returns The cycle count
+ */
+uint32_t IRAM_ATTR hal_cycles()
+{
+    uint32_t cycles;
+    __asm__ __volatile__("rsr %0, ccount" : "=a"(cycles));
+        // the CCOUNT special register counts CPU clocks
+    return cycles;
+}
+
+/**
+ * @brief Gets the rate of the cycle counter
+ * @returns The cycles per us
+ */
+uint32_t hal_cycles_per_us()
+{
+    return getCpuFrequencyMhz();
+}
+
+/**
+ * @brief Blocks the calling task
+ * @param ms - the time to block in ms
+ */
+void hal_delay_ms(uint32_t ms)
+{
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+#pragma endregion
+
+#pragma region Static allocation
+#if HAL_STATIC_ALLOCATION
+static uint8_t static_arena[HAL_STATIC_ARENA_SIZE] __attribute__((aligned(16)));
+#endif
+static size_t static_used = 0;
+static uint32_t static_overflows = 0;
+static portMUX_TYPE static_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Rounds a size up to the alignment of the arena
+ * @param size - the size in bytes
+ * @returns The rounded size
+ */
+static constexpr size_t static_size(size_t size)
+{
+    return (size + 15) & ~(size_t)15;
+}
+
+/**
+ * @brief Takes memory from the static arena. The memory is never returned.
+ * @param size - the size in bytes
+ * @returns The memory, nullptr if the arena is exhausted or static allocation is off
+ */
+static uint8_t* static_alloc(size_t size)
+{
+#if HAL_STATIC_ALLOCATION
+    uint8_t* memory = nullptr;
+    size = static_size(size);
+    portENTER_CRITICAL(&static_lock);
+    if(static_used + size <= HAL_STATIC_ARENA_SIZE)
+    {
+        memory = static_arena + static_used;
+        static_used += size;
+    }
+    else static_overflows++;
+    portEXIT_CRITICAL(&static_lock);
+    return memory;
+#else
+    (void)size;
+    return nullptr;
+#endif
+}
+
+/**
+ * @brief Gets the bytes of the static arena handed out so far
+ * @returns The bytes
+ */
+size_t hal_static_used()
+{
+    return static_used;
+}
+
+/**
+ * @brief Gets the number of objects that did not fit into the static arena and were allocated on the heap
+ * @returns The count
+ */
+uint32_t hal_static_overflows()
+{
+    return static_overflows;
+}
+#pragma endregion
+
+#pragma region Tasks
+/**
+ * @brief Converts a timeout to ticks
+ * @param timeout_ms - the timeout in ms or HAL_WAIT_FOREVER
+ * @returns The timeout in ticks
+ */
+static TickType_t to_ticks(uint32_t timeout_ms)
+{
+    return timeout_ms == HAL_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+}
+
+/**
+ * @brief Creates and starts a task
+ * @param fn - the task function
+ * @param name - the task name
+ * @param stack - the stack size in bytes
+ * @param arg - argument passed to the task function
+ * @param priority - the task priority or HAL_PRIORITY_HIGHEST
+ * @param core - the core to pin the task to or HAL_CORE_ANY
+ * @returns The task handle
+ */
+hal_task_t hal_task_create(hal_task_fn_t fn, const char* name, uint32_t stack, void* arg, int priority, int core)
+{
+    TaskHandle_t task = NULL;
+    if(priority == HAL_PRIORITY_HIGHEST) priority = configMAX_PRIORITIES - 1;
+    BaseType_t affinity = core == HAL_CORE_ANY ? tskNO_AFFINITY : core;
+    uint8_t* memory = static_alloc(static_size(sizeof(StaticTask_t)) + stack);
+    if(memory != nullptr)
+    {
+        task = xTaskCreateStaticPinnedToCore(fn, name, stack, arg, priority,
+            (StackType_t*)(memory + static_size(sizeof(StaticTask_t))), (StaticTask_t*)memory, affinity);
+            // the stack depth is in bytes on the ESP32, like StackType_t
+    }
+    else xTaskCreatePinnedToCore(fn, name, stack, arg, priority, &task, affinity);
+    return task;
+}
+
+/**
+ * @brief Deletes a task
+ * @param task - the task handle
+ */
+void hal_task_delete(hal_task_t task)
+{
+    vTaskDelete((TaskHandle_t)task);
+}
+
+/**
+ * @brief Gets the core the caller runs on. Safe to call from interrupt context.
+ * @returns The core, 0 or 1
+ */
+int IRAM_ATTR hal_core_id()
+{
+    return xPortGetCoreID();
+}
+
+/**
+ * @brief Gets the calling task
+ * @returns The task handle
+ */
+hal_task_t hal_task_current()
+{
+    return xTaskGetCurrentTaskHandle();
+}
+
+/**
+ * @brief Gets the stack the task has never used so far
+ * @param task - the task handle
+ * @returns The free bytes at the high water mark, 0 if the platform does not tell
+ */
+uint32_t hal_task_stack_free(hal_task_t task)
+{
+    return uxTaskGetStackHighWaterMark((TaskHandle_t)task);
+        // ESP-IDF counts stacks in bytes
+}
+
+/**
+ * @brief Gets the processor time a task consumed so far
+ * @param task - the task handle
+ * @returns The time in us, HAL_RUNTIME_UNKNOWN if the platform does not account it
+ */
+uint64_t hal_task_runtime_us(hal_task_t task)
+{
+#if configGENERATE_RUN_TIME_STATS && configUSE_TRACE_FACILITY
+    TaskStatus_t status;
+    vTaskGetInfo((TaskHandle_t)task, &status, pdFALSE, eRunning);
+    return status.ulRunTimeCounter;
+        // ESP-IDF clocks the run time counter with esp_timer, in us
+#else
+    return HAL_RUNTIME_UNKNOWN;
+        // the Arduino core builds FreeRTOS without run time statistics
+#endif
+}
+
+/**
+ * @brief Notifies a task, waking it from hal_task_wait
+ * @param task - the task handle
+ */
+void hal_task_notify(hal_task_t task)
+{
+    xTaskNotifyGive((TaskHandle_t)task);
+}
+
+/**
+ * @brief Notifies a task from interrupt context, waking it from hal_task_wait
+ * @param task - the task handle
+ */
+void IRAM_ATTR hal_task_notify_from_isr(hal_task_t task)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR((TaskHandle_t)task, &xHigherPriorityTaskWoken);
+        // ESP-IDF places FreeRTOS in IRAM, unless CONFIG_FREERTOS_PLACE_FUNCTIONS_INTO_FLASH is set
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/**
+ * @brief Waits for a notification of the calling task and clears it
+ * @param timeout_ms - the maximum time to wait or HAL_WAIT_FOREVER
+ * @returns The number of notifications received, 0 on timeout
+ */
+uint32_t hal_task_wait(uint32_t timeout_ms)
+{
+    return ulTaskNotifyTake(pdTRUE, to_ticks(timeout_ms));
+}
+
+/**
+ * @brief Creates a queue of fixed size items
+ * @param depth - the number of items the queue holds
+ * @param item_size - the size of an item in bytes
+ * @returns The queue handle
+ */
+hal_queue_t hal_queue_create(size_t depth, size_t item_size)
+{
+    uint8_t* memory = static_alloc(static_size(sizeof(StaticQueue_t)) + depth * item_size);
+    if(memory == nullptr) return xQueueCreate(depth, item_size);
+    return xQueueCreateStatic(depth, item_size, memory + static_size(sizeof(StaticQueue_t)), (StaticQueue_t*)memory);
+}
+
+/**
+ * @brief Copies an item to the back of the queue
+ * @param queue - the queue handle
+ * @param item - the item
+ * @param timeout_ms - the maximum time to wait for space or HAL_WAIT_FOREVER
+ * @returns True if the item was queued
+ */
+bool hal_queue_send(hal_queue_t queue, const void* item, uint32_t timeout_ms)
+{
+    return xQueueSend((QueueHandle_t)queue, item, to_ticks(timeout_ms)) == pdTRUE;
+}
+
+/**
+ * @brief Copies an item from the front of the queue and removes it
+ * @param queue - the queue handle
+ * @param item - buffer receiving the item
+ * @param timeout_ms - the maximum time to wait for an item or HAL_WAIT_FOREVER
+ * @returns True if an item was received
+ */
+bool hal_queue_receive(hal_queue_t queue, void* item, uint32_t timeout_ms)
+{
+    return xQueueReceive((QueueHandle_t)queue, item, to_ticks(timeout_ms)) == pdTRUE;
+}
+
+/**
+ * @brief Creates a binary semaphore, initially taken
+ * @returns The semaphore handle
+ */
+hal_sem_t hal_sem_create()
+{
+    uint8_t* memory = static_alloc(sizeof(StaticSemaphore_t));
+    if(memory == nullptr) return xSemaphoreCreateBinary();
+    return xSemaphoreCreateBinaryStatic((StaticSemaphore_t*)memory);
+}
+
+/**
+ * @brief Takes a semaphore
+ * @param sem - the semaphore handle
+ * @param timeout_ms - the maximum time to wait or HAL_WAIT_FOREVER
+ * @returns True if the semaphore was taken
+ */
+bool hal_sem_take(hal_sem_t sem, uint32_t timeout_ms)
+{
+    return xSemaphoreTake((SemaphoreHandle_t)sem, to_ticks(timeout_ms)) == pdTRUE;
+}
+
+/**
+ * @brief Gives a semaphore
+ * @param sem - the semaphore handle
+ */
+void hal_sem_give(hal_sem_t sem)
+{
+    xSemaphoreGive((SemaphoreHandle_t)sem);
+}
+
+/**
+ * @brief Creates an event group with all bits cleared
+ * @returns The event group handle
+ */
+hal_events_t hal_events_create()
+{
+    uint8_t* memory = static_alloc(sizeof(StaticEventGroup_t));
+    if(memory == nullptr) return xEventGroupCreate();
+    return xEventGroupCreateStatic((StaticEventGroup_t*)memory);
+}
+
+/**
+ * @brief Sets bits in an event group, waking the tasks waiting for them
+ * @param events - the event group handle
+ * @param bits - the bits to set, within HAL_EVENT_BITS
+ */
+void hal_events_set(hal_events_t events, uint32_t bits)
+{
+    xEventGroupSetBits((EventGroupHandle_t)events, bits);
+}
+
+/**
+ * @brief Waits for any of a set of bits and clears them
+ * @param events - the event group handle
+ * @param bits - the bits to wait for, within HAL_EVENT_BITS
+ * @param timeout_ms - the maximum time to wait or HAL_WAIT_FOREVER
+ * @returns The bits that were set out of the ones waited for, 0 on timeout
+ */
+uint32_t hal_events_wait(hal_events_t events, uint32_t bits, uint32_t timeout_ms)
+{
+    return xEventGroupWaitBits((EventGroupHandle_t)events, bits, pdTRUE, pdFALSE, to_ticks(timeout_ms)) & bits;
+}
+#pragma endregion
+
+#pragma region Serial
+/**
+ * @brief Opens the serial console
+ * @param baud - the transmission speed
+ */
+void hal_serial_begin(uint32_t baud)
+{
+    Serial.begin(baud);
+}
+
+/**
+ * @brief Flushes and closes the serial console
+ */
+void hal_serial_end()
+{
+    if(Serial)
+    {
+        Serial.flush();
+        Serial.end();
+    }
+}
+
+/**
+ * @brief Writes to the serial console
+ * @param data - the bytes to write
+ * @param len - the number of bytes
+ * @returns The number of bytes written
+ */
+size_t hal_serial_write(const char* data, size_t len)
+{
+    return Serial.write((const uint8_t*)data, len);
+}
+
+/**
+ * @brief Reads the bytes received on the serial console so far, without waiting
+ * @param data - buffer receiving the bytes
+ * @param len - the size of the buffer
+ * @returns The number of bytes read, 0 if nothing was received
+ */
+size_t hal_serial_read(char* data, size_t len)
+{
+    size_t available = Serial.available();
+    if(available == 0) return 0;
+    return Serial.readBytes(data, available < len ? available : len);
+}
+#pragma endregion
+
+#pragma region SPI
+/**
+ * @brief SPI bus on the HSPI peripheral through the Arduino SPI driver
+ */
+class ESP32_SPI_Bus : public HAL_SPI_Bus
+{
+    public:
+        /**
+         * @brief Creates a new instance of ESP32_SPI_Bus
+         * @param frequency - the bus frequency in Hz
+         */
+        ESP32_SPI_Bus(uint32_t frequency) : _spi(HSPI), _settings(frequency, MSBFIRST, SPI_MODE0) {}
+
+        /**
+         * @brief Starts the bus
+         * @param sck - the clock pin
+         * @param miso - the MISO pin, -1 if not used
+         * @param mosi - the MOSI pin
+         * @param cs - the chip select pin
+         */
+        void begin(int8_t sck, int8_t miso, int8_t mosi, int8_t cs) { _spi.begin(sck, miso, mosi, cs); }
+
+        void begin_transaction() override { _spi.beginTransaction(_settings); }
+        void end_transaction() override { _spi.endTransaction(); }
+        void write(uint8_t b) override { _spi.write(b); }
+        void write16(uint16_t w) override { _spi.write16(w); }
+        void write_bytes(const uint8_t* data, size_t len) override { _spi.transferBytes(data, nullptr, len); }
+        void write_pattern(const uint8_t* pattern, uint8_t size, uint32_t repeat) override { _spi.writePattern(pattern, size, repeat); }
+
+    private:
+        SPIClass _spi;
+        SPISettings _settings;
+};
+
+/**
+ * @brief Creates and starts a SPI bus
+ * @param sck - the clock pin
+ * @param miso - the MISO pin, -1 if not used
+ * @param mosi - the MOSI pin
+ * @param cs - the chip select pin
+ * @param frequency - the bus frequency in Hz
+ * @returns The bus
+ */
+HAL_SPI_Bus* HAL_SPI_Bus::create(int8_t sck, int8_t miso, int8_t mosi, int8_t cs, uint32_t frequency)
+{
+    ESP32_SPI_Bus* bus = new ESP32_SPI_Bus(frequency);
+    bus->begin(sck, miso, mosi, cs);
+    return bus;
+}
+#pragma endregion
+
+#pragma region Flash
+/**
+ * @brief Finds a data partition
+ * @param label - the partition label
+ * @returns The partition, nullptr if it does not exist
+ */
+static const esp_partition_t* find_partition(const char* label)
+{
+    return esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+}
+
+/**
+ * @brief Gets the size of a data partition
+ * @param label - the partition label from partitions.csv
+ * @returns The size in bytes, 0 if the partition does not exist
+ */
+size_t hal_partition_size(const char* label)
+{
+    const esp_partition_t* partition = find_partition(label);
+    return partition == nullptr ? 0 : partition->size;
+}
+
+/**
+ * @brief Reads from a data partition
+ * @param label - the partition label from partitions.csv
+ * @param offset - the offset in the partition
+ * @param data - buffer receiving the bytes
+ * @param len - the number of bytes to read
+ * @returns True if the bytes were read
+ */
+bool hal_partition_read(const char* label, size_t offset, void* data, size_t len)
+{
+    const esp_partition_t* partition = find_partition(label);
+    return partition != nullptr && esp_partition_read(partition, offset, data, len) == ESP_OK;
+}
+
+/**
+ * @brief Maps the start of a data partition into the address space, read only. The mapping stays valid until
+ * the program ends.
+ * @param label - the partition label from partitions.csv
+ * @param len - the number of bytes to map
+ * @returns The mapped bytes, nullptr if the partition does not exist or cannot be mapped
+ */
+const uint8_t* hal_partition_map(const char* label, size_t len)
+{
+    const esp_partition_t* partition = find_partition(label);
+    if(partition == nullptr || len > partition->size) return nullptr;
+    const void* data = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if(esp_partition_mmap(partition, 0, len, SPI_FLASH_MMAP_DATA, &data, &handle) != ESP_OK) return nullptr;
+        // reads go through the flash cache, the handle is never released
+    return (const uint8_t*)data;
+}
+
+/**
+ * @brief Erases a range of a data partition, setting all bits. Blocks until the flash is done, and on the ESP32
+ * stalls code running from flash on both cores meanwhile, for about 50 ms per sector. Interrupt handlers in IRAM
+ * keep running, so they must only call the IRAM_ATTR functions of the HAL.
+ * @param label - the partition label from partitions.csv
+ * @param offset - the offset in the partition, a multiple of HAL_FLASH_SECTOR_SIZE
+ * @param len - the number of bytes, a multiple of HAL_FLASH_SECTOR_SIZE
+ * @returns True if the range was erased
+ */
+bool hal_partition_erase(const char* label, size_t offset, size_t len)
+{
+    const esp_partition_t* partition = find_partition(label);
+    return partition != nullptr && esp_partition_erase_range(partition, offset, len) == ESP_OK;
+}
+
+/**
+ * @brief Writes to a data partition. Writing can only clear bits, so the range must have been erased since it
+ * was last written. Stalls code running from flash like hal_partition_erase, for about 1 ms per 256 bytes.
+ * @param label - the partition label from partitions.csv
+ * @param offset - the offset in the partition
+ * @param data - the bytes to write
+ * @param len - the number of bytes
+ * @returns True if the bytes were written
+ */
+bool hal_partition_write(const char* label, size_t offset, const void* data, size_t len)
+{
+    const esp_partition_t* partition = find_partition(label);
+    return partition != nullptr && esp_partition_write(partition, offset, data, len) == ESP_OK;
+}
+#pragma endregion
+
+#endif
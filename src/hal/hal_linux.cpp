@@ -0,0 +1,1150 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef ARDUINO
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+#include "hal.h"
+
+#define HOST_GPIO_COUNT 40
+#define HOST_GPIO_TAPS 4                // Simulated peripherals watching the same pin
+#define HOST_SPI_SLEEP_US 50            // The SPI bus blocks the writer once it is this far behind, shorter
+                                        // transfers accumulate so the sleeps stay above the timer resolution
+#define HOST_FLASH_ERASE_US 50000       // A sector erase blocks the caller this long, like the flash does
+#define HOST_FLASH_PAGE_US 1000         // Programming blocks the caller this long per 256 byte page
+
+/**
+ * @brief State of a simulated pin
+ */
+struct host_pin {
+    hal_pin_mode mode = HAL_PIN_INPUT;
+    bool level = false;
+    hal_edge edge = HAL_EDGE_CHANGE;
+    hal_isr_t isr = nullptr;
+    void* arg = nullptr;
+    bool masked = false;
+    bool driven = false;
+    uint32_t latency_us = 0;    // the interrupt handler runs up to this much after the edge
+    hal_host_tap_t taps[HOST_GPIO_TAPS] = {};
+    void* tap_args[HOST_GPIO_TAPS] = {};
+};
+
+/**
+ * @brief A pthread backed task with a notification counter
+ */
+struct host_task {
+    pthread_t thread;
+    const char* name = nullptr;
+    hal_task_fn_t fn = nullptr;
+    void* arg = nullptr;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t signal = PTHREAD_COND_INITIALIZER;
+    uint32_t notifications = 0;
+    int core = 0;               // the core the task was pinned to, tasks not pinned report core 0
+};
+
+/**
+ * @brief A fixed size item queue
+ */
+struct host_queue {
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t not_empty = PTHREAD_COND_INITIALIZER;
+    pthread_cond_t not_full = PTHREAD_COND_INITIALIZER;
+    uint8_t* items = nullptr;
+    size_t depth = 0;
+    size_t item_size = 0;
+    size_t head = 0;
+    size_t count = 0;
+};
+
+/**
+ * @brief A binary semaphore
+ */
+struct host_sem {
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t signal = PTHREAD_COND_INITIALIZER;
+    bool given = false;
+};
+
+/**
+ * @brief Erase counts of a data partition, written like NOR flash
+ */
+struct host_flash {
+    hal_host_flash_stats stats;
+    std::vector<uint32_t> sector_erases;
+};
+
+/**
+ * @brief An event group
+ */
+struct host_events {
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t signal = PTHREAD_COND_INITIALIZER;
+    uint32_t bits = 0;
+};
+
+static host_pin pins[HOST_GPIO_COUNT];
+static pthread_mutex_t isr_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+    // interrupt handlers do not preempt each other on the target, so they are serialized here as well.
+    // Recursive, since a handler may drive a pin itself.
+static thread_local host_task* current_task = nullptr;
+static struct timespec timer_start = {0, 0};
+static uint32_t time_scale = 1;
+static HAL_SPI_Device* spi_device = nullptr;
+static std::atomic<uint64_t> spi_bytes{0};
+static std::atomic<uint64_t> spi_transactions{0};
+static std::atomic<bool> serial_muted{false};
+static std::map<std::string, std::string> partition_files;
+static std::map<std::string, host_flash> flash_devices;
+static pthread_mutex_t flash_lock = PTHREAD_MUTEX_INITIALIZER;
+static thread_local bool in_isr = false;
+static std::atomic<int> flash_busy{0};
+    // erases and writes in progress, the ESP32 disables the flash cache meanwhile
+static std::atomic<uint32_t> isr_flash_handlers{0};
+static std::atomic<uint32_t> isr_flash_calls{0};
+
+/**
+ * @brief Marks a HAL function that runs from flash on the ESP32. Counts the call if an interrupt handler makes
+ * it while a partition is erased or written, when the flash cache is disabled and the ESP32 would crash.
+ */
+static inline void flash_resident()
+{
+    if(in_isr && flash_busy.load(std::memory_order_relaxed) > 0) isr_flash_calls.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Runs an interrupt handler or a simulated peripheral of a pin, in interrupt context
+ * @param isr - the function to run
+ */
+template<typename F> static inline void run_isr(F isr)
+{
+    bool nested = in_isr;
+    in_isr = true;
+    if(flash_busy.load(std::memory_order_relaxed) > 0) isr_flash_handlers.fetch_add(1, std::memory_order_relaxed);
+    isr();
+    in_isr = nested;
+}
+
+/**
+ * @brief Calculates the absolute deadline for a timed wait
+ * @param timeout_ms - the timeout in ms
+ * @returns The deadline on the realtime clock
+ */
+static struct timespec deadline(uint32_t timeout_ms)
+{
+    struct timespec ts;
+    uint64_t ns = (uint64_t)timeout_ms * 1000000ULL / time_scale;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += ns / 1000000000ULL;
+    ts.tv_nsec += (long)(ns % 1000000000ULL);
+    if(ts.tv_nsec >= 1000000000L) { ts.tv_sec++; ts.tv_nsec -= 1000000000L; }
+    return ts;
+}
+
+/**
+ * @brief Sleeps the calling thread for a simulated time
+ * @param us - the simulated time in us
+ */
+static void sleep_us(uint64_t us)
+{
+    uint64_t ns = us * 1000ULL / time_scale;
+    struct timespec ts = { (time_t)(ns / 1000000000ULL), (long)(ns % 1000000000ULL) };
+    while(nanosleep(&ts, &ts) != 0 && errno == EINTR);
+}
+
+/**
+ * @brief Waits on a condition until it is signaled or the timeout expires
+ * @param cond - the condition
+ * @param lock - the locked mutex protecting the condition
+ * @param until - the deadline, nullptr to wait forever
+ * @returns False if the timeout expired
+ */
+static bool wait(pthread_cond_t* cond, pthread_mutex_t* lock, const struct timespec* until)
+{
+    if(until == nullptr) return pthread_cond_wait(cond, lock) == 0;
+    return pthread_cond_timedwait(cond, lock, until) != ETIMEDOUT;
+}
+
+#pragma region GPIO
+/**
+ * @brief Configures a pin
+ * @param pin - the pin
+ * @param mode - the pin configuration
+ */
+void hal_gpio_mode(uint8_t pin, hal_pin_mode mode)
+{
+    flash_resident();
+    if(pin >= HOST_GPIO_COUNT) return;
+    pins[pin].mode = mode;
+    if(pins[pin].driven) return;
+        // the connected hardware wins over the pull resistors
+    if(mode == HAL_PIN_INPUT_PULLUP) pins[pin].level = true;
+    if(mode == HAL_PIN_INPUT_PULLDOWN) pins[pin].level = false;
+}
+
+/**
+ * @brief Reads the level of a pin
+ * @param pin - the pin
+ * @returns True if the pin is high
+ */
+bool hal_gpio_read(uint8_t pin)
+{
+    flash_resident();
+    return pin < HOST_GPIO_COUNT && __atomic_load_n(&pins[pin].level, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Drives an output pin
+ * @param pin - the pin
+ * @param level - true for high, false for low
+ */
+void hal_gpio_write(uint8_t pin, bool level)
+{
+    flash_resident();
+    hal_host_gpio_set(pin, level);
+}
+
+/**
+ * @brief Attaches an interrupt handler to a pin
+ * @param pin - the pin
+ * @param edge - the edge triggering the handler
+ * @param isr - the handler, runs in interrupt context
+ * @param arg - argument passed to the handler
+ */
+void hal_gpio_attach(uint8_t pin, hal_edge edge, hal_isr_t isr, void* arg)
+{
+    flash_resident();
+    if(pin >= HOST_GPIO_COUNT) return;
+    pthread_mutex_lock(&isr_lock);
+    pins[pin].edge = edge;
+    pins[pin].arg = arg;
+    pins[pin].isr = isr;
+    pthread_mutex_unlock(&isr_lock);
+}
+
+/**
+ * @brief Detaches the interrupt handler from a pin
+ * @param pin - the pin
+ */
+void hal_gpio_detach(uint8_t pin)
+{
+    flash_resident();
+    if(pin >= HOST_GPIO_COUNT) return;
+    pthread_mutex_lock(&isr_lock);
+    pins[pin].isr = nullptr;
+    pthread_mutex_unlock(&isr_lock);
+}
+
+/**
+ * @brief Masks or unmasks the interrupt of a pin without detaching the handler
+ * @param pin - the pin
+ * @param enable - true to unmask, false to mask
+ */
+void hal_gpio_interrupt(uint8_t pin, bool enable)
+{
+    flash_resident();
+    if(pin >= HOST_GPIO_COUNT) return;
+    pthread_mutex_lock(&isr_lock);
+    pins[pin].masked = !enable;
+    pthread_mutex_unlock(&isr_lock);
+}
+
+/**
+ * @brief Drives a pin from outside, as the connected hardware would, firing the attached interrupt handlers
+ * @param pin - the pin
+ * @param level - true for high, false for low
+ */
+void hal_host_gpio_set(uint8_t pin, bool level)
+{
+    if(pin >= HOST_GPIO_COUNT) return;
+    pthread_mutex_lock(&isr_lock);
+    bool old = pins[pin].level;
+    pins[pin].driven = true;
+    __atomic_store_n(&pins[pin].level, level, __ATOMIC_RELEASE);
+    host_pin& p = pins[pin];
+    uint64_t at = old != level ? hal_timer_us() : 0;
+    if(old != level)
+    {
+        for(int i = 0; i < HOST_GPIO_TAPS; i++)
+        {
+            if(p.taps[i] != nullptr) run_isr([&]() { p.taps[i](level, at, p.tap_args[i]); });
+        }
+    }
+    if(p.isr != nullptr && !p.masked && old != level)
+    {
+        if(p.latency_us > 0)
+        {
+            static uint32_t noise = 2463534242u;
+            noise ^= noise << 13; noise ^= noise >> 17; noise ^= noise << 5;
+                // xorshift, the lock serializes it
+            uint64_t until = at + noise % (p.latency_us + 1);
+            while(hal_timer_us() < until) {}
+                // spins, sleeping is far coarser than the latency
+        }
+        if(p.edge == HAL_EDGE_CHANGE || (p.edge == HAL_EDGE_RISING) == level) run_isr([&]() { p.isr(p.arg); });
+    }
+    pthread_mutex_unlock(&isr_lock);
+}
+
+/**
+ * @brief Delays the interrupt handler of a pin by a random time after each edge, like the interrupt latency on the
+ * target. Simulated peripherals on the pin still see the edge on time.
+ * @param pin - the pin
+ * @param max_us - the longest delay in simulated us, 0 to run the handler right away
+ */
+void hal_host_gpio_latency(uint8_t pin, uint32_t max_us)
+{
+    if(pin >= HOST_GPIO_COUNT) return;
+    pthread_mutex_lock(&isr_lock);
+    pins[pin].latency_us = max_us;
+    pthread_mutex_unlock(&isr_lock);
+}
+
+/**
+ * @brief Connects a simulated peripheral to a pin, e.g. a stand-in for the pulse counter or the capture unit.
+ * Peripherals watch the pin besides the interrupt handler and see every level change before it runs.
+ * @param pin - the pin
+ * @param tap - the function receiving the level changes
+ * @param arg - argument passed to the function
+ * @returns True if connected, false if the pin has no free tap
+ */
+bool hal_host_gpio_tap(uint8_t pin, hal_host_tap_t tap, void* arg)
+{
+    if(pin >= HOST_GPIO_COUNT) return false;
+    bool connected = false;
+    pthread_mutex_lock(&isr_lock);
+    for(int i = 0; i < HOST_GPIO_TAPS && !connected; i++)
+    {
+        if(pins[pin].taps[i] != nullptr) continue;
+        pins[pin].taps[i] = tap;
+        pins[pin].tap_args[i] = arg;
+        connected = true;
+    }
+    pthread_mutex_unlock(&isr_lock);
+    return connected;
+}
+
+/**
+ * @brief Disconnects a simulated peripheral from a pin
+ * @param pin - the pin
+ * @param tap - the function passed to hal_host_gpio_tap
+ * @param arg - the argument passed to hal_host_gpio_tap
+ */
+void hal_host_gpio_untap(uint8_t pin, hal_host_tap_t tap, void* arg)
+{
+    if(pin >= HOST_GPIO_COUNT) return;
+    pthread_mutex_lock(&isr_lock);
+    for(int i = 0; i < HOST_GPIO_TAPS; i++)
+    {
+        if(pins[pin].taps[i] == tap && pins[pin].tap_args[i] == arg) pins[pin].taps[i] = nullptr;
+    }
+    pthread_mutex_unlock(&isr_lock);
+}
+#pragma endregion
+
+#pragma region Timer
+/**
+ * @brief Starts the free running microsecond counter. Must be called before hal_timer_us.
+ */
+void hal_timer_init()
+{
+    if(timer_start.tv_sec != 0 || timer_start.tv_nsec != 0) return;
+        // one clock per process, host devices may have started it before the firmware
+    clock_gettime(CLOCK_MONOTONIC, &timer_start);
+}
+
+/**
+ * @brief Stops the free running microsecond counter
+ */
+void hal_timer_deinit() {}
+
+/**
+ * @brief Reads the free running microsecond counter. Safe to call from interrupt context.
+ * @returns The time in us since hal_timer_init
+ */
+uint64_t hal_timer_us()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    int64_t ns = (int64_t)(ts.tv_sec - timer_start.tv_sec) * 1000000000LL + (ts.tv_nsec - timer_start.tv_nsec);
+    return (uint64_t)ns * time_scale / 1000;
+}
+
+/**
+ * @brief Reads the cycle counter of the calling core. Cheap enough to time short interrupt handlers, and safe
+ * to call from interrupt context. Wraps, so only the difference of two close readings on the same core is valid.
+ * @returns The cycle count
+ */
+uint32_t hal_cycles()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec) * time_scale);
+        // simulated ns, so cycles relate to hal_timer_us as on the target
+}
+
+/**
+ * @brief Gets the rate of the cycle counter
+ * @returns The cycles per us
+ */
+uint32_t hal_cycles_per_us()
+{
+    return 1000;
+}
+
+/**
+ * @brief Blocks the calling task
+ * @param ms - the time to block in ms
+ */
+void hal_delay_ms(uint32_t ms)
+{
+    flash_resident();
+    sleep_us((uint64_t)ms * 1000);
+}
+
+/**
+ * @brief Runs the simulated time faster than the wall clock. Must be called before hal_timer_init.
+ * @param factor - the speedup, 1 for real time
+ */
+void hal_host_time_scale(uint32_t factor)
+{
+    time_scale = factor < 1 ? 1 : factor;
+}
+
+/**
+ * @brief Blocks the calling thread until the microsecond counter reaches a time
+ * @param us - the time in us
+ */
+void hal_host_sleep_until(uint64_t us)
+{
+    uint64_t now = hal_timer_us();
+    if(us > now) sleep_us(us - now);
+}
+#pragma endregion
+
+#pragma region Static allocation
+/**
+ * @brief Gets the bytes of the static arena handed out so far. The workstation allocates on the heap.
+ * @returns 0
+ */
+size_t hal_static_used()
+{
+    return 0;
+}
+
+/**
+ * @brief Gets the number of objects that did not fit into the static arena and were allocated on the heap
+ * @returns 0
+ */
+uint32_t hal_static_overflows()
+{
+    return 0;
+}
+#pragma endregion
+
+#pragma region Tasks
+/**
+ * @brief Gets the task of the calling thread, threads not created by hal_task_create get one on first use
+ * @returns The task
+ */
+static host_task* self()
+{
+    if(current_task == nullptr)
+    {
+        current_task = new host_task();
+        current_task->thread = pthread_self();
+    }
+    return current_task;
+}
+
+/**
+ * @brief Thread entry point of a task
+ * @param arg - the task
+ * @returns Nothing
+ */
+static void* task_entry(void* arg)
+{
+    current_task = reinterpret_cast<host_task*>(arg);
+    current_task->fn(current_task->arg);
+    return nullptr;
+}
+
+/**
+ * @brief Creates and starts a task
+ * @param fn - the task function
+ * @param name - the task name
+ * @param stack - the stack size in bytes
+ * @param arg - argument passed to the task function
+ * @param priority - the task priority or HAL_PRIORITY_HIGHEST
+ * @param core - the core to pin the task to or HAL_CORE_ANY
+ * @returns The task handle
+ */
+hal_task_t hal_task_create(hal_task_fn_t fn, const char* name, uint32_t stack, void* arg, int priority, int core)
+{
+    host_task* task = new host_task();
+    task->name = name;
+    task->fn = fn;
+    task->arg = arg;
+    task->core = core == HAL_CORE_ANY ? 0 : core;
+    pthread_create(&task->thread, nullptr, task_entry, task);
+        // host stacks are much larger than the target ones and priorities need privileges, so both are
+        // left to the OS defaults
+    (void)stack;
+    (void)priority;
+    pthread_setname_np(task->thread, name);
+    return task;
+}
+
+/**
+ * @brief Gets the name of the calling task. Does not allocate, so a heap wrapper can call it.
+ * @returns The name passed to hal_task_create, nullptr on threads not created by it
+ */
+const char* hal_host_task_name()
+{
+    return current_task != nullptr ? current_task->name : nullptr;
+}
+
+/**
+ * @brief Gets the core the caller runs on. Safe to call from interrupt context.
+ * @returns The core, 0 or 1
+ */
+int hal_core_id()
+{
+    return self()->core;
+}
+
+/**
+ * @brief Gets the calling task
+ * @returns The task handle
+ */
+hal_task_t hal_task_current()
+{
+    flash_resident();
+    return self();
+}
+
+/**
+ * @brief Gets the stack the task has never used so far
+ * @param task - the task handle
+ * @returns The free bytes at the high water mark, 0 if the platform does not tell
+ */
+uint32_t hal_task_stack_free(hal_task_t task)
+{
+    (void)task;
+    return 0;
+        // host threads run on the much larger stacks of the OS
+}
+
+/**
+ * @brief Gets the processor time a task consumed so far
+ * @param task - the task handle
+ * @returns The time in us, HAL_RUNTIME_UNKNOWN if the platform does not account it
+ */
+uint64_t hal_task_runtime_us(hal_task_t task)
+{
+    clockid_t clock;
+    struct timespec ts;
+    if(pthread_getcpuclockid(reinterpret_cast<host_task*>(task)->thread, &clock) != 0) return HAL_RUNTIME_UNKNOWN;
+    if(clock_gettime(clock, &ts) != 0) return HAL_RUNTIME_UNKNOWN;
+    return ((uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000) * time_scale;
+        // simulated us, like hal_timer_us
+}
+
+/**
+ * @brief Deletes a task
+ * @param task - the task handle
+ */
+void hal_task_delete(hal_task_t task)
+{
+    host_task* t = reinterpret_cast<host_task*>(task);
+    pthread_cancel(t->thread);
+    pthread_join(t->thread, nullptr);
+    delete t;
+}
+
+/**
+ * @brief Notifies a task
+ * @param task - the task handle
+ */
+static void notify(hal_task_t task)
+{
+    host_task* t = reinterpret_cast<host_task*>(task);
+    if(t == nullptr) return;
+        // an input may change before the task has been created
+    pthread_mutex_lock(&t->lock);
+    t->notifications++;
+    pthread_cond_signal(&t->signal);
+    pthread_mutex_unlock(&t->lock);
+}
+
+/**
+ * @brief Notifies a task, waking it from hal_task_wait
+ * @param task - the task handle
+ */
+void hal_task_notify(hal_task_t task)
+{
+    flash_resident();
+    notify(task);
+}
+
+/**
+ * @brief Notifies a task from interrupt context, waking it from hal_task_wait
+ * @param task - the task handle
+ */
+void hal_task_notify_from_isr(hal_task_t task)
+{
+    notify(task);
+}
+
+/**
+ * @brief Waits for a notification of the calling task and clears it
+ * @param timeout_ms - the maximum time to wait or HAL_WAIT_FOREVER
+ * @returns The number of notifications received, 0 on timeout
+ */
+uint32_t hal_task_wait(uint32_t timeout_ms)
+{
+    flash_resident();
+    host_task* t = self();
+    struct timespec until = deadline(timeout_ms);
+    pthread_mutex_lock(&t->lock);
+    while(t->notifications == 0 && wait(&t->signal, &t->lock, timeout_ms == HAL_WAIT_FOREVER ? nullptr : &until));
+    uint32_t n = t->notifications;
+    t->notifications = 0;
+    pthread_mutex_unlock(&t->lock);
+    return n;
+}
+
+/**
+ * @brief Creates a queue of fixed size items
+ * @param depth - the number of items the queue holds
+ * @param item_size - the size of an item in bytes
+ * @returns The queue handle
+ */
+hal_queue_t hal_queue_create(size_t depth, size_t item_size)
+{
+    host_queue* q = new host_queue();
+    q->items = new uint8_t[depth * item_size];
+    q->depth = depth;
+    q->item_size = item_size;
+    return q;
+}
+
+/**
+ * @brief Copies an item to the back of the queue
+ * @param queue - the queue handle
+ * @param item - the item
+ * @param timeout_ms - the maximum time to wait for space or HAL_WAIT_FOREVER
+ * @returns True if the item was queued
+ */
+bool hal_queue_send(hal_queue_t queue, const void* item, uint32_t timeout_ms)
+{
+    flash_resident();
+    host_queue* q = reinterpret_cast<host_queue*>(queue);
+    struct timespec until = deadline(timeout_ms);
+    pthread_mutex_lock(&q->lock);
+    while(q->count == q->depth && wait(&q->not_full, &q->lock, timeout_ms == HAL_WAIT_FOREVER ? nullptr : &until));
+    bool sent = q->count < q->depth;
+    if(sent)
+    {
+        memcpy(q->items + ((q->head + q->count) % q->depth) * q->item_size, item, q->item_size);
+        q->count++;
+        pthread_cond_signal(&q->not_empty);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return sent;
+}
+
+/**
+ * @brief Copies an item from the front of the queue and removes it
+ * @param queue - the queue handle
+ * @param item - buffer receiving the item
+ * @param timeout_ms - the maximum time to wait for an item or HAL_WAIT_FOREVER
+ * @returns True if an item was received
+ */
+bool hal_queue_receive(hal_queue_t queue, void* item, uint32_t timeout_ms)
+{
+    flash_resident();
+    host_queue* q = reinterpret_cast<host_queue*>(queue);
+    struct timespec until = deadline(timeout_ms);
+    pthread_mutex_lock(&q->lock);
+    while(q->count == 0 && wait(&q->not_empty, &q->lock, timeout_ms == HAL_WAIT_FOREVER ? nullptr : &until));
+    bool received = q->count > 0;
+    if(received)
+    {
+        memcpy(item, q->items + q->head * q->item_size, q->item_size);
+        q->head = (q->head + 1) % q->depth;
+        q->count--;
+        pthread_cond_signal(&q->not_full);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return received;
+}
+
+/**
+ * @brief Creates a binary semaphore, initially taken
+ * @returns The semaphore handle
+ */
+hal_sem_t hal_sem_create()
+{
+    return new host_sem();
+}
+
+/**
+ * @brief Takes a semaphore
+ * @param sem - the semaphore handle
+ * @param timeout_ms - the maximum time to wait or HAL_WAIT_FOREVER
+ * @returns True if the semaphore was taken
+ */
+bool hal_sem_take(hal_sem_t sem, uint32_t timeout_ms)
+{
+    flash_resident();
+    host_sem* s = reinterpret_cast<host_sem*>(sem);
+    struct timespec until = deadline(timeout_ms);
+    pthread_mutex_lock(&s->lock);
+    while(!s->given && wait(&s->signal, &s->lock, timeout_ms == HAL_WAIT_FOREVER ? nullptr : &until));
+    bool taken = s->given;
+    s->given = false;
+    pthread_mutex_unlock(&s->lock);
+    return taken;
+}
+
+/**
+ * @brief Gives a semaphore
+ * @param sem - the semaphore handle
+ */
+void hal_sem_give(hal_sem_t sem)
+{
+    flash_resident();
+    host_sem* s = reinterpret_cast<host_sem*>(sem);
+    pthread_mutex_lock(&s->lock);
+    s->given = true;
+    pthread_cond_signal(&s->signal);
+    pthread_mutex_unlock(&s->lock);
+}
+
+/**
+ * @brief Creates an event group with all bits cleared
+ * @returns The event group handle
+ */
+hal_events_t hal_events_create()
+{
+    return new host_events();
+}
+
+/**
+ * @brief Sets bits in an event group, waking the tasks waiting for them
+ * @param events - the event group handle
+ * @param bits - the bits to set, within HAL_EVENT_BITS
+ */
+void hal_events_set(hal_events_t events, uint32_t bits)
+{
+    flash_resident();
+    host_events* e = reinterpret_cast<host_events*>(events);
+    pthread_mutex_lock(&e->lock);
+    e->bits |= bits;
+    pthread_cond_broadcast(&e->signal);
+    pthread_mutex_unlock(&e->lock);
+}
+
+/**
+ * @brief Waits for any of a set of bits and clears them
+ * @param events - the event group handle
+ * @param bits - the bits to wait for, within HAL_EVENT_BITS
+ * @param timeout_ms - the maximum time to wait or HAL_WAIT_FOREVER
+ * @returns The bits that were set out of the ones waited for, 0 on timeout
+ */
+uint32_t hal_events_wait(hal_events_t events, uint32_t bits, uint32_t timeout_ms)
+{
+    flash_resident();
+    host_events* e = reinterpret_cast<host_events*>(events);
+    struct timespec until = deadline(timeout_ms);
+    pthread_mutex_lock(&e->lock);
+    while((e->bits & bits) == 0 && wait(&e->signal, &e->lock, timeout_ms == HAL_WAIT_FOREVER ? nullptr : &until));
+    uint32_t set = e->bits & bits;
+    e->bits &= ~set;
+    pthread_mutex_unlock(&e->lock);
+    return set;
+}
+#pragma endregion
+
+#pragma region Serial
+/**
+ * @brief Opens the serial console
+ * @param baud - the transmission speed
+ */
+void hal_serial_begin(uint32_t baud)
+{
+    (void)baud;
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+        // line buffered, so the log shows up as it is written
+}
+
+/**
+ * @brief Flushes and closes the serial console
+ */
+void hal_serial_end()
+{
+    fflush(stdout);
+}
+
+/**
+ * @brief Writes to the serial console
+ * @param data - the bytes to write
+ * @param len - the number of bytes
+ * @returns The number of bytes written
+ */
+size_t hal_serial_write(const char* data, size_t len)
+{
+    if(serial_muted) return len;
+    return fwrite(data, 1, len, stdout);
+}
+
+/**
+ * @brief Discards everything written to the serial console, e.g. while benchmarking the logger
+ * @param mute - true to discard, false to write to stdout again
+ */
+void hal_host_serial_mute(bool mute)
+{
+    serial_muted = mute;
+}
+
+/**
+ * @brief Reads the bytes received on the serial console so far, without waiting
+ * @param data - buffer receiving the bytes
+ * @param len - the size of the buffer
+ * @returns The number of bytes read, 0 if nothing was received
+ */
+size_t hal_serial_read(char* data, size_t len)
+{
+    struct pollfd fd = { STDIN_FILENO, POLLIN, 0 };
+    if(poll(&fd, 1, 0) <= 0 || (fd.revents & POLLIN) == 0) return 0;
+    ssize_t n = read(STDIN_FILENO, data, len);
+    return n > 0 ? (size_t)n : 0;
+}
+#pragma endregion
+
+#pragma region SPI
+/**
+ * @brief In-memory SPI bus forwarding the written bytes to the connected device. The bus takes as long as the
+ * bytes take at the bus clock. Like the ESP32 driver, which writes from the CPU, the writer blocks until they are
+ * out, so display timings on the host include the transfer.
+ */
+class Memory_SPI_Bus : public HAL_SPI_Bus
+{
+    public:
+        /**
+         * @brief Creates a new instance of Memory_SPI_Bus
+         * @param frequency - the bus frequency in Hz, 0 to transfer without delay
+         */
+        Memory_SPI_Bus(uint32_t frequency) : _frequency(frequency) {}
+
+        void begin_transaction() override { spi_transactions++; }
+        void end_transaction() override {}
+        void write(uint8_t b) override { write_bytes(&b, 1); }
+        void write16(uint16_t w) override { uint8_t b[2] = { (uint8_t)(w >> 8), (uint8_t)w }; write_bytes(b, 2); }
+
+        void write_bytes(const uint8_t* data, size_t len) override
+        {
+            spi_bytes += len;
+            if(spi_device != nullptr) spi_device->on_write(data, len);
+            transfer(len);
+        }
+
+        void write_pattern(const uint8_t* pattern, uint8_t size, uint32_t repeat) override
+        {
+            spi_bytes += (uint64_t)size * repeat;
+            if(spi_device != nullptr) for(uint32_t i = 0; i < repeat; i++) spi_device->on_write(pattern, size);
+            transfer((uint64_t)size * repeat);
+        }
+
+    private:
+        /**
+         * @brief Occupies the bus for the time the bytes take at the bus clock and blocks the writer until then
+         * @param len - the number of bytes
+         */
+        void transfer(uint64_t len)
+        {
+            if(_frequency == 0) return;
+            uint64_t now = hal_timer_us() * 1000;
+            if(_free_at < now) _free_at = now;
+                // the bus was idle, the transfer starts now
+            _free_at += len * 8 * 1000000000ULL / _frequency;
+            if(_free_at >= now + HOST_SPI_SLEEP_US * 1000) hal_host_sleep_until(_free_at / 1000);
+                // up to the absolute time, so the short transfers that did not block are paid for as well
+        }
+
+        uint32_t _frequency;
+        uint64_t _free_at = 0;          // simulated time in ns the last byte is out
+};
+
+/**
+ * @brief Creates and starts a SPI bus
+ * @param sck - the clock pin
+ * @param miso - the MISO pin, -1 if not used
+ * @param mosi - the MOSI pin
+ * @param cs - the chip select pin
+ * @param frequency - the bus frequency in Hz
+ * @returns The bus
+ */
+HAL_SPI_Bus* HAL_SPI_Bus::create(int8_t sck, int8_t miso, int8_t mosi, int8_t cs, uint32_t frequency)
+{
+    (void)sck;
+    (void)miso;
+    (void)mosi;
+    (void)cs;
+        // the in-memory bus has no pins
+    return new Memory_SPI_Bus(frequency);
+}
+
+/**
+ * @brief Connects a device to the in-memory SPI bus. The bus only counts the bytes if no device is connected.
+ * @param device - the device, nullptr to disconnect
+ */
+void hal_host_spi_attach(HAL_SPI_Device* device)
+{
+    spi_device = device;
+}
+
+/**
+ * @brief Gets the number of bytes written to the in-memory SPI bus
+ * @returns The number of bytes
+ */
+uint64_t hal_host_spi_bytes()
+{
+    return spi_bytes;
+}
+
+/**
+ * @brief Gets the number of transactions on the in-memory SPI bus
+ * @returns The number of transactions
+ */
+uint64_t hal_host_spi_transactions()
+{
+    return spi_transactions;
+}
+#pragma endregion
+
+#pragma region Flash
+/**
+ * @brief Gets the file backing a data partition
+ * @param label - the partition label
+ * @returns The path of the file
+ */
+static std::string partition_file(const char* label)
+{
+    auto it = partition_files.find(label);
+    return it != partition_files.end() ? it->second : std::string(label) + ".bin";
+}
+
+/**
+ * @brief Backs a data partition with a file. Partitions without a file are read from LABEL.bin in the working
+ * directory.
+ * @param label - the partition label
+ * @param path - the file
+ */
+void hal_host_partition_file(const char* label, const char* path)
+{
+    partition_files[label] = path;
+}
+
+/**
+ * @brief Gets the size of a data partition
+ * @param label - the partition label from partitions.csv
+ * @returns The size in bytes, 0 if the partition does not exist
+ */
+size_t hal_partition_size(const char* label)
+{
+    struct stat st;
+    if(stat(partition_file(label).c_str(), &st) != 0) return 0;
+    return (size_t)st.st_size;
+}
+
+/**
+ * @brief Reads from a data partition
+ * @param label - the partition label from partitions.csv
+ * @param offset - the offset in the partition
+ * @param data - buffer receiving the bytes
+ * @param len - the number of bytes to read
+ * @returns True if the bytes were read
+ */
+bool hal_partition_read(const char* label, size_t offset, void* data, size_t len)
+{
+    flash_resident();
+    FILE* f = fopen(partition_file(label).c_str(), "rb");
+    if(f == nullptr) return false;
+    bool ok = fseek(f, (long)offset, SEEK_SET) == 0 && fread(data, 1, len, f) == len;
+    fclose(f);
+    return ok;
+}
+
+/**
+ * @brief Maps the start of a data partition into the address space, read only. The mapping stays valid until
+ * the program ends.
+ * @param label - the partition label from partitions.csv
+ * @param len - the number of bytes to map
+ * @returns The mapped bytes, nullptr if the partition does not exist or cannot be mapped
+ */
+const uint8_t* hal_partition_map(const char* label, size_t len)
+{
+    if(len == 0 || len > hal_partition_size(label)) return nullptr;
+    int fd = open(partition_file(label).c_str(), O_RDONLY);
+    if(fd < 0) return nullptr;
+    void* data = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+        // the mapping keeps the file referenced
+    return data == MAP_FAILED ? nullptr : (const uint8_t*)data;
+}
+
+/**
+ * @brief Gets the erase counts of a data partition. Must be called with flash_lock held.
+ * @param label - the partition label
+ * @returns The erase counts, sized to the partition
+ */
+static host_flash& flash_device(const char* label)
+{
+    host_flash& flash = flash_devices[label];
+    size_t sectors = hal_partition_size(label) / HAL_FLASH_SECTOR_SIZE;
+    if(flash.sector_erases.size() < sectors) flash.sector_erases.resize(sectors, 0);
+    return flash;
+}
+
+/**
+ * @brief Creates the file backing a data partition, erased, unless a file of that size exists
+ * @param label - the partition label
+ * @param size - the size of the partition in bytes, as in partitions.csv
+ */
+void hal_host_partition_create(const char* label, size_t size)
+{
+    if(hal_partition_size(label) == size) return;
+    FILE* f = fopen(partition_file(label).c_str(), "wb");
+    if(f == nullptr) return;
+    std::vector<uint8_t> erased(size, 0xff);
+    fwrite(erased.data(), 1, size, f);
+    fclose(f);
+}
+
+/**
+ * @brief Erases a range of a data partition, setting all bits. Blocks until the flash is done, and on the ESP32
+ * stalls code running from flash on both cores meanwhile, for about 50 ms per sector. Interrupt handlers in IRAM
+ * keep running, so they must only call the IRAM_ATTR functions of the HAL.
+ * @param label - the partition label from partitions.csv
+ * @param offset - the offset in the partition, a multiple of HAL_FLASH_SECTOR_SIZE
+ * @param len - the number of bytes, a multiple of HAL_FLASH_SECTOR_SIZE
+ * @returns True if the range was erased
+ */
+bool hal_partition_erase(const char* label, size_t offset, size_t len)
+{
+    if(offset % HAL_FLASH_SECTOR_SIZE != 0 || len % HAL_FLASH_SECTOR_SIZE != 0) return false;
+    if(offset + len > hal_partition_size(label)) return false;
+    flash_resident();
+    pthread_mutex_lock(&flash_lock);
+    flash_busy.fetch_add(1, std::memory_order_relaxed);
+    FILE* f = fopen(partition_file(label).c_str(), "r+b");
+    bool ok = f != nullptr && fseek(f, (long)offset, SEEK_SET) == 0;
+    std::vector<uint8_t> erased(len, 0xff);
+    ok = ok && fwrite(erased.data(), 1, len, f) == len;
+    if(f != nullptr) fclose(f);
+    sleep_us((uint64_t)len / HAL_FLASH_SECTOR_SIZE * HOST_FLASH_ERASE_US);
+        // interrupt handlers keep running meanwhile, flash_resident counts those calling into flash
+    flash_busy.fetch_sub(1, std::memory_order_relaxed);
+    if(ok)
+    {
+        host_flash& flash = flash_device(label);
+        for(size_t i = offset / HAL_FLASH_SECTOR_SIZE; i < (offset + len) / HAL_FLASH_SECTOR_SIZE; i++) flash.sector_erases[i]++;
+        flash.stats.erases += len / HAL_FLASH_SECTOR_SIZE;
+    }
+    pthread_mutex_unlock(&flash_lock);
+    return ok;
+}
+
+/**
+ * @brief Writes to a data partition. Writing can only clear bits, so the range must have been erased since it
+ * was last written. Stalls code running from flash like hal_partition_erase, for about 1 ms per 256 bytes.
+ * @param label - the partition label from partitions.csv
+ * @param offset - the offset in the partition
+ * @param data - the bytes to write
+ * @param len - the number of bytes
+ * @returns True if the bytes were written
+ */
+bool hal_partition_write(const char* label, size_t offset, const void* data, size_t len)
+{
+    if(offset + len > hal_partition_size(label)) return false;
+    flash_resident();
+    pthread_mutex_lock(&flash_lock);
+    flash_busy.fetch_add(1, std::memory_order_relaxed);
+    FILE* f = fopen(partition_file(label).c_str(), "r+b");
+    std::vector<uint8_t> cells(len);
+    bool ok = f != nullptr && fseek(f, (long)offset, SEEK_SET) == 0 && fread(cells.data(), 1, len, f) == len;
+    bool overwrite = false;
+    for(size_t i = 0; ok && i < len; i++)
+    {
+        uint8_t b = ((const uint8_t*)data)[i];
+        if((b & ~cells[i]) != 0) overwrite = true;
+        cells[i] &= b;
+            // programming only clears bits, like the flash does
+    }
+    ok = ok && fseek(f, (long)offset, SEEK_SET) == 0 && fwrite(cells.data(), 1, len, f) == len;
+    if(f != nullptr) fclose(f);
+    sleep_us(((uint64_t)len + 255) / 256 * HOST_FLASH_PAGE_US);
+    flash_busy.fetch_sub(1, std::memory_order_relaxed);
+    if(ok)
+    {
+        host_flash& flash = flash_device(label);
+        flash.stats.programmed += len;
+        flash.stats.writes++;
+        if(overwrite) flash.stats.overwrites++;
+    }
+    pthread_mutex_unlock(&flash_lock);
+    return ok;
+}
+
+/**
+ * @brief Gets the write statistics of a data partition since the program started
+ * @param label - the partition label
+ * @returns The statistics
+ */
+hal_host_flash_stats hal_host_flash_statistics(const char* label)
+{
+    pthread_mutex_lock(&flash_lock);
+    host_flash& flash = flash_device(label);
+    hal_host_flash_stats stats = flash.stats;
+    if(!flash.sector_erases.empty())
+    {
+        stats.min_sector_erases = stats.max_sector_erases = flash.sector_erases[0];
+        for(uint32_t n : flash.sector_erases)
+        {
+            if(n < stats.min_sector_erases) stats.min_sector_erases = n;
+            if(n > stats.max_sector_erases) stats.max_sector_erases = n;
+        }
+    }
+    pthread_mutex_unlock(&flash_lock);
+    return stats;
+}
+
+/**
+ * @brief Gets how the interrupt handlers behaved while partitions were erased or written, since the program started
+ * @returns The statistics
+ */
+hal_host_isr_flash_stats hal_host_isr_flash_statistics()
+{
+    hal_host_isr_flash_stats stats;
+    stats.handlers = isr_flash_handlers.load(std::memory_order_relaxed);
+    stats.flash_calls = isr_flash_calls.load(std::memory_order_relaxed);
+    return stats;
+}
+#pragma endregion
+
+#endif
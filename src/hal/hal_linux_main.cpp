@@ -0,0 +1,19 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef ARDUINO
+
+void setup();
+void loop();
+
+/**
+ * @brief Host entry point, runs the sketch like the Arduino core does. Kept apart from the host HAL, so the
+ * host tests link the HAL with entry points of their own.
+ */
+int main()
+{
+    setup();
+    for(;;) loop();
+}
+
+#endif
@@ -0,0 +1,64 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+/**
+ * Host stand-in for the Arduino core. Only provides the types and macros the firmware uses outside of
+ * the HAL, all hardware access goes through hal.h. Never on the include path of the target build.
+ */
+
+#ifdef ARDUINO
+  #error "src/hal/host must not be on the include path of the target build"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+
+#define IRAM_ATTR
+#define PROGMEM
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef uint16_t word;
+
+using std::min;
+using std::max;
+
+class __FlashStringHelper;
+    // marks string literals passed with F(), as on the target
+
+/**
+ * @brief Minimal Arduino String on top of std::string
+ */
+class String
+{
+    public:
+        String() {}
+        String(const char* s) : _s(s == nullptr ? "" : s) {}
+        String(const __FlashStringHelper* s) : String(reinterpret_cast<const char*>(s)) {}
+        String(const std::string& s) : _s(s) {}
+        String(int v) : _s(std::to_string(v)) {}
+        String(unsigned int v) : _s(std::to_string(v)) {}
+        String(long v) : _s(std::to_string(v)) {}
+        String(unsigned long v) : _s(std::to_string(v)) {}
+
+        const char* c_str() const { return _s.c_str(); }
+        unsigned int length() const { return _s.length(); }
+        String& operator+=(const String& o) { _s += o._s; return *this; }
+        friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+        bool operator==(const String& o) const { return _s == o._s; }
+
+    private:
+        std::string _s;
+};
+
+#endif
@@ -7,182 +7,683 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
 #include "SerialLogger.h"
+#include "flight_recorder.h"
+#include "../hal/hal.h"
 
 #define UNIX_EPOCH_START_YEAR 1900
+#define LOGGER_SPEC_SIZE 32             // longest conversion specification, longer ones are written as text
+
+static_assert(sizeof(log_record) == LOGGER_RECORD_SIZE, "log_record does not match LOGGER_RECORD_SIZE");
+
+static const char* const level_names[] = { "[TRACE]", "[DEBUG]", "[INFO]", "[WARN]", "[ERROR]" };
+static const char* const category_names[] = { "", "[system] ", "[controller] ", "[rpm] ", "[display] ", "[spi] " };
+static_assert(sizeof(category_names) / sizeof(category_names[0]) == LOG_CAT_COUNT, "category_names does not match log_category");
+
+/**
+ * @brief Types of the arguments of printf conversions
+ */
+enum log_arg : uint8_t {
+  ARG_NONE,             // %% or a conversion we do not know, written as text
+  ARG_INT,              // also char and short, they are promoted to int
+  ARG_LONG,
+  ARG_LLONG,
+  ARG_SIZE,
+  ARG_INTMAX,
+  ARG_PTRDIFF,
+  ARG_DOUBLE,
+  ARG_LDOUBLE,          // captured as double
+  ARG_STRING,
+  ARG_POINTER,
+  ARG_COUNT             // %n, consumed but never written
+};
+
+/**
+ * @brief A conversion specification in a format
+ */
+struct log_spec {
+  const char* start;    // the '%'
+  size_t length;        // including the conversion character
+  uint8_t stars;        // width and precision passed as arguments
+  log_arg arg;
+};
+
+/**
+ * @brief Finds the next conversion specification in a format
+ * @param p - the position in the format
+ * @param spec - receives the specification
+ * @returns True if a specification was found
+ */
+static bool next_spec(const char* p, log_spec& spec)
+{
+  p = strchr(p, '%');
+  if(p == nullptr) return false;
+  const char* q = p + 1;
+  spec.start = p;
+  spec.stars = 0;
+  while(*q != 0 && strchr("-+ #0'", *q) != nullptr) q++;
+  if(*q == '*') { spec.stars++; q++; } else while(*q >= '0' && *q <= '9') q++;
+  if(*q == '.')
+  {
+    q++;
+    if(*q == '*') { spec.stars++; q++; } else while(*q >= '0' && *q <= '9') q++;
+  }
+  char length = 0;
+  if(*q == 'h') { q++; if(*q == 'h') q++; }
+  else if(*q == 'l') { length = 'l'; q++; if(*q == 'l') { length = 'q'; q++; } }
+  else if(*q == 'q' || *q == 'j' || *q == 'z' || *q == 't' || *q == 'L') length = *q++;
+
+  switch(*q)
+  {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+      spec.arg = length == 'l' ? ARG_LONG : length == 'q' ? ARG_LLONG : length == 'z' ? ARG_SIZE :
+        length == 'j' ? ARG_INTMAX : length == 't' ? ARG_PTRDIFF : ARG_INT;
+      break;
+    case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+      spec.arg = length == 'L' ? ARG_LDOUBLE : ARG_DOUBLE;
+      break;
+    case 's': spec.arg = ARG_STRING; break;
+    case 'p': spec.arg = ARG_POINTER; break;
+    case 'n': spec.arg = ARG_COUNT; break;
+    default: spec.arg = ARG_NONE; spec.stars = 0; break;
+  }
+  spec.length = (*q == 0 ? q : q + 1) - p;
+  return true;
+}
+
+/**
+ * @brief Captures the arguments of a format into the payload of a record
+ * @param record - the record, format must be set
+ * @param args - the arguments
+ */
+static void capture(log_record& record, va_list args)
+{
+  log_spec spec;
+  const char* p = record.format;
+  size_t size = 0;
+  while(next_spec(p, spec))
+  {
+    p = spec.start + spec.length;
+    int64_t values[3];
+    size_t count = 0;
+    for(int i = 0; i < spec.stars; i++) values[count++] = va_arg(args, int);
+    switch(spec.arg)
+    {
+      case ARG_INT: values[count++] = va_arg(args, int); break;
+      case ARG_LONG: values[count++] = va_arg(args, long); break;
+      case ARG_LLONG: values[count++] = va_arg(args, long long); break;
+      case ARG_SIZE: values[count++] = (int64_t)va_arg(args, size_t); break;
+      case ARG_INTMAX: values[count++] = va_arg(args, intmax_t); break;
+      case ARG_PTRDIFF: values[count++] = va_arg(args, ptrdiff_t); break;
+      case ARG_POINTER: values[count++] = (int64_t)(intptr_t)va_arg(args, void*); break;
+      case ARG_COUNT: va_arg(args, void*); break;
+      case ARG_DOUBLE: { double d = va_arg(args, double); memcpy(&values[count++], &d, sizeof(d)); break; }
+      case ARG_LDOUBLE: { double d = (double)va_arg(args, long double); memcpy(&values[count++], &d, sizeof(d)); break; }
+      default: break;
+    }
+    if(size + count * sizeof(int64_t) > sizeof(record.payload)) { record.truncated = 1; break; }
+    memcpy(record.payload + size, values, count * sizeof(int64_t));
+    size += count * sizeof(int64_t);
+
+    if(spec.arg == ARG_STRING)
+    {
+      const char* s = va_arg(args, const char*);
+      if(s == nullptr) s = "(null)";
+      size_t len = strlen(s);
+      size_t room = sizeof(record.payload) - size;
+      if(room < 1) { record.truncated = 1; break; }
+      if(len > room - 1 || len > 255) { len = room - 1 < 255 ? room - 1 : 255; record.truncated = 1; }
+      record.payload[size++] = (uint8_t)len;
+      memcpy(record.payload + size, s, len);
+      size += len;
+      if(record.truncated) break;
+    }
+  }
+  record.size = (uint8_t)size;
+}
+
+/**
+ * @brief Appends a formatted value to a line
+ * @param line - the line
+ * @param size - the size of the line buffer
+ * @param len - the length of the line
+ * @param fmt - the conversion
+ * @param ... the value
+ * @returns The new length of the line
+ */
+static size_t append(char* line, size_t size, size_t len, const char* fmt, ...)
+{
+  if(len >= size - 1) return len;
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(line + len, size - len, fmt, args);
+  va_end(args);
+  if(n < 0) return len;
+  return len + n < size - 1 ? len + n : size - 1;
+}
+
+/**
+ * @brief Formats the message of a record from the captured arguments
+ * @param record - the record
+ * @param line - receives the message
+ * @param size - the size of the line buffer
+ * @param len - the length of the line so far
+ * @returns The length of the line
+ */
+static size_t render(const log_record& record, char* line, size_t size, size_t len)
+{
+  if(record.kind == LOG_KIND_STATIC) return append(line, size, len, "%s", record.format);
+  if(record.kind == LOG_KIND_TEXT) return append(line, size, len, "%.*s", (int)record.size, (const char*)record.payload);
+
+  log_spec spec;
+  const char* p = record.format;
+  size_t pos = 0;
+  while(next_spec(p, spec))
+  {
+    len = append(line, size, len, "%.*s", (int)(spec.start - p), p);
+    p = spec.start + spec.length;
+    if(spec.arg == ARG_NONE)
+    {
+      if(spec.length == 2 && spec.start[1] == '%') len = append(line, size, len, "%%");
+      else len = append(line, size, len, "%.*s", (int)spec.length, spec.start);
+      continue;
+    }
+    if(spec.arg == ARG_COUNT) continue;
+
+    // the conversion with the captured width and precision in place of the stars
+    size_t needed = (spec.stars + (spec.arg == ARG_STRING ? 0 : 1)) * sizeof(int64_t);
+    if(pos + needed > record.size || (spec.arg == ARG_STRING && pos + needed >= record.size) ||
+      spec.length + spec.stars * 11 >= LOGGER_SPEC_SIZE)
+    {
+      return append(line, size, len, "...");
+        // the arguments did not fit the record
+    }
+    char fmt[LOGGER_SPEC_SIZE];
+    size_t f = 0;
+    for(size_t i = 0; i < spec.length; i++)
+    {
+      if(spec.start[i] != '*') { fmt[f++] = spec.start[i]; continue; }
+      int64_t star;
+      memcpy(&star, record.payload + pos, sizeof(star));
+      pos += sizeof(star);
+      f += snprintf(fmt + f, sizeof(fmt) - f, "%d", (int)star);
+    }
+    fmt[f] = 0;
+
+    int64_t v = 0;
+    if(spec.arg != ARG_STRING) { memcpy(&v, record.payload + pos, sizeof(v)); pos += sizeof(v); }
+    switch(spec.arg)
+    {
+      case ARG_INT: len = append(line, size, len, fmt, (int)v); break;
+      case ARG_LONG: len = append(line, size, len, fmt, (long)v); break;
+      case ARG_LLONG: len = append(line, size, len, fmt, (long long)v); break;
+      case ARG_SIZE: len = append(line, size, len, fmt, (size_t)v); break;
+      case ARG_INTMAX: len = append(line, size, len, fmt, (intmax_t)v); break;
+      case ARG_PTRDIFF: len = append(line, size, len, fmt, (ptrdiff_t)v); break;
+      case ARG_POINTER: len = append(line, size, len, fmt, (void*)(intptr_t)v); break;
+      case ARG_DOUBLE: { double d; memcpy(&d, &v, sizeof(d)); len = append(line, size, len, fmt, d); break; }
+      case ARG_LDOUBLE:
+      {
+        double d; memcpy(&d, &v, sizeof(d));
+        len = append(line, size, len, fmt, (long double)d);
+        break;
+      }
+      case ARG_STRING:
+      {
+        char text[256];
+        size_t n = record.payload[pos++];
+        memcpy(text, record.payload + pos, n);
+        text[n] = 0;
+        pos += n;
+        len = append(line, size, len, fmt, text);
+        break;
+      }
+      default: break;
+    }
+  }
+  len = append(line, size, len, "%s", p);
+  if(record.truncated) len = append(line, size, len, "...");
+  return len;
+}
+
+/**
+ * @brief Calculates the FNV-1a hash of a format, which identifies it in binary frames
+ * @param format - the format
+ * @returns The hash, never 0
+ */
+static uint32_t log_id(const char* format)
+{
+  uint32_t hash = 0x811c9dc5;
+  for(const char* p = format; *p != 0; p++) hash = (hash ^ (uint8_t)*p) * 0x01000193;
+  return hash == 0 ? 1 : hash;
+}
+
+/**
+ * @brief Appends a varint, 7 bits per byte, least significant first
+ * @param out - the buffer
+ * @param value - the value
+ * @returns The number of bytes appended
+ */
+static size_t put_varint(uint8_t* out, uint64_t value)
+{
+  size_t n = 0;
+  while(value >= 0x80) { out[n++] = (uint8_t)(value | 0x80); value >>= 7; }
+  out[n++] = (uint8_t)value;
+  return n;
+}
+
+static const uint8_t crc8_table[256] = {
+  0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15, 0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
+  0x70, 0x77, 0x7e, 0x79, 0x6c, 0x6b, 0x62, 0x65, 0x48, 0x4f, 0x46, 0x41, 0x54, 0x53, 0x5a, 0x5d,
+  0xe0, 0xe7, 0xee, 0xe9, 0xfc, 0xfb, 0xf2, 0xf5, 0xd8, 0xdf, 0xd6, 0xd1, 0xc4, 0xc3, 0xca, 0xcd,
+  0x90, 0x97, 0x9e, 0x99, 0x8c, 0x8b, 0x82, 0x85, 0xa8, 0xaf, 0xa6, 0xa1, 0xb4, 0xb3, 0xba, 0xbd,
+  0xc7, 0xc0, 0xc9, 0xce, 0xdb, 0xdc, 0xd5, 0xd2, 0xff, 0xf8, 0xf1, 0xf6, 0xe3, 0xe4, 0xed, 0xea,
+  0xb7, 0xb0, 0xb9, 0xbe, 0xab, 0xac, 0xa5, 0xa2, 0x8f, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9d, 0x9a,
+  0x27, 0x20, 0x29, 0x2e, 0x3b, 0x3c, 0x35, 0x32, 0x1f, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0d, 0x0a,
+  0x57, 0x50, 0x59, 0x5e, 0x4b, 0x4c, 0x45, 0x42, 0x6f, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7d, 0x7a,
+  0x89, 0x8e, 0x87, 0x80, 0x95, 0x92, 0x9b, 0x9c, 0xb1, 0xb6, 0xbf, 0xb8, 0xad, 0xaa, 0xa3, 0xa4,
+  0xf9, 0xfe, 0xf7, 0xf0, 0xe5, 0xe2, 0xeb, 0xec, 0xc1, 0xc6, 0xcf, 0xc8, 0xdd, 0xda, 0xd3, 0xd4,
+  0x69, 0x6e, 0x67, 0x60, 0x75, 0x72, 0x7b, 0x7c, 0x51, 0x56, 0x5f, 0x58, 0x4d, 0x4a, 0x43, 0x44,
+  0x19, 0x1e, 0x17, 0x10, 0x05, 0x02, 0x0b, 0x0c, 0x21, 0x26, 0x2f, 0x28, 0x3d, 0x3a, 0x33, 0x34,
+  0x4e, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5c, 0x5b, 0x76, 0x71, 0x78, 0x7f, 0x6a, 0x6d, 0x64, 0x63,
+  0x3e, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2c, 0x2b, 0x06, 0x01, 0x08, 0x0f, 0x1a, 0x1d, 0x14, 0x13,
+  0xae, 0xa9, 0xa0, 0xa7, 0xb2, 0xb5, 0xbc, 0xbb, 0x96, 0x91, 0x98, 0x9f, 0x8a, 0x8d, 0x84, 0x83,
+  0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb, 0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3,
+};
+
+/**
+ * @brief Calculates the CRC-8 (poly 0x07) of a buffer, the checksum of a frame
+ * @param data - the bytes
+ * @param len - the number of bytes
+ * @returns The checksum
+ */
+uint8_t log_crc8(const uint8_t* data, size_t len)
+{
+  uint8_t crc = 0;
+  for(size_t i = 0; i < len; i++) crc = crc8_table[crc ^ data[i]];
+  return crc;
+}
+
+/**
+ * @brief Encodes a record as a binary frame
+ * @param record - the record
+ * @param frame - receives the frame, LOGGER_LINE_SIZE bytes
+ * @returns The length of the frame
+ */
+static size_t encode(const log_record& record, uint8_t* frame)
+{
+  uint32_t id = record.kind == LOG_KIND_TEXT ? 0 : log_id(record.format);
+  frame[0] = LOGGER_FRAME_MAGIC;
+  frame[2] = (record.level & LOGGER_FRAME_LEVEL) | (record.raw ? LOGGER_FRAME_RAW : 0) |
+    (record.kind == LOG_KIND_STATIC ? LOGGER_FRAME_STATIC : 0) | (record.truncated ? LOGGER_FRAME_TRUNCATED : 0);
+  frame[3] = record.category;
+  for(int i = 0; i < 4; i++) frame[4 + i] = (uint8_t)(id >> (8 * i));
+  size_t n = 8 + put_varint(frame + 8, record.us);
+
+  if(record.kind == LOG_KIND_TEXT)
+  {
+    memcpy(frame + n, record.payload, record.size);
+    n += record.size;
+  }
+  else if(record.kind == LOG_KIND_FORMAT)
+  {
+    // the same walk as render, the arguments are written instead of formatted
+    log_spec spec;
+    const char* p = record.format;
+    size_t pos = 0;
+    while(next_spec(p, spec))
+    {
+      p = spec.start + spec.length;
+      if(spec.arg == ARG_NONE || spec.arg == ARG_COUNT) continue;
+      size_t needed = (spec.stars + (spec.arg == ARG_STRING ? 0 : 1)) * sizeof(int64_t);
+      if(pos + needed > record.size || (spec.arg == ARG_STRING && pos + needed >= record.size)) break;
+      for(int i = 0; i < spec.stars; i++)
+      {
+        int64_t star;
+        memcpy(&star, record.payload + pos, sizeof(star));
+        pos += sizeof(star);
+        n += put_varint(frame + n, ((uint64_t)star << 1) ^ (uint64_t)(star >> 63));
+      }
+      if(spec.arg == ARG_STRING)
+      {
+        size_t len = record.payload[pos++];
+        n += put_varint(frame + n, len);
+        memcpy(frame + n, record.payload + pos, len);
+        n += len;
+        pos += len;
+        continue;
+      }
+      int64_t v;
+      memcpy(&v, record.payload + pos, sizeof(v));
+      pos += sizeof(v);
+      if(spec.arg == ARG_DOUBLE || spec.arg == ARG_LDOUBLE)
+      {
+        for(int i = 0; i < 8; i++) frame[n++] = (uint8_t)((uint64_t)v >> (8 * i));
+        continue;
+      }
+      char conversion = spec.start[spec.length - 1];
+      if(conversion == 'd' || conversion == 'i')
+      {
+        n += put_varint(frame + n, ((uint64_t)v << 1) ^ (uint64_t)(v >> 63));
+        continue;
+      }
+      size_t bits = spec.arg == ARG_INT ? 8 * sizeof(int) : spec.arg == ARG_LONG ? 8 * sizeof(long) :
+        spec.arg == ARG_SIZE ? 8 * sizeof(size_t) : spec.arg == ARG_PTRDIFF ? 8 * sizeof(ptrdiff_t) :
+        spec.arg == ARG_POINTER ? 8 * sizeof(void*) : 64;
+      uint64_t u = (uint64_t)v;
+      if(bits < 64) u &= ((uint64_t)1 << bits) - 1;
+        // unsigned conversions of narrower types were sign extended when captured
+      n += put_varint(frame + n, u);
+    }
+  }
+  frame[1] = (uint8_t)(n - 2);
+  frame[n] = log_crc8(frame + 1, n - 1);
+  return n + 1;
+}
 
 /**
  * @brief Construct a new Serial Logger:: Serial Logger object
  * 
  */
-SerialLogger::SerialLogger() 
-{ 
-  Serial.begin(SERIAL_LOGGER_BAUD_RATE); 
+SerialLogger::SerialLogger()
+{
+  hal_serial_begin(SERIAL_LOGGER_BAUD_RATE);
 }
 
+/**
+ * @brief Starts the drain task. Messages logged from then on are written asynchronously.
+ * 
+ */
+void SerialLogger::Begin()
+{
+  if(this->_started) return;
+  hal_timer_init();
+  this->_drain = hal_task_create(drain_runner, "logDrain", LOGGER_DRAIN_STACK, this, LOGGER_DRAIN_PRIORITY, HAL_CORE_ANY);
+  this->_started = true;
+}
 
 #pragma region Information Logging methods
 /**
- * @brief Logs an information message to the serial console. 
+ * @brief Logs an information message to the serial console.
+ * 
+ * @param message The message to log, copied
+ * @param newline True to terminate with a newline.
+ */
+void SerialLogger::Info(const char* message, bool newline)
+{
+  log_record record;
+  record.format = nullptr;
+  record.level = LOG_LEVEL_INFO;
+  record.category = LOG_CAT_NONE;
+  record.raw = !newline;
+  record.kind = LOG_KIND_TEXT;
+  size_t len = strlen(message);
+  record.truncated = len > sizeof(record.payload);
+  record.size = record.truncated ? sizeof(record.payload) : len;
+  memcpy(record.payload, message, record.size);
+  this->submit(record);
+}
+
+/**
+ * @brief Logs an information message with static storage to the serial console.
  * 
  * @param message The message to log
  * @param newline True to terminate with a newline.
  */
-void SerialLogger::Info(String message, bool newline)
+void SerialLogger::Info(const __FlashStringHelper* message, bool newline)
 {
-  if(newline)
-  { 
-    Serial.print("; ");
-    this->writeTime();
-    Serial.print(F(" [INFO] "));
-    Serial.println(message);
-  }
-  else Serial.print(message);
+  log_record record;
+  record.format = reinterpret_cast<const char*>(message);
+  record.level = LOG_LEVEL_INFO;
+  record.category = LOG_CAT_NONE;
+  record.raw = !newline;
+  record.kind = LOG_KIND_STATIC;
+  record.size = 0;
+  record.truncated = 0;
+  this->submit(record);
 }
 
 /**
  * @brief Logs a formatted message to the serial console. Follows print_f conventions.
  * 
- * @param format The format string
+ * @param format The format string, must have static storage
  * @param ... Argument list for the token replacement in the format string.
- * @return size_t The lenght of the actual string logged.
- */
-size_t SerialLogger::Info_f(String format, ...)
-{
-  char *buf = NULL;
-  va_list arg;
-  va_list copy;
-  Serial.print("; ");
-  this->writeTime();
-  Serial.print(F(" [INFO] "));
-
-  va_start(arg, format);
-  va_copy(copy, arg);
-  int len = vsnprintf(NULL, 0, format.c_str(), arg);
-    // determine the length first, before we attempt the actual conversion 
-  if(len < 0) {
-    // error condition, most likely in the format string. 
-    va_end(arg);
-    va_end(copy);
-    return 0;
-  };
-
-  // allocate memory for the operation
-  buf = (char*) malloc(len+1);
-  if(buf == NULL) {
-    // memory allocation error. 
-    va_end(arg);
-    va_end(copy);
-    return 0;
-  } 
-  len = vsnprintf(buf, len+1, format.c_str(), copy);
-  va_end(arg);
-  va_end(copy);
-  len = Serial.print(buf);
-  free(buf);
-  Serial.println();
+ * @return size_t The number of bytes captured or written, 0 if the message was dropped.
+ */
+size_t SerialLogger::Info_f(const char* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  size_t len = this->log_f(LOG_LEVEL_INFO, LOG_CAT_NONE, format, args);
+  va_end(args);
   return len;
 }
-#pragma endregion 
+
+size_t SerialLogger::Info_f(const __FlashStringHelper* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  size_t len = this->log_f(LOG_LEVEL_INFO, LOG_CAT_NONE, reinterpret_cast<const char*>(format), args);
+  va_end(args);
+  return len;
+}
+#pragma endregion
 
 #pragma region Error Logging methods
 /**
- * @brief Logs an error message to the serial console. 
+ * @brief Logs an error message to the serial console.
+ * 
+ * @param message The message to log, copied
+ */
+void SerialLogger::Error(const char* message)
+{
+  log_record record;
+  record.format = nullptr;
+  record.level = LOG_LEVEL_ERROR;
+  record.category = LOG_CAT_NONE;
+  record.raw = 0;
+  record.kind = LOG_KIND_TEXT;
+  size_t len = strlen(message);
+  record.truncated = len > sizeof(record.payload);
+  record.size = record.truncated ? sizeof(record.payload) : len;
+  memcpy(record.payload, message, record.size);
+  this->submit(record);
+}
+
+/**
+ * @brief Logs an error message with static storage to the serial console.
  * 
  * @param message The message to log
- */  
-void SerialLogger::Error(String message)
+ */
+void SerialLogger::Error(const __FlashStringHelper* message)
 {
-  Serial.print("; ");
-  this->writeTime();
-  Serial.print(F(" [ERROR] "));
-  Serial.println(message);
+  log_record record;
+  record.format = reinterpret_cast<const char*>(message);
+  record.level = LOG_LEVEL_ERROR;
+  record.category = LOG_CAT_NONE;
+  record.raw = 0;
+  record.kind = LOG_KIND_STATIC;
+  record.size = 0;
+  record.truncated = 0;
+  this->submit(record);
 }
 
 /**
  * @brief Logs a formatted error to the serial console. Follows print_f conventions.
  * 
- * @param format The format string
+ * @param format The format string, must have static storage
  * @param ... Argument list for the token replacement in the format string.
- * @return size_t The lenght of the actual string logged.
- */ 
-size_t SerialLogger::Error_f(String format, ...)
-{
-  char *buf = NULL;
-  va_list arg;
-  va_list copy;
-  Serial.print("; ");
-  this->writeTime();
-  Serial.print(F(" [ERROR] "));
-
-  va_start(arg, format);
-  va_copy(copy, arg);
-  int len = vsnprintf(NULL, 0, format.c_str(), arg);
-  if(len < 0) {
-    // error condition, most likely in the format string. 
-    va_end(arg);
-    va_end(copy);
-    return 0;
-  };
-  // allocate memory for the operation
-  buf = (char*) malloc(len+1);
-  if(buf == NULL) {
-    // memory allocation error. 
-    va_end(arg);
-    va_end(copy);
-    return 0;
-  } 
-  len = vsnprintf(buf, len+1, format.c_str(), copy);
-  va_end(arg);
-  va_end(copy);
-  len = Serial.print(buf);
-  free(buf);
-
-  Serial.println();
+ * @return size_t The number of bytes captured or written, 0 if the message was dropped.
+ */
+size_t SerialLogger::Error_f(const char* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  size_t len = this->log_f(LOG_LEVEL_ERROR, LOG_CAT_NONE, format, args);
+  va_end(args);
+  return len;
+}
+
+size_t SerialLogger::Error_f(const __FlashStringHelper* format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  size_t len = this->log_f(LOG_LEVEL_ERROR, LOG_CAT_NONE, reinterpret_cast<const char*>(format), args);
+  va_end(args);
   return len;
 }
 #pragma endregion
 
-#pragma region private methods
 /**
- * @brief Writes the current time inline to the console. 
+ * @brief Logs a formatted message of a level and category. Called by the LOG_* macros of log.h, which
+ * drop the messages below the level configured for the category at compile time.
  * 
+ * @param level The level, LOG_LEVEL_*
+ * @param category The module, log_category
+ * @param format The format string, must have static storage
+ * @param ... Argument list for the token replacement in the format string.
+ * @return size_t The number of bytes captured or written, 0 if the message was dropped.
  */
-void SerialLogger::writeTime()
+size_t SerialLogger::Log(uint8_t level, uint8_t category, const __FlashStringHelper* format, ...)
 {
-  struct tm* ptm;
-  time_t now = time(NULL);
+  va_list args;
+  va_start(args, format);
+  size_t len = this->log_f(level, category, reinterpret_cast<const char*>(format), args);
+  va_end(args);
+  return len;
+}
 
-  ptm = localtime(&now);
-  Serial.print(ptm->tm_year + UNIX_EPOCH_START_YEAR);
-  Serial.print("/");
-  Serial.print(ptm->tm_mon + 1);
-  Serial.print("/");
-  Serial.print(ptm->tm_mday);
-  Serial.print(" ");
-  
-  if (ptm->tm_hour < 10)
+/**
+ * @brief Waits until the drain task wrote the messages logged so far
+ * 
+ * @param timeout_ms The maximum time to wait
+ */
+void SerialLogger::Flush(uint32_t timeout_ms)
+{
+  if(!this->_started) return;
+  uint32_t target = this->_ring.pushed();
+  for(uint32_t waited = 0; (int32_t)(this->_written - target) < 0 && waited < timeout_ms; waited++)
   {
-    Serial.print(0);
+    hal_task_notify(this->_drain);
+    hal_delay_ms(1);
   }
-
-  Serial.print(ptm->tm_hour);
-  Serial.print(":");
-
-  if (ptm->tm_min < 10)
+  if(this->_recorder == nullptr) return;
+  this->_recorder->request_flush();
+  for(uint32_t waited = 0; this->_recorder->is_pending() && waited < timeout_ms; waited++)
   {
-    Serial.print(0);
+    hal_task_notify(this->_drain);
+    hal_delay_ms(1);
   }
+}
+
+#pragma region private methods
+/**
+ * @brief Captures a formatted message and queues or writes it
+ * 
+ * @param level The level of the record
+ * @param category The category of the record
+ * @param format The format string
+ * @param args The arguments
+ * @return size_t The number of bytes captured or written, 0 if the message was dropped.
+ */
+size_t SerialLogger::log_f(uint8_t level, uint8_t category, const char* format, va_list args)
+{
+  log_record record;
+  record.format = format;
+  record.level = level;
+  record.category = category;
+  record.raw = 0;
+  record.kind = LOG_KIND_FORMAT;
+  record.truncated = 0;
+  capture(record, args);
+  return this->submit(record);
+}
 
-  Serial.print(ptm->tm_min);
-  Serial.print(":");
+/**
+ * @brief Queues a record, or writes it if the drain task is not running
+ * 
+ * @param record The record
+ * @return size_t The number of bytes captured or written, 0 if the record was dropped.
+ */
+size_t SerialLogger::submit(log_record& record)
+{
+  record.us = hal_timer_us();
+  if(!this->_started) return this->write(record);
+  if(!this->_ring.push(record)) return 0;
+  return offsetof(log_record, payload) + record.size;
+}
 
-  if (ptm->tm_sec < 10)
+/**
+ * @brief Formats a record and writes it to the console.
+ * 
+ * @param record The record
+ * @return size_t The number of bytes written.
+ */
+size_t SerialLogger::write(const log_record& record)
+{
+  char line[LOGGER_LINE_SIZE];
+  size_t len = 0;
+  if(this->_recorder != nullptr && !record.raw && record.level >= FLIGHT_LOG_LEVEL)
+  {
+    len = encode(record, (uint8_t*)line);
+    this->_recorder->append((const uint8_t*)line, len, record.level >= FLIGHT_LOG_URGENT_LEVEL);
+    if(this->_binary) return hal_serial_write(line, len);
+    len = 0;
+  }
+  if(this->_binary)
+  {
+    len = encode(record, (uint8_t*)line);
+    return hal_serial_write(line, len);
+  }
+  if(!record.raw)
   {
-    Serial.print(0);
+    struct tm tm;
+    time_t t = time(NULL) - (time_t)((hal_timer_us() - record.us) / 1000000);
+      // the wall clock when the message was logged
+    localtime_r(&t, &tm);
+    len = append(line, sizeof(line) - 2, len, "; %d/%d/%d %02d:%02d:%02d %s %s", tm.tm_year + UNIX_EPOCH_START_YEAR,
+      tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec, level_names[record.level < LOG_LEVEL_NONE ? record.level : LOG_LEVEL_ERROR],
+      category_names[record.category < LOG_CAT_COUNT ? record.category : (uint8_t)LOG_CAT_NONE]);
   }
+  len = render(record, line, sizeof(line) - 2, len);
+    // leaves room for the line break
+  if(!record.raw) { line[len++] = '\r'; line[len++] = '\n'; }
+  return hal_serial_write(line, len);
+}
 
-  Serial.print(ptm->tm_sec);
+/**
+ * @brief Task function formatting and writing the queued records
+ * 
+ * @param args Pointer to the logger
+ */
+void SerialLogger::drain_runner(void* args)
+{
+  SerialLogger* _this = reinterpret_cast<SerialLogger*>(args);
+  log_record record;
+  for(;;)
+  {
+    while(_this->_ring.pop(record)) _this->write(record);
+    uint32_t dropped = _this->_ring.dropped();
+    if(dropped != _this->_reported_drops)
+    {
+      record.format = nullptr;
+      record.us = hal_timer_us();
+      record.level = LOG_LEVEL_ERROR;
+      record.category = LOG_CAT_NONE;
+      record.raw = 0;
+      record.kind = LOG_KIND_TEXT;
+      record.truncated = 0;
+      record.size = snprintf((char*)record.payload, sizeof(record.payload), "Logger: %u messages dropped",
+        (unsigned int)(dropped - _this->_reported_drops));
+      _this->write(record);
+      _this->_reported_drops = dropped;
+    }
+    if(_this->_recorder != nullptr) _this->_recorder->service();
+    _this->_written = _this->_ring.popped();
+    hal_task_wait(LOGGER_DRAIN_INTERVAL_MS);
+  }
 }
 #pragma endregion
 
@@ -192,12 +693,8 @@ void SerialLogger::writeTime()
  */
 void SerialLogger::SetSpeed(uint32_t speed)
 {
-  if(Serial)
-  {
-    Serial.flush();
-    Serial.end();
-  }
-  Serial.begin(speed);
+  hal_serial_end();
+  hal_serial_begin(speed);
 }
 
 /**
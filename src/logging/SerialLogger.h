@@ -6,15 +6,115 @@
 #define SERIALLOGGER_H
 
 #include <Arduino.h>
-#include <HardwareSerial.h>
+#include <stdarg.h>
+#include <atomic>
+#include "log_ring.h"
+#include "../hal/hal.h"
 
 #ifndef SERIAL_LOGGER_BAUD_RATE
 #define SERIAL_LOGGER_BAUD_RATE 115200
 #endif
 
+#ifndef LOGGER_RING_SIZE
+#define LOGGER_RING_SIZE 64             // records queued for the drain task, must be a power of two
+#endif
+#define LOGGER_RECORD_SIZE 128          // bytes per record, bounds the copied text and arguments of one message
+#define LOGGER_LINE_SIZE 256            // longest line written, including time stamp and level
+#define LOGGER_DRAIN_PRIORITY 1         // below every controller task
+#define LOGGER_DRAIN_STACK 4096
+#define LOGGER_DRAIN_INTERVAL_MS 20     // the drain task writes the queued records at least this often
+#define LOGGER_FLUSH_TIMEOUT_MS 1000
+#ifndef LOGGER_BINARY
+#define LOGGER_BINARY 0                 // 1 writes binary frames instead of text lines, see below
+#endif
+#define LOGGER_FRAME_MAGIC 0xa5
+#define LOGGER_FRAME_LEVEL 0x07         // frame flags, the LOG_LEVEL_* of the message in the low bits
+#define LOGGER_FRAME_RAW 0x08
+#define LOGGER_FRAME_STATIC 0x10
+#define LOGGER_FRAME_TRUNCATED 0x20
+
+#define LOG_LEVEL_TRACE 0               // message levels, log.h filters them at compile time
+#define LOG_LEVEL_DEBUG 1
+#define LOG_LEVEL_INFO 2
+#define LOG_LEVEL_WARN 3
+#define LOG_LEVEL_ERROR 4
+#define LOG_LEVEL_NONE 5                // as a filter only, disables all messages
+
+/**
+ * In binary mode every message is written as one frame instead of a text line:
+ *
+ *     LOGGER_FRAME_MAGIC
+ *     length           u8, of the frame between this byte and the checksum
+ *     flags            u8, LOGGER_FRAME_*
+ *     category         u8, log_category
+ *     id               u32 le, FNV-1a hash of the format, 0 if the message text follows instead of arguments
+ *     time             varint, hal_timer_us at the time of the call
+ *     arguments        in the order of the conversions: signed integers as zigzag varint, unsigned integers
+ *                      and pointers as varint, doubles as 8 bytes le, strings as varint length and characters
+ *     checksum         u8, CRC-8 (poly 0x07) of the frame after the magic
+ *
+ * A typical message shrinks from 60-90 bytes of text to 15-25 bytes. tools/log_decoder.py extracts the formats
+ * from the sources into a dictionary and turns captured streams back into text. Bytes outside of valid frames,
+ * like the boot messages of the ROM, are passed through as they are.
+ */
+
+class Flight_Recorder;
+
+/**
+ * @brief Calculates the CRC-8 (poly 0x07) of a buffer, the checksum of a frame
+ * @param data - the bytes
+ * @param len - the number of bytes
+ * @returns The checksum
+ */
+uint8_t log_crc8(const uint8_t* data, size_t len);
+
+/**
+ * @brief Modules a message is logged for, see log.h
+ */
+enum log_category : uint8_t {
+  LOG_CAT_NONE,         // messages logged with Info and Error
+  LOG_CAT_SYSTEM,
+  LOG_CAT_CONTROLLER,
+  LOG_CAT_RPM,
+  LOG_CAT_DISPLAY,
+  LOG_CAT_SPI,
+  LOG_CAT_COUNT
+};
+
+/**
+ * @brief Kinds of log records
+ */
+enum log_kind : uint8_t {
+  LOG_KIND_FORMAT,      // format is a printf format, the payload holds its arguments
+  LOG_KIND_TEXT,        // the payload holds the text
+  LOG_KIND_STATIC       // format is the text
+};
+
+/**
+ * @brief A message as queued by the caller and formatted by the drain task
+ */
+struct log_record {
+  const char* format;   // printf format or text with static storage, see log_kind
+  uint64_t us;          // hal_timer_us at the time of the call
+  uint8_t level;        // LOG_LEVEL_*
+  uint8_t category;     // log_category
+  uint8_t raw;          // text without time stamp and line break
+  uint8_t kind;         // log_kind
+  uint8_t size;         // payload bytes used
+  uint8_t truncated;    // the payload could not hold all arguments or the whole text
+  uint8_t payload[LOGGER_RECORD_SIZE - 22];
+    // arguments in the order of the conversions, 8 bytes per number, strings as length byte and characters
+};
+
 /**
  * @brief Allows logging of messages and errors to the serial console.
- * 
+ * @details Until Begin is called messages are formatted and written by the caller. After that callers only
+ * capture the message into a lock-free ring: the format pointer and the raw arguments, with strings copied.
+ * A drain task at LOGGER_DRAIN_PRIORITY formats and writes them, so a high priority task never blocks on the
+ * UART or the heap. When the ring is full messages are dropped and counted, and the drain task reports the
+ * count. Formats, and messages passed with F(), must have static storage, they are read after the call returns.
+ * With a flight recorder attached, the drain task also keeps the messages in flash.
+ * Begin also starts the microsecond counter, which time stamps the messages.
  */
 class SerialLogger
 {
@@ -24,39 +124,105 @@ public:
    * 
    */
   SerialLogger();
-  
+
   /**
-   * @brief Logs an information message to the serial console. 
+   * @brief Starts the drain task. Messages logged from then on are written asynchronously.
+   * 
+   */
+  void Begin();
+
+  /**
+   * @brief Logs an information message to the serial console.
+   * 
+   * @param message The message to log, copied
+   * @param newline True to terminate with a newline.
+   */
+  void Info(const char* message, bool newline=true);
+  void Info(const String& message, bool newline=true) { this->Info(message.c_str(), newline); }
+
+  /**
+   * @brief Logs an information message with static storage to the serial console.
    * 
    * @param message The message to log
    * @param newline True to terminate with a newline.
    */
-  void Info(String message, bool newline=true);
+  void Info(const __FlashStringHelper* message, bool newline=true);
 
   /**
    * @brief Logs a formatted message to the serial console. Follows print_f conventions.
    * 
-   * @param format The format string
+   * @param format The format string, must have static storage
    * @param ... Argument list for the token replacement in the format string.
-   * @return size_t The lenght of the actual string logged.
-   */ 
-  size_t Info_f(String format, ...);
+   * @return size_t The number of bytes captured or written, 0 if the message was dropped.
+   */
+  size_t Info_f(const char* format, ...);
+  size_t Info_f(const __FlashStringHelper* format, ...);
+
+  /**
+   * @brief Logs an error message to the serial console.
+   * 
+   * @param message The message to log, copied
+   */
+  void Error(const char* message);
+  void Error(const String& message) { this->Error(message.c_str()); }
 
   /**
-   * @brief Logs an error message to the serial console. 
+   * @brief Logs an error message with static storage to the serial console.
    * 
    * @param message The message to log
-   */  
-  void Error(String message);
+   */
+  void Error(const __FlashStringHelper* message);
 
   /**
    * @brief Logs a formatted error to the serial console. Follows print_f conventions.
    * 
-   * @param format The format string
+   * @param format The format string, must have static storage
+   * @param ... Argument list for the token replacement in the format string.
+   * @return size_t The number of bytes captured or written, 0 if the message was dropped.
+   */
+  size_t Error_f(const char* format, ...);
+  size_t Error_f(const __FlashStringHelper* format, ...);
+
+  /**
+   * @brief Logs a formatted message of a level and category. Called by the LOG_* macros of log.h, which
+   * drop the messages below the level configured for the category at compile time.
+   * 
+   * @param level The level, LOG_LEVEL_*
+   * @param category The module, log_category
+   * @param format The format string, must have static storage
    * @param ... Argument list for the token replacement in the format string.
-   * @return size_t The lenght of the actual string logged.
-   */ 
-  size_t Error_f(String format, ...);
+   * @return size_t The number of bytes captured or written, 0 if the message was dropped.
+   */
+  size_t Log(uint8_t level, uint8_t category, const __FlashStringHelper* format, ...);
+
+  /**
+   * @brief Waits until the drain task wrote the messages logged so far
+   * 
+   * @param timeout_ms The maximum time to wait
+   */
+  void Flush(uint32_t timeout_ms=LOGGER_FLUSH_TIMEOUT_MS);
+
+  /**
+   * @brief Gets the number of messages dropped because the ring was full
+   * 
+   * @return uint32_t The number of messages
+   */
+  uint32_t GetDropped() const { return _ring.dropped(); }
+
+  /**
+   * @brief Selects between text lines and binary frames
+   * 
+   * @param binary True to write binary frames
+   */
+  void SetBinary(bool binary) { _binary = binary; }
+
+  /**
+   * @brief Records the messages at or above FLIGHT_LOG_LEVEL in flash as well. Must be called before Begin,
+   * the drain task owns the recorder from then on.
+   * 
+   * @param recorder The recorder, begun
+   */
+  void SetRecorder(Flight_Recorder* recorder) { _recorder = recorder; }
 
   /**
    * @brief Sets the transmission speed
@@ -66,10 +232,46 @@ public:
 
 private:
   /**
-   * @brief Writes the current time inline to the console. 
+   * @brief Captures a formatted message and queues or writes it
+   * 
+   * @param level The level of the record
+   * @param category The category of the record
+   * @param format The format string
+   * @param args The arguments
+   * @return size_t The number of bytes captured or written, 0 if the message was dropped.
+   */
+  size_t log_f(uint8_t level, uint8_t category, const char* format, va_list args);
+
+  /**
+   * @brief Queues a record, or writes it if the drain task is not running
    * 
+   * @param record The record
+   * @return size_t The number of bytes captured or written, 0 if the record was dropped.
    */
-  void writeTime();
+  size_t submit(log_record& record);
+
+  /**
+   * @brief Formats a record and writes it to the console.
+   * 
+   * @param record The record
+   * @return size_t The number of bytes written.
+   */
+  size_t write(const log_record& record);
+
+  /**
+   * @brief Task function formatting and writing the queued records
+   * 
+   * @param args Pointer to the logger
+   */
+  static void drain_runner(void* args);
+
+  Log_Ring<log_record, LOGGER_RING_SIZE> _ring;
+  hal_task_t _drain = nullptr;
+  Flight_Recorder* _recorder = nullptr;
+  std::atomic<bool> _started{false};
+  std::atomic<bool> _binary{LOGGER_BINARY != 0};
+  std::atomic<uint32_t> _written{0};
+  uint32_t _reported_drops = 0;
 };
 
 /**
@@ -0,0 +1,191 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <stdio.h>
+#include <string.h>
+#include "flight_recorder.h"
+
+#define FLIGHT_LOG_FRAME_MAX 258        // magic, length, up to 255 bytes and checksum
+
+/**
+ * @brief Finds the end of the log in the partition
+ * @returns True if the partition is usable, false if it does not exist or cannot be written
+ */
+bool Flight_Recorder::begin()
+{
+    _sectors = hal_partition_size(_partition) / HAL_FLASH_SECTOR_SIZE;
+    if(_sectors < 2) return false;
+
+    bool found = false;
+    for(uint32_t i = 0; i < _sectors; i++)
+    {
+        uint32_t sequence;
+        if(!read_header(i, sequence)) continue;
+        if(!found || (int32_t)(sequence - _sequence) > 0)
+        {
+            _sector = i;
+            _sequence = sequence;
+            found = true;
+        }
+    }
+    if(!found) return open_sector(0, 1);
+
+    bool clean;
+    _used = scan_sector(_sector, clean);
+    if(!clean) return open_sector((_sector + 1) % _sectors, _sequence + 1);
+        // the last write was cut short, the rest of the sector may not be erased
+    _ready = true;
+    return true;
+}
+
+/**
+ * @brief Records a frame
+ * @param frame - the frame
+ * @param len - the length of the frame
+ * @param urgent - true to write it to the flash right away
+ */
+void Flight_Recorder::append(const uint8_t* frame, size_t len, bool urgent)
+{
+    if(!_ready || len > FLIGHT_LOG_STAGING) return;
+    if(_used + _staged + len > HAL_FLASH_SECTOR_SIZE)
+    {
+        flush();
+        if(!open_sector((_sector + 1) % _sectors, _sequence + 1)) return;
+    }
+    if(_staged + len > FLIGHT_LOG_STAGING) flush();
+    if(_staged == 0) _staged_us = hal_timer_us();
+    memcpy(_staging + _staged, frame, len);
+    _staged += len;
+    _recorded += len;
+    if(urgent) flush();
+}
+
+/**
+ * @brief Writes the staged frames to the flash
+ */
+void Flight_Recorder::flush()
+{
+    if(!_ready || _staged == 0) return;
+    if(hal_partition_write(_partition, _sector * HAL_FLASH_SECTOR_SIZE + _used, _staging, _staged)) _used += _staged;
+    else _used = HAL_FLASH_SECTOR_SIZE;
+        // do not write over a range that may be partly written, continue in the next sector
+    _staged = 0;
+}
+
+/**
+ * @brief Writes the recorded frames, oldest first, between two text lines
+ * @param sink - receives the bytes, e.g. hal_serial_write
+ * @returns The number of frame bytes written
+ */
+size_t Flight_Recorder::dump(flight_sink_t sink)
+{
+    char line[80];
+    size_t total = 0;
+    flush();
+    snprintf(line, sizeof(line), "; Flight recorder: %u sectors, sequence %u\r\n", (unsigned)get_sectors(), (unsigned)_sequence);
+    sink(line, strlen(line));
+    for(uint32_t i = 1; _ready && i <= _sectors; i++)
+    {
+        uint32_t sector = (_sector + i) % _sectors;
+            // the sector after the current one is the oldest, the current one comes last
+        uint32_t sequence;
+        if(!read_header(sector, sequence)) continue;
+        bool clean;
+        size_t end = sector == _sector ? _used : scan_sector(sector, clean);
+        uint8_t chunk[FLIGHT_LOG_FRAME_MAX];
+        for(size_t pos = sizeof(flight_sector_header); pos < end; )
+        {
+            size_t n = end - pos < sizeof(chunk) ? end - pos : sizeof(chunk);
+            if(!hal_partition_read(_partition, sector * HAL_FLASH_SECTOR_SIZE + pos, chunk, n)) break;
+            sink((const char*)chunk, n);
+            pos += n;
+            total += n;
+        }
+    }
+    snprintf(line, sizeof(line), "\r\n; Flight recorder: %u bytes\r\n", (unsigned)total);
+    sink(line, strlen(line));
+    return total;
+}
+
+/**
+ * @brief Flushes the staged frames once they are due and handles the requests. Called periodically
+ * by the owning task.
+ */
+void Flight_Recorder::service()
+{
+    if(_dump_requested)
+    {
+        dump(hal_serial_write);
+        _dump_requested = false;
+    }
+    if(_flush_requested || (_staged != 0 && hal_timer_us() - _staged_us >= (uint64_t)FLIGHT_LOG_FLUSH_MS * 1000))
+    {
+        flush();
+        _flush_requested = false;
+    }
+}
+
+/**
+ * @brief Erases a sector and writes its header
+ * @param sector - the sector
+ * @param sequence - its sequence number
+ * @returns True if the sector can be written
+ */
+bool Flight_Recorder::open_sector(uint32_t sector, uint32_t sequence)
+{
+    flight_sector_header header = { FLIGHT_LOG_MAGIC, sequence };
+    size_t offset = sector * HAL_FLASH_SECTOR_SIZE;
+    _sector = sector;
+    _sequence = sequence;
+    _used = sizeof(header);
+    _ready = hal_partition_erase(_partition, offset, HAL_FLASH_SECTOR_SIZE) &&
+        hal_partition_write(_partition, offset, &header, sizeof(header));
+    return _ready;
+}
+
+/**
+ * @brief Reads the header of a sector
+ * @param sector - the sector
+ * @param sequence - receives the sequence number
+ * @returns True if the sector is in use
+ */
+bool Flight_Recorder::read_header(uint32_t sector, uint32_t& sequence)
+{
+    flight_sector_header header;
+    if(!hal_partition_read(_partition, sector * HAL_FLASH_SECTOR_SIZE, &header, sizeof(header))) return false;
+    sequence = header.sequence;
+    return header.magic == FLIGHT_LOG_MAGIC;
+}
+
+/**
+ * @brief Finds the end of the intact frames of a sector
+ * @param sector - the sector
+ * @param clean - receives true if the frames are followed by erased flash, false if by a torn or
+ * corrupted frame
+ * @returns The offset in the sector after the last intact frame
+ */
+size_t Flight_Recorder::scan_sector(uint32_t sector, bool& clean)
+{
+    uint8_t frame[FLIGHT_LOG_FRAME_MAX];
+    size_t offset = sector * HAL_FLASH_SECTOR_SIZE;
+    size_t pos = sizeof(flight_sector_header);
+    clean = true;
+    while(pos + 2 <= HAL_FLASH_SECTOR_SIZE)
+    {
+        if(!hal_partition_read(_partition, offset + pos, frame, 2)) break;
+        if(frame[0] == 0xff && frame[1] == 0xff) return pos;
+        size_t len = frame[1] + 3;
+        if(frame[0] != LOGGER_FRAME_MAGIC || pos + len > HAL_FLASH_SECTOR_SIZE ||
+            !hal_partition_read(_partition, offset + pos, frame, len) ||
+            log_crc8(frame + 1, len - 2) != frame[len - 1]) break;
+        pos += len;
+    }
+    clean = pos == HAL_FLASH_SECTOR_SIZE;
+        // a full sector is as good as a clean one, the next frame goes to a new sector anyway
+    return pos;
+}
+
+/**
+ * @brief Global instance recording the log of the firmware
+ */
+Flight_Recorder Recorder;
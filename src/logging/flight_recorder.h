@@ -0,0 +1,164 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _FLIGHT_RECORDER_H_
+#define _FLIGHT_RECORDER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include "SerialLogger.h"
+#include "../hal/hal.h"
+
+#define FLIGHT_LOG_PARTITION "flightlog"
+#define FLIGHT_LOG_SIZE 0x10000                 // size of the partition in partitions.csv, the host creates its file
+#define FLIGHT_LOG_MAGIC 0x31524c46             // "FLR1", marks a sector in use
+#define FLIGHT_LOG_STAGING 512                  // bytes collected in RAM before they are written
+#define FLIGHT_LOG_FLUSH_MS 10000               // staged messages reach the flash at least this often
+#ifndef FLIGHT_LOG_LEVEL
+#define FLIGHT_LOG_LEVEL LOG_LEVEL_INFO         // messages below are not recorded
+#endif
+#define FLIGHT_LOG_URGENT_LEVEL LOG_LEVEL_WARN  // messages at or above are written to the flash right away
+
+/**
+ * @brief Start of every sector of the flight log
+ */
+struct flight_sector_header {
+    uint32_t magic;         // FLIGHT_LOG_MAGIC
+    uint32_t sequence;      // increases with every sector opened, the highest is written
+};
+
+typedef size_t (*flight_sink_t)(const char* data, size_t len);
+
+/**
+ * @brief Keeps the recent log in a flash partition, so it survives resets and power loss.
+ * @details The partition is used as a ring of sectors. Messages are stored as the binary frames of the logger
+ * (see SerialLogger.h) and collected in a RAM buffer, which is written to the end of the current sector when it
+ * is full, when the oldest message in it is FLIGHT_LOG_FLUSH_MS old, or right away for warnings and errors. A
+ * frame never spans sectors. When the current sector is full the next one is erased and opened with the next
+ * sequence number, so every sector is erased once per round and the flash wears evenly. On start the sector
+ * with the highest sequence is continued after its last intact frame, or a new one is opened if it ends in a
+ * torn write. All methods but request_flush and request_dump must be called from the task owning the recorder,
+ * the logger's drain task once it is attached with SerialLogger::SetRecorder.
+ */
+class Flight_Recorder
+{
+    public:
+        /**
+         * @brief Creates a new instance of Flight_Recorder
+         * @param partition - the label of the partition holding the log
+         */
+        Flight_Recorder(const char* partition = FLIGHT_LOG_PARTITION) : _partition(partition) {}
+
+        /**
+         * @brief Finds the end of the log in the partition
+         * @returns True if the partition is usable, false if it does not exist or cannot be written
+         */
+        bool begin();
+
+        /**
+         * @brief Records a frame
+         * @param frame - the frame
+         * @param len - the length of the frame
+         * @param urgent - true to write it to the flash right away
+         */
+        void append(const uint8_t* frame, size_t len, bool urgent);
+
+        /**
+         * @brief Writes the staged frames to the flash
+         */
+        void flush();
+
+        /**
+         * @brief Writes the recorded frames, oldest first, between two text lines
+         * @param sink - receives the bytes, e.g. hal_serial_write
+         * @returns The number of frame bytes written
+         */
+        size_t dump(flight_sink_t sink);
+
+        /**
+         * @brief Flushes the staged frames once they are due and handles the requests. Called periodically
+         * by the owning task.
+         */
+        void service();
+
+        /**
+         * @brief Asks the owning task to flush the staged frames. May be called from any task.
+         */
+        void request_flush() { _flush_requested = true; }
+
+        /**
+         * @brief Asks the owning task to dump the log to the serial console. May be called from any task.
+         */
+        void request_dump() { _dump_requested = true; }
+
+        /**
+         * @brief Checks whether requests are still outstanding
+         * @returns True until the owning task handled all requests
+         */
+        bool is_pending() const { return _flush_requested || _dump_requested; }
+
+        /**
+         * @brief Gets the number of sectors of the partition
+         * @returns The number of sectors, 0 if the partition is not usable
+         */
+        uint32_t get_sectors() const { return _ready ? _sectors : 0; }
+
+        /**
+         * @brief Gets the sequence number of the sector written
+         * @returns The sequence number
+         */
+        uint32_t get_sequence() const { return _sequence; }
+
+        /**
+         * @brief Gets the number of frame bytes recorded since begin
+         * @returns The number of bytes
+         */
+        uint64_t get_recorded() const { return _recorded; }
+
+    private:
+        /**
+         * @brief Erases a sector and writes its header
+         * @param sector - the sector
+         * @param sequence - its sequence number
+         * @returns True if the sector can be written
+         */
+        bool open_sector(uint32_t sector, uint32_t sequence);
+
+        /**
+         * @brief Reads the header of a sector
+         * @param sector - the sector
+         * @param sequence - receives the sequence number
+         * @returns True if the sector is in use
+         */
+        bool read_header(uint32_t sector, uint32_t& sequence);
+
+        /**
+         * @brief Finds the end of the intact frames of a sector
+         * @param sector - the sector
+         * @param clean - receives true if the frames are followed by erased flash, false if by a torn or
+         * corrupted frame
+         * @returns The offset in the sector after the last intact frame
+         */
+        size_t scan_sector(uint32_t sector, bool& clean);
+
+        const char* _partition;
+        uint32_t _sectors = 0;
+        uint32_t _sector = 0;           // the sector written
+        uint32_t _sequence = 0;         // and its sequence number
+        size_t _used = 0;               // bytes written to the sector, including the header
+        uint8_t _staging[FLIGHT_LOG_STAGING];
+        size_t _staged = 0;
+        uint64_t _staged_us = 0;        // time the oldest staged frame was recorded
+        uint64_t _recorded = 0;
+        bool _ready = false;
+        std::atomic<bool> _flush_requested{false};
+        std::atomic<bool> _dump_requested{false};
+};
+
+/**
+ * @brief Global instance recording the log of the firmware
+ */
+extern Flight_Recorder Recorder;
+
+#endif
@@ -0,0 +1,51 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _LOG_H_
+#define _LOG_H_
+
+#include "SerialLogger.h"
+
+/**
+ * Logging front end with compile time levels and per module categories.
+ *
+ *     LOG_INFO(RPM, "Count Hall Sensor pulses on pin %i", pin);
+ *
+ * A message is compiled only if its level is at or above the level configured for its category. The
+ * condition is a constant, so a disabled message, its format and its arguments compile to nothing and the
+ * arguments are not evaluated. An enabled message passes the format as a flash string straight to
+ * SerialLogger::Log, which captures the arguments into the ring without formatting or allocating.
+ *
+ * The levels are configured with build flags, e.g. -DLOG_LEVEL=LOG_LEVEL_WARN -DLOG_LEVEL_RPM=LOG_LEVEL_TRACE.
+ * The format must be a string literal, tools/log_decoder.py extracts it for binary frames.
+ */
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO        // default for all categories
+#endif
+#ifndef LOG_LEVEL_SYSTEM
+#define LOG_LEVEL_SYSTEM LOG_LEVEL      // start up and platform
+#endif
+#ifndef LOG_LEVEL_CONTROLLER
+#define LOG_LEVEL_CONTROLLER LOG_LEVEL  // inputs, relays and machine state
+#endif
+#ifndef LOG_LEVEL_RPM
+#define LOG_LEVEL_RPM LOG_LEVEL         // spindle sensing and estimation
+#endif
+#ifndef LOG_LEVEL_DISPLAY
+#define LOG_LEVEL_DISPLAY LOG_LEVEL     // screen content and assets
+#endif
+#ifndef LOG_LEVEL_SPI
+#define LOG_LEVEL_SPI LOG_LEVEL         // display panel and bus
+#endif
+
+#define LOG_AT(level, category, format, ...) \
+  do { if((level) >= LOG_LEVEL_##category) Logger.Log((level), LOG_CAT_##category, F(format), ##__VA_ARGS__); } while(0)
+
+#define LOG_TRACE(category, format, ...) LOG_AT(LOG_LEVEL_TRACE, category, format, ##__VA_ARGS__)
+#define LOG_DEBUG(category, format, ...) LOG_AT(LOG_LEVEL_DEBUG, category, format, ##__VA_ARGS__)
+#define LOG_INFO(category, format, ...) LOG_AT(LOG_LEVEL_INFO, category, format, ##__VA_ARGS__)
+#define LOG_WARN(category, format, ...) LOG_AT(LOG_LEVEL_WARN, category, format, ##__VA_ARGS__)
+#define LOG_ERROR(category, format, ...) LOG_AT(LOG_LEVEL_ERROR, category, format, ##__VA_ARGS__)
+
+#endif
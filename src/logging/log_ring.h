@@ -0,0 +1,125 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _LOG_RING_H_
+#define _LOG_RING_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <type_traits>
+
+/**
+ * @brief Fixed capacity multi-producer/single-consumer ring of records.
+ * @details Every slot carries a sequence number. A producer claims the slot at the tail with a compare and
+ * swap on the tail index, copies the record and publishes it by advancing the slot sequence, so producers on
+ * both cores never take a lock and never wait for each other or the consumer. If the ring is full the record
+ * is dropped and counted instead of blocking the producer. The consumer takes records in order and hands the
+ * slot back to the producers by advancing its sequence by N.
+ * @tparam T - the record, must be trivially copyable
+ * @tparam N - ring capacity, must be a power of two
+ */
+template<typename T, size_t N>
+class Log_Ring
+{
+    static_assert(N > 1 && (N & (N - 1)) == 0, "Log_Ring capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "Log_Ring records must be trivially copyable");
+
+    public:
+        /**
+         * @brief Creates a new instance of Log_Ring
+         */
+        Log_Ring()
+        {
+            for(size_t i = 0; i < N; i++) _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Appends a record. May be called from any number of producers, including interrupt handlers,
+         * which it is inlined into so it runs from IRAM.
+         * @param record - the record
+         * @returns True if the record was queued, false if the ring was full and the record was dropped
+         */
+        inline __attribute__((always_inline)) bool push(const T& record)
+        {
+            uint32_t pos = _tail.load(std::memory_order_relaxed);
+            for(;;)
+            {
+                uint32_t seq = _slots[pos & (N - 1)].sequence.load(std::memory_order_acquire);
+                int32_t diff = (int32_t)(seq - pos);
+                if(diff == 0)
+                {
+                    if(_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                        // on failure pos holds the new tail
+                }
+                else if(diff < 0)
+                {
+                    // the consumer has not freed the slot yet
+                    _dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                else pos = _tail.load(std::memory_order_relaxed);
+                    // another producer claimed the slot
+            }
+            slot& s = _slots[pos & (N - 1)];
+            s.record = record;
+            s.sequence.store(pos + 1, std::memory_order_release);
+                // publish the record only after it has been written
+            return true;
+        }
+
+        /**
+         * @brief Takes the oldest record. Must only be called from a single consumer.
+         * @param record - receives the record
+         * @returns True if a record was taken, false if the ring is empty or the oldest record is still written
+         */
+        bool pop(T& record)
+        {
+            uint32_t pos = _head.load(std::memory_order_relaxed);
+            slot& s = _slots[pos & (N - 1)];
+            if(s.sequence.load(std::memory_order_acquire) != pos + 1) return false;
+            record = s.record;
+            s.sequence.store(pos + N, std::memory_order_release);
+            _head.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Gets the number of records queued since construction
+         * @returns The monotonic tail index
+         */
+        uint32_t pushed() const
+        {
+            return _tail.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Gets the number of records taken since construction
+         * @returns The monotonic head index
+         */
+        uint32_t popped() const
+        {
+            return _head.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Gets the number of records dropped because the ring was full
+         * @returns The number of records
+         */
+        uint32_t dropped() const
+        {
+            return _dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct slot {
+            std::atomic<uint32_t> sequence;
+            T record;
+        };
+        slot _slots[N];
+        std::atomic<uint32_t> _tail{0};
+        std::atomic<uint32_t> _head{0};
+        std::atomic<uint32_t> _dropped{0};
+};
+
+#endif
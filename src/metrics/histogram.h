@@ -0,0 +1,108 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _HISTOGRAM_H_
+#define _HISTOGRAM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+#define HISTOGRAM_BUCKETS 33            // one for 0 and one per power of two of a 32 bit value
+
+/**
+ * @brief Lock-free histogram of 32 bit values in power of two buckets, cheap enough to record in interrupt
+ * handlers.
+ * @details Bucket 0 counts the value 0, bucket b > 0 counts the values from 2^(b-1) to 2^b - 1, so the bucket
+ * of a value is its bit length, a single instruction on the ESP32. There is a single writer per histogram (one
+ * interrupt handler), which increments the bucket with a relaxed load and store, so no read-modify-write is
+ * needed. Readers copy the buckets one by one, so a copy taken while the writer runs may miss the newest values
+ * but never counts a value twice. The counts accumulate from the start and wrap after 2^32 values per bucket.
+ */
+class Log2_Histogram
+{
+    public:
+        /**
+         * @brief Creates a new instance of Log2_Histogram
+         * @param name - the name shown in the report, must be a literal
+         * @param unit - the unit of the values, must be a literal
+         */
+        Log2_Histogram(const char* name, const char* unit) : _name(name), _unit(unit) {}
+
+        /**
+         * @brief Gets the bucket of a value
+         * @param value - the value
+         * @returns The bucket
+         */
+        static inline __attribute__((always_inline)) uint32_t bucket(uint32_t value)
+        {
+            return value == 0 ? 0 : 32 - __builtin_clz(value);
+        }
+
+        /**
+         * @brief Gets the smallest value of a bucket
+         * @param bucket - the bucket
+         * @returns The value
+         */
+        static uint32_t lower(uint32_t bucket) { return bucket == 0 ? 0 : 1u << (bucket - 1); }
+
+        /**
+         * @brief Gets the largest value of a bucket
+         * @param bucket - the bucket
+         * @returns The value
+         */
+        static uint32_t upper(uint32_t bucket) { return bucket == 0 ? 0 : bucket == 32 ? UINT32_MAX : (1u << bucket) - 1; }
+
+        /**
+         * @brief Records a value. Must only be called from a single writer.
+         * @param value - the value
+         */
+        inline __attribute__((always_inline)) void record(uint32_t value)
+        {
+            std::atomic<uint32_t>& count = _counts[bucket(value)];
+            count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            if(value > _max.load(std::memory_order_relaxed)) _max.store(value, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Copies the bucket counts
+         * @param counts - receives HISTOGRAM_BUCKETS counts
+         * @returns The number of values
+         */
+        uint32_t read(uint32_t* counts) const
+        {
+            uint32_t total = 0;
+            for(size_t i = 0; i < HISTOGRAM_BUCKETS; i++)
+            {
+                counts[i] = _counts[i].load(std::memory_order_relaxed);
+                total += counts[i];
+            }
+            return total;
+        }
+
+        /**
+         * @brief Gets the largest value recorded
+         * @returns The value
+         */
+        uint32_t get_max() const { return _max.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Gets the name
+         * @returns The name
+         */
+        const char* get_name() const { return _name; }
+
+        /**
+         * @brief Gets the unit of the values
+         * @returns The unit
+         */
+        const char* get_unit() const { return _unit; }
+
+    private:
+        const char* _name;
+        const char* _unit;
+        std::atomic<uint32_t> _counts[HISTOGRAM_BUCKETS] = {};
+        std::atomic<uint32_t> _max{0};
+};
+
+#endif
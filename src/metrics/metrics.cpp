@@ -0,0 +1,233 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "metrics.h"
+#include "../logging/log.h"
+
+/**
+ * @brief Gets a consistent copy of the counters
+ * @returns The counters
+ */
+isr_counters ISR_Metric::read() const
+{
+    isr_counters counters;
+    for(;;)
+    {
+        uint32_t s1 = _seq.load(std::memory_order_acquire);
+        if(s1 & 1) continue;
+            // the handler runs on the other core and is about to finish
+        counters.calls = _calls.load(std::memory_order_relaxed);
+        counters.max_cycles = _max_cycles.load(std::memory_order_relaxed);
+        counters.cycles = ((uint64_t)_cycles_high.load(std::memory_order_relaxed) << 32) |
+            _cycles_low.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(_seq.load(std::memory_order_relaxed) == s1) return counters;
+    }
+}
+
+/**
+ * @brief Prepares the collector. Must be called before anything is registered.
+ */
+void Metrics_Collector::begin()
+{
+    _lock = hal_sem_create();
+    hal_sem_give(_lock);
+    _last_us = hal_timer_us();
+}
+
+/**
+ * @brief Registers a task
+ * @param metric - the metric the task updates
+ * @param task - the task handle
+ * @returns True if the task was registered, false if the table is full
+ */
+bool Metrics_Collector::add_task(Task_Metric* metric, hal_task_t task)
+{
+    bool added = false;
+    if(_lock == nullptr || metric == nullptr || task == nullptr) return false;
+    hal_sem_take(_lock, HAL_WAIT_FOREVER);
+    for(size_t i = 0; i < METRICS_MAX_TASKS && !added; i++)
+    {
+        if(_tasks[i].metric != nullptr) continue;
+        uint64_t runtime = hal_task_runtime_us(task);
+        _tasks[i] = { metric, task, runtime, metric->get_wakeups(), metric->get_busy_us() };
+        added = true;
+    }
+    hal_sem_give(_lock);
+    return added;
+}
+
+/**
+ * @brief Removes a task. Must be called before the task or its metric are deleted.
+ * @param task - the task handle
+ */
+void Metrics_Collector::remove_task(hal_task_t task)
+{
+    if(_lock == nullptr) return;
+    hal_sem_take(_lock, HAL_WAIT_FOREVER);
+    for(size_t i = 0; i < METRICS_MAX_TASKS; i++)
+    {
+        if(_tasks[i].task == task) _tasks[i] = {};
+    }
+    hal_sem_give(_lock);
+}
+
+/**
+ * @brief Registers an interrupt handler
+ * @param metric - the metric the handler updates
+ * @returns True if the handler was registered, false if the table is full
+ */
+bool Metrics_Collector::add_isr(ISR_Metric* metric)
+{
+    bool added = false;
+    if(_lock == nullptr || metric == nullptr) return false;
+    hal_sem_take(_lock, HAL_WAIT_FOREVER);
+    for(size_t i = 0; i < METRICS_MAX_ISRS && !added; i++)
+    {
+        if(_isrs[i].metric == metric) added = true;
+    }
+    for(size_t i = 0; i < METRICS_MAX_ISRS && !added; i++)
+    {
+        if(_isrs[i].metric != nullptr) continue;
+        _isrs[i] = { metric, metric->read() };
+        added = true;
+    }
+    hal_sem_give(_lock);
+    return added;
+}
+
+/**
+ * @brief Removes an interrupt handler
+ * @param metric - the metric the handler updates
+ */
+void Metrics_Collector::remove_isr(ISR_Metric* metric)
+{
+    if(_lock == nullptr) return;
+    hal_sem_take(_lock, HAL_WAIT_FOREVER);
+    for(size_t i = 0; i < METRICS_MAX_ISRS; i++)
+    {
+        if(_isrs[i].metric == metric) _isrs[i] = {};
+    }
+    hal_sem_give(_lock);
+}
+
+/**
+ * @brief Registers a histogram
+ * @param histogram - the histogram
+ * @returns True if the histogram was registered, false if the table is full
+ */
+bool Metrics_Collector::add_histogram(Log2_Histogram* histogram)
+{
+    bool added = false;
+    if(_lock == nullptr || histogram == nullptr) return false;
+    hal_sem_take(_lock, HAL_WAIT_FOREVER);
+    for(size_t i = 0; i < METRICS_MAX_HISTOGRAMS && !added; i++)
+    {
+        if(_histograms[i] == histogram) added = true;
+    }
+    for(size_t i = 0; i < METRICS_MAX_HISTOGRAMS && !added; i++)
+    {
+        if(_histograms[i] != nullptr) continue;
+        _histograms[i] = histogram;
+        added = true;
+    }
+    hal_sem_give(_lock);
+    return added;
+}
+
+/**
+ * @brief Removes a histogram
+ * @param histogram - the histogram
+ */
+void Metrics_Collector::remove_histogram(Log2_Histogram* histogram)
+{
+    if(_lock == nullptr) return;
+    hal_sem_take(_lock, HAL_WAIT_FOREVER);
+    for(size_t i = 0; i < METRICS_MAX_HISTOGRAMS; i++)
+    {
+        if(_histograms[i] == histogram) _histograms[i] = nullptr;
+    }
+    hal_sem_give(_lock);
+}
+
+/**
+ * @brief Logs one line per task and interrupt handler with the figures since the previous report
+ */
+void Metrics_Collector::report()
+{
+    if(_lock == nullptr) return;
+    hal_sem_take(_lock, HAL_WAIT_FOREVER);
+    uint64_t now = hal_timer_us();
+    uint64_t interval = now - _last_us;
+    uint32_t cycles_per_us = hal_cycles_per_us();
+    _last_us = now;
+    if(interval == 0) interval = 1;
+    LOG_INFO(SYSTEM, "Metrics over %u ms:", (unsigned)(interval / 1000));
+
+    for(size_t i = 0; i < METRICS_MAX_TASKS; i++)
+    {
+        task_entry& e = _tasks[i];
+        if(e.metric == nullptr) continue;
+        uint64_t runtime = hal_task_runtime_us(e.task);
+        uint32_t wakeups = e.metric->get_wakeups();
+        uint32_t busy = e.metric->get_busy_us();
+        bool accounted = runtime != HAL_RUNTIME_UNKNOWN && e.runtime_us != HAL_RUNTIME_UNKNOWN;
+        uint32_t used = accounted ? (uint32_t)(runtime - e.runtime_us) : busy - e.busy_us;
+            // FreeRTOS counts the run time in 32 bits, like the busy time
+        unsigned permille = (unsigned)((uint64_t)used * 1000 / interval);
+        LOG_INFO(SYSTEM, "    task %-14s %3u.%u%% cpu%s, %6u wakeups, %5u bytes stack free",
+            e.metric->get_name(), permille / 10, permille % 10, accounted ? "" : " (busy)",
+            (unsigned)(wakeups - e.wakeups), (unsigned)hal_task_stack_free(e.task));
+        e.runtime_us = runtime;
+        e.wakeups = wakeups;
+        e.busy_us = busy;
+    }
+
+    for(size_t i = 0; i < METRICS_MAX_ISRS; i++)
+    {
+        isr_entry& e = _isrs[i];
+        if(e.metric == nullptr) continue;
+        isr_counters counters = e.metric->read();
+        uint32_t calls = counters.calls - e.counters.calls;
+        uint64_t cycles = counters.cycles - e.counters.cycles;
+        unsigned permille = (unsigned)(cycles * 1000 / cycles_per_us / interval);
+        LOG_INFO(SYSTEM, "    isr  %-14s %3u.%u%% cpu, %6u calls, avg %6u ns, max %6u ns, %llu us total",
+            e.metric->get_name(), permille / 10, permille % 10, (unsigned)calls,
+            calls == 0 ? 0u : (unsigned)(cycles * 1000 / cycles_per_us / calls),
+            (unsigned)((uint64_t)counters.max_cycles * 1000 / cycles_per_us),
+            (unsigned long long)(counters.cycles / cycles_per_us));
+        e.counters = counters;
+    }
+    hal_sem_give(_lock);
+}
+
+/**
+ * @brief Logs the registered histograms, one line per bucket holding values. The histograms accumulate
+ * from the start.
+ */
+void Metrics_Collector::report_histograms()
+{
+    if(_lock == nullptr) return;
+    hal_sem_take(_lock, HAL_WAIT_FOREVER);
+    for(size_t i = 0; i < METRICS_MAX_HISTOGRAMS; i++)
+    {
+        Log2_Histogram* h = _histograms[i];
+        if(h == nullptr) continue;
+        uint32_t counts[HISTOGRAM_BUCKETS];
+        uint32_t total = h->read(counts);
+        LOG_INFO(SYSTEM, "Histogram %s in %s: %u values, max %u", h->get_name(), h->get_unit(), (unsigned)total, (unsigned)h->get_max());
+        for(uint32_t b = 0; b < HISTOGRAM_BUCKETS; b++)
+        {
+            if(counts[b] == 0) continue;
+            unsigned permille = (unsigned)((uint64_t)counts[b] * 1000 / total);
+            LOG_INFO(SYSTEM, "    %10u..%-10u %10u %3u.%u%%", (unsigned)Log2_Histogram::lower(b), (unsigned)Log2_Histogram::upper(b),
+                (unsigned)counts[b], permille / 10, permille % 10);
+        }
+    }
+    hal_sem_give(_lock);
+}
+
+/**
+ * @brief Global instance reporting on the tasks and interrupt handlers of the firmware
+ */
+Metrics_Collector Metrics;
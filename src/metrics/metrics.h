@@ -0,0 +1,254 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _METRICS_H_
+#define _METRICS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include "../hal/hal.h"
+#include "histogram.h"
+
+#define METRICS_MAX_TASKS 8             // tasks the collector reports on
+#define METRICS_MAX_ISRS 6              // interrupt handlers the collector reports on
+#define METRICS_MAX_HISTOGRAMS 6        // histograms the collector reports on
+
+/**
+ * @brief Counts the wakeups of a task and the time it is busy between waking up and blocking again.
+ * @details The task calls wake when it returns from blocking and sleep before it blocks again. Only the task
+ * itself writes, the collector reads the counters from any task. The busy time is a 32 bit count of us, so it
+ * must be sampled at least every 71 minutes. It stands in for the run time of the task on platforms that do not
+ * account it (see hal_task_runtime_us), but also counts the time the task was preempted while busy.
+ */
+class Task_Metric
+{
+    public:
+        /**
+         * @brief Creates a new instance of Task_Metric
+         * @param name - the name shown in the report, must be a literal
+         */
+        Task_Metric(const char* name) : _name(name) {}
+
+        /**
+         * @brief Marks the task as woken up
+         */
+        void wake()
+        {
+            _wake_us = hal_timer_us();
+            _wakeups.store(_wakeups.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Marks the task as about to block
+         */
+        void sleep()
+        {
+            uint32_t busy = (uint32_t)(hal_timer_us() - _wake_us);
+            _busy_us.store(_busy_us.load(std::memory_order_relaxed) + busy, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the name
+         * @returns The name
+         */
+        const char* get_name() const { return _name; }
+
+        /**
+         * @brief Gets the number of wakeups so far
+         * @returns The count, wraps
+         */
+        uint32_t get_wakeups() const { return _wakeups.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Gets the time the task was busy so far
+         * @returns The time in us, wraps
+         */
+        uint32_t get_busy_us() const { return _busy_us.load(std::memory_order_relaxed); }
+
+    private:
+        const char* _name;
+        uint64_t _wake_us = 0;
+        std::atomic<uint32_t> _wakeups{0};
+        std::atomic<uint32_t> _busy_us{0};
+};
+
+/**
+ * @brief The counters of an interrupt handler
+ */
+struct isr_counters {
+    uint32_t calls = 0;
+    uint32_t max_cycles = 0;            // longest call since start
+    uint64_t cycles = 0;                // all calls
+};
+
+/**
+ * @brief Counts the invocations of an interrupt handler and the cycles spent in it.
+ * @details The handler is the only writer. It updates the counters under a sequence number, like Seqlock but
+ * inlined into the handler, so the update stays in IRAM and costs a few stores. Readers retry until they copied
+ * the counters between two equal, even sequence numbers. Each handler must have its own instance and must not
+ * run on both cores. The time is measured with hal_cycles, so it covers the body of the handler, not the
+ * interrupt entry and exit of the platform. The durations can also be binned into a histogram.
+ */
+class ISR_Metric
+{
+    public:
+        /**
+         * @brief Creates a new instance of ISR_Metric
+         * @param name - the name shown in the report, must be a literal
+         * @param durations - optional, receives the duration of every call in cycles
+         */
+        ISR_Metric(const char* name, Log2_Histogram* durations = nullptr) : _name(name), _durations(durations) {}
+
+        /**
+         * @brief Records a call of the handler. Called from the handler.
+         * @param start - hal_cycles when the handler was entered
+         */
+        inline __attribute__((always_inline)) void record(uint32_t start)
+        {
+            uint32_t cycles = hal_cycles() - start;
+            uint32_t seq = _seq.load(std::memory_order_relaxed);
+            _seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            _calls.store(_calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            uint32_t low = _cycles_low.load(std::memory_order_relaxed) + cycles;
+            if(low < cycles) _cycles_high.store(_cycles_high.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            _cycles_low.store(low, std::memory_order_relaxed);
+            if(cycles > _max_cycles.load(std::memory_order_relaxed)) _max_cycles.store(cycles, std::memory_order_relaxed);
+            _seq.store(seq + 2, std::memory_order_release);
+            if(_durations != nullptr) _durations->record(cycles);
+        }
+
+        /**
+         * @brief Gets a consistent copy of the counters
+         * @returns The counters
+         */
+        isr_counters read() const;
+
+        /**
+         * @brief Gets the name
+         * @returns The name
+         */
+        const char* get_name() const { return _name; }
+
+    private:
+        const char* _name;
+        Log2_Histogram* _durations;
+        std::atomic<uint32_t> _seq{0};
+        std::atomic<uint32_t> _calls{0};
+        std::atomic<uint32_t> _max_cycles{0};
+        std::atomic<uint32_t> _cycles_low{0};
+        std::atomic<uint32_t> _cycles_high{0};
+            // 64 bit atomics are not lock free on the ESP32
+};
+
+/**
+ * @brief Records a call of an interrupt handler for the scope of the probe
+ *
+ *     void IRAM_ATTR handler(void* arg) { ISR_Probe probe(handler_metric); ... }
+ */
+class ISR_Probe
+{
+    public:
+        inline __attribute__((always_inline)) ISR_Probe(ISR_Metric& metric) : _metric(metric), _start(hal_cycles()) {}
+        inline __attribute__((always_inline)) ~ISR_Probe() { _metric.record(_start); }
+
+    private:
+        ISR_Metric& _metric;
+        uint32_t _start;
+};
+
+/**
+ * @brief Reports the processor time, wakeups and free stack of the registered tasks and the calls and processor
+ * time of the registered interrupt handlers.
+ * @details Each report covers the time since the previous one, so the first report after start covers the time
+ * since begin. The processor time of a task is taken from the platform if it accounts it, or else from the busy
+ * time of its Task_Metric. Registering, removing and reporting may be called from any task, but not from
+ * interrupts.
+ */
+class Metrics_Collector
+{
+    public:
+        /**
+         * @brief Prepares the collector. Must be called before anything is registered.
+         */
+        void begin();
+
+        /**
+         * @brief Registers a task
+         * @param metric - the metric the task updates
+         * @param task - the task handle
+         * @returns True if the task was registered, false if the table is full
+         */
+        bool add_task(Task_Metric* metric, hal_task_t task);
+
+        /**
+         * @brief Removes a task. Must be called before the task or its metric are deleted.
+         * @param task - the task handle
+         */
+        void remove_task(hal_task_t task);
+
+        /**
+         * @brief Registers an interrupt handler
+         * @param metric - the metric the handler updates
+         * @returns True if the handler was registered, false if the table is full
+         */
+        bool add_isr(ISR_Metric* metric);
+
+        /**
+         * @brief Removes an interrupt handler
+         * @param metric - the metric the handler updates
+         */
+        void remove_isr(ISR_Metric* metric);
+
+        /**
+         * @brief Registers a histogram
+         * @param histogram - the histogram
+         * @returns True if the histogram was registered, false if the table is full
+         */
+        bool add_histogram(Log2_Histogram* histogram);
+
+        /**
+         * @brief Removes a histogram
+         * @param histogram - the histogram
+         */
+        void remove_histogram(Log2_Histogram* histogram);
+
+        /**
+         * @brief Logs one line per task and interrupt handler with the figures since the previous report
+         */
+        void report();
+
+        /**
+         * @brief Logs the registered histograms, one line per bucket holding values. The histograms accumulate
+         * from the start.
+         */
+        void report_histograms();
+
+    private:
+        struct task_entry {
+            Task_Metric* metric;
+            hal_task_t task;
+            uint64_t runtime_us;        // at the previous report
+            uint32_t wakeups;
+            uint32_t busy_us;
+        };
+
+        struct isr_entry {
+            ISR_Metric* metric;
+            isr_counters counters;      // at the previous report
+        };
+
+        hal_sem_t _lock = nullptr;
+        task_entry _tasks[METRICS_MAX_TASKS] = {};
+        isr_entry _isrs[METRICS_MAX_ISRS] = {};
+        Log2_Histogram* _histograms[METRICS_MAX_HISTOGRAMS] = {};
+        uint64_t _last_us = 0;
+};
+
+/**
+ * @brief Global instance reporting on the tasks and interrupt handlers of the firmware
+ */
+extern Metrics_Collector Metrics;
+
+#endif
@@ -0,0 +1,170 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+#include "trace.h"
+#include "../logging/SerialLogger.h"
+
+static const Trace_Point* points[TRACE_MAX_POINTS];
+static std::atomic<uint16_t> point_count{0};
+    // constant initialized, so trace points of any translation unit can register during static initialization
+
+/**
+ * @brief Creates a new instance of Trace_Point
+ * @param name - the name shown on the timeline, must be a literal
+ */
+Trace_Point::Trace_Point(const char* name) : _name(name)
+{
+    _id = point_count.fetch_add(1);
+    if(_id < TRACE_MAX_POINTS) points[_id] = this;
+}
+
+/**
+ * @brief Records a begin event of the calling task
+ * @param point - the trace point
+ */
+Trace_Scope::Trace_Scope(const Trace_Point& point) : _point(point)
+{
+    Trace.record(point, TRACE_BEGIN);
+}
+
+/**
+ * @brief Records the end event
+ */
+Trace_Scope::~Trace_Scope()
+{
+    Trace.record(_point, TRACE_END);
+}
+
+/**
+ * @brief Starts the drain task. Tracing stays stopped until start is called.
+ */
+void Tracer::begin()
+{
+    if(_drain != nullptr) return;
+    _drain = hal_task_create(drain_runner, "traceDrain", TRACE_DRAIN_STACK, this, TRACE_DRAIN_PRIORITY, HAL_CORE_ANY);
+}
+
+/**
+ * @brief Starts recording and streaming, beginning with the names of the points and tasks
+ */
+void Tracer::start()
+{
+    _names_pending = true;
+    _running = true;
+}
+
+/**
+ * @brief Stops recording. Events already recorded are still streamed.
+ */
+void Tracer::stop()
+{
+    _running = false;
+}
+
+/**
+ * @brief Registers a task, so its events are shown under its name
+ * @param task - the task handle
+ * @param name - the name, must be a literal
+ */
+void Tracer::add_task(hal_task_t task, const char* name)
+{
+    for(uint8_t i = 1; i < TRACE_MAX_TASKS; i++)
+    {
+        if(_tasks[i] != nullptr && _tasks[i] != task) continue;
+        _task_names[i] = name;
+        _tasks[i] = task;
+            // the name is in place before record can find the task
+        return;
+    }
+}
+
+/**
+ * @brief Task function streaming the recorded events
+ * @param args - pointer to the Tracer
+ */
+void Tracer::drain_runner(void* args)
+{
+    Tracer* _this = reinterpret_cast<Tracer*>(args);
+    for(;;)
+    {
+        if(_this->_names_pending.exchange(false)) _this->write_names();
+        bool written = _this->write_events(0);
+        written |= _this->write_events(1);
+        if(!written) hal_delay_ms(TRACE_DRAIN_MS);
+    }
+}
+
+/**
+ * @brief Writes a frame
+ * @param kind - the TRACE_KIND_ of the frame
+ * @param payload - the payload
+ * @param len - the length of the payload
+ */
+static void write_frame(uint8_t kind, const uint8_t* payload, size_t len)
+{
+    uint8_t frame[260];
+    frame[0] = TRACE_FRAME_MAGIC;
+    frame[1] = (uint8_t)(len + 1);
+    frame[2] = kind;
+    memcpy(frame + 3, payload, len);
+    frame[len + 3] = log_crc8(frame + 1, len + 2);
+    hal_serial_write((const char*)frame, len + 4);
+}
+
+/**
+ * @brief Writes the names of the trace points and tasks
+ */
+void Tracer::write_names()
+{
+    uint8_t payload[64];
+    uint16_t count = point_count.load();
+    for(uint16_t i = 0; i < count + TRACE_MAX_TASKS; i++)
+    {
+        bool is_point = i < count;
+        uint16_t id = is_point ? i : i - count;
+        const char* name = is_point ? (i < TRACE_MAX_POINTS ? points[i]->get_name() : nullptr) : _task_names[id];
+        if(name == nullptr) continue;
+        size_t len = strlen(name);
+        if(len > sizeof(payload) - 3) len = sizeof(payload) - 3;
+        payload[0] = is_point ? 0 : 1;
+        payload[1] = id & 0xff;
+        payload[2] = id >> 8;
+        memcpy(payload + 3, name, len);
+        write_frame(TRACE_KIND_NAME, payload, len + 3);
+    }
+}
+
+/**
+ * @brief Writes the events queued in the ring of a core
+ * @param core - the core
+ * @returns True if events were written
+ */
+bool Tracer::write_events(int core)
+{
+    uint8_t payload[1 + TRACE_FRAME_EVENTS * sizeof(trace_event)];
+    size_t count = 0;
+    trace_event event;
+    payload[0] = (uint8_t)core;
+    while(count < TRACE_FRAME_EVENTS && _rings[core].pop(event))
+    {
+        memcpy(payload + 1 + count * sizeof(event), &event, sizeof(event));
+            // both targets are little endian, so the struct is the wire format
+        count++;
+    }
+    if(count > 0) write_frame(TRACE_KIND_EVENTS, payload, 1 + count * sizeof(event));
+
+    uint32_t dropped = _rings[core].dropped();
+    if(dropped != _dropped[core])
+    {
+        uint8_t report[5] = { (uint8_t)core, (uint8_t)dropped, (uint8_t)(dropped >> 8), (uint8_t)(dropped >> 16), (uint8_t)(dropped >> 24) };
+        write_frame(TRACE_KIND_DROPPED, report, sizeof(report));
+        _dropped[core] = dropped;
+    }
+    return count > 0;
+}
+
+/**
+ * @brief Global instance tracing the firmware
+ */
+Tracer Trace;
@@ -0,0 +1,255 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include "../hal/hal.h"
+#include "../logging/log_ring.h"
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1                 // 0 compiles the trace macros to nothing
+#endif
+#define TRACE_RING_SIZE 256             // events buffered per core, must be a power of two
+#define TRACE_MAX_POINTS 32             // trace points of the firmware
+#define TRACE_MAX_TASKS 8               // tasks shown by name, others are shown as task 0
+#define TRACE_DRAIN_STACK 2048
+#define TRACE_DRAIN_PRIORITY 0          // below all firmware tasks, like the log drain
+#define TRACE_DRAIN_MS 20               // the drain task empties the rings at least this often
+#define TRACE_FRAME_MAGIC 0xA6          // starts a trace frame, log frames start with LOGGER_FRAME_MAGIC
+#define TRACE_FRAME_EVENTS 31           // events per frame, the frame length must fit in a byte
+#define TRACE_TASK_ISR 0xff             // task of events recorded in interrupt handlers
+
+#define TRACE_BEGIN 'B'                 // phases, as in the Chrome trace format
+#define TRACE_END 'E'
+#define TRACE_INSTANT 'i'
+
+#define TRACE_KIND_NAME 0               // frame kinds
+#define TRACE_KIND_EVENTS 1
+#define TRACE_KIND_DROPPED 2
+
+/**
+ * Lightweight timeline tracing of tasks and interrupt handlers.
+ *
+ *     TRACE_POINT(spi_blit, "spiBlit");
+ *     void blit() { TRACE_SCOPE(spi_blit); ... }
+ *
+ * A scope records a begin event when it is entered and an end event when it is left, an interrupt handler uses
+ * TRACE_ISR_SCOPE. TRACE_ENTER and TRACE_LEAVE mark spans that do not follow a block. Events carry the time of
+ * the counter timer (hal_timer_us) and the task, and are queued in the ring of the core they were recorded on.
+ * While tracing is stopped a trace point costs a relaxed load.
+ *
+ * A drain task streams the events over the serial port in frames, mixed with the log:
+ *
+ *     TRACE_FRAME_MAGIC, length, kind, payload, crc8 of length to payload (log_crc8)
+ *
+ *     TRACE_KIND_NAME     type (0 point, 1 task), id (u16), name
+ *     TRACE_KIND_EVENTS   core, then per event: us (u32), point (u16), task (u8), phase (u8)
+ *     TRACE_KIND_DROPPED  core, events dropped on the core since start (u32)
+ *
+ * Multi byte values are little endian. The names of the points and tasks are sent when tracing starts.
+ * tools/trace_to_chrome.py turns a capture into Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+ */
+
+/**
+ * @brief An event of the trace
+ */
+struct trace_event {
+    uint32_t us;                        // hal_timer_us, wraps after 71 minutes
+    uint16_t point;
+    uint8_t task;                       // index in the task table, TRACE_TASK_ISR in interrupt handlers
+    uint8_t phase;                      // TRACE_BEGIN, TRACE_END or TRACE_INSTANT
+};
+static_assert(sizeof(trace_event) == 8, "trace_event is streamed as is");
+
+/**
+ * @brief A named place in the firmware that records events. Declare trace points as statics with TRACE_POINT,
+ * they register themselves before setup runs.
+ */
+class Trace_Point
+{
+    public:
+        /**
+         * @brief Creates a new instance of Trace_Point
+         * @param name - the name shown on the timeline, must be a literal
+         */
+        Trace_Point(const char* name);
+
+        /**
+         * @brief Gets the name
+         * @returns The name
+         */
+        const char* get_name() const { return _name; }
+
+        /**
+         * @brief Gets the id used in the events
+         * @returns The id
+         */
+        uint16_t get_id() const { return _id; }
+
+    private:
+        const char* _name;
+        uint16_t _id;
+};
+
+/**
+ * @brief Records trace events into per core rings and streams them over the serial port.
+ * @details The rings are the multi-producer rings of the logger, so tasks and interrupt handlers on the same
+ * core never block each other. If the drain task falls behind, events are dropped and counted, and the count
+ * is streamed with the events. At 115200 baud about 1400 events per second get through.
+ */
+class Tracer
+{
+    public:
+        /**
+         * @brief Starts the drain task. Tracing stays stopped until start is called.
+         */
+        void begin();
+
+        /**
+         * @brief Starts recording and streaming, beginning with the names of the points and tasks
+         */
+        void start();
+
+        /**
+         * @brief Stops recording. Events already recorded are still streamed.
+         */
+        void stop();
+
+        /**
+         * @brief Checks whether events are recorded
+         * @returns True if tracing is started
+         */
+        bool is_running() const { return _running.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Registers a task, so its events are shown under its name
+         * @param task - the task handle
+         * @param name - the name, must be a literal
+         */
+        void add_task(hal_task_t task, const char* name);
+
+        /**
+         * @brief Records an event of the calling task
+         * @param point - the trace point
+         * @param phase - TRACE_BEGIN, TRACE_END or TRACE_INSTANT
+         */
+        void record(const Trace_Point& point, uint8_t phase)
+        {
+            if(!is_running()) return;
+            hal_task_t current = hal_task_current();
+            uint8_t task = 0;
+            for(uint8_t i = 1; i < TRACE_MAX_TASKS; i++)
+            {
+                if(_tasks[i] == current) { task = i; break; }
+            }
+            push({ (uint32_t)hal_timer_us(), point.get_id(), task, phase });
+        }
+
+        /**
+         * @brief Records an event of an interrupt handler
+         * @param point - the trace point
+         * @param phase - TRACE_BEGIN, TRACE_END or TRACE_INSTANT
+         */
+        inline __attribute__((always_inline)) void record_isr(const Trace_Point& point, uint8_t phase)
+        {
+            if(!is_running()) return;
+            push({ (uint32_t)hal_timer_us(), point.get_id(), TRACE_TASK_ISR, phase });
+        }
+
+    private:
+        /**
+         * @brief Queues an event in the ring of the calling core
+         * @param event - the event
+         */
+        inline __attribute__((always_inline)) void push(const trace_event& event)
+        {
+            _rings[hal_core_id() & 1].push(event);
+        }
+
+        /**
+         * @brief Task function streaming the recorded events
+         * @param args - pointer to the Tracer
+         */
+        static void drain_runner(void* args);
+
+        /**
+         * @brief Writes the names of the trace points and tasks
+         */
+        void write_names();
+
+        /**
+         * @brief Writes the events queued in the ring of a core
+         * @param core - the core
+         * @returns True if events were written
+         */
+        bool write_events(int core);
+
+        Log_Ring<trace_event, TRACE_RING_SIZE> _rings[2];
+        uint32_t _dropped[2] = {0, 0};           // counts already streamed
+        hal_task_t _tasks[TRACE_MAX_TASKS] = {};
+        const char* _task_names[TRACE_MAX_TASKS] = {};
+        hal_task_t _drain = nullptr;
+        std::atomic<bool> _running{false};
+        std::atomic<bool> _names_pending{false};
+};
+
+/**
+ * @brief Records a begin event when constructed and an end event when destroyed
+ */
+class Trace_Scope
+{
+    public:
+        Trace_Scope(const Trace_Point& point);
+        ~Trace_Scope();
+
+    private:
+        const Trace_Point& _point;
+};
+
+/**
+ * @brief Records a begin event when constructed and an end event when destroyed, in an interrupt handler
+ */
+class Trace_ISR_Scope
+{
+    public:
+        inline __attribute__((always_inline)) Trace_ISR_Scope(const Trace_Point& point);
+        inline __attribute__((always_inline)) ~Trace_ISR_Scope();
+
+    private:
+        const Trace_Point& _point;
+};
+
+/**
+ * @brief Global instance tracing the firmware
+ */
+extern Tracer Trace;
+
+inline Trace_ISR_Scope::Trace_ISR_Scope(const Trace_Point& point) : _point(point) { Trace.record_isr(point, TRACE_BEGIN); }
+inline Trace_ISR_Scope::~Trace_ISR_Scope() { Trace.record_isr(_point, TRACE_END); }
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#if TRACE_ENABLED
+#define TRACE_POINT(var, name) static Trace_Point var(name)
+#define TRACE_SCOPE(var) Trace_Scope TRACE_CONCAT(trace_scope_, __LINE__)(var)
+#define TRACE_ISR_SCOPE(var) Trace_ISR_Scope TRACE_CONCAT(trace_scope_, __LINE__)(var)
+#define TRACE_ENTER(var) Trace.record(var, TRACE_BEGIN)
+#define TRACE_LEAVE(var) Trace.record(var, TRACE_END)
+#define TRACE_INSTANT_EVENT(var) Trace.record(var, TRACE_INSTANT)
+#define TRACE_ISR_INSTANT_EVENT(var) Trace.record_isr(var, TRACE_INSTANT)
+#else
+#define TRACE_POINT(var, name) static_assert(true, "")
+#define TRACE_SCOPE(var) do {} while(0)
+#define TRACE_ISR_SCOPE(var) do {} while(0)
+#define TRACE_ENTER(var) do {} while(0)
+#define TRACE_LEAVE(var) do {} while(0)
+#define TRACE_INSTANT_EVENT(var) do {} while(0)
+#define TRACE_ISR_INSTANT_EVENT(var) do {} while(0)
+#endif
+
+#endif
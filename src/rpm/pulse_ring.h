@@ -0,0 +1,85 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _PULSE_RING_H_
+#define _PULSE_RING_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * @brief Fixed capacity single-producer/single-consumer ring of pulse timestamps.
+ * @details The producer (an ISR) writes the slot and then publishes it by advancing a monotonic head index,
+ * which is O(1) and needs no critical section. The oldest entries are overwritten when the ring is full.
+ * The consumer copies the newest entries and re-reads the head afterwards. If the producer advanced far enough
+ * to have touched one of the copied slots, the copy is discarded and retried, so the consumer always
+ * gets a consistent snapshot without locking out the producer.
+ * @tparam N - ring capacity, must be a power of two and larger than the snapshots taken
+ */
+template<size_t N>
+class Pulse_Ring
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Pulse_Ring capacity must be a power of two");
+
+    public:
+        /**
+         * @brief Appends a timestamp. Must only be called from a single producer.
+         * @param timestamp - the timestamp to append
+         */
+        inline __attribute__((always_inline)) void push(uint64_t timestamp)
+        {
+            uint32_t h = _head.load(std::memory_order_relaxed);
+            _slots[h & (N - 1)] = timestamp;
+            _head.store(h + 1, std::memory_order_release);
+                // publish the slot only after it has been written
+        }
+
+        /**
+         * @brief Gets the number of timestamps pushed since construction.
+         * @returns The monotonic head index
+         */
+        inline uint32_t head() const
+        {
+            return _head.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief Copies the newest timestamps, oldest first. Must only be called from a single consumer.
+         * @param out - buffer receiving the timestamps
+         * @param max - maximum number of timestamps to copy, must be smaller than N
+         * @returns The number of timestamps copied
+         */
+        size_t snapshot(uint64_t* out, size_t max) const
+        {
+            for(;;)
+            {
+                uint32_t h1 = _head.load(std::memory_order_acquire);
+                size_t n = h1 < max ? h1 : max;
+                for(size_t i = 0; i < n; i++) out[i] = _slots[(h1 - n + i) & (N - 1)];
+                std::atomic_thread_fence(std::memory_order_acquire);
+                uint32_t h2 = _head.load(std::memory_order_relaxed);
+                if(h2 - h1 < N - n) return n;
+                    // the producer writes slot h2 next, which holds entry h2-N. As long as that entry is older
+                    // than the oldest one we copied, our copy is intact.
+                _retries++;
+            }
+        }
+
+        /**
+         * @brief Gets the number of copies snapshot discarded because the producer overwrote them.
+         * Must only be called from the consumer.
+         * @returns The number of retries
+         */
+        inline uint32_t retries() const
+        {
+            return _retries;
+        }
+
+    private:
+        uint64_t _slots[N];
+        std::atomic<uint32_t> _head{0};
+        mutable uint32_t _retries = 0;     // only touched by the consumer
+};
+
+#endif
@@ -0,0 +1,157 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "rpm_estimator.h"
+
+#define Q8(x) ((int32_t)(x) << 8)
+#define Q16_MUL(a, q16) ((int32_t)(((int64_t)(a) * (q16)) >> 16))
+
+/**
+ * @brief Creates a new instance of RPM_Estimator
+ * @param filter - the initial filter
+ */
+RPM_Estimator::RPM_Estimator(rpm_filter filter) : _filter(filter), _requested(filter)
+{
+    reset();
+}
+
+/**
+ * @brief Gets the active filter
+ * @returns The filter
+ */
+rpm_filter RPM_Estimator::get_filter()
+{
+    return _requested;
+}
+
+/**
+ * @brief Selects the filter. Takes effect on the next update.
+ * @param filter - the filter to use
+ */
+void RPM_Estimator::set_filter(rpm_filter filter)
+{
+    if(filter >= RPM_FILTER_COUNT) return;
+    _requested = filter;
+}
+
+/**
+ * @brief Sets the minimum change of the estimate before the output follows
+ * @param delta - the hysteresis in RPM
+ */
+void RPM_Estimator::set_min_delta(unsigned int delta)
+{
+    _min_delta = delta;
+}
+
+/**
+ * @brief Discards the filter state
+ */
+void RPM_Estimator::reset()
+{
+    for(int i = 0; i < RPM_FILTER_WINDOW; i++) _history[i] = 0;
+    _sum = 0;
+    _head = 0;
+    _samples = 0;
+    _estimate = 0;
+    _rate = 0;
+    _output = 0;
+}
+
+/**
+ * @brief Feeds a raw RPM sample into the filter. Must be called at a fixed interval.
+ * @param raw - the raw RPM, 0 if the spindle stands still
+ * @returns The filtered RPM
+ */
+unsigned int RPM_Estimator::update(unsigned int raw)
+{
+    if(_requested != _filter)
+    {
+        _filter = _requested;
+        reset();
+    }
+    if(raw == 0)
+    {
+        // not enough recent pulses, the spindle stands still. Start over once it turns again
+        // so the filters do not ramp up from 0.
+        reset();
+        return 0;
+    }
+
+    int32_t z = Q8(raw < (unsigned int)RPM_ESTIMATOR_MAX ? raw : RPM_ESTIMATOR_MAX);
+    _sum += z - _history[_head];
+    _history[_head] = z;
+    _head = (_head + 1) % RPM_FILTER_WINDOW;
+    if(_samples < RPM_FILTER_WINDOW) _samples++;
+
+    if(_samples == 1)
+    {
+        _estimate = z;
+        _rate = 0;
+    }
+    else switch(_filter)
+    {
+        case RPM_FILTER_MOVING_AVERAGE:
+            _estimate = _sum / _samples;
+            break;
+        case RPM_FILTER_MEDIAN:
+            _estimate = median();
+            break;
+        case RPM_FILTER_EMA:
+            _estimate += Q16_MUL(z - _estimate, RPM_EMA_ALPHA);
+            break;
+        case RPM_FILTER_ALPHA_BETA:
+        {
+            int32_t predicted = _estimate + _rate;
+            int32_t residual = z - predicted;
+            _estimate = predicted + Q16_MUL(residual, RPM_AB_ALPHA);
+            _rate += Q16_MUL(residual, RPM_AB_BETA);
+            if(_estimate < 0) _estimate = 0;
+            break;
+        }
+        default:
+            _estimate = z;
+            break;
+    }
+
+    // Jitter suppression
+    unsigned int rpm = (unsigned int)((_estimate + 0x80) >> 8);
+    if(rpm > _output + _min_delta || rpm + _min_delta < _output) _output = rpm;
+    return _output;
+}
+
+/**
+ * @brief Gets the name of a filter
+ * @param filter - the filter
+ * @returns The name
+ */
+const char* RPM_Estimator::get_filter_name(rpm_filter filter)
+{
+    switch(filter)
+    {
+        case RPM_FILTER_NONE: return "none";
+        case RPM_FILTER_MOVING_AVERAGE: return "average";
+        case RPM_FILTER_MEDIAN: return "median";
+        case RPM_FILTER_EMA: return "ema";
+        case RPM_FILTER_ALPHA_BETA: return "alpha-beta";
+        default: return "unknown";
+    }
+}
+
+/**
+ * @brief Calculates the median of the newest samples in the history
+ * @returns The median in Q8
+ */
+int32_t RPM_Estimator::median()
+{
+    int32_t window[RPM_MEDIAN_WINDOW];
+    int n = _samples < RPM_MEDIAN_WINDOW ? _samples : RPM_MEDIAN_WINDOW;
+    for(int i = 0; i < n; i++)
+    {
+        // insertion sort, the window is tiny
+        int32_t v = _history[(_head + RPM_FILTER_WINDOW - 1 - i) % RPM_FILTER_WINDOW];
+        int j = i;
+        while(j > 0 && window[j - 1] > v) { window[j] = window[j - 1]; j--; }
+        window[j] = v;
+    }
+    return window[n / 2];
+}
@@ -0,0 +1,110 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _RPM_ESTIMATOR_H_
+#define _RPM_ESTIMATOR_H_
+
+#include <stdint.h>
+
+#define RPM_FILTER_WINDOW 8         // History depth of raw RPM samples for the moving average
+#define RPM_MEDIAN_WINDOW 5         // Number of raw RPM samples for the median, must be odd and not larger than RPM_FILTER_WINDOW
+#define RPM_EMA_ALPHA 16384         // EMA smoothing factor in Q16 (0.25), closer to 0 gives a smoother RPM evolution,
+                                    // closer to 65536 is more responsive but also more jittery
+#define RPM_AB_ALPHA 19661          // Alpha-beta position gain in Q16 (0.3)
+#define RPM_AB_BETA 1311            // Alpha-beta rate gain in Q16 (0.02)
+#define MIN_RPM_DELTA 10            // Minimum change to update display
+#define RPM_ESTIMATOR_MAX (INT32_MAX / 256 / RPM_FILTER_WINDOW)
+                                    // Largest raw RPM the filters take, larger samples (phantom pulses) are clamped,
+                                    // so the Q8 sum of the window fits in 32 bits
+#ifndef RPM_FILTER_DEFAULT
+#define RPM_FILTER_DEFAULT RPM_FILTER_NONE
+                                    // Filter at start up, select another one with the filter command
+#endif
+
+/**
+ * @brief The filters the estimator can apply to the raw RPM
+ */
+enum rpm_filter {
+    RPM_FILTER_NONE,                // raw RPM, only the MIN_RPM_DELTA hysteresis is applied
+    RPM_FILTER_MOVING_AVERAGE,      // average over the last RPM_FILTER_WINDOW samples
+    RPM_FILTER_MEDIAN,              // median of the last RPM_MEDIAN_WINDOW samples, rejects single sample spikes
+    RPM_FILTER_EMA,                 // exponential moving average with RPM_EMA_ALPHA
+    RPM_FILTER_ALPHA_BETA,          // alpha-beta tracker, follows ramps without the lag of the averaging filters
+    RPM_FILTER_COUNT
+};
+
+/**
+ * @brief Filters the raw RPM calculated by an RPM_Source
+ * @details All math is in Q8 fixed point on preallocated state, so an update costs no float operations
+ * and no allocation. The filter can be changed at runtime from any task, the change is applied on the next
+ * update and restarts the filter from the current raw value.
+ */
+class RPM_Estimator
+{
+    public:
+        /**
+         * @brief Creates a new instance of RPM_Estimator
+         * @param filter - the initial filter
+         */
+        RPM_Estimator(rpm_filter filter = RPM_FILTER_DEFAULT);
+
+        /**
+         * @brief Gets the active filter
+         * @returns The filter
+         */
+        rpm_filter get_filter();
+
+        /**
+         * @brief Selects the filter. Takes effect on the next update.
+         * @param filter - the filter to use
+         */
+        void set_filter(rpm_filter filter);
+
+        /**
+         * @brief Sets the minimum change of the estimate before the output follows
+         * @param delta - the hysteresis in RPM
+         */
+        void set_min_delta(unsigned int delta);
+
+        /**
+         * @brief Discards the filter state
+         */
+        void reset();
+
+        /**
+         * @brief Feeds a raw RPM sample into the filter. Must be called at a fixed interval.
+         * @param raw - the raw RPM, 0 if the spindle stands still
+         * @returns The filtered RPM
+         */
+        unsigned int update(unsigned int raw);
+
+        /**
+         * @brief Gets the name of a filter
+         * @param filter - the filter
+         * @returns The name
+         */
+        static const char* get_filter_name(rpm_filter filter);
+
+    protected:
+        /**
+         * @brief Calculates the median of the newest samples in the history
+         * @returns The median in Q8
+         */
+        int32_t median();
+
+    private:
+        volatile rpm_filter _filter;
+        volatile rpm_filter _requested;
+        volatile unsigned int _min_delta = MIN_RPM_DELTA;
+
+        int32_t _history[RPM_FILTER_WINDOW];
+        int32_t _sum = 0;
+        uint8_t _head = 0;
+        uint8_t _samples = 0;
+
+        int32_t _estimate = 0;       // Q8 RPM
+        int32_t _rate = 0;           // Q8 RPM per update, only used by the alpha-beta tracker
+        unsigned int _output = 0;
+};
+
+#endif
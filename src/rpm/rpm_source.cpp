@@ -0,0 +1,496 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <Arduino.h>
+#include "rpm_source.h"
+#include "../logging/log.h"
+#include "../metrics/metrics.h"
+#include "../metrics/trace.h"
+#ifdef ARDUINO
+extern "C" {
+  #include <driver/timer.h>
+  #include <driver/pcnt.h>
+  #include <driver/mcpwm.h>
+  #include <soc/gpio_struct.h>
+}
+#endif
+
+static Log2_Histogram hall_latency("hallLatency", "us");
+    // from the polling timer alarm to the entry of the handler
+static Log2_Histogram hall_duration("hallDuration", "cycles");
+static Log2_Histogram hall_interval("hallInterval", "us");
+    // between accepted edges, phantom pulses show up as short intervals
+static ISR_Metric hall_isr("hallISR", &hall_duration);
+    // whichever of the handlers below the acquisition mode uses
+TRACE_POINT(trace_hall_isr, "hallISR");
+TRACE_POINT(trace_hall_edge, "hallEdge");
+    // the polling handler runs every HALL_POLLING_INTERVAL_US, far more often than the trace can stream, so it
+    // only marks the edges it accepts
+
+/**
+ * @brief Registers the hall sensor metrics
+ * @param latency - true if the handler measures its latency
+ */
+static void add_hall_metrics(bool latency)
+{
+    Metrics.add_isr(&hall_isr);
+    Metrics.add_histogram(&hall_duration);
+    Metrics.add_histogram(&hall_interval);
+    if(latency) Metrics.add_histogram(&hall_latency);
+}
+
+/**
+ * @brief Removes the hall sensor metrics
+ */
+static void remove_hall_metrics()
+{
+    Metrics.remove_isr(&hall_isr);
+    Metrics.remove_histogram(&hall_duration);
+    Metrics.remove_histogram(&hall_interval);
+    Metrics.remove_histogram(&hall_latency);
+}
+
+/**
+ * @brief Records the interval to the previous accepted edge. Called from the handlers.
+ * @param t - the time of the edge in us
+ * @param previous - the time of the previous edge, 0 if there is none
+ */
+static inline __attribute__((always_inline)) void record_hall_interval(uint64_t t, uint64_t previous)
+{
+    if(previous == 0) return;
+    uint64_t interval = t - previous;
+    hall_interval.record(interval > UINT32_MAX ? UINT32_MAX : (uint32_t)interval);
+}
+
+/**
+ * @brief Creates the RPM source for an acquisition mode
+ * @param mode - one of RPM_SOURCE_POLLING, RPM_SOURCE_INTERRUPT, RPM_SOURCE_PCNT or RPM_SOURCE_CAPTURE
+ * @param pin - the pin the hall sensor is connected to
+ * @returns The new source. The source is not started yet.
+ */
+RPM_Source* RPM_Source::create(uint8_t mode, uint8_t pin)
+{
+    switch(mode)
+    {
+        case RPM_SOURCE_INTERRUPT: return new Interrupt_RPM_Source(pin);
+        case RPM_SOURCE_PCNT: return new PCNT_RPM_Source(pin);
+        case RPM_SOURCE_CAPTURE: return new Capture_RPM_Source(pin);
+#ifdef ARDUINO
+        default: return new Polling_RPM_Source(pin);
+#else
+        default: return new Interrupt_RPM_Source(pin);
+            // no stand-in for the sample timer
+#endif
+    }
+}
+
+#pragma region Pulse_History_Source
+/**
+ * @brief Gets the number of pulses acquired since begin
+ * @returns The number of pulses
+ */
+uint32_t Pulse_History_Source::get_pulse_count()
+{
+    return _pulses.head();
+}
+
+/**
+ * @brief Calculates the raw RPM from the average period of the recent pulses
+ * @returns The RPM, 0 if there are not enough recent pulses
+ */
+unsigned int Pulse_History_Source::get_rpm()
+{
+    uint64_t pulse_times[MAX_RPM_PULSES];
+    int count = _pulses.snapshot(pulse_times, MAX_RPM_PULSES);
+        // consistent copy of the newest pulses, the ISR keeps running while we read
+    return calculate_rpm(pulse_times, count, now(), _ticks_per_us);
+}
+
+/**
+ * @brief Calculates the raw RPM from pulse timestamps as get_rpm does, pulses older than MAX_RPM_AGE_US
+ * are ignored
+ * @param pulse_times - the newest pulse timestamps, oldest first
+ * @param count - the number of timestamps
+ * @param t - the current time in us
+ * @param ticks_per_us - the resolution of the timestamps
+ * @returns The RPM, 0 if there are not enough recent pulses
+ */
+unsigned int Pulse_History_Source::calculate_rpm(const uint64_t* pulse_times, int count, uint64_t t, uint32_t ticks_per_us)
+{
+    if (count < 2) return 0;
+        // we need at least two pulses to calculate RPMs.
+
+    // Filter out timestamps older than MAX_RPM_AGE_US
+    uint64_t newest = pulse_times[count - 1];
+    uint64_t last = newest / ticks_per_us;
+        // the ticks count from the origin of the counter timer
+    uint64_t newest_age = t > last ? t - last : 0;
+    if (newest_age > MAX_RPM_AGE_US) return 0;
+    int first = count - 1;
+    while (first > 0 && newest_age + (newest - pulse_times[first - 1]) / ticks_per_us <= MAX_RPM_AGE_US) first--;
+    int periods = count - 1 - first;
+    if (periods < 1) return 0;
+        // we need at least two pulses to calculate RPMs.
+
+    // the sum of the deltas between subsequent pulses is the span between the oldest and the newest pulse
+    return (uint64_t)60000000ULL * ticks_per_us * periods / (newest - pulse_times[first]);
+}
+#pragma endregion
+
+#ifdef ARDUINO
+#pragma region Polling_RPM_Source
+/**
+ * @brief Starts the sample timer
+ */
+void Polling_RPM_Source::begin()
+{
+    LOG_INFO(RPM, "     Not using interrupt for RPM sensing. Instead create RPM sample timer");
+    timer_config_t rpm_config =
+    {
+        .alarm_en = TIMER_ALARM_EN,
+        .counter_en = TIMER_PAUSE,
+        .counter_dir = TIMER_COUNT_UP,
+        .auto_reload = TIMER_AUTORELOAD_EN,
+        .divider = TIMER_DIVIDER,
+    };
+    timer_init(TIMER_GROUP, TIMER_RPM, &rpm_config);
+    timer_set_counter_value(TIMER_GROUP, TIMER_RPM, 0);
+    timer_set_alarm_value(TIMER_GROUP, TIMER_RPM, HALL_POLLING_INTERVAL_US);
+    timer_enable_intr(TIMER_GROUP, TIMER_RPM);
+    timer_isr_callback_add(TIMER_GROUP, TIMER_RPM, Polling_RPM_Source::read_hall_sensor, this, ESP_INTR_FLAG_IRAM);
+    timer_start(TIMER_GROUP, TIMER_RPM);
+    add_hall_metrics(true);
+}
+
+/**
+ * @brief Stops the sample timer
+ */
+void Polling_RPM_Source::end()
+{
+    LOG_INFO(RPM, "     Remove RPM timer");
+    remove_hall_metrics();
+    timer_pause(TIMER_GROUP, TIMER_RPM);
+    timer_disable_intr(TIMER_GROUP, TIMER_RPM);
+    timer_isr_callback_remove(TIMER_GROUP, TIMER_RPM);
+    timer_set_counter_value(TIMER_GROUP, TIMER_RPM, 0);
+    timer_set_alarm_value(TIMER_GROUP, TIMER_RPM, 0);
+}
+
+/**
+ * @brief Interrupt handler to read the State of the Hall sensor to measure Motor RPM
+ *
+ * @param arg pointer to class instance context (this)
+ */
+bool IRAM_ATTR Polling_RPM_Source::read_hall_sensor(void *arg)
+{
+    ISR_Probe probe(hall_isr);
+    hall_latency.record((uint32_t)timer_group_get_counter_value_in_isr(TIMER_GROUP, TIMER_RPM));
+        // the counter restarts at the alarm, so it holds the timer ticks (us) since then
+    static byte reg = 0x0;
+    static bool last_stable_state = 1;
+    static uint64_t last_edge = 0;
+
+    // hall sensor will read logical 1 until the magnet gets close to the sensor, when it
+    // switches to logical 0. So it is equivalent to a normally closed switch. So will
+    // monitor for a stable low signal while our state is high.
+
+    Polling_RPM_Source* _this = reinterpret_cast<Polling_RPM_Source *>(arg);
+    timer_group_clr_intr_status_in_isr(TIMER_GROUP, TIMER_RPM);
+                                                // clear the timer interrupt to allow for subsequent processing
+    bool val = 0;
+    if(_this->_pin < 32) val = (GPIO.in >> _this->_pin) & 0x1;
+    else if (_this->_pin < 40) val = (GPIO.in1.data >> (_this->_pin - 32)) & 0x1;
+    else val = 0;
+
+    reg = ((reg << 1) | (val ? 1 : 0)) & 0x07;  // Shift in current value, keep last 3 bits
+    bool stable_state = (reg == 0x07) ? 1 : (reg == 0x00) ? 0 : last_stable_state;
+                                                // Determine stable state from 3-sample debounce
+
+    // Detect falling edge: HIGH → LOW
+    if (last_stable_state == 1 && stable_state == 0)
+    {
+        uint64_t t = now();
+        _this->_pulses.push(t);
+            // O(1) and lock free, the ring overwrites the oldest pulse once full
+        record_hall_interval(t, last_edge);
+        last_edge = t;
+        TRACE_ISR_INSTANT_EVENT(trace_hall_edge);
+    }
+    last_stable_state = stable_state;
+    return false;
+}
+#pragma endregion
+#endif
+
+#pragma region Interrupt_RPM_Source
+/**
+ * @brief Attaches the interrupt handler
+ */
+void Interrupt_RPM_Source::begin()
+{
+    LOG_INFO(RPM, "     Register Interrupt Handler for Hall Sensor on pin %i", _pin);
+    hal_gpio_attach(_pin, HAL_EDGE_FALLING, Interrupt_RPM_Source::handle_spindle_pulse, this);
+    add_hall_metrics(false);
+}
+
+/**
+ * @brief Detaches the interrupt handler
+ */
+void Interrupt_RPM_Source::end()
+{
+    LOG_INFO(RPM, "     Remove RPM hall sensor interrupt");
+    remove_hall_metrics();
+    hal_gpio_detach(_pin);
+}
+
+/**
+ * @brief Event handler monitoring the Spindle Pulse
+ * @param arg - pointer to class instance context (this)
+ */
+void IRAM_ATTR Interrupt_RPM_Source::handle_spindle_pulse(void* arg)
+{
+    ISR_Probe probe(hall_isr);
+    TRACE_ISR_SCOPE(trace_hall_isr);
+    Interrupt_RPM_Source* _this = reinterpret_cast<Interrupt_RPM_Source *>(arg);
+    uint64_t t = now();
+    if(t - _this->_last_edge > HALL_DEBOUNCE_DELAY_US)
+    {
+        record_hall_interval(t, _this->_last_edge);
+        _this->_last_edge = t;
+        _this->_pulses.push(t);
+    }
+}
+#pragma endregion
+
+#pragma region Capture_RPM_Source
+/**
+ * @brief Routes the pin to the capture unit and enables the capture channel
+ */
+void Capture_RPM_Source::begin()
+{
+#ifdef ARDUINO
+    LOG_INFO(RPM, "     Capture Hall Sensor edges on pin %i in MCPWM unit %i", _pin, CAPTURE_RPM_UNIT);
+    mcpwm_gpio_init(CAPTURE_RPM_UNIT, MCPWM_CAP_0, _pin);
+    mcpwm_capture_config_t config;
+    config.cap_edge = MCPWM_NEG_EDGE;
+        // the hall sensor pulls low when the magnet passes, so we capture falling edges only
+    config.cap_prescale = 1;
+    config.capture_cb = Capture_RPM_Source::handle_capture;
+    config.user_data = this;
+    mcpwm_capture_enable_channel(CAPTURE_RPM_UNIT, MCPWM_SELECT_CAP0, &config);
+#else
+    LOG_INFO(RPM, "     Capture Hall Sensor edges on pin %i in the simulated capture unit", _pin);
+    hal_host_gpio_tap(_pin, Capture_RPM_Source::latch_edge, this);
+#endif
+    add_hall_metrics(false);
+}
+
+/**
+ * @brief Disables the capture channel
+ */
+void Capture_RPM_Source::end()
+{
+    LOG_INFO(RPM, "     Disable RPM capture channel");
+    remove_hall_metrics();
+#ifdef ARDUINO
+    mcpwm_capture_disable_channel(CAPTURE_RPM_UNIT, MCPWM_SELECT_CAP0);
+#else
+    hal_host_gpio_untap(_pin, Capture_RPM_Source::latch_edge, this);
+#endif
+}
+
+/**
+ * @brief Extends a latched capture value and pushes it into the pulse history
+ * @param cap_value - the capture timer value latched at the edge
+ */
+inline __attribute__((always_inline)) void Capture_RPM_Source::on_capture(uint32_t cap_value)
+{
+    uint64_t anchor = now() * CAPTURE_TICKS_PER_US;
+        // the counter timer time in capture ticks, late by the interrupt latency
+    uint32_t elapsed = cap_value - _last_capture;
+        // wrap safe as long as edges are less than 53s apart
+    if(_ticks == 0 || anchor > _ticks + (uint64_t)MAX_RPM_AGE_US * CAPTURE_TICKS_PER_US)
+    {
+        // first pulse, or after a long pause the capture value might have wrapped. The previous pulse is too
+        // old to be used anyways, so the count restarts from the counter timer, which keeps the history
+        // monotonic and aligned with the counter timer.
+        _ticks = anchor;
+    }
+    else
+    {
+        if(elapsed < HALL_DEBOUNCE_DELAY_US * CAPTURE_TICKS_PER_US) return;
+            // too close to the previous edge, treat as bounce
+        _ticks += elapsed;
+        hall_interval.record(elapsed / CAPTURE_TICKS_PER_US);
+    }
+    _last_capture = cap_value;
+    _pulses.push(_ticks);
+}
+
+#ifdef ARDUINO
+/**
+ * @brief Capture callback invoked from the MCPWM interrupt for each latched edge
+ * @param mcpwm - the MCPWM unit
+ * @param cap_channel - the capture channel
+ * @param edata - the capture event with the latched timer value
+ * @param user_data - pointer to class instance context (this)
+ * @returns True if a higher priority task was woken
+ */
+bool IRAM_ATTR Capture_RPM_Source::handle_capture(mcpwm_unit_t mcpwm, mcpwm_capture_channel_id_t cap_channel, const cap_event_data_t *edata, void *user_data)
+{
+    ISR_Probe probe(hall_isr);
+    TRACE_ISR_SCOPE(trace_hall_isr);
+    Capture_RPM_Source* _this = reinterpret_cast<Capture_RPM_Source *>(user_data);
+    _this->on_capture(edata->cap_value);
+    return false;
+}
+#else
+/**
+ * @brief Stands in for the capture unit, latches the time of the falling edges on the pin
+ * @param level - the new level of the pin
+ * @param at - the time of the change in us
+ * @param arg - pointer to class instance context (this)
+ */
+void Capture_RPM_Source::latch_edge(bool level, uint64_t at, void* arg)
+{
+    if(level) return;
+    ISR_Probe probe(hall_isr);
+    TRACE_ISR_SCOPE(trace_hall_isr);
+    Capture_RPM_Source* _this = reinterpret_cast<Capture_RPM_Source *>(arg);
+    _this->on_capture((uint32_t)(at * CAPTURE_TICKS_PER_US));
+        // the capture timer runs from begin, at the resolution of the simulated time
+}
+#endif
+#pragma endregion
+
+#pragma region PCNT_RPM_Source
+/**
+ * @brief Configures and starts the pulse counter
+ */
+void PCNT_RPM_Source::begin()
+{
+#ifdef ARDUINO
+    LOG_INFO(RPM, "     Count Hall Sensor pulses on pin %i in pulse counter unit %i", _pin, PCNT_RPM_UNIT);
+    pcnt_config_t config;
+    config.pulse_gpio_num = _pin;
+    config.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+    config.lctrl_mode = PCNT_MODE_KEEP;
+    config.hctrl_mode = PCNT_MODE_KEEP;
+    config.pos_mode = PCNT_COUNT_DIS;
+    config.neg_mode = PCNT_COUNT_INC;
+        // the hall sensor pulls low when the magnet passes, so we count falling edges only
+    config.counter_h_lim = PCNT_RPM_H_LIM;
+    config.counter_l_lim = 0;
+    config.unit = PCNT_RPM_UNIT;
+    config.channel = PCNT_CHANNEL_0;
+    pcnt_unit_config(&config);
+    pcnt_set_filter_value(PCNT_RPM_UNIT, PCNT_RPM_FILTER);
+    pcnt_filter_enable(PCNT_RPM_UNIT);
+
+    pcnt_counter_pause(PCNT_RPM_UNIT);
+    pcnt_counter_clear(PCNT_RPM_UNIT);
+    _count = 0;
+    _last_raw = 0;
+    _sample_head = 0;
+    pcnt_counter_resume(PCNT_RPM_UNIT);
+#else
+    LOG_INFO(RPM, "     Count Hall Sensor pulses on pin %i in the simulated pulse counter", _pin);
+    _host_counter = 0;
+    _count = 0;
+    _last_raw = 0;
+    _sample_head = 0;
+    hal_host_gpio_tap(_pin, PCNT_RPM_Source::count_edge, this);
+#endif
+}
+
+/**
+ * @brief Stops the pulse counter
+ */
+void PCNT_RPM_Source::end()
+{
+    LOG_INFO(RPM, "     Stop RPM pulse counter");
+#ifdef ARDUINO
+    pcnt_counter_pause(PCNT_RPM_UNIT);
+    pcnt_filter_disable(PCNT_RPM_UNIT);
+#else
+    hal_host_gpio_untap(_pin, PCNT_RPM_Source::count_edge, this);
+#endif
+}
+
+/**
+ * @brief Gets the number of pulses acquired since begin. The count is updated by get_rpm.
+ * @returns The number of pulses
+ */
+uint32_t PCNT_RPM_Source::get_pulse_count()
+{
+    return _count;
+}
+
+/**
+ * @brief Calculates the raw RPM from the count delta over the recent count changes
+ * @returns The RPM, 0 if there are not enough recent pulses
+ */
+unsigned int PCNT_RPM_Source::get_rpm()
+{
+    int16_t raw = 0;
+    uint64_t t = now();
+#ifdef ARDUINO
+    pcnt_get_counter_value(PCNT_RPM_UNIT, &raw);
+#else
+    raw = _host_counter;
+#endif
+
+    // accumulate into a 32 bit count, the hardware counter resets to 0 when reaching the limit
+    int32_t delta = raw - _last_raw;
+    if(delta < 0) delta += PCNT_RPM_H_LIM;
+    _last_raw = raw;
+    if(delta > 0)
+    {
+        _count += delta;
+        count_sample& sample = _samples[_sample_head++ % PCNT_RPM_SAMPLES];
+        sample.time = t;
+        sample.count = _count;
+    }
+
+    // find the oldest count change within MAX_RPM_AGE_US
+    uint32_t available = _sample_head < PCNT_RPM_SAMPLES ? _sample_head : PCNT_RPM_SAMPLES;
+    if(available < 2) return 0;
+    const count_sample& newest = _samples[(_sample_head - 1) % PCNT_RPM_SAMPLES];
+    if(t - newest.time > MAX_RPM_AGE_US) return 0;
+    const count_sample* oldest = &newest;
+    for(uint32_t i = 2; i <= available; i++)
+    {
+        const count_sample& s = _samples[(_sample_head - i) % PCNT_RPM_SAMPLES];
+        if(t - s.time > MAX_RPM_AGE_US) break;
+        oldest = &s;
+    }
+    if(oldest == &newest) return 0;
+        // we need at least two count changes to calculate RPMs.
+
+    return (uint64_t)(newest.count - oldest->count) * 60000000ULL / (newest.time - oldest->time);
+}
+
+#ifndef ARDUINO
+/**
+ * @brief Stands in for the pulse counter, counts the falling edges on the pin. Like the glitch filter, it drops
+ * falling edges after a high level shorter than PCNT_RPM_FILTER, and like the counter, it resets to 0 when
+ * reaching PCNT_RPM_H_LIM.
+ * @param level - the new level of the pin
+ * @param at - the time of the change in us
+ * @param arg - pointer to class instance context (this)
+ */
+void PCNT_RPM_Source::count_edge(bool level, uint64_t at, void* arg)
+{
+    PCNT_RPM_Source* _this = reinterpret_cast<PCNT_RPM_Source *>(arg);
+    if(level)
+    {
+        _this->_host_high_at = at;
+        return;
+    }
+    if((at - _this->_host_high_at) * 80 < PCNT_RPM_FILTER) return;
+        // the filter counts APB cycles, 80 per us
+    int16_t counter = _this->_host_counter + 1;
+    _this->_host_counter = counter >= PCNT_RPM_H_LIM ? 0 : counter;
+}
+#endif
+#pragma endregion
@@ -0,0 +1,367 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _RPM_SOURCE_H_
+#define _RPM_SOURCE_H_
+
+#include <Arduino.h>
+#include "pulse_ring.h"
+#include "../hal/hal.h"
+#ifdef ARDUINO
+extern "C" {
+  #include <driver/timer.h>
+  #include <driver/pcnt.h>
+  #include <driver/mcpwm.h>
+}
+
+#define TIMER_GROUP    HAL_TIMER_GROUP
+#define TIMER_RPM      TIMER_0
+#define TIMER_DIVIDER  HAL_TIMER_DIVIDER
+    // 80 MHz / 80 = 1 MHz → 1 tick = 1 µs
+#endif
+
+#define RPM_SOURCE_POLLING 0
+#define RPM_SOURCE_INTERRUPT 1
+#define RPM_SOURCE_PCNT 2
+#define RPM_SOURCE_CAPTURE 3
+
+#define HALL_DEBOUNCE_DELAY_US 10
+#define HALL_POLLING_INTERVAL_US 25
+#ifndef RPM_ACQUISITION_MODE
+#define RPM_ACQUISITION_MODE RPM_SOURCE_POLLING
+    // this define controls how we acquire the hall sensor pulses for RPM measurement:
+    //   RPM_SOURCE_POLLING   - sample the pin on a timer every HALL_POLLING_INTERVAL_US with a 3 sample debounce
+    //   RPM_SOURCE_INTERRUPT - timestamp falling edges in a GPIO interrupt
+    //   RPM_SOURCE_PCNT      - count falling edges in the pulse counter peripheral behind its glitch filter
+    //   RPM_SOURCE_CAPTURE   - latch falling edge times in the MCPWM capture unit at APB clock resolution
+    // while interrupt drive is preferable, there seem to be a lot of phantom interrupts on low RPMs
+    // probably because the slow takeup edge on the hall. We might be able to reduce the capacitor
+    // from the Hall input to ground to steepen the edge, but it is more likely a function of the slow
+    // increase of the magnetic field on low RPMs (on higher RPMs, the edge is sharp).
+    // see also https://github.com/espressif/arduino-esp32/issues/4172 and
+    // https://github.com/espressif/esp-idf/issues/7602 for addtional discussion.
+    // The pulse counter filters glitches in hardware and costs no interrupts at all, but it only
+    // resolves edge times to the RPM calculation interval. The capture unit latches the edge time in hardware,
+    // so ISR latency does not leak into the measured periods.
+    // Off target, the pulse counter and the capture unit are simulated on the pin (see hal_host_gpio_tap), and
+    // RPM_SOURCE_POLLING falls back to RPM_SOURCE_INTERRUPT.
+#endif
+
+#define MAX_RPM_PULSES 12       // History depth for RPM measurement, should be between 8 and 12
+#define PULSE_RING_SIZE 16      // Capacity of the pulse timestamp ring, power of two larger than MAX_RPM_PULSES
+#define MAX_RPM_AGE_US 1000000  // Max age of pulse timestamps to consider in us, 6-10sec
+
+#define PCNT_RPM_UNIT PCNT_UNIT_0         // ESP32 only
+#define PCNT_RPM_FILTER 1023    // Glitch filter in APB cycles (12.8us at 80MHz), 1023 is the hardware maximum
+#define PCNT_RPM_H_LIM 32767    // Counter limit, the counter resets to 0 when reaching it
+#define PCNT_RPM_SAMPLES 64     // History depth of count changes for the pulse counter
+
+#define CAPTURE_RPM_UNIT MCPWM_UNIT_0     // ESP32 only
+#define CAPTURE_TICKS_PER_US 80 // The capture timer runs on the 80MHz APB clock
+
+/**
+ * @brief Acquires the spindle pulses and calculates the raw (unfiltered) RPM from them
+ */
+class RPM_Source
+{
+    public:
+        /**
+         * @brief Creates the RPM source for an acquisition mode
+         * @param mode - one of RPM_SOURCE_POLLING, RPM_SOURCE_INTERRUPT, RPM_SOURCE_PCNT or RPM_SOURCE_CAPTURE
+         * @param pin - the pin the hall sensor is connected to
+         * @returns The new source. The source is not started yet.
+         */
+        static RPM_Source* create(uint8_t mode, uint8_t pin);
+
+        /**
+         * @brief Cleans up resources used by class
+         */
+        virtual ~RPM_Source() {}
+
+        /**
+         * @brief Starts acquiring pulses
+         */
+        virtual void begin() = 0;
+
+        /**
+         * @brief Stops acquiring pulses
+         */
+        virtual void end() = 0;
+
+        /**
+         * @brief Gets the number of pulses acquired since begin
+         * @returns The number of pulses
+         */
+        virtual uint32_t get_pulse_count() = 0;
+
+        /**
+         * @brief Calculates the raw RPM from the acquired pulses
+         * @returns The RPM, 0 if there are not enough recent pulses
+         */
+        virtual unsigned int get_rpm() = 0;
+
+    protected:
+        /**
+         * @brief Creates a new instance of RPM_Source
+         * @param pin - the pin the hall sensor is connected to
+         */
+        RPM_Source(uint8_t pin) : _pin(pin) {}
+
+        /**
+         * @brief Reads the microsecond counter timer
+         * @returns The current time in us
+         */
+        static inline uint64_t IRAM_ATTR now() { return hal_timer_us(); }
+
+        uint8_t _pin;
+};
+
+/**
+ * @brief Base for sources that keep a history of pulse timestamps
+ * @details Timestamps are kept in source specific ticks, which allows sources with a finer time base than the
+ * microsecond counter timer. The ticks count from the origin of the counter timer, so the history is aged
+ * against it without sharing any other state with the interrupt handler.
+ */
+class Pulse_History_Source : public RPM_Source
+{
+    public:
+        /**
+         * @brief Gets the number of pulses acquired since begin
+         * @returns The number of pulses
+         */
+        uint32_t get_pulse_count() override;
+
+        /**
+         * @brief Calculates the raw RPM from the average period of the recent pulses
+         * @returns The RPM, 0 if there are not enough recent pulses
+         */
+        unsigned int get_rpm() override;
+
+        /**
+         * @brief Calculates the raw RPM from pulse timestamps as get_rpm does, pulses older than MAX_RPM_AGE_US
+         * are ignored
+         * @param pulse_times - the newest pulse timestamps, oldest first
+         * @param count - the number of timestamps
+         * @param t - the current time in us
+         * @param ticks_per_us - the resolution of the timestamps
+         * @returns The RPM, 0 if there are not enough recent pulses
+         */
+        static unsigned int calculate_rpm(const uint64_t* pulse_times, int count, uint64_t t, uint32_t ticks_per_us);
+
+        /**
+         * @brief Copies the newest pulse timestamps, oldest first. Must be called from the task calling get_rpm.
+         * @param out - buffer receiving the timestamps, in ticks of get_ticks_per_us
+         * @param max - maximum number of timestamps to copy, must be smaller than PULSE_RING_SIZE
+         * @returns The number of timestamps copied
+         */
+        size_t get_pulses(uint64_t* out, size_t max) const { return _pulses.snapshot(out, max); }
+
+        /**
+         * @brief Gets the resolution of the timestamps
+         * @returns The ticks per us
+         */
+        uint32_t get_ticks_per_us() const { return _ticks_per_us; }
+
+    protected:
+        /**
+         * @brief Creates a new instance of Pulse_History_Source
+         * @param pin - the pin the hall sensor is connected to
+         * @param ticks_per_us - the resolution of the timestamps
+         */
+        Pulse_History_Source(uint8_t pin, uint32_t ticks_per_us = 1) : RPM_Source(pin), _ticks_per_us(ticks_per_us) {}
+
+        Pulse_Ring<PULSE_RING_SIZE> _pulses;
+        uint32_t _ticks_per_us;
+};
+
+#ifdef ARDUINO
+/**
+ * @brief Samples the hall sensor on a timer interrupt
+ */
+class Polling_RPM_Source : public Pulse_History_Source
+{
+    public:
+        /**
+         * @brief Creates a new instance of Polling_RPM_Source
+         * @param pin - the pin the hall sensor is connected to
+         */
+        Polling_RPM_Source(uint8_t pin) : Pulse_History_Source(pin) {}
+
+        /**
+         * @brief Starts the sample timer
+         */
+        void begin() override;
+
+        /**
+         * @brief Stops the sample timer
+         */
+        void end() override;
+
+    protected:
+        /**
+         * @brief Interrupt handler to read the State of the Hall sensor to measure Motor RPM
+         *
+         * @param arg pointer to class instance context (this)
+         */
+        static bool IRAM_ATTR read_hall_sensor(void *arg);
+};
+#endif
+
+/**
+ * @brief Timestamps the hall sensor edges in a GPIO interrupt
+ */
+class Interrupt_RPM_Source : public Pulse_History_Source
+{
+    public:
+        /**
+         * @brief Creates a new instance of Interrupt_RPM_Source
+         * @param pin - the pin the hall sensor is connected to
+         */
+        Interrupt_RPM_Source(uint8_t pin) : Pulse_History_Source(pin) {}
+
+        /**
+         * @brief Attaches the interrupt handler
+         */
+        void begin() override;
+
+        /**
+         * @brief Detaches the interrupt handler
+         */
+        void end() override;
+
+    protected:
+        /**
+         * @brief Event handler monitoring the Spindle Pulse
+         * @param arg - pointer to class instance context (this)
+         */
+        static void IRAM_ATTR handle_spindle_pulse(void* arg);
+
+    private:
+        uint64_t _last_edge = 0;
+};
+
+/**
+ * @brief Latches the hall sensor edge times in the MCPWM capture unit
+ * @details The capture callback extends the 32 bit capture value (wrapping every 53s) into a 64 bit tick count
+ * and pushes it into the pulse history, so the periods are free of interrupt latency jitter. The count starts
+ * from the counter timer at the first pulse and after long pauses, and both run from the APB clock, so it stays
+ * aligned with the counter timer up to the interrupt latency at that pulse. On the workstation,
+ * a stand-in latches the time of the falling edges on the pin.
+ */
+class Capture_RPM_Source : public Pulse_History_Source
+{
+    public:
+        /**
+         * @brief Creates a new instance of Capture_RPM_Source
+         * @param pin - the pin the hall sensor is connected to
+         */
+        Capture_RPM_Source(uint8_t pin) : Pulse_History_Source(pin, CAPTURE_TICKS_PER_US) {}
+
+        /**
+         * @brief Routes the pin to the capture unit and enables the capture channel
+         */
+        void begin() override;
+
+        /**
+         * @brief Disables the capture channel
+         */
+        void end() override;
+
+    protected:
+        /**
+         * @brief Extends a latched capture value and pushes it into the pulse history
+         * @param cap_value - the capture timer value latched at the edge
+         */
+        void on_capture(uint32_t cap_value);
+
+#ifdef ARDUINO
+        /**
+         * @brief Capture callback invoked from the MCPWM interrupt for each latched edge
+         * @param mcpwm - the MCPWM unit
+         * @param cap_channel - the capture channel
+         * @param edata - the capture event with the latched timer value
+         * @param user_data - pointer to class instance context (this)
+         * @returns True if a higher priority task was woken
+         */
+        static bool IRAM_ATTR handle_capture(mcpwm_unit_t mcpwm, mcpwm_capture_channel_id_t cap_channel, const cap_event_data_t *edata, void *user_data);
+#else
+        /**
+         * @brief Stands in for the capture unit, latches the time of the falling edges on the pin
+         * @param level - the new level of the pin
+         * @param at - the time of the change in us
+         * @param arg - pointer to class instance context (this)
+         */
+        static void latch_edge(bool level, uint64_t at, void* arg);
+#endif
+
+    private:
+        uint64_t _ticks = 0;               // only touched by the capture callback
+        uint32_t _last_capture = 0;
+};
+
+/**
+ * @brief Counts the hall sensor edges in the pulse counter peripheral
+ * @details The RPM is calculated from the count delta over time. Each call to get_rpm records the time at
+ * which the count changed, so the edge times are resolved to the interval at which get_rpm is called. On the
+ * workstation, a stand-in counts the falling edges on the pin behind the same glitch filter.
+ */
+class PCNT_RPM_Source : public RPM_Source
+{
+    public:
+        /**
+         * @brief Creates a new instance of PCNT_RPM_Source
+         * @param pin - the pin the hall sensor is connected to
+         */
+        PCNT_RPM_Source(uint8_t pin) : RPM_Source(pin) {}
+
+        /**
+         * @brief Configures and starts the pulse counter
+         */
+        void begin() override;
+
+        /**
+         * @brief Stops the pulse counter
+         */
+        void end() override;
+
+        /**
+         * @brief Gets the number of pulses acquired since begin
+         * @returns The number of pulses
+         */
+        uint32_t get_pulse_count() override;
+
+        /**
+         * @brief Calculates the raw RPM from the count delta over the recent count changes
+         * @returns The RPM, 0 if there are not enough recent pulses
+         */
+        unsigned int get_rpm() override;
+
+    private:
+#ifndef ARDUINO
+        /**
+         * @brief Stands in for the pulse counter, counts the falling edges on the pin
+         * @param level - the new level of the pin
+         * @param at - the time of the change in us
+         * @param arg - pointer to class instance context (this)
+         */
+        static void count_edge(bool level, uint64_t at, void* arg);
+
+        volatile int16_t _host_counter = 0;
+        uint64_t _host_high_at = 0;
+#endif
+
+        /**
+         * @brief Describes the time at which the accumulated count was observed to change
+         */
+        struct count_sample {
+            uint64_t time = 0;
+            uint32_t count = 0;
+        };
+
+        count_sample _samples[PCNT_RPM_SAMPLES];
+        uint32_t _sample_head = 0;
+        uint32_t _count = 0;
+        int16_t _last_raw = 0;
+};
+
+#endif
@@ -0,0 +1,977 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#if defined(LATHE_SIMULATOR) && !defined(ARDUINO)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include "lathe_simulator.h"
+#include "../logging/SerialLogger.h"
+#include "../logging/flight_recorder.h"
+#include "../metrics/metrics.h"
+
+static const uint8_t source_modes[SIM_RPM_SOURCES] = { RPM_SOURCE_INTERRUPT, RPM_SOURCE_PCNT, RPM_SOURCE_CAPTURE };
+static const char* const source_names[SIM_RPM_SOURCES] = { "interrupt", "pcnt", "capture" };
+static const char* const source_errors[SIM_RPM_SOURCES] = { "rpm error interrupt", "rpm error pcnt", "rpm error capture" };
+static const char* const period_error_interrupt = "period ns interrupt";
+static const char* const period_error_capture = "period ns capture";
+
+static std::atomic<uint64_t> heap_ops{0};
+static std::atomic<uint64_t> display_heap_ops{0};
+    // those of the display and the blitter task
+static std::atomic<int64_t> heap_bytes{0};
+static thread_local bool heap_uncounted = false;
+    // set by the threads of the simulator that allocate while the scenario runs, they free on the same thread
+static std::atomic<uint32_t> failures{0};
+    // checks that logged an error, any of them fails the run (exit status 1)
+
+// Counts the heap operations and the bytes in use of all tasks, operator new and delete end up here as well
+// (glibc only)
+extern "C" {
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t count, size_t size);
+    void* __libc_realloc(void* ptr, size_t size);
+    void __libc_free(void* ptr);
+
+    static inline void count_operation()
+    {
+        if(heap_uncounted) return;
+        heap_ops++;
+        const char* task = hal_host_task_name();
+        if(task != nullptr && (strcmp(task, "displayRunner") == 0 || strcmp(task, "blitRunner") == 0)) display_heap_ops++;
+    }
+
+    static inline void* count_allocation(void* ptr)
+    {
+        if(ptr != nullptr && !heap_uncounted) heap_bytes += malloc_usable_size(ptr);
+        return ptr;
+    }
+
+    void* malloc(size_t size) noexcept { count_operation(); return count_allocation(__libc_malloc(size)); }
+    void* calloc(size_t count, size_t size) noexcept { count_operation(); return count_allocation(__libc_calloc(count, size)); }
+    void* realloc(void* ptr, size_t size) noexcept
+    {
+        count_operation();
+        size_t before = ptr != nullptr && !heap_uncounted ? malloc_usable_size(ptr) : 0;
+        void* moved = __libc_realloc(ptr, size);
+        if(moved != nullptr || size == 0) heap_bytes -= before;
+            // on failure the block stays, realloc to 0 frees it
+        return count_allocation(moved);
+    }
+    void free(void* ptr) noexcept
+    {
+        if(ptr == nullptr) return;
+        count_operation();
+        if(!heap_uncounted) heap_bytes -= malloc_usable_size(ptr);
+        __libc_free(ptr);
+    }
+}
+
+/**
+ * @brief Gets the direction icon the display shows for a direction switch position
+ */
+static asset_id for_icon(int position)
+{
+    return position == 1 ? ASSET_FORWARD_ON : position == 2 ? ASSET_BACKWARD_ON : ASSET_NEUTRAL_ON;
+}
+
+/**
+ * @brief Checks whether an address window lies on the RPM scale
+ */
+static bool on_scale(const fb_window& w)
+{
+    const asset_info& first = asset_table[assets_scales_on[0]];
+    const asset_info& last = asset_table[assets_scales_on[SCALE_BARS - 1]];
+    return w.x1 >= first.x && w.x2 < last.x + last.w && w.y1 >= first.y && w.y2 < first.y + first.h;
+}
+
+/**
+ * @brief Checks that a snapshot is one the input task could have published
+ */
+static bool is_consistent(const machine_state& s)
+{
+    if(s.for_f && s.for_b) return false;
+    if(s.for_f) return !s.direction_a.desired && !s.direction_b.desired && s.common.desired;
+    if(s.for_b) return s.direction_a.desired && s.direction_b.desired && s.common.desired;
+    return !s.common.desired;
+}
+
+/**
+ * @brief Logs the status lines input_runner writes on every change
+ * @param logger - the logger
+ * @param i - varies the values
+ * @returns The bytes written, if the logger writes synchronously
+ */
+static size_t log_status(SerialLogger& logger, int i)
+{
+    size_t bytes = logger.Info_f(F("    Direction Relay A: %s"), (i & 1) ? "Reverse" : "Forward");
+    bytes += logger.Info_f(F("Simulator: spindle at %u RPM, controller reads %u RPM"), (unsigned)(i % 3000), (unsigned)(i % 2999));
+    return bytes;
+}
+
+/**
+ * @brief Times SIM_LOG_BENCH_CALLS log calls formatted and written by the caller
+ * @param logger - the logger, not started
+ * @param bytes - receives the bytes written per call
+ * @returns The time per call in ns
+ */
+static uint64_t time_log_calls(SerialLogger& logger, uint64_t& bytes)
+{
+    auto start = std::chrono::steady_clock::now();
+    uint64_t total = 0;
+    for(int i = 0; i < SIM_LOG_BENCH_CALLS; i += 2) total += log_status(logger, i);
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    bytes = total / SIM_LOG_BENCH_CALLS;
+    return ns / SIM_LOG_BENCH_CALLS;
+}
+
+/**
+ * @brief Measures what a log call costs, with the serial console muted: formatted and written by the caller as
+ * text and as binary frames, and queued for the drain task. Then logs a burst of four times the ring size.
+ */
+static void benchmark_logger()
+{
+    typedef std::chrono::steady_clock clock;
+    static SerialLogger logger;
+    Logger.Flush();
+        // the start up messages queued so far would be lost to the muted console
+    hal_host_serial_mute(true);
+
+    uint64_t text_bytes, binary_bytes;
+    logger.SetBinary(false);
+    uint64_t text_ns = time_log_calls(logger, text_bytes);
+    logger.SetBinary(true);
+    uint64_t binary_ns = time_log_calls(logger, binary_bytes);
+
+    logger.Begin();
+    uint64_t async_ns = 0, async_heap_ops = 0;
+    for(int i = 0; i < SIM_LOG_BENCH_CALLS; i += LOGGER_RING_SIZE / 2)
+    {
+        // half a ring at a time, then let the drain task catch up, so nothing is dropped
+        uint64_t heap = heap_ops;
+        auto start = clock::now();
+        for(int k = 0; k < LOGGER_RING_SIZE / 2; k += 2) log_status(logger, i + k);
+        async_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+        async_heap_ops += heap_ops - heap;
+        logger.Flush();
+    }
+    uint32_t dropped = logger.GetDropped();
+
+    for(int i = 0; i < LOGGER_RING_SIZE * 4; i += 2) log_status(logger, i);
+    uint32_t burst_dropped = logger.GetDropped() - dropped;
+    logger.Flush();
+    hal_host_serial_mute(false);
+
+    Logger.Info_f(F("Logger benchmark: text %llu ns/call %llu bytes/call, binary %llu ns/call %llu bytes/call"),
+        (unsigned long long)text_ns, (unsigned long long)text_bytes, (unsigned long long)binary_ns, (unsigned long long)binary_bytes);
+    Logger.Info_f(F("Logger benchmark: %llu ns/call queued (%llu heap ops, %u dropped)"),
+        (unsigned long long)(async_ns / SIM_LOG_BENCH_CALLS), (unsigned long long)async_heap_ops, dropped);
+    Logger.Info_f(F("Logger burst: %u of %u messages dropped with a ring of %u"), burst_dropped, LOGGER_RING_SIZE * 4, LOGGER_RING_SIZE);
+}
+
+static std::string flight_dump;
+
+/**
+ * @brief Collects the dump of the flight recorder check
+ */
+static size_t collect_dump(const char* data, size_t len)
+{
+    flight_dump.append(data, len);
+    return len;
+}
+
+/**
+ * @brief Builds a text frame as the logger writes them
+ * @param frame - receives the frame
+ * @param i - the number of the frame, part of the text
+ * @returns The length of the frame
+ */
+static size_t flight_frame(uint8_t* frame, uint32_t i)
+{
+    size_t n = 0;
+    frame[n++] = LOGGER_FRAME_MAGIC;
+    frame[n++] = 0;
+    frame[n++] = LOG_LEVEL_INFO;
+    frame[n++] = LOG_CAT_NONE;
+    for(int k = 0; k < 4; k++) frame[n++] = 0;
+        // id 0, the text follows
+    for(uint64_t us = hal_timer_us(); ; us >>= 7)
+    {
+        frame[n++] = (uint8_t)(us | (us >= 0x80 ? 0x80 : 0));
+        if(us < 0x80) break;
+    }
+    n += snprintf((char*)frame + n, 64, "Flight recorder check %u", (unsigned)i);
+    frame[1] = (uint8_t)(n - 2);
+    frame[n] = log_crc8(frame + 1, n - 1);
+    return n + 1;
+}
+
+/**
+ * @brief Writes SIM_FLIGHT_LOG_FRAMES frames through a flight recorder on a partition of its own, then reads
+ * them back with a second recorder, as after a reset. Reports the write amplification and the wear per sector.
+ */
+static void exercise_flight_recorder()
+{
+    hal_host_partition_create(SIM_FLIGHT_LOG_PARTITION, FLIGHT_LOG_SIZE);
+    hal_host_flash_stats before = hal_host_flash_statistics(SIM_FLIGHT_LOG_PARTITION);
+    Flight_Recorder recorder(SIM_FLIGHT_LOG_PARTITION);
+    if(!recorder.begin())
+    {
+        Logger.Error(F("Flight recorder check: partition not available"));
+        failures++;
+        return;
+    }
+    uint8_t frame[96];
+    for(uint32_t i = 1; i <= SIM_FLIGHT_LOG_FRAMES; i++)
+    {
+        size_t len = flight_frame(frame, i);
+        recorder.append(frame, len, i % SIM_FLIGHT_LOG_URGENT == 0);
+    }
+    recorder.flush();
+    hal_host_flash_stats stats = hal_host_flash_statistics(SIM_FLIGHT_LOG_PARTITION);
+
+    Flight_Recorder restarted(SIM_FLIGHT_LOG_PARTITION);
+    flight_dump.clear();
+    restarted.begin();
+    restarted.dump(collect_dump);
+    uint32_t frames = 0, first = 0, last = 0;
+    for(size_t pos = 0; pos + 2 < flight_dump.size(); )
+    {
+        const uint8_t* f = (const uint8_t*)flight_dump.data() + pos;
+        size_t len = f[1] + 3;
+        if(f[0] != LOGGER_FRAME_MAGIC || pos + len > flight_dump.size() || log_crc8(f + 1, len - 2) != f[len - 1]) { pos++; continue; }
+        size_t text = 8;
+        while(f[text] & 0x80) text++;
+        std::string message((const char*)f + text + 1, len - text - 2);
+        uint32_t i = (uint32_t)strtoul(message.c_str() + strlen("Flight recorder check "), nullptr, 10);
+        if(frames == 0) first = i;
+        else if(i != last + 1)
+        {
+            Logger.Error_f(F("Flight recorder check: frame %u follows %u"), i, last);
+            failures++;
+        }
+        last = i;
+        frames++;
+        pos += len;
+    }
+
+    Logger.Info_f(F("Flight recorder check: %u frames, %llu bytes, %llu programmed in %u writes, %u erases (%u-%u per sector), %u overwrites"),
+        SIM_FLIGHT_LOG_FRAMES, (unsigned long long)recorder.get_recorded(), (unsigned long long)(stats.programmed - before.programmed),
+        stats.writes - before.writes, stats.erases - before.erases, stats.min_sector_erases, stats.max_sector_erases,
+        stats.overwrites - before.overwrites);
+    Logger.Info_f(F("Flight recorder check: frames %u to %u read back after restart"), first, last);
+    if(last != SIM_FLIGHT_LOG_FRAMES)
+    {
+        Logger.Error(F("Flight recorder check: the newest frames are missing"));
+        failures++;
+    }
+}
+
+/**
+ * @brief Task function erasing the sectors of SIM_FLIGHT_LOG_PARTITION in turn while the scenario runs, so the
+ * interrupt handlers of the controller and the RPM sources fire while the ESP32 would have the flash cache
+ * disabled. The host HAL counts their calls into functions that run from flash on the ESP32.
+ * @param args - unused
+ */
+static void flash_runner(void* args)
+{
+    (void)args;
+    heap_uncounted = true;
+        // the host flash allocates, the firmware does not
+    for(uint32_t sector = 0; ; sector = (sector + 1) % (FLIGHT_LOG_SIZE / HAL_FLASH_SECTOR_SIZE))
+    {
+        hal_partition_erase(SIM_FLIGHT_LOG_PARTITION, sector * HAL_FLASH_SECTOR_SIZE, HAL_FLASH_SECTOR_SIZE);
+        hal_delay_ms(SIM_FLASH_ERASE_MS);
+    }
+}
+
+/**
+ * @brief Renders a sweep of the RPM up the scale and down again, a frame per step, as the display task does
+ * @param display - the display
+ * @param task_us - receives the time per frame in us until the rendering task is done with it
+ * @returns The time per frame in us until it is on the bus
+ */
+static uint64_t time_display_sweep(Controller_Display& display, uint64_t& task_us)
+{
+    uint64_t task = 0, total = 0, frames = 0;
+    for(int step = 0; step <= 2 * SIM_DISPLAY_BENCH_RPM; step += SIM_DISPLAY_BENCH_STEP)
+    {
+        unsigned int rpm = step <= SIM_DISPLAY_BENCH_RPM ? step : 2 * SIM_DISPLAY_BENCH_RPM - step;
+        uint64_t start = hal_timer_us();
+        display.write_rpm(rpm);
+        display.update_scale(rpm);
+        display.render_frame();
+        task += hal_timer_us() - start;
+        display.flush();
+        total += hal_timer_us() - start;
+        frames++;
+    }
+    task_us = task / frames;
+    return total / frames;
+}
+
+/**
+ * @brief Results of the startup display benchmark, printed with the report
+ */
+struct display_benchmark {
+    bool done = false;          // false without an asset pack, nothing is drawn
+    uint64_t frame_bytes = 0;
+    uint64_t queued_us = 0;
+    uint64_t queued_task_us = 0;
+    uint64_t sync_us = 0;
+    uint64_t sync_task_us = 0;
+    uint64_t fill_transactions = 0;
+    uint64_t fill_bytes = 0;
+    uint64_t fill_us = 0;
+    uint64_t pixel_transactions = 0;
+    uint64_t pixel_bytes = 0;
+    uint64_t pixel_us = 0;
+};
+
+static display_benchmark display_bench;
+
+/**
+ * @brief Fills the SIM_FILL_BENCH_W x SIM_FILL_BENCH_H rectangle with fill_rect, or pixel by pixel, column by
+ * column, as fill_rect did before it wrote the color with a single write_pattern
+ * @param display - the display
+ * @param per_pixel - true to draw every pixel on its own
+ * @param transactions - receives the SPI transactions
+ * @param bytes - receives the SPI bytes
+ * @returns The time in us
+ */
+static uint64_t time_fill(Controller_Display& display, bool per_pixel, uint64_t& transactions, uint64_t& bytes)
+{
+    uint64_t start_transactions = hal_host_spi_transactions(), start_bytes = hal_host_spi_bytes();
+    uint64_t start = hal_timer_us();
+    if(!per_pixel) display.fill_rect(0, 0, SIM_FILL_BENCH_W, SIM_FILL_BENCH_H, 0x0);
+    else
+    {
+        for(int16_t x = 0; x < SIM_FILL_BENCH_W; x++)
+            for(int16_t y = 0; y < SIM_FILL_BENCH_H; y++) display.draw_pixel(x, y, 0x0);
+    }
+    uint64_t us = hal_timer_us() - start;
+    transactions = hal_host_spi_transactions() - start_transactions;
+    bytes = hal_host_spi_bytes() - start_bytes;
+    return us;
+}
+
+/**
+ * @brief Measures the frames of an RPM sweep with the bus modeled at SPI_BUS_FREQUENCY, with the blits queued to
+ * the blitter task and written by the rendering task, and the SPI transactions of a filled rectangle. No device
+ * is connected yet, so the bus only counts. Without an asset pack nothing is drawn, so that fails the check.
+ */
+static void benchmark_display()
+{
+    static Controller_Display display;
+    display.init();
+    display.update_background();
+    display.render_frame();
+    display.flush();
+    if(asset_image(ASSET_BACKGROUND_LCARS) == nullptr)
+    {
+        Logger.Error(F("Display benchmark: no asset pack in assets.bin, skipped"));
+        failures++;
+        return;
+    }
+
+    display_benchmark& r = display_bench;
+    r.done = true;
+    uint64_t bytes = hal_host_spi_bytes();
+    r.queued_us = time_display_sweep(display, r.queued_task_us);
+    r.frame_bytes = (hal_host_spi_bytes() - bytes) / (2 * SIM_DISPLAY_BENCH_RPM / SIM_DISPLAY_BENCH_STEP + 1);
+    display.set_blit_queued(false);
+    r.sync_us = time_display_sweep(display, r.sync_task_us);
+    display.set_blit_queued(true);
+
+    r.fill_us = time_fill(display, false, r.fill_transactions, r.fill_bytes);
+    r.pixel_us = time_fill(display, true, r.pixel_transactions, r.pixel_bytes);
+}
+
+/**
+ * @brief Powers up, runs the spindle through a few speeds and exercises every input, including an event
+ * storm on the light switch while the emergency stop is hit. Ends with a sweep over the full scale.
+ */
+const sim_event default_scenario[] = {
+    {    0, SIM_HEAP, 0 },
+    {    0, SIM_POWER, 1 },
+    {  300, SIM_FOR, 1 },
+    {  800, SIM_ENERGIZE, 0 },
+    { 1000, SIM_SPEED, 1200 },
+    { 2500, SIM_CHECK_RPM, 0 },
+    { 2500, SIM_SNAPSHOT, 0 },
+    { 2600, SIM_SPEED, 2500 },
+    { 4000, SIM_CHECK_RPM, 0 },
+    { 4200, SIM_STORM, 300 },
+    { 4300, SIM_EMS, 1 },
+    { 4700, SIM_SNAPSHOT, 0 },
+    { 4800, SIM_EMS, 0 },
+    { 5200, SIM_ENERGIZE, 0 },
+    { 5400, SIM_SPEED, 800 },
+    { 7000, SIM_CHECK_RPM, 0 },
+    { 7100, SIM_OVERLOAD, 0 },
+    { 7600, SIM_ENERGIZE, 0 },
+    { 8200, SIM_ENERGIZE, 0 },
+    { 8800, SIM_FOR, 2 },
+    { 9400, SIM_SNAPSHOT, 0 },
+    { 9500, SIM_SPEED, 2600 },
+    {11000, SIM_SPEED, 0 },
+    {12400, SIM_HEAP, 1 },
+    {12500, SIM_END, 0 },
+};
+const size_t default_scenario_size = sizeof(default_scenario) / sizeof(default_scenario[0]);
+
+// An hour of operation, a cycle of the working day repeated, to show that the heap does not grow
+const sim_event soak_scenario[] = {
+    {    0, SIM_HEAP, 0 },
+    {    0, SIM_POWER, 1 },
+    {  300, SIM_FOR, 1 },
+    {  800, SIM_ENERGIZE, 0 },
+    { 1000, SIM_SPEED, 1800 },
+    { 2800, SIM_CHECK_RPM, 0 },
+    { 3000, SIM_STORM, 50 },
+    { 4000, SIM_SPEED, 600 },
+    { 5500, SIM_EMS, 1 },
+    { 6000, SIM_EMS, 0 },
+    { 6500, SIM_ENERGIZE, 0 },
+    { 7000, SIM_SPEED, 2400 },
+    { 8500, SIM_OVERLOAD, 0 },
+    { 9000, SIM_ENERGIZE, 0 },
+    { 9500, SIM_FOR, 2 },
+    {10000, SIM_SPEED, 0 },
+    {11000, SIM_FOR, 0 },
+    {11500, SIM_HEAP, 1 },
+    {12000, SIM_REPEAT, SIM_SOAK_CYCLES - 1 },
+    {12000, SIM_END, 0 },
+};
+const size_t soak_scenario_size = sizeof(soak_scenario) / sizeof(soak_scenario[0]);
+
+/**
+ * @brief Creates a new instance of Lathe_Simulator
+ * @param scenario - the stimuli, ordered by time
+ * @param count - the number of stimuli
+ */
+Lathe_Simulator::Lathe_Simulator(const sim_event* scenario, size_t count) : _scenario(scenario), _count(count)
+{
+    _windows.reserve(FB_MAX_WINDOWS);
+    _edges.reserve(SIM_MAX_EDGES);
+    _probes.reserve(SIM_MAX_PROBES);
+    _views.reserve(SIM_MAX_PROBES);
+    _trace.reserve(SIM_MAX_TRACE);
+        // so the heap only changes when the firmware allocates
+}
+
+/**
+ * @brief Sets the initial pin levels. Must be called before the controller is created.
+ */
+void Lathe_Simulator::begin()
+{
+    benchmark_logger();
+    hal_timer_init();
+    exercise_flight_recorder();
+    benchmark_display();
+    hal_host_spi_attach(&_display);
+    hal_host_gpio_set(I_MAIN_POWER, true);             // switched off
+    hal_host_gpio_set(I_EMS, false);
+    hal_host_gpio_set(I_ENERGIZE, true);               // released
+    hal_host_gpio_set(I_FOR_F, false);
+    hal_host_gpio_set(I_FOR_B, false);
+    hal_host_gpio_set(I_LIGHT, true);
+    hal_host_gpio_set(I_BACKLIGHT, false);
+    hal_host_gpio_set(I_LUBE, true);
+    hal_host_gpio_set(I_CONTROLBOARD_DETECT, true);    // no voltage on the control board
+    hal_host_gpio_set(I_SPINDLE_PULSE, true);
+    hal_host_gpio_set(SIM_RPM_PIN, true);
+}
+
+/**
+ * @brief Starts running the scenario against the controller
+ * @param controller - the controller
+ */
+void Lathe_Simulator::start(Controller* controller)
+{
+    _controller = controller;
+    for(int i = 0; i < SIM_RPM_SOURCES; i++)
+    {
+        _sources[i] = RPM_Source::create(source_modes[i], SIM_RPM_PIN);
+        _sources[i]->begin();
+    }
+    hal_host_gpio_tap(SIM_RPM_PIN, mark_edge, this);
+    hal_host_gpio_latency(SIM_RPM_PIN, SIM_ISR_LATENCY_US);
+    Logger.Info_f(F("Lathe simulator running %i stimuli at %ix speed"), (int)_count, SIM_SPEEDUP);
+    hal_task_create(sim_runner, "simRunner", 8192, this, HAL_PRIORITY_HIGHEST, HAL_CORE_ANY);
+    hal_task_create(flash_runner, "flashRunner", 4096, nullptr, 1, HAL_CORE_ANY);
+}
+
+/**
+ * @brief Task function running the model
+ * @param args - pointer to the simulator
+ */
+void Lathe_Simulator::sim_runner(void* args)
+{
+    Lathe_Simulator* _this = reinterpret_cast<Lathe_Simulator*>(args);
+    uint64_t start = hal_timer_us();
+    uint64_t t = start;
+    for(;;)
+    {
+        while(_this->_next < _this->_count && start + (uint64_t)_this->_scenario[_this->_next].at_ms * 1000 <= t)
+        {
+            const sim_event& e = _this->_scenario[_this->_next++];
+            if(e.action == SIM_REPEAT && _this->_repeats < e.value)
+            {
+                _this->_repeats++;
+                _this->_next = 0;
+                start = t;
+            }
+            else _this->apply(e, t);
+        }
+        _this->step(t);
+        t += SIM_STEP_US;
+        hal_host_sleep_until(t);
+            // absolute schedule, so the model does not drift when a step runs late
+    }
+}
+
+/**
+ * @brief Records the time of the falling edges on SIM_RPM_PIN, as they happened
+ * @param level - the new level of the pin
+ * @param at - the time of the change in us
+ * @param arg - pointer to the simulator
+ */
+void Lathe_Simulator::mark_edge(bool level, uint64_t at, void* arg)
+{
+    if(level) return;
+    Lathe_Simulator* _this = reinterpret_cast<Lathe_Simulator*>(arg);
+    _this->_previous_edge_at = _this->_edge_at;
+    _this->_edge_at = at;
+    if(_this->_trace.size() < SIM_MAX_TRACE) _this->_trace.push_back({ at, -1 });
+}
+
+/**
+ * @brief Compares the newest period of the timestamps of a source with the period of the edges
+ * @param name - the statistic receiving the error in ns
+ * @param source - the source
+ */
+void Lathe_Simulator::compare_period(const char* name, const Pulse_History_Source* source)
+{
+    uint64_t pulses[2];
+    if(_previous_edge_at == 0 || source->get_pulses(pulses, 2) < 2) return;
+    int64_t period = (int64_t)((pulses[1] - pulses[0]) * 1000 / source->get_ticks_per_us());
+    int64_t error = period - (int64_t)(_edge_at - _previous_edge_at) * 1000;
+    record(name, error < 0 ? -error : error);
+}
+
+/**
+ * @brief Applies a stimulus
+ * @param e - the stimulus
+ * @param now - the simulated time in us
+ */
+void Lathe_Simulator::apply(const sim_event& e, uint64_t now)
+{
+    switch(e.action)
+    {
+        case SIM_POWER:
+            hal_host_gpio_set(I_MAIN_POWER, !e.value);
+            if(!e.value) _board_on = _board_target = false;
+            break;
+        case SIM_EMS:
+            hal_host_gpio_set(I_EMS, e.value);
+            if(e.value)
+            {
+                _board_on = _board_target = false;
+                    // the emergency stop cuts the board power directly
+                expect("ems -> discharge", O_ENGINE_DISCHARGE, true, now);
+                expect_view("ems -> pixels", ASSET_BACKGROUND_EMS, now);
+            }
+            else expect_view("ems release -> pixels", for_icon(_for), now);
+                // the regular screen is back once the widgets are drawn over the background
+            break;
+        case SIM_FOR:
+            hal_host_gpio_set(I_FOR_F, e.value == 1);
+            hal_host_gpio_set(I_FOR_B, e.value == 2);
+            _for = e.value;
+            expect_view("for -> pixels", for_icon(_for), now);
+                // the display follows the switch even if the relays are deferred
+            if(_board_on) break;
+                // the controller defers direction changes while the engine is energized
+            if(e.value == 2) expect("for -> relays", O_SPINDLE_DIRECTION_SWITCH_A, true, now);
+            else expect("for -> relays", O_SPINDLE_OFF, e.value == 1, now);
+            break;
+        case SIM_ENERGIZE:
+        {
+            if(_board_on) expect("energize -> discharge", O_ENGINE_DISCHARGE, true, now);
+            uint64_t pressed = schedule_bounce(now, I_ENERGIZE, false);
+            schedule_bounce(pressed + SIM_PRESS_US, I_ENERGIZE, true);
+            break;
+        }
+        case SIM_STORM:
+        {
+            bool level = hal_gpio_read(I_LIGHT);
+            for(int i = 0; i < e.value; i++) schedule(now + (uint64_t)i * SIM_STORM_GAP_US, I_LIGHT, level = !level);
+            break;
+        }
+        case SIM_OVERLOAD:
+            _board_on = _board_target = false;
+            break;
+        case SIM_SPEED:
+            _target_rpm = e.value;
+            break;
+        case SIM_CHECK_RPM:
+        {
+            unsigned int rpm = _controller->get_rpm();
+            record("rpm error", rpm > _rpm ? rpm - _rpm : _rpm - rpm);
+            Logger.Info_f(F("Simulator: spindle at %i RPM, controller reads %i RPM"), (int)_rpm, (int)rpm);
+            for(int i = 0; i < SIM_RPM_SOURCES; i++)
+            {
+                unsigned int r = _source_rpm[i];
+                record(source_errors[i], r > _rpm ? r - _rpm : _rpm - r);
+            }
+            Logger.Info_f(F("Simulator: RPM sources read %u (%s), %u (%s), %u (%s)"), _source_rpm[0], source_names[0],
+                _source_rpm[1], source_names[1], _source_rpm[2], source_names[2]);
+            break;
+        }
+        case SIM_SNAPSHOT:
+        {
+            char path[32];
+            snprintf(path, sizeof(path), "sim_%u.png", (unsigned)e.at_ms);
+            if(_display.write_png(path)) Logger.Info_f(F("Simulator: display written to %s"), path);
+            else
+            {
+                Logger.Error(F("Simulator: could not write display snapshot"));
+                failures++;
+            }
+            break;
+        }
+        case SIM_HEAP:
+        {
+            int64_t bytes = heap_bytes;
+            if(e.value == 0 && _heap_baseline < 0) _heap_baseline = bytes;
+            else if(e.value != 0 && _heap_baseline >= 0 && bytes - _heap_baseline > _heap_growth) _heap_growth = bytes - _heap_baseline;
+            break;
+        }
+        case SIM_REPEAT:
+            break;
+                // the repetitions are done by sim_runner
+        case SIM_END:
+            report();
+            if(write_trace(SIM_TRACE_FILE)) Logger.Info_f(F("Simulator: spindle trace written to %s"), SIM_TRACE_FILE);
+            else
+            {
+                Logger.Error(F("Simulator: could not write the spindle trace"));
+                failures++;
+            }
+            Logger.Flush();
+            exit(failures > 0 ? 1 : 0);
+    }
+}
+
+/**
+ * @brief Advances the model by one step
+ * @param now - the simulated time in us
+ */
+void Lathe_Simulator::step(uint64_t now)
+{
+    // scheduled pin changes
+    while(!_edges.empty() && _edges.front().at <= now)
+    {
+        sim_edge e = _edges.front();
+        _edges.erase(_edges.begin());
+        hal_host_gpio_set(e.pin, e.level);
+        if(e.pin == I_SPINDLE_PULSE) hal_host_gpio_set(SIM_RPM_PIN, e.level);
+    }
+
+    // motor control board. It latches on the falling edge of the energize button, which it debounces itself,
+    // and powers down when the controller discharges it.
+    bool energize = hal_gpio_read(I_ENERGIZE);
+    bool can_run = !hal_gpio_read(I_MAIN_POWER) && !hal_gpio_read(I_EMS);
+    if(_last_energize && !energize && !_board_on && !_board_target && can_run && !hal_gpio_read(O_ENGINE_DISCHARGE))
+    {
+        _board_target = true;
+        _board_change_at = now + SIM_BOARD_ENERGIZE_US;
+    }
+    _last_energize = energize;
+    if(_board_on && _board_target && hal_gpio_read(O_ENGINE_DISCHARGE))
+    {
+        _board_target = false;
+        _board_change_at = now + SIM_BOARD_DISCHARGE_US;
+    }
+    if(_board_on != _board_target && now >= _board_change_at) _board_on = _board_target;
+    if(hal_gpio_read(I_CONTROLBOARD_DETECT) != !_board_on) hal_host_gpio_set(I_CONTROLBOARD_DETECT, !_board_on);
+
+    // spindle, it only turns with the engine energized and the direction relays closed
+    uint32_t target = (_board_on && hal_gpio_read(O_SPINDLE_OFF)) ? _target_rpm : 0;
+    uint32_t ramp = (uint32_t)((uint64_t)SIM_RAMP_RPM_PER_S * SIM_STEP_US / 1000000);
+    if(ramp == 0) ramp = 1;
+    if(_rpm < target) _rpm = _rpm + ramp > target ? target : _rpm + ramp;
+    else if(_rpm > target) _rpm = _rpm < target + ramp ? target : _rpm - ramp;
+    _phase += (double)_rpm * SIM_STEP_US / 60000000.0;
+    if(_phase >= 1.0)
+    {
+        // one magnet on the spindle, the sensor pulls low while it passes
+        _phase -= 1.0;
+        _pulses++;
+        hal_host_gpio_set(I_SPINDLE_PULSE, false);
+        hal_host_gpio_set(SIM_RPM_PIN, false);
+        schedule(now + SIM_PULSE_WIDTH_US, I_SPINDLE_PULSE, true);
+        compare_period(period_error_interrupt, static_cast<Pulse_History_Source*>(_sources[0]));
+        compare_period(period_error_capture, static_cast<Pulse_History_Source*>(_sources[2]));
+            // both keep a history of timestamps, source_modes lists them
+    }
+
+    // the compared RPM sources, at the interval of the RPM task. The pulse counter resolves the edges to it.
+    if(now - _source_at >= RPM_CALCULATION_INTERVAL * 1000)
+    {
+        for(int i = 0; i < SIM_RPM_SOURCES; i++) _source_rpm[i] = _sources[i]->get_rpm();
+        _source_at = now;
+        if(_trace.size() < SIM_MAX_TRACE) _trace.push_back({ now, (int32_t)_rpm });
+    }
+
+    // display traffic per frame
+    if(now - _frame_at >= SIM_FRAME_US)
+    {
+        uint64_t bytes = _display.get_bytes();
+        uint64_t heap = display_heap_ops;
+        _display.take_windows(_windows);
+        if(_frame_at != 0 && !_windows.empty())
+        {
+            record("display bytes/frame", bytes - _frame_bytes);
+            record("display windows/frame", _windows.size());
+        }
+
+        uint64_t scale_bytes = 0, scale_windows = 0;
+        for(const fb_window& w : _windows)
+        {
+            if(!on_scale(w)) continue;
+            scale_bytes += w.bytes;
+            scale_windows++;
+        }
+        if(_frame_at != 0 && scale_windows > 0)
+        {
+            record("scale bytes/update", scale_bytes);
+            record("scale windows/update", scale_windows);
+            record("heap ops/update", heap - _frame_heap_ops);
+            _scale_updates++;
+            _scale_heap_ops += heap - _frame_heap_ops;
+        }
+        _frame_at = now;
+        _frame_bytes = bytes;
+        _frame_heap_ops = heap;
+    }
+
+    // display reactions, only checked when the display received data
+    uint64_t view_bytes = _display.get_bytes();
+    if(view_bytes != _view_bytes || !_views.empty())
+    {
+        for(size_t i = 0; i < _views.size();)
+        {
+            sim_view& v = _views[i];
+            bool done = view_bytes != _view_bytes && _display.shows(asset_image(v.image), asset_table[v.image].x, asset_table[v.image].y);
+            bool missed = now - v.since > SIM_PROBE_TIMEOUT_US;
+            if(done || missed)
+            {
+                record(v.name, now - v.since, missed);
+                _views.erase(_views.begin() + i);
+            }
+            else i++;
+        }
+        _view_bytes = view_bytes;
+    }
+
+    // the machine state has to be consistent whenever another task looks at it
+    machine_state state = _controller->get_state();
+    _state_reads++;
+    if(!is_consistent(state)) _state_inconsistent++;
+
+    // controller reactions
+    for(size_t i = 0; i < _probes.size();)
+    {
+        sim_probe& p = _probes[i];
+        bool done = hal_gpio_read(p.pin) == p.level;
+        bool missed = now - p.since > SIM_PROBE_TIMEOUT_US;
+        if(done || missed)
+        {
+            record(p.name, now - p.since, missed);
+            _probes.erase(_probes.begin() + i);
+        }
+        else i++;
+    }
+}
+
+/**
+ * @brief Schedules a pin level change
+ * @param at - the simulated time in us
+ * @param pin - the pin
+ * @param level - the level
+ */
+void Lathe_Simulator::schedule(uint64_t at, uint8_t pin, bool level)
+{
+    auto it = _edges.begin();
+    while(it != _edges.end() && it->at <= at) it++;
+    _edges.insert(it, { at, pin, level });
+}
+
+/**
+ * @brief Schedules a bouncing transition of a pin
+ * @param at - the simulated time in us of the first edge
+ * @param pin - the pin
+ * @param level - the level the pin settles at
+ * @returns The simulated time in us the pin is stable
+ */
+uint64_t Lathe_Simulator::schedule_bounce(uint64_t at, uint8_t pin, bool level)
+{
+    for(int i = 0; i < SIM_BOUNCE_EDGES; i++)
+    {
+        schedule(at, pin, (i % 2 == 0) ? level : !level);
+        at += SIM_BOUNCE_GAP_US / 2 + rand() % SIM_BOUNCE_GAP_US;
+    }
+    schedule(at, pin, level);
+    return at;
+}
+
+/**
+ * @brief Starts waiting for a reaction of the controller
+ * @param name - the name of the reaction
+ * @param pin - the output pin
+ * @param level - the level the controller is expected to drive
+ * @param now - the simulated time in us
+ */
+void Lathe_Simulator::expect(const char* name, uint8_t pin, bool level, uint64_t now)
+{
+    if(hal_gpio_read(pin) == level) return;
+        // nothing to react to
+    _probes.push_back({ name, pin, level, now });
+}
+
+/**
+ * @brief Starts waiting for an image to appear on the display
+ * @param name - the name of the reaction
+ * @param image - the image, it is expected at its place in the asset table
+ * @param now - the simulated time in us
+ */
+void Lathe_Simulator::expect_view(const char* name, asset_id image, uint64_t now)
+{
+    if(asset_image(image) == nullptr) return;
+        // no asset pack, nothing will be drawn
+    if(_display.shows(asset_image(image), asset_table[image].x, asset_table[image].y)) return;
+        // nothing to react to
+    _views.push_back({ name, image, now });
+}
+
+/**
+ * @brief Records a sample in the named statistic
+ * @param name - the statistic
+ * @param value - the sample, ignored if missed
+ * @param missed - true if the expected reaction did not happen
+ */
+void Lathe_Simulator::record(const char* name, uint64_t value, bool missed)
+{
+    for(int i = 0; i < SIM_MAX_STATS; i++)
+    {
+        sim_stat& s = _stats[i];
+        if(s.name != nullptr && s.name != name) continue;
+        s.name = name;
+        if(missed) { s.missed++; return; }
+        s.count++;
+        s.sum += value;
+        if(value > s.max) s.max = value;
+        return;
+    }
+}
+
+/**
+ * @brief Prints the statistics
+ */
+void Lathe_Simulator::report()
+{
+    Logger.Info(F("Simulator report:"));
+    Logger.Info_f(F("    Spindle pulses: %llu, SPI bytes: %llu in %llu transactions"), (unsigned long long)_pulses,
+        (unsigned long long)hal_host_spi_bytes(), (unsigned long long)hal_host_spi_transactions());
+    const display_benchmark& d = display_bench;
+    if(d.done) Logger.Info_f(F("    Display sweep: %llu bytes/frame at %u MHz, queued blits %llu us/frame (%llu us in the task), synchronous %llu us/frame (%llu us in the task)"),
+        (unsigned long long)d.frame_bytes, (unsigned)(SPI_BUS_FREQUENCY / 1000000), (unsigned long long)d.queued_us,
+        (unsigned long long)d.queued_task_us, (unsigned long long)d.sync_us, (unsigned long long)d.sync_task_us);
+    if(d.done) Logger.Info_f(F("    Fill %ix%i: fill_rect %llu transactions %llu bytes %llu us, per pixel %llu transactions %llu bytes %llu us"),
+        SIM_FILL_BENCH_W, SIM_FILL_BENCH_H, (unsigned long long)d.fill_transactions, (unsigned long long)d.fill_bytes,
+        (unsigned long long)d.fill_us, (unsigned long long)d.pixel_transactions, (unsigned long long)d.pixel_bytes, (unsigned long long)d.pixel_us);
+    Logger.Info_f(F("    State snapshots: %llu reads, %llu inconsistent"), (unsigned long long)_state_reads, (unsigned long long)_state_inconsistent);
+    if(_scale_updates == 0)
+    {
+        Logger.Error(F("Simulator: no scale update was drawn, is assets.bin missing?"));
+        failures++;
+    }
+    if(_scale_heap_ops > 0)
+    {
+        Logger.Error(F("Simulator: the display tasks used the heap while updating the scale"));
+        failures++;
+    }
+    if(_state_inconsistent > 0)
+    {
+        Logger.Error(F("Simulator: the controller published inconsistent state snapshots"));
+        failures++;
+    }
+    if(_heap_baseline >= 0)
+    {
+        Logger.Info_f(F("    Heap: %lld bytes in use at the start, %lld now, grew by up to %lld (%i runs)"), (long long)_heap_baseline,
+            (long long)heap_bytes.load(), (long long)_heap_growth, _repeats + 1);
+        if(_heap_growth > 0)
+        {
+            Logger.Error(F("Simulator: the heap grew while the scenario ran"));
+            failures++;
+        }
+    }
+    hal_host_flash_stats flash = hal_host_flash_statistics(FLIGHT_LOG_PARTITION);
+    Logger.Info_f(F("    Flight recorder: %llu bytes recorded, %llu programmed in %u writes, %u erases"),
+        (unsigned long long)Recorder.get_recorded(), (unsigned long long)flash.programmed, flash.writes, flash.erases);
+    hal_host_isr_flash_stats isr_flash = hal_host_isr_flash_statistics();
+    Logger.Info_f(F("    Flash busy: %u interrupt handlers ran, %u of their calls went to code in flash"), isr_flash.handlers,
+        isr_flash.flash_calls);
+    if(isr_flash.handlers == 0)
+    {
+        Logger.Error(F("Simulator: no interrupt handler ran while the flash was busy"));
+        failures++;
+    }
+    if(isr_flash.flash_calls > 0)
+    {
+        Logger.Error(F("Simulator: interrupt handlers called into flash while it was busy"));
+        failures++;
+    }
+    for(int i = 0; i < SIM_MAX_STATS && _stats[i].name != nullptr; i++)
+    {
+        sim_stat& s = _stats[i];
+        Logger.Info_f(F("    %-24s n=%u missed=%u avg=%llu max=%llu"), s.name, s.count, s.missed,
+            (unsigned long long)(s.count ? s.sum / s.count : 0), (unsigned long long)s.max);
+    }
+    Logger.Info_f(F("    latencies in us, rpm error in RPM, display budget %i bytes/frame at %i fps"), FB_FRAME_BUDGET_BYTES, FB_FRAME_RATE);
+    Logger.Info_f(F("    period errors in ns against the edges, with up to %i us interrupt latency"), SIM_ISR_LATENCY_US);
+    Logger.Info(F("    scale updates count pixel bytes, heap operations are those of the display and blitter tasks during the frame"));
+    Metrics.report();
+    Metrics.report_histograms();
+    Logger.Info_f(F("Simulator: %u checks failed"), failures.load());
+}
+
+/**
+ * @brief Writes the spindle trace, see test/rpm_filter_bench.cpp
+ * @param path - the file
+ * @returns True if the file was written
+ */
+bool Lathe_Simulator::write_trace(const char* path)
+{
+    FILE* f = fopen(path, "w");
+    if(f == nullptr) return false;
+    fprintf(f, "# spindle trace of the lathe simulator, times in us\n");
+    fprintf(f, "# e <time>: falling edge of the hall sensor\n");
+    fprintf(f, "# s <time> <rpm>: spindle speed at an RPM calculation, every %i ms\n", RPM_CALCULATION_INTERVAL);
+    for(const sim_trace_event& e : _trace)
+    {
+        if(e.rpm < 0) fprintf(f, "e %llu\n", (unsigned long long)e.at);
+        else fprintf(f, "s %llu %i\n", (unsigned long long)e.at, (int)e.rpm);
+    }
+    return fclose(f) == 0;
+}
+
+#endif
@@ -0,0 +1,306 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#ifndef _LATHE_SIMULATOR_H_
+#define _LATHE_SIMULATOR_H_
+
+#if defined(LATHE_SIMULATOR) && !defined(ARDUINO)
+
+#include <Arduino.h>
+#include <vector>
+#include "../hal/hal.h"
+#include "../controller/controller.h"
+#include "../rpm/rpm_source.h"
+#include "../display_spi/ili9341_framebuffer.h"
+#include "../controller_display/assets.h"
+
+#ifndef SIM_SPEEDUP
+#define SIM_SPEEDUP 4                   // Simulated time runs this much faster than the wall clock, faster and
+                                        // the host no longer keeps up with the bouncing buttons
+#endif
+#define SIM_STEP_US 250                 // Model update interval in simulated us
+#define SIM_BOARD_ENERGIZE_US 80000     // Time for the motor control board to power up after the energize button
+#define SIM_BOARD_DISCHARGE_US 40000    // Time for the motor control board to power down after discharge
+#define SIM_BOUNCE_EDGES 6              // Number of bounce edges on each press and release of the energize button
+#define SIM_BOUNCE_GAP_US 400           // Time between bounce edges
+#define SIM_PRESS_US 400000             // Duration of a button press, the controller samples it after DEBOUNCE_US
+#define SIM_PULSE_WIDTH_US 500          // Hall sensor low time per revolution
+#define SIM_RAMP_RPM_PER_S 2000         // Spindle acceleration
+#define SIM_STORM_GAP_US 1000           // Time between edges of an event storm
+#define SIM_PROBE_TIMEOUT_US 5000000    // Time after which a reaction is counted as missing
+#define SIM_RPM_PIN 25                  // Mirrors the hall sensor to the RPM sources the simulator compares
+#define SIM_RPM_SOURCES 3               // Interrupt, pulse counter and capture unit
+#define SIM_ISR_LATENCY_US 50           // Longest interrupt latency on SIM_RPM_PIN, the handler runs a random time
+                                        // up to this after the edge, while the capture unit latches it on time
+#define SIM_FRAME_US (1000000 / FB_FRAME_RATE)   // Interval of the display budget samples
+#define SIM_MAX_STATS 24
+#define SIM_MAX_EDGES 1024              // Pending pin changes, a storm of value toggles schedules 2 * value
+#define SIM_MAX_PROBES 16               // Reactions waited for at the same time
+#define SIM_LOG_BENCH_CALLS 20000       // Log calls timed by the startup logger benchmark
+#define SIM_FLIGHT_LOG_FRAMES 20000     // Frames written by the startup check of the flight recorder, several rounds
+#define SIM_FLIGHT_LOG_URGENT 50        // One in this many is written right away, like a warning
+#define SIM_FLIGHT_LOG_PARTITION "flightlog_test"
+#define SIM_FLASH_ERASE_MS 250         // While the scenario runs, a sector of SIM_FLIGHT_LOG_PARTITION is erased this
+                                        // often, so the interrupt handlers also run while the flash is busy
+#define SIM_MAX_TRACE 16384            // Events of the spindle trace, the hall edges and the spindle speed at every RPM
+                                        // calculation, written to SIM_TRACE_FILE at the end of the scenario
+#define SIM_TRACE_FILE "sim_spindle_trace.txt"
+#define SIM_DISPLAY_BENCH_RPM 3000      // The startup display benchmark sweeps the RPM up to this and down again
+#define SIM_DISPLAY_BENCH_STEP 50       // in steps of this, one frame each
+#define SIM_FILL_BENCH_W 120            // Rectangle the startup display benchmark fills with fill_rect and pixel by
+#define SIM_FILL_BENCH_H 80             // pixel, to count the SPI transactions of both
+#ifndef SIM_SOAK_CYCLES
+#define SIM_SOAK_CYCLES 300             // Runs of the 12 s soak scenario, an hour of operation in 15 minutes
+#endif
+
+/**
+ * @brief The stimuli a scenario can apply to the lathe
+ */
+enum sim_action {
+    SIM_POWER,          // main power switch, value 1 for on
+    SIM_EMS,            // emergency stop, value 1 for pressed
+    SIM_FOR,            // direction switch, value 0 neutral, 1 forward, 2 backward
+    SIM_ENERGIZE,       // press and release the energize button with bounce
+    SIM_STORM,          // toggle the light switch value times
+    SIM_OVERLOAD,       // motor control board shuts down on its own
+    SIM_SPEED,          // spindle target speed in RPM, reached with SIM_RAMP_RPM_PER_S
+    SIM_CHECK_RPM,      // compare the controller RPM with the spindle speed
+    SIM_SNAPSHOT,       // write the display framebuffer to sim_<at_ms>.png
+    SIM_HEAP,           // value 0 takes the heap in use as the baseline (once), value 1 compares it with the baseline
+    SIM_REPEAT,         // run the stimuli again from the first one, value times, their times count from here
+    SIM_END             // print the report and exit, with status 1 if a check failed
+};
+
+/**
+ * @brief A stimulus at a point in simulated time
+ */
+struct sim_event {
+    uint32_t at_ms;
+    sim_action action;
+    int value;
+};
+
+/**
+ * @brief Simulates the lathe around the controller
+ * @details Models the motor control board (I_CONTROLBOARD_DETECT following the energize button and
+ * O_ENGINE_DISCHARGE), the switches, the bouncing energize button and the hall sensor, and drives them
+ * through the host HAL pins. The controller runs unmodified with its real tasks. The simulator measures how
+ * long the controller takes to react to stimuli, at the outputs and on the display, and how well the RPM tracks
+ * the spindle. The hall sensor is mirrored to a spare pin, where an RPM source of each acquisition mode that runs
+ * on the workstation gets the same pulses, so their RPM can be compared with that of the spindle. The display is
+ * rendered into an ILI9341_Framebuffer, so the SPI traffic per frame can be checked against the bus budget.
+ * Frames that redraw the RPM scale are also measured on their own: the pixel bytes and address windows of the
+ * scale and the heap operations of the display and blitter tasks during the frame, which must be none, so a
+ * spindle speed sweep shows what a scale update costs. Every step also takes a machine state snapshot and checks
+ * it against the invariants of the direction relays (test/seqlock_test.cpp stress tests the Seqlock itself). The
+ * heap in use is tracked as well, the firmware allocates everything during setup, so it must not grow while a
+ * scenario runs.
+ */
+class Lathe_Simulator
+{
+    public:
+        /**
+         * @brief Creates a new instance of Lathe_Simulator
+         * @param scenario - the stimuli, ordered by time
+         * @param count - the number of stimuli
+         */
+        Lathe_Simulator(const sim_event* scenario, size_t count);
+
+        /**
+         * @brief Sets the initial pin levels. Must be called before the controller is created.
+         */
+        void begin();
+
+        /**
+         * @brief Starts running the scenario against the controller
+         * @param controller - the controller
+         */
+        void start(Controller* controller);
+
+    protected:
+        /**
+         * @brief A pin level change scheduled by the model
+         */
+        struct sim_edge {
+            uint64_t at;
+            uint8_t pin;
+            bool level;
+        };
+
+        /**
+         * @brief Reaction of the controller the simulator waits for
+         */
+        struct sim_probe {
+            const char* name;
+            uint8_t pin;
+            bool level;
+            uint64_t since;
+        };
+
+        /**
+         * @brief Image the simulator waits for on the display
+         */
+        struct sim_view {
+            const char* name;
+            asset_id image;
+            uint64_t since;
+        };
+
+        /**
+         * @brief An event of the spindle trace, a falling hall edge or the spindle speed at an RPM calculation
+         */
+        struct sim_trace_event {
+            uint64_t at;
+            int32_t rpm;        // -1 for an edge
+        };
+
+        /**
+         * @brief Latency or error statistics
+         */
+        struct sim_stat {
+            const char* name = nullptr;
+            uint32_t count = 0;
+            uint32_t missed = 0;
+            uint64_t sum = 0;
+            uint64_t max = 0;
+        };
+
+        /**
+         * @brief Task function running the model
+         * @param args - pointer to the simulator
+         */
+        static void sim_runner(void* args);
+
+        /**
+         * @brief Records the time of the falling edges on SIM_RPM_PIN, as they happened
+         * @param level - the new level of the pin
+         * @param at - the time of the change in us
+         * @param arg - pointer to the simulator
+         */
+        static void mark_edge(bool level, uint64_t at, void* arg);
+
+        /**
+         * @brief Compares the newest period of the timestamps of a source with the period of the edges
+         * @param name - the statistic receiving the error in ns
+         * @param source - the source
+         */
+        void compare_period(const char* name, const Pulse_History_Source* source);
+
+        /**
+         * @brief Applies a stimulus
+         * @param e - the stimulus
+         * @param now - the simulated time in us
+         */
+        void apply(const sim_event& e, uint64_t now);
+
+        /**
+         * @brief Advances the model by one step
+         * @param now - the simulated time in us
+         */
+        void step(uint64_t now);
+
+        /**
+         * @brief Schedules a pin level change
+         * @param at - the simulated time in us
+         * @param pin - the pin
+         * @param level - the level
+         */
+        void schedule(uint64_t at, uint8_t pin, bool level);
+
+        /**
+         * @brief Schedules a bouncing transition of a pin
+         * @param at - the simulated time in us of the first edge
+         * @param pin - the pin
+         * @param level - the level the pin settles at
+         * @returns The simulated time in us the pin is stable
+         */
+        uint64_t schedule_bounce(uint64_t at, uint8_t pin, bool level);
+
+        /**
+         * @brief Starts waiting for a reaction of the controller
+         * @param name - the name of the reaction
+         * @param pin - the output pin
+         * @param level - the level the controller is expected to drive
+         * @param now - the simulated time in us
+         */
+        void expect(const char* name, uint8_t pin, bool level, uint64_t now);
+
+        /**
+         * @brief Starts waiting for an image to appear on the display
+         * @param name - the name of the reaction
+         * @param image - the image, it is expected at its place in the asset table
+         * @param now - the simulated time in us
+         */
+        void expect_view(const char* name, asset_id image, uint64_t now);
+
+        /**
+         * @brief Records a sample in the named statistic
+         * @param name - the statistic
+         * @param value - the sample, ignored if missed
+         * @param missed - true if the expected reaction did not happen
+         */
+        void record(const char* name, uint64_t value, bool missed = false);
+
+        /**
+         * @brief Prints the statistics
+         */
+        void report();
+
+        /**
+         * @brief Writes the spindle trace, see test/rpm_filter_bench.cpp
+         * @param path - the file
+         * @returns True if the file was written
+         */
+        bool write_trace(const char* path);
+
+    private:
+        const sim_event* _scenario;
+        size_t _count;
+        size_t _next = 0;
+        int _repeats = 0;
+        Controller* _controller = nullptr;
+
+        std::vector<sim_edge> _edges;
+        std::vector<sim_probe> _probes;
+        std::vector<sim_view> _views;
+        uint64_t _view_bytes = 0;
+        int _for = 0;
+        sim_stat _stats[SIM_MAX_STATS];
+        ILI9341_Framebuffer _display;
+        uint64_t _frame_at = 0;
+        uint64_t _frame_bytes = 0;
+        uint64_t _frame_heap_ops = 0;
+        uint64_t _scale_updates = 0;
+        uint64_t _scale_heap_ops = 0;
+        std::vector<fb_window> _windows;
+
+        bool _board_on = false;
+        uint64_t _board_change_at = 0;
+        bool _board_target = false;
+        bool _last_energize = true;
+
+        uint32_t _rpm = 0;
+        uint32_t _target_rpm = 0;
+        double _phase = 0;
+        uint64_t _pulses = 0;
+        RPM_Source* _sources[SIM_RPM_SOURCES] = {};
+        unsigned int _source_rpm[SIM_RPM_SOURCES] = {};
+        uint64_t _source_at = 0;
+        uint64_t _edge_at = 0;
+        uint64_t _previous_edge_at = 0;
+        std::vector<sim_trace_event> _trace;
+
+        uint64_t _state_reads = 0;
+        uint64_t _state_inconsistent = 0;
+
+        int64_t _heap_baseline = -1;
+        int64_t _heap_growth = 0;
+};
+
+extern const sim_event default_scenario[];
+extern const size_t default_scenario_size;
+extern const sim_event soak_scenario[];
+extern const size_t soak_scenario_size;
+
+#endif
+#endif
@@ -0,0 +1,92 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+// Host test of Log2_Histogram against reference_bucket. Records the bounds and the middle of every bucket, then
+// HISTOGRAM_VALUES values of a log-uniform and a narrow normal distribution, like ISR latencies with a long tail,
+// from a writer thread while the histogram is read, like the histograms command. Fails (exit status 1) if a
+// bound or a value lands in the wrong bucket, a final count is off or a copy taken while recording shrinks.
+
+#include <stdio.h>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+#include "../src/metrics/histogram.h"
+
+#define HISTOGRAM_VALUES 4000000        // Values recorded while the histogram is read
+
+/**
+ * @brief Gets the histogram bucket of a value by counting its bits, the slow way
+ */
+static uint32_t reference_bucket(uint32_t value)
+{
+    uint32_t bits = 0;
+    for(; value != 0; value >>= 1) bits++;
+    return bits;
+}
+
+int main()
+{
+    static Log2_Histogram histogram("test", "");
+    uint64_t expected[HISTOGRAM_BUCKETS] = {0};
+    uint32_t misplaced = 0;
+    for(uint32_t b = 0; b < HISTOGRAM_BUCKETS; b++)
+    {
+        uint32_t values[] = { Log2_Histogram::lower(b), Log2_Histogram::upper(b), Log2_Histogram::lower(b) + (Log2_Histogram::upper(b) - Log2_Histogram::lower(b)) / 2 };
+        for(uint32_t v : values)
+        {
+            if(reference_bucket(v) != b || Log2_Histogram::bucket(v) != b)
+            {
+                printf("%u: bucket %u, expected %u\n", v, Log2_Histogram::bucket(v), b);
+                misplaced++;
+            }
+            histogram.record(v);
+            expected[b]++;
+        }
+    }
+
+    std::mt19937 random(1);
+    std::vector<uint32_t> values(HISTOGRAM_VALUES);
+    std::normal_distribution<double> normal(1000.0, 50.0);
+    for(uint32_t i = 0; i < HISTOGRAM_VALUES; i++)
+    {
+        values[i] = i & 1 ? (uint32_t)normal(random) : random() >> (random() % 32);
+        expected[reference_bucket(values[i])]++;
+    }
+    std::atomic<bool> done{false};
+    std::thread writer([&]()
+    {
+        for(uint32_t v : values) histogram.record(v);
+        done = true;
+    });
+    uint32_t counts[HISTOGRAM_BUCKETS], previous[HISTOGRAM_BUCKETS] = {0};
+    uint32_t reads = 0, shrunk = 0;
+    while(!done)
+    {
+        histogram.read(counts);
+        for(uint32_t b = 0; b < HISTOGRAM_BUCKETS; b++)
+        {
+            if(counts[b] < previous[b]) shrunk++;
+            previous[b] = counts[b];
+        }
+        reads++;
+    }
+    writer.join();
+
+    uint32_t total = histogram.read(counts);
+    uint32_t off = 0;
+    for(uint32_t b = 0; b < HISTOGRAM_BUCKETS; b++)
+    {
+        if(counts[b] == expected[b]) continue;
+        printf("bucket %u: %u values, expected %llu\n", b, counts[b], (unsigned long long)expected[b]);
+        off++;
+    }
+    printf("Histogram: %u values, %u bounds misplaced, %u buckets off, %u reads while recording, %u shrunk\n",
+        total, misplaced, off, reads, shrunk);
+    if(misplaced > 0 || off > 0 || shrunk > 0 || total != HISTOGRAM_VALUES + 3 * HISTOGRAM_BUCKETS)
+    {
+        printf("FAILED\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,55 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+// Host test of Pulse_Ring: one thread pushes RING_PUSHES consecutive timestamps into a ring while another takes
+// snapshots of every size up to MAX_RPM_PULSES, like the hall ISR and the RPM calculation. Each snapshot must be
+// consecutive, so neither torn nor missing an entry, and must not start before the previous one of the same
+// size. Fails (exit status 1) on any broken snapshot or if the consumer never had to retry, which means the
+// overwrite path was not exercised.
+
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include "../src/rpm/rpm_source.h"
+
+#define RING_PUSHES 20000000            // Timestamps pushed by the producer
+
+int main()
+{
+    static Pulse_Ring<PULSE_RING_SIZE> ring;
+    std::atomic<bool> done{false};
+    std::thread producer([&]()
+    {
+        for(uint64_t t = 1; t <= RING_PUSHES; t++) ring.push(t);
+        done = true;
+    });
+
+    uint64_t out[MAX_RPM_PULSES], newest[MAX_RPM_PULSES + 1] = {0};
+    uint64_t snapshots = 0, broken = 0;
+    while(!done)
+    {
+        size_t max = 1 + snapshots % MAX_RPM_PULSES;
+        size_t n = ring.snapshot(out, max);
+        snapshots++;
+        if(n == 0) continue;
+        bool ok = out[n - 1] >= newest[max] && (n == max || out[0] == 1);
+        for(size_t i = 1; i < n; i++) ok = ok && out[i] == out[i - 1] + 1;
+        if(!ok)
+        {
+            if(broken == 0) printf("snapshot %llu of %u: %llu..%llu, %u entries\n", (unsigned long long)snapshots,
+                (unsigned)max, (unsigned long long)out[0], (unsigned long long)out[n - 1], (unsigned)n);
+            broken++;
+        }
+        newest[max] = out[n - 1];
+    }
+    producer.join();
+
+    printf("Pulse ring: %llu snapshots, %llu broken, %u retried\n", (unsigned long long)snapshots,
+        (unsigned long long)broken, ring.retries());
+    if(broken > 0 || ring.retries() == 0)
+    {
+        printf("FAILED: %s\n", broken > 0 ? "broken snapshots" : "the producer never overwrote a copy");
+        return 1;
+    }
+    return 0;
+}
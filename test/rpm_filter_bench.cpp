@@ -0,0 +1,174 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+// Host benchmark of the RPM filters on a spindle trace recorded by the lathe simulator (SIM_TRACE_FILE, a capture
+// of the default scenario is checked in as test/data/spindle_trace.txt). The hall edges of the trace are replayed
+// through Pulse_History_Source::calculate_rpm at the times the simulator calculated the RPM, so every filter gets
+// the raw RPM the controller got, including the lag of the pulse history. For each filter, the benchmark reports
+// the cycles per update (hal_cycles), the error against the spindle speed, the updates until the output settles
+// after each speed change of the spindle and the overshoot, without the MIN_RPM_DELTA hysteresis, and the output
+// for a phantom sample far beyond any spindle speed. Fails (exit status 1) if the trace does not load, a filter
+// never settles or the phantom sample is not clamped.
+//
+//   rpm_filter_bench [trace]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "../src/hal/hal.h"
+#include "../src/rpm/rpm_source.h"
+#include "../src/rpm/rpm_estimator.h"
+#include "../src/controller/controller.h"
+
+#define BENCH_PASSES 200                // Replays of the trace timed per filter
+#define BENCH_SETTLE_PERCENT 2          // The output has settled within this of the spindle speed, or MIN_RPM_DELTA
+
+/**
+ * @brief An RPM calculation of the trace
+ */
+struct bench_sample {
+    uint64_t at;
+    unsigned int raw;       // RPM from the pulse history at this time
+    unsigned int rpm;       // the spindle speed
+};
+
+/**
+ * @brief Reads a spindle trace and calculates the raw RPM at each of its RPM calculations
+ * @param path - the trace
+ * @param samples - receives the RPM calculations
+ * @returns The number of edges in the trace
+ */
+static uint32_t load_trace(const char* path, std::vector<bench_sample>& samples)
+{
+    FILE* f = fopen(path, "r");
+    if(f == nullptr) return 0;
+    uint64_t edges[MAX_RPM_PULSES];
+    int count = 0;
+    uint32_t total = 0;
+    char line[128];
+    while(fgets(line, sizeof(line), f) != nullptr)
+    {
+        unsigned long long at;
+        unsigned int rpm;
+        if(sscanf(line, "e %llu", &at) == 1)
+        {
+            if(count == MAX_RPM_PULSES) memmove(edges, edges + 1, sizeof(edges) - sizeof(edges[0]));
+            else count++;
+            edges[count - 1] = at;
+            total++;
+        }
+        else if(sscanf(line, "s %llu %u", &at, &rpm) == 2)
+        {
+            samples.push_back({ at, Pulse_History_Source::calculate_rpm(edges, count, at, 1), rpm });
+        }
+    }
+    fclose(f);
+    return total;
+}
+
+/**
+ * @brief Response of a filter to the trace
+ */
+struct bench_result {
+    uint64_t error_sum = 0;
+    unsigned int error_max = 0;
+    uint32_t changes = 0;           // speed changes of the spindle followed by a constant speed
+    uint32_t settled = 0;           // of them, the ones the output settled on before the next change
+    uint64_t settle_updates = 0;    // sum over the settled ones
+    unsigned int overshoot = 0;
+};
+
+/**
+ * @brief Measures the response of a filter to the trace
+ * @param samples - the trace
+ * @param output - the output of the filter for each sample
+ * @returns The response
+ */
+static bench_result measure(const std::vector<bench_sample>& samples, const std::vector<unsigned int>& output)
+{
+    bench_result r;
+    size_t n = samples.size();
+    for(size_t i = 0; i < n; i++)
+    {
+        unsigned int error = output[i] > samples[i].rpm ? output[i] - samples[i].rpm : samples[i].rpm - output[i];
+        r.error_sum += error;
+        if(error > r.error_max) r.error_max = error;
+    }
+    for(size_t i = 1; i + 1 < n; i++)
+    {
+        if(samples[i].rpm == samples[i - 1].rpm || samples[i].rpm != samples[i + 1].rpm) continue;
+            // the ramp of the spindle ends here
+        unsigned int target = samples[i].rpm;
+        bool up = target > samples[i - 1].rpm;
+        unsigned int tolerance = target * BENCH_SETTLE_PERCENT / 100;
+        if(tolerance < MIN_RPM_DELTA) tolerance = MIN_RPM_DELTA;
+        size_t end = i, settle = i;
+        for(; end < n && samples[end].rpm == target; end++)
+        {
+            unsigned int out = output[end];
+            if((out > target ? out - target : target - out) > tolerance) settle = end + 1;
+            if(up && out > target && out - target > r.overshoot) r.overshoot = out - target;
+            if(!up && out < target && target - out > r.overshoot) r.overshoot = target - out;
+        }
+        r.changes++;
+        if(settle < end)
+        {
+            r.settled++;
+            r.settle_updates += settle - i;
+        }
+    }
+    return r;
+}
+
+int main(int argc, char** argv)
+{
+    const char* path = argc > 1 ? argv[1] : "sim_spindle_trace.txt";
+    std::vector<bench_sample> samples;
+    uint32_t edges = load_trace(path, samples);
+    printf("Trace %s: %u edges, %u RPM calculations\n", path, edges, (unsigned)samples.size());
+    if(edges < 2 || samples.size() < 2)
+    {
+        printf("FAILED: no trace\n");
+        return 1;
+    }
+
+    int failed = 0;
+    std::vector<unsigned int> output(samples.size());
+    for(int f = 0; f < RPM_FILTER_COUNT; f++)
+    {
+        static RPM_Estimator estimator;
+        estimator.set_filter((rpm_filter)f);
+        estimator.set_min_delta(0);
+        estimator.reset();
+        for(size_t i = 0; i < samples.size(); i++) output[i] = estimator.update(samples[i].raw);
+        unsigned int phantom = estimator.update(UINT32_MAX);
+        bench_result r = measure(samples, output);
+
+        uint64_t cycles = 0;
+        volatile unsigned int sink = 0;
+        for(int pass = 0; pass < BENCH_PASSES; pass++)
+        {
+            estimator.reset();
+            uint32_t start = hal_cycles();
+            for(const bench_sample& s : samples) sink = estimator.update(s.raw);
+            cycles += hal_cycles() - start;
+                // a pass is far shorter than the wrap of the counter
+        }
+        (void)sink;
+
+        uint64_t settle = r.settled ? r.settle_updates / r.settled : 0;
+        printf("RPM filter %s: %llu cycles/update, error avg %llu max %u RPM, settled on %u of %u speed changes after %llu updates (%llu ms), overshoot %u RPM, phantom sample %u RPM\n",
+            RPM_Estimator::get_filter_name((rpm_filter)f), (unsigned long long)(cycles / BENCH_PASSES / samples.size()),
+            (unsigned long long)(r.error_sum / samples.size()), r.error_max, r.settled, r.changes,
+            (unsigned long long)settle, (unsigned long long)(settle * RPM_CALCULATION_INTERVAL), r.overshoot, phantom);
+        if(r.changes == 0 || r.settled == 0 || phantom > RPM_ESTIMATOR_MAX)
+        {
+            printf("FAILED: %s\n", phantom > RPM_ESTIMATOR_MAX ? "the phantom sample is not clamped" : "the output never settled");
+            failed++;
+        }
+    }
+    printf("%u cycles per us, updates every %i ms, settled within %i%% or %i RPM\n", hal_cycles_per_us(),
+        RPM_CALCULATION_INTERVAL, BENCH_SETTLE_PERCENT, MIN_RPM_DELTA);
+    return failed > 0 ? 1 : 0;
+}
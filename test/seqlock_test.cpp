@@ -0,0 +1,87 @@
+// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+// Host test of Seqlock: one thread publishes machine_state snapshots with every field alternately false and true,
+// like the input task, while STRESS_READERS threads read them, like the display task and Controller::get_state.
+// Each read must be uniform, so never mix the fields of two snapshots. Fails (exit status 1) on any torn read.
+// The readers also take plain copies of the same words without the sequence check, which are reported to show
+// that the test can catch a torn read on this machine.
+
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../src/controller/controller.h"
+
+#define STRESS_WRITES 2000000           // Snapshots published by the writer
+#define STRESS_READERS 3                // Threads reading them
+
+/**
+ * @brief Fills every field of a snapshot with the same value
+ */
+static machine_state uniform_state(bool value)
+{
+    machine_state s;
+    s.main_power = s.has_emergency = s.for_f = s.for_b = s.light = s.is_energized = value;
+    s.backlight = s.lube = s.has_deferred_action = value;
+    s.direction_a = s.direction_b = s.common = s.deenergize = { value, value };
+    return s;
+}
+
+/**
+ * @brief Checks whether all fields of a snapshot hold the same value
+ */
+static bool is_uniform(const machine_state& s)
+{
+    machine_state expected = uniform_state(s.main_power);
+    return memcmp(&s, &expected, sizeof(s)) == 0;
+}
+
+int main()
+{
+    static Seqlock<machine_state> lock;
+    static std::atomic<uint32_t> words[(sizeof(machine_state) + 3) / 4];
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> reads{0}, torn{0}, unsynchronized{0};
+
+    lock.publish(uniform_state(false));
+    std::vector<std::thread> readers;
+    for(int r = 0; r < STRESS_READERS; r++)
+    {
+        readers.emplace_back([&]()
+        {
+            uint64_t n = 0, b = 0, p = 0;
+            while(!done)
+            {
+                if(!is_uniform(lock.read())) b++;
+                n++;
+                uint32_t copy[(sizeof(machine_state) + 3) / 4];
+                for(size_t i = 0; i < sizeof(copy) / 4; i++) copy[i] = words[i].load(std::memory_order_relaxed);
+                machine_state s;
+                memcpy(&s, copy, sizeof(s));
+                if(!is_uniform(s)) p++;
+            }
+            reads += n; torn += b; unsynchronized += p;
+        });
+    }
+    for(uint32_t i = 0; i < STRESS_WRITES; i++)
+    {
+        machine_state s = uniform_state(i & 1);
+        lock.publish(s);
+        uint32_t copy[(sizeof(machine_state) + 3) / 4] = {0};
+        memcpy(copy, &s, sizeof(s));
+        for(size_t k = 0; k < sizeof(copy) / 4; k++) words[k].store(copy[k], std::memory_order_relaxed);
+    }
+    done = true;
+    for(std::thread& t : readers) t.join();
+
+    printf("Seqlock: %llu reads, %llu torn (unsynchronized copy: %llu torn), generation %u\n",
+        (unsigned long long)reads, (unsigned long long)torn, (unsigned long long)unsynchronized, lock.generation());
+    if(torn > 0 || reads == 0 || lock.generation() != STRESS_WRITES + 1)
+    {
+        printf("FAILED: %s\n", torn > 0 ? "torn reads" : reads == 0 ? "no reads" : "lost publishes");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+# Copyright (c) Thor Schueler. All rights reserved.
+# SPDX-License-Identifier: MIT
+"""
+Compiles the display artwork in assets/ into the asset table of the firmware.
+
+Reads assets/manifest.json, which places every image on the display:
+
+    "groups":    name -> { x, y, w, h, images: { variant -> PNG } }
+                 all variants of a group share the placement, e.g. the on and off icon of a widget
+    "sequences": name -> [ group_variant, ... ]
+                 ordered lists of images the firmware indexes, e.g. the ten digits
+
+Every PNG is scaled to the size of its group, converted to RGB565 and compressed with rle565. The images are
+packed into one array, each starting at an ASSET_ALIGN boundary. The generated header describes the placement
+and location of every image as constexpr data together with static_asserts, so a layout mistake fails the build
+instead of corrupting a blit.
+
+With --pack the images are also written as an asset pack (see src/controller_display/asset_pack.h), which the
+firmware maps from the assets partition when ASSETS_IN_PARTITION is set. The pack only has to be flashed again
+when the artwork changes; the firmware has to be rebuilt only when the placements change.
+
+Usage:
+    asset_compiler.py [--manifest assets/manifest.json] [--out src/controller_display] [--pack assets.bin]
+"""
+
+import argparse
+import csv
+import json
+import os
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import rle565  # noqa: E402
+
+ALIGN = 4
+PACK_MAGIC = 0x4b50414c
+PACK_VERSION = 1
+PACK_PARTITION = "assets"
+HEADER = "assets.h"
+SOURCE = "assets.cpp"
+BANNER = """// Copyright (c) Thor Schueler. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+// Generated by tools/asset_compiler.py from assets/manifest.json, do not edit.
+"""
+
+
+def identifier(*parts):
+    return "_".join(p for p in parts if p).upper()
+
+
+def load(manifest_path):
+    """Reads the manifest and compiles the images. Returns the display size, the images and the sequences."""
+    with open(manifest_path) as f:
+        manifest = json.load(f)
+    root = os.path.dirname(manifest_path)
+    display = manifest["display"]
+    images = []
+    for group, spec in manifest["groups"].items():
+        x, y, w, h = spec["x"], spec["y"], spec["w"], spec["h"]
+        if x < 0 or y < 0 or x + w > display["width"] or y + h > display["height"]:
+            raise ValueError(f"{group}: {w}x{h} at {x},{y} is outside of the display")
+        for variant, png in spec["images"].items():
+            rows = rle565.read_png(os.path.join(root, png))
+            if len(rows) != h or len(rows[0]) != w:
+                rows = rle565.resize(rows, w, h)
+            pixels = rle565.to_565(rows)
+            image = rle565.encode(pixels, w)
+            raw, packed, line = rle565.measure(f"{group}_{variant}", pixels, image)
+            print(line)
+            images.append({"name": f"{group}_{variant}", "group": group, "x": x, "y": y, "w": w, "h": h,
+                           "png": png, "data": image, "raw": raw})
+    names = {i["name"] for i in images}
+    sequences = manifest.get("sequences", {})
+    for seq, members in sequences.items():
+        for m in members:
+            if m not in names:
+                raise ValueError(f"sequence {seq}: unknown image {m}")
+    return display, images, sequences
+
+
+def pack(images):
+    """Assigns aligned offsets and returns the packed data."""
+    data = bytearray()
+    for image in images:
+        data += bytes(-len(data) % ALIGN)
+        image["offset"] = len(data)
+        data += image["data"]
+    return bytes(data)
+
+
+def layout_hash(images):
+    """FNV-1a hash of the placements, in the order of the asset ids, as asset_pack.cpp calculates it."""
+    value = 0x811c9dc5
+    for image in images:
+        for b in struct.pack("<hhhh", image["x"], image["y"], image["w"], image["h"]):
+            value = ((value ^ b) * 0x01000193) & 0xffffffff
+    return value
+
+
+def write_pack(path, images):
+    """Writes the asset pack and returns its size."""
+    directory = 20 + 8 * len(images)
+    body, entries = bytearray(), []
+    for image in images:
+        body += bytes(-(directory + len(body)) % ALIGN)
+        entries.append(struct.pack("<II", directory + len(body), len(image["data"])))
+        body += image["data"]
+    payload = b"".join(entries) + bytes(body)
+    size = 20 + len(payload)
+    header = struct.pack("<IHHIII", PACK_MAGIC, PACK_VERSION, len(images), layout_hash(images), size,
+                         zlib.crc32(payload))
+    with open(path, "wb") as f:
+        f.write(header + payload)
+    return size
+
+
+def partition(path, label):
+    """Finds the offset and size of a partition in partitions.csv."""
+    with open(path) as f:
+        for row in csv.reader(line for line in f if not line.lstrip().startswith("#")):
+            row = [c.strip() for c in row]
+            if len(row) >= 5 and row[0] == label:
+                return int(row[3], 0), int(row[4], 0)
+    raise ValueError(f"{path}: no partition {label}")
+
+
+def write_header(path, display, images, sequences, size):
+    out = [BANNER, "#ifndef _ASSETS_H_", "#define _ASSETS_H_", "",
+           '#include "Arduino.h"', '#include "../display_spi/mcu_spi_magic.h"', '#include "asset_pack.h"', "",
+           f"#define ASSET_ALIGN {ALIGN}", "",
+           "/**", " * @brief Placement and location of a compiled image", " */",
+           "struct asset_info {",
+           "    uint32_t offset;    // of the rle565 image in asset_data",
+           "    uint32_t size;      // of the rle565 image in bytes",
+           "    int16_t x;", "    int16_t y;", "    int16_t w;", "    int16_t h;", "};", "",
+           "/**", " * @brief Identifies the compiled images", " */", "enum asset_id : uint8_t {"]
+    for image in images:
+        out.append(f"    ASSET_{identifier(image['name'])},")
+    out += ["    ASSET_COUNT", "};", "",
+            f"constexpr uint32_t asset_data_size = {size};",
+            "constexpr asset_info asset_table[ASSET_COUNT] = {"]
+    for image in images:
+        out.append(f"    {{ {image['offset']:>6}, {len(image['data']):>5}, {image['x']:>3}, {image['y']:>3}, "
+                   f"{image['w']:>3}, {image['h']:>3} }},    // {image['name']} from {image['png']}")
+    out += ["};", ""]
+    for seq, members in sequences.items():
+        ids = ", ".join(f"ASSET_{identifier(m)}" for m in members)
+        out.append(f"constexpr asset_id assets_{seq}[{len(members)}] = {{ {ids} }};")
+    out += ["", "#if ASSETS_IN_PARTITION",
+            "/**", " * @brief Makes the images available", " * @returns True if the asset pack was loaded", " */",
+            "inline bool assets_begin() { return asset_pack_begin(); }", "",
+            "/**", " * @brief Gets a compiled image", " * @param id - the image",
+            " * @returns The rle565 image, nullptr if the asset pack was not loaded", " */",
+            "inline const unsigned char* asset_image(asset_id id) { return asset_pack_image(id); }",
+            "#else",
+            "extern const unsigned char asset_data[] PROGMEM;", "",
+            "/**", " * @brief Makes the images available", " * @returns True, the images are linked into the firmware", " */",
+            "inline bool assets_begin() { return true; }", "",
+            "/**", " * @brief Gets a compiled image", " * @param id - the image",
+            " * @returns The rle565 image", " */",
+            "inline const unsigned char* asset_image(asset_id id) { return asset_data + asset_table[id].offset; }",
+            "#endif", "",
+            "/**", " * @brief Checks that an image lies within the display and the packed data", " */",
+            "constexpr bool asset_is_valid(asset_id id)", "{",
+            "    return asset_table[id].x >= 0 && asset_table[id].y >= 0 &&",
+            "        asset_table[id].x + asset_table[id].w <= TFT_WIDTH && asset_table[id].y + asset_table[id].h <= TFT_HEIGHT &&",
+            "        asset_table[id].offset % ASSET_ALIGN == 0 && asset_table[id].offset + asset_table[id].size <= asset_data_size;",
+            "}", "",
+            "/**", " * @brief Checks that two images occupy the same screen region", " */",
+            "constexpr bool asset_same_area(asset_id a, asset_id b)", "{",
+            "    return asset_table[a].x == asset_table[b].x && asset_table[a].y == asset_table[b].y &&",
+            "        asset_table[a].w == asset_table[b].w && asset_table[a].h == asset_table[b].h;",
+            "}", ""]
+    out.append(f'static_assert(TFT_WIDTH == {display["width"]} && TFT_HEIGHT == {display["height"]}, '
+               f'"assets were compiled for a {display["width"]}x{display["height"]} display");')
+    for image in images:
+        ident = identifier(image["name"])
+        out.append(f'static_assert(asset_is_valid(ASSET_{ident}), "{image["name"]} is outside of the display or the asset data");')
+    out.append("")
+    groups = {}
+    for image in images:
+        groups.setdefault(image["group"], []).append(identifier(image["name"]))
+    for group, members in groups.items():
+        for other in members[1:]:
+            out.append(f'static_assert(asset_same_area(ASSET_{members[0]}, ASSET_{other}), "{group} images differ in placement");')
+    out += ["", "#endif", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+
+def write_source(path, images, data):
+    out = [BANNER, '#include "assets.h"', "", "#if !ASSETS_IN_PARTITION",
+           "alignas(ASSET_ALIGN) const unsigned char asset_data[] PROGMEM = {"]
+    pos = 0
+    for image in images:
+        if image["offset"] > pos:
+            out.append("    " + ",".join("0" for _ in range(image["offset"] - pos)) + ",")
+        out.append(f"    // {image['name']}")
+        body = image["data"]
+        for i in range(0, len(body), 48):
+            out.append("    " + ",".join(str(b) for b in body[i:i + 48]) + ",")
+        pos = image["offset"] + len(body)
+    out += ["};", "",
+            'static_assert(sizeof(asset_data) == asset_data_size, "asset_data does not match the asset table");',
+            "#endif", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser.add_argument("--manifest", default=os.path.join(root, "assets", "manifest.json"))
+    parser.add_argument("--out", default=os.path.join(root, "src", "controller_display"))
+    parser.add_argument("--pack", help="also write the asset pack for the assets partition to this file")
+    parser.add_argument("--partitions", default=os.path.join(root, "partitions.csv"))
+    args = parser.parse_args()
+
+    display, images, sequences = load(args.manifest)
+    data = pack(images)
+    write_header(os.path.join(args.out, HEADER), display, images, sequences, len(data))
+    write_source(os.path.join(args.out, SOURCE), images, data)
+    raw = sum(i["raw"] for i in images)
+    print(f"{len(images)} images, {raw} -> {len(data)} bytes, {raw / len(data):.1f}:1")
+    if args.pack:
+        size = write_pack(args.pack, images)
+        offset, capacity = partition(args.partitions, PACK_PARTITION)
+        if size > capacity:
+            raise ValueError(f"asset pack of {size} bytes does not fit the {capacity} byte {PACK_PARTITION} partition")
+        print(f"{args.pack}: {size} bytes, layout {layout_hash(images):08x}, "
+              f"flash with: esptool.py write_flash 0x{offset:x} {args.pack}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,321 @@
+#!/usr/bin/env python3
+# Copyright (c) Thor Schueler. All rights reserved.
+# SPDX-License-Identifier: MIT
+"""
+Decodes the binary log frames written by src/logging/SerialLogger.cpp with LOGGER_BINARY set.
+
+A frame carries the FNV-1a hash of the format instead of the text, so the decoder needs the formats of the
+firmware that wrote the stream. They are extracted from the sources: every string literal passed to Info,
+Info_f, Error, Error_f and the LOG_* macros, with adjacent literals and string macros joined as the compiler does. Extract them
+when building a release and keep the dictionary with the binary, or point the decoder at the matching sources.
+
+Bytes outside of valid frames (boot messages, text written before binary mode was selected) are passed through.
+Trace frames (src/metrics/trace.h) are skipped, tools/trace_to_chrome.py converts them.
+
+Usage:
+    log_decoder.py dictionary [--source .] [--out log_dictionary.json]
+    log_decoder.py decode [--source . | --dictionary log_dictionary.json] [CAPTURE]
+        reads the capture from stdin if no file is given, e.g.
+        stty -F /dev/ttyUSB0 115200 raw && log_decoder.py decode < /dev/ttyUSB0
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+MAGIC = 0xA5
+TRACE_MAGIC = 0xA6
+FRAME_LEVEL = 0x07
+FRAME_RAW = 0x08
+FRAME_STATIC = 0x10
+FRAME_TRUNCATED = 0x20
+LEVELS = ["[TRACE]", "[DEBUG]", "[INFO]", "[WARN]", "[ERROR]"]
+CATEGORIES = ["", "[system] ", "[controller] ", "[rpm] ", "[display] ", "[spi] "]
+    # log_category of src/logging/SerialLogger.h
+
+CALL = re.compile(r"\b(?:\w+\s*(?:\.|->)\s*(?:Info|Error)(?:_f)?\s*\(|LOG_(?:TRACE|DEBUG|INFO|WARN|ERROR)\s*\(\s*\w+\s*,)")
+DEFINE = re.compile(r"^\s*#\s*define\s+(\w+)\s+((?:\"(?:[^\"\\]|\\.)*\"\s*)+)(?://.*)?$", re.M)
+LITERAL = re.compile(r"\"((?:[^\"\\]|\\.)*)\"")
+TOKEN = re.compile(r"\s*(?:\"((?:[^\"\\]|\\.)*)\"|(\w+))")
+SPEC = re.compile(r"%([-+ #0']*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|q|j|z|t|L)?(.?)", re.S)
+SOURCES = (".cpp", ".h", ".ino")
+
+
+def fnv1a(data):
+    value = 0x811c9dc5
+    for b in data:
+        value = ((value ^ b) * 0x01000193) & 0xffffffff
+    return value or 1
+
+
+def unescape(text):
+    """Resolves the escapes of a C string literal."""
+    out, i = bytearray(), 0
+    simple = {"n": 10, "r": 13, "t": 9, "\\": 92, "\"": 34, "'": 39, "a": 7, "b": 8, "f": 12, "v": 11, "?": 63}
+    raw = text.encode("utf-8")
+    while i < len(raw):
+        c = raw[i]
+        if c != 92:
+            out.append(c)
+            i += 1
+            continue
+        e = chr(raw[i + 1])
+        if e in simple:
+            out.append(simple[e])
+            i += 2
+        elif e == "x":
+            m = re.match(rb"[0-9a-fA-F]+", raw[i + 2:])
+            out.append(int(m.group(0), 16) & 0xff)
+            i += 2 + len(m.group(0))
+        elif e in "01234567":
+            m = re.match(rb"[0-7]{1,3}", raw[i + 1:])
+            out.append(int(m.group(0), 8) & 0xff)
+            i += 1 + len(m.group(0))
+        else:
+            out.append(raw[i + 1])
+            i += 2
+    return bytes(out)
+
+
+def source_files(root):
+    for base, dirs, files in os.walk(root):
+        dirs[:] = [d for d in dirs if not d.startswith(".") and not d.startswith("_")]
+        for name in files:
+            if name.endswith(SOURCES):
+                yield os.path.join(base, name)
+
+
+def extract(root):
+    """Finds the formats logged by the sources. Returns id -> { format, places }."""
+    texts = {}
+    for path in source_files(root):
+        with open(path, encoding="utf-8", errors="replace") as f:
+            texts[path] = f.read()
+    macros = {}
+    for text in texts.values():
+        for m in DEFINE.finditer(text):
+            macros[m.group(1)] = b"".join(unescape(s) for s in LITERAL.findall(m.group(2)))
+
+    dictionary = {}
+    for path, text in sorted(texts.items()):
+        for call in CALL.finditer(text):
+            pos = call.end()
+            m = re.match(r"\s*F\s*\(", text[pos:])
+            if m:
+                pos += m.end()
+            parts = []
+            while True:
+                m = TOKEN.match(text, pos)
+                if not m:
+                    break
+                if m.group(1) is not None:
+                    parts.append(unescape(m.group(1)))
+                elif m.group(2) in macros:
+                    parts.append(macros[m.group(2)])
+                else:
+                    break
+                pos = m.end()
+            if not parts:
+                continue
+                # not a literal, the firmware sends such messages as text
+            fmt = b"".join(parts)
+            key = f"{fnv1a(fmt):08x}"
+            place = f"{os.path.relpath(path, root)}:{text.count(chr(10), 0, call.start()) + 1}"
+            entry = dictionary.setdefault(key, {"format": fmt.decode("utf-8", "replace"), "places": []})
+            if entry["format"] != fmt.decode("utf-8", "replace"):
+                print(f"warning: {place}: hash collision with {entry['places'][0]}", file=sys.stderr)
+            entry["places"].append(place)
+    return dictionary
+
+
+def varint(data, pos):
+    value, shift = 0, 0
+    while True:
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7f) << shift
+        shift += 7
+        if b < 0x80:
+            return value, pos
+
+
+def zigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def render(fmt, data):
+    """Formats the arguments of a frame with its format. Returns the text and whether arguments were missing."""
+    out, pos, last = [], 0, 0
+    for m in SPEC.finditer(fmt):
+        out.append(fmt[last:m.start()])
+        last = m.end()
+        flags, width, precision, length, conversion = m.groups()
+        if conversion == "%" and m.group(0) == "%%":
+            out.append("%")
+            continue
+        if conversion == "" or conversion not in "diuoxXceEfFgGaAspn":
+            out.append(m.group(0))
+            continue
+        if conversion == "n":
+            continue
+        try:
+            if width == "*":
+                v, pos = varint(data, pos)
+                width = str(zigzag(v))
+            if precision == "*":
+                v, pos = varint(data, pos)
+                precision = str(zigzag(v))
+            flags = flags.replace("'", "")
+            spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+            if conversion == "s":
+                n, pos = varint(data, pos)
+                value = data[pos:pos + n].decode("utf-8", "replace")
+                if pos + n > len(data):
+                    raise IndexError
+                pos += n
+                out.append((spec + "s") % value)
+            elif conversion in "eEfFgGaA":
+                if pos + 8 > len(data):
+                    raise IndexError
+                value = struct.unpack_from("<d", data, pos)[0]
+                pos += 8
+                out.append(value.hex() if conversion in "aA" else (spec + conversion) % value)
+            else:
+                value, pos = varint(data, pos)
+                if conversion in "di":
+                    value = zigzag(value)
+                if length in ("h", "hh"):
+                    bits = 16 if length == "h" else 8
+                    value &= (1 << bits) - 1
+                    if conversion in "di" and value >= 1 << (bits - 1):
+                        value -= 1 << bits
+                        # the argument was promoted to int, the conversion narrows it again
+                if conversion in "di":
+                    out.append((spec + "d") % value)
+                elif conversion == "u":
+                    out.append((spec + "d") % value)
+                elif conversion == "c":
+                    out.append((spec + "s") % chr(value))
+                elif conversion == "p":
+                    out.append("0x%x" % value)
+                elif conversion == "o":
+                    out.append(((spec + "o") % value).replace("0o", "0", 1))
+                        # C writes the alternate form of octal with a leading 0
+                else:
+                    out.append((spec + conversion) % value)
+        except IndexError:
+            return "".join(out) + "...", True
+    out.append(fmt[last:])
+    return "".join(out), False
+
+
+class Decoder:
+    """Splits a captured stream into frames and text, as it arrives."""
+
+    def __init__(self, dictionary, write):
+        self.dictionary = dictionary
+        self.write = write
+        self.data = b""
+
+    def feed(self, chunk, final=False):
+        data = self.data + chunk
+        i, text_start = 0, 0
+        while i < len(data):
+            if data[i] != MAGIC and data[i] != TRACE_MAGIC:
+                i += 1
+                continue
+            if i + 1 >= len(data) or i + 2 + data[i + 1] >= len(data):
+                if not final:
+                    break
+                    # the frame may be completed by the next chunk
+                i += 1
+                continue
+            length = data[i + 1]
+            end = i + 2 + length
+            if length < (7 if data[i] == MAGIC else 1) or crc8(data[i + 1:end]) != data[end]:
+                i += 1
+                continue
+            if i > text_start:
+                self.write(data[text_start:i].decode("utf-8", "replace"))
+            if data[i] == MAGIC:
+                self.write(frame(data[i + 2:end], self.dictionary))
+            i = end + 1
+            text_start = i
+        if i > text_start:
+            self.write(data[text_start:i].decode("utf-8", "replace"))
+        self.data = data[i:]
+
+
+def frame(body, dictionary):
+    """Turns the body of a frame (flags to the last argument) into a log line."""
+    flags, category = body[0], body[1]
+    ident = struct.unpack_from("<I", body, 2)[0]
+    us, pos = varint(body, 6)
+    args = body[pos:]
+    if ident == 0:
+        text = args.decode("utf-8", "replace")
+    elif f"{ident:08x}" not in dictionary:
+        text = f"<unknown message {ident:08x} with {len(args)} argument bytes>"
+    elif flags & FRAME_STATIC:
+        text = dictionary[f"{ident:08x}"]["format"]
+    else:
+        text, missing = render(dictionary[f"{ident:08x}"]["format"], args)
+        if flags & FRAME_TRUNCATED and not missing:
+            text += "..."
+    if flags & FRAME_RAW:
+        return text
+    level = LEVELS[min(flags & FRAME_LEVEL, len(LEVELS) - 1)]
+    category = CATEGORIES[category] if category < len(CATEGORIES) else f"[{category}] "
+    return f"; {us / 1e6:12.6f} {level} {category}{text}\r\n"
+
+
+def crc8(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xff if crc & 0x80 else (crc << 1) & 0xff
+    return crc
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser.add_argument("mode", choices=["dictionary", "decode"])
+    parser.add_argument("capture", nargs="?", help="captured serial stream, stdin if omitted")
+    parser.add_argument("--source", default=root, help="firmware sources to extract the formats from")
+    parser.add_argument("--dictionary", help="dictionary written by the dictionary mode, instead of --source")
+    parser.add_argument("--out", default="log_dictionary.json")
+    args = parser.parse_intermixed_args()
+
+    if args.mode == "dictionary":
+        dictionary = extract(args.source)
+        with open(args.out, "w") as f:
+            json.dump(dictionary, f, indent=1, sort_keys=True)
+        print(f"{args.out}: {len(dictionary)} formats")
+        return
+
+    if args.dictionary:
+        with open(args.dictionary) as f:
+            dictionary = json.load(f)
+    else:
+        dictionary = extract(args.source)
+    def write(text):
+        sys.stdout.write(text)
+        sys.stdout.flush()
+
+    decoder = Decoder(dictionary, write)
+    stream = open(args.capture, "rb") if args.capture else sys.stdin.buffer
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+        if not chunk:
+            break
+        decoder.feed(chunk)
+    decoder.feed(b"", final=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+# Copyright (c) Thor Schueler. All rights reserved.
+# SPDX-License-Identifier: MIT
+"""
+Converts display assets to the rle565 format decoded by src/display_spi/rle565.h.
+
+An rle565 image is a byte array:
+
+    'R' 'L'  width (u16 le)  height (u16 le)
+    height x row offset (u32 le, relative to the first data byte)
+    row data
+
+Every row is encoded on its own, so the blitter can start decoding at any row of a clipped region. A row is a
+sequence of tokens. A token byte with the high bit set is a run: (token & 0x7f) + 1 copies of the RGB565 pixel
+that follows. Otherwise it is a literal: token + 1 pixels follow. Pixels are big endian, as the display expects
+them on the bus.
+
+Usage:
+    rle565.py png IMAGE.png [--size WxH] [--name NAME]   print an asset as C source
+    rle565.py rewrite FILE.cpp [...] [--width W]         compress the raw arrays in asset sources in place
+    rle565.py report FILE.cpp [...] [--width W]          print compression ratio and decode throughput only
+"""
+
+import argparse
+import re
+import struct
+import sys
+import time
+import zlib
+
+MAGIC = b"RL"
+MAX_TOKEN = 128
+MARKER = "// rle565"
+
+
+def read_png(path):
+    """Decodes an 8 bit, non interlaced PNG into a list of rows of (r, g, b) tuples."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG")
+    pos, idat, palette = 8, b"", None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + length
+    if depth != 8 or interlace != 0:
+        raise ValueError(f"{path}: only 8 bit non interlaced images are supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows, prev = [], bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif kind == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xff
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        prev = line
+        pixels = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if color == 3:
+                pixels.append(palette[px[0]])
+            elif color in (0, 4):
+                pixels.append((px[0], px[0], px[0]))
+            else:
+                pixels.append(tuple(px[:3]))
+                # alpha is dropped, the artwork is drawn on black
+            if color in (4, 6):
+                alpha = px[-1]
+                pixels[-1] = tuple(v * alpha // 255 for v in pixels[-1])
+        rows.append(pixels)
+    return rows
+
+
+def resize(rows, width, height):
+    """Box filter resize, the artwork is drawn at a multiple of the display resolution."""
+    src_h, src_w = len(rows), len(rows[0])
+    out = []
+    for y in range(height):
+        y0, y1 = y * src_h // height, max(y * src_h // height + 1, (y + 1) * src_h // height)
+        line = []
+        for x in range(width):
+            x0, x1 = x * src_w // width, max(x * src_w // width + 1, (x + 1) * src_w // width)
+            acc, n = [0, 0, 0], 0
+            for sy in range(y0, y1):
+                for sx in range(x0, x1):
+                    for k in range(3):
+                        acc[k] += rows[sy][sx][k]
+                    n += 1
+            line.append(tuple(v // n for v in acc))
+        out.append(line)
+    return out
+
+
+def to_565(rows):
+    """Converts rows of (r, g, b) to a flat list of RGB565 values."""
+    return [((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3) for line in rows for (r, g, b) in line]
+
+
+def encode(pixels, width):
+    """Encodes a flat list of RGB565 pixels into an rle565 image."""
+    if len(pixels) % width:
+        raise ValueError(f"{len(pixels)} pixels do not divide into rows of {width}")
+    height = len(pixels) // width
+    offsets, data = [], bytearray()
+    for y in range(height):
+        offsets.append(len(data))
+        row = pixels[y * width:(y + 1) * width]
+        x = 0
+        while x < width:
+            run = 1
+            while x + run < width and run < MAX_TOKEN and row[x + run] == row[x]:
+                run += 1
+            if run >= 2:
+                data += bytes([0x80 | (run - 1)]) + struct.pack(">H", row[x])
+                x += run
+                continue
+            # literal up to the next run of at least three, a run of two costs as much as two literals
+            end = x + 1
+            while end < width and end - x < MAX_TOKEN:
+                if end + 2 < width and row[end] == row[end + 1] == row[end + 2]:
+                    break
+                end += 1
+            data.append(end - x - 1)
+            for p in row[x:end]:
+                data += struct.pack(">H", p)
+            x = end
+    header = MAGIC + struct.pack("<HH", width, height) + b"".join(struct.pack("<I", o) for o in offsets)
+    return bytes(header + data)
+
+
+def decode(image):
+    """Reference decoder, returns the flat list of RGB565 pixels."""
+    if image[:2] != MAGIC:
+        raise ValueError("not an rle565 image")
+    width, height = struct.unpack("<HH", image[2:6])
+    base = 6 + 4 * height
+    pixels = []
+    for y in range(height):
+        pos = base + struct.unpack("<I", image[6 + 4 * y:10 + 4 * y])[0]
+        n = 0
+        while n < width:
+            token = image[pos]
+            count = (token & 0x7f) + 1
+            if token & 0x80:
+                pixels += [(image[pos + 1] << 8) | image[pos + 2]] * count
+                pos += 3
+            else:
+                pixels += [(image[pos + 1 + 2 * i] << 8) | image[pos + 2 + 2 * i] for i in range(count)]
+                pos += 1 + 2 * count
+            n += count
+    return pixels
+
+
+def measure(name, pixels, image):
+    """Checks the round trip and returns a report line."""
+    start = time.perf_counter()
+    decoded = decode(image)
+    elapsed = time.perf_counter() - start
+    if decoded != pixels:
+        raise ValueError(f"{name}: round trip mismatch")
+    raw = len(pixels) * 2
+    rate = len(pixels) / elapsed / 1e6 if elapsed > 0 else float("inf")
+    return raw, len(image), f"{name:<24} {raw:>8} -> {len(image):>7} bytes  {raw / len(image):5.1f}:1  " \
+                            f"decode {rate:6.2f} Mpx/s (reference decoder)"
+
+
+def c_array(name, image):
+    """Formats an rle565 image as an asset array."""
+    lines = [f"const unsigned char {name}[] PROGMEM={{ {MARKER}"]
+    for i in range(0, len(image), 48):
+        prefix = "    " if i == 0 else "    ,"
+        lines.append(prefix + ",".join(str(b) for b in image[i:i + 48]))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+ARRAY = re.compile(r"const unsigned char (\w+)\[\] PROGMEM=\{(.*?)\n\};", re.S)
+NUMBER = re.compile(r"0x[0-9a-fA-F]+|\d+")
+WIDTH = re.compile(r"const unsigned int (\w+)_w = (\d+);")
+
+
+def asset_width(name, widths, default):
+    """Finds the width of an asset array from the NAME_w constants, dropping name parts from the end."""
+    parts = name.split("_")
+    while parts:
+        key = "_".join(parts)
+        if key in widths:
+            return widths[key]
+        parts.pop()
+    return default
+
+
+def process(path, default_width, rewrite):
+    """Compresses the raw arrays of an asset source and reports the ratios."""
+    with open(path) as f:
+        source = f.read()
+    widths = {m.group(1): int(m.group(2)) for m in WIDTH.finditer(source)}
+    totals = [0, 0]
+
+    def convert(match):
+        name, body = match.group(1), match.group(2)
+        compressed = body.lstrip().startswith(MARKER)
+        if compressed:
+            body = body.split("\n", 1)[1]
+        values = bytes(int(v, 0) if v.startswith("0x") else int(v) for v in NUMBER.findall(body))
+        if compressed:
+            pixels = decode(values)
+            image = values
+        else:
+            width = asset_width(name, widths, default_width)
+            pixels = [(values[i] << 8) | values[i + 1] for i in range(0, len(values), 2)]
+            image = encode(pixels, width)
+        raw, packed, line = measure(name, pixels, image)
+        totals[0] += raw
+        totals[1] += packed
+        print(line)
+        return c_array(name, image)
+
+    result = ARRAY.sub(convert, source)
+    if totals[1]:
+        print(f"{path}: {totals[0]} -> {totals[1]} bytes, {totals[0] / totals[1]:.1f}:1")
+    if rewrite and result != source:
+        with open(path, "w") as f:
+            f.write(result)
+    return totals
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("mode", choices=["png", "rewrite", "report"])
+    parser.add_argument("files", nargs="+")
+    parser.add_argument("--size", help="resize a PNG to WxH")
+    parser.add_argument("--name", help="array name for a PNG, defaults to the file name")
+    parser.add_argument("--width", type=int, default=240, help="width of arrays without a NAME_w constant")
+    args = parser.parse_args()
+
+    if args.mode == "png":
+        for path in args.files:
+            rows = read_png(path)
+            if args.size:
+                w, h = (int(v) for v in args.size.lower().split("x"))
+                rows = resize(rows, w, h)
+            name = args.name or re.sub(r"\W", "_", path.rsplit("/", 1)[-1].rsplit(".", 1)[0])
+            pixels = to_565(rows)
+            image = encode(pixels, len(rows[0]))
+            print(measure(name, pixels, image)[2], file=sys.stderr)
+            print(c_array(name, image))
+        return
+
+    totals = [0, 0]
+    for path in args.files:
+        raw, packed = process(path, args.width, args.mode == "rewrite")
+        totals[0] += raw
+        totals[1] += packed
+    if len(args.files) > 1 and totals[1]:
+        print(f"total: {totals[0]} -> {totals[1]} bytes, {totals[0] / totals[1]:.1f}:1")
+
+
+if __name__ == "__main__":
+    main()
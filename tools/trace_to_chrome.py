@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# Copyright (c) Thor Schueler. All rights reserved.
+# SPDX-License-Identifier: MIT
+"""
+Converts the trace frames streamed by src/metrics/trace.cpp into Chrome trace JSON, to be opened in
+chrome://tracing or ui.perfetto.dev.
+
+Start the trace by sending "trace" on the serial console, capture the stream, send "trace" again to stop. The
+capture may contain the log as text or binary frames, everything but trace frames is skipped. Each core is
+shown as a process, each task as a thread and the interrupt handlers of a core as the thread "ISR".
+
+Usage:
+    trace_to_chrome.py [CAPTURE] [--out trace.json]
+        reads the capture from stdin if no file is given, e.g.
+        stty -F /dev/ttyUSB0 115200 raw && cat /dev/ttyUSB0 > capture.bin
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0xA6
+KIND_NAME = 0
+KIND_EVENTS = 1
+KIND_DROPPED = 2
+TASK_ISR = 0xFF
+EVENT = struct.Struct("<IHBB")
+    # trace_event of src/metrics/trace.h
+
+
+def crc8(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xff if crc & 0x80 else (crc << 1) & 0xff
+    return crc
+
+
+def frames(data):
+    """Finds the trace frames in a capture. Yields the kind and the payload of each."""
+    i = 0
+    while i + 3 < len(data):
+        if data[i] != MAGIC:
+            i += 1
+            continue
+        length = data[i + 1]
+        end = i + 2 + length
+        if length < 1 or end >= len(data) or crc8(data[i + 1:end]) != data[end]:
+            i += 1
+            continue
+        yield data[i + 2], data[i + 3:end]
+        i = end + 1
+
+
+def convert(data):
+    """Turns a capture into the list of Chrome trace events. Returns the events and the dropped counts."""
+    points, tasks, events, dropped = {}, {}, [], {}
+    last = {}
+    for kind, payload in frames(data):
+        if kind == KIND_NAME and len(payload) >= 3:
+            table = points if payload[0] == 0 else tasks
+            table[payload[1] | payload[2] << 8] = payload[3:].decode("utf-8", "replace")
+        elif kind == KIND_EVENTS and len(payload) % EVENT.size == 1:
+            core = payload[0]
+            for pos in range(1, len(payload), EVENT.size):
+                us, point, task, phase = EVENT.unpack_from(payload, pos)
+                base, previous = last.get(core, (0, None))
+                if previous is not None and us < previous and previous - us > 1 << 31:
+                    base += 1 << 32
+                        # the 32 bit time stamp wrapped
+                last[core] = (base, us)
+                events.append((core, base + us, point, task, chr(phase)))
+        elif kind == KIND_DROPPED and len(payload) == 5:
+            dropped[payload[0]] = struct.unpack_from("<I", payload, 1)[0]
+
+    trace = []
+    threads = set()
+    for core, ts, point, task, phase in events:
+        event = {"name": points.get(point, f"point {point}"), "ph": phase, "ts": ts, "pid": core, "tid": task}
+        if phase == "i":
+            event["s"] = "t"
+        trace.append(event)
+        threads.add((core, task))
+    for core in sorted({c for c, _ in threads}):
+        trace.append({"name": "process_name", "ph": "M", "pid": core, "args": {"name": f"core {core}"}})
+    for core, task in sorted(threads):
+        name = "ISR" if task == TASK_ISR else tasks.get(task, f"task {task}")
+        trace.append({"name": "thread_name", "ph": "M", "pid": core, "tid": task, "args": {"name": name}})
+        if task == TASK_ISR:
+            trace.append({"name": "thread_sort_index", "ph": "M", "pid": core, "tid": task, "args": {"sort_index": -1}})
+    return trace, dropped, len(events)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", nargs="?", help="captured serial stream, stdin if omitted")
+    parser.add_argument("--out", default="trace.json")
+    args = parser.parse_args()
+
+    if args.capture:
+        with open(args.capture, "rb") as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+    trace, dropped, count = convert(data)
+    with open(args.out, "w") as f:
+        json.dump({"traceEvents": trace, "displayTimeUnit": "ms"}, f)
+    print(f"{args.out}: {count} events")
+    for core, n in sorted(dropped.items()):
+        if n:
+            print(f"warning: {n} events dropped on core {core}, the drain task could not keep up", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()